@@ -41,6 +41,7 @@ HYPRE_IJMatrixCreate( MPI_Comm        comm,
    hypre_IJMatrixObject(ijmatrix)         = NULL;
    hypre_IJMatrixTranslator(ijmatrix)     = NULL;
    hypre_IJMatrixAssumedPart(ijmatrix)    = NULL;
+   hypre_IJMatrixUpdatePlan(ijmatrix)     = NULL;
    hypre_IJMatrixObjectType(ijmatrix)     = HYPRE_UNITIALIZED;
    hypre_IJMatrixAssembleFlag(ijmatrix)   = 0;
    hypre_IJMatrixPrintLevel(ijmatrix)     = 0;
@@ -711,6 +712,89 @@ HYPRE_IJMatrixAssemble( HYPRE_IJMatrix matrix )
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_IJMatrixSetUpdatePattern( HYPRE_IJMatrix       matrix,
+                                HYPRE_Int            nrows,
+                                HYPRE_Int           *ncols,
+                                const HYPRE_BigInt  *rows,
+                                const HYPRE_BigInt  *cols )
+{
+   hypre_IJMatrix *ijmatrix = (hypre_IJMatrix *) matrix;
+
+   if (!ijmatrix)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   if (nrows < 0)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+
+   if (nrows && !rows)
+   {
+      hypre_error_in_arg(4);
+      return hypre_error_flag;
+   }
+
+   if (nrows && !cols)
+   {
+      hypre_error_in_arg(5);
+      return hypre_error_flag;
+   }
+
+   if ( hypre_IJMatrixObjectType(ijmatrix) != HYPRE_PARCSR ||
+        !hypre_IJMatrixAssembleFlag(ijmatrix) )
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   if (hypre_GetExecPolicy1(hypre_IJMatrixMemoryLocation(ijmatrix)) == HYPRE_EXEC_DEVICE)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Update plans are only available on the host!\n");
+      return hypre_error_flag;
+   }
+
+   return ( hypre_IJMatrixSetUpdatePatternParCSR( ijmatrix, nrows, ncols, rows, cols ) );
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_IJMatrixUpdateValues( HYPRE_IJMatrix       matrix,
+                            HYPRE_Int            action,
+                            const HYPRE_Complex *values )
+{
+   hypre_IJMatrix *ijmatrix = (hypre_IJMatrix *) matrix;
+
+   if (!ijmatrix || !hypre_IJMatrixUpdatePlan(ijmatrix))
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   if (action != 0 && action != 1)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+
+   if (!values && hypre_IJUpdatePlanNumValues(hypre_IJMatrixUpdatePlan(ijmatrix)))
+   {
+      hypre_error_in_arg(3);
+      return hypre_error_flag;
+   }
+
+   return ( hypre_IJMatrixUpdateValuesParCSR( ijmatrix, action, values ) );
+}
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
@@ -199,6 +199,36 @@ HYPRE_Int HYPRE_IJMatrixAddToValues2(HYPRE_IJMatrix       matrix,
  **/
 HYPRE_Int HYPRE_IJMatrixAssemble(HYPRE_IJMatrix matrix);
 
+/**
+ * (Optional) Records a fixed list of entries whose values will be updated
+ * repeatedly, e.g., at every step of a nonlinear solve.  The entries are
+ * given as in IJMatrixAddToValues, without the values, and may lie in rows
+ * owned by other processors or be repeated.  The matrix must be assembled
+ * and already contain every entry of the pattern.  Each call replaces the
+ * previous pattern.  The pattern is dropped when the matrix is initialized
+ * again.  Collective.
+ *
+ * Positions in the local matrix and the communication of off-processor
+ * entries are resolved once here, so that IJMatrixUpdateValues needs
+ * neither column searches nor a new assembly.
+ **/
+HYPRE_Int HYPRE_IJMatrixSetUpdatePattern(HYPRE_IJMatrix       matrix,
+                                         HYPRE_Int            nrows,
+                                         HYPRE_Int           *ncols,
+                                         const HYPRE_BigInt  *rows,
+                                         const HYPRE_BigInt  *cols);
+
+/**
+ * (Optional) Updates the entries of the pattern set by
+ * IJMatrixSetUpdatePattern.  The \e values array is ordered as the pattern.
+ * Contributions to the same entry, including those from other processors,
+ * are summed.  If \e action is 0, each entry of the pattern is replaced by
+ * this sum; if \e action is 1, the sum is added to it.  Collective.
+ **/
+HYPRE_Int HYPRE_IJMatrixUpdateValues(HYPRE_IJMatrix       matrix,
+                                     HYPRE_Int            action,
+                                     const HYPRE_Complex *values);
+
 /**
  * Gets number of nonzeros elements for \e nrows rows specified in \e rows
  * and returns them in \e ncols, which needs to be allocated by the
@@ -259,6 +259,11 @@ hypre_IJMatrixInitializeParCSR_v2(hypre_IJMatrix *matrix, HYPRE_MemoryLocation m
    HYPRE_MemoryLocation memory_location_aux =
       hypre_GetExecPolicy1(memory_location) == HYPRE_EXEC_HOST ? HYPRE_MEMORY_HOST : HYPRE_MEMORY_DEVICE;
 
+   /* The positions recorded by an update plan are not valid after the
+      matrix is (re)assembled */
+   hypre_IJUpdatePlanDestroy(hypre_IJMatrixUpdatePlan(matrix));
+   hypre_IJMatrixUpdatePlan(matrix) = NULL;
+
    if (hypre_IJMatrixAssembleFlag(matrix) == 0)
    {
       if (!par_matrix)
@@ -1611,10 +1616,12 @@ hypre_IJMatrixDestroyParCSR(hypre_IJMatrix *matrix)
 {
    hypre_ParCSRMatrixDestroy((hypre_ParCSRMatrix *)hypre_IJMatrixObject(matrix));
    hypre_AuxParCSRMatrixDestroy((hypre_AuxParCSRMatrix*)hypre_IJMatrixTranslator(matrix));
+   hypre_IJUpdatePlanDestroy(hypre_IJMatrixUpdatePlan(matrix));
 
    /* Reset pointers to NULL */
    hypre_IJMatrixObject(matrix)     = NULL;
    hypre_IJMatrixTranslator(matrix) = NULL;
+   hypre_IJMatrixUpdatePlan(matrix) = NULL;
 
    return hypre_error_flag;
 }
@@ -2530,7 +2537,6 @@ hypre_IJMatrixAssembleParCSR(hypre_IJMatrix *matrix)
    HYPRE_BigInt col_0, col_n;
    HYPRE_Int nnz_offd;
    HYPRE_BigInt *big_offd_j;
-   HYPRE_BigInt *tmp_j;
    HYPRE_Complex temp;
    HYPRE_BigInt base = hypre_IJMatrixGlobalFirstCol(matrix);
    HYPRE_Int off_proc_i_indx;
@@ -2553,6 +2559,11 @@ hypre_IJMatrixAssembleParCSR(hypre_IJMatrix *matrix)
 
    max_num_threads = hypre_NumThreads();
 
+   /* the merged diag/offd copy and the compressed column indices, if any,
+      no longer match the matrix */
+   hypre_ParCSRMatrixDestroyMergedLayout(par_matrix);
+   hypre_CSRMatrixUncompressIndices(diag);
+
    /* first find out if anyone has an aux_matrix, and create one if you don't
     * have one, but other procs do */
    aux_flag = 0;
@@ -2868,32 +2879,8 @@ hypre_IJMatrixAssembleParCSR(hypre_IJMatrix *matrix)
       nnz_offd = offd_i[num_rows];
       if (nnz_offd)
       {
-         tmp_j = hypre_CTAlloc(HYPRE_BigInt, nnz_offd, HYPRE_MEMORY_HOST);
-         for (i = 0; i < nnz_offd; i++)
-         {
-            tmp_j[i] = big_offd_j[i];
-         }
-         hypre_BigQsort0(tmp_j, 0, nnz_offd - 1);
-         num_cols_offd = 1;
-         for (i = 0; i < nnz_offd - 1; i++)
-         {
-            if (tmp_j[i + 1] > tmp_j[i])
-            {
-               tmp_j[num_cols_offd++] = tmp_j[i + 1];
-            }
-         }
-         col_map_offd = hypre_CTAlloc(HYPRE_BigInt, num_cols_offd, HYPRE_MEMORY_HOST);
-         for (i = 0; i < num_cols_offd; i++)
-         {
-            col_map_offd[i] = tmp_j[i];
-         }
-#ifdef HYPRE_USING_OPENMP
-         #pragma omp parallel for private(i)
-#endif
-         for (i = 0; i < nnz_offd; i++)
-         {
-            offd_j[i] = hypre_BigBinarySearch(col_map_offd, big_offd_j[i], num_cols_offd);
-         }
+         hypre_GlobalToLocalColumns(nnz_offd, big_offd_j, 0, NULL, offd_j, NULL,
+                                    &num_cols_offd, &col_map_offd);
 
          if (base)
          {
@@ -2904,7 +2891,6 @@ hypre_IJMatrixAssembleParCSR(hypre_IJMatrix *matrix)
          }
          hypre_ParCSRMatrixColMapOffd(par_matrix) = col_map_offd;
          hypre_CSRMatrixNumCols(offd) = num_cols_offd;
-         hypre_TFree(tmp_j, HYPRE_MEMORY_HOST);
          hypre_TFree(big_offd_j, hypre_CSRMatrixMemoryLocation(offd));
          hypre_CSRMatrixBigJ(offd) = NULL;
       }
@@ -4231,3 +4217,566 @@ hypre_IJMatrixAddToValuesOMPParCSR( hypre_IJMatrix       *matrix,
 
    return hypre_error_flag;
 }
+
+/******************************************************************************
+ *
+ * hypre_IJMatrixFindEntryParCSR
+ *
+ * Returns the position of entry (row_local, col) in the diag data array, or
+ * nnz_diag plus its position in the offd data array.  Returns -1 if the
+ * entry is not part of the assembled sparsity pattern.
+ *
+ *****************************************************************************/
+
+static HYPRE_Int
+hypre_IJMatrixFindEntryParCSR( hypre_IJMatrix *matrix,
+                               HYPRE_Int       row_local,
+                               HYPRE_BigInt    col )
+{
+   hypre_ParCSRMatrix *par_matrix       = (hypre_ParCSRMatrix *) hypre_IJMatrixObject(matrix);
+   hypre_CSRMatrix    *diag             = hypre_ParCSRMatrixDiag(par_matrix);
+   hypre_CSRMatrix    *offd             = hypre_ParCSRMatrixOffd(par_matrix);
+   HYPRE_Int          *diag_i           = hypre_CSRMatrixI(diag);
+   HYPRE_Int          *diag_j           = hypre_CSRMatrixJ(diag);
+   HYPRE_Int          *offd_i           = hypre_CSRMatrixI(offd);
+   HYPRE_Int          *offd_j           = hypre_CSRMatrixJ(offd);
+   HYPRE_Int           num_rows         = hypre_CSRMatrixNumRows(diag);
+   HYPRE_Int           num_cols_offd    = hypre_CSRMatrixNumCols(offd);
+   HYPRE_BigInt       *col_map_offd     = hypre_ParCSRMatrixColMapOffd(par_matrix);
+   HYPRE_BigInt       *col_partitioning = hypre_IJMatrixColPartitioning(matrix);
+   HYPRE_Int           j, j_offd, col_local;
+
+   if (col >= col_partitioning[0] && col < col_partitioning[1])
+   {
+      col_local = (HYPRE_Int)(col - col_partitioning[0]);
+      for (j = diag_i[row_local]; j < diag_i[row_local + 1]; j++)
+      {
+         if (diag_j[j] == col_local)
+         {
+            return j;
+         }
+      }
+   }
+   else if (num_cols_offd)
+   {
+      j_offd = hypre_BigBinarySearch(col_map_offd, col - hypre_IJMatrixGlobalFirstCol(matrix),
+                                     num_cols_offd);
+      if (j_offd > -1)
+      {
+         for (j = offd_i[row_local]; j < offd_i[row_local + 1]; j++)
+         {
+            if (offd_j[j] == j_offd)
+            {
+               return diag_i[num_rows] + j;
+            }
+         }
+      }
+   }
+
+   return -1;
+}
+
+/******************************************************************************
+ *
+ * hypre_IJUpdatePlanDestroy
+ *
+ *****************************************************************************/
+
+HYPRE_Int
+hypre_IJUpdatePlanDestroy( hypre_IJUpdatePlan *plan )
+{
+   if (plan)
+   {
+      hypre_TFree(hypre_IJUpdatePlanSlotI(plan), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_IJUpdatePlanSlotJ(plan), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_IJUpdatePlanTarget(plan), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_IJUpdatePlanTargetI(plan), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_IJUpdatePlanTargetJ(plan), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_IJUpdatePlanSendData(plan), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_IJUpdatePlanRecvData(plan), HYPRE_MEMORY_HOST);
+      if (hypre_IJUpdatePlanCommPkg(plan))
+      {
+         hypre_MatvecCommPkgDestroy(hypre_IJUpdatePlanCommPkg(plan));
+      }
+      hypre_TFree(plan, HYPRE_MEMORY_HOST);
+   }
+
+   return hypre_error_flag;
+}
+
+/******************************************************************************
+ *
+ * hypre_IJMatrixSetUpdatePatternParCSR
+ *
+ * Compiles the update plan of an assembled matrix for the entries
+ * (rows[i], cols[k]) given in the same layout as IJMatrixAddToValues.
+ * Off-processor entries are sorted and combined into slots, their owners
+ * are located once through an assumed partition of the rows, and the
+ * column indices are shipped to the owners so that each side can resolve
+ * matrix positions here rather than at every update.
+ *
+ *****************************************************************************/
+
+HYPRE_Int
+hypre_IJMatrixSetUpdatePatternParCSR( hypre_IJMatrix       *matrix,
+                                      HYPRE_Int             nrows,
+                                      HYPRE_Int            *ncols,
+                                      const HYPRE_BigInt   *rows,
+                                      const HYPRE_BigInt   *cols )
+{
+   MPI_Comm                comm             = hypre_IJMatrixComm(matrix);
+   hypre_ParCSRMatrix     *par_matrix       = (hypre_ParCSRMatrix *) hypre_IJMatrixObject(matrix);
+   hypre_CSRMatrix        *diag             = hypre_ParCSRMatrixDiag(par_matrix);
+   hypre_CSRMatrix        *offd             = hypre_ParCSRMatrixOffd(par_matrix);
+   HYPRE_Int               num_rows         = hypre_CSRMatrixNumRows(diag);
+   HYPRE_Int               nnz_diag         = hypre_CSRMatrixI(diag)[num_rows];
+   HYPRE_Int               nnz              = nnz_diag + hypre_CSRMatrixI(offd)[num_rows];
+   HYPRE_BigInt           *row_partitioning = hypre_IJMatrixRowPartitioning(matrix);
+   HYPRE_BigInt            first_row        = hypre_IJMatrixGlobalFirstRow(matrix);
+   HYPRE_Int               print_level      = hypre_IJMatrixPrintLevel(matrix);
+
+   hypre_IJUpdatePlan     *plan;
+   hypre_ParCSRCommPkg    *row_pkg;
+   hypre_ParCSRCommPkg    *comm_pkg = NULL;
+   hypre_ParCSRCommHandle *comm_handle;
+   hypre_IJAssumedPart    *apart;
+
+   HYPRE_Int               num_values, num_off, num_slots, num_off_rows, num_recv;
+   HYPRE_Int               num_targets, num_local_targets;
+   HYPRE_Int               num_row_sends, num_row_recvs;
+   HYPRE_Int              *src_target, *recv_target;
+   HYPRE_Int              *off_perm, *slot_i;
+   HYPRE_BigInt           *off_rows, *off_cols, *slot_cols, *recv_cols;
+   HYPRE_BigInt           *off_row_list;
+   HYPRE_Int              *off_row_slots, *row_slot_start, *recv_cnt;
+   HYPRE_Int              *send_procs, *send_map_starts, *send_map_elmts;
+   HYPRE_Int              *recv_procs, *recv_vec_starts;
+   HYPRE_Int              *tcount, *tmap, *target, *target_i, *target_j;
+   HYPRE_Int               i, j, k, n, r, t, ii, kb;
+   HYPRE_BigInt            row;
+
+   hypre_IJUpdatePlanDestroy(hypre_IJMatrixUpdatePlan(matrix));
+   hypre_IJMatrixUpdatePlan(matrix) = NULL;
+
+   /*-----------------------------------------------------------------------
+    * Resolve local entries, collect off-processor ones
+    *-----------------------------------------------------------------------*/
+
+   num_values = 0;
+   for (ii = 0; ii < nrows; ii++)
+   {
+      num_values += ncols ? ncols[ii] : 1;
+   }
+
+   src_target = hypre_TAlloc(HYPRE_Int, num_values, HYPRE_MEMORY_HOST);
+   off_rows   = hypre_TAlloc(HYPRE_BigInt, num_values, HYPRE_MEMORY_HOST);
+   off_perm   = hypre_TAlloc(HYPRE_Int, num_values, HYPRE_MEMORY_HOST);
+
+   num_off = 0;
+   for (ii = 0, k = 0; ii < nrows; ii++)
+   {
+      row = rows[ii];
+      n = ncols ? ncols[ii] : 1;
+      for (i = 0; i < n; i++, k++)
+      {
+         if (row >= row_partitioning[0] && row < row_partitioning[1])
+         {
+            src_target[k] = hypre_IJMatrixFindEntryParCSR(matrix,
+                                                          (HYPRE_Int)(row - row_partitioning[0]),
+                                                          cols[k]);
+            if (src_target[k] < 0)
+            {
+               hypre_error(HYPRE_ERROR_GENERIC);
+               if (print_level)
+               {
+                  hypre_printf (" Error, element %b %b does not exist\n", row, cols[k]);
+               }
+            }
+         }
+         else
+         {
+            src_target[k] = -1;
+            off_rows[num_off] = row;
+            off_perm[num_off++] = k;
+         }
+      }
+   }
+
+   /*-----------------------------------------------------------------------
+    * Sort the off-processor entries by (row, col) and combine duplicates
+    * into slots.  Sorted rows are grouped by owner in increasing rank order,
+    * which is the order of the receive side of the row communication package
+    *-----------------------------------------------------------------------*/
+
+   off_cols = hypre_TAlloc(HYPRE_BigInt, num_off, HYPRE_MEMORY_HOST);
+   hypre_BigIntSort(off_rows, off_perm, num_off);
+   for (i = 0; i < num_off; i++)
+   {
+      off_cols[i] = cols[off_perm[i]];
+   }
+   for (i = 0; i < num_off; i = j)
+   {
+      j = i + 1;
+      while (j < num_off && off_rows[j] == off_rows[i])
+      {
+         j++;
+      }
+      hypre_BigQsortbi(off_cols, off_perm, i, j - 1);
+   }
+
+   slot_i        = hypre_TAlloc(HYPRE_Int, num_off + 1, HYPRE_MEMORY_HOST);
+   slot_cols     = hypre_TAlloc(HYPRE_BigInt, num_off, HYPRE_MEMORY_HOST);
+   off_row_list  = hypre_TAlloc(HYPRE_BigInt, num_off, HYPRE_MEMORY_HOST);
+   off_row_slots = hypre_TAlloc(HYPRE_Int, num_off, HYPRE_MEMORY_HOST);
+
+   num_slots = 0;
+   num_off_rows = 0;
+   for (i = 0; i < num_off; i++)
+   {
+      if (i == 0 || off_rows[i] != off_rows[i - 1])
+      {
+         off_row_list[num_off_rows]  = off_rows[i] - first_row;
+         off_row_slots[num_off_rows] = 0;
+         num_off_rows++;
+      }
+      else if (off_cols[i] == off_cols[i - 1])
+      {
+         continue;
+      }
+      slot_i[num_slots]    = i;
+      slot_cols[num_slots] = off_cols[i];
+      off_row_slots[num_off_rows - 1]++;
+      num_slots++;
+   }
+   slot_i[num_slots] = num_off;
+
+   hypre_TFree(off_rows, HYPRE_MEMORY_HOST);
+   hypre_TFree(off_cols, HYPRE_MEMORY_HOST);
+
+   /*-----------------------------------------------------------------------
+    * Locate the owners of the off-processor rows
+    *-----------------------------------------------------------------------*/
+
+   apart = hypre_AssumedPartitionCreate(comm, hypre_ParCSRMatrixGlobalNumRows(par_matrix),
+                                        hypre_ParCSRMatrixFirstRowIndex(par_matrix),
+                                        hypre_ParCSRMatrixLastRowIndex(par_matrix));
+   row_pkg = hypre_TAlloc(hypre_ParCSRCommPkg, 1, HYPRE_MEMORY_HOST);
+   hypre_ParCSRCommPkgCreateApart(comm, off_row_list,
+                                  hypre_ParCSRMatrixFirstRowIndex(par_matrix),
+                                  num_off_rows, hypre_ParCSRMatrixGlobalNumRows(par_matrix),
+                                  apart, row_pkg);
+   hypre_AssumedPartitionDestroy(apart);
+
+   num_row_sends = hypre_ParCSRCommPkgNumSends(row_pkg);
+   num_row_recvs = hypre_ParCSRCommPkgNumRecvs(row_pkg);
+
+   /* Tell the owners how many slots each requested row carries */
+   recv_cnt = hypre_TAlloc(HYPRE_Int, hypre_ParCSRCommPkgSendMapStart(row_pkg, num_row_sends),
+                           HYPRE_MEMORY_HOST);
+   comm_handle = hypre_ParCSRCommHandleCreate(12, row_pkg, off_row_slots, recv_cnt);
+   hypre_ParCSRCommHandleDestroy(comm_handle);
+
+   /*-----------------------------------------------------------------------
+    * Build the slot communication package: the receivers of the row package
+    * send their slots, the senders of the row package receive them
+    *-----------------------------------------------------------------------*/
+
+   row_slot_start = hypre_TAlloc(HYPRE_Int, num_off_rows + 1, HYPRE_MEMORY_HOST);
+   row_slot_start[0] = 0;
+   for (i = 0; i < num_off_rows; i++)
+   {
+      row_slot_start[i + 1] = row_slot_start[i] + off_row_slots[i];
+   }
+
+   send_procs      = hypre_TAlloc(HYPRE_Int, num_row_recvs, HYPRE_MEMORY_HOST);
+   send_map_starts = hypre_TAlloc(HYPRE_Int, num_row_recvs + 1, HYPRE_MEMORY_HOST);
+   send_map_elmts  = hypre_TAlloc(HYPRE_Int, num_slots, HYPRE_MEMORY_HOST);
+   for (i = 0; i <= num_row_recvs; i++)
+   {
+      if (i < num_row_recvs)
+      {
+         send_procs[i] = hypre_ParCSRCommPkgRecvProc(row_pkg, i);
+      }
+      send_map_starts[i] = row_slot_start[hypre_ParCSRCommPkgRecvVecStart(row_pkg, i)];
+   }
+   for (i = 0; i < num_slots; i++)
+   {
+      send_map_elmts[i] = i;
+   }
+
+   recv_procs      = hypre_TAlloc(HYPRE_Int, num_row_sends, HYPRE_MEMORY_HOST);
+   recv_vec_starts = hypre_TAlloc(HYPRE_Int, num_row_sends + 1, HYPRE_MEMORY_HOST);
+   recv_vec_starts[0] = 0;
+   for (i = 0; i < num_row_sends; i++)
+   {
+      recv_procs[i] = hypre_ParCSRCommPkgSendProc(row_pkg, i);
+      recv_vec_starts[i + 1] = recv_vec_starts[i];
+      for (j = hypre_ParCSRCommPkgSendMapStart(row_pkg, i);
+           j < hypre_ParCSRCommPkgSendMapStart(row_pkg, i + 1); j++)
+      {
+         recv_vec_starts[i + 1] += recv_cnt[j];
+      }
+   }
+   num_recv = recv_vec_starts[num_row_sends];
+
+   hypre_ParCSRCommPkgCreateAndFill(comm, num_row_sends, recv_procs, recv_vec_starts,
+                                    num_row_recvs, send_procs, send_map_starts, send_map_elmts,
+                                    &comm_pkg);
+
+   /* Ship the column indices of the slots and resolve them on the owners */
+   recv_cols = hypre_TAlloc(HYPRE_BigInt, num_recv, HYPRE_MEMORY_HOST);
+   comm_handle = hypre_ParCSRCommHandleCreate(21, comm_pkg, slot_cols, recv_cols);
+   hypre_ParCSRCommHandleDestroy(comm_handle);
+
+   recv_target = hypre_TAlloc(HYPRE_Int, num_recv, HYPRE_MEMORY_HOST);
+   for (j = 0, r = 0; j < hypre_ParCSRCommPkgSendMapStart(row_pkg, num_row_sends); j++)
+   {
+      HYPRE_Int row_local = hypre_ParCSRCommPkgSendMapElmt(row_pkg, j);
+
+      for (i = 0; i < recv_cnt[j]; i++, r++)
+      {
+         recv_target[r] = hypre_IJMatrixFindEntryParCSR(matrix, row_local, recv_cols[r]);
+         if (recv_target[r] < 0)
+         {
+            hypre_error(HYPRE_ERROR_GENERIC);
+            if (print_level)
+            {
+               hypre_printf (" Error, element %b %b does not exist\n",
+                             row_partitioning[0] + row_local, recv_cols[r]);
+            }
+         }
+      }
+   }
+
+   hypre_MatvecCommPkgDestroy(row_pkg);
+   hypre_TFree(recv_cnt, HYPRE_MEMORY_HOST);
+   hypre_TFree(recv_cols, HYPRE_MEMORY_HOST);
+   hypre_TFree(slot_cols, HYPRE_MEMORY_HOST);
+   hypre_TFree(off_row_list, HYPRE_MEMORY_HOST);
+   hypre_TFree(off_row_slots, HYPRE_MEMORY_HOST);
+   hypre_TFree(row_slot_start, HYPRE_MEMORY_HOST);
+
+   /*-----------------------------------------------------------------------
+    * Invert the source -> position map.  Targets fed by local entries only
+    * come first so they can be updated while the slots are in flight.
+    * Sources of a target are kept in increasing order, which fixes the
+    * summation order of repeated entries.
+    *-----------------------------------------------------------------------*/
+
+   tcount = hypre_CTAlloc(HYPRE_Int, nnz, HYPRE_MEMORY_HOST);
+   tmap   = hypre_CTAlloc(HYPRE_Int, nnz, HYPRE_MEMORY_HOST);
+
+   for (k = 0; k < num_values; k++)
+   {
+      if (src_target[k] > -1)
+      {
+         tcount[src_target[k]]++;
+      }
+   }
+   for (r = 0; r < num_recv; r++)
+   {
+      if (recv_target[r] > -1)
+      {
+         tcount[recv_target[r]]++;
+         tmap[recv_target[r]] = 1;
+      }
+   }
+
+   num_targets = 0;
+   num_local_targets = 0;
+   for (t = 0; t < nnz; t++)
+   {
+      if (tcount[t])
+      {
+         num_targets++;
+         num_local_targets += !tmap[t];
+      }
+   }
+
+   target   = hypre_TAlloc(HYPRE_Int, num_targets, HYPRE_MEMORY_HOST);
+   target_i = hypre_TAlloc(HYPRE_Int, num_targets + 1, HYPRE_MEMORY_HOST);
+   target_j = hypre_TAlloc(HYPRE_Int, num_values + num_recv, HYPRE_MEMORY_HOST);
+
+   i = 0;
+   j = num_local_targets;
+   for (t = 0; t < nnz; t++)
+   {
+      if (tcount[t])
+      {
+         kb = tmap[t] ? j++ : i++;
+         target[kb] = t;
+         tmap[t] = kb;
+      }
+   }
+
+   target_i[0] = 0;
+   for (i = 0; i < num_targets; i++)
+   {
+      target_i[i + 1] = target_i[i] + tcount[target[i]];
+      tcount[target[i]] = target_i[i];
+   }
+   for (k = 0; k < num_values; k++)
+   {
+      if (src_target[k] > -1)
+      {
+         target_j[tcount[src_target[k]]++] = k;
+      }
+   }
+   for (r = 0; r < num_recv; r++)
+   {
+      if (recv_target[r] > -1)
+      {
+         target_j[tcount[recv_target[r]]++] = num_values + r;
+      }
+   }
+
+   hypre_TFree(tcount, HYPRE_MEMORY_HOST);
+   hypre_TFree(tmap, HYPRE_MEMORY_HOST);
+   hypre_TFree(src_target, HYPRE_MEMORY_HOST);
+   hypre_TFree(recv_target, HYPRE_MEMORY_HOST);
+
+   /*-----------------------------------------------------------------------
+    * Store the plan
+    *-----------------------------------------------------------------------*/
+
+   plan = hypre_CTAlloc(hypre_IJUpdatePlan, 1, HYPRE_MEMORY_HOST);
+
+   hypre_IJUpdatePlanNumValues(plan)       = num_values;
+   hypre_IJUpdatePlanNumSlots(plan)        = num_slots;
+   hypre_IJUpdatePlanSlotI(plan)           = slot_i;
+   hypre_IJUpdatePlanSlotJ(plan)           = off_perm;
+   hypre_IJUpdatePlanNumTargets(plan)      = num_targets;
+   hypre_IJUpdatePlanNumLocalTargets(plan) = num_local_targets;
+   hypre_IJUpdatePlanTarget(plan)          = target;
+   hypre_IJUpdatePlanTargetI(plan)         = target_i;
+   hypre_IJUpdatePlanTargetJ(plan)         = target_j;
+   hypre_IJUpdatePlanCommPkg(plan)         = comm_pkg;
+   hypre_IJUpdatePlanSendData(plan)        = hypre_CTAlloc(HYPRE_Complex, num_slots,
+                                                           HYPRE_MEMORY_HOST);
+   hypre_IJUpdatePlanRecvData(plan)        = hypre_CTAlloc(HYPRE_Complex, num_recv,
+                                                           HYPRE_MEMORY_HOST);
+
+   hypre_IJMatrixUpdatePlan(matrix) = plan;
+
+   return hypre_error_flag;
+}
+
+/******************************************************************************
+ *
+ * hypre_IJUpdatePlanApply
+ *
+ * Updates targets [begin, end) of the plan from the pattern values and the
+ * received slots.  action = 0 replaces a matrix entry by the sum of its
+ * contributions, action = 1 adds the sum to it.
+ *
+ *****************************************************************************/
+
+static void
+hypre_IJUpdatePlanApply( hypre_IJUpdatePlan  *plan,
+                         HYPRE_Int            begin,
+                         HYPRE_Int            end,
+                         HYPRE_Int            action,
+                         const HYPRE_Complex *values,
+                         HYPRE_Int            nnz_diag,
+                         HYPRE_Complex       *diag_data,
+                         HYPRE_Complex       *offd_data )
+{
+   HYPRE_Int      num_values = hypre_IJUpdatePlanNumValues(plan);
+   HYPRE_Int     *target     = hypre_IJUpdatePlanTarget(plan);
+   HYPRE_Int     *target_i   = hypre_IJUpdatePlanTargetI(plan);
+   HYPRE_Int     *target_j   = hypre_IJUpdatePlanTargetJ(plan);
+   HYPRE_Complex *recv_data  = hypre_IJUpdatePlanRecvData(plan);
+   HYPRE_Int      i, j, s;
+   HYPRE_Complex  sum, *entry;
+
+#if defined(HYPRE_USING_OPENMP)
+   #pragma omp parallel for private(i, j, s, sum, entry) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = begin; i < end; i++)
+   {
+      sum = 0.0;
+      for (j = target_i[i]; j < target_i[i + 1]; j++)
+      {
+         s = target_j[j];
+         sum += (s < num_values) ? values[s] : recv_data[s - num_values];
+      }
+
+      entry = (target[i] < nnz_diag) ? &diag_data[target[i]] :
+              &offd_data[target[i] - nnz_diag];
+      *entry = action ? *entry + sum : sum;
+   }
+}
+
+/******************************************************************************
+ *
+ * hypre_IJMatrixUpdateValuesParCSR
+ *
+ * Applies new values given in the order of the update pattern: packs the
+ * off-processor slots, starts their exchange, updates the entries that only
+ * have local contributions and finishes the rest once the slots arrive.
+ *
+ *****************************************************************************/
+
+HYPRE_Int
+hypre_IJMatrixUpdateValuesParCSR( hypre_IJMatrix      *matrix,
+                                  HYPRE_Int            action,
+                                  const HYPRE_Complex *values )
+{
+   hypre_IJUpdatePlan     *plan       = hypre_IJMatrixUpdatePlan(matrix);
+   hypre_ParCSRMatrix     *par_matrix = (hypre_ParCSRMatrix *) hypre_IJMatrixObject(matrix);
+   hypre_CSRMatrix        *diag       = hypre_ParCSRMatrixDiag(par_matrix);
+   hypre_CSRMatrix        *offd       = hypre_ParCSRMatrixOffd(par_matrix);
+   HYPRE_Int               nnz_diag   = hypre_CSRMatrixI(diag)[hypre_CSRMatrixNumRows(diag)];
+   HYPRE_Complex          *diag_data  = hypre_CSRMatrixData(diag);
+   HYPRE_Complex          *offd_data  = hypre_CSRMatrixData(offd);
+
+   hypre_ParCSRCommPkg    *comm_pkg   = hypre_IJUpdatePlanCommPkg(plan);
+   HYPRE_Int               num_slots  = hypre_IJUpdatePlanNumSlots(plan);
+   HYPRE_Int              *slot_i     = hypre_IJUpdatePlanSlotI(plan);
+   HYPRE_Int              *slot_j     = hypre_IJUpdatePlanSlotJ(plan);
+   HYPRE_Complex          *send_data  = hypre_IJUpdatePlanSendData(plan);
+   HYPRE_Complex          *recv_data  = hypre_IJUpdatePlanRecvData(plan);
+   HYPRE_Int               i, j;
+   HYPRE_Complex           sum;
+
+#ifdef HYPRE_USING_PERSISTENT_COMM
+   hypre_ParCSRPersistentCommHandle *persistent_comm_handle;
+#else
+   hypre_ParCSRCommHandle           *comm_handle;
+#endif
+
+#if defined(HYPRE_USING_OPENMP)
+   #pragma omp parallel for private(i, j, sum) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < num_slots; i++)
+   {
+      sum = 0.0;
+      for (j = slot_i[i]; j < slot_i[i + 1]; j++)
+      {
+         sum += values[slot_j[j]];
+      }
+      send_data[i] = sum;
+   }
+
+#ifdef HYPRE_USING_PERSISTENT_COMM
+   persistent_comm_handle = hypre_ParCSRCommPkgGetPersistentCommHandle(1, comm_pkg);
+   hypre_ParCSRPersistentCommHandleStart(persistent_comm_handle, HYPRE_MEMORY_HOST, send_data);
+#else
+   comm_handle = hypre_ParCSRCommHandleCreate(1, comm_pkg, send_data, recv_data);
+#endif
+
+   hypre_IJUpdatePlanApply(plan, 0, hypre_IJUpdatePlanNumLocalTargets(plan), action, values,
+                           nnz_diag, diag_data, offd_data);
+
+#ifdef HYPRE_USING_PERSISTENT_COMM
+   hypre_ParCSRPersistentCommHandleWait(persistent_comm_handle, HYPRE_MEMORY_HOST, recv_data);
+#else
+   hypre_ParCSRCommHandleDestroy(comm_handle);
+#endif
+
+   hypre_IJUpdatePlanApply(plan, hypre_IJUpdatePlanNumLocalTargets(plan),
+                           hypre_IJUpdatePlanNumTargets(plan), action, values,
+                           nnz_diag, diag_data, offd_data);
+
+   return hypre_error_flag;
+}
@@ -14,6 +14,56 @@
 #ifndef hypre_IJ_MATRIX_HEADER
 #define hypre_IJ_MATRIX_HEADER
 
+/*--------------------------------------------------------------------------
+ * hypre_IJUpdatePlan:
+ *
+ * Compiled mapping from a fixed list of (row, col) entries to positions in
+ * the diag/offd data of an assembled ParCSR matrix.  Entries in rows owned
+ * by other processors are combined into send slots (one per distinct
+ * entry) that are exchanged through comm_pkg.  Each updated matrix entry
+ * (target) lists its sources: a pattern entry (< num_values) or a received
+ * slot (num_values + index into recv_data).  The first num_local_targets
+ * targets have local sources only and are updated while messages are in
+ * flight.
+ *--------------------------------------------------------------------------*/
+
+typedef struct hypre_IJUpdatePlan_struct
+{
+   HYPRE_Int             num_values;         /* number of pattern entries */
+
+   HYPRE_Int             num_slots;          /* distinct off-processor entries */
+   HYPRE_Int            *slot_i;             /* slot -> pattern entries */
+   HYPRE_Int            *slot_j;
+
+   HYPRE_Int             num_targets;        /* matrix entries updated */
+   HYPRE_Int             num_local_targets;
+   HYPRE_Int            *target;             /* diag position, or nnz_diag + offd position */
+   HYPRE_Int            *target_i;           /* target -> sources */
+   HYPRE_Int            *target_j;
+
+   hypre_ParCSRCommPkg  *comm_pkg;           /* slots are sent, owners receive */
+   HYPRE_Complex        *send_data;
+   HYPRE_Complex        *recv_data;
+
+} hypre_IJUpdatePlan;
+
+/*--------------------------------------------------------------------------
+ * Accessor macros: hypre_IJUpdatePlan
+ *--------------------------------------------------------------------------*/
+
+#define hypre_IJUpdatePlanNumValues(plan)         ((plan) -> num_values)
+#define hypre_IJUpdatePlanNumSlots(plan)          ((plan) -> num_slots)
+#define hypre_IJUpdatePlanSlotI(plan)             ((plan) -> slot_i)
+#define hypre_IJUpdatePlanSlotJ(plan)             ((plan) -> slot_j)
+#define hypre_IJUpdatePlanNumTargets(plan)        ((plan) -> num_targets)
+#define hypre_IJUpdatePlanNumLocalTargets(plan)   ((plan) -> num_local_targets)
+#define hypre_IJUpdatePlanTarget(plan)            ((plan) -> target)
+#define hypre_IJUpdatePlanTargetI(plan)           ((plan) -> target_i)
+#define hypre_IJUpdatePlanTargetJ(plan)           ((plan) -> target_j)
+#define hypre_IJUpdatePlanCommPkg(plan)           ((plan) -> comm_pkg)
+#define hypre_IJUpdatePlanSendData(plan)          ((plan) -> send_data)
+#define hypre_IJUpdatePlanRecvData(plan)          ((plan) -> recv_data)
+
 /*--------------------------------------------------------------------------
  * hypre_IJMatrix:
  *--------------------------------------------------------------------------*/
@@ -40,6 +90,8 @@ typedef struct hypre_IJMatrix_struct
    HYPRE_Int     omp_flag;
    HYPRE_Int     print_level;
 
+   hypre_IJUpdatePlan *update_plan;   /* optional compiled value update */
+
 } hypre_IJMatrix;
 
 /*--------------------------------------------------------------------------
@@ -63,6 +115,7 @@ typedef struct hypre_IJMatrix_struct
 #define hypre_IJMatrixGlobalNumCols(matrix)    ((matrix) -> global_num_cols)
 #define hypre_IJMatrixOMPFlag(matrix)          ((matrix) -> omp_flag)
 #define hypre_IJMatrixPrintLevel(matrix)       ((matrix) -> print_level)
+#define hypre_IJMatrixUpdatePlan(matrix)       ((matrix) -> update_plan)
 
 static inline HYPRE_MemoryLocation
 hypre_IJMatrixMemoryLocation(hypre_IJMatrix *matrix)
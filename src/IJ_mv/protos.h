@@ -100,6 +100,12 @@ HYPRE_Int hypre_IJMatrixSetValuesOMPParCSR ( hypre_IJMatrix *matrix, HYPRE_Int n
 HYPRE_Int hypre_IJMatrixAddToValuesOMPParCSR ( hypre_IJMatrix *matrix, HYPRE_Int nrows,
                                                HYPRE_Int *ncols, const HYPRE_BigInt *rows, const HYPRE_Int *row_indexes, const HYPRE_BigInt *cols,
                                                const HYPRE_Complex *values );
+HYPRE_Int hypre_IJUpdatePlanDestroy ( hypre_IJUpdatePlan *plan );
+HYPRE_Int hypre_IJMatrixSetUpdatePatternParCSR ( hypre_IJMatrix *matrix, HYPRE_Int nrows,
+                                                 HYPRE_Int *ncols, const HYPRE_BigInt *rows,
+                                                 const HYPRE_BigInt *cols );
+HYPRE_Int hypre_IJMatrixUpdateValuesParCSR ( hypre_IJMatrix *matrix, HYPRE_Int action,
+                                             const HYPRE_Complex *values );
 HYPRE_Int hypre_IJMatrixAssembleParCSRDevice(hypre_IJMatrix *matrix);
 HYPRE_Int hypre_IJMatrixInitializeParCSR_v2(hypre_IJMatrix *matrix,
                                             HYPRE_MemoryLocation memory_location);
@@ -174,6 +180,11 @@ HYPRE_Int HYPRE_IJMatrixSetConstantValues ( HYPRE_IJMatrix matrix, HYPRE_Complex
 HYPRE_Int HYPRE_IJMatrixAddToValues ( HYPRE_IJMatrix matrix, HYPRE_Int nrows, HYPRE_Int *ncols,
                                       const HYPRE_BigInt *rows, const HYPRE_BigInt *cols, const HYPRE_Complex *values );
 HYPRE_Int HYPRE_IJMatrixAssemble ( HYPRE_IJMatrix matrix );
+HYPRE_Int HYPRE_IJMatrixSetUpdatePattern ( HYPRE_IJMatrix matrix, HYPRE_Int nrows,
+                                           HYPRE_Int *ncols, const HYPRE_BigInt *rows,
+                                           const HYPRE_BigInt *cols );
+HYPRE_Int HYPRE_IJMatrixUpdateValues ( HYPRE_IJMatrix matrix, HYPRE_Int action,
+                                       const HYPRE_Complex *values );
 HYPRE_Int HYPRE_IJMatrixGetRowCounts ( HYPRE_IJMatrix matrix, HYPRE_Int nrows, HYPRE_BigInt *rows,
                                        HYPRE_Int *ncols );
 HYPRE_Int HYPRE_IJMatrixGetValues ( HYPRE_IJMatrix matrix, HYPRE_Int nrows, HYPRE_Int *ncols,
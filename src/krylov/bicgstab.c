@@ -52,12 +52,60 @@ hypre_BiCGSTABFunctionsCreate(
    bicgstab_functions->ScaleVector = ScaleVector;
    bicgstab_functions->Axpy = Axpy;
    bicgstab_functions->CommInfo = CommInfo;
+   bicgstab_functions->UpdateSolutionResidual = NULL; /* optional, see below */
+   bicgstab_functions->Axpby = NULL;
    bicgstab_functions->precond_setup = PrecondSetup;
    bicgstab_functions->precond = Precond;
 
    return bicgstab_functions;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_BiCGSTABFunctionsSetVectorUpdates
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BiCGSTABFunctionsSetVectorUpdates(
+   hypre_BiCGSTABFunctions *bicgstab_functions,
+   HYPRE_Int  (*UpdateSolutionResidual) ( HYPRE_Complex alpha, void *p, void *s,
+                                          void *x, void *r, HYPRE_Real *r_prod ),
+   HYPRE_Int  (*Axpby)         ( HYPRE_Complex alpha, void *x, HYPRE_Complex beta, void *y )
+)
+{
+   bicgstab_functions->UpdateSolutionResidual = UpdateSolutionResidual;
+   bicgstab_functions->Axpby = Axpby;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BiCGSTABUpdateSolutionResidual
+ *
+ * x = x + alpha*p, r = r - alpha*s and, if r_prod is not NULL,
+ * r_prod = <r,r>.  Uses the fused UpdateSolutionResidual function when the
+ * function table provides one.
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_BiCGSTABUpdateSolutionResidual( hypre_BiCGSTABFunctions *bicgstab_functions,
+                                      HYPRE_Complex alpha, void *p, void *s, void *x, void *r,
+                                      HYPRE_Real *r_prod )
+{
+   if (bicgstab_functions->UpdateSolutionResidual)
+   {
+      (*(bicgstab_functions->UpdateSolutionResidual))(alpha, p, s, x, r, r_prod);
+   }
+   else
+   {
+      (*(bicgstab_functions->Axpy))(alpha, p, x);
+      (*(bicgstab_functions->Axpy))(-alpha, s, r);
+      if (r_prod)
+      {
+         *r_prod = (*(bicgstab_functions->InnerProd))(r, r);
+      }
+   }
+}
+
 /*--------------------------------------------------------------------------
  * hypre_BiCGSTABCreate
  *--------------------------------------------------------------------------*/
@@ -464,8 +512,8 @@ hypre_BiCGSTABSolve(void  *bicgstab_vdata,
 
          return hypre_error_flag;
       }
-      (*(bicgstab_functions->Axpy))(alpha, v, x);
-      (*(bicgstab_functions->Axpy))(-alpha, q, r);
+      /* x = x + alpha*v, r = r - alpha*q */
+      hypre_BiCGSTABUpdateSolutionResidual(bicgstab_functions, alpha, v, q, x, r, NULL);
       (*(bicgstab_functions->ClearVector))(v);
       precond(precond_data, A, r, v);
       (*(bicgstab_functions->Matvec))(matvec_data, 1.0, A, v, 0.0, s);
@@ -480,10 +528,10 @@ hypre_BiCGSTABSolve(void  *bicgstab_vdata,
       {
          gamma = gamma_numer / gamma_denom;
       }
-      (*(bicgstab_functions->Axpy))(gamma, v, x);
-      (*(bicgstab_functions->Axpy))(-gamma, s, r);
+      /* x = x + gamma*v, r = r - gamma*s, and r_norm^2 = <r,r> */
+      hypre_BiCGSTABUpdateSolutionResidual(bicgstab_functions, gamma, v, s, x, r, &r_norm);
       /* residual is now updated, must immediately check for convergence */
-      r_norm = sqrt((*(bicgstab_functions->InnerProd))(r, r));
+      r_norm = sqrt(r_norm);
       if (logging > 0 || print_level > 0)
       {
          norms[iter] = r_norm;
@@ -548,7 +596,16 @@ hypre_BiCGSTABSolve(void  *bicgstab_vdata,
       (*(bicgstab_functions->Axpy))(-gamma, q, p);
       if (fabs(gamma) >= epsmac)
       {
-         (*(bicgstab_functions->ScaleVector))((beta * alpha / gamma), p);
+         /* p = r + (beta*alpha/gamma)*p */
+         if (bicgstab_functions->Axpby)
+         {
+            (*(bicgstab_functions->Axpby))(1.0, r, (beta * alpha / gamma), p);
+         }
+         else
+         {
+            (*(bicgstab_functions->ScaleVector))((beta * alpha / gamma), p);
+            (*(bicgstab_functions->Axpy))(1.0, r, p);
+         }
       }
       else
       {
@@ -557,7 +614,6 @@ hypre_BiCGSTABSolve(void  *bicgstab_vdata,
 
          return hypre_error_flag;
       }
-      (*(bicgstab_functions->Axpy))(1.0, r, p);
    } /* end while loop */
 
    (bicgstab_data -> num_iterations) = iter;
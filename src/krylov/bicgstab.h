@@ -82,6 +82,13 @@ typedef struct
    HYPRE_Int  (*ScaleVector)   ( HYPRE_Complex alpha, void *x );
    HYPRE_Int  (*Axpy)          ( HYPRE_Complex alpha, void *x, void *y );
    HYPRE_Int  (*CommInfo)      ( void *A, HYPRE_Int *my_id, HYPRE_Int *num_procs );
+
+   /* optional fused vector updates: x += alpha*p and r -= alpha*s with <r,r>,
+      and y = alpha*x + beta*y */
+   HYPRE_Int  (*UpdateSolutionResidual) ( HYPRE_Complex alpha, void *p, void *s,
+                                          void *x, void *r, HYPRE_Real *r_prod );
+   HYPRE_Int  (*Axpby)         ( HYPRE_Complex alpha, void *x, HYPRE_Complex beta, void *y );
+
    HYPRE_Int  (*precond_setup) (void *vdata, void *A, void *b, void *x);
    HYPRE_Int  (*precond)       (void *vdata, void *A, void *b, void *x);
 
@@ -164,6 +171,20 @@ hypre_BiCGSTABFunctionsCreate(
    HYPRE_Int  (*Precond)       ( void *vdata, void *A, void *b, void *x )
 );
 
+/**
+ * Sets the optional fused vector update functions of the BiCGSTAB function
+ * table.  If none are set, BiCGSTAB uses the Axpy, ScaleVector and InnerProd
+ * functions.
+ **/
+
+HYPRE_Int
+hypre_BiCGSTABFunctionsSetVectorUpdates(
+   hypre_BiCGSTABFunctions *bicgstab_functions,
+   HYPRE_Int  (*UpdateSolutionResidual) ( HYPRE_Complex alpha, void *p, void *s,
+                                          void *x, void *r, HYPRE_Real *r_prod ),
+   HYPRE_Int  (*Axpby)         ( HYPRE_Complex alpha, void *x, HYPRE_Complex beta, void *y )
+);
+
 /**
  * Description...
  *
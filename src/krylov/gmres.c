@@ -58,6 +58,7 @@ hypre_GMRESFunctionsCreate(
    gmres_functions->ClearVector = ClearVector;
    gmres_functions->ScaleVector = ScaleVector;
    gmres_functions->Axpy = Axpy;
+   gmres_functions->ResidualInnerProd = NULL; /* optional, see below */
    /* default preconditioner must be set here but can be changed later... */
    gmres_functions->precond_setup = PrecondSetup;
    gmres_functions->precond       = Precond;
@@ -65,6 +66,49 @@ hypre_GMRESFunctionsCreate(
    return gmres_functions;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_GMRESFunctionsSetResidualInnerProd
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_GMRESFunctionsSetResidualInnerProd(
+   hypre_GMRESFunctions *gmres_functions,
+   HYPRE_Int    (*ResidualInnerProd) ( void *matvec_data, void *A, void *x, void *b,
+                                       void *r, void *z, HYPRE_Real *rr, HYPRE_Real *rz )
+)
+{
+   gmres_functions->ResidualInnerProd = ResidualInnerProd;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_GMRESResidual
+ *
+ * r = b - A*x and, if r_prod is not NULL, r_prod = <r,r>.  Uses the fused
+ * ResidualInnerProd function when the function table provides one.
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_GMRESResidual( hypre_GMRESFunctions *gmres_functions,
+                     void *matvec_data, void *A, void *x, void *b, void *r,
+                     HYPRE_Real *r_prod )
+{
+   if (gmres_functions->ResidualInnerProd)
+   {
+      (*(gmres_functions->ResidualInnerProd))(matvec_data, A, x, b, r, NULL, r_prod, NULL);
+   }
+   else
+   {
+      (*(gmres_functions->CopyVector))(b, r);
+      (*(gmres_functions->Matvec))(matvec_data, -1.0, A, x, 1.0, r);
+      if (r_prod)
+      {
+         *r_prod = (*(gmres_functions->InnerProd))(r, r);
+      }
+   }
+}
+
 /*--------------------------------------------------------------------------
  * hypre_GMRESCreate
  *--------------------------------------------------------------------------*/
@@ -356,10 +400,8 @@ hypre_GMRESSolve(void  *gmres_vdata,
       hh[i] = hypre_CTAllocF(HYPRE_Real, k_dim, gmres_functions, HYPRE_MEMORY_HOST);
    }
 
-   (*(gmres_functions->CopyVector))(b, p[0]);
-
-   /* compute initial residual */
-   (*(gmres_functions->Matvec))(matvec_data, -1.0, A, x, 1.0, p[0]);
+   /* compute initial residual and its norm */
+   hypre_GMRESResidual(gmres_functions, matvec_data, A, x, b, p[0], &r_norm);
 
    b_norm = sqrt((*(gmres_functions->InnerProd))(b, b));
    real_r_norm_old = b_norm;
@@ -391,7 +433,7 @@ hypre_GMRESSolve(void  *gmres_vdata,
       return hypre_error_flag;
    }
 
-   r_norm = sqrt((*(gmres_functions->InnerProd))(p[0], p[0]));
+   r_norm = sqrt(r_norm);
    r_norm_0 = r_norm;
 
    /* Since it is does not diminish performance, attempt to return an error flag
@@ -504,9 +546,8 @@ hypre_GMRESSolve(void  *gmres_vdata,
          if (!rel_change) /* shouldn't exit after no iterations if
                            * relative change is on*/
          {
-            (*(gmres_functions->CopyVector))(b, r);
-            (*(gmres_functions->Matvec))(matvec_data, -1.0, A, x, 1.0, r);
-            r_norm = sqrt((*(gmres_functions->InnerProd))(r, r));
+            hypre_GMRESResidual(gmres_functions, matvec_data, A, x, b, r, &r_norm);
+            r_norm = sqrt(r_norm);
             if (r_norm  <= epsilon)
             {
                if ( print_level > 1 && my_id == 0)
@@ -773,9 +814,8 @@ hypre_GMRESSolve(void  *gmres_vdata,
          }
 
          /* calculate actual residual norm*/
-         (*(gmres_functions->CopyVector))(b, r);
-         (*(gmres_functions->Matvec))(matvec_data, -1.0, A, x, 1.0, r);
-         real_r_norm_new = r_norm = sqrt( (*(gmres_functions->InnerProd))(r, r) );
+         hypre_GMRESResidual(gmres_functions, matvec_data, A, x, b, r, &r_norm);
+         real_r_norm_new = r_norm = sqrt(r_norm);
 
          if (r_norm <= epsilon)
          {
@@ -65,6 +65,10 @@ typedef struct
    HYPRE_Int    (*ScaleVector)   ( HYPRE_Complex alpha, void *x );
    HYPRE_Int    (*Axpy)          ( HYPRE_Complex alpha, void *x, void *y );
 
+   /* optional: r = b - A*x with <r,r> and <r,z> in a single pass and reduction */
+   HYPRE_Int    (*ResidualInnerProd) ( void *matvec_data, void *A, void *x, void *b,
+                                       void *r, void *z, HYPRE_Real *rr, HYPRE_Real *rz );
+
    HYPRE_Int    (*precond)       ();
    HYPRE_Int    (*precond_setup) ();
 
@@ -149,6 +153,19 @@ hypre_GMRESFunctionsCreate(
    HYPRE_Int    (*Precond)       ( void *vdata, void *A, void *b, void *x )
 );
 
+/**
+ * Sets the optional fused residual function of the GMRES function table.
+ * If none is set, GMRES computes residuals and their norms with the
+ * CopyVector, Matvec and InnerProd functions.
+ **/
+
+HYPRE_Int
+hypre_GMRESFunctionsSetResidualInnerProd(
+   hypre_GMRESFunctions *gmres_functions,
+   HYPRE_Int    (*ResidualInnerProd) ( void *matvec_data, void *A, void *x, void *b,
+                                       void *r, void *z, HYPRE_Real *rr, HYPRE_Real *rz )
+);
+
 /**
  * Description...
  *
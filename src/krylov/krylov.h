@@ -102,6 +102,13 @@ typedef struct
    HYPRE_Int  (*ScaleVector)   ( HYPRE_Complex alpha, void *x );
    HYPRE_Int  (*Axpy)          ( HYPRE_Complex alpha, void *x, void *y );
    HYPRE_Int  (*CommInfo)      ( void *A, HYPRE_Int *my_id, HYPRE_Int *num_procs );
+
+   /* optional fused vector updates: x += alpha*p and r -= alpha*s with <r,r>,
+      and y = alpha*x + beta*y */
+   HYPRE_Int  (*UpdateSolutionResidual) ( HYPRE_Complex alpha, void *p, void *s,
+                                          void *x, void *r, HYPRE_Real *r_prod );
+   HYPRE_Int  (*Axpby)         ( HYPRE_Complex alpha, void *x, HYPRE_Complex beta, void *y );
+
    HYPRE_Int  (*precond_setup) (void *vdata, void *A, void *b, void *x);
    HYPRE_Int  (*precond)       (void *vdata, void *A, void *b, void *x);
 
@@ -186,6 +193,20 @@ extern "C" {
       HYPRE_Int  (*Precond)       ( void *vdata, void *A, void *b, void *x )
    );
 
+   /**
+    * Sets the optional fused vector update functions of the BiCGSTAB function
+    * table.  If none are set, BiCGSTAB uses the Axpy, ScaleVector and InnerProd
+    * functions.
+    **/
+
+   HYPRE_Int
+   hypre_BiCGSTABFunctionsSetVectorUpdates(
+      hypre_BiCGSTABFunctions *bicgstab_functions,
+      HYPRE_Int  (*UpdateSolutionResidual) ( HYPRE_Complex alpha, void *p, void *s,
+                                             void *x, void *r, HYPRE_Real *r_prod ),
+      HYPRE_Int  (*Axpby)         ( HYPRE_Complex alpha, void *x, HYPRE_Complex beta, void *y )
+   );
+
    /**
     * Description...
     *
@@ -412,6 +433,10 @@ typedef struct
    HYPRE_Int    (*ScaleVector)   ( HYPRE_Complex alpha, void *x );
    HYPRE_Int    (*Axpy)          ( HYPRE_Complex alpha, void *x, void *y );
 
+   /* optional: r = b - A*x with <r,r> and <r,z> in a single pass and reduction */
+   HYPRE_Int    (*ResidualInnerProd) ( void *matvec_data, void *A, void *x, void *b,
+                                       void *r, void *z, HYPRE_Real *rr, HYPRE_Real *rz );
+
    HYPRE_Int    (*precond)       (void *vdata, void *A, void *b, void *x);
    HYPRE_Int    (*precond_setup) (void *vdata, void *A, void *b, void *x);
 
@@ -498,6 +523,19 @@ extern "C" {
       HYPRE_Int    (*Precond)       ( void *vdata, void *A, void *b, void *x )
    );
 
+   /**
+    * Sets the optional fused residual function of the GMRES function table.
+    * If none is set, GMRES computes residuals and their norms with the
+    * CopyVector, Matvec and InnerProd functions.
+    **/
+
+   HYPRE_Int
+   hypre_GMRESFunctionsSetResidualInnerProd(
+      hypre_GMRESFunctions *gmres_functions,
+      HYPRE_Int    (*ResidualInnerProd) ( void *matvec_data, void *A, void *x, void *b,
+                                          void *r, void *z, HYPRE_Real *rr, HYPRE_Real *rz )
+   );
+
    /**
     * Description...
     *
@@ -1067,6 +1105,16 @@ typedef struct
    HYPRE_Int    (*ScaleVector)   ( HYPRE_Complex alpha, void *x );
    HYPRE_Int    (*Axpy)          ( HYPRE_Complex alpha, void *x, void *y );
 
+   /* optional: r = b - A*x with <r,r> and <r,z> in a single pass and reduction */
+   HYPRE_Int    (*ResidualInnerProd) ( void *matvec_data, void *A, void *x, void *b,
+                                       void *r, void *z, HYPRE_Real *rr, HYPRE_Real *rz );
+
+   /* optional fused vector updates: x += alpha*p and r -= alpha*s with <r,r>,
+      and y = alpha*x + beta*y */
+   HYPRE_Int    (*UpdateSolutionResidual) ( HYPRE_Complex alpha, void *p, void *s,
+                                            void *x, void *r, HYPRE_Real *r_prod );
+   HYPRE_Int    (*Axpby)         ( HYPRE_Complex alpha, void *x, HYPRE_Complex beta, void *y );
+
    HYPRE_Int    (*precond)(void *vdata, void *A, void *b, void *x);
    HYPRE_Int    (*precond_setup)(void *vdata, void *A, void *b, void *x);
 
@@ -1187,6 +1235,33 @@ extern "C" {
       HYPRE_Int    (*Precond)       ( void *vdata, void *A, void *b, void *x )
    );
 
+   /**
+    * Sets the optional fused residual function of the PCG function table.
+    * If none is set, PCG computes residuals and their norms with the
+    * CopyVector, Matvec and InnerProd functions.
+    **/
+
+   HYPRE_Int
+   hypre_PCGFunctionsSetResidualInnerProd(
+      hypre_PCGFunctions *pcg_functions,
+      HYPRE_Int    (*ResidualInnerProd) ( void *matvec_data, void *A, void *x, void *b,
+                                          void *r, void *z, HYPRE_Real *rr, HYPRE_Real *rz )
+   );
+
+   /**
+    * Sets the optional fused vector update functions of the PCG function
+    * table.  If none are set, PCG uses the Axpy, ScaleVector and InnerProd
+    * functions.
+    **/
+
+   HYPRE_Int
+   hypre_PCGFunctionsSetVectorUpdates(
+      hypre_PCGFunctions *pcg_functions,
+      HYPRE_Int    (*UpdateSolutionResidual) ( HYPRE_Complex alpha, void *p, void *s,
+                                               void *x, void *r, HYPRE_Real *r_prod ),
+      HYPRE_Int    (*Axpby)         ( HYPRE_Complex alpha, void *x, HYPRE_Complex beta, void *y )
+   );
+
    /**
     * Description...
     *
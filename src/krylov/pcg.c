@@ -65,6 +65,9 @@ hypre_PCGFunctionsCreate(
    pcg_functions->ClearVector = ClearVector;
    pcg_functions->ScaleVector = ScaleVector;
    pcg_functions->Axpy = Axpy;
+   pcg_functions->ResidualInnerProd = NULL; /* optional, see below */
+   pcg_functions->UpdateSolutionResidual = NULL;
+   pcg_functions->Axpby = NULL;
    /* default preconditioner must be set here but can be changed later... */
    pcg_functions->precond_setup = PrecondSetup;
    pcg_functions->precond       = Precond;
@@ -72,6 +75,95 @@ hypre_PCGFunctionsCreate(
    return pcg_functions;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_PCGFunctionsSetResidualInnerProd
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PCGFunctionsSetResidualInnerProd(
+   hypre_PCGFunctions *pcg_functions,
+   HYPRE_Int    (*ResidualInnerProd) ( void *matvec_data, void *A, void *x, void *b,
+                                       void *r, void *z, HYPRE_Real *rr, HYPRE_Real *rz )
+)
+{
+   pcg_functions->ResidualInnerProd = ResidualInnerProd;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_PCGFunctionsSetVectorUpdates
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PCGFunctionsSetVectorUpdates(
+   hypre_PCGFunctions *pcg_functions,
+   HYPRE_Int    (*UpdateSolutionResidual) ( HYPRE_Complex alpha, void *p, void *s,
+                                            void *x, void *r, HYPRE_Real *r_prod ),
+   HYPRE_Int    (*Axpby)         ( HYPRE_Complex alpha, void *x, HYPRE_Complex beta, void *y )
+)
+{
+   pcg_functions->UpdateSolutionResidual = UpdateSolutionResidual;
+   pcg_functions->Axpby = Axpby;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_PCGResidual
+ *
+ * r = b - A*x and, if r_prod is not NULL, r_prod = <r,r>.  Uses the fused
+ * ResidualInnerProd function when the function table provides one.
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_PCGResidual( hypre_PCGFunctions *pcg_functions,
+                   void *matvec_data, void *A, void *x, void *b, void *r,
+                   HYPRE_Real *r_prod )
+{
+   if (pcg_functions->ResidualInnerProd)
+   {
+      (*(pcg_functions->ResidualInnerProd))(matvec_data, A, x, b, r, NULL, r_prod, NULL);
+   }
+   else
+   {
+      (*(pcg_functions->CopyVector))(b, r);
+      (*(pcg_functions->Matvec))(matvec_data, -1.0, A, x, 1.0, r);
+      if (r_prod)
+      {
+         *r_prod = (*(pcg_functions->InnerProd))(r, r);
+      }
+   }
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_PCGUpdateSolutionResidual
+ *
+ * x = x + alpha*p, r = r - alpha*s and, if r_prod is not NULL,
+ * r_prod = <r,r>.  Uses the fused UpdateSolutionResidual function when the
+ * function table provides one.
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_PCGUpdateSolutionResidual( hypre_PCGFunctions *pcg_functions,
+                                 HYPRE_Complex alpha, void *p, void *s, void *x, void *r,
+                                 HYPRE_Real *r_prod )
+{
+   if (pcg_functions->UpdateSolutionResidual)
+   {
+      (*(pcg_functions->UpdateSolutionResidual))(alpha, p, s, x, r, r_prod);
+   }
+   else
+   {
+      (*(pcg_functions->Axpy))(alpha, p, x);
+      (*(pcg_functions->Axpy))(-alpha, s, r);
+      if (r_prod)
+      {
+         *r_prod = (*(pcg_functions->InnerProd))(r, r);
+      }
+   }
+}
+
 /*--------------------------------------------------------------------------
  * hypre_PCGCreate
  *--------------------------------------------------------------------------*/
@@ -322,6 +414,7 @@ hypre_PCGSolve( void *pcg_vdata,
 
    HYPRE_Real      i_prod = 0.0;
    HYPRE_Real      i_prod_0 = 0.0;
+   HYPRE_Real      r_prod = 0.0;
    HYPRE_Real      cf_ave_0 = 0.0;
    HYPRE_Real      cf_ave_1 = 0.0;
    HYPRE_Real      weight;
@@ -440,10 +533,10 @@ hypre_PCGSolve( void *pcg_vdata,
          action to force iterations even though the exact value was known. */
    };
 
-   /* r = b - Ax */
-   (*(pcg_functions->CopyVector))(b, r);
-
-   (*(pcg_functions->Matvec))(matvec_data, -1.0, A, x, 1.0, r);
+   /* r = b - Ax, and i_prod_0 = <r,r> if it is needed below */
+   hypre_PCGResidual(pcg_functions, matvec_data, A, x, b, r,
+                     (two_norm && (logging > 0 || print_level > 0 || cf_tol > 0.0)) ?
+                     &i_prod_0 : NULL);
 
    //hypre_ParVectorUpdateHost(r);
    /* p = C*r */
@@ -480,11 +573,7 @@ hypre_PCGSolve( void *pcg_vdata,
    /* Set initial residual norm */
    if ( logging > 0 || print_level > 0 || cf_tol > 0.0 )
    {
-      if (two_norm)
-      {
-         i_prod_0 = (*(pcg_functions->InnerProd))(r, r);
-      }
-      else
+      if (!two_norm)
       {
          i_prod_0 = gamma;
       }
@@ -549,22 +638,23 @@ hypre_PCGSolve( void *pcg_vdata,
 
       gamma_old = gamma;
 
-      /* x = x + alpha*p */
-      (*(pcg_functions->Axpy))(alpha, p, x);
-
-      /* r = r - alpha*s */
       if ( !recompute_true_residual )
       {
-         (*(pcg_functions->Axpy))(-alpha, s, r);
+         /* x = x + alpha*p, r = r - alpha*s, and r_prod = <r,r> if needed */
+         hypre_PCGUpdateSolutionResidual(pcg_functions, alpha, p, s, x, r,
+                                         two_norm ? &r_prod : NULL);
       }
       else
       {
+         /* x = x + alpha*p */
+         (*(pcg_functions->Axpy))(alpha, p, x);
+
          if (print_level > 1 && my_id == 0)
          {
             hypre_printf("Recomputing the residual...\n");
          }
-         (*(pcg_functions->CopyVector))(b, r);
-         (*(pcg_functions->Matvec))(matvec_data, -1.0, A, x, 1.0, r);
+         hypre_PCGResidual(pcg_functions, matvec_data, A, x, b, r,
+                           two_norm ? &i_prod : NULL);
       }
 
       /* residual-based stopping criteria: ||r_new-r_old|| < rtol ||b|| */
@@ -604,10 +694,13 @@ hypre_PCGSolve( void *pcg_vdata,
          }
       }
 
-      /* set i_prod for convergence test */
+      /* set i_prod for convergence test (<r,r> was computed along with r above) */
       if (two_norm)
       {
-         i_prod = (*(pcg_functions->InnerProd))(r, r);
+         if (!recompute_true_residual)
+         {
+            i_prod = r_prod;
+         }
       }
       else
       {
@@ -669,16 +762,12 @@ hypre_PCGSolve( void *pcg_vdata,
             This calculation is coded on the assumption that r's accuracy is only a
             concern for problems where CG takes many iterations. */
       {
-         /* r = b - Ax */
-         (*(pcg_functions->CopyVector))(b, r);
-         (*(pcg_functions->Matvec))(matvec_data, -1.0, A, x, 1.0, r);
+         /* r = b - Ax, and i_prod = <r,r> for the convergence test */
+         hypre_PCGResidual(pcg_functions, matvec_data, A, x, b, r,
+                           two_norm ? &i_prod : NULL);
 
          /* set i_prod for convergence test */
-         if (two_norm)
-         {
-            i_prod = (*(pcg_functions->InnerProd))(r, r);
-         }
-         else
+         if (!two_norm)
          {
             /* s = C*r */
             (*(pcg_functions->ClearVector))(s);
@@ -759,8 +848,15 @@ hypre_PCGSolve( void *pcg_vdata,
       /* p = s + beta p */
       if ( !recompute_true_residual )
       {
-         (*(pcg_functions->ScaleVector))(beta, p);
-         (*(pcg_functions->Axpy))(1.0, s, p);
+         if (pcg_functions->Axpby)
+         {
+            (*(pcg_functions->Axpby))(1.0, s, beta, p);
+         }
+         else
+         {
+            (*(pcg_functions->ScaleVector))(beta, p);
+            (*(pcg_functions->Axpy))(1.0, s, p);
+         }
       }
       else
       {
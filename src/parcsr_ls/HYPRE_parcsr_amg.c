@@ -124,6 +124,39 @@ HYPRE_BoomerAMGSolveT( HYPRE_Solver solver,
                                    (hypre_ParVector *) x ) );
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_BoomerAMGTune
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BoomerAMGTune( HYPRE_Solver        solver,
+                     HYPRE_ParCSRMatrix  A,
+                     HYPRE_Real          time_budget,
+                     HYPRE_Int           num_solves,
+                     const char         *filename )
+{
+   if (!A)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+
+   return ( hypre_BoomerAMGTune( (void *) solver,
+                                 (hypre_ParCSRMatrix *) A,
+                                 time_budget, num_solves, filename ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_BoomerAMGReadTunedParams
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BoomerAMGReadTunedParams( HYPRE_Solver  solver,
+                                const char   *filename )
+{
+   return ( hypre_BoomerAMGReadTunedParams( (void *) solver, filename ) );
+}
+
 /*--------------------------------------------------------------------------
  * HYPRE_BoomerAMGSetRestriction
  *--------------------------------------------------------------------------*/
@@ -265,6 +298,24 @@ HYPRE_BoomerAMGGetCoarsenCutFactor( HYPRE_Solver  solver,
    return ( hypre_BoomerAMGGetCoarsenCutFactor( (void *) solver, coarsen_cut_factor ) );
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_BoomerAMGSetCoarsenThreadBlocks, HYPRE_BoomerAMGGetCoarsenThreadBlocks
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BoomerAMGSetCoarsenThreadBlocks( HYPRE_Solver solver,
+                                       HYPRE_Int    coarsen_thread_blocks )
+{
+   return ( hypre_BoomerAMGSetCoarsenThreadBlocks( (void *) solver, coarsen_thread_blocks ) );
+}
+
+HYPRE_Int
+HYPRE_BoomerAMGGetCoarsenThreadBlocks( HYPRE_Solver  solver,
+                                       HYPRE_Int    *coarsen_thread_blocks )
+{
+   return ( hypre_BoomerAMGGetCoarsenThreadBlocks( (void *) solver, coarsen_thread_blocks ) );
+}
+
 /*--------------------------------------------------------------------------
  * HYPRE_BoomerAMGSetStrongThreshold, HYPRE_BoomerAMGGetStrongThreshold
  *--------------------------------------------------------------------------*/
@@ -587,6 +638,42 @@ HYPRE_BoomerAMGGetFCycle( HYPRE_Solver solver,
    return ( hypre_BoomerAMGGetFCycle( (void *) solver, fcycle ) );
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_BoomerAMGSetKCycle, HYPRE_BoomerAMGGetKCycle
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BoomerAMGSetKCycle( HYPRE_Solver solver,
+                          HYPRE_Int    kcycle  )
+{
+   return ( hypre_BoomerAMGSetKCycle( (void *) solver, kcycle ) );
+}
+
+HYPRE_Int
+HYPRE_BoomerAMGGetKCycle( HYPRE_Solver solver,
+                          HYPRE_Int   *kcycle  )
+{
+   return ( hypre_BoomerAMGGetKCycle( (void *) solver, kcycle ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_BoomerAMGSetKCycleNumIter, HYPRE_BoomerAMGGetKCycleNumIter
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BoomerAMGSetKCycleNumIter( HYPRE_Solver solver,
+                                 HYPRE_Int    num_iter  )
+{
+   return ( hypre_BoomerAMGSetKCycleNumIter( (void *) solver, num_iter ) );
+}
+
+HYPRE_Int
+HYPRE_BoomerAMGGetKCycleNumIter( HYPRE_Solver solver,
+                                 HYPRE_Int   *num_iter  )
+{
+   return ( hypre_BoomerAMGGetKCycleNumIter( (void *) solver, num_iter ) );
+}
+
 /*--------------------------------------------------------------------------
  * HYPRE_BoomerAMGSetConvergeType, HYPRE_BoomerAMGGetConvergeType
  *--------------------------------------------------------------------------*/
@@ -1505,6 +1592,17 @@ HYPRE_BoomerAMGSetAggNumLevels( HYPRE_Solver  solver,
    return ( hypre_BoomerAMGSetAggNumLevels( (void *) solver, agg_num_levels ) );
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_BoomerAMGSetSmoothAggNumLevels
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BoomerAMGSetSmoothAggNumLevels( HYPRE_Solver  solver,
+                                      HYPRE_Int          sa_num_levels  )
+{
+   return ( hypre_BoomerAMGSetSmoothAggNumLevels( (void *) solver, sa_num_levels ) );
+}
+
 /*--------------------------------------------------------------------------
  * HYPRE_BoomerAMGSetAggInterpType
  *--------------------------------------------------------------------------*/
@@ -1817,6 +1915,17 @@ HYPRE_BoomerAMGSetChebyScale( HYPRE_Solver  solver,
    return ( hypre_BoomerAMGSetChebyScale( (void *) solver, scale ) );
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_BoomerAMGSetChebyMatPowers
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BoomerAMGSetChebyMatPowers( HYPRE_Solver  solver,
+                                  HYPRE_Int     mat_powers )
+{
+   return ( hypre_BoomerAMGSetChebyMatPowers( (void *) solver, mat_powers ) );
+}
+
 /*--------------------------------------------------------------------------
  * HYPRE_BoomerAMGSetChebyVariant
  *--------------------------------------------------------------------------*/
@@ -1977,6 +2086,17 @@ HYPRE_BoomerAMGSetAddLastLvl( HYPRE_Solver solver,
    return ( hypre_BoomerAMGSetAddLastLvl( (void *) solver, add_last_lvl ) );
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_BoomerAMGSetAddComposite
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BoomerAMGSetAddComposite( HYPRE_Solver solver,
+                                HYPRE_Int    add_composite  )
+{
+   return ( hypre_BoomerAMGSetAddComposite( (void *) solver, add_composite ) );
+}
+
 /*--------------------------------------------------------------------------
  * HYPRE_BoomerAMGSetNonGalerkinTol
  *--------------------------------------------------------------------------*/
@@ -2012,6 +2132,17 @@ HYPRE_BoomerAMGSetNonGalerkTol (HYPRE_Solver solver,
    return (hypre_BoomerAMGSetNonGalerkTol ( (void *) solver, nongalerk_num_tol, nongalerk_tol ) );
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_BoomerAMGSetNonGalerkinRAP
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BoomerAMGSetNonGalerkinRAP (HYPRE_Solver solver,
+                                  HYPRE_Int    nongalerkin_rap)
+{
+   return (hypre_BoomerAMGSetNonGalerkinRAP ( (void *) solver, nongalerkin_rap ) );
+}
+
 /*--------------------------------------------------------------------------
  * HYPRE_BoomerAMGSetRAP2
  *--------------------------------------------------------------------------*/
@@ -2045,6 +2176,61 @@ HYPRE_BoomerAMGSetKeepTranspose (HYPRE_Solver solver,
    return (hypre_BoomerAMGSetKeepTranspose ( (void *) solver, keepTranspose ) );
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_BoomerAMGSetCompressIndices
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BoomerAMGSetCompressIndices (HYPRE_Solver solver,
+                                   HYPRE_Int    compress_indices)
+{
+   return (hypre_BoomerAMGSetCompressIndices ( (void *) solver, compress_indices ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_BoomerAMGSetPersistentComm
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BoomerAMGSetPersistentComm (HYPRE_Solver solver,
+                                  HYPRE_Int    persistent_comm)
+{
+   return (hypre_BoomerAMGSetPersistentComm ( (void *) solver, persistent_comm ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_BoomerAMGSetMergedLayout
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BoomerAMGSetMergedLayout (HYPRE_Solver solver,
+                                HYPRE_Int    merged_layout)
+{
+   return (hypre_BoomerAMGSetMergedLayout ( (void *) solver, merged_layout ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_BoomerAMGSetSetupTimings
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BoomerAMGSetSetupTimings (HYPRE_Solver solver,
+                                HYPRE_Int    setup_timings)
+{
+   return (hypre_BoomerAMGSetSetupTimings ( (void *) solver, setup_timings ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_BoomerAMGSetMemoryBudget
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BoomerAMGSetMemoryBudget (HYPRE_Solver solver,
+                                HYPRE_Real   memory_budget)
+{
+   return (hypre_BoomerAMGSetMemoryBudget ( (void *) solver, memory_budget ) );
+}
+
 #ifdef HYPRE_USING_DSUPERLU
 /*--------------------------------------------------------------------------
  * HYPRE_BoomerAMGSetDSLUThreshold
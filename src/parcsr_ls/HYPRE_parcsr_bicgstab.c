@@ -31,6 +31,9 @@ HYPRE_ParCSRBiCGSTABCreate( MPI_Comm comm, HYPRE_Solver *solver )
          hypre_ParKrylovScaleVector, hypre_ParKrylovAxpy,
          hypre_ParKrylovCommInfo,
          hypre_ParKrylovIdentitySetup, hypre_ParKrylovIdentity );
+   hypre_BiCGSTABFunctionsSetVectorUpdates(bicgstab_functions,
+                                           hypre_ParKrylovUpdateSolutionResidual,
+                                           hypre_ParKrylovAxpby);
    *solver = ( (HYPRE_Solver) hypre_BiCGSTABCreate( bicgstab_functions) );
 
    return hypre_error_flag;
@@ -32,6 +32,7 @@ HYPRE_ParCSRGMRESCreate( MPI_Comm comm, HYPRE_Solver *solver )
          hypre_ParKrylovClearVector,
          hypre_ParKrylovScaleVector, hypre_ParKrylovAxpy,
          hypre_ParKrylovIdentitySetup, hypre_ParKrylovIdentity );
+   hypre_GMRESFunctionsSetResidualInnerProd(gmres_functions, hypre_ParKrylovResidualInnerProd);
    *solver = ( (HYPRE_Solver) hypre_GMRESCreate( gmres_functions ) );
 
    return hypre_error_flag;
@@ -154,6 +154,353 @@ aux_indexFromMask( HYPRE_Int n, HYPRE_Int* mask, HYPRE_Int* index )
 }
 
 
+/*--------------------------------------------------------------------------
+ * Fused multivector kernels for ParCSR vectors.
+ *
+ * The generic mv_TempMultiVector routines go through the vector interpreter
+ * one column pair at a time, so a Gram matrix x'*y costs mx*my global
+ * reductions and a product x*r costs mx*my separate axpy sweeps.  The
+ * routines below work directly on the local data of the hypre_ParVector
+ * columns: local sums are accumulated over row blocks and reduced with a
+ * single MPI_Allreduce, and products are formed row block by row block so
+ * that each block of x is read from cache for every column of y.
+ *--------------------------------------------------------------------------*/
+
+#define HYPRE_PARCSR_MV_BLOCK 128
+
+static HYPRE_Int
+hypre_ParCSRMultiVectorIsHost( mv_TempMultiVector *x )
+{
+#if defined(HYPRE_USING_GPU)
+   if (x->numVectors > 0 &&
+       hypre_GetExecPolicy1(hypre_ParVectorMemoryLocation((hypre_ParVector *) x->vector[0])) ==
+       HYPRE_EXEC_DEVICE)
+   {
+      return 0;
+   }
+#else
+   (void) x;
+#endif
+
+   return 1;
+}
+
+static void
+hypre_ParCSRMultiVectorCollectData( mv_TempMultiVector *x,
+                                    HYPRE_Complex     **data )
+{
+   HYPRE_Int ix, jx;
+
+   for (ix = 0, jx = 0; ix < x->numVectors; ix++)
+   {
+      if (x->mask == NULL || x->mask[ix])
+      {
+         data[jx++] = hypre_VectorData(hypre_ParVectorLocalVector((hypre_ParVector *) x->vector[ix]));
+      }
+   }
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMultiVectorByMultiVector
+ *
+ * xy = x'*y with one global reduction for the whole block.
+ *--------------------------------------------------------------------------*/
+
+void
+hypre_ParCSRMultiVectorByMultiVector( void *x_, void *y_,
+                                      HYPRE_Int xyGHeight, HYPRE_Int xyHeight,
+                                      HYPRE_Int xyWidth, HYPRE_Complex *xyVal )
+{
+   mv_TempMultiVector  *x = (mv_TempMultiVector *) x_;
+   mv_TempMultiVector  *y = (mv_TempMultiVector *) y_;
+   HYPRE_Int            mx, my, nxy, size, num_threads;
+   HYPRE_Int            ix, iy, k, t;
+   HYPRE_Complex      **xd, **yd;
+   HYPRE_Real          *local, *global;
+   MPI_Comm             comm;
+
+   hypre_assert( x != NULL && y != NULL );
+
+   if (!hypre_ParCSRMultiVectorIsHost(x) || !hypre_ParCSRMultiVectorIsHost(y))
+   {
+      mv_TempMultiVectorByMultiVector(x_, y_, xyGHeight, xyHeight, xyWidth, xyVal);
+      return;
+   }
+
+   mx = aux_maskCount( x->numVectors, x->mask );
+   my = aux_maskCount( y->numVectors, y->mask );
+   hypre_assert( mx == xyHeight && my == xyWidth );
+
+   nxy = mx * my;
+   if (nxy == 0)
+   {
+      return;
+   }
+
+   comm = hypre_ParVectorComm((hypre_ParVector *) x->vector[0]);
+   size = hypre_VectorSize(hypre_ParVectorLocalVector((hypre_ParVector *) x->vector[0]));
+   num_threads = hypre_NumThreads();
+
+   xd     = hypre_TAlloc(HYPRE_Complex *, mx, HYPRE_MEMORY_HOST);
+   yd     = hypre_TAlloc(HYPRE_Complex *, my, HYPRE_MEMORY_HOST);
+   local  = hypre_CTAlloc(HYPRE_Real, num_threads * nxy, HYPRE_MEMORY_HOST);
+   global = hypre_TAlloc(HYPRE_Real, nxy, HYPRE_MEMORY_HOST);
+
+   hypre_ParCSRMultiVectorCollectData(x, xd);
+   hypre_ParCSRMultiVectorCollectData(y, yd);
+
+#if defined(HYPRE_USING_OPENMP)
+   #pragma omp parallel private(ix, iy, k)
+#endif
+   {
+      HYPRE_Int   ns, ne, kb, ke;
+      HYPRE_Real  sum;
+      HYPRE_Real *tlocal = local + hypre_GetThreadNum() * nxy;
+
+      hypre_GetSimpleThreadPartition(&ns, &ne, size);
+
+      for (kb = ns; kb < ne; kb += HYPRE_PARCSR_MV_BLOCK)
+      {
+         ke = hypre_min(kb + HYPRE_PARCSR_MV_BLOCK, ne);
+         for (iy = 0; iy < my; iy++)
+         {
+            for (ix = 0; ix < mx; ix++)
+            {
+               sum = 0.0;
+               for (k = kb; k < ke; k++)
+               {
+                  sum += hypre_conj(yd[iy][k]) * xd[ix][k];
+               }
+               tlocal[iy * mx + ix] += sum;
+            }
+         }
+      }
+   }
+
+   /* Combine the thread contributions in a fixed order */
+   for (t = 1; t < num_threads; t++)
+   {
+      for (k = 0; k < nxy; k++)
+      {
+         local[k] += local[t * nxy + k];
+      }
+   }
+
+   hypre_MPI_Allreduce(local, global, nxy, HYPRE_MPI_REAL, hypre_MPI_SUM, comm);
+
+   for (iy = 0; iy < my; iy++)
+   {
+      for (ix = 0; ix < mx; ix++)
+      {
+         xyVal[iy * xyGHeight + ix] = global[iy * mx + ix];
+      }
+   }
+
+   hypre_TFree(xd, HYPRE_MEMORY_HOST);
+   hypre_TFree(yd, HYPRE_MEMORY_HOST);
+   hypre_TFree(local, HYPRE_MEMORY_HOST);
+   hypre_TFree(global, HYPRE_MEMORY_HOST);
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMultiVectorByMultiVectorDiag
+ *
+ * diag = diag(x'*y) with one global reduction.
+ *--------------------------------------------------------------------------*/
+
+void
+hypre_ParCSRMultiVectorByMultiVectorDiag( void *x_, void *y_,
+                                          HYPRE_Int *mask, HYPRE_Int n, HYPRE_Complex *diag )
+{
+   mv_TempMultiVector  *x = (mv_TempMultiVector *) x_;
+   mv_TempMultiVector  *y = (mv_TempMultiVector *) y_;
+   HYPRE_Int            m, size, num_threads;
+   HYPRE_Int            i, k, t;
+   HYPRE_Int           *index;
+   HYPRE_Complex      **xd, **yd;
+   HYPRE_Real          *local, *global;
+   MPI_Comm             comm;
+
+   hypre_assert( x != NULL && y != NULL );
+
+   if (!hypre_ParCSRMultiVectorIsHost(x) || !hypre_ParCSRMultiVectorIsHost(y))
+   {
+      mv_TempMultiVectorByMultiVectorDiag(x_, y_, mask, n, diag);
+      return;
+   }
+
+   m = aux_maskCount( n, mask );
+   hypre_assert( aux_maskCount( x->numVectors, x->mask ) == m &&
+                 aux_maskCount( y->numVectors, y->mask ) == m );
+
+   if (m == 0)
+   {
+      return;
+   }
+
+   comm = hypre_ParVectorComm((hypre_ParVector *) x->vector[0]);
+   size = hypre_VectorSize(hypre_ParVectorLocalVector((hypre_ParVector *) x->vector[0]));
+   num_threads = hypre_NumThreads();
+
+   xd     = hypre_TAlloc(HYPRE_Complex *, m, HYPRE_MEMORY_HOST);
+   yd     = hypre_TAlloc(HYPRE_Complex *, m, HYPRE_MEMORY_HOST);
+   index  = hypre_TAlloc(HYPRE_Int, m, HYPRE_MEMORY_HOST);
+   local  = hypre_CTAlloc(HYPRE_Real, num_threads * m, HYPRE_MEMORY_HOST);
+   global = hypre_TAlloc(HYPRE_Real, m, HYPRE_MEMORY_HOST);
+
+   hypre_ParCSRMultiVectorCollectData(x, xd);
+   hypre_ParCSRMultiVectorCollectData(y, yd);
+   aux_indexFromMask( n, mask, index );
+
+#if defined(HYPRE_USING_OPENMP)
+   #pragma omp parallel private(i, k)
+#endif
+   {
+      HYPRE_Int   ns, ne;
+      HYPRE_Real  sum;
+      HYPRE_Real *tlocal = local + hypre_GetThreadNum() * m;
+
+      hypre_GetSimpleThreadPartition(&ns, &ne, size);
+
+      for (i = 0; i < m; i++)
+      {
+         sum = 0.0;
+         for (k = ns; k < ne; k++)
+         {
+            sum += hypre_conj(yd[i][k]) * xd[i][k];
+         }
+         tlocal[i] = sum;
+      }
+   }
+
+   for (t = 1; t < num_threads; t++)
+   {
+      for (i = 0; i < m; i++)
+      {
+         local[i] += local[t * m + i];
+      }
+   }
+
+   hypre_MPI_Allreduce(local, global, m, HYPRE_MPI_REAL, hypre_MPI_SUM, comm);
+
+   for (i = 0; i < m; i++)
+   {
+      diag[index[i] - 1] = global[i];
+   }
+
+   hypre_TFree(xd, HYPRE_MEMORY_HOST);
+   hypre_TFree(yd, HYPRE_MEMORY_HOST);
+   hypre_TFree(index, HYPRE_MEMORY_HOST);
+   hypre_TFree(local, HYPRE_MEMORY_HOST);
+   hypre_TFree(global, HYPRE_MEMORY_HOST);
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMultiVectorByMatrixCore
+ *
+ * y = x*r (beta = 0) or y = y + x*r (beta = 1), one sweep over y.
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_ParCSRMultiVectorByMatrixCore( mv_TempMultiVector *x,
+                                     HYPRE_Int rGHeight, HYPRE_Int rHeight,
+                                     HYPRE_Int rWidth, HYPRE_Complex *rVal,
+                                     mv_TempMultiVector *y,
+                                     HYPRE_Int beta )
+{
+   HYPRE_Int            mx, my, size;
+   HYPRE_Int            i, j, k, kb;
+   HYPRE_Complex      **xd, **yd;
+
+   mx = aux_maskCount( x->numVectors, x->mask );
+   my = aux_maskCount( y->numVectors, y->mask );
+   hypre_assert( mx == rHeight && my == rWidth );
+
+   if (my == 0)
+   {
+      return;
+   }
+
+   size = hypre_VectorSize(hypre_ParVectorLocalVector((hypre_ParVector *) y->vector[0]));
+
+   xd = hypre_TAlloc(HYPRE_Complex *, mx, HYPRE_MEMORY_HOST);
+   yd = hypre_TAlloc(HYPRE_Complex *, my, HYPRE_MEMORY_HOST);
+
+   hypre_ParCSRMultiVectorCollectData(x, xd);
+   hypre_ParCSRMultiVectorCollectData(y, yd);
+
+#if defined(HYPRE_USING_OPENMP)
+   #pragma omp parallel for private(kb, i, j, k) HYPRE_SMP_SCHEDULE
+#endif
+   for (kb = 0; kb < size; kb += HYPRE_PARCSR_MV_BLOCK)
+   {
+      HYPRE_Int      ke = hypre_min(kb + HYPRE_PARCSR_MV_BLOCK, size);
+      HYPRE_Complex  r;
+
+      for (j = 0; j < my; j++)
+      {
+         if (!beta)
+         {
+            for (k = kb; k < ke; k++)
+            {
+               yd[j][k] = 0.0;
+            }
+         }
+         for (i = 0; i < mx; i++)
+         {
+            r = rVal[j * rGHeight + i];
+            for (k = kb; k < ke; k++)
+            {
+               yd[j][k] += r * xd[i][k];
+            }
+         }
+      }
+   }
+
+   hypre_TFree(xd, HYPRE_MEMORY_HOST);
+   hypre_TFree(yd, HYPRE_MEMORY_HOST);
+}
+
+void
+hypre_ParCSRMultiVectorByMatrix( void *x_,
+                                 HYPRE_Int rGHeight, HYPRE_Int rHeight,
+                                 HYPRE_Int rWidth, HYPRE_Complex *rVal,
+                                 void *y_ )
+{
+   mv_TempMultiVector *x = (mv_TempMultiVector *) x_;
+   mv_TempMultiVector *y = (mv_TempMultiVector *) y_;
+
+   hypre_assert( x != NULL && y != NULL );
+
+   if (!hypre_ParCSRMultiVectorIsHost(x) || !hypre_ParCSRMultiVectorIsHost(y))
+   {
+      mv_TempMultiVectorByMatrix(x_, rGHeight, rHeight, rWidth, rVal, y_);
+      return;
+   }
+
+   hypre_ParCSRMultiVectorByMatrixCore(x, rGHeight, rHeight, rWidth, rVal, y, 0);
+}
+
+void
+hypre_ParCSRMultiVectorXapy( void *x_,
+                             HYPRE_Int rGHeight, HYPRE_Int rHeight,
+                             HYPRE_Int rWidth, HYPRE_Complex *rVal,
+                             void *y_ )
+{
+   mv_TempMultiVector *x = (mv_TempMultiVector *) x_;
+   mv_TempMultiVector *y = (mv_TempMultiVector *) y_;
+
+   hypre_assert( x != NULL && y != NULL );
+
+   if (!hypre_ParCSRMultiVectorIsHost(x) || !hypre_ParCSRMultiVectorIsHost(y))
+   {
+      mv_TempMultiVectorXapy(x_, rGHeight, rHeight, rWidth, rVal, y_);
+      return;
+   }
+
+   hypre_ParCSRMultiVectorByMatrixCore(x, rGHeight, rHeight, rWidth, rVal, y, 1);
+}
+
 /* The function below is a temporary one that fills the multivector
    part of the HYPRE_InterfaceInterpreter structure with pointers
    that come from the temporary implementation of the multivector
@@ -202,7 +549,15 @@ HYPRE_TempParCSRSetupInterpreter( mv_InterfaceInterpreter *i )
 HYPRE_Int
 HYPRE_ParCSRSetupInterpreter( mv_InterfaceInterpreter *i )
 {
-   return HYPRE_TempParCSRSetupInterpreter( i );
+   HYPRE_TempParCSRSetupInterpreter( i );
+
+   /* Block reductions and updates that work on the ParVector data directly */
+   i->MultiInnerProd = hypre_ParCSRMultiVectorByMultiVector;
+   i->MultiInnerProdDiag = hypre_ParCSRMultiVectorByMultiVectorDiag;
+   i->MultiVecMat = hypre_ParCSRMultiVectorByMatrix;
+   i->MultiXapy = hypre_ParCSRMultiVectorXapy;
+
+   return 0;
 }
 
 HYPRE_Int
@@ -136,6 +136,37 @@ HYPRE_Int HYPRE_BoomerAMGSolveT(HYPRE_Solver       solver,
                                 HYPRE_ParVector    b,
                                 HYPRE_ParVector    x);
 
+/**
+ * (Optional) Selects the coarsening and interpolation, strength threshold,
+ * interpolation truncation and smoother that minimize the estimated time
+ * of \e num\_solves solves with \e A to the tolerance of the solver
+ * (a reduction by 1e-6 if the tolerance is 0, as for a preconditioner).
+ * Starting from the current settings, each group of parameters is varied
+ * in turn, and every candidate is timed with a setup and a few V-cycles.
+ * No new trial is started once \e time\_budget seconds have elapsed
+ * (0 means no limit).  The selected parameters are set in the solver and,
+ * if \e filename is not NULL, written to that file for
+ * HYPRE\_BoomerAMGReadTunedParams.  With print level 1 or higher, the
+ * trials are printed.  The solver has to be set up after this call.
+ *
+ * @param solver [IN] solver object whose parameters are tuned.
+ * @param A [IN] ParCSR matrix
+ * @param time_budget [IN] time budget in seconds
+ * @param num_solves [IN] number of solves the setup is amortized over
+ * @param filename [IN] output file for the selected parameters, or NULL
+ **/
+HYPRE_Int HYPRE_BoomerAMGTune(HYPRE_Solver        solver,
+                              HYPRE_ParCSRMatrix  A,
+                              HYPRE_Real          time_budget,
+                              HYPRE_Int           num_solves,
+                              const char         *filename);
+
+/**
+ * (Optional) Sets the parameters written by HYPRE\_BoomerAMGTune.
+ **/
+HYPRE_Int HYPRE_BoomerAMGReadTunedParams(HYPRE_Solver  solver,
+                                         const char   *filename);
+
 /**
  * Recovers old default for coarsening and interpolation, i.e Falgout
  * coarsening and untruncated modified classical interpolation.
@@ -250,6 +281,19 @@ HYPRE_Int HYPRE_BoomerAMGSetMaxLevels(HYPRE_Solver solver,
 HYPRE_Int HYPRE_BoomerAMGSetCoarsenCutFactor(HYPRE_Solver solver,
                                              HYPRE_Int    coarsen_cut_factor);
 
+/**
+ * (Optional) If set to 1, the first pass of the Ruge-Stueben (coarsen
+ * types 1-5 and 11), Falgout (6) and HMIS (10) coarsenings runs on
+ * contiguous blocks of local rows, one per OpenMP thread, ignoring the
+ * strong connections between blocks as with processor boundaries.  Blocks
+ * hold at least 1000 rows, so small problems still use one block.  The
+ * coarse grids then depend on the number of threads, and they may be
+ * sparser or denser than with one block, which changes the convergence.
+ * The default is 0 (one block, independent of the number of threads).
+ **/
+HYPRE_Int HYPRE_BoomerAMGSetCoarsenThreadBlocks(HYPRE_Solver solver,
+                                                HYPRE_Int    coarsen_thread_blocks);
+
 /**
  * (Optional) Sets AMG strength threshold. The default is 0.25.
  * For 2D Laplace operators, 0.25 is a good value, for 3D Laplace
@@ -363,6 +407,26 @@ HYPRE_Int HYPRE_BoomerAMGSetNonGalerkTol (HYPRE_Solver solver,
                                           HYPRE_Int    nongalerk_num_tol,
                                           HYPRE_Real  *nongalerk_tol);
 
+/**
+ * (Optional) Defines how non-Galerkin coarse grid operators are built
+ * on levels with a positive non-Galerkin drop-tolerance.
+ *
+ * The options are:
+ *
+ *    - 0 : form the Galerkin product RAP and then sparsify it (default)
+ *    - 1 : sparsify each row inside the RAP triple product. Entries smaller
+ *          than the drop-tolerance times the largest off-diagonal entry of the
+ *          row, and outside the pattern of the injected product (A P)_{C,:},
+ *          are never stored; their values are redistributed within the row
+ *          so that row sums are preserved. This reduces setup time and
+ *          memory, since the Galerkin operator is never stored in full,
+ *          but does not collapse symmetrically, so the coarse operators can
+ *          be slightly nonsymmetric and large tolerances should be avoided.
+ *          Host only.
+ **/
+HYPRE_Int HYPRE_BoomerAMGSetNonGalerkinRAP (HYPRE_Solver solver,
+                                            HYPRE_Int    nongalerkin_rap);
+
 /**
  * (Optional) Defines whether local or global measures are used.
  **/
@@ -376,6 +440,24 @@ HYPRE_Int HYPRE_BoomerAMGSetMeasureType(HYPRE_Solver solver,
 HYPRE_Int HYPRE_BoomerAMGSetAggNumLevels(HYPRE_Solver solver,
                                          HYPRE_Int    agg_num_levels);
 
+/**
+ * (Optional) Defines the number of levels, starting with the finest level,
+ * that are coarsened by smoothed aggregation instead of the classical
+ * coarsening and interpolation.  The aggregates are formed from the local
+ * part of the strength matrix, the tentative prolongator interpolates one
+ * constant vector per function plus the vectors given by
+ * HYPRE\_BoomerAMGSetInterpVectors (e.g. the rotational rigid body modes
+ * for elasticity), and is smoothed by one damped Jacobi step.  The
+ * interpolation truncation parameters apply to the smoothed prolongator
+ * when no interpolation vectors are given.  The unknowns of a node must be
+ * numbered contiguously.  On these levels, smoothed aggregation takes
+ * precedence over aggressive coarsening, and it replaces the interpolation
+ * set by HYPRE\_BoomerAMGSetInterpVecVariant.  This option is not
+ * available in block mode or on GPUs.  The default is 0.
+ **/
+HYPRE_Int HYPRE_BoomerAMGSetSmoothAggNumLevels(HYPRE_Solver solver,
+                                               HYPRE_Int    sa_num_levels);
+
 /**
  * (Optional) Defines the degree of aggressive coarsening.
  * The default is 1. Larger numbers lead to less aggressive
@@ -593,6 +675,30 @@ HYPRE_Int
 HYPRE_BoomerAMGSetFCycle( HYPRE_Solver solver,
                           HYPRE_Int    fcycle  );
 
+/**
+ * (Optional) Specifies the use of a K-cycle on the first \e kcycle coarse
+ * levels (levels 1 through \e kcycle, excluding the coarsest level).  On each
+ * of these levels, the coarse-grid correction is computed by a few iterations
+ * of flexible GMRES preconditioned by the cycle itself, which makes the cycle
+ * much more robust for aggressive coarsening at a cost close to that of a
+ * V-cycle.  The K-cycle is a nonlinear preconditioner, so BoomerAMG should be
+ * used as a solver or as a preconditioner for FlexGMRES.  Not available in
+ * block mode, with multiple vectors, or with additive cycles.
+ * The default is 0 (no K-cycle).
+ **/
+HYPRE_Int
+HYPRE_BoomerAMGSetKCycle( HYPRE_Solver solver,
+                          HYPRE_Int    kcycle  );
+
+/**
+ * (Optional) Sets the maximum number of inner Krylov iterations on each
+ * K-cycle level.  Iterations stop early once the coarse residual has been
+ * reduced by a factor of 4.  The default is 2.
+ **/
+HYPRE_Int
+HYPRE_BoomerAMGSetKCycleNumIter( HYPRE_Solver solver,
+                                 HYPRE_Int    num_iter  );
+
 /**
  * (Optional) Defines use of an additive V(1,1)-cycle using the
  * classical additive method starting at level 'addlvl'.
@@ -639,6 +745,21 @@ HYPRE_Int HYPRE_BoomerAMGSetSimple(HYPRE_Solver solver,
 HYPRE_Int HYPRE_BoomerAMGSetAddLastLvl(HYPRE_Solver solver,
                                        HYPRE_Int    add_last_lvl);
 
+/**
+ * (Optional) If set to 1, the additive, mult-additive or simple cycle
+ * restricts the residual to all additive levels with a single composite
+ * operator, and interpolates all corrections back with its transpose.
+ * This replaces the level-by-level restriction and interpolation by one
+ * threaded matvec each and one halo exchange each, at the cost of building
+ * the products of the interpolation operators during setup.
+ * The default is 0. Has no effect together with an AIR
+ * restriction (see HYPRE_BoomerAMGSetRestriction).
+ *
+ * Can only be used when AMG is used as a preconditioner !!!
+ **/
+HYPRE_Int HYPRE_BoomerAMGSetAddComposite(HYPRE_Solver solver,
+                                         HYPRE_Int    add_composite);
+
 /**
  * (Optional) Defines the truncation factor for the
  * smoothed interpolation used for mult-additive or simple method.
@@ -885,6 +1006,18 @@ HYPRE_Int HYPRE_BoomerAMGSetChebyFraction (HYPRE_Solver solver,
 HYPRE_Int HYPRE_BoomerAMGSetChebyScale (HYPRE_Solver solver,
                                         HYPRE_Int   scale);
 
+/**
+ * (Optional) Defines whether the Chebyshev smoother evaluates its polynomial
+ *  with a matrix powers kernel, which replicates the rows of A on a ghost
+ *  region so that only one halo exchange is needed per smoothing step
+ *  instead of one per matrix-vector product. This trades setup time and
+ *  memory for fewer messages and only applies to polynomials of degree two
+ *  or more (order 3 and 4) on the host. Results agree with the default
+ *  evaluation up to rounding. The default is 0 (i.e., off).
+ **/
+HYPRE_Int HYPRE_BoomerAMGSetChebyMatPowers (HYPRE_Solver solver,
+                                            HYPRE_Int    mat_powers);
+
 /**
  * (Optional) Defines which polynomial variant should be used.
  *  The default is 0 (i.e., scaled).
@@ -1277,6 +1410,78 @@ HYPRE_Int HYPRE_BoomerAMGSetModuleRAP2(HYPRE_Solver solver,
 HYPRE_Int HYPRE_BoomerAMGSetKeepTranspose(HYPRE_Solver solver,
                                           HYPRE_Int    keepTranspose);
 
+/**
+ * (Optional) If set to 1, the diagonal blocks of the matrices on all levels
+ * (including the fine-grid matrix A) store an additional copy of their column
+ * indices as 16-bit offsets, which the host matvec and hybrid Gauss-Seidel
+ * kernels read instead of the full indices.  This reduces the memory traffic
+ * of the solve phase.  Blocks whose rows span more than 65536 columns are not
+ * compressed.  The compressed indices are rebuilt by each call to
+ * HYPRE\_BoomerAMGSetup, which must be called again if the sparsity pattern
+ * of A changes, and the copy held by A is freed by HYPRE\_BoomerAMGDestroy
+ * (so the solver must be destroyed before A).  Results may differ from the
+ * uncompressed ones in the last bits.  The default is 0.
+ **/
+HYPRE_Int HYPRE_BoomerAMGSetCompressIndices(HYPRE_Solver solver,
+                                            HYPRE_Int    compress_indices);
+
+/**
+ * (Optional) If set to 1, HYPRE\_BoomerAMGSetup creates persistent MPI
+ * requests and buffers for the halo exchanges of the matrices A, P and R on
+ * all levels.  The host matvecs and the Jacobi and hybrid Gauss-Seidel
+ * smoothers then reuse them in every cycle instead of posting new
+ * nonblocking requests for each exchange.  The handles are stored in the
+ * communication packages of the matrices; those of the fine-grid matrix A
+ * are freed when the solver is destroyed (so the solver must be destroyed
+ * before A), the others with the hierarchy.  The option has no
+ * effect in block mode or when a communication package uses a node-aware or
+ * shared-memory schedule.  The default is 0.
+ **/
+HYPRE_Int HYPRE_BoomerAMGSetPersistentComm(HYPRE_Solver solver,
+                                           HYPRE_Int    persistent_comm);
+
+/**
+ * (Optional) If set to 1, HYPRE\_BoomerAMGSetup stores a merged copy of the
+ * diag and offd blocks of the matrices on all levels (including the
+ * fine-grid matrix A), in which each row holds its local columns followed
+ * by its off-processor columns.  The host matvec, residual, Jacobi and
+ * non-scaled hybrid Gauss-Seidel kernels then traverse one row stream and
+ * update each row once after the halo values have arrived, instead of
+ * overlapping the exchange with a separate pass over the diag block.  This
+ * improves locality at the cost of one extra copy of each matrix.  The copy
+ * of A is dropped when A is modified through the IJ or ParCSR interfaces
+ * (e.g., scaled), after which the solver uses the regular kernels until the
+ * next HYPRE\_BoomerAMGSetup, and it is freed when the solver is destroyed.
+ * The default is 0.
+ **/
+HYPRE_Int HYPRE_BoomerAMGSetMergedLayout(HYPRE_Solver solver,
+                                         HYPRE_Int    merged_layout);
+
+/**
+ * (Optional) If set to 1, HYPRE\_BoomerAMGSetup measures the wall-clock
+ * time it spends in coarsening, interpolation, the coarse-grid (RAP)
+ * products and the coarse-grid solver setup, summed over all levels, and
+ * rank 0 prints the maximum over all ranks at the end of the setup.  The
+ * default is 0.
+ **/
+HYPRE_Int HYPRE_BoomerAMGSetSetupTimings(HYPRE_Solver solver,
+                                         HYPRE_Int    setup_timings);
+
+/**
+ * (Optional) Sets a budget, in megabytes per process, for the memory of
+ * the operators and interpolation matrices of the hierarchy.  After each
+ * coarse-grid operator is built, the memory of the remaining levels is
+ * projected from the growth of the operators so far.  While the projection
+ * exceeds the budget, the setup of the following levels is adapted one
+ * step per level: first the interpolation is truncated to at most 3
+ * entries per row, then aggressive coarsening is used, and finally the
+ * coarse-grid operators are sparsified (non-Galerkin).  The memory of each
+ * level and the adaptation are printed with the setup statistics.  The
+ * default is 0 (no budget).
+ **/
+HYPRE_Int HYPRE_BoomerAMGSetMemoryBudget(HYPRE_Solver solver,
+                                         HYPRE_Real   memory_budget);
+
 /**
  * HYPRE_BoomerAMGSetPlotGrids
  **/
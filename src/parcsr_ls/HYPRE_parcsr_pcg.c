@@ -31,6 +31,10 @@ HYPRE_ParCSRPCGCreate( MPI_Comm comm, HYPRE_Solver *solver )
          hypre_ParKrylovClearVector,
          hypre_ParKrylovScaleVector, hypre_ParKrylovAxpy,
          hypre_ParKrylovIdentitySetup, hypre_ParKrylovIdentity );
+   hypre_PCGFunctionsSetResidualInnerProd(pcg_functions, hypre_ParKrylovResidualInnerProd);
+   hypre_PCGFunctionsSetVectorUpdates(pcg_functions,
+                                      hypre_ParKrylovUpdateSolutionResidual,
+                                      hypre_ParKrylovAxpby);
    *solver = ( (HYPRE_Solver) hypre_PCGCreate( pcg_functions ) );
 
    return hypre_error_flag;
@@ -42,6 +42,7 @@ typedef struct
    HYPRE_Int      max_levels;
    HYPRE_Real     strong_threshold;
    HYPRE_Int      coarsen_cut_factor;
+   HYPRE_Int      coarsen_thread_blocks;
    HYPRE_Real     strong_thresholdR; /* theta for build R: defines strong F neighbors */
    HYPRE_Real     filter_thresholdR; /* theta for filtering R  */
    HYPRE_Real     max_row_sum;
@@ -67,6 +68,7 @@ typedef struct
    HYPRE_Int      is_triangular;
    HYPRE_Int      gmres_switch;
    HYPRE_Int      agg_num_levels;
+   HYPRE_Int      sa_num_levels;
    HYPRE_Int      num_paths;
    HYPRE_Int      post_interp_type;
    HYPRE_Int      num_CR_relax_steps;
@@ -84,6 +86,9 @@ typedef struct
    HYPRE_Int      max_iter;
    HYPRE_Int      min_iter;
    HYPRE_Int      fcycle;
+   HYPRE_Int      kcycle;
+   HYPRE_Int      kcycle_num_iter;
+   HYPRE_Solver  *kcycle_solvers;
    HYPRE_Int      cycle_type;
    HYPRE_Int     *num_grid_sweeps;
    HYPRE_Int     *grid_relax_type;
@@ -179,6 +184,8 @@ typedef struct
    HYPRE_Real           cheby_fraction;
    hypre_Vector       **cheby_ds;
    HYPRE_Real         **cheby_coefs;
+   HYPRE_Int            cheby_mat_powers;
+   hypre_ParCSRMatPowers **cheby_powers;
 
    HYPRE_Real           cum_nnz_AP;
 
@@ -187,6 +194,7 @@ typedef struct
    HYPRE_Real         *nongalerk_tol;
    HYPRE_Real          nongalerkin_tol;
    HYPRE_Real         *nongal_tol_array;
+   HYPRE_Int           nongalerkin_rap;
 
    /* data generated in the solve phase */
    hypre_ParVector   *Vtemp;
@@ -264,11 +272,36 @@ typedef struct
    hypre_ParVector *Xtilde;
    HYPRE_Real *D_inv;
 
+   /* composite restriction to all additive levels - additive AMG */
+   HYPRE_Int      add_composite;
+   HYPRE_Int      add_comp_last_lvl;
+   hypre_ParCSRMatrix *Rhat;
+   hypre_ParVector *Rhat_r;
+   hypre_ParVector *Rhat_x;
+
    /* Use 2 mat-mat-muls instead of triple product*/
    HYPRE_Int rap2;
    HYPRE_Int keepTranspose;
    HYPRE_Int modularized_matmat;
 
+   /* 16-bit column indices for the diag blocks of A_array */
+   HYPRE_Int compress_indices;
+
+   /* persistent halo-exchange handles for A_array, P_array and R_array */
+   HYPRE_Int persistent_comm;
+
+   /* merged diag/offd copies of A_array for the solve phase */
+   HYPRE_Int merged_layout;
+
+   /* per-phase setup times (coarsening, interpolation, RAP, coarse solve) */
+   HYPRE_Int  setup_timings;
+   HYPRE_Real setup_time[4];
+
+   /* memory budget (MB per process) for A_array and P_array, and the
+    * adaptation applied when building each level to stay within it */
+   HYPRE_Real  memory_budget;
+   HYPRE_Int  *memory_adapt;
+
    /* information for preserving indices as coarse grid points */
    HYPRE_Int      num_C_points;
    HYPRE_Int      C_points_coarse_level;
@@ -303,6 +336,7 @@ typedef struct
 #define hypre_ParAMGDataGMRESSwitchR(amg_data)         ((amg_data) -> gmres_switch)
 #define hypre_ParAMGDataMaxLevels(amg_data)            ((amg_data) -> max_levels)
 #define hypre_ParAMGDataCoarsenCutFactor(amg_data)     ((amg_data) -> coarsen_cut_factor)
+#define hypre_ParAMGDataCoarsenThreadBlocks(amg_data)  ((amg_data) -> coarsen_thread_blocks)
 #define hypre_ParAMGDataStrongThreshold(amg_data)      ((amg_data) -> strong_threshold)
 #define hypre_ParAMGDataStrongThresholdR(amg_data)     ((amg_data) -> strong_thresholdR)
 #define hypre_ParAMGDataFilterThresholdR(amg_data)     ((amg_data) -> filter_thresholdR)
@@ -324,6 +358,7 @@ typedef struct
 #define hypre_ParAMGDataAggP12MaxElmts(amg_data)       ((amg_data) -> agg_P12_max_elmts)
 #define hypre_ParAMGDataNumPaths(amg_data)             ((amg_data) -> num_paths)
 #define hypre_ParAMGDataAggNumLevels(amg_data)         ((amg_data) -> agg_num_levels)
+#define hypre_ParAMGDataSmoothAggNumLevels(amg_data)   ((amg_data) -> sa_num_levels)
 #define hypre_ParAMGDataPostInterpType(amg_data)       ((amg_data) -> post_interp_type)
 #define hypre_ParAMGDataNumCRRelaxSteps(amg_data)      ((amg_data) -> num_CR_relax_steps)
 #define hypre_ParAMGDataCRRate(amg_data)               ((amg_data) -> CR_rate)
@@ -343,6 +378,9 @@ typedef struct
 #define hypre_ParAMGDataMinIter(amg_data) ((amg_data)->min_iter)
 #define hypre_ParAMGDataMaxIter(amg_data) ((amg_data)->max_iter)
 #define hypre_ParAMGDataFCycle(amg_data) ((amg_data)->fcycle)
+#define hypre_ParAMGDataKCycle(amg_data) ((amg_data)->kcycle)
+#define hypre_ParAMGDataKCycleNumIter(amg_data) ((amg_data)->kcycle_num_iter)
+#define hypre_ParAMGDataKCycleSolvers(amg_data) ((amg_data)->kcycle_solvers)
 #define hypre_ParAMGDataCycleType(amg_data) ((amg_data)->cycle_type)
 #define hypre_ParAMGDataConvergeType(amg_data) ((amg_data)->converge_type)
 #define hypre_ParAMGDataTol(amg_data) ((amg_data)->tol)
@@ -430,6 +468,8 @@ typedef struct
 #define hypre_ParAMGDataChebyScale(amg_data) ((amg_data)->cheby_scale)
 #define hypre_ParAMGDataChebyDS(amg_data) ((amg_data)->cheby_ds)
 #define hypre_ParAMGDataChebyCoefs(amg_data) ((amg_data)->cheby_coefs)
+#define hypre_ParAMGDataChebyMatPowers(amg_data) ((amg_data)->cheby_mat_powers)
+#define hypre_ParAMGDataChebyPowers(amg_data) ((amg_data)->cheby_powers)
 
 #define hypre_ParAMGDataCumNnzAP(amg_data)   ((amg_data)->cum_nnz_AP)
 
@@ -517,15 +557,28 @@ typedef struct
 #define hypre_ParAMGDataRtilde(amg_data) ((amg_data)->Rtilde)
 #define hypre_ParAMGDataXtilde(amg_data) ((amg_data)->Xtilde)
 #define hypre_ParAMGDataDinv(amg_data) ((amg_data)->D_inv)
+#define hypre_ParAMGDataAddComposite(amg_data) ((amg_data)->add_composite)
+#define hypre_ParAMGDataAddCompLastLvl(amg_data) ((amg_data)->add_comp_last_lvl)
+#define hypre_ParAMGDataRhat(amg_data) ((amg_data)->Rhat)
+#define hypre_ParAMGDataRhatR(amg_data) ((amg_data)->Rhat_r)
+#define hypre_ParAMGDataRhatX(amg_data) ((amg_data)->Rhat_x)
 
 /* non-Galerkin parameters */
 #define hypre_ParAMGDataNonGalerkNumTol(amg_data) ((amg_data)->nongalerk_num_tol)
 #define hypre_ParAMGDataNonGalerkTol(amg_data) ((amg_data)->nongalerk_tol)
 #define hypre_ParAMGDataNonGalerkinTol(amg_data) ((amg_data)->nongalerkin_tol)
 #define hypre_ParAMGDataNonGalTolArray(amg_data) ((amg_data)->nongal_tol_array)
+#define hypre_ParAMGDataNonGalerkinRAP(amg_data) ((amg_data)->nongalerkin_rap)
 
 #define hypre_ParAMGDataRAP2(amg_data) ((amg_data)->rap2)
 #define hypre_ParAMGDataKeepTranspose(amg_data) ((amg_data)->keepTranspose)
+#define hypre_ParAMGDataCompressIndices(amg_data) ((amg_data)->compress_indices)
+#define hypre_ParAMGDataPersistentComm(amg_data) ((amg_data)->persistent_comm)
+#define hypre_ParAMGDataMergedLayout(amg_data) ((amg_data)->merged_layout)
+#define hypre_ParAMGDataSetupTimings(amg_data) ((amg_data)->setup_timings)
+#define hypre_ParAMGDataSetupTime(amg_data, i) ((amg_data)->setup_time[i])
+#define hypre_ParAMGDataMemoryBudget(amg_data) ((amg_data)->memory_budget)
+#define hypre_ParAMGDataMemoryAdapt(amg_data) ((amg_data)->memory_adapt)
 #define hypre_ParAMGDataModularizedMatMat(amg_data) ((amg_data)->modularized_matmat)
 
 /*indices for the dof which will keep coarsening to the coarse level */
@@ -1241,6 +1294,10 @@ HYPRE_Int hypre_ParCSRMatrixFixZeroRows ( hypre_ParCSRMatrix *A );
 HYPRE_Int hypre_ParCSRComputeL1Norms ( hypre_ParCSRMatrix *A, HYPRE_Int option,
                                        HYPRE_Int *cf_marker, HYPRE_Real **l1_norm_ptr );
 HYPRE_Int hypre_ParCSRMatrixSetDiagRows ( hypre_ParCSRMatrix *A, HYPRE_Real d );
+HYPRE_Int hypre_ParCSRMatrixBlockColSplit ( hypre_ParCSRMatrix *A, hypre_ParCSRMatrix *A_ [3 ],
+                                            HYPRE_Int dim );
+HYPRE_Int hypre_ParCSRComponentRAP ( hypre_ParCSRMatrix *A, hypre_ParCSRMatrix *Pi, HYPRE_Int dim,
+                                     hypre_ParCSRMatrix *Pi_ [3 ], hypre_ParCSRMatrix *A_ [3 ] );
 void *hypre_AMSCreate ( void );
 HYPRE_Int hypre_AMSDestroy ( void *solver );
 HYPRE_Int hypre_AMSSetDimension ( void *solver, HYPRE_Int dim );
@@ -1464,6 +1521,9 @@ HYPRE_Int HYPRE_BoomerAMGSolve ( HYPRE_Solver solver, HYPRE_ParCSRMatrix A, HYPR
                                  HYPRE_ParVector x );
 HYPRE_Int HYPRE_BoomerAMGSolveT ( HYPRE_Solver solver, HYPRE_ParCSRMatrix A, HYPRE_ParVector b,
                                   HYPRE_ParVector x );
+HYPRE_Int HYPRE_BoomerAMGTune ( HYPRE_Solver solver, HYPRE_ParCSRMatrix A, HYPRE_Real time_budget,
+                                HYPRE_Int num_solves, const char *filename );
+HYPRE_Int HYPRE_BoomerAMGReadTunedParams ( HYPRE_Solver solver, const char *filename );
 HYPRE_Int HYPRE_BoomerAMGSetRestriction ( HYPRE_Solver solver, HYPRE_Int restr_par );
 HYPRE_Int HYPRE_BoomerAMGSetIsTriangular ( HYPRE_Solver solver, HYPRE_Int is_triangular );
 HYPRE_Int HYPRE_BoomerAMGSetGMRESSwitchR ( HYPRE_Solver solver, HYPRE_Int gmres_switch );
@@ -1479,6 +1539,10 @@ HYPRE_Int HYPRE_BoomerAMGSetRedundant ( HYPRE_Solver solver, HYPRE_Int redundant
 HYPRE_Int HYPRE_BoomerAMGGetRedundant ( HYPRE_Solver solver, HYPRE_Int *redundant );
 HYPRE_Int HYPRE_BoomerAMGSetCoarsenCutFactor( HYPRE_Solver solver, HYPRE_Int coarsen_cut_factor );
 HYPRE_Int HYPRE_BoomerAMGGetCoarsenCutFactor( HYPRE_Solver solver, HYPRE_Int *coarsen_cut_factor );
+HYPRE_Int HYPRE_BoomerAMGSetCoarsenThreadBlocks( HYPRE_Solver solver,
+                                                 HYPRE_Int coarsen_thread_blocks );
+HYPRE_Int HYPRE_BoomerAMGGetCoarsenThreadBlocks( HYPRE_Solver solver,
+                                                 HYPRE_Int *coarsen_thread_blocks );
 HYPRE_Int HYPRE_BoomerAMGSetStrongThreshold ( HYPRE_Solver solver, HYPRE_Real strong_threshold );
 HYPRE_Int HYPRE_BoomerAMGGetStrongThreshold ( HYPRE_Solver solver, HYPRE_Real *strong_threshold );
 HYPRE_Int HYPRE_BoomerAMGSetStrongThresholdR ( HYPRE_Solver solver, HYPRE_Real strong_threshold );
@@ -1513,6 +1577,10 @@ HYPRE_Int HYPRE_BoomerAMGSetSetupType ( HYPRE_Solver solver, HYPRE_Int setup_typ
 HYPRE_Int HYPRE_BoomerAMGSetOldDefault ( HYPRE_Solver solver );
 HYPRE_Int HYPRE_BoomerAMGSetFCycle ( HYPRE_Solver solver, HYPRE_Int fcycle );
 HYPRE_Int HYPRE_BoomerAMGGetFCycle ( HYPRE_Solver solver, HYPRE_Int *fcycle );
+HYPRE_Int HYPRE_BoomerAMGSetKCycle ( HYPRE_Solver solver, HYPRE_Int kcycle );
+HYPRE_Int HYPRE_BoomerAMGGetKCycle ( HYPRE_Solver solver, HYPRE_Int *kcycle );
+HYPRE_Int HYPRE_BoomerAMGSetKCycleNumIter ( HYPRE_Solver solver, HYPRE_Int num_iter );
+HYPRE_Int HYPRE_BoomerAMGGetKCycleNumIter ( HYPRE_Solver solver, HYPRE_Int *num_iter );
 HYPRE_Int HYPRE_BoomerAMGSetCycleType ( HYPRE_Solver solver, HYPRE_Int cycle_type );
 HYPRE_Int HYPRE_BoomerAMGGetCycleType ( HYPRE_Solver solver, HYPRE_Int *cycle_type );
 HYPRE_Int HYPRE_BoomerAMGSetConvergeType ( HYPRE_Solver solver, HYPRE_Int type );
@@ -1606,6 +1674,7 @@ HYPRE_Int HYPRE_BoomerAMGSetKeepSameSign ( HYPRE_Solver solver, HYPRE_Int keep_s
 HYPRE_Int HYPRE_BoomerAMGSetDofFunc ( HYPRE_Solver solver, HYPRE_Int *dof_func );
 HYPRE_Int HYPRE_BoomerAMGSetNumPaths ( HYPRE_Solver solver, HYPRE_Int num_paths );
 HYPRE_Int HYPRE_BoomerAMGSetAggNumLevels ( HYPRE_Solver solver, HYPRE_Int agg_num_levels );
+HYPRE_Int HYPRE_BoomerAMGSetSmoothAggNumLevels ( HYPRE_Solver solver, HYPRE_Int sa_num_levels );
 HYPRE_Int HYPRE_BoomerAMGSetAggInterpType ( HYPRE_Solver solver, HYPRE_Int agg_interp_type );
 HYPRE_Int HYPRE_BoomerAMGSetAggTruncFactor ( HYPRE_Solver solver, HYPRE_Real agg_trunc_factor );
 HYPRE_Int HYPRE_BoomerAMGSetAddTruncFactor ( HYPRE_Solver solver, HYPRE_Real add_trunc_factor );
@@ -1638,6 +1707,7 @@ HYPRE_Int HYPRE_BoomerAMGSetChebyFraction ( HYPRE_Solver solver, HYPRE_Real rati
 HYPRE_Int HYPRE_BoomerAMGSetChebyEigEst ( HYPRE_Solver solver, HYPRE_Int eig_est );
 HYPRE_Int HYPRE_BoomerAMGSetChebyVariant ( HYPRE_Solver solver, HYPRE_Int variant );
 HYPRE_Int HYPRE_BoomerAMGSetChebyScale ( HYPRE_Solver solver, HYPRE_Int scale );
+HYPRE_Int HYPRE_BoomerAMGSetChebyMatPowers ( HYPRE_Solver solver, HYPRE_Int mat_powers );
 HYPRE_Int HYPRE_BoomerAMGSetInterpVectors ( HYPRE_Solver solver, HYPRE_Int num_vectors,
                                             HYPRE_ParVector *vectors );
 HYPRE_Int HYPRE_BoomerAMGSetInterpVecVariant ( HYPRE_Solver solver, HYPRE_Int num );
@@ -1654,14 +1724,21 @@ HYPRE_Int HYPRE_BoomerAMGGetMultAdditive ( HYPRE_Solver solver, HYPRE_Int *mult_
 HYPRE_Int HYPRE_BoomerAMGSetSimple ( HYPRE_Solver solver, HYPRE_Int simple );
 HYPRE_Int HYPRE_BoomerAMGGetSimple ( HYPRE_Solver solver, HYPRE_Int *simple );
 HYPRE_Int HYPRE_BoomerAMGSetAddLastLvl ( HYPRE_Solver solver, HYPRE_Int add_last_lvl );
+HYPRE_Int HYPRE_BoomerAMGSetAddComposite ( HYPRE_Solver solver, HYPRE_Int add_composite );
 HYPRE_Int HYPRE_BoomerAMGSetNonGalerkinTol ( HYPRE_Solver solver, HYPRE_Real nongalerkin_tol );
 HYPRE_Int HYPRE_BoomerAMGSetLevelNonGalerkinTol ( HYPRE_Solver solver, HYPRE_Real nongalerkin_tol,
                                                   HYPRE_Int level );
 HYPRE_Int HYPRE_BoomerAMGSetNonGalerkTol ( HYPRE_Solver solver, HYPRE_Int nongalerk_num_tol,
                                            HYPRE_Real *nongalerk_tol );
+HYPRE_Int HYPRE_BoomerAMGSetNonGalerkinRAP ( HYPRE_Solver solver, HYPRE_Int nongalerkin_rap );
 HYPRE_Int HYPRE_BoomerAMGSetRAP2 ( HYPRE_Solver solver, HYPRE_Int rap2 );
 HYPRE_Int HYPRE_BoomerAMGSetModuleRAP2 ( HYPRE_Solver solver, HYPRE_Int mod_rap2 );
 HYPRE_Int HYPRE_BoomerAMGSetKeepTranspose ( HYPRE_Solver solver, HYPRE_Int keepTranspose );
+HYPRE_Int HYPRE_BoomerAMGSetCompressIndices ( HYPRE_Solver solver, HYPRE_Int compress_indices );
+HYPRE_Int HYPRE_BoomerAMGSetPersistentComm ( HYPRE_Solver solver, HYPRE_Int persistent_comm );
+HYPRE_Int HYPRE_BoomerAMGSetMergedLayout ( HYPRE_Solver solver, HYPRE_Int merged_layout );
+HYPRE_Int HYPRE_BoomerAMGSetSetupTimings ( HYPRE_Solver solver, HYPRE_Int setup_timings );
+HYPRE_Int HYPRE_BoomerAMGSetMemoryBudget ( HYPRE_Solver solver, HYPRE_Real memory_budget );
 #ifdef HYPRE_USING_DSUPERLU
 HYPRE_Int HYPRE_BoomerAMGSetDSLUThreshold ( HYPRE_Solver solver, HYPRE_Int slu_threshold );
 #endif
@@ -1919,6 +1996,15 @@ HYPRE_Int HYPRE_ParCSRMultiVectorPrint ( void *x_, const char *fileName );
 void *HYPRE_ParCSRMultiVectorRead ( MPI_Comm comm, void *ii_, const char *fileName );
 HYPRE_Int aux_maskCount ( HYPRE_Int n, HYPRE_Int *mask );
 void aux_indexFromMask ( HYPRE_Int n, HYPRE_Int *mask, HYPRE_Int *index );
+void hypre_ParCSRMultiVectorByMultiVector ( void *x_, void *y_, HYPRE_Int xyGHeight,
+                                            HYPRE_Int xyHeight, HYPRE_Int xyWidth,
+                                            HYPRE_Complex *xyVal );
+void hypre_ParCSRMultiVectorByMultiVectorDiag ( void *x_, void *y_, HYPRE_Int *mask, HYPRE_Int n,
+                                                HYPRE_Complex *diag );
+void hypre_ParCSRMultiVectorByMatrix ( void *x_, HYPRE_Int rGHeight, HYPRE_Int rHeight,
+                                       HYPRE_Int rWidth, HYPRE_Complex *rVal, void *y_ );
+void hypre_ParCSRMultiVectorXapy ( void *x_, HYPRE_Int rGHeight, HYPRE_Int rHeight,
+                                   HYPRE_Int rWidth, HYPRE_Complex *rVal, void *y_ );
 HYPRE_Int HYPRE_TempParCSRSetupInterpreter ( mv_InterfaceInterpreter *i );
 HYPRE_Int HYPRE_ParCSRSetupInterpreter ( mv_InterfaceInterpreter *i );
 HYPRE_Int HYPRE_ParCSRSetupMatvec ( HYPRE_MatvecFunctions *mv );
@@ -2073,6 +2159,7 @@ HYPRE_Int HYPRE_SchwarzSetDofFunc ( HYPRE_Solver solver, HYPRE_Int *dof_func );
 HYPRE_Int hypre_BoomerAMGAdditiveCycle ( void *amg_vdata );
 HYPRE_Int hypre_CreateLambda ( void *amg_vdata );
 HYPRE_Int hypre_CreateDinv ( void *amg_vdata );
+HYPRE_Int hypre_CreateAddComposite ( void *amg_vdata );
 
 /* par_amg.c */
 void *hypre_BoomerAMGCreate ( void );
@@ -2090,6 +2177,8 @@ HYPRE_Int hypre_BoomerAMGSetSeqThreshold ( void *data, HYPRE_Int seq_threshold )
 HYPRE_Int hypre_BoomerAMGGetSeqThreshold ( void *data, HYPRE_Int *seq_threshold );
 HYPRE_Int hypre_BoomerAMGSetCoarsenCutFactor( void *data, HYPRE_Int coarsen_cut_factor );
 HYPRE_Int hypre_BoomerAMGGetCoarsenCutFactor( void *data, HYPRE_Int *coarsen_cut_factor );
+HYPRE_Int hypre_BoomerAMGSetCoarsenThreadBlocks( void *data, HYPRE_Int coarsen_thread_blocks );
+HYPRE_Int hypre_BoomerAMGGetCoarsenThreadBlocks( void *data, HYPRE_Int *coarsen_thread_blocks );
 HYPRE_Int hypre_BoomerAMGSetRedundant ( void *data, HYPRE_Int redundant );
 HYPRE_Int hypre_BoomerAMGGetRedundant ( void *data, HYPRE_Int *redundant );
 HYPRE_Int hypre_BoomerAMGSetStrongThreshold ( void *data, HYPRE_Real strong_threshold );
@@ -2124,6 +2213,10 @@ HYPRE_Int hypre_BoomerAMGSetSetupType ( void *data, HYPRE_Int setup_type );
 HYPRE_Int hypre_BoomerAMGGetSetupType ( void *data, HYPRE_Int *setup_type );
 HYPRE_Int hypre_BoomerAMGSetFCycle ( void *data, HYPRE_Int fcycle );
 HYPRE_Int hypre_BoomerAMGGetFCycle ( void *data, HYPRE_Int *fcycle );
+HYPRE_Int hypre_BoomerAMGSetKCycle ( void *data, HYPRE_Int kcycle );
+HYPRE_Int hypre_BoomerAMGGetKCycle ( void *data, HYPRE_Int *kcycle );
+HYPRE_Int hypre_BoomerAMGSetKCycleNumIter ( void *data, HYPRE_Int num_iter );
+HYPRE_Int hypre_BoomerAMGGetKCycleNumIter ( void *data, HYPRE_Int *num_iter );
 HYPRE_Int hypre_BoomerAMGSetCycleType ( void *data, HYPRE_Int cycle_type );
 HYPRE_Int hypre_BoomerAMGGetCycleType ( void *data, HYPRE_Int *cycle_type );
 HYPRE_Int hypre_BoomerAMGSetConvergeType ( void *data, HYPRE_Int type );
@@ -2185,6 +2278,7 @@ HYPRE_Int hypre_BoomerAMGSetNodalDiag ( void *data, HYPRE_Int nodal );
 HYPRE_Int hypre_BoomerAMGSetKeepSameSign ( void *data, HYPRE_Int keep_same_sign );
 HYPRE_Int hypre_BoomerAMGSetNumPaths ( void *data, HYPRE_Int num_paths );
 HYPRE_Int hypre_BoomerAMGSetAggNumLevels ( void *data, HYPRE_Int agg_num_levels );
+HYPRE_Int hypre_BoomerAMGSetSmoothAggNumLevels ( void *data, HYPRE_Int sa_num_levels );
 HYPRE_Int hypre_BoomerAMGSetAggInterpType ( void *data, HYPRE_Int agg_interp_type );
 HYPRE_Int hypre_BoomerAMGSetAggPMaxElmts ( void *data, HYPRE_Int agg_P_max_elmts );
 HYPRE_Int hypre_BoomerAMGSetMultAddPMaxElmts ( void *data, HYPRE_Int add_P_max_elmts );
@@ -2246,6 +2340,7 @@ HYPRE_Int hypre_BoomerAMGSetChebyFraction ( void *data, HYPRE_Real ratio );
 HYPRE_Int hypre_BoomerAMGSetChebyEigEst ( void *data, HYPRE_Int eig_est );
 HYPRE_Int hypre_BoomerAMGSetChebyVariant ( void *data, HYPRE_Int variant );
 HYPRE_Int hypre_BoomerAMGSetChebyScale ( void *data, HYPRE_Int scale );
+HYPRE_Int hypre_BoomerAMGSetChebyMatPowers ( void *data, HYPRE_Int mat_powers );
 HYPRE_Int hypre_BoomerAMGSetInterpVectors ( void *solver, HYPRE_Int num_vectors,
                                             hypre_ParVector **interp_vectors );
 HYPRE_Int hypre_BoomerAMGSetInterpVecVariant ( void *solver, HYPRE_Int var );
@@ -2261,14 +2356,22 @@ HYPRE_Int hypre_BoomerAMGGetMultAdditive ( void *data, HYPRE_Int *mult_additive
 HYPRE_Int hypre_BoomerAMGSetSimple ( void *data, HYPRE_Int simple );
 HYPRE_Int hypre_BoomerAMGGetSimple ( void *data, HYPRE_Int *simple );
 HYPRE_Int hypre_BoomerAMGSetAddLastLvl ( void *data, HYPRE_Int add_last_lvl );
+HYPRE_Int hypre_BoomerAMGSetAddComposite ( void *data, HYPRE_Int add_composite );
+HYPRE_Int hypre_BoomerAMGGetAddComposite ( void *data, HYPRE_Int *add_composite );
 HYPRE_Int hypre_BoomerAMGSetNonGalerkinTol ( void *data, HYPRE_Real nongalerkin_tol );
 HYPRE_Int hypre_BoomerAMGSetLevelNonGalerkinTol ( void *data, HYPRE_Real nongalerkin_tol,
                                                   HYPRE_Int level );
 HYPRE_Int hypre_BoomerAMGSetNonGalerkTol ( void *data, HYPRE_Int nongalerk_num_tol,
                                            HYPRE_Real *nongalerk_tol );
+HYPRE_Int hypre_BoomerAMGSetNonGalerkinRAP ( void *data, HYPRE_Int nongalerkin_rap );
 HYPRE_Int hypre_BoomerAMGSetRAP2 ( void *data, HYPRE_Int rap2 );
 HYPRE_Int hypre_BoomerAMGSetModuleRAP2 ( void *data, HYPRE_Int mod_rap2 );
 HYPRE_Int hypre_BoomerAMGSetKeepTranspose ( void *data, HYPRE_Int keepTranspose );
+HYPRE_Int hypre_BoomerAMGSetCompressIndices ( void *data, HYPRE_Int compress_indices );
+HYPRE_Int hypre_BoomerAMGSetPersistentComm ( void *data, HYPRE_Int persistent_comm );
+HYPRE_Int hypre_BoomerAMGSetMergedLayout ( void *data, HYPRE_Int merged_layout );
+HYPRE_Int hypre_BoomerAMGSetSetupTimings ( void *data, HYPRE_Int setup_timings );
+HYPRE_Int hypre_BoomerAMGSetMemoryBudget ( void *data, HYPRE_Real memory_budget );
 #ifdef HYPRE_USING_DSUPERLU
 HYPRE_Int hypre_BoomerAMGSetDSLUThreshold ( void *data, HYPRE_Int slu_threshold );
 #endif
@@ -2296,6 +2399,11 @@ HYPRE_Int hypre_BoomerAMGRelaxT ( hypre_ParCSRMatrix *A, hypre_ParVector *f, HYP
                                   HYPRE_Int relax_type, HYPRE_Int relax_points, HYPRE_Real relax_weight, hypre_ParVector *u,
                                   hypre_ParVector *Vtemp );
 
+/* par_amg_tune.c */
+HYPRE_Int hypre_BoomerAMGTune ( void *amg_vdata, hypre_ParCSRMatrix *A, HYPRE_Real time_budget,
+                                HYPRE_Int num_solves, const char *filename );
+HYPRE_Int hypre_BoomerAMGReadTunedParams ( void *amg_vdata, const char *filename );
+
 /* par_cgc_coarsen.c */
 HYPRE_Int hypre_BoomerAMGCoarsenCGCb ( hypre_ParCSRMatrix *S, hypre_ParCSRMatrix *A,
                                        HYPRE_Int measure_type, HYPRE_Int coarsen_type, HYPRE_Int cgc_its, HYPRE_Int debug_flag,
@@ -2331,6 +2439,9 @@ HYPRE_Int hypre_ParCSRRelax_Cheby_SolveHost ( hypre_ParCSRMatrix *A, hypre_ParVe
                                               HYPRE_Real *ds_data, HYPRE_Real *coefs, HYPRE_Int order, HYPRE_Int scale, HYPRE_Int variant,
                                               hypre_ParVector *u, hypre_ParVector *v, hypre_ParVector *r, hypre_ParVector *orig_u_vec,
                                               hypre_ParVector *tmp_vec);
+HYPRE_Int hypre_ParCSRRelax_Cheby_SolvePowers ( hypre_ParCSRMatrix *A, hypre_ParVector *f,
+                                                HYPRE_Real *ds_data, HYPRE_Real *coefs, HYPRE_Int order, HYPRE_Int scale,
+                                                hypre_ParCSRMatPowers *mp, hypre_ParVector *u, hypre_ParVector *v, hypre_ParVector *r );
 
 /* par_cheby_device.c */
 HYPRE_Int hypre_ParCSRRelax_Cheby_SolveDevice ( hypre_ParCSRMatrix *A, hypre_ParVector *f,
@@ -2342,14 +2453,14 @@ HYPRE_Int hypre_ParCSRRelax_Cheby_SolveDevice ( hypre_ParCSRMatrix *A, hypre_Par
 HYPRE_Int hypre_BoomerAMGCoarsen ( hypre_ParCSRMatrix *S, hypre_ParCSRMatrix *A, HYPRE_Int CF_init,
                                    HYPRE_Int debug_flag, hypre_IntArray **CF_marker_ptr );
 HYPRE_Int hypre_BoomerAMGCoarsenRuge ( hypre_ParCSRMatrix *S, hypre_ParCSRMatrix *A,
-                                       HYPRE_Int measure_type, HYPRE_Int coarsen_type, HYPRE_Int cut_factor, HYPRE_Int debug_flag,
-                                       hypre_IntArray **CF_marker_ptr );
+                                       HYPRE_Int measure_type, HYPRE_Int coarsen_type, HYPRE_Int cut_factor, HYPRE_Int thread_blocks,
+                                       HYPRE_Int debug_flag, hypre_IntArray **CF_marker_ptr );
 HYPRE_Int hypre_BoomerAMGCoarsenFalgout ( hypre_ParCSRMatrix *S, hypre_ParCSRMatrix *A,
-                                          HYPRE_Int measure_type, HYPRE_Int cut_factor, HYPRE_Int debug_flag,
-                                          hypre_IntArray **CF_marker_ptr );
+                                          HYPRE_Int measure_type, HYPRE_Int cut_factor, HYPRE_Int thread_blocks,
+                                          HYPRE_Int debug_flag, hypre_IntArray **CF_marker_ptr );
 HYPRE_Int hypre_BoomerAMGCoarsenHMIS ( hypre_ParCSRMatrix *S, hypre_ParCSRMatrix *A,
-                                       HYPRE_Int measure_type, HYPRE_Int cut_factor, HYPRE_Int debug_flag,
-                                       hypre_IntArray **CF_marker_ptr );
+                                       HYPRE_Int measure_type, HYPRE_Int cut_factor, HYPRE_Int thread_blocks,
+                                       HYPRE_Int debug_flag, hypre_IntArray **CF_marker_ptr );
 HYPRE_Int hypre_BoomerAMGCoarsenPMIS ( hypre_ParCSRMatrix *S, hypre_ParCSRMatrix *A,
                                        HYPRE_Int CF_init, HYPRE_Int debug_flag, hypre_IntArray **CF_marker_ptr );
 HYPRE_Int hypre_BoomerAMGCoarsenPMISHost ( hypre_ParCSRMatrix *S, hypre_ParCSRMatrix *A,
@@ -2418,6 +2529,8 @@ HYPRE_Int hypre_BoomerAMGCoarsenCR ( hypre_ParCSRMatrix *A, hypre_IntArray **CF_
 /* par_cycle.c */
 HYPRE_Int hypre_BoomerAMGCycle ( void *amg_vdata, hypre_ParVector **F_array,
                                  hypre_ParVector **U_array );
+HYPRE_Int hypre_BoomerAMGKCycleSetup ( void *amg_vdata );
+HYPRE_Int hypre_BoomerAMGKCycleDestroy ( void *amg_vdata, HYPRE_Int num_levels );
 
 /* par_difconv.c */
 HYPRE_ParCSRMatrix GenerateDifConv ( MPI_Comm comm, HYPRE_BigInt nx, HYPRE_BigInt ny,
@@ -2480,6 +2593,10 @@ HYPRE_Int hypre_BoomerAMGInterpTruncation ( hypre_ParCSRMatrix *P, HYPRE_Real tr
                                             HYPRE_Int max_elmts );
 HYPRE_Int hypre_BoomerAMGInterpTruncationDevice( hypre_ParCSRMatrix *P, HYPRE_Real trunc_factor,
                                                  HYPRE_Int max_elmts );
+HYPRE_Int hypre_BoomerAMGInterpTruncateRow ( HYPRE_Real trunc_factor, HYPRE_Int max_elmts,
+                                            HYPRE_Int num_cols_diag, HYPRE_Int *diag_j, HYPRE_Real *diag_data, HYPRE_Int *diag_size,
+                                            HYPRE_Int *offd_j, HYPRE_Real *offd_data, HYPRE_Int *offd_size, HYPRE_Int *aux_j,
+                                            HYPRE_Real *aux_data );
 
 HYPRE_Int hypre_BoomerAMGBuildInterpModUnk ( hypre_ParCSRMatrix *A, HYPRE_Int *CF_marker,
                                              hypre_ParCSRMatrix *S, HYPRE_BigInt *num_cpts_global, HYPRE_Int num_functions, HYPRE_Int *dof_func,
@@ -2700,6 +2817,9 @@ HYPRE_Int hypre_NonGalerkinIJBufferEmpty ( HYPRE_IJMatrix B, HYPRE_Int ijbuf_siz
 hypre_ParCSRMatrix * hypre_NonGalerkinSparsityPattern(hypre_ParCSRMatrix *R_IAP,
                                                       hypre_ParCSRMatrix *RAP, HYPRE_Int * CF_marker, HYPRE_Real droptol, HYPRE_Int sym_collapse,
                                                       HYPRE_Int collapse_beta );
+HYPRE_Int hypre_NonGalerkinDropRow ( HYPRE_Real droptol, HYPRE_Int row_marker,
+                                     HYPRE_Int *keep_marker, HYPRE_Int num_cols_diag, HYPRE_Int *diag_j, HYPRE_Real *diag_data,
+                                     HYPRE_Int *diag_size_ptr, HYPRE_Int *offd_j, HYPRE_Real *offd_data, HYPRE_Int *offd_size_ptr );
 HYPRE_Int hypre_BoomerAMGBuildNonGalerkinCoarseOperator( hypre_ParCSRMatrix **RAP_ptr,
                                                          hypre_ParCSRMatrix *AP, HYPRE_Real strong_threshold, HYPRE_Real max_row_sum,
                                                          HYPRE_Int num_functions, HYPRE_Int * dof_func_value, HYPRE_Int * CF_marker, HYPRE_Real droptol,
@@ -2710,6 +2830,9 @@ HYPRE_Int hypre_BoomerAMGBuildCoarseOperator ( hypre_ParCSRMatrix *RT, hypre_Par
                                                hypre_ParCSRMatrix *P, hypre_ParCSRMatrix **RAP_ptr );
 HYPRE_Int hypre_BoomerAMGBuildCoarseOperatorKT ( hypre_ParCSRMatrix *RT, hypre_ParCSRMatrix *A,
                                                  hypre_ParCSRMatrix *P, HYPRE_Int keepTranspose, hypre_ParCSRMatrix **RAP_ptr );
+HYPRE_Int hypre_BoomerAMGBuildCoarseOperatorDropKT ( hypre_ParCSRMatrix *RT, hypre_ParCSRMatrix *A,
+                                                     hypre_ParCSRMatrix *P, HYPRE_Int keepTranspose, HYPRE_Int *CF_marker, HYPRE_Real droptol,
+                                                     hypre_ParCSRMatrix **RAP_ptr );
 
 /* par_rap_communication.c */
 HYPRE_Int hypre_GetCommPkgRTFromCommPkgA ( hypre_ParCSRMatrix *RT, hypre_ParCSRMatrix *A,
@@ -2883,9 +3006,25 @@ HYPRE_Int hypre_SchwarzSetScale ( void *data, HYPRE_Real *scale );
 HYPRE_Int hypre_SchwarzReScale ( void *data, HYPRE_Int size, HYPRE_Real value );
 HYPRE_Int hypre_SchwarzSetDofFunc ( void *data, HYPRE_Int *dof_func );
 
+/* par_smooth_agg.c */
+HYPRE_Int hypre_BoomerAMGSmoothAggNullspace ( hypre_ParCSRMatrix *A, HYPRE_Int num_functions,
+                                              HYPRE_Int *dof_func, HYPRE_Int num_interp_vectors, hypre_ParVector **interp_vectors,
+                                              HYPRE_Int *num_vectors_ptr, HYPRE_Real **B_ptr );
+HYPRE_Int hypre_BoomerAMGCoarsenAggregates ( hypre_ParCSRMatrix *S, HYPRE_Int num_functions,
+                                             HYPRE_Int num_vectors, hypre_IntArray *CF_marker, hypre_IntArray **aggregates_ptr,
+                                             HYPRE_Int *num_aggregates_ptr );
+HYPRE_Int hypre_BoomerAMGSmoothAggCoarseParms ( MPI_Comm comm, HYPRE_Int num_aggregates,
+                                                HYPRE_Int num_vectors, hypre_IntArray **coarse_dof_func_ptr,
+                                                HYPRE_BigInt *coarse_pnts_global );
+HYPRE_Int hypre_BoomerAMGBuildSmoothAggInterp ( hypre_ParCSRMatrix *A, hypre_IntArray *aggregates,
+                                                HYPRE_Int num_functions, HYPRE_Int num_vectors, HYPRE_Real *B,
+                                                HYPRE_BigInt *coarse_pnts_global, HYPRE_Real trunc_factor, HYPRE_Int max_elmts,
+                                                HYPRE_Real **B_coarse_ptr, hypre_ParCSRMatrix **P_ptr );
+
 /* par_stats.c */
 HYPRE_Int hypre_BoomerAMGSetupStats ( void *amg_vdata, hypre_ParCSRMatrix *A );
 HYPRE_Int hypre_BoomerAMGWriteSolverParams ( void *data );
+HYPRE_Real hypre_BoomerAMGMatrixMemory ( hypre_ParCSRMatrix *A );
 
 /* par_strength.c */
 HYPRE_Int hypre_BoomerAMGCreateS ( hypre_ParCSRMatrix *A, HYPRE_Real strength_threshold,
@@ -3003,6 +3142,8 @@ HYPRE_Int hypre_ParKrylovMatvecT ( void *matvec_data, HYPRE_Complex alpha, void
                                    HYPRE_Complex beta, void *y );
 HYPRE_Int hypre_ParKrylovMatvecDestroy ( void *matvec_data );
 HYPRE_Real hypre_ParKrylovInnerProd ( void *x, void *y );
+HYPRE_Int hypre_ParKrylovResidualInnerProd ( void *matvec_data, void *A, void *x, void *b,
+                                            void *r, void *z, HYPRE_Real *rr, HYPRE_Real *rz );
 HYPRE_Int hypre_ParKrylovMassInnerProd ( void *x, void **y, HYPRE_Int k, HYPRE_Int unroll,
                                          void *result );
 HYPRE_Int hypre_ParKrylovMassDotpTwo ( void *x, void *y, void **z, HYPRE_Int k, HYPRE_Int unroll,
@@ -3013,6 +3154,9 @@ HYPRE_Int hypre_ParKrylovCopyVector ( void *x, void *y );
 HYPRE_Int hypre_ParKrylovClearVector ( void *x );
 HYPRE_Int hypre_ParKrylovScaleVector ( HYPRE_Complex alpha, void *x );
 HYPRE_Int hypre_ParKrylovAxpy ( HYPRE_Complex alpha, void *x, void *y );
+HYPRE_Int hypre_ParKrylovAxpby ( HYPRE_Complex alpha, void *x, HYPRE_Complex beta, void *y );
+HYPRE_Int hypre_ParKrylovUpdateSolutionResidual ( HYPRE_Complex alpha, void *p, void *s, void *x,
+                                                 void *r, HYPRE_Real *r_prod );
 HYPRE_Int hypre_ParKrylovCommInfo ( void *A, HYPRE_Int *my_id, HYPRE_Int *num_procs );
 HYPRE_Int hypre_ParKrylovIdentitySetup ( void *vdata, void *A, void *b, void *x );
 HYPRE_Int hypre_ParKrylovIdentity ( void *vdata, void *A, void *b, void *x );
@@ -645,18 +645,24 @@ HYPRE_Int hypre_ADSComputePi(hypre_ParCSRMatrix *A,
                Pi_diag_I[i] = 3 * F2V_diag_I[i];
             }
 
+#ifdef HYPRE_USING_OPENMP
+            #pragma omp parallel for private(i, d) HYPRE_SMP_SCHEDULE
+#endif
             for (i = 0; i < F2V_diag_nnz; i++)
                for (d = 0; d < 3; d++)
                {
                   Pi_diag_J[3 * i + d] = 3 * F2V_diag_J[i] + d;
                }
 
+#ifdef HYPRE_USING_OPENMP
+            #pragma omp parallel for private(i, j) HYPRE_SMP_SCHEDULE
+#endif
             for (i = 0; i < F2V_diag_nrows; i++)
                for (j = F2V_diag_I[i]; j < F2V_diag_I[i + 1]; j++)
                {
-                  *Pi_diag_data++ = RT100_data[i];
-                  *Pi_diag_data++ = RT010_data[i];
-                  *Pi_diag_data++ = RT001_data[i];
+                  Pi_diag_data[3 * j]     = RT100_data[i];
+                  Pi_diag_data[3 * j + 1] = RT010_data[i];
+                  Pi_diag_data[3 * j + 2] = RT001_data[i];
                }
          }
       }
@@ -708,18 +714,24 @@ HYPRE_Int hypre_ADSComputePi(hypre_ParCSRMatrix *A,
                   Pi_offd_I[i] = 3 * F2V_offd_I[i];
                }
 
+#ifdef HYPRE_USING_OPENMP
+            #pragma omp parallel for private(i, d) HYPRE_SMP_SCHEDULE
+#endif
             for (i = 0; i < F2V_offd_nnz; i++)
                for (d = 0; d < 3; d++)
                {
                   Pi_offd_J[3 * i + d] = 3 * F2V_offd_J[i] + d;
                }
 
+#ifdef HYPRE_USING_OPENMP
+            #pragma omp parallel for private(i, j) HYPRE_SMP_SCHEDULE
+#endif
             for (i = 0; i < F2V_offd_nrows; i++)
                for (j = F2V_offd_I[i]; j < F2V_offd_I[i + 1]; j++)
                {
-                  *Pi_offd_data++ = RT100_data[i];
-                  *Pi_offd_data++ = RT010_data[i];
-                  *Pi_offd_data++ = RT001_data[i];
+                  Pi_offd_data[3 * j]     = RT100_data[i];
+                  Pi_offd_data[3 * j + 1] = RT010_data[i];
+                  Pi_offd_data[3 * j + 2] = RT001_data[i];
                }
          }
 
@@ -1044,6 +1056,70 @@ HYPRE_Int hypre_ADSComputePixyz(hypre_ParCSRMatrix *A,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_ADSSetupReset
+ *
+ * Free the data of a previous hypre_ADSSetup() call that depends on the
+ * coefficients of A: the Galerkin products, their AMS/AMG solvers and the
+ * work vectors. The interpolations only depend on the mesh and are kept.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int hypre_ADSSetupReset(hypre_ADSData *ads_data)
+{
+   hypre_ParCSRMatrixDestroy(ads_data -> A_C);
+   ads_data -> A_C = NULL;
+   if (ads_data -> B_C)
+   {
+      HYPRE_AMSDestroy(ads_data -> B_C);
+      ads_data -> B_C = NULL;
+   }
+
+   hypre_ParCSRMatrixDestroy(ads_data -> A_Pi);
+   ads_data -> A_Pi = NULL;
+   if (ads_data -> B_Pi)
+   {
+      HYPRE_BoomerAMGDestroy(ads_data -> B_Pi);
+      ads_data -> B_Pi = NULL;
+   }
+
+   hypre_ParCSRMatrixDestroy(ads_data -> A_Pix);
+   hypre_ParCSRMatrixDestroy(ads_data -> A_Piy);
+   hypre_ParCSRMatrixDestroy(ads_data -> A_Piz);
+   ads_data -> A_Pix = ads_data -> A_Piy = ads_data -> A_Piz = NULL;
+   if (ads_data -> B_Pix)
+   {
+      HYPRE_BoomerAMGDestroy(ads_data -> B_Pix);
+      ads_data -> B_Pix = NULL;
+   }
+   if (ads_data -> B_Piy)
+   {
+      HYPRE_BoomerAMGDestroy(ads_data -> B_Piy);
+      ads_data -> B_Piy = NULL;
+   }
+   if (ads_data -> B_Piz)
+   {
+      HYPRE_BoomerAMGDestroy(ads_data -> B_Piz);
+      ads_data -> B_Piz = NULL;
+   }
+
+   hypre_ParVectorDestroy(ads_data -> r0);
+   hypre_ParVectorDestroy(ads_data -> g0);
+   hypre_ParVectorDestroy(ads_data -> r1);
+   hypre_ParVectorDestroy(ads_data -> g1);
+   hypre_ParVectorDestroy(ads_data -> r2);
+   hypre_ParVectorDestroy(ads_data -> g2);
+   hypre_ParVectorDestroy(ads_data -> zz);
+   ads_data -> r0 = ads_data -> g0 = NULL;
+   ads_data -> r1 = ads_data -> g1 = NULL;
+   ads_data -> r2 = ads_data -> g2 = NULL;
+   ads_data -> zz = NULL;
+
+   hypre_SeqVectorDestroy(ads_data -> A_l1_norms);
+   ads_data -> A_l1_norms = NULL;
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_ADSSetup
  *
@@ -1067,6 +1143,12 @@ HYPRE_Int hypre_ADSSetup(void *solver,
    hypre_ADSData *ads_data = (hypre_ADSData *) solver;
    hypre_AMSData *ams_data;
 
+   /* Repeated setup, e.g. with new coefficients in A */
+   if (ads_data -> r0)
+   {
+      hypre_ADSSetupReset(ads_data);
+   }
+
    ads_data -> A = A;
 
    /* Make sure that the first entry in each row is the diagonal one. */
@@ -1192,8 +1274,27 @@ HYPRE_Int hypre_ADSSetup(void *solver,
    if (ads_data -> Pi == NULL && ads_data -> Pix == NULL)
    {
       if (ads_data -> cycle_type > 10)
-         /* Construct Pi{x,y,z} instead of Pi = [Pix,Piy,Piz] */
-         hypre_ADSComputePixyz(ads_data -> A,
+      {
+#if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_HIP)
+         if (exec == HYPRE_EXEC_DEVICE)
+            /* Construct Pi{x,y,z} instead of Pi = [Pix,Piy,Piz] */
+            hypre_ADSComputePixyz(ads_data -> A,
+                                  ads_data -> C,
+                                  ads_data -> G,
+                                  ads_data -> x,
+                                  ads_data -> y,
+                                  ads_data -> z,
+                                  ams_data -> Pix,
+                                  ams_data -> Piy,
+                                  ams_data -> Piz,
+                                  &ads_data -> Pix,
+                                  &ads_data -> Piy,
+                                  &ads_data -> Piz);
+         else
+#endif
+            /* Construct Pi = [Pix,Piy,Piz]. Pi{x,y,z} are split off below,
+               together with their coarse space matrices. */
+            hypre_ADSComputePi(ads_data -> A,
                                ads_data -> C,
                                ads_data -> G,
                                ads_data -> x,
@@ -1202,9 +1303,8 @@ HYPRE_Int hypre_ADSSetup(void *solver,
                                ams_data -> Pix,
                                ams_data -> Piy,
                                ams_data -> Piz,
-                               &ads_data -> Pix,
-                               &ads_data -> Piy,
-                               &ads_data -> Piz);
+                               &ads_data -> Pi);
+      }
       else
          /* Construct the Pi interpolation matrix */
          hypre_ADSComputePi(ads_data -> A,
@@ -1266,76 +1366,115 @@ HYPRE_Int hypre_ADSSetup(void *solver,
       HYPRE_BoomerAMGSetCycleRelaxType(ads_data -> B_Piz,
                                        ads_data -> B_Pi_relax_type, 3);
 
-      /* Construct the coarse space matrices by RAP */
-      if (!hypre_ParCSRMatrixCommPkg(ads_data -> Pix))
+      /* Construct the coarse space matrices by RAP. On the host, all of them
+         are computed from the block Pi with a single product with A. The
+         block Pi is freed once it is split into Pi{x,y,z}, and a repeated
+         setup forms the same products per component. */
+      if (ads_data -> owns_Pi
+#if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_HIP)
+          && exec == HYPRE_EXEC_HOST
+#endif
+         )
       {
-         hypre_MatvecCommPkgCreate(ads_data -> Pix);
+         hypre_ParCSRMatrix *Pi_[3];
+         hypre_ParCSRMatrix *A_Pi_[3] = {NULL, NULL, NULL};
+
+         Pi_[0] = ads_data -> Pix;
+         Pi_[1] = ads_data -> Piy;
+         Pi_[2] = ads_data -> Piz;
+
+         hypre_ParCSRComponentRAP(ads_data -> A, ads_data -> Pi, 3, Pi_, A_Pi_);
+         if (ads_data -> Pi)
+         {
+            hypre_ParCSRMatrixDestroy(ads_data -> Pi);
+            ads_data -> Pi = NULL;
+            ads_data -> Pix = Pi_[0];
+            ads_data -> Piy = Pi_[1];
+            ads_data -> Piz = Pi_[2];
+         }
+         ads_data -> A_Pix = A_Pi_[0];
+         ads_data -> A_Piy = A_Pi_[1];
+         ads_data -> A_Piz = A_Pi_[2];
       }
 
-#if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_HIP)
-      if (exec == HYPRE_EXEC_DEVICE)
+      if (!ads_data -> A_Pix)
       {
-         ads_data -> A_Pix = hypre_ParCSRMatrixRAPKT(ads_data -> Pix,
-                                                     ads_data -> A,
-                                                     ads_data -> Pix, 1);
-      }
-      else
+         if (!hypre_ParCSRMatrixCommPkg(ads_data -> Pix))
+         {
+            hypre_MatvecCommPkgCreate(ads_data -> Pix);
+         }
+
+#if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_HIP)
+         if (exec == HYPRE_EXEC_DEVICE)
+         {
+            ads_data -> A_Pix = hypre_ParCSRMatrixRAPKT(ads_data -> Pix,
+                                                        ads_data -> A,
+                                                        ads_data -> Pix, 1);
+         }
+         else
 #endif
-      {
-         hypre_BoomerAMGBuildCoarseOperator(ads_data -> Pix,
-                                            ads_data -> A,
-                                            ads_data -> Pix,
-                                            &ads_data -> A_Pix);
+         {
+            hypre_BoomerAMGBuildCoarseOperator(ads_data -> Pix,
+                                               ads_data -> A,
+                                               ads_data -> Pix,
+                                               &ads_data -> A_Pix);
+         }
       }
 
       HYPRE_BoomerAMGSetup(ads_data -> B_Pix,
                            (HYPRE_ParCSRMatrix)ads_data -> A_Pix,
                            NULL, NULL);
 
-      if (!hypre_ParCSRMatrixCommPkg(ads_data -> Piy))
+      if (!ads_data -> A_Piy)
       {
-         hypre_MatvecCommPkgCreate(ads_data -> Piy);
-      }
+         if (!hypre_ParCSRMatrixCommPkg(ads_data -> Piy))
+         {
+            hypre_MatvecCommPkgCreate(ads_data -> Piy);
+         }
 
 #if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_HIP)
-      if (exec == HYPRE_EXEC_DEVICE)
-      {
-         ads_data -> A_Piy = hypre_ParCSRMatrixRAPKT(ads_data -> Piy,
-                                                     ads_data -> A,
-                                                     ads_data -> Piy, 1);
-      }
-      else
+         if (exec == HYPRE_EXEC_DEVICE)
+         {
+            ads_data -> A_Piy = hypre_ParCSRMatrixRAPKT(ads_data -> Piy,
+                                                        ads_data -> A,
+                                                        ads_data -> Piy, 1);
+         }
+         else
 #endif
-      {
-         hypre_BoomerAMGBuildCoarseOperator(ads_data -> Piy,
-                                            ads_data -> A,
-                                            ads_data -> Piy,
-                                            &ads_data -> A_Piy);
+         {
+            hypre_BoomerAMGBuildCoarseOperator(ads_data -> Piy,
+                                               ads_data -> A,
+                                               ads_data -> Piy,
+                                               &ads_data -> A_Piy);
+         }
       }
 
       HYPRE_BoomerAMGSetup(ads_data -> B_Piy,
                            (HYPRE_ParCSRMatrix)ads_data -> A_Piy,
                            NULL, NULL);
 
-      if (!hypre_ParCSRMatrixCommPkg(ads_data -> Piz))
+      if (!ads_data -> A_Piz)
       {
-         hypre_MatvecCommPkgCreate(ads_data -> Piz);
-      }
+         if (!hypre_ParCSRMatrixCommPkg(ads_data -> Piz))
+         {
+            hypre_MatvecCommPkgCreate(ads_data -> Piz);
+         }
 
 #if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_HIP)
-      if (exec == HYPRE_EXEC_DEVICE)
-      {
-         ads_data -> A_Piz = hypre_ParCSRMatrixRAPKT(ads_data -> Piz,
-                                                     ads_data -> A,
-                                                     ads_data -> Piz, 1);
-      }
-      else
+         if (exec == HYPRE_EXEC_DEVICE)
+         {
+            ads_data -> A_Piz = hypre_ParCSRMatrixRAPKT(ads_data -> Piz,
+                                                        ads_data -> A,
+                                                        ads_data -> Piz, 1);
+         }
+         else
 #endif
-      {
-         hypre_BoomerAMGBuildCoarseOperator(ads_data -> Piz,
-                                            ads_data -> A,
-                                            ads_data -> Piz,
-                                            &ads_data -> A_Piz);
+         {
+            hypre_BoomerAMGBuildCoarseOperator(ads_data -> Piz,
+                                               ads_data -> A,
+                                               ads_data -> Piz,
+                                               &ads_data -> A_Piz);
+         }
       }
 
       HYPRE_BoomerAMGSetup(ads_data -> B_Piz,
@@ -1884,6 +1884,11 @@ hypre_AMGHybridSolve( void               *AMGhybrid_vdata,
                   hypre_ParKrylovClearVector,
                   hypre_ParKrylovScaleVector, hypre_ParKrylovAxpy,
                   hypre_ParKrylovIdentitySetup, hypre_ParKrylovIdentity );
+            hypre_PCGFunctionsSetResidualInnerProd(pcg_functions,
+                                                  hypre_ParKrylovResidualInnerProd);
+            hypre_PCGFunctionsSetVectorUpdates(pcg_functions,
+                                               hypre_ParKrylovUpdateSolutionResidual,
+                                               hypre_ParKrylovAxpby);
             pcg_solver = hypre_PCGCreate( pcg_functions );
 
             hypre_PCGSetTol(pcg_solver, tol);
@@ -1951,6 +1956,8 @@ hypre_AMGHybridSolve( void               *AMGhybrid_vdata,
                   hypre_ParKrylovClearVector,
                   hypre_ParKrylovScaleVector, hypre_ParKrylovAxpy,
                   hypre_ParKrylovIdentitySetup, hypre_ParKrylovIdentity );
+            hypre_GMRESFunctionsSetResidualInnerProd(gmres_functions,
+                                                    hypre_ParKrylovResidualInnerProd);
             pcg_solver = hypre_GMRESCreate( gmres_functions );
 
             hypre_GMRESSetTol(pcg_solver, tol);
@@ -2014,6 +2021,9 @@ hypre_AMGHybridSolve( void               *AMGhybrid_vdata,
                   hypre_ParKrylovScaleVector, hypre_ParKrylovAxpy,
                   hypre_ParKrylovCommInfo,
                   hypre_ParKrylovIdentitySetup, hypre_ParKrylovIdentity );
+            hypre_BiCGSTABFunctionsSetVectorUpdates(bicgstab_functions,
+                                                    hypre_ParKrylovUpdateSolutionResidual,
+                                                    hypre_ParKrylovAxpby);
             pcg_solver = hypre_BiCGSTABCreate( bicgstab_functions );
 
             hypre_BiCGSTABSetTol(pcg_solver, tol);
@@ -835,6 +835,200 @@ HYPRE_Int hypre_ParCSRMatrixSetDiagRows(hypre_ParCSRMatrix *A, HYPRE_Real d)
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixBlockColSplit
+ *
+ * Split the columns of a parallel matrix A with interleaved block columns
+ * into dim matrices A_0,...,A_{dim-1}, such that column k of A_d is column
+ * dim*k+d of A. Each process must own whole column blocks. Host only.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int hypre_ParCSRMatrixBlockColSplit(hypre_ParCSRMatrix *A,
+                                          hypre_ParCSRMatrix *A_[3],
+                                          HYPRE_Int dim)
+{
+   MPI_Comm comm = hypre_ParCSRMatrixComm(A);
+   HYPRE_MemoryLocation memory_location = hypre_ParCSRMatrixMemoryLocation(A);
+
+   hypre_CSRMatrix *A_diag = hypre_ParCSRMatrixDiag(A);
+   HYPRE_Int *A_diag_I = hypre_CSRMatrixI(A_diag);
+   HYPRE_Int *A_diag_J = hypre_CSRMatrixJ(A_diag);
+   HYPRE_Real *A_diag_data = hypre_CSRMatrixData(A_diag);
+
+   hypre_CSRMatrix *A_offd = hypre_ParCSRMatrixOffd(A);
+   HYPRE_Int *A_offd_I = hypre_CSRMatrixI(A_offd);
+   HYPRE_Int *A_offd_J = hypre_CSRMatrixJ(A_offd);
+   HYPRE_Real *A_offd_data = hypre_CSRMatrixData(A_offd);
+
+   HYPRE_Int num_rows = hypre_CSRMatrixNumRows(A_diag);
+   HYPRE_Int num_cols_offd = hypre_CSRMatrixNumCols(A_offd);
+   HYPRE_BigInt *A_cmap = hypre_ParCSRMatrixColMapOffd(A);
+   HYPRE_BigInt *A_col_starts = hypre_ParCSRMatrixColStarts(A);
+
+   HYPRE_Int *offd_map = hypre_TAlloc(HYPRE_Int, num_cols_offd, HYPRE_MEMORY_HOST);
+   HYPRE_BigInt col_starts[2];
+   HYPRE_Int i, j, k, d, cnt, num_cols_offd_;
+
+   for (d = 0; d < dim; d++)
+   {
+      hypre_ParCSRMatrix *B;
+      HYPRE_Int *B_diag_I, *B_diag_J, *B_offd_I, *B_offd_J;
+      HYPRE_Real *B_diag_data, *B_offd_data;
+      HYPRE_BigInt *B_cmap;
+
+      /* the off-processor columns of component d keep their order */
+      num_cols_offd_ = 0;
+      for (k = 0; k < num_cols_offd; k++)
+      {
+         offd_map[k] = (A_cmap[k] % dim == d) ? num_cols_offd_++ : -1;
+      }
+
+      B_diag_I = hypre_CTAlloc(HYPRE_Int, num_rows + 1, memory_location);
+      B_offd_I = hypre_CTAlloc(HYPRE_Int, num_rows + 1, memory_location);
+
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel for private(i, j) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < num_rows; i++)
+      {
+         for (j = A_diag_I[i]; j < A_diag_I[i + 1]; j++)
+            if (A_diag_J[j] % dim == d)
+            {
+               B_diag_I[i + 1]++;
+            }
+         for (j = A_offd_I[i]; j < A_offd_I[i + 1]; j++)
+            if (offd_map[A_offd_J[j]] > -1)
+            {
+               B_offd_I[i + 1]++;
+            }
+      }
+
+      for (i = 0; i < num_rows; i++)
+      {
+         B_diag_I[i + 1] += B_diag_I[i];
+         B_offd_I[i + 1] += B_offd_I[i];
+      }
+
+      col_starts[0] = A_col_starts[0] / dim;
+      col_starts[1] = A_col_starts[1] / dim;
+
+      B = hypre_ParCSRMatrixCreate(comm,
+                                   hypre_ParCSRMatrixGlobalNumRows(A),
+                                   hypre_ParCSRMatrixGlobalNumCols(A) / dim,
+                                   hypre_ParCSRMatrixRowStarts(A),
+                                   col_starts,
+                                   num_cols_offd_,
+                                   B_diag_I[num_rows],
+                                   B_offd_I[num_rows]);
+      hypre_CSRMatrixI(hypre_ParCSRMatrixDiag(B)) = B_diag_I;
+      hypre_CSRMatrixI(hypre_ParCSRMatrixOffd(B)) = B_offd_I;
+      hypre_ParCSRMatrixInitialize_v2(B, memory_location);
+
+      B_diag_J = hypre_CSRMatrixJ(hypre_ParCSRMatrixDiag(B));
+      B_diag_data = hypre_CSRMatrixData(hypre_ParCSRMatrixDiag(B));
+      B_offd_J = hypre_CSRMatrixJ(hypre_ParCSRMatrixOffd(B));
+      B_offd_data = hypre_CSRMatrixData(hypre_ParCSRMatrixOffd(B));
+      B_cmap = hypre_ParCSRMatrixColMapOffd(B);
+
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel for private(i, j, cnt) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < num_rows; i++)
+      {
+         cnt = B_diag_I[i];
+         for (j = A_diag_I[i]; j < A_diag_I[i + 1]; j++)
+            if (A_diag_J[j] % dim == d)
+            {
+               B_diag_J[cnt] = A_diag_J[j] / dim;
+               B_diag_data[cnt++] = A_diag_data[j];
+            }
+         cnt = B_offd_I[i];
+         for (j = A_offd_I[i]; j < A_offd_I[i + 1]; j++)
+            if (offd_map[A_offd_J[j]] > -1)
+            {
+               B_offd_J[cnt] = offd_map[A_offd_J[j]];
+               B_offd_data[cnt++] = A_offd_data[j];
+            }
+      }
+
+      for (k = 0; k < num_cols_offd; k++)
+         if (offd_map[k] > -1)
+         {
+            B_cmap[offd_map[k]] = A_cmap[k] / dim;
+         }
+
+      A_[d] = B;
+   }
+
+   hypre_TFree(offd_map, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRComponentRAP
+ *
+ * Compute the Galerkin products A_d = Pi_d^T A Pi_d, d = 0,...,dim-1, of the
+ * components of the interleaved block interpolation Pi = [Pi_0,...]. If Pi
+ * is not NULL, this is done with a single product A*Pi instead of dim
+ * separate triple products, which shares the exchange of the external rows
+ * of Pi between the components. Pi is then split and its components are
+ * returned in Pi_. Otherwise, Pi_ holds the components on input and A*Pi_d
+ * is formed for each of them, with the same arithmetic. In both cases the
+ * off-diagonal blocks Pi_d^T A Pi_e are never formed. Host only.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int hypre_ParCSRComponentRAP(hypre_ParCSRMatrix *A,
+                                   hypre_ParCSRMatrix *Pi,
+                                   HYPRE_Int dim,
+                                   hypre_ParCSRMatrix *Pi_[3],
+                                   hypre_ParCSRMatrix *A_[3])
+{
+   hypre_ParCSRMatrix *APi, *APi_[3];
+   HYPRE_Int d;
+
+   if (!hypre_ParCSRMatrixCommPkg(A))
+   {
+      hypre_MatvecCommPkgCreate(A);
+   }
+
+   if (Pi)
+   {
+      /* A*Pi = [A*Pi_0, ..., A*Pi_{dim-1}] */
+      APi = hypre_ParCSRMatMat(A, Pi);
+      hypre_ParCSRMatrixBlockColSplit(APi, APi_, dim);
+      hypre_ParCSRMatrixDestroy(APi);
+
+      hypre_ParCSRMatrixBlockColSplit(Pi, Pi_, dim);
+   }
+   else
+   {
+      for (d = 0; d < dim; d++)
+      {
+         if (!hypre_ParCSRMatrixCommPkg(Pi_[d]))
+         {
+            hypre_MatvecCommPkgCreate(Pi_[d]);
+         }
+         APi_[d] = hypre_ParCSRMatMat(A, Pi_[d]);
+      }
+   }
+
+   for (d = 0; d < dim; d++)
+   {
+      if (!hypre_ParCSRMatrixCommPkg(Pi_[d]))
+      {
+         hypre_MatvecCommPkgCreate(Pi_[d]);
+      }
+      A_[d] = hypre_ParCSRTMatMat(Pi_[d], APi_[d]);
+      hypre_ParCSRMatrixDestroy(APi_[d]);
+
+      /* BoomerAMG expects the diagonal entry first */
+      hypre_CSRMatrixReorder(hypre_ParCSRMatrixDiag(A_[d]));
+   }
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_AMSCreate
  *
@@ -1578,7 +1772,7 @@ HYPRE_Int hypre_AMSComputePi(hypre_ParCSRMatrix *A,
    {
       HYPRE_Int i, j, d;
 
-      HYPRE_Real *Gx_data, *Gy_data, *Gz_data;
+      HYPRE_Real *Gx_data, *Gy_data = NULL, *Gz_data = NULL;
 
       MPI_Comm comm = hypre_ParCSRMatrixComm(G);
       HYPRE_BigInt global_num_rows = hypre_ParCSRMatrixGlobalNumRows(G);
@@ -1666,23 +1860,29 @@ HYPRE_Int hypre_AMSComputePi(hypre_ParCSRMatrix *A,
                Pi_diag_I[i] = dim * G_diag_I[i];
             }
 
+#ifdef HYPRE_USING_OPENMP
+            #pragma omp parallel for private(i, d) HYPRE_SMP_SCHEDULE
+#endif
             for (i = 0; i < G_diag_nnz; i++)
                for (d = 0; d < dim; d++)
                {
                   Pi_diag_J[dim * i + d] = dim * G_diag_J[i] + d;
                }
 
+#ifdef HYPRE_USING_OPENMP
+            #pragma omp parallel for private(i, j) HYPRE_SMP_SCHEDULE
+#endif
             for (i = 0; i < G_diag_nrows; i++)
                for (j = G_diag_I[i]; j < G_diag_I[i + 1]; j++)
                {
-                  *Pi_diag_data++ = fabs(G_diag_data[j]) * 0.5 * Gx_data[i];
+                  Pi_diag_data[dim * j] = fabs(G_diag_data[j]) * 0.5 * Gx_data[i];
                   if (dim >= 2)
                   {
-                     *Pi_diag_data++ = fabs(G_diag_data[j]) * 0.5 * Gy_data[i];
+                     Pi_diag_data[dim * j + 1] = fabs(G_diag_data[j]) * 0.5 * Gy_data[i];
                   }
                   if (dim == 3)
                   {
-                     *Pi_diag_data++ = fabs(G_diag_data[j]) * 0.5 * Gz_data[i];
+                     Pi_diag_data[dim * j + 2] = fabs(G_diag_data[j]) * 0.5 * Gz_data[i];
                   }
                }
          }
@@ -1736,23 +1936,29 @@ HYPRE_Int hypre_AMSComputePi(hypre_ParCSRMatrix *A,
                   Pi_offd_I[i] = dim * G_offd_I[i];
                }
 
+#ifdef HYPRE_USING_OPENMP
+            #pragma omp parallel for private(i, d) HYPRE_SMP_SCHEDULE
+#endif
             for (i = 0; i < G_offd_nnz; i++)
                for (d = 0; d < dim; d++)
                {
                   Pi_offd_J[dim * i + d] = dim * G_offd_J[i] + d;
                }
 
+#ifdef HYPRE_USING_OPENMP
+            #pragma omp parallel for private(i, j) HYPRE_SMP_SCHEDULE
+#endif
             for (i = 0; i < G_offd_nrows; i++)
                for (j = G_offd_I[i]; j < G_offd_I[i + 1]; j++)
                {
-                  *Pi_offd_data++ = fabs(G_offd_data[j]) * 0.5 * Gx_data[i];
+                  Pi_offd_data[dim * j] = fabs(G_offd_data[j]) * 0.5 * Gx_data[i];
                   if (dim >= 2)
                   {
-                     *Pi_offd_data++ = fabs(G_offd_data[j]) * 0.5 * Gy_data[i];
+                     Pi_offd_data[dim * j + 1] = fabs(G_offd_data[j]) * 0.5 * Gy_data[i];
                   }
                   if (dim == 3)
                   {
-                     *Pi_offd_data++ = fabs(G_offd_data[j]) * 0.5 * Gz_data[i];
+                     Pi_offd_data[dim * j + 2] = fabs(G_offd_data[j]) * 0.5 * Gz_data[i];
                   }
                }
          }
@@ -2645,6 +2851,76 @@ HYPRE_Int hypre_AMSComputeGPi(hypre_ParCSRMatrix *A,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_AMSSetupReset
+ *
+ * Free the data of a previous hypre_AMSSetup() call that depends on the
+ * coefficients of A: the Galerkin products, their AMG solvers and the work
+ * vectors. The interpolations only depend on the mesh and are kept.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int hypre_AMSSetupReset(hypre_AMSData *ams_data)
+{
+   if (ams_data -> owns_A_G && ams_data -> A_G)
+   {
+      hypre_ParCSRMatrixDestroy(ams_data -> A_G);
+      ams_data -> A_G = NULL;
+      ams_data -> owns_A_G = 0;
+   }
+   if (ams_data -> B_G)
+   {
+      HYPRE_BoomerAMGDestroy(ams_data -> B_G);
+      ams_data -> B_G = NULL;
+   }
+
+   if (ams_data -> owns_A_Pi && ams_data -> A_Pi)
+   {
+      hypre_ParCSRMatrixDestroy(ams_data -> A_Pi);
+      ams_data -> A_Pi = NULL;
+      ams_data -> owns_A_Pi = 0;
+   }
+   if (ams_data -> B_Pi)
+   {
+      HYPRE_BoomerAMGDestroy(ams_data -> B_Pi);
+      ams_data -> B_Pi = NULL;
+   }
+
+   hypre_ParCSRMatrixDestroy(ams_data -> A_Pix);
+   hypre_ParCSRMatrixDestroy(ams_data -> A_Piy);
+   hypre_ParCSRMatrixDestroy(ams_data -> A_Piz);
+   ams_data -> A_Pix = ams_data -> A_Piy = ams_data -> A_Piz = NULL;
+   if (ams_data -> B_Pix)
+   {
+      HYPRE_BoomerAMGDestroy(ams_data -> B_Pix);
+      ams_data -> B_Pix = NULL;
+   }
+   if (ams_data -> B_Piy)
+   {
+      HYPRE_BoomerAMGDestroy(ams_data -> B_Piy);
+      ams_data -> B_Piy = NULL;
+   }
+   if (ams_data -> B_Piz)
+   {
+      HYPRE_BoomerAMGDestroy(ams_data -> B_Piz);
+      ams_data -> B_Piz = NULL;
+   }
+
+   hypre_ParVectorDestroy(ams_data -> r0);
+   hypre_ParVectorDestroy(ams_data -> g0);
+   hypre_ParVectorDestroy(ams_data -> r1);
+   hypre_ParVectorDestroy(ams_data -> g1);
+   hypre_ParVectorDestroy(ams_data -> r2);
+   hypre_ParVectorDestroy(ams_data -> g2);
+   ams_data -> r0 = ams_data -> g0 = NULL;
+   ams_data -> r1 = ams_data -> g1 = NULL;
+   ams_data -> r2 = ams_data -> g2 = NULL;
+
+   hypre_SeqVectorDestroy(ams_data -> A_l1_norms);
+   ams_data -> A_l1_norms = NULL;
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_AMSSetup
  *
@@ -2800,6 +3076,12 @@ HYPRE_Int hypre_AMSSetup(void *solver,
 
    HYPRE_Int input_info = 0;
 
+   /* Repeated setup, e.g. after a change of the alpha/beta coefficients */
+   if (ams_data -> r0 && !ams_data -> interior_nodes)
+   {
+      hypre_AMSSetupReset(ams_data);
+   }
+
    ams_data -> A = A;
 
    /* Modifications for problems with zero-conductivity regions */
@@ -3104,16 +3386,31 @@ HYPRE_Int hypre_AMSSetup(void *solver,
                              ams_data -> dim,
                              &ams_data -> Pi);
       else if (ams_data -> cycle_type > 10)
-         /* Construct Pi{x,y,z} instead of Pi = [Pix,Piy,Piz] */
-         hypre_AMSComputePixyz(ams_data -> A,
+      {
+#if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_HIP)
+         if (exec == HYPRE_EXEC_DEVICE)
+            /* Construct Pi{x,y,z} instead of Pi = [Pix,Piy,Piz] */
+            hypre_AMSComputePixyz(ams_data -> A,
+                                  ams_data -> G,
+                                  ams_data -> Gx,
+                                  ams_data -> Gy,
+                                  ams_data -> Gz,
+                                  ams_data -> dim,
+                                  &ams_data -> Pix,
+                                  &ams_data -> Piy,
+                                  &ams_data -> Piz);
+         else
+#endif
+            /* Construct Pi = [Pix,Piy,Piz]. Pi{x,y,z} are split off below,
+               together with their coarse space matrices. */
+            hypre_AMSComputePi(ams_data -> A,
                                ams_data -> G,
                                ams_data -> Gx,
                                ams_data -> Gy,
                                ams_data -> Gz,
                                ams_data -> dim,
-                               &ams_data -> Pix,
-                               &ams_data -> Piy,
-                               &ams_data -> Piz);
+                               &ams_data -> Pi);
+      }
       else
          /* Construct the Pi interpolation matrix */
          hypre_AMSComputePi(ams_data -> A,
@@ -3258,24 +3555,58 @@ HYPRE_Int hypre_AMSSetup(void *solver,
          HYPRE_BoomerAMGSetMaxLevels(ams_data -> B_Piz, 2);
       }
 
-      /* Construct the coarse space matrices by RAP */
-      if (!hypre_ParCSRMatrixCommPkg(ams_data -> Pix))
+      /* Construct the coarse space matrices by RAP. On the host, all of them
+         are computed from the block Pi with a single product with A. The
+         block Pi is freed once it is split into Pi{x,y,z}, and a repeated
+         setup forms the same products per component. */
+      if (ams_data -> owns_Pi
+#if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_HIP)
+          && exec == HYPRE_EXEC_HOST
+#endif
+         )
       {
-         hypre_MatvecCommPkgCreate(ams_data -> Pix);
+         hypre_ParCSRMatrix *Pi_[3];
+         hypre_ParCSRMatrix *A_Pi_[3] = {NULL, NULL, NULL};
+
+         Pi_[0] = ams_data -> Pix;
+         Pi_[1] = ams_data -> Piy;
+         Pi_[2] = ams_data -> Piz;
+
+         hypre_ParCSRComponentRAP(ams_data -> A, ams_data -> Pi, ams_data -> dim,
+                                  Pi_, A_Pi_);
+         if (ams_data -> Pi)
+         {
+            hypre_ParCSRMatrixDestroy(ams_data -> Pi);
+            ams_data -> Pi = NULL;
+            ams_data -> Pix = Pi_[0];
+            ams_data -> Piy = Pi_[1];
+            ams_data -> Piz = Pi_[2];
+         }
+         ams_data -> A_Pix = A_Pi_[0];
+         ams_data -> A_Piy = A_Pi_[1];
+         ams_data -> A_Piz = A_Pi_[2];
       }
 
-#if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_HIP)
-      if (exec == HYPRE_EXEC_DEVICE)
+      if (!ams_data -> A_Pix)
       {
-         ams_data -> A_Pix = hypre_ParCSRMatrixRAPKT(ams_data -> Pix, ams_data -> A, ams_data -> Pix, 1);
-      }
-      else
+         if (!hypre_ParCSRMatrixCommPkg(ams_data -> Pix))
+         {
+            hypre_MatvecCommPkgCreate(ams_data -> Pix);
+         }
+
+#if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_HIP)
+         if (exec == HYPRE_EXEC_DEVICE)
+         {
+            ams_data -> A_Pix = hypre_ParCSRMatrixRAPKT(ams_data -> Pix, ams_data -> A, ams_data -> Pix, 1);
+         }
+         else
 #endif
-      {
-         hypre_BoomerAMGBuildCoarseOperator(ams_data -> Pix,
-                                            ams_data -> A,
-                                            ams_data -> Pix,
-                                            &ams_data -> A_Pix);
+         {
+            hypre_BoomerAMGBuildCoarseOperator(ams_data -> Pix,
+                                               ams_data -> A,
+                                               ams_data -> Pix,
+                                               &ams_data -> A_Pix);
+         }
       }
 
       /* Make sure that A_Pix has no zero rows (this can happen
@@ -3288,25 +3619,28 @@ HYPRE_Int hypre_AMSSetup(void *solver,
 
       if (ams_data -> Piy)
       {
-         if (!hypre_ParCSRMatrixCommPkg(ams_data -> Piy))
+         if (!ams_data -> A_Piy)
          {
-            hypre_MatvecCommPkgCreate(ams_data -> Piy);
-         }
+            if (!hypre_ParCSRMatrixCommPkg(ams_data -> Piy))
+            {
+               hypre_MatvecCommPkgCreate(ams_data -> Piy);
+            }
 
 #if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_HIP)
-         if (exec == HYPRE_EXEC_DEVICE)
-         {
-            ams_data -> A_Piy = hypre_ParCSRMatrixRAPKT(ams_data -> Piy,
-                                                        ams_data -> A,
-                                                        ams_data -> Piy, 1);
-         }
-         else
+            if (exec == HYPRE_EXEC_DEVICE)
+            {
+               ams_data -> A_Piy = hypre_ParCSRMatrixRAPKT(ams_data -> Piy,
+                                                           ams_data -> A,
+                                                           ams_data -> Piy, 1);
+            }
+            else
 #endif
-         {
-            hypre_BoomerAMGBuildCoarseOperator(ams_data -> Piy,
-                                               ams_data -> A,
-                                               ams_data -> Piy,
-                                               &ams_data -> A_Piy);
+            {
+               hypre_BoomerAMGBuildCoarseOperator(ams_data -> Piy,
+                                                  ams_data -> A,
+                                                  ams_data -> Piy,
+                                                  &ams_data -> A_Piy);
+            }
          }
 
          /* Make sure that A_Piy has no zero rows (this can happen
@@ -3320,25 +3654,28 @@ HYPRE_Int hypre_AMSSetup(void *solver,
 
       if (ams_data -> Piz)
       {
-         if (!hypre_ParCSRMatrixCommPkg(ams_data -> Piz))
+         if (!ams_data -> A_Piz)
          {
-            hypre_MatvecCommPkgCreate(ams_data -> Piz);
-         }
+            if (!hypre_ParCSRMatrixCommPkg(ams_data -> Piz))
+            {
+               hypre_MatvecCommPkgCreate(ams_data -> Piz);
+            }
 
 #if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_HIP)
-         if (exec == HYPRE_EXEC_DEVICE)
-         {
-            ams_data -> A_Piz = hypre_ParCSRMatrixRAPKT(ams_data -> Piz,
-                                                        ams_data -> A,
-                                                        ams_data -> Piz, 1);
-         }
-         else
+            if (exec == HYPRE_EXEC_DEVICE)
+            {
+               ams_data -> A_Piz = hypre_ParCSRMatrixRAPKT(ams_data -> Piz,
+                                                           ams_data -> A,
+                                                           ams_data -> Piz, 1);
+            }
+            else
 #endif
-         {
-            hypre_BoomerAMGBuildCoarseOperator(ams_data -> Piz,
-                                               ams_data -> A,
-                                               ams_data -> Piz,
-                                               &ams_data -> A_Piz);
+            {
+               hypre_BoomerAMGBuildCoarseOperator(ams_data -> Piz,
+                                                  ams_data -> A,
+                                                  ams_data -> Piz,
+                                                  &ams_data -> A_Piz);
+            }
          }
 
          /* Make sure that A_Piz has no zero rows (this can happen
@@ -3595,7 +3932,7 @@ HYPRE_Int hypre_AMSSetup(void *solver,
       ams_data -> r1 = hypre_ParVectorInRangeOf(ams_data -> A_Pix);
       ams_data -> g1 = hypre_ParVectorInRangeOf(ams_data -> A_Pix);
    }
-   if (ams_data -> Pi)
+   if (ams_data -> B_Pi)
    {
       ams_data -> r2 = hypre_ParVectorInDomainOf(ams_data -> Pi);
       ams_data -> g2 = hypre_ParVectorInDomainOf(ams_data -> Pi);
@@ -306,14 +306,17 @@ static HYPRE_Int hypre_new_offd_nodes(HYPRE_BigInt **found, HYPRE_Int num_cols_A
    hypre_profile_times[HYPRE_TIMER_ID_RENUMBER_COLIDX] -= hypre_MPI_Wtime();
 #endif
 
-   HYPRE_BigInt big_i1, big_k1;
+   HYPRE_BigInt big_i1;
    HYPRE_Int i, j, kk;
-   HYPRE_Int got_loc, loc_col;
+   HYPRE_Int loc_col;
 
    /*HYPRE_Int min;*/
    HYPRE_Int newoff = 0;
 
 #ifdef HYPRE_CONCURRENT_HOPSCOTCH
+   HYPRE_BigInt big_k1;
+   HYPRE_Int got_loc;
+
    hypre_UnorderedBigIntMap col_map_offd_inverse;
    hypre_UnorderedBigIntMapCreate(&col_map_offd_inverse, 2 * num_cols_A_offd, 16 * hypre_NumThreads());
 
@@ -430,16 +433,20 @@ static HYPRE_Int hypre_new_offd_nodes(HYPRE_BigInt **found, HYPRE_Int num_cols_A
       hypre_UnorderedBigIntMapDestroy(&tmp_found_inverse);
    }
 #else /* !HYPRE_CONCURRENT_HOPSCOTCH */
-   HYPRE_Int size_offP;
+   HYPRE_Int size_offP, num_offd, num_cols_found;
 
    HYPRE_BigInt *tmp_found;
-   HYPRE_Int min;
-   HYPRE_Int ifound;
+   HYPRE_BigInt *big_offd;
+   HYPRE_BigInt *cols_found;
+   HYPRE_Int    *loc_offd;
+   HYPRE_Int    *cols_map;
 
    size_offP = A_ext_i[num_cols_A_offd] + Sop_i[num_cols_A_offd];
-   tmp_found = hypre_CTAlloc(HYPRE_BigInt, size_offP, HYPRE_MEMORY_HOST);
+   big_offd  = hypre_TAlloc(HYPRE_BigInt, size_offP, HYPRE_MEMORY_HOST);
+   loc_offd  = hypre_TAlloc(HYPRE_Int, size_offP, HYPRE_MEMORY_HOST);
 
-   /* Find nodes that will be added to the off diag list */
+   /* Gather the off-processor columns */
+   num_offd = 0;
    for (i = 0; i < num_cols_A_offd; i++)
    {
       if (CF_marker_offd[i] < 0)
@@ -449,16 +456,7 @@ static HYPRE_Int hypre_new_offd_nodes(HYPRE_BigInt **found, HYPRE_Int num_cols_A
             big_i1 = A_ext_j[j];
             if (big_i1 < col_1 || big_i1 >= col_n)
             {
-               ifound = hypre_BigBinarySearch(col_map_offd, big_i1, num_cols_A_offd);
-               if (ifound == -1)
-               {
-                  tmp_found[newoff] = big_i1;
-                  newoff++;
-               }
-               else
-               {
-                  A_ext_j[j] = (HYPRE_BigInt)(-ifound - 1);
-               }
+               big_offd[num_offd++] = big_i1;
             }
          }
          for (j = Sop_i[i]; j < Sop_i[i + 1]; j++)
@@ -466,68 +464,69 @@ static HYPRE_Int hypre_new_offd_nodes(HYPRE_BigInt **found, HYPRE_Int num_cols_A
             big_i1 = Sop_j[j];
             if (big_i1 < col_1 || big_i1 >= col_n)
             {
-               ifound = hypre_BigBinarySearch(col_map_offd, big_i1, num_cols_A_offd);
-               if (ifound == -1)
-               {
-                  tmp_found[newoff] = big_i1;
-                  newoff++;
-               }
-               else
-               {
-                  Sop_j[j] = (HYPRE_BigInt)(-ifound - 1);
-               }
+               big_offd[num_offd++] = big_i1;
             }
          }
       }
    }
-   /* Put found in monotone increasing order */
-   if (newoff > 0)
+
+   /* Compress them, then split the unique columns into the ones already in
+    * col_map_offd and the new ones, which are kept in increasing order */
+   hypre_GlobalToLocalColumns(num_offd, big_offd, 0, NULL, loc_offd, NULL,
+                              &num_cols_found, &cols_found);
+
+   tmp_found = hypre_TAlloc(HYPRE_BigInt, num_cols_found, HYPRE_MEMORY_HOST);
+   cols_map  = hypre_TAlloc(HYPRE_Int, num_cols_found, HYPRE_MEMORY_HOST);
+   kk = 0;
+   for (i = 0; i < num_cols_found; i++)
    {
-      hypre_BigQsort0(tmp_found, 0, newoff - 1);
-      ifound = tmp_found[0];
-      min = 1;
-      for (i = 1; i < newoff; i++)
+      while (kk < num_cols_A_offd && col_map_offd[kk] < cols_found[i])
       {
-         if (tmp_found[i] > ifound)
-         {
-            ifound = tmp_found[i];
-            tmp_found[min++] = ifound;
-         }
+         kk++;
+      }
+      if (kk < num_cols_A_offd && col_map_offd[kk] == cols_found[i])
+      {
+         cols_map[i] = kk;
+      }
+      else
+      {
+         cols_map[i] = num_cols_A_offd + newoff;
+         tmp_found[newoff++] = cols_found[i];
       }
-      newoff = min;
    }
 
    /* Set column indices for Sop and A_ext such that offd nodes are
     * negatively indexed */
+   num_offd = 0;
    for (i = 0; i < num_cols_A_offd; i++)
    {
       if (CF_marker_offd[i] < 0)
       {
-         for (kk = Sop_i[i]; kk < Sop_i[i + 1]; kk++)
+         for (j = A_ext_i[i]; j < A_ext_i[i + 1]; j++)
          {
-            big_k1 = Sop_j[kk];
-            if (big_k1 > -1 && (big_k1 < col_1 || big_k1 >= col_n))
+            big_i1 = A_ext_j[j];
+            if (big_i1 < col_1 || big_i1 >= col_n)
             {
-               got_loc = hypre_BigBinarySearch(tmp_found, big_k1, newoff);
-               if (got_loc > -1)
-               {
-                  loc_col = got_loc + num_cols_A_offd;
-               }
-               Sop_j[kk] = (HYPRE_BigInt)(-loc_col - 1);
+               loc_col = cols_map[loc_offd[num_offd++]];
+               A_ext_j[j] = (HYPRE_BigInt)(-loc_col - 1);
             }
          }
-         for (kk = A_ext_i[i]; kk < A_ext_i[i + 1]; kk++)
+         for (j = Sop_i[i]; j < Sop_i[i + 1]; j++)
          {
-            big_k1 = A_ext_j[kk];
-            if (big_k1 > -1 && (big_k1 < col_1 || big_k1 >= col_n))
+            big_i1 = Sop_j[j];
+            if (big_i1 < col_1 || big_i1 >= col_n)
             {
-               got_loc = hypre_BigBinarySearch(tmp_found, big_k1, newoff);
-               loc_col = got_loc + num_cols_A_offd;
-               A_ext_j[kk] = (HYPRE_BigInt)(-loc_col - 1);
+               loc_col = cols_map[loc_offd[num_offd++]];
+               Sop_j[j] = (HYPRE_BigInt)(-loc_col - 1);
             }
          }
       }
    }
+
+   hypre_TFree(big_offd, HYPRE_MEMORY_HOST);
+   hypre_TFree(loc_offd, HYPRE_MEMORY_HOST);
+   hypre_TFree(cols_found, HYPRE_MEMORY_HOST);
+   hypre_TFree(cols_map, HYPRE_MEMORY_HOST);
 #endif /* !HYPRE_CONCURRENT_HOPSCOTCH */
 
    *found = tmp_found;
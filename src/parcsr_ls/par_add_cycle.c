@@ -35,6 +35,8 @@ hypre_BoomerAMGAdditiveCycle( void              *amg_vdata)
    hypre_ParVector    *Vtemp;
    hypre_ParVector    *Ztemp;
    hypre_ParVector    *Xtilde, *Rtilde;
+   hypre_ParCSRMatrix *Rhat;
+   hypre_ParVector    *Rhat_r, *Rhat_x;
    hypre_IntArray    **CF_marker_array;
    HYPRE_Int          *CF_marker;
 
@@ -44,6 +46,7 @@ hypre_BoomerAMGAdditiveCycle( void              *amg_vdata)
    HYPRE_Int       mult_additive;
    HYPRE_Int       simple;
    HYPRE_Int       add_last_lvl;
+   HYPRE_Int       comp_end;
    HYPRE_Int       i, j, num_rows;
    HYPRE_Int       n_global;
    HYPRE_Int       rlx_order;
@@ -102,6 +105,10 @@ hypre_BoomerAMGAdditiveCycle( void              *amg_vdata)
    omega             = hypre_ParAMGDataOmega(amg_data);
    rlx_order         = hypre_ParAMGDataRelaxOrder(amg_data);
    num_grid_sweeps   = hypre_ParAMGDataNumGridSweeps(amg_data);
+   Rhat              = hypre_ParAMGDataRhat(amg_data);
+   Rhat_r            = hypre_ParAMGDataRhatR(amg_data);
+   Rhat_x            = hypre_ParAMGDataRhatX(amg_data);
+   comp_end          = hypre_ParAMGDataAddCompLastLvl(amg_data);
 
    /* Initialize */
 
@@ -194,6 +201,10 @@ hypre_BoomerAMGAdditiveCycle( void              *amg_vdata)
          hypre_ParCSRMatrixMatvecT(alpha, R_array[fine_grid], Vtemp,
                                    beta, F_array[coarse_grid]);
       }
+      else if (Rhat && level > addlvl && level < comp_end)
+      {
+         /* residual already obtained with the composite restriction */
+      }
       else /* additive version */
       {
          hypre_ParVectorCopy(F_array[fine_grid], Vtemp);
@@ -204,8 +215,16 @@ hypre_BoomerAMGAdditiveCycle( void              *amg_vdata)
          }
          alpha = 1.0;
          beta = 0.0;
-         hypre_ParCSRMatrixMatvecT(alpha, R_array[fine_grid], Vtemp,
-                                   beta, F_array[coarse_grid]);
+         if (Rhat && level == addlvl)
+         {
+            /* restrict to all levels addlvl+1, ..., comp_end at once */
+            hypre_ParCSRMatrixMatvec(alpha, Rhat, Vtemp, beta, Rhat_r);
+         }
+         else
+         {
+            hypre_ParCSRMatrixMatvecT(alpha, R_array[fine_grid], Vtemp,
+                                      beta, F_array[coarse_grid]);
+         }
       }
 
       HYPRE_ANNOTATE_MGLEVEL_END(level);
@@ -324,13 +343,25 @@ hypre_BoomerAMGAdditiveCycle( void              *amg_vdata)
                                  U_array[fine_grid], Vtemp, Ztemp);
             }
       }
+      else if (Rhat && fine_grid > addlvl && fine_grid < comp_end)
+      {
+         /* corrections are interpolated with the composite operator */
+      }
       else /* additive version */
       {
          alpha = 1.0;
          beta = 1.0;
-         hypre_ParCSRMatrixMatvec(alpha, P_array[fine_grid],
-                                  U_array[coarse_grid],
-                                  beta, U_array[fine_grid]);
+         if (Rhat && fine_grid == addlvl)
+         {
+            /* interpolate the corrections of levels addlvl+1, ..., comp_end at once */
+            hypre_ParCSRMatrixMatvecT(alpha, Rhat, Rhat_x, beta, U_array[fine_grid]);
+         }
+         else
+         {
+            hypre_ParCSRMatrixMatvec(alpha, P_array[fine_grid],
+                                     U_array[coarse_grid],
+                                     beta, U_array[fine_grid]);
+         }
       }
 
       HYPRE_ANNOTATE_MGLEVEL_END(level);
@@ -1157,3 +1188,262 @@ HYPRE_Int hypre_CreateDinv(void *amg_vdata)
 
    return Solve_err_flag;
 }
+
+/*--------------------------------------------------------------------------
+ * hypre_CreateAddComposite
+ *
+ * Builds the composite restriction Rhat used by the additive part of the
+ * cycle when add_composite is set. With a = addlvl, the local rows of
+ * Rhat are the stacked local rows of
+ *
+ *    (P_a)^T, (P_a P_{a+1})^T, ..., (P_a ... P_{m-1})^T
+ *
+ * for the additive levels a+1, ..., m that live in Rtilde/Xtilde. The
+ * residuals of all these levels are then obtained from the level a
+ * residual with a single Matvec (one halo exchange), and the corrections
+ * are interpolated back to level a with a single MatvecT. Since the rows of
+ * all coarse levels are processed by one threaded kernel, small coarse
+ * levels no longer run one after another on a few threads each.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CreateAddComposite(void *amg_vdata)
+{
+   hypre_ParAMGData    *amg_data = (hypre_ParAMGData*) amg_vdata;
+
+   MPI_Comm             comm;
+   hypre_ParCSRMatrix **A_array;
+   hypre_ParCSRMatrix **P_array;
+   hypre_ParCSRMatrix  *Phat, *Ptmp;
+   hypre_ParCSRMatrix **C_array;
+   hypre_ParCSRMatrix  *Rhat;
+   hypre_CSRMatrix     *C_diag, *C_offd;
+   hypre_CSRMatrix     *Rhat_diag, *Rhat_offd;
+   hypre_ParVector     *Rtilde, *Xtilde;
+   hypre_ParVector     *Rhat_r, *Rhat_x;
+   hypre_Vector        *Rhat_r_local, *Rhat_x_local;
+
+   HYPRE_Int           *Rhat_diag_i, *Rhat_diag_j;
+   HYPRE_Int           *Rhat_offd_i, *Rhat_offd_j;
+   HYPRE_Real          *Rhat_diag_data, *Rhat_offd_data;
+   HYPRE_Int           *C_diag_i, *C_diag_j;
+   HYPRE_Int           *C_offd_i, *C_offd_j;
+   HYPRE_Real          *C_diag_data, *C_offd_data;
+   HYPRE_BigInt        *C_col_map_offd;
+   HYPRE_BigInt        *col_map_offd = NULL;
+   HYPRE_BigInt         row_starts[2];
+   HYPRE_BigInt         num_rows_local, global_num_rows;
+
+   HYPRE_Int            num_levels, addlvl, add_end, add_last_lvl;
+   HYPRE_Int            simple, num_comp;
+   HYPRE_Int            num_rows, num_rows_a, row_start;
+   HYPRE_Int            num_cols_offd, num_cols_offd_C;
+   HYPRE_Int            nnz_diag, nnz_offd, cnt_diag, cnt_offd;
+   HYPRE_Int            num_procs, level, i, j, k;
+
+   comm         = hypre_ParCSRMatrixComm(hypre_ParAMGDataAArray(amg_data)[0]);
+   A_array      = hypre_ParAMGDataAArray(amg_data);
+   P_array      = hypre_ParAMGDataPArray(amg_data);
+   num_levels   = hypre_ParAMGDataNumLevels(amg_data);
+   simple       = hypre_ParAMGDataSimple(amg_data);
+   add_last_lvl = hypre_ParAMGDataAddLastLvl(amg_data);
+   Rtilde       = hypre_ParAMGDataRtilde(amg_data);
+   Xtilde       = hypre_ParAMGDataXtilde(amg_data);
+
+   hypre_MPI_Comm_size(comm, &num_procs);
+
+   /* The additive cycle restricts with R^T, the composite operator with P^T */
+   if (hypre_ParAMGDataRestriction(amg_data) || !Rtilde || !Xtilde)
+   {
+      return hypre_error_flag;
+   }
+
+   /* Same level range as in hypre_CreateDinv and hypre_CreateLambda */
+   if (simple > -1)
+   {
+      addlvl  = simple;
+      add_end = (add_last_lvl == -1) ? num_levels : add_last_lvl;
+   }
+   else
+   {
+      addlvl  = hypre_max(hypre_ParAMGDataAdditive(amg_data),
+                          hypre_ParAMGDataMultAdditive(amg_data));
+      add_end = (add_last_lvl == -1) ? num_levels : add_last_lvl + 1;
+   }
+   add_end  = hypre_min(add_end, num_levels);
+   num_comp = add_end - addlvl - 1;
+
+   if (num_comp < 1)
+   {
+      return hypre_error_flag;
+   }
+
+   /*-----------------------------------------------------------------------
+    * Compute the transposes of the composite interpolations P_a ... P_{l-1}
+    *-----------------------------------------------------------------------*/
+
+   C_array = hypre_CTAlloc(hypre_ParCSRMatrix *, num_comp, HYPRE_MEMORY_HOST);
+   Phat    = P_array[addlvl];
+   for (level = addlvl + 1; level < add_end; level++)
+   {
+      if (level > addlvl + 1)
+      {
+         Ptmp = hypre_ParMatmul(Phat, P_array[level - 1]);
+         if (Phat != P_array[addlvl])
+         {
+            hypre_ParCSRMatrixDestroy(Phat);
+         }
+         Phat = Ptmp;
+      }
+      hypre_ParCSRMatrixTranspose(Phat, &C_array[level - addlvl - 1], 1);
+   }
+   if (Phat != P_array[addlvl])
+   {
+      hypre_ParCSRMatrixDestroy(Phat);
+   }
+
+   /*-----------------------------------------------------------------------
+    * Merge the off-processor column maps, all in the level a numbering
+    *-----------------------------------------------------------------------*/
+
+   num_rows = 0;
+   nnz_diag = 0;
+   nnz_offd = 0;
+   num_cols_offd = 0;
+   for (k = 0; k < num_comp; k++)
+   {
+      C_diag    = hypre_ParCSRMatrixDiag(C_array[k]);
+      C_offd    = hypre_ParCSRMatrixOffd(C_array[k]);
+      num_rows += hypre_CSRMatrixNumRows(C_diag);
+      nnz_diag += hypre_CSRMatrixNumNonzeros(C_diag);
+      nnz_offd += hypre_CSRMatrixNumNonzeros(C_offd);
+      num_cols_offd += hypre_CSRMatrixNumCols(C_offd);
+   }
+
+   if (num_cols_offd)
+   {
+      col_map_offd  = hypre_TAlloc(HYPRE_BigInt, num_cols_offd, HYPRE_MEMORY_HOST);
+      num_cols_offd = 0;
+      for (k = 0; k < num_comp; k++)
+      {
+         C_col_map_offd  = hypre_ParCSRMatrixColMapOffd(C_array[k]);
+         num_cols_offd_C = hypre_CSRMatrixNumCols(hypre_ParCSRMatrixOffd(C_array[k]));
+         for (i = 0; i < num_cols_offd_C; i++)
+         {
+            col_map_offd[num_cols_offd++] = C_col_map_offd[i];
+         }
+      }
+      hypre_BigQsort0(col_map_offd, 0, num_cols_offd - 1);
+
+      j = 0;
+      for (i = 1; i < num_cols_offd; i++)
+      {
+         if (col_map_offd[i] > col_map_offd[j])
+         {
+            col_map_offd[++j] = col_map_offd[i];
+         }
+      }
+      num_cols_offd = j + 1;
+   }
+
+   /*-----------------------------------------------------------------------
+    * Stack the local rows of all composite restrictions
+    *-----------------------------------------------------------------------*/
+
+   num_rows_local = (HYPRE_BigInt) num_rows;
+   hypre_MPI_Scan(&num_rows_local, &row_starts[1], 1, HYPRE_MPI_BIG_INT, hypre_MPI_SUM, comm);
+   row_starts[0] = row_starts[1] - num_rows_local;
+   global_num_rows = row_starts[1];
+   hypre_MPI_Bcast(&global_num_rows, 1, HYPRE_MPI_BIG_INT, num_procs - 1, comm);
+
+   Rhat = hypre_ParCSRMatrixCreate(comm, global_num_rows,
+                                   hypre_ParCSRMatrixGlobalNumRows(A_array[addlvl]),
+                                   row_starts, hypre_ParCSRMatrixRowStarts(A_array[addlvl]),
+                                   num_cols_offd, nnz_diag, nnz_offd);
+   hypre_ParCSRMatrixInitialize_v2(Rhat, HYPRE_MEMORY_HOST);
+
+   Rhat_diag      = hypre_ParCSRMatrixDiag(Rhat);
+   Rhat_offd      = hypre_ParCSRMatrixOffd(Rhat);
+   Rhat_diag_i    = hypre_CSRMatrixI(Rhat_diag);
+   Rhat_diag_j    = hypre_CSRMatrixJ(Rhat_diag);
+   Rhat_diag_data = hypre_CSRMatrixData(Rhat_diag);
+   Rhat_offd_i    = hypre_CSRMatrixI(Rhat_offd);
+   Rhat_offd_j    = hypre_CSRMatrixJ(Rhat_offd);
+   Rhat_offd_data = hypre_CSRMatrixData(Rhat_offd);
+
+   for (i = 0; i < num_cols_offd; i++)
+   {
+      hypre_ParCSRMatrixColMapOffd(Rhat)[i] = col_map_offd[i];
+   }
+
+   row_start = 0;
+   cnt_diag  = 0;
+   cnt_offd  = 0;
+   Rhat_diag_i[0] = 0;
+   Rhat_offd_i[0] = 0;
+   for (k = 0; k < num_comp; k++)
+   {
+      C_diag          = hypre_ParCSRMatrixDiag(C_array[k]);
+      C_offd          = hypre_ParCSRMatrixOffd(C_array[k]);
+      C_diag_i        = hypre_CSRMatrixI(C_diag);
+      C_diag_j        = hypre_CSRMatrixJ(C_diag);
+      C_diag_data     = hypre_CSRMatrixData(C_diag);
+      C_offd_i        = hypre_CSRMatrixI(C_offd);
+      C_offd_j        = hypre_CSRMatrixJ(C_offd);
+      C_offd_data     = hypre_CSRMatrixData(C_offd);
+      C_col_map_offd  = hypre_ParCSRMatrixColMapOffd(C_array[k]);
+      num_rows_a      = hypre_CSRMatrixNumRows(C_diag);
+
+      for (i = 0; i < num_rows_a; i++)
+      {
+         for (j = C_diag_i[i]; j < C_diag_i[i + 1]; j++)
+         {
+            Rhat_diag_j[cnt_diag]      = C_diag_j[j];
+            Rhat_diag_data[cnt_diag++] = C_diag_data[j];
+         }
+         for (j = C_offd_i[i]; j < C_offd_i[i + 1]; j++)
+         {
+            Rhat_offd_j[cnt_offd]      = hypre_BigBinarySearch(col_map_offd,
+                                                               C_col_map_offd[C_offd_j[j]],
+                                                               num_cols_offd);
+            Rhat_offd_data[cnt_offd++] = C_offd_data[j];
+         }
+         Rhat_diag_i[row_start + i + 1] = cnt_diag;
+         Rhat_offd_i[row_start + i + 1] = cnt_offd;
+      }
+      row_start += num_rows_a;
+
+      hypre_ParCSRMatrixDestroy(C_array[k]);
+   }
+   hypre_TFree(C_array, HYPRE_MEMORY_HOST);
+   hypre_TFree(col_map_offd, HYPRE_MEMORY_HOST);
+
+   hypre_MatvecCommPkgCreate(Rhat);
+
+   /*-----------------------------------------------------------------------
+    * Views of Rtilde and Xtilde restricted to the levels a+1, ..., m
+    *-----------------------------------------------------------------------*/
+
+   num_rows_a = hypre_ParCSRMatrixNumRows(A_array[addlvl]);
+
+   Rhat_r = hypre_ParVectorCreate(comm, global_num_rows, row_starts);
+   Rhat_r_local = hypre_ParVectorLocalVector(Rhat_r);
+   hypre_VectorData(Rhat_r_local) = hypre_VectorData(hypre_ParVectorLocalVector(Rtilde)) +
+                                    num_rows_a;
+   hypre_VectorMemoryLocation(Rhat_r_local) = HYPRE_MEMORY_HOST;
+   hypre_SeqVectorSetDataOwner(Rhat_r_local, 0);
+
+   Rhat_x = hypre_ParVectorCreate(comm, global_num_rows, row_starts);
+   Rhat_x_local = hypre_ParVectorLocalVector(Rhat_x);
+   hypre_VectorData(Rhat_x_local) = hypre_VectorData(hypre_ParVectorLocalVector(Xtilde)) +
+                                    num_rows_a;
+   hypre_VectorMemoryLocation(Rhat_x_local) = HYPRE_MEMORY_HOST;
+   hypre_SeqVectorSetDataOwner(Rhat_x_local, 0);
+
+   hypre_ParAMGDataRhat(amg_data)           = Rhat;
+   hypre_ParAMGDataRhatR(amg_data)          = Rhat_r;
+   hypre_ParAMGDataRhatX(amg_data)          = Rhat_x;
+   hypre_ParAMGDataAddCompLastLvl(amg_data) = add_end - 1;
+
+   return hypre_error_flag;
+}
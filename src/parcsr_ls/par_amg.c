@@ -31,6 +31,7 @@ hypre_BoomerAMGCreate( void )
    HYPRE_Int    max_coarse_size;
    HYPRE_Int    min_coarse_size;
    HYPRE_Int    coarsen_cut_factor;
+   HYPRE_Int    coarsen_thread_blocks;
    HYPRE_Real   strong_threshold;
    HYPRE_Real   strong_threshold_R;
    HYPRE_Real   filter_threshold_R;
@@ -118,6 +119,7 @@ hypre_BoomerAMGCreate( void )
    HYPRE_Int cheby_eig_est;
    HYPRE_Int cheby_variant;
    HYPRE_Int cheby_scale;
+   HYPRE_Int cheby_mat_powers;
    HYPRE_Real cheby_eig_ratio;
 
    HYPRE_Int block_mode;
@@ -130,6 +132,7 @@ hypre_BoomerAMGCreate( void )
    HYPRE_Int    add_P_max_elmts;
    HYPRE_Int    add_rlx_type;
    HYPRE_Real   add_rlx_wt;
+   HYPRE_Int    add_composite;
 
    /* log info */
    HYPRE_Int    num_iterations;
@@ -158,6 +161,7 @@ hypre_BoomerAMGCreate( void )
    seq_threshold = 0;
    redundant = 0;
    coarsen_cut_factor = 0;
+   coarsen_thread_blocks = 0;
    strong_threshold = 0.25;
    strong_threshold_R = 0.25;
    filter_threshold_R = 0.0;
@@ -247,6 +251,7 @@ hypre_BoomerAMGCreate( void )
    cheby_order = 2;
    cheby_variant = 0;
    cheby_scale = 1;
+   cheby_mat_powers = 0;
    cheby_eig_est = 10;
    cheby_eig_ratio = .3;
 
@@ -260,6 +265,7 @@ hypre_BoomerAMGCreate( void )
    add_P_max_elmts = 0;
    add_rlx_type = 18;
    add_rlx_wt = 1.0;
+   add_composite = 0;
 
    /* log info */
    num_iterations = 0;
@@ -311,6 +317,7 @@ hypre_BoomerAMGCreate( void )
    hypre_BoomerAMGSetMaxCoarseSize(amg_data, max_coarse_size);
    hypre_BoomerAMGSetMinCoarseSize(amg_data, min_coarse_size);
    hypre_BoomerAMGSetCoarsenCutFactor(amg_data, coarsen_cut_factor);
+   hypre_BoomerAMGSetCoarsenThreadBlocks(amg_data, coarsen_thread_blocks);
    hypre_BoomerAMGSetStrongThreshold(amg_data, strong_threshold);
    hypre_BoomerAMGSetStrongThresholdR(amg_data, strong_threshold_R);
    hypre_BoomerAMGSetFilterThresholdR(amg_data, filter_threshold_R);
@@ -396,6 +403,7 @@ hypre_BoomerAMGCreate( void )
    hypre_BoomerAMGSetChebyEigEst(amg_data, cheby_eig_est);
    hypre_BoomerAMGSetChebyVariant(amg_data, cheby_variant);
    hypre_BoomerAMGSetChebyScale(amg_data, cheby_scale);
+   hypre_BoomerAMGSetChebyMatPowers(amg_data, cheby_mat_powers);
 
    hypre_BoomerAMGSetNumIterations(amg_data, num_iterations);
 
@@ -411,6 +419,11 @@ hypre_BoomerAMGCreate( void )
    hypre_ParAMGDataXtilde(amg_data) = NULL;
    hypre_ParAMGDataRtilde(amg_data) = NULL;
    hypre_ParAMGDataDinv(amg_data) = NULL;
+   hypre_BoomerAMGSetAddComposite(amg_data, add_composite);
+   hypre_ParAMGDataAddCompLastLvl(amg_data) = -1;
+   hypre_ParAMGDataRhat(amg_data) = NULL;
+   hypre_ParAMGDataRhatR(amg_data) = NULL;
+   hypre_ParAMGDataRhatX(amg_data) = NULL;
 
 #ifdef CUMNUMIT
    hypre_ParAMGDataCumNumIterations(amg_data) = cum_num_iterations;
@@ -456,6 +469,12 @@ hypre_BoomerAMGCreate( void )
    hypre_ParAMGDataMinEigEst(amg_data) = NULL;
    hypre_ParAMGDataChebyDS(amg_data) = NULL;
    hypre_ParAMGDataChebyCoefs(amg_data) = NULL;
+   hypre_ParAMGDataChebyPowers(amg_data) = NULL;
+
+   /* K-cycle */
+   hypre_ParAMGDataKCycle(amg_data) = 0;
+   hypre_ParAMGDataKCycleNumIter(amg_data) = 2;
+   hypre_ParAMGDataKCycleSolvers(amg_data) = NULL;
 
    /* BM Oct 22, 2006 */
    hypre_ParAMGDataPlotGrids(amg_data) = 0;
@@ -496,9 +515,17 @@ hypre_BoomerAMGCreate( void )
 
    hypre_ParAMGDataNonGalerkinTol(amg_data) = nongalerkin_tol;
    hypre_ParAMGDataNonGalTolArray(amg_data) = NULL;
+   hypre_ParAMGDataNonGalerkinRAP(amg_data) = 0;
 
    hypre_ParAMGDataRAP2(amg_data)              = rap2;
    hypre_ParAMGDataKeepTranspose(amg_data)     = keepT;
+   hypre_ParAMGDataCompressIndices(amg_data)   = 0;
+   hypre_ParAMGDataPersistentComm(amg_data)    = 0;
+   hypre_ParAMGDataMergedLayout(amg_data)      = 0;
+   hypre_ParAMGDataSmoothAggNumLevels(amg_data) = 0;
+   hypre_ParAMGDataSetupTimings(amg_data)      = 0;
+   hypre_ParAMGDataMemoryBudget(amg_data)      = 0.0;
+   hypre_ParAMGDataMemoryAdapt(amg_data)       = NULL;
    hypre_ParAMGDataModularizedMatMat(amg_data) = modu_rap;
 
    /* information for preserving indices as coarse grid points */
@@ -563,6 +590,7 @@ hypre_BoomerAMGDestroy( void *data )
          hypre_TFree(hypre_ParAMGDataMinEigEst(amg_data), HYPRE_MEMORY_HOST);
          hypre_ParAMGDataMinEigEst(amg_data) = NULL;
       }
+      hypre_TFree(hypre_ParAMGDataMemoryAdapt(amg_data), HYPRE_MEMORY_HOST);
       if (hypre_ParAMGDataNumGridSweeps(amg_data))
       {
          hypre_TFree(hypre_ParAMGDataNumGridSweeps(amg_data), HYPRE_MEMORY_HOST);
@@ -610,6 +638,22 @@ hypre_BoomerAMGDestroy( void *data )
          hypre_IntArrayDestroy(hypre_ParAMGDataDofFunc(amg_data));
          hypre_ParAMGDataDofFunc(amg_data) = NULL;
       }
+      /* the fine-grid matrix belongs to the user: drop what setup attached to it */
+      if (hypre_ParAMGDataAArray(amg_data) && hypre_ParAMGDataAArray(amg_data)[0])
+      {
+         hypre_ParCSRMatrix *A = hypre_ParAMGDataAArray(amg_data)[0];
+
+         if (hypre_ParAMGDataCompressIndices(amg_data))
+         {
+            hypre_CSRMatrixUncompressIndices(hypre_ParCSRMatrixDiag(A));
+         }
+         if (hypre_ParAMGDataPersistentComm(amg_data) && hypre_ParCSRMatrixCommPkg(A))
+         {
+            hypre_ParCSRCommPkgDestroyPersistentCommHandles(hypre_ParCSRMatrixCommPkg(A));
+         }
+         hypre_ParCSRMatrixDestroyMergedLayout(A);
+      }
+
       for (i = 1; i < num_levels; i++)
       {
          hypre_ParVectorDestroy(hypre_ParAMGDataFArray(amg_data)[i]);
@@ -678,6 +722,10 @@ hypre_BoomerAMGDestroy( void *data )
       hypre_ParVectorDestroy(hypre_ParAMGDataXtilde(amg_data));
       hypre_ParVectorDestroy(hypre_ParAMGDataRtilde(amg_data));
 
+      hypre_ParCSRMatrixDestroy(hypre_ParAMGDataRhat(amg_data));
+      hypre_ParVectorDestroy(hypre_ParAMGDataRhatR(amg_data));
+      hypre_ParVectorDestroy(hypre_ParAMGDataRhatX(amg_data));
+
       if (hypre_ParAMGDataL1Norms(amg_data))
       {
          for (i = 0; i < num_levels; i++)
@@ -708,6 +756,17 @@ hypre_BoomerAMGDestroy( void *data )
          hypre_TFree(hypre_ParAMGDataChebyDS(amg_data), HYPRE_MEMORY_HOST);
       }
 
+      if (hypre_ParAMGDataChebyPowers(amg_data))
+      {
+         for (i = 0; i < num_levels; i++)
+         {
+            hypre_ParCSRMatPowersDestroy(hypre_ParAMGDataChebyPowers(amg_data)[i]);
+         }
+         hypre_TFree(hypre_ParAMGDataChebyPowers(amg_data), HYPRE_MEMORY_HOST);
+      }
+
+      hypre_BoomerAMGKCycleDestroy(amg_data, num_levels);
+
       hypre_TFree(hypre_ParAMGDataDinv(amg_data), HYPRE_MEMORY_HOST);
 
       /* get rid of a fine level block matrix */
@@ -1221,6 +1280,46 @@ hypre_BoomerAMGGetCoarsenCutFactor( void       *data,
    return hypre_error_flag;
 }
 
+HYPRE_Int
+hypre_BoomerAMGSetCoarsenThreadBlocks( void       *data,
+                                       HYPRE_Int   coarsen_thread_blocks )
+{
+   hypre_ParAMGData  *amg_data = (hypre_ParAMGData*) data;
+
+   if (!amg_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   if (coarsen_thread_blocks < 0)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+
+   hypre_ParAMGDataCoarsenThreadBlocks(amg_data) = coarsen_thread_blocks;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_BoomerAMGGetCoarsenThreadBlocks( void       *data,
+                                       HYPRE_Int  *coarsen_thread_blocks )
+{
+   hypre_ParAMGData  *amg_data = (hypre_ParAMGData*) data;
+
+   if (!amg_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   *coarsen_thread_blocks = hypre_ParAMGDataCoarsenThreadBlocks(amg_data);
+
+   return hypre_error_flag;
+}
+
 HYPRE_Int
 hypre_BoomerAMGSetStrongThreshold( void     *data,
                                    HYPRE_Real    strong_threshold )
@@ -1867,6 +1966,84 @@ hypre_BoomerAMGGetFCycle( void      *data,
    return hypre_error_flag;
 }
 
+HYPRE_Int
+hypre_BoomerAMGSetKCycle( void     *data,
+                          HYPRE_Int kcycle )
+{
+   hypre_ParAMGData  *amg_data = (hypre_ParAMGData*) data;
+
+   if (!amg_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+   if (kcycle < 0)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+
+   hypre_ParAMGDataKCycle(amg_data) = kcycle;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_BoomerAMGGetKCycle( void      *data,
+                          HYPRE_Int *kcycle )
+{
+   hypre_ParAMGData  *amg_data = (hypre_ParAMGData*) data;
+
+   if (!amg_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   *kcycle = hypre_ParAMGDataKCycle(amg_data);
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_BoomerAMGSetKCycleNumIter( void     *data,
+                                 HYPRE_Int num_iter )
+{
+   hypre_ParAMGData  *amg_data = (hypre_ParAMGData*) data;
+
+   if (!amg_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+   if (num_iter < 1)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+
+   hypre_ParAMGDataKCycleNumIter(amg_data) = num_iter;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_BoomerAMGGetKCycleNumIter( void      *data,
+                                 HYPRE_Int *num_iter )
+{
+   hypre_ParAMGData  *amg_data = (hypre_ParAMGData*) data;
+
+   if (!amg_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   *num_iter = hypre_ParAMGDataKCycleNumIter(amg_data);
+
+   return hypre_error_flag;
+}
+
 HYPRE_Int
 hypre_BoomerAMGSetConvergeType( void     *data,
                                 HYPRE_Int type  )
@@ -3295,6 +3472,31 @@ hypre_BoomerAMGSetAggNumLevels( void     *data,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * Indicates the number of levels of smoothed aggregation
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGSetSmoothAggNumLevels( void     *data,
+                                      HYPRE_Int       sa_num_levels )
+{
+   hypre_ParAMGData  *amg_data = (hypre_ParAMGData*) data;
+
+   if (!amg_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+   if (sa_num_levels < 0)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+   hypre_ParAMGDataSmoothAggNumLevels(amg_data) = sa_num_levels;
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * Indicates the interpolation used with aggressive coarsening
  *--------------------------------------------------------------------------*/
@@ -4414,6 +4616,21 @@ hypre_BoomerAMGSetChebyScale( void     *data,
 
    return hypre_error_flag;
 }
+HYPRE_Int
+hypre_BoomerAMGSetChebyMatPowers( void     *data,
+                                  HYPRE_Int     cheby_mat_powers)
+{
+   hypre_ParAMGData  *amg_data = (hypre_ParAMGData*) data;
+
+   if (!amg_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+   hypre_ParAMGDataChebyMatPowers(amg_data) = cheby_mat_powers;
+
+   return hypre_error_flag;
+}
 
 
 /*--------------------------------------------------------------------------
@@ -4690,6 +4907,40 @@ hypre_BoomerAMGSetAddLastLvl( void *data,
    return hypre_error_flag;
 }
 
+HYPRE_Int
+hypre_BoomerAMGSetAddComposite( void *data,
+                                HYPRE_Int   add_composite )
+{
+   hypre_ParAMGData  *amg_data = (hypre_ParAMGData*) data;
+
+   if (!amg_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   hypre_ParAMGDataAddComposite(amg_data) = add_composite;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_BoomerAMGGetAddComposite( void *data,
+                                HYPRE_Int *  add_composite )
+{
+   hypre_ParAMGData  *amg_data = (hypre_ParAMGData*) data;
+
+   if (!amg_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   *add_composite = hypre_ParAMGDataAddComposite(amg_data);
+
+   return hypre_error_flag;
+}
+
 HYPRE_Int
 hypre_BoomerAMGSetNonGalerkinTol( void   *data,
                                   HYPRE_Real nongalerkin_tol)
@@ -4778,6 +5029,27 @@ hypre_BoomerAMGSetNonGalerkTol( void   *data,
    return hypre_error_flag;
 }
 
+HYPRE_Int
+hypre_BoomerAMGSetNonGalerkinRAP( void      *data,
+                                  HYPRE_Int  nongalerkin_rap )
+{
+   hypre_ParAMGData *amg_data = (hypre_ParAMGData*) data;
+
+   if (!amg_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+   if (nongalerkin_rap < 0 || nongalerkin_rap > 1)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+
+   hypre_ParAMGDataNonGalerkinRAP(amg_data) = nongalerkin_rap;
+   return hypre_error_flag;
+}
+
 HYPRE_Int
 hypre_BoomerAMGSetRAP2( void      *data,
                         HYPRE_Int  rap2 )
@@ -4809,6 +5081,91 @@ hypre_BoomerAMGSetKeepTranspose( void       *data,
    return hypre_error_flag;
 }
 
+HYPRE_Int
+hypre_BoomerAMGSetCompressIndices( void       *data,
+                                   HYPRE_Int   compress_indices )
+{
+   hypre_ParAMGData *amg_data = (hypre_ParAMGData*) data;
+
+   if (!amg_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+   hypre_ParAMGDataCompressIndices(amg_data) = compress_indices;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_BoomerAMGSetPersistentComm( void       *data,
+                                  HYPRE_Int   persistent_comm )
+{
+   hypre_ParAMGData *amg_data = (hypre_ParAMGData*) data;
+
+   if (!amg_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+   hypre_ParAMGDataPersistentComm(amg_data) = persistent_comm;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_BoomerAMGSetMergedLayout( void       *data,
+                                HYPRE_Int   merged_layout )
+{
+   hypre_ParAMGData *amg_data = (hypre_ParAMGData*) data;
+
+   if (!amg_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+   hypre_ParAMGDataMergedLayout(amg_data) = merged_layout;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_BoomerAMGSetSetupTimings( void       *data,
+                                HYPRE_Int   setup_timings )
+{
+   hypre_ParAMGData *amg_data = (hypre_ParAMGData*) data;
+
+   if (!amg_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+   hypre_ParAMGDataSetupTimings(amg_data) = setup_timings;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_BoomerAMGSetMemoryBudget( void       *data,
+                                HYPRE_Real  memory_budget )
+{
+   hypre_ParAMGData *amg_data = (hypre_ParAMGData*) data;
+
+   if (!amg_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+   if (memory_budget < 0.0)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+   hypre_ParAMGDataMemoryBudget(amg_data) = memory_budget;
+
+   return hypre_error_flag;
+}
+
 #ifdef HYPRE_USING_DSUPERLU
 HYPRE_Int
 hypre_BoomerAMGSetDSLUThreshold( void   *data,
@@ -24,6 +24,7 @@ typedef struct
    HYPRE_Int      max_levels;
    HYPRE_Real     strong_threshold;
    HYPRE_Int      coarsen_cut_factor;
+   HYPRE_Int      coarsen_thread_blocks;
    HYPRE_Real     strong_thresholdR; /* theta for build R: defines strong F neighbors */
    HYPRE_Real     filter_thresholdR; /* theta for filtering R  */
    HYPRE_Real     max_row_sum;
@@ -49,6 +50,7 @@ typedef struct
    HYPRE_Int      is_triangular;
    HYPRE_Int      gmres_switch;
    HYPRE_Int      agg_num_levels;
+   HYPRE_Int      sa_num_levels;
    HYPRE_Int      num_paths;
    HYPRE_Int      post_interp_type;
    HYPRE_Int      num_CR_relax_steps;
@@ -66,6 +68,9 @@ typedef struct
    HYPRE_Int      max_iter;
    HYPRE_Int      min_iter;
    HYPRE_Int      fcycle;
+   HYPRE_Int      kcycle;
+   HYPRE_Int      kcycle_num_iter;
+   HYPRE_Solver  *kcycle_solvers;
    HYPRE_Int      cycle_type;
    HYPRE_Int     *num_grid_sweeps;
    HYPRE_Int     *grid_relax_type;
@@ -161,6 +166,8 @@ typedef struct
    HYPRE_Real           cheby_fraction;
    hypre_Vector       **cheby_ds;
    HYPRE_Real         **cheby_coefs;
+   HYPRE_Int            cheby_mat_powers;
+   hypre_ParCSRMatPowers **cheby_powers;
 
    HYPRE_Real           cum_nnz_AP;
 
@@ -169,6 +176,7 @@ typedef struct
    HYPRE_Real         *nongalerk_tol;
    HYPRE_Real          nongalerkin_tol;
    HYPRE_Real         *nongal_tol_array;
+   HYPRE_Int           nongalerkin_rap;
 
    /* data generated in the solve phase */
    hypre_ParVector   *Vtemp;
@@ -246,11 +254,36 @@ typedef struct
    hypre_ParVector *Xtilde;
    HYPRE_Real *D_inv;
 
+   /* composite restriction to all additive levels - additive AMG */
+   HYPRE_Int      add_composite;
+   HYPRE_Int      add_comp_last_lvl;
+   hypre_ParCSRMatrix *Rhat;
+   hypre_ParVector *Rhat_r;
+   hypre_ParVector *Rhat_x;
+
    /* Use 2 mat-mat-muls instead of triple product*/
    HYPRE_Int rap2;
    HYPRE_Int keepTranspose;
    HYPRE_Int modularized_matmat;
 
+   /* 16-bit column indices for the diag blocks of A_array */
+   HYPRE_Int compress_indices;
+
+   /* persistent halo-exchange handles for A_array, P_array and R_array */
+   HYPRE_Int persistent_comm;
+
+   /* merged diag/offd copies of A_array for the solve phase */
+   HYPRE_Int merged_layout;
+
+   /* per-phase setup times (coarsening, interpolation, RAP, coarse solve) */
+   HYPRE_Int  setup_timings;
+   HYPRE_Real setup_time[4];
+
+   /* memory budget (MB per process) for A_array and P_array, and the
+    * adaptation applied when building each level to stay within it */
+   HYPRE_Real  memory_budget;
+   HYPRE_Int  *memory_adapt;
+
    /* information for preserving indices as coarse grid points */
    HYPRE_Int      num_C_points;
    HYPRE_Int      C_points_coarse_level;
@@ -285,6 +318,7 @@ typedef struct
 #define hypre_ParAMGDataGMRESSwitchR(amg_data)         ((amg_data) -> gmres_switch)
 #define hypre_ParAMGDataMaxLevels(amg_data)            ((amg_data) -> max_levels)
 #define hypre_ParAMGDataCoarsenCutFactor(amg_data)     ((amg_data) -> coarsen_cut_factor)
+#define hypre_ParAMGDataCoarsenThreadBlocks(amg_data)  ((amg_data) -> coarsen_thread_blocks)
 #define hypre_ParAMGDataStrongThreshold(amg_data)      ((amg_data) -> strong_threshold)
 #define hypre_ParAMGDataStrongThresholdR(amg_data)     ((amg_data) -> strong_thresholdR)
 #define hypre_ParAMGDataFilterThresholdR(amg_data)     ((amg_data) -> filter_thresholdR)
@@ -306,6 +340,7 @@ typedef struct
 #define hypre_ParAMGDataAggP12MaxElmts(amg_data)       ((amg_data) -> agg_P12_max_elmts)
 #define hypre_ParAMGDataNumPaths(amg_data)             ((amg_data) -> num_paths)
 #define hypre_ParAMGDataAggNumLevels(amg_data)         ((amg_data) -> agg_num_levels)
+#define hypre_ParAMGDataSmoothAggNumLevels(amg_data)   ((amg_data) -> sa_num_levels)
 #define hypre_ParAMGDataPostInterpType(amg_data)       ((amg_data) -> post_interp_type)
 #define hypre_ParAMGDataNumCRRelaxSteps(amg_data)      ((amg_data) -> num_CR_relax_steps)
 #define hypre_ParAMGDataCRRate(amg_data)               ((amg_data) -> CR_rate)
@@ -325,6 +360,9 @@ typedef struct
 #define hypre_ParAMGDataMinIter(amg_data) ((amg_data)->min_iter)
 #define hypre_ParAMGDataMaxIter(amg_data) ((amg_data)->max_iter)
 #define hypre_ParAMGDataFCycle(amg_data) ((amg_data)->fcycle)
+#define hypre_ParAMGDataKCycle(amg_data) ((amg_data)->kcycle)
+#define hypre_ParAMGDataKCycleNumIter(amg_data) ((amg_data)->kcycle_num_iter)
+#define hypre_ParAMGDataKCycleSolvers(amg_data) ((amg_data)->kcycle_solvers)
 #define hypre_ParAMGDataCycleType(amg_data) ((amg_data)->cycle_type)
 #define hypre_ParAMGDataConvergeType(amg_data) ((amg_data)->converge_type)
 #define hypre_ParAMGDataTol(amg_data) ((amg_data)->tol)
@@ -412,6 +450,8 @@ typedef struct
 #define hypre_ParAMGDataChebyScale(amg_data) ((amg_data)->cheby_scale)
 #define hypre_ParAMGDataChebyDS(amg_data) ((amg_data)->cheby_ds)
 #define hypre_ParAMGDataChebyCoefs(amg_data) ((amg_data)->cheby_coefs)
+#define hypre_ParAMGDataChebyMatPowers(amg_data) ((amg_data)->cheby_mat_powers)
+#define hypre_ParAMGDataChebyPowers(amg_data) ((amg_data)->cheby_powers)
 
 #define hypre_ParAMGDataCumNnzAP(amg_data)   ((amg_data)->cum_nnz_AP)
 
@@ -499,15 +539,28 @@ typedef struct
 #define hypre_ParAMGDataRtilde(amg_data) ((amg_data)->Rtilde)
 #define hypre_ParAMGDataXtilde(amg_data) ((amg_data)->Xtilde)
 #define hypre_ParAMGDataDinv(amg_data) ((amg_data)->D_inv)
+#define hypre_ParAMGDataAddComposite(amg_data) ((amg_data)->add_composite)
+#define hypre_ParAMGDataAddCompLastLvl(amg_data) ((amg_data)->add_comp_last_lvl)
+#define hypre_ParAMGDataRhat(amg_data) ((amg_data)->Rhat)
+#define hypre_ParAMGDataRhatR(amg_data) ((amg_data)->Rhat_r)
+#define hypre_ParAMGDataRhatX(amg_data) ((amg_data)->Rhat_x)
 
 /* non-Galerkin parameters */
 #define hypre_ParAMGDataNonGalerkNumTol(amg_data) ((amg_data)->nongalerk_num_tol)
 #define hypre_ParAMGDataNonGalerkTol(amg_data) ((amg_data)->nongalerk_tol)
 #define hypre_ParAMGDataNonGalerkinTol(amg_data) ((amg_data)->nongalerkin_tol)
 #define hypre_ParAMGDataNonGalTolArray(amg_data) ((amg_data)->nongal_tol_array)
+#define hypre_ParAMGDataNonGalerkinRAP(amg_data) ((amg_data)->nongalerkin_rap)
 
 #define hypre_ParAMGDataRAP2(amg_data) ((amg_data)->rap2)
 #define hypre_ParAMGDataKeepTranspose(amg_data) ((amg_data)->keepTranspose)
+#define hypre_ParAMGDataCompressIndices(amg_data) ((amg_data)->compress_indices)
+#define hypre_ParAMGDataPersistentComm(amg_data) ((amg_data)->persistent_comm)
+#define hypre_ParAMGDataMergedLayout(amg_data) ((amg_data)->merged_layout)
+#define hypre_ParAMGDataSetupTimings(amg_data) ((amg_data)->setup_timings)
+#define hypre_ParAMGDataSetupTime(amg_data, i) ((amg_data)->setup_time[i])
+#define hypre_ParAMGDataMemoryBudget(amg_data) ((amg_data)->memory_budget)
+#define hypre_ParAMGDataMemoryAdapt(amg_data) ((amg_data)->memory_adapt)
 #define hypre_ParAMGDataModularizedMatMat(amg_data) ((amg_data)->modularized_matmat)
 
 /*indices for the dof which will keep coarsening to the coarse level */
@@ -21,6 +21,38 @@
  *
  *****************************************************************************/
 
+/*****************************************************************************
+ * hypre_BoomerAMGCreatePersistentComm
+ *
+ * Attach a persistent handle for job to the comm_pkg of A (see
+ * HYPRE_BoomerAMGSetPersistentComm).  Handles that already exist, e.g., on
+ * the fine-grid matrix after a previous setup, are reused.
+ *****************************************************************************/
+
+static HYPRE_Int hypre_BoomerAMGCreatePersistentComm( hypre_ParCSRMatrix *A,
+                                                      HYPRE_Int           job )
+{
+   hypre_ParCSRCommPkg *comm_pkg;
+
+   if (!A || hypre_GetActualMemLocation(hypre_ParCSRMatrixMemoryLocation(A)) != hypre_MEMORY_HOST)
+   {
+      return hypre_error_flag;
+   }
+
+   if (!hypre_ParCSRMatrixCommPkg(A))
+   {
+      hypre_MatvecCommPkgCreate(A);
+   }
+   comm_pkg = hypre_ParCSRMatrixCommPkg(A);
+
+   if (!hypre_ParCSRCommPkgNodePkg(comm_pkg) && !hypre_ParCSRCommPkgShmPkg(comm_pkg))
+   {
+      hypre_ParCSRCommPkgGetPersistentCommHandle(job, comm_pkg);
+   }
+
+   return hypre_error_flag;
+}
+
 /*****************************************************************************
  * hypre_BoomerAMGSetup
  *****************************************************************************/
@@ -55,6 +87,7 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
    HYPRE_Real           schwarz_relax_wt = 1;
    HYPRE_Real           strong_threshold;
    HYPRE_Int            coarsen_cut_factor;
+   HYPRE_Int            coarsen_thread_blocks;
    HYPRE_Int            useSabs;
    HYPRE_Real           CR_strong_th;
    HYPRE_Real           max_row_sum;
@@ -66,6 +99,7 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
    HYPRE_Int            amg_logging;
    HYPRE_Int            amg_print_level;
    HYPRE_Int            debug_flag;
+   HYPRE_Real          *setup_time = NULL;
    HYPRE_Int            dbg_flg;
    HYPRE_Int            local_num_vars;
    HYPRE_Int            P_max_elmts;
@@ -110,6 +144,7 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
    hypre_Vector       **l1_norms = NULL;
    hypre_Vector       **cheby_ds = NULL;
    HYPRE_Real         **cheby_coefs = NULL;
+   hypre_ParCSRMatPowers **cheby_powers = NULL;
 
    HYPRE_Int       old_num_levels, num_levels;
    HYPRE_Int       level;
@@ -139,6 +174,17 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
    HYPRE_Int       num_paths = hypre_ParAMGDataNumPaths(amg_data);
    HYPRE_Int       agg_num_levels = hypre_ParAMGDataAggNumLevels(amg_data);
    HYPRE_Int       agg_interp_type = hypre_ParAMGDataAggInterpType(amg_data);
+   HYPRE_Int       sa_num_levels = hypre_ParAMGDataSmoothAggNumLevels(amg_data);
+   HYPRE_Int       sa_num_vectors = 0;
+   HYPRE_Int       sa_num_aggregates = 0;
+   HYPRE_Real     *sa_B = NULL;
+   HYPRE_Real     *sa_B_coarse = NULL;
+   /* memory budget: bytes used so far and the adaptation in effect */
+   HYPRE_Real      memory_budget = hypre_ParAMGDataMemoryBudget(amg_data);
+   HYPRE_Int      *memory_adapt = NULL;
+   HYPRE_Int       mem_adapt = 0;
+   HYPRE_Real      mem_used = 0.0;
+   hypre_IntArray *sa_aggregates = NULL;
    HYPRE_Int       sep_weight = hypre_ParAMGDataSepWeight(amg_data);
    hypre_IntArray *coarse_dof_func = NULL;
    HYPRE_BigInt    coarse_pnts_global[2];
@@ -198,6 +244,7 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
    HYPRE_Real *nongalerk_tol = hypre_ParAMGDataNonGalerkTol (amg_data);
    HYPRE_Real nongalerk_tol_l = 0.0;
    HYPRE_Real *nongal_tol_array = hypre_ParAMGDataNonGalTolArray (amg_data);
+   HYPRE_Int nongalerkin_rap = hypre_ParAMGDataNonGalerkinRAP (amg_data);
 
    hypre_ParCSRBlockMatrix *A_H_block;
 
@@ -332,6 +379,19 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
 
    HYPRE_ANNOTATE_FUNC_BEGIN;
 
+   /* Per-phase times, accumulated over all levels */
+   if (hypre_ParAMGDataSetupTimings(amg_data))
+   {
+      setup_time = &hypre_ParAMGDataSetupTime(amg_data, 0);
+      for (j = 0; j < 4; j++)
+      {
+         setup_time[j] = 0.0;
+      }
+   }
+
+   /* A merged copy from a previous setup may be stale; it is rebuilt below */
+   hypre_ParCSRMatrixDestroyMergedLayout(A);
+
    /* change in definition of standard and multipass interpolation, by
       eliminating interp_type 9 and 5 and setting sep_weight instead
       when using separation of weights option */
@@ -346,6 +406,15 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
       sep_weight = 1;
    }
 
+   /* With smoothed aggregation, the interpolation vectors are part of the
+      near-nullspace and are not used to expand the interpolation */
+   if (sa_num_levels > 0 && interp_vec_variant > 0)
+   {
+      interp_vec_variant = 0;
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                        "WARNING: Ignoring HYPRE_BoomerAMGSetInterpVecVariant because smoothed aggregation has been specified via HYPRE_BoomerAMGSetSmoothAggNumLevels.\n");
+   }
+
    /* Verify that if the user has selected the interp_vec_variant > 0
       (so GM or LN interpolation) then they have nodal coarsening
       selected also */
@@ -411,6 +480,13 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
 
    hypre_ParAMGDataBlockMode(amg_data) = block_mode;
 
+   if (sa_num_levels > 0 && block_mode)
+   {
+      sa_num_levels = 0;
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                        "WARNING: Smoothed aggregation is not available in block mode and has been turned off.\n");
+   }
+
 
    /* end of systems checks */
 
@@ -513,6 +589,16 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
          hypre_ParAMGDataFCoarse(amg_data) = NULL;
       }
 
+      if (hypre_ParAMGDataRhat(amg_data))
+      {
+         hypre_ParCSRMatrixDestroy(hypre_ParAMGDataRhat(amg_data));
+         hypre_ParVectorDestroy(hypre_ParAMGDataRhatR(amg_data));
+         hypre_ParVectorDestroy(hypre_ParAMGDataRhatX(amg_data));
+         hypre_ParAMGDataRhat(amg_data)  = NULL;
+         hypre_ParAMGDataRhatR(amg_data) = NULL;
+         hypre_ParAMGDataRhatX(amg_data) = NULL;
+      }
+
       hypre_TFree(hypre_ParAMGDataAMat(amg_data), HYPRE_MEMORY_HOST);
       hypre_TFree(hypre_ParAMGDataAInv(amg_data), HYPRE_MEMORY_HOST);
       hypre_TFree(hypre_ParAMGDataBVec(amg_data), HYPRE_MEMORY_HOST);
@@ -551,6 +637,17 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
          hypre_TFree(hypre_ParAMGDataChebyCoefs(amg_data), HYPRE_MEMORY_HOST);
       }
 
+      if (hypre_ParAMGDataChebyPowers(amg_data))
+      {
+         for (i = 0; i < old_num_levels; i++)
+         {
+            hypre_ParCSRMatPowersDestroy(hypre_ParAMGDataChebyPowers(amg_data)[i]);
+         }
+         hypre_TFree(hypre_ParAMGDataChebyPowers(amg_data), HYPRE_MEMORY_HOST);
+      }
+
+      hypre_BoomerAMGKCycleDestroy(amg_data, old_num_levels);
+
       if (hypre_ParAMGDataL1Norms(amg_data))
       {
          for (i = 0; i < old_num_levels; i++)
@@ -931,6 +1028,15 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
 
    not_finished_coarsening = 1;
    level = 0;
+
+   hypre_TFree(hypre_ParAMGDataMemoryAdapt(amg_data), HYPRE_MEMORY_HOST);
+   hypre_ParAMGDataMemoryAdapt(amg_data) = NULL;
+   if (memory_budget > 0.0 && !block_mode)
+   {
+      memory_adapt = hypre_CTAlloc(HYPRE_Int, max_levels, HYPRE_MEMORY_HOST);
+      hypre_ParAMGDataMemoryAdapt(amg_data) = memory_adapt;
+      mem_used = hypre_BoomerAMGMatrixMemory(A_array[0]);
+   }
    HYPRE_ANNOTATE_MGLEVEL_BEGIN(level);
 
 #if defined (HYPRE_USING_NVTX) || defined (HYPRE_USING_ROCTX)
@@ -940,6 +1046,7 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
 
    strong_threshold = hypre_ParAMGDataStrongThreshold(amg_data);
    coarsen_cut_factor = hypre_ParAMGDataCoarsenCutFactor(amg_data);
+   coarsen_thread_blocks = hypre_ParAMGDataCoarsenThreadBlocks(amg_data);
    useSabs = hypre_ParAMGDataSabs(amg_data);
    CR_strong_th = hypre_ParAMGDataCRStrongTh(amg_data);
    max_row_sum = hypre_ParAMGDataMaxRowSum(amg_data);
@@ -1191,12 +1298,33 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
 
          /**** Do the appropriate coarsening ****/
          HYPRE_ANNOTATE_REGION_BEGIN("%s", "Coarsening");
+         if (setup_time) { setup_time[0] -= hypre_MPI_Wtime(); }
 
-         if (nodal == 0) /* no nodal coarsening */
+         if (level < sa_num_levels) /* smoothed aggregation */
+         {
+            if (!sa_B)
+            {
+               hypre_BoomerAMGSmoothAggNullspace(A_array[level], num_functions, dof_func_data,
+                                                 num_interp_vectors, interp_vectors,
+                                                 &sa_num_vectors, &sa_B);
+            }
+            hypre_BoomerAMGCoarsenAggregates(nodal ? SN : S, num_functions, sa_num_vectors,
+                                             CF_marker_array[level], &sa_aggregates,
+                                             &sa_num_aggregates);
+            if (nodal)
+            {
+               hypre_ParCSRMatrixDestroy(SN);
+               SN = NULL;
+               hypre_ParCSRMatrixDestroy(AN);
+               AN = NULL;
+            }
+         }
+         else if (nodal == 0) /* no nodal coarsening */
          {
             if (coarsen_type == 6)
                hypre_BoomerAMGCoarsenFalgout(S, A_array[level], measure_type,
-                                             coarsen_cut_factor, debug_flag, &(CF_marker_array[level]));
+                                             coarsen_cut_factor, coarsen_thread_blocks, debug_flag,
+                                             &(CF_marker_array[level]));
             else if (coarsen_type == 7)
                hypre_BoomerAMGCoarsen(S, A_array[level], 2,
                                       debug_flag, &(CF_marker_array[level]));
@@ -1208,7 +1336,8 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
                                           debug_flag, &(CF_marker_array[level]));
             else if (coarsen_type == 10)
                hypre_BoomerAMGCoarsenHMIS(S, A_array[level], measure_type,
-                                          coarsen_cut_factor, debug_flag, &(CF_marker_array[level]));
+                                          coarsen_cut_factor, coarsen_thread_blocks, debug_flag,
+                                          &(CF_marker_array[level]));
             else if (coarsen_type == 21 || coarsen_type == 22)
             {
 #ifdef HYPRE_MIXEDINT
@@ -1236,7 +1365,8 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
             else if (coarsen_type)
             {
                hypre_BoomerAMGCoarsenRuge(S, A_array[level], measure_type, coarsen_type,
-                                          coarsen_cut_factor, debug_flag, &(CF_marker_array[level]));
+                                          coarsen_cut_factor, coarsen_thread_blocks, debug_flag,
+                                          &(CF_marker_array[level]));
                /* DEBUG: SAVE CF the splitting
                HYPRE_Int my_id;
                MPI_Comm comm = hypre_ParCSRMatrixComm(A_array[level]);
@@ -1279,7 +1409,7 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
                if (coarsen_type == 10)
                {
                   hypre_BoomerAMGCoarsenHMIS(S2, S2, measure_type + 3, coarsen_cut_factor,
-                                             debug_flag, &CFN_marker);
+                                             coarsen_thread_blocks, debug_flag, &CFN_marker);
                }
                else if (coarsen_type == 8)
                {
@@ -1294,7 +1424,7 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
                else if (coarsen_type == 6)
                {
                   hypre_BoomerAMGCoarsenFalgout(S2, S2, measure_type, coarsen_cut_factor,
-                                                debug_flag, &CFN_marker);
+                                                coarsen_thread_blocks, debug_flag, &CFN_marker);
                }
                else if (coarsen_type == 21 || coarsen_type == 22)
                {
@@ -1308,7 +1438,8 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
                else if (coarsen_type)
                {
                   hypre_BoomerAMGCoarsenRuge(S2, S2, measure_type, coarsen_type,
-                                             coarsen_cut_factor, debug_flag, &CFN_marker);
+                                             coarsen_cut_factor, coarsen_thread_blocks, debug_flag,
+                                             &CFN_marker);
                }
                else
                {
@@ -1322,7 +1453,7 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
          {
             if (coarsen_type == 6)
                hypre_BoomerAMGCoarsenFalgout(SN, SN, measure_type, coarsen_cut_factor,
-                                             debug_flag, &(CF_marker_array[level]));
+                                             coarsen_thread_blocks, debug_flag, &(CF_marker_array[level]));
             else if (coarsen_type == 7)
                hypre_BoomerAMGCoarsen(SN, SN, 2,
                                       debug_flag, &(CF_marker_array[level]));
@@ -1334,13 +1465,14 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
                                           debug_flag, &(CF_marker_array[level]));
             else if (coarsen_type == 10)
                hypre_BoomerAMGCoarsenHMIS(SN, SN, measure_type, coarsen_cut_factor,
-                                          debug_flag, &(CF_marker_array[level]));
+                                          coarsen_thread_blocks, debug_flag, &(CF_marker_array[level]));
             else if (coarsen_type == 21 || coarsen_type == 22)
                hypre_BoomerAMGCoarsenCGCb(SN, SN, measure_type,
                                           coarsen_type, cgc_its, debug_flag, &(CF_marker_array[level]));
             else if (coarsen_type)
                hypre_BoomerAMGCoarsenRuge(SN, SN, measure_type, coarsen_type,
-                                          coarsen_cut_factor, debug_flag, &(CF_marker_array[level]));
+                                          coarsen_cut_factor, coarsen_thread_blocks, debug_flag,
+                                          &(CF_marker_array[level]));
             else
             {
                hypre_BoomerAMGCoarsen(SN, SN, 0, debug_flag, &(CF_marker_array[level]));
@@ -1350,7 +1482,7 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
          {
             if (coarsen_type == 6)
                hypre_BoomerAMGCoarsenFalgout(SN, SN, measure_type, coarsen_cut_factor,
-                                             debug_flag, &CFN_marker);
+                                             coarsen_thread_blocks, debug_flag, &CFN_marker);
             else if (coarsen_type == 7)
             {
                hypre_BoomerAMGCoarsen(SN, SN, 2, debug_flag, &CFN_marker);
@@ -1365,13 +1497,14 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
             }
             else if (coarsen_type == 10)
                hypre_BoomerAMGCoarsenHMIS(SN, SN, measure_type, coarsen_cut_factor,
-                                          debug_flag, &CFN_marker);
+                                          coarsen_thread_blocks, debug_flag, &CFN_marker);
             else if (coarsen_type == 21 || coarsen_type == 22)
                hypre_BoomerAMGCoarsenCGCb(SN, SN, measure_type,
                                           coarsen_type, cgc_its, debug_flag, &CFN_marker);
             else if (coarsen_type)
                hypre_BoomerAMGCoarsenRuge(SN, SN, measure_type, coarsen_type,
-                                          coarsen_cut_factor, debug_flag, &CFN_marker);
+                                          coarsen_cut_factor, coarsen_thread_blocks, debug_flag,
+                                          &CFN_marker);
             else
                hypre_BoomerAMGCoarsen(SN, SN, 0,
                                       debug_flag, &CFN_marker);
@@ -1385,7 +1518,7 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
                if (coarsen_type == 10)
                {
                   hypre_BoomerAMGCoarsenHMIS(S2, S2, measure_type + 3, coarsen_cut_factor,
-                                             debug_flag, &CF2_marker);
+                                             coarsen_thread_blocks, debug_flag, &CF2_marker);
                }
                else if (coarsen_type == 8)
                {
@@ -1400,7 +1533,7 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
                else if (coarsen_type == 6)
                {
                   hypre_BoomerAMGCoarsenFalgout(S2, S2, measure_type, coarsen_cut_factor,
-                                                debug_flag, &CF2_marker);
+                                                coarsen_thread_blocks, debug_flag, &CF2_marker);
                }
                else if (coarsen_type == 21 || coarsen_type == 22)
                {
@@ -1414,7 +1547,8 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
                else if (coarsen_type)
                {
                   hypre_BoomerAMGCoarsenRuge(S2, S2, measure_type, coarsen_type,
-                                             coarsen_cut_factor, debug_flag, &CF2_marker);
+                                             coarsen_cut_factor, coarsen_thread_blocks, debug_flag,
+                                             &CF2_marker);
                }
                else
                {
@@ -1605,9 +1739,14 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
 
          hypre_GpuProfilingPushRange("CheckMinSize");
 
-         if (level >= agg_num_levels)
+         if (level < sa_num_levels || level >= agg_num_levels)
          {
-            if (block_mode)
+            if (level < sa_num_levels)
+            {
+               hypre_BoomerAMGSmoothAggCoarseParms(comm, sa_num_aggregates, sa_num_vectors,
+                                                   &coarse_dof_func, coarse_pnts_global);
+            }
+            else if (block_mode)
             {
                hypre_BoomerAMGCoarseParms(comm,
                                           hypre_CSRMatrixNumRows(hypre_ParCSRMatrixDiag(AN)),
@@ -1626,8 +1765,9 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
             hypre_MPI_Bcast(&coarse_size, 1, HYPRE_MPI_BIG_INT, num_procs - 1, comm);
 
             /* if no coarse-grid, stop coarsening, and set the
-             * coarsest solve to be a single sweep of default smoother or smoother set by user */
-            if ((coarse_size == 0) || (coarse_size == fine_size))
+             * coarsest solve to be a single sweep of default smoother or smoother set by user;
+             * with several vectors per aggregate the coarse grid may even be larger */
+            if ((coarse_size == 0) || (coarse_size >= fine_size))
             {
                HYPRE_Int *num_grid_sweeps = hypre_ParAMGDataNumGridSweeps(amg_data);
                HYPRE_Int **grid_relax_points = hypre_ParAMGDataGridRelaxPoints(amg_data);
@@ -1665,7 +1805,11 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
                   coarse_dof_func = NULL;
                }
 
+               hypre_IntArrayDestroy(sa_aggregates);
+               sa_aggregates = NULL;
+
                HYPRE_ANNOTATE_REGION_END("%s", "Coarsening");
+               if (setup_time) { setup_time[0] += hypre_MPI_Wtime(); }
                break;
             }
 
@@ -1674,11 +1818,13 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
                if (S) { hypre_ParCSRMatrixDestroy(S); }
                if (SN) { hypre_ParCSRMatrixDestroy(SN); }
                if (AN) { hypre_ParCSRMatrixDestroy(AN); }
-               if (num_functions > 1)
+               if (coarse_dof_func)
                {
                   hypre_IntArrayDestroy(coarse_dof_func);
                   coarse_dof_func = NULL;
                }
+               hypre_IntArrayDestroy(sa_aggregates);
+               sa_aggregates = NULL;
                hypre_IntArrayDestroy(CF_marker_array[level]);
                CF_marker_array[level] = NULL;
                if (level > 0)
@@ -1695,6 +1841,7 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
                }
 
                HYPRE_ANNOTATE_REGION_END("%s", "Coarsening");
+               if (setup_time) { setup_time[0] += hypre_MPI_Wtime(); }
                break;
             }
          }
@@ -1703,9 +1850,24 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
 
          /*****xxxxxxxxxxxxx changes for min_coarse_size  end */
          HYPRE_ANNOTATE_REGION_END("%s", "Coarsening");
+         if (setup_time) { setup_time[0] += hypre_MPI_Wtime(); }
          HYPRE_ANNOTATE_REGION_BEGIN("%s", "Interpolation");
+         if (setup_time) { setup_time[1] -= hypre_MPI_Wtime(); }
 
-         if (level < agg_num_levels)
+         if (level < sa_num_levels)
+         {
+            hypre_BoomerAMGBuildSmoothAggInterp(A_array[level], sa_aggregates, num_functions,
+                                                sa_num_vectors, sa_B, coarse_pnts_global,
+                                                trunc_factor, P_max_elmts, &sa_B_coarse, &P);
+            hypre_IntArrayDestroy(sa_aggregates);
+            sa_aggregates = NULL;
+            hypre_TFree(sa_B, HYPRE_MEMORY_HOST);
+            sa_B = sa_B_coarse;
+
+            /* the coarse level has one unknown per vector and aggregate */
+            num_functions = sa_num_vectors;
+         }
+         else if (level < agg_num_levels)
          {
             if (nodal == 0)
             {
@@ -2459,6 +2621,7 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
          }
 
          HYPRE_ANNOTATE_REGION_END("%s", "Interpolation");
+         if (setup_time) { setup_time[1] += hypre_MPI_Wtime(); }
       } /* end of if max_levels > 1 */
 
       /* if no coarse-grid, stop coarsening, and set the
@@ -2729,6 +2892,7 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
             }
 
             HYPRE_ANNOTATE_REGION_BEGIN("%s", "RAP");
+            if (setup_time) { setup_time[2] -= hypre_MPI_Wtime(); }
             if (ns == 1)
             {
                hypre_ParCSRMatrix *Q = NULL;
@@ -2887,6 +3051,7 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
                hypre_ParCSRMatrixDestroy(C);
             } /* if (ns == 1) */
             HYPRE_ANNOTATE_REGION_END("%s", "RAP");
+            if (setup_time) { setup_time[2] += hypre_MPI_Wtime(); }
 
             if (add_P_max_elmts || add_trunc_factor)
             {
@@ -2928,6 +3093,7 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
        *--------------------------------------------------------------*/
 
       HYPRE_ANNOTATE_REGION_BEGIN("%s", "RAP");
+      if (setup_time) { setup_time[2] -= hypre_MPI_Wtime(); }
       if (debug_flag == 1) { wall_time = time_getWallclockSeconds(); }
 
       if (block_mode)
@@ -2951,8 +3117,21 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
          {
             nongalerk_tol_l = nongal_tol_array[level];
          }
+         if (mem_adapt > 2)
+         {
+            nongalerk_tol_l = hypre_max(nongalerk_tol_l, 0.05);
+         }
 
-         if (nongalerk_tol_l > 0.0)
+         if (nongalerk_tol_l > 0.0 && nongalerkin_rap &&
+             hypre_GetExecPolicy1(memory_location) == HYPRE_EXEC_HOST)
+         {
+            /* Sparsify RAP row by row inside the triple product */
+            hypre_BoomerAMGBuildCoarseOperatorDropKT(P_array[level], A_array[level],
+                                                     P_array[level], keepTranspose,
+                                                     hypre_IntArrayData(CF_marker_array[level]),
+                                                     nongalerk_tol_l, &A_H);
+         }
+         else if (nongalerk_tol_l > 0.0)
          {
             /* Construct AP, and then RAP */
             hypre_ParCSRMatrix *Q = NULL;
@@ -3061,6 +3240,7 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
 #endif
 
       HYPRE_ANNOTATE_REGION_END("%s", "RAP");
+      if (setup_time) { setup_time[2] += hypre_MPI_Wtime(); }
       if (debug_flag == 1)
       {
          wall_time = time_getWallclockSeconds() - wall_time;
@@ -3099,6 +3279,47 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
          A_array[level] = A_H;
       }
 
+      /* Project the memory of the hierarchy from the growth of the operators
+       * so far, and adapt the next levels while it exceeds the budget.  The
+       * budget is per process, so every process projects its own memory from
+       * its own growth, and the largest projection decides on all of them. */
+      if (memory_adapt)
+      {
+         HYPRE_Real mem_A, mem_A_H, mem_P, mem_ratio, mem_projected, mem_max;
+
+         mem_A   = hypre_BoomerAMGMatrixMemory(A_array[level - 1]);
+         mem_A_H = hypre_BoomerAMGMatrixMemory(A_H);
+         mem_P   = hypre_BoomerAMGMatrixMemory(P_array[level - 1]);
+         mem_used += mem_A_H + mem_P;
+
+         mem_projected = mem_used;
+         if (mem_A > 0.0)
+         {
+            mem_ratio = hypre_min(mem_A_H / mem_A, 0.9);
+            mem_projected += mem_A_H * (1.0 + mem_P / mem_A) * mem_ratio / (1.0 - mem_ratio);
+         }
+         hypre_MPI_Allreduce(&mem_projected, &mem_max, 1, HYPRE_MPI_REAL, hypre_MPI_MAX, comm);
+
+         if (mem_max > memory_budget * 1048576.0 && mem_adapt < 3)
+         {
+            mem_adapt++;
+            if (mem_adapt == 1)
+            {
+               /* truncate interpolation harder */
+               P_max_elmts       = (P_max_elmts > 0)       ? hypre_min(P_max_elmts, 3) : 3;
+               agg_P_max_elmts   = (agg_P_max_elmts > 0)   ? hypre_min(agg_P_max_elmts, 3) : 3;
+               agg_P12_max_elmts = (agg_P12_max_elmts > 0) ? hypre_min(agg_P12_max_elmts, 3) : 3;
+            }
+            else if (mem_adapt == 2)
+            {
+               /* aggressive coarsening from now on */
+               agg_num_levels = hypre_max(agg_num_levels, max_levels);
+            }
+            /* mem_adapt == 3: non-Galerkin coarse-grid operators, see above */
+         }
+         memory_adapt[level] = mem_adapt;
+      }
+
       size = ((HYPRE_Real) fine_size ) * .75;
       if (coarsen_type > 0 && coarse_size >= (HYPRE_BigInt) size)
       {
@@ -3117,7 +3338,10 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
       }
    }  /* end of coarsening loop: while (not_finished_coarsening) */
 
+   hypre_TFree(sa_B, HYPRE_MEMORY_HOST);
+
    HYPRE_ANNOTATE_REGION_BEGIN("%s", "Coarse solve");
+   if (setup_time) { setup_time[3] -= hypre_MPI_Wtime(); }
 
    /* redundant coarse grid solve */
    if ((seq_threshold >= coarse_threshold) &&
@@ -3158,6 +3382,7 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
       }
    }
    HYPRE_ANNOTATE_REGION_END("%s", "Coarse solve");
+   if (setup_time) { setup_time[3] += hypre_MPI_Wtime(); }
    HYPRE_ANNOTATE_MGLEVEL_END(level);
 #if defined (HYPRE_USING_NVTX) || defined (HYPRE_USING_ROCTX)
    hypre_GpuProfilingPopRange();
@@ -3242,6 +3467,11 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
       cheby_coefs = hypre_CTAlloc(HYPRE_Real *, num_levels, HYPRE_MEMORY_HOST);
       hypre_ParAMGDataChebyDS(amg_data) = cheby_ds;
       hypre_ParAMGDataChebyCoefs(amg_data) = cheby_coefs;
+      if (hypre_ParAMGDataChebyMatPowers(amg_data))
+      {
+         cheby_powers = hypre_CTAlloc(hypre_ParCSRMatPowers *, num_levels, HYPRE_MEMORY_HOST);
+         hypre_ParAMGDataChebyPowers(amg_data) = cheby_powers;
+      }
    }
 
    /* CG */
@@ -3486,6 +3716,14 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
                                        &coefs,
                                        &hypre_VectorData(cheby_ds[j]));
          cheby_coefs[j] = coefs;
+
+         /* matrix powers kernel for p(A) of degree >= 2, on the host only */
+         if (cheby_powers && hypre_min(cheby_order, 4) > 2 &&
+             hypre_GetExecPolicy1(hypre_ParCSRMatrixMemoryLocation(A_array[j])) == HYPRE_EXEC_HOST)
+         {
+            cheby_powers[j] = hypre_ParCSRMatPowersCreate(A_array[j], hypre_min(cheby_order, 4) - 1,
+                                                          hypre_VectorData(cheby_ds[j]));
+         }
       }
       else if (grid_relax_type[1] == 15 || (grid_relax_type[3] == 15 && j == (num_levels - 1))  )
       {
@@ -3700,6 +3938,11 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
       hypre_CreateLambda(amg_data);
    }
 
+   if (hypre_ParAMGDataAddComposite(amg_data) && hypre_ParAMGDataXtilde(amg_data))
+   {
+      hypre_CreateAddComposite(amg_data);
+   }
+
    if (cum_nnz_AP > 0.0)
    {
       cum_nnz_AP = hypre_ParCSRMatrixDNumNonzeros(A_array[0]);
@@ -3712,6 +3955,46 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
       hypre_ParAMGDataCumNnzAP(amg_data) = cum_nnz_AP;
    }
 
+   if (hypre_ParAMGDataCompressIndices(amg_data) && !block_mode)
+   {
+      for (j = 0; j < num_levels; j++)
+      {
+         hypre_CSRMatrixCompressIndices(hypre_ParCSRMatrixDiag(A_array[j]));
+      }
+   }
+
+   if (hypre_ParAMGDataMergedLayout(amg_data) && !block_mode)
+   {
+      for (j = 0; j < num_levels; j++)
+      {
+         if (hypre_GetActualMemLocation(hypre_ParCSRMatrixMemoryLocation(A_array[j])) ==
+             hypre_MEMORY_HOST)
+         {
+            hypre_ParCSRMatrixCreateMergedLayout(A_array[j]);
+         }
+      }
+   }
+
+   if (hypre_ParAMGDataPersistentComm(amg_data) && !block_mode)
+   {
+      R_array = hypre_ParAMGDataRArray(amg_data);
+
+      for (j = 0; j < num_levels; j++)
+      {
+         hypre_BoomerAMGCreatePersistentComm(A_array[j], 1);
+         if (j < num_levels - 1)
+         {
+            hypre_BoomerAMGCreatePersistentComm(P_array[j], 1);
+            hypre_BoomerAMGCreatePersistentComm(R_array[j], restri_type ? 1 : 2);
+         }
+      }
+   }
+
+   if (hypre_ParAMGDataKCycle(amg_data))
+   {
+      hypre_BoomerAMGKCycleSetup(amg_data);
+   }
+
    /*-----------------------------------------------------------------------
     * Print some stuff
     *-----------------------------------------------------------------------*/
@@ -3721,6 +4004,22 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
       hypre_BoomerAMGSetupStats(amg_data, A);
    }
 
+   if (setup_time)
+   {
+      HYPRE_Real max_setup_time[4];
+
+      hypre_MPI_Allreduce(setup_time, max_setup_time, 4, HYPRE_MPI_REAL,
+                          hypre_MPI_MAX, comm);
+      if (my_id == 0)
+      {
+         hypre_printf("\nBoomerAMG setup phase times (max over ranks):\n");
+         hypre_printf("  Coarsening        = %f seconds\n", max_setup_time[0]);
+         hypre_printf("  Interpolation     = %f seconds\n", max_setup_time[1]);
+         hypre_printf("  RAP               = %f seconds\n", max_setup_time[2]);
+         hypre_printf("  Coarse solve      = %f seconds\n\n", max_setup_time[3]);
+      }
+   }
+
    /* print out CF info to plot grids in matlab (see 'tools/AMGgrids.m') */
 
    if (hypre_ParAMGDataPlotGrids(amg_data))
@@ -70,7 +70,7 @@ hypre_BoomerAMGSolve( void               *amg_vdata,
    HYPRE_Real          ieee_check = 0.;
 
    hypre_ParVector    *Vtemp;
-   hypre_ParVector    *Residual;
+   hypre_ParVector    *Residual = NULL;
 
    HYPRE_ANNOTATE_FUNC_BEGIN;
    hypre_MPI_Comm_size(comm, &num_procs);
@@ -146,23 +146,36 @@ hypre_BoomerAMGSolve( void               *amg_vdata,
 
    if (amg_print_level > 1 || amg_logging > 1 || tol > 0.)
    {
+      /* the residual and its norm are computed in a single pass */
       if ( amg_logging > 1 )
       {
-         hypre_ParVectorCopy(F_array[0], Residual );
          if (tol > 0)
          {
-            hypre_ParCSRMatrixMatvec(alpha, A_array[0], U_array[0], beta, Residual);
+            hypre_ParCSRMatrixMatvecOutOfPlaceInnerProd(alpha, A_array[0], U_array[0], beta,
+                                                        F_array[0], Residual, NULL,
+                                                        &resid_nrm, NULL);
          }
-         resid_nrm = sqrt(hypre_ParVectorInnerProd( Residual, Residual ));
+         else
+         {
+            hypre_ParVectorCopy(F_array[0], Residual );
+            resid_nrm = hypre_ParVectorInnerProd( Residual, Residual );
+         }
+         resid_nrm = sqrt(resid_nrm);
       }
       else
       {
-         hypre_ParVectorCopy(F_array[0], Vtemp);
          if (tol > 0)
          {
-            hypre_ParCSRMatrixMatvec(alpha, A_array[0], U_array[0], beta, Vtemp);
+            hypre_ParCSRMatrixMatvecOutOfPlaceInnerProd(alpha, A_array[0], U_array[0], beta,
+                                                        F_array[0], Vtemp, NULL,
+                                                        &resid_nrm, NULL);
+         }
+         else
+         {
+            hypre_ParVectorCopy(F_array[0], Vtemp);
+            resid_nrm = hypre_ParVectorInnerProd(Vtemp, Vtemp);
          }
-         resid_nrm = sqrt(hypre_ParVectorInnerProd(Vtemp, Vtemp));
+         resid_nrm = sqrt(resid_nrm);
       }
 
       /* Since it is does not diminish performance, attempt to return an error flag
@@ -259,14 +272,17 @@ hypre_BoomerAMGSolve( void               *amg_vdata,
 
          if ( amg_logging > 1 )
          {
-            hypre_ParCSRMatrixMatvecOutOfPlace(alpha, A_array[0], U_array[0], beta, F_array[0], Residual );
-            resid_nrm = sqrt(hypre_ParVectorInnerProd( Residual, Residual ));
+            hypre_ParCSRMatrixMatvecOutOfPlaceInnerProd(alpha, A_array[0], U_array[0], beta,
+                                                        F_array[0], Residual, NULL,
+                                                        &resid_nrm, NULL);
          }
          else
          {
-            hypre_ParCSRMatrixMatvecOutOfPlace(alpha, A_array[0], U_array[0], beta, F_array[0], Vtemp);
-            resid_nrm = sqrt(hypre_ParVectorInnerProd(Vtemp, Vtemp));
+            hypre_ParCSRMatrixMatvecOutOfPlaceInnerProd(alpha, A_array[0], U_array[0], beta,
+                                                        F_array[0], Vtemp, NULL,
+                                                        &resid_nrm, NULL);
          }
+         resid_nrm = sqrt(resid_nrm);
 
          if (old_resid)
          {
@@ -0,0 +1,475 @@
+/******************************************************************************
+ * Copyright (c) 1998 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Parameter tuning for BoomerAMG
+ *
+ * The tuner runs trial setups and a few V-cycles with a zero right-hand side
+ * and a random initial guess, and estimates the total time of num_solves
+ * solves to the tolerance of the solver as
+ *
+ *    setup time + num_solves * (cycle time) * log(tol) / log(rho),
+ *
+ * where rho is the measured asymptotic convergence factor.  The parameter
+ * space is searched one group of parameters at a time, starting from the
+ * settings of the solver: coarsening and interpolation, strength threshold,
+ * interpolation truncation and smoother.  All decisions are based on global
+ * quantities, so every rank selects the same configuration.  The settings of
+ * the solver are run once untimed first, since the first setup and cycles
+ * pay for page faults, memory pools and MPI connections that would otherwise
+ * be charged to the first trial only.
+ *
+ *****************************************************************************/
+
+#include "_hypre_parcsr_ls.h"
+#include "par_amg.h"
+
+#define HYPRE_AMG_TUNE_WARMUP_CYCLES 2
+#define HYPRE_AMG_TUNE_TRIAL_CYCLES  5
+/* reduction per solve assumed when BoomerAMG is used as a preconditioner */
+#define HYPRE_AMG_TUNE_PRECOND_TOL   1.0e-6
+
+typedef struct
+{
+   HYPRE_Int   coarsen_type;
+   HYPRE_Int   interp_type;
+   HYPRE_Int   agg_num_levels;
+   HYPRE_Int   sa_num_levels;
+   HYPRE_Real  strong_threshold;
+   HYPRE_Int   P_max_elmts;
+   HYPRE_Real  trunc_factor;
+   HYPRE_Int   relax_down;
+   HYPRE_Int   relax_up;
+
+   /* measured and estimated quantities */
+   HYPRE_Real  setup_time;
+   HYPRE_Real  cycle_time;
+   HYPRE_Real  conv_factor;
+   HYPRE_Real  total_time;
+
+} hypre_AMGTuneParams;
+
+/*--------------------------------------------------------------------------
+ * hypre_AMGTuneParamsApply
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_AMGTuneParamsApply( void                *amg_vdata,
+                          hypre_AMGTuneParams *params )
+{
+   hypre_BoomerAMGSetCoarsenType(amg_vdata, params -> coarsen_type);
+   hypre_BoomerAMGSetInterpType(amg_vdata, params -> interp_type);
+   hypre_BoomerAMGSetAggNumLevels(amg_vdata, params -> agg_num_levels);
+   hypre_BoomerAMGSetSmoothAggNumLevels(amg_vdata, params -> sa_num_levels);
+   hypre_BoomerAMGSetStrongThreshold(amg_vdata, params -> strong_threshold);
+   hypre_BoomerAMGSetPMaxElmts(amg_vdata, params -> P_max_elmts);
+   hypre_BoomerAMGSetTruncFactor(amg_vdata, params -> trunc_factor);
+   hypre_BoomerAMGSetCycleRelaxType(amg_vdata, params -> relax_down, 1);
+   hypre_BoomerAMGSetCycleRelaxType(amg_vdata, params -> relax_up, 2);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_AMGTuneParamsEqual
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_AMGTuneParamsEqual( hypre_AMGTuneParams *a,
+                          hypre_AMGTuneParams *b )
+{
+   return (a -> coarsen_type     == b -> coarsen_type     &&
+           a -> interp_type      == b -> interp_type      &&
+           a -> agg_num_levels   == b -> agg_num_levels   &&
+           a -> sa_num_levels    == b -> sa_num_levels    &&
+           a -> strong_threshold == b -> strong_threshold &&
+           a -> P_max_elmts      == b -> P_max_elmts      &&
+           a -> trunc_factor     == b -> trunc_factor     &&
+           a -> relax_down       == b -> relax_down       &&
+           a -> relax_up         == b -> relax_up);
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_AMGTuneTrial
+ *
+ * Sets up the solver with the given parameters, measures the setup time and
+ * the time and convergence factor of the V-cycles, and estimates the total
+ * time.  Times are maxima over all ranks.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_AMGTuneTrial( void                *amg_vdata,
+                    hypre_ParCSRMatrix  *A,
+                    hypre_ParVector     *f,
+                    hypre_ParVector     *u,
+                    hypre_ParVector     *r,
+                    HYPRE_Real           tol,
+                    HYPRE_Int            num_solves,
+                    hypre_AMGTuneParams *params )
+{
+   MPI_Comm    comm = hypre_ParCSRMatrixComm(A);
+   HYPRE_Real  times[2], max_times[2];
+   HYPRE_Real  r_start, r_end, num_cycles;
+
+   hypre_AMGTuneParamsApply(amg_vdata, params);
+
+   hypre_ParVectorSetRandomValues(u, 1);
+
+   hypre_MPI_Barrier(comm);
+   times[0] = -hypre_MPI_Wtime();
+   hypre_BoomerAMGSetup(amg_vdata, A, f, u);
+   times[0] += hypre_MPI_Wtime();
+
+   /* skip the initial transient of the error reduction */
+   hypre_BoomerAMGSetMaxIter(amg_vdata, HYPRE_AMG_TUNE_WARMUP_CYCLES);
+   hypre_BoomerAMGSolve(amg_vdata, A, f, u);
+   hypre_ParVectorCopy(f, r);
+   hypre_ParCSRMatrixMatvec(-1.0, A, u, 1.0, r);
+   r_start = sqrt(hypre_ParVectorInnerProd(r, r));
+
+   hypre_BoomerAMGSetMaxIter(amg_vdata, HYPRE_AMG_TUNE_TRIAL_CYCLES);
+   hypre_MPI_Barrier(comm);
+   times[1] = -hypre_MPI_Wtime();
+   hypre_BoomerAMGSolve(amg_vdata, A, f, u);
+   times[1] += hypre_MPI_Wtime();
+   hypre_ParVectorCopy(f, r);
+   hypre_ParCSRMatrixMatvec(-1.0, A, u, 1.0, r);
+   r_end = sqrt(hypre_ParVectorInnerProd(r, r));
+
+   hypre_MPI_Allreduce(times, max_times, 2, HYPRE_MPI_REAL, hypre_MPI_MAX, comm);
+
+   params -> setup_time = max_times[0];
+   params -> cycle_time = max_times[1] / HYPRE_AMG_TUNE_TRIAL_CYCLES;
+
+   if (r_start > 0.0)
+   {
+      params -> conv_factor = pow(r_end / r_start, 1.0 / HYPRE_AMG_TUNE_TRIAL_CYCLES);
+   }
+   else
+   {
+      params -> conv_factor = 0.0;
+   }
+
+   if (params -> conv_factor >= 1.0 || params -> conv_factor != params -> conv_factor)
+   {
+      params -> total_time = HYPRE_REAL_MAX;
+   }
+   else
+   {
+      num_cycles = 1.0;
+      if (params -> conv_factor > 0.0 && tol > 0.0 && tol < 1.0)
+      {
+         num_cycles = hypre_max(1.0, ceil(log(tol) / log(params -> conv_factor)));
+      }
+      params -> total_time = params -> setup_time +
+                             num_solves * num_cycles * params -> cycle_time;
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_AMGTuneParamsPrint
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_AMGTuneParamsPrint( FILE                *fp,
+                          hypre_AMGTuneParams *params )
+{
+   hypre_fprintf(fp, " %6d %6d %4d %4d %6.2f %4d %6.2f %4d %4d   %10.3e %10.3e %7.4f %10.3e\n",
+                 params -> coarsen_type, params -> interp_type,
+                 params -> agg_num_levels, params -> sa_num_levels,
+                 params -> strong_threshold, params -> P_max_elmts,
+                 params -> trunc_factor, params -> relax_down, params -> relax_up,
+                 params -> setup_time, params -> cycle_time, params -> conv_factor,
+                 params -> total_time);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGTune
+ *
+ * Selects the parameters within a time budget (in seconds, 0 for no limit)
+ * for num_solves solves with the matrix A, applies them to the solver, and
+ * writes them to filename if it is not NULL.  The trial hierarchy is left in
+ * place, so the solver has to be set up again before it is used.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGTune( void               *amg_vdata,
+                     hypre_ParCSRMatrix *A,
+                     HYPRE_Real          time_budget,
+                     HYPRE_Int           num_solves,
+                     const char         *filename )
+{
+   hypre_ParAMGData    *amg_data = (hypre_ParAMGData*) amg_vdata;
+   MPI_Comm             comm;
+   HYPRE_Int            my_id;
+
+   /* candidate values, one group of parameters at a time */
+   const HYPRE_Int      coarsen_cands[][4] = { {10, 6, 0, 0}, {8, 6, 0, 0}, {6, 0, 0, 0},
+      {10, 6, 1, 0}, {10, 6, 0, -1}
+   };
+   const HYPRE_Real     strong_cands[]     = { 0.25, 0.5 };
+   const HYPRE_Int      pmx_cands[]        = { 4, 6, 0 };
+   const HYPRE_Real     trunc_cands[]      = { 0.0, 0.0, 0.1 };
+   const HYPRE_Int      relax_cands[][2]   = { {13, 14}, {8, 8}, {18, 18} };
+   HYPRE_Int            num_cands[4] = { 5, 2, 3, 3 };
+
+   hypre_AMGTuneParams  best, trial;
+   hypre_ParVector     *f, *u, *r;
+   HYPRE_Int           *grid_relax_type;
+   HYPRE_Int            max_iter, print_level, logging;
+   HYPRE_Real           tol, target_tol, start_time, elapsed;
+   HYPRE_Int            group, c, num_trials = 0;
+   FILE                *fp;
+
+   if (!amg_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+   if (!A)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+   if (num_solves < 1)
+   {
+      hypre_error_in_arg(4);
+      return hypre_error_flag;
+   }
+
+   comm = hypre_ParCSRMatrixComm(A);
+   hypre_MPI_Comm_rank(comm, &my_id);
+   start_time = hypre_MPI_Wtime();
+
+   /* the tuned settings; the solver settings are the first trial */
+   grid_relax_type = hypre_ParAMGDataGridRelaxType(amg_data);
+
+   best.coarsen_type     = hypre_ParAMGDataCoarsenType(amg_data);
+   best.interp_type      = hypre_ParAMGDataInterpType(amg_data);
+   best.agg_num_levels   = hypre_ParAMGDataAggNumLevels(amg_data);
+   best.sa_num_levels    = hypre_ParAMGDataSmoothAggNumLevels(amg_data);
+   best.strong_threshold = hypre_ParAMGDataStrongThreshold(amg_data);
+   best.P_max_elmts      = hypre_ParAMGDataPMaxElmts(amg_data);
+   best.trunc_factor     = hypre_ParAMGDataTruncFactor(amg_data);
+   best.relax_down       = grid_relax_type[1];
+   best.relax_up         = grid_relax_type[2];
+
+   /* settings changed for the trials */
+   max_iter    = hypre_ParAMGDataMaxIter(amg_data);
+   tol         = hypre_ParAMGDataTol(amg_data);
+   print_level = hypre_ParAMGDataPrintLevel(amg_data);
+   logging     = hypre_ParAMGDataLogging(amg_data);
+   target_tol  = (tol > 0.0) ? tol : HYPRE_AMG_TUNE_PRECOND_TOL;
+   hypre_BoomerAMGSetTol(amg_vdata, 0.0);
+   hypre_BoomerAMGSetPrintLevel(amg_vdata, 0);
+   hypre_BoomerAMGSetLogging(amg_vdata, 0);
+
+   f = hypre_ParVectorCreate(comm, hypre_ParCSRMatrixGlobalNumRows(A),
+                             hypre_ParCSRMatrixRowStarts(A));
+   u = hypre_ParVectorCreate(comm, hypre_ParCSRMatrixGlobalNumRows(A),
+                             hypre_ParCSRMatrixRowStarts(A));
+   r = hypre_ParVectorCreate(comm, hypre_ParCSRMatrixGlobalNumRows(A),
+                             hypre_ParCSRMatrixRowStarts(A));
+   hypre_ParVectorInitialize(f);
+   hypre_ParVectorInitialize(u);
+   hypre_ParVectorInitialize(r);
+   hypre_ParVectorSetConstantValues(f, 0.0);
+
+   if (my_id == 0 && print_level > 0)
+   {
+      hypre_printf("\nBoomerAMG tuning for %d solve(s) to relative tolerance %e\n\n",
+                   num_solves, target_tol);
+      hypre_printf(" coarsn interp  agg   sa strong  Pmx  trunc down   up        setup      cycle    rho   est. total\n");
+   }
+
+   /* warm-up, discarded */
+   hypre_AMGTuneTrial(amg_vdata, A, f, u, r, target_tol, num_solves, &best);
+
+   hypre_AMGTuneTrial(amg_vdata, A, f, u, r, target_tol, num_solves, &best);
+   num_trials++;
+   if (my_id == 0 && print_level > 0)
+   {
+      hypre_AMGTuneParamsPrint(stdout, &best);
+   }
+
+   for (group = 0; group < 4; group++)
+   {
+      for (c = 0; c < num_cands[group]; c++)
+      {
+         /* the same decision on all ranks */
+         elapsed = hypre_MPI_Wtime() - start_time;
+         hypre_MPI_Bcast(&elapsed, 1, HYPRE_MPI_REAL, 0, comm);
+         if (time_budget > 0.0 && elapsed >= time_budget)
+         {
+            break;
+         }
+
+         trial = best;
+         if (group == 0)
+         {
+            trial.coarsen_type   = coarsen_cands[c][0];
+            trial.interp_type    = coarsen_cands[c][1];
+            trial.agg_num_levels = coarsen_cands[c][2];
+            trial.sa_num_levels  = (coarsen_cands[c][3] < 0) ?
+                                   hypre_ParAMGDataMaxLevels(amg_data) : 0;
+         }
+         else if (group == 1)
+         {
+            trial.strong_threshold = strong_cands[c];
+         }
+         else if (group == 2)
+         {
+            trial.P_max_elmts  = pmx_cands[c];
+            trial.trunc_factor = trunc_cands[c];
+         }
+         else
+         {
+            trial.relax_down = relax_cands[c][0];
+            trial.relax_up   = relax_cands[c][1];
+         }
+         if (hypre_AMGTuneParamsEqual(&trial, &best))
+         {
+            continue;
+         }
+
+         hypre_AMGTuneTrial(amg_vdata, A, f, u, r, target_tol, num_solves, &trial);
+         num_trials++;
+         if (my_id == 0 && print_level > 0)
+         {
+            hypre_AMGTuneParamsPrint(stdout, &trial);
+         }
+         if (trial.total_time < best.total_time)
+         {
+            best = trial;
+         }
+      }
+   }
+
+   hypre_ParVectorDestroy(f);
+   hypre_ParVectorDestroy(u);
+   hypre_ParVectorDestroy(r);
+
+   /* apply the selected configuration and restore the other settings */
+   hypre_AMGTuneParamsApply(amg_vdata, &best);
+   hypre_BoomerAMGSetMaxIter(amg_vdata, max_iter);
+   hypre_BoomerAMGSetTol(amg_vdata, tol);
+   hypre_BoomerAMGSetPrintLevel(amg_vdata, print_level);
+   hypre_BoomerAMGSetLogging(amg_vdata, logging);
+
+   if (my_id == 0 && print_level > 0)
+   {
+      hypre_printf("\nSelected after %d trials (%.2f s):\n", num_trials,
+                   hypre_MPI_Wtime() - start_time);
+      hypre_AMGTuneParamsPrint(stdout, &best);
+      hypre_printf("\n");
+   }
+
+   if (filename && my_id == 0)
+   {
+      if ((fp = fopen(filename, "w")) == NULL)
+      {
+         hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Error: can't open output file for tuned parameters\n");
+         return hypre_error_flag;
+      }
+      hypre_fprintf(fp, "# BoomerAMG parameters selected by HYPRE_BoomerAMGTune\n");
+      hypre_fprintf(fp, "# setup %e s, cycle %e s, convergence factor %f, estimated total %e s\n",
+                    best.setup_time, best.cycle_time, best.conv_factor, best.total_time);
+      hypre_fprintf(fp, "coarsen_type %d\n", best.coarsen_type);
+      hypre_fprintf(fp, "interp_type %d\n", best.interp_type);
+      hypre_fprintf(fp, "agg_num_levels %d\n", best.agg_num_levels);
+      hypre_fprintf(fp, "smooth_agg_num_levels %d\n", best.sa_num_levels);
+      hypre_fprintf(fp, "strong_threshold %.17g\n", best.strong_threshold);
+      hypre_fprintf(fp, "P_max_elmts %d\n", best.P_max_elmts);
+      hypre_fprintf(fp, "trunc_factor %.17g\n", best.trunc_factor);
+      hypre_fprintf(fp, "relax_down %d\n", best.relax_down);
+      hypre_fprintf(fp, "relax_up %d\n", best.relax_up);
+      fclose(fp);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGReadTunedParams
+ *
+ * Applies parameters written by hypre_BoomerAMGTune.  Lines starting with
+ * '#' and unknown keys are ignored.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGReadTunedParams( void       *amg_vdata,
+                                const char *filename )
+{
+   FILE       *fp;
+   char        line[256], key[64];
+   HYPRE_Real  value;
+
+   if (!amg_vdata)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+   if (!filename || (fp = fopen(filename, "r")) == NULL)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+
+   while (fgets(line, sizeof(line), fp))
+   {
+      if (line[0] == '#' || hypre_sscanf(line, "%63s %le", key, &value) != 2)
+      {
+         continue;
+      }
+
+      if (!strcmp(key, "coarsen_type"))
+      {
+         hypre_BoomerAMGSetCoarsenType(amg_vdata, (HYPRE_Int) value);
+      }
+      else if (!strcmp(key, "interp_type"))
+      {
+         hypre_BoomerAMGSetInterpType(amg_vdata, (HYPRE_Int) value);
+      }
+      else if (!strcmp(key, "agg_num_levels"))
+      {
+         hypre_BoomerAMGSetAggNumLevels(amg_vdata, (HYPRE_Int) value);
+      }
+      else if (!strcmp(key, "smooth_agg_num_levels"))
+      {
+         hypre_BoomerAMGSetSmoothAggNumLevels(amg_vdata, (HYPRE_Int) value);
+      }
+      else if (!strcmp(key, "strong_threshold"))
+      {
+         hypre_BoomerAMGSetStrongThreshold(amg_vdata, value);
+      }
+      else if (!strcmp(key, "P_max_elmts"))
+      {
+         hypre_BoomerAMGSetPMaxElmts(amg_vdata, (HYPRE_Int) value);
+      }
+      else if (!strcmp(key, "trunc_factor"))
+      {
+         hypre_BoomerAMGSetTruncFactor(amg_vdata, value);
+      }
+      else if (!strcmp(key, "relax_down"))
+      {
+         hypre_BoomerAMGSetCycleRelaxType(amg_vdata, (HYPRE_Int) value, 1);
+      }
+      else if (!strcmp(key, "relax_up"))
+      {
+         hypre_BoomerAMGSetCycleRelaxType(amg_vdata, (HYPRE_Int) value, 2);
+      }
+   }
+
+   fclose(fp);
+
+   return hypre_error_flag;
+}
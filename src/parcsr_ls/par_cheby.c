@@ -376,6 +376,96 @@ hypre_ParCSRRelax_Cheby_SolveHost(hypre_ParCSRMatrix *A, /* matrix to relax with
    return hypre_error_flag;
 }
 
+/**
+ * @brief Solve using a chebyshev polynomial and a matrix powers kernel
+ *
+ * Same update as hypre_ParCSRRelax_Cheby_SolveHost, but p(A)r is evaluated
+ * by a matrix powers kernel with a single halo exchange instead of one
+ * exchange per Horner step. The Horner recurrence is the same, but ghost
+ * rows are summed in a different order than on their owning process, so
+ * the results agree with the standard path up to rounding only.
+ *
+ * @param[in] A Matrix to relax with
+ * @param[in] f right-hand side
+ * @param[in] ds_data Diagonal information
+ * @param[in] coefs Polynomial coefficients
+ * @param[in] order Order of the polynomial
+ * @param[in] scale Whether or not to scale by diagonal
+ * @param[in] mp Matrix powers kernel of A, scaled by ds_data if scale
+ * @param[in,out] u Initial/updated approximation
+ * @param[in] v Temp vector
+ * @param[in] r Temp Vector
+ */
+HYPRE_Int
+hypre_ParCSRRelax_Cheby_SolvePowers(hypre_ParCSRMatrix    *A, /* matrix to relax with */
+                                    hypre_ParVector       *f, /* right-hand side */
+                                    HYPRE_Real            *ds_data,
+                                    HYPRE_Real            *coefs,
+                                    HYPRE_Int              order, /* polynomial order */
+                                    HYPRE_Int              scale, /* scale by diagonal?*/
+                                    hypre_ParCSRMatPowers *mp,
+                                    hypre_ParVector       *u, /* initial/updated approximation */
+                                    hypre_ParVector       *v, /* temporary vector */
+                                    hypre_ParVector       *r) /* another vector */
+{
+   HYPRE_Real *u_data = hypre_VectorData(hypre_ParVectorLocalVector(u));
+   HYPRE_Real *v_data = hypre_VectorData(hypre_ParVectorLocalVector(v));
+   HYPRE_Real *r_data = hypre_VectorData(hypre_ParVectorLocalVector(r));
+   HYPRE_Int   num_rows = hypre_ParCSRMatrixNumRows(A);
+   HYPRE_Int   j;
+
+   if (order > 4)
+   {
+      order = 4;
+   }
+   if (order < 1)
+   {
+      order = 1;
+   }
+
+   /* r = f - A*u */
+   hypre_ParCSRMatrixMatvecOutOfPlace(-1.0, A, u, 1.0, f, r);
+
+   if (scale)
+   {
+      /* r = D^(-1/2) r */
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel for private(j) HYPRE_SMP_SCHEDULE
+#endif
+      for ( j = 0; j < num_rows; j++ )
+      {
+         r_data[j] *= ds_data[j];
+      }
+   }
+
+   /* v = p(S)r with S = D^(-1/2)AD^(-1/2) or S = A */
+   hypre_ParCSRMatPowersApplyPoly(mp, r, order - 1, coefs, v);
+
+   /* u = u + ds .* v, or u = u + v */
+   if (scale)
+   {
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel for private(j) HYPRE_SMP_SCHEDULE
+#endif
+      for ( j = 0; j < num_rows; j++ )
+      {
+         u_data[j] += ds_data[j] * v_data[j];
+      }
+   }
+   else
+   {
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel for private(j) HYPRE_SMP_SCHEDULE
+#endif
+      for ( j = 0; j < num_rows; j++ )
+      {
+         u_data[j] += v_data[j];
+      }
+   }
+
+   return hypre_error_flag;
+}
+
 /**
  * @brief Solve using a chebyshev polynomial
  *
@@ -899,10 +899,114 @@ hypre_BoomerAMGCoarsen( hypre_ParCSRMatrix    *S,
 #define UNDECIDED 0
 
 
+/* smallest number of rows per thread block in the threaded first pass */
+#define HYPRE_RUGE_MIN_BLOCK_SIZE 1000
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGCoarsenRugeCheckFPoints
+ *
+ * Second pass of Ruge coarsening on a subset of the local rows: for every
+ * F-point i, each strongly connected F-point j must share a strong C-point
+ * with i, otherwise j (or, on a second failure, i) becomes a C-point.
+ * Checks the points first,...,last-1 if points is NULL, and the num_points
+ * entries of points otherwise.  Only couplings to points in [first, last)
+ * are considered, so disjoint ranges can be processed concurrently.
+ * The candidate C-point state (ci_tilde, ci_tilde_mark, C_i_nonempty) is
+ * passed in and out, as in the serial second pass.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_BoomerAMGCoarsenRugeCheckFPoints( HYPRE_Int  num_points,
+                                        HYPRE_Int *points,
+                                        HYPRE_Int  first,
+                                        HYPRE_Int  last,
+                                        HYPRE_Int *S_i,
+                                        HYPRE_Int *S_j,
+                                        HYPRE_Int *CF_marker,
+                                        HYPRE_Int *graph_array,
+                                        HYPRE_Int *ci_tilde_ptr,
+                                        HYPRE_Int *ci_tilde_mark_ptr,
+                                        HYPRE_Int *C_i_nonempty_ptr )
+{
+   HYPRE_Int  ci_tilde      = *ci_tilde_ptr;
+   HYPRE_Int  ci_tilde_mark = *ci_tilde_mark_ptr;
+   HYPRE_Int  C_i_nonempty  = *C_i_nonempty_ptr;
+   HYPRE_Int  set_empty;
+   HYPRE_Int  i, j, k, ji, jj, index;
+
+   for (k = 0; k < num_points; k++)
+   {
+      i = points ? points[k] : first + k;
+      if (ci_tilde_mark != i) { ci_tilde = -1; }
+      if (CF_marker[i] == -1)
+      {
+         for (ji = S_i[i]; ji < S_i[i + 1]; ji++)
+         {
+            j = S_j[ji];
+            if (j >= first && j < last && CF_marker[j] > 0)
+            {
+               graph_array[j] = i;
+            }
+         }
+         for (ji = S_i[i]; ji < S_i[i + 1]; ji++)
+         {
+            j = S_j[ji];
+            if (j >= first && j < last && CF_marker[j] == -1)
+            {
+               set_empty = 1;
+               for (jj = S_i[j]; jj < S_i[j + 1]; jj++)
+               {
+                  index = S_j[jj];
+                  if (index >= first && index < last && graph_array[index] == i)
+                  {
+                     set_empty = 0;
+                     break;
+                  }
+               }
+               if (set_empty)
+               {
+                  if (C_i_nonempty)
+                  {
+                     CF_marker[i] = 1;
+                     if (ci_tilde > -1)
+                     {
+                        CF_marker[ci_tilde] = -1;
+                        ci_tilde = -1;
+                     }
+                     C_i_nonempty = 0;
+                     break;
+                  }
+                  else
+                  {
+                     ci_tilde = j;
+                     ci_tilde_mark = i;
+                     CF_marker[j] = 1;
+                     C_i_nonempty = 1;
+                     k--;
+                     break;
+                  }
+               }
+            }
+         }
+      }
+   }
+
+   *ci_tilde_ptr      = ci_tilde;
+   *ci_tilde_mark_ptr = ci_tilde_mark;
+   *C_i_nonempty_ptr  = C_i_nonempty;
+
+   return hypre_error_flag;
+}
+
 /**************************************************************
  *
  *      Ruge Coarsening routine
  *
+ *      If thread_blocks is nonzero, the first pass runs on one
+ *      block of local rows per OpenMP thread (see
+ *      HYPRE_BoomerAMGSetCoarsenThreadBlocks), so that the
+ *      coarse grid depends on the number of threads.
+ *
  **************************************************************/
 HYPRE_Int
 hypre_BoomerAMGCoarsenRuge( hypre_ParCSRMatrix    *S,
@@ -910,6 +1014,7 @@ hypre_BoomerAMGCoarsenRuge( hypre_ParCSRMatrix    *S,
                             HYPRE_Int              measure_type,
                             HYPRE_Int              coarsen_type,
                             HYPRE_Int              cut_factor,
+                            HYPRE_Int              thread_blocks,
                             HYPRE_Int              debug_flag,
                             hypre_IntArray       **CF_marker_ptr)
 {
@@ -981,6 +1086,12 @@ hypre_BoomerAMGCoarsenRuge( hypre_ParCSRMatrix    *S,
    HYPRE_Int        f_pnt = F_PT;
    HYPRE_Real       wall_time;
 
+   HYPRE_Int        num_threads = hypre_NumThreads();
+   HYPRE_Int        num_blocks, ib, ns, ne;
+   HYPRE_Int        num_negative = 0;
+   HYPRE_Int       *bdry_points = NULL;
+   HYPRE_Int        num_bdry_points = 0;
+
    if (coarsen_type < 0)
    {
       coarsen_type = -coarsen_type;
@@ -1170,7 +1281,6 @@ hypre_BoomerAMGCoarsenRuge( hypre_ParCSRMatrix    *S,
    }
    CF_marker = hypre_IntArrayData(*CF_marker_ptr);
 
-   num_left = 0;
    for (j = 0; j < num_variables; j++)
    {
       if (CF_marker[j] == 0)
@@ -1188,7 +1298,6 @@ hypre_BoomerAMGCoarsenRuge( hypre_ParCSRMatrix    *S,
          else
          {
             CF_marker[j] = UNDECIDED;
-            num_left++;
          }
       }
       else
@@ -1207,148 +1316,158 @@ hypre_BoomerAMGCoarsenRuge( hypre_ParCSRMatrix    *S,
          nnzrow = (A_i[j + 1] - A_i[j]) + (A_offd_i[j + 1] - A_offd_i[j]);
          if (nnzrow > cut)
          {
-            if (CF_marker[j] == UNDECIDED)
-            {
-               num_left--;
-            }
             CF_marker[j] = SF_PT;
          }
       }
    }
 
-   for (j = 0; j < num_variables; j++)
+   /*-------------------------------------------------------
+    * With thread_blocks and several threads, the local rows
+    * are split into contiguous blocks and the first pass runs
+    * on each block independently, ignoring strong couplings
+    * between blocks, just as coarsen_type 1 ignores couplings
+    * between processors.  The block boundaries are fixed up
+    * below.
+    *-------------------------------------------------------*/
+
+   num_blocks = 1;
+   if (thread_blocks)
    {
-      measure = measure_array[j];
-      if (CF_marker[j] != SF_PT && CF_marker[j] != SC_PT)
+      num_blocks = hypre_min(num_threads, num_variables / HYPRE_RUGE_MIN_BLOCK_SIZE);
+      num_blocks = hypre_max(num_blocks, 1);
+   }
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(ib,ns,ne,j,k,index,measure,new_meas,nabor,nabor_two,num_left,LoL_head,LoL_tail) reduction(+:num_negative) HYPRE_SMP_SCHEDULE
+#endif
+   for (ib = 0; ib < num_blocks; ib++)
+   {
+      hypre_partition1D(num_variables, num_blocks, ib, &ns, &ne);
+
+      /*************************************************************
+       *
+       *   Initialize the lists
+       *
+       *************************************************************/
+
+      LoL_head = NULL;
+      LoL_tail = NULL;
+      num_left = 0;
+      for (j = ns; j < ne; j++)
       {
-         if (measure > 0)
+         if (CF_marker[j] == UNDECIDED)
          {
-            hypre_enter_on_lists(&LoL_head, &LoL_tail, measure, j, lists, where);
+            num_left++;
          }
-         else
+      }
+
+      for (j = ns; j < ne; j++)
+      {
+         measure = measure_array[j];
+         if (CF_marker[j] != SF_PT && CF_marker[j] != SC_PT)
          {
-            if (measure < 0)
+            if (measure > 0)
             {
-               hypre_error_w_msg(HYPRE_ERROR_GENERIC, "negative measure!\n");
+               hypre_enter_on_lists(&LoL_head, &LoL_tail, measure, j, lists, where);
             }
-
-            CF_marker[j] = f_pnt;
-            for (k = S_i[j]; k < S_i[j + 1]; k++)
+            else
             {
-               nabor = S_j[k];
-               if (CF_marker[nabor] != SF_PT && CF_marker[nabor] != SC_PT)
+               if (measure < 0)
                {
-                  if (nabor < j)
-                  {
-                     new_meas = measure_array[nabor];
-                     if (new_meas > 0)
-                     {
-                        hypre_remove_point(&LoL_head, &LoL_tail, new_meas,
-                                           nabor, lists, where);
-                     }
+                  num_negative++;
+               }
 
-                     new_meas = ++(measure_array[nabor]);
-                     hypre_enter_on_lists(&LoL_head, &LoL_tail, new_meas,
-                                          nabor, lists, where);
+               CF_marker[j] = f_pnt;
+               for (k = S_i[j]; k < S_i[j + 1]; k++)
+               {
+                  nabor = S_j[k];
+                  if (nabor < ns || nabor >= ne)
+                  {
+                     continue;
                   }
-                  else
+                  if (CF_marker[nabor] != SF_PT && CF_marker[nabor] != SC_PT)
                   {
-                     new_meas = ++(measure_array[nabor]);
+                     if (nabor < j)
+                     {
+                        new_meas = measure_array[nabor];
+                        if (new_meas > 0)
+                        {
+                           hypre_remove_point(&LoL_head, &LoL_tail, new_meas,
+                                              nabor, lists, where);
+                        }
+
+                        new_meas = ++(measure_array[nabor]);
+                        hypre_enter_on_lists(&LoL_head, &LoL_tail, new_meas,
+                                             nabor, lists, where);
+                     }
+                     else
+                     {
+                        new_meas = ++(measure_array[nabor]);
+                     }
                   }
                }
+               --num_left;
             }
-            --num_left;
          }
       }
-   }
-
-   /****************************************************************
-    *
-    *  Main loop of Ruge-Stueben first coloring pass.
-    *
-    *  WHILE there are still points to classify DO:
-    *        1) find first point, i,  on list with max_measure
-    *           make i a C-point, remove it from the lists
-    *        2) For each point, j,  in S_i^T,
-    *           a) Set j to be an F-point
-    *           b) For each point, k, in S_j
-    *                  move k to the list in LoL with measure one
-    *                  greater than it occupies (creating new LoL
-    *                  entry if necessary)
-    *        3) For each point, j,  in S_i,
-    *                  move j to the list in LoL with measure one
-    *                  smaller than it occupies (creating new LoL
-    *                  entry if necessary)
-    *
-    ****************************************************************/
-
-   while (num_left > 0)
-   {
-      index = LoL_head -> head;
-
-      CF_marker[index] = C_PT;
-      measure = measure_array[index];
-      measure_array[index] = 0;
-      --num_left;
 
-      hypre_remove_point(&LoL_head, &LoL_tail, measure, index, lists, where);
+      /****************************************************************
+       *
+       *  Main loop of Ruge-Stueben first coloring pass.
+       *
+       *  WHILE there are still points to classify DO:
+       *        1) find first point, i,  on list with max_measure
+       *           make i a C-point, remove it from the lists
+       *        2) For each point, j,  in S_i^T,
+       *           a) Set j to be an F-point
+       *           b) For each point, k, in S_j
+       *                  move k to the list in LoL with measure one
+       *                  greater than it occupies (creating new LoL
+       *                  entry if necessary)
+       *        3) For each point, j,  in S_i,
+       *                  move j to the list in LoL with measure one
+       *                  smaller than it occupies (creating new LoL
+       *                  entry if necessary)
+       *
+       ****************************************************************/
 
-      for (j = ST_i[index]; j < ST_i[index + 1]; j++)
+      while (num_left > 0)
       {
-         nabor = ST_j[j];
-         if (CF_marker[nabor] == UNDECIDED)
-         {
-            CF_marker[nabor] = F_PT;
-            measure = measure_array[nabor];
-
-            hypre_remove_point(&LoL_head, &LoL_tail, measure, nabor, lists, where);
-            --num_left;
+         index = LoL_head -> head;
 
-            for (k = S_i[nabor]; k < S_i[nabor + 1]; k++)
-            {
-               nabor_two = S_j[k];
-               if (CF_marker[nabor_two] == UNDECIDED)
-               {
-                  measure = measure_array[nabor_two];
-                  hypre_remove_point(&LoL_head, &LoL_tail, measure,
-                                     nabor_two, lists, where);
+         CF_marker[index] = C_PT;
+         measure = measure_array[index];
+         measure_array[index] = 0;
+         --num_left;
 
-                  new_meas = ++(measure_array[nabor_two]);
+         hypre_remove_point(&LoL_head, &LoL_tail, measure, index, lists, where);
 
-                  hypre_enter_on_lists(&LoL_head, &LoL_tail, new_meas,
-                                       nabor_two, lists, where);
-               }
-            }
-         }
-      }
-      for (j = S_i[index]; j < S_i[index + 1]; j++)
-      {
-         nabor = S_j[j];
-         if (CF_marker[nabor] == UNDECIDED)
+         for (j = ST_i[index]; j < ST_i[index + 1]; j++)
          {
-            measure = measure_array[nabor];
-
-            hypre_remove_point(&LoL_head, &LoL_tail, measure, nabor, lists, where);
-
-            measure_array[nabor] = --measure;
-
-            if (measure > 0)
+            nabor = ST_j[j];
+            if (nabor < ns || nabor >= ne)
             {
-               hypre_enter_on_lists(&LoL_head, &LoL_tail, measure, nabor,
-                                    lists, where);
+               continue;
             }
-            else
+            if (CF_marker[nabor] == UNDECIDED)
             {
                CF_marker[nabor] = F_PT;
+               measure = measure_array[nabor];
+
+               hypre_remove_point(&LoL_head, &LoL_tail, measure, nabor, lists, where);
                --num_left;
 
                for (k = S_i[nabor]; k < S_i[nabor + 1]; k++)
                {
                   nabor_two = S_j[k];
+                  if (nabor_two < ns || nabor_two >= ne)
+                  {
+                     continue;
+                  }
                   if (CF_marker[nabor_two] == UNDECIDED)
                   {
-                     new_meas = measure_array[nabor_two];
-                     hypre_remove_point(&LoL_head, &LoL_tail, new_meas,
+                     measure = measure_array[nabor_two];
+                     hypre_remove_point(&LoL_head, &LoL_tail, measure,
                                         nabor_two, lists, where);
 
                      new_meas = ++(measure_array[nabor_two]);
@@ -1359,6 +1478,120 @@ hypre_BoomerAMGCoarsenRuge( hypre_ParCSRMatrix    *S,
                }
             }
          }
+         for (j = S_i[index]; j < S_i[index + 1]; j++)
+         {
+            nabor = S_j[j];
+            if (nabor < ns || nabor >= ne)
+            {
+               continue;
+            }
+            if (CF_marker[nabor] == UNDECIDED)
+            {
+               measure = measure_array[nabor];
+
+               hypre_remove_point(&LoL_head, &LoL_tail, measure, nabor, lists, where);
+
+               measure_array[nabor] = --measure;
+
+               if (measure > 0)
+               {
+                  hypre_enter_on_lists(&LoL_head, &LoL_tail, measure, nabor,
+                                       lists, where);
+               }
+               else
+               {
+                  CF_marker[nabor] = F_PT;
+                  --num_left;
+
+                  for (k = S_i[nabor]; k < S_i[nabor + 1]; k++)
+                  {
+                     nabor_two = S_j[k];
+                     if (nabor_two < ns || nabor_two >= ne)
+                     {
+                        continue;
+                     }
+                     if (CF_marker[nabor_two] == UNDECIDED)
+                     {
+                        new_meas = measure_array[nabor_two];
+                        hypre_remove_point(&LoL_head, &LoL_tail, new_meas,
+                                           nabor_two, lists, where);
+
+                        new_meas = ++(measure_array[nabor_two]);
+
+                        hypre_enter_on_lists(&LoL_head, &LoL_tail, new_meas,
+                                             nabor_two, lists, where);
+                     }
+                  }
+               }
+            }
+         }
+      }
+
+      hypre_TFree(LoL_head, HYPRE_MEMORY_HOST);
+      hypre_TFree(LoL_tail, HYPRE_MEMORY_HOST);
+   }
+
+   if (num_negative)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "negative measure!\n");
+   }
+
+   /*-------------------------------------------------------
+    * Collect the points with strong couplings to other
+    * blocks.  For Falgout and HMIS coarsening they are reset
+    * to undecided and treated like processor boundary points
+    * by the following CLJP/PMIS coarsening; otherwise the
+    * second pass checks them across blocks.
+    *-------------------------------------------------------*/
+
+   if (num_blocks > 1)
+   {
+      bdry_points = hypre_TAlloc(HYPRE_Int, num_variables, HYPRE_MEMORY_HOST);
+
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel for private(ib,ns,ne,i,j,nabor) HYPRE_SMP_SCHEDULE
+#endif
+      for (ib = 0; ib < num_blocks; ib++)
+      {
+         hypre_partition1D(num_variables, num_blocks, ib, &ns, &ne);
+         for (i = ns; i < ne; i++)
+         {
+            bdry_points[i] = 0;
+            if (CF_marker[i] == SF_PT || CF_marker[i] == SC_PT)
+            {
+               continue;
+            }
+            for (j = S_i[i]; j < S_i[i + 1]; j++)
+            {
+               nabor = S_j[j];
+               if (nabor < ns || nabor >= ne)
+               {
+                  bdry_points[i] = 1;
+                  break;
+               }
+            }
+            for (j = ST_i[i]; j < ST_i[i + 1] && !bdry_points[i]; j++)
+            {
+               nabor = ST_j[j];
+               if (nabor < ns || nabor >= ne)
+               {
+                  bdry_points[i] = 1;
+               }
+            }
+            if (bdry_points[i] && f_pnt == Z_PT)
+            {
+               CF_marker[i] = UNDECIDED;
+            }
+         }
+      }
+
+      num_bdry_points = 0;
+      for (i = 0; i < num_variables; i++)
+      {
+         if (bdry_points[i])
+         {
+            bdry_points[num_bdry_points++] = i;
+         }
       }
    }
 
@@ -1374,8 +1607,6 @@ hypre_BoomerAMGCoarsenRuge( hypre_ParCSRMatrix    *S,
 
    hypre_TFree(lists, HYPRE_MEMORY_HOST);
    hypre_TFree(where, HYPRE_MEMORY_HOST);
-   hypre_TFree(LoL_head, HYPRE_MEMORY_HOST);
-   hypre_TFree(LoL_tail, HYPRE_MEMORY_HOST);
 
    for (i = 0; i < num_variables; i++)
    {
@@ -1391,6 +1622,7 @@ hypre_BoomerAMGCoarsenRuge( hypre_ParCSRMatrix    *S,
       {
          hypre_CSRMatrixDestroy(S_ext);
       }
+      hypre_TFree(bdry_points, HYPRE_MEMORY_HOST);
       return 0;
    }
 
@@ -1595,60 +1827,31 @@ hypre_BoomerAMGCoarsenRuge( hypre_ParCSRMatrix    *S,
    }
    else
    {
-      for (i = 0; i < num_variables; i++)
+      if (num_blocks == 1)
       {
-         if (ci_tilde_mark != i) { ci_tilde = -1; }
-         if (CF_marker[i] == -1)
+         hypre_BoomerAMGCoarsenRugeCheckFPoints(num_variables, NULL, 0, num_variables,
+                                                S_i, S_j, CF_marker, graph_array,
+                                                &ci_tilde, &ci_tilde_mark, &C_i_nonempty);
+      }
+      else
+      {
+#ifdef HYPRE_USING_OPENMP
+         #pragma omp parallel for private(ib,ns,ne) HYPRE_SMP_SCHEDULE
+#endif
+         for (ib = 0; ib < num_blocks; ib++)
          {
-            for (ji = S_i[i]; ji < S_i[i + 1]; ji++)
-            {
-               j = S_j[ji];
-               if (CF_marker[j] > 0)
-               {
-                  graph_array[j] = i;
-               }
-            }
-            for (ji = S_i[i]; ji < S_i[i + 1]; ji++)
-            {
-               j = S_j[ji];
-               if (CF_marker[j] == -1)
-               {
-                  set_empty = 1;
-                  for (jj = S_i[j]; jj < S_i[j + 1]; jj++)
-                  {
-                     index = S_j[jj];
-                     if (graph_array[index] == i)
-                     {
-                        set_empty = 0;
-                        break;
-                     }
-                  }
-                  if (set_empty)
-                  {
-                     if (C_i_nonempty)
-                     {
-                        CF_marker[i] = 1;
-                        if (ci_tilde > -1)
-                        {
-                           CF_marker[ci_tilde] = -1;
-                           ci_tilde = -1;
-                        }
-                        C_i_nonempty = 0;
-                        break;
-                     }
-                     else
-                     {
-                        ci_tilde = j;
-                        ci_tilde_mark = i;
-                        CF_marker[j] = 1;
-                        C_i_nonempty = 1;
-                        i--;
-                        break;
-                     }
-                  }
-               }
-            }
+            HYPRE_Int ci_tilde_b = -1, ci_tilde_mark_b = -1, C_i_nonempty_b = 0;
+
+            hypre_partition1D(num_variables, num_blocks, ib, &ns, &ne);
+            hypre_BoomerAMGCoarsenRugeCheckFPoints(ne - ns, NULL, ns, ne, S_i, S_j,
+                                                   CF_marker, graph_array, &ci_tilde_b,
+                                                   &ci_tilde_mark_b, &C_i_nonempty_b);
          }
+
+         /* check strong F-F couplings between blocks */
+         hypre_BoomerAMGCoarsenRugeCheckFPoints(num_bdry_points, bdry_points, 0, num_variables,
+                                                S_i, S_j, CF_marker, graph_array,
+                                                &ci_tilde, &ci_tilde_mark, &C_i_nonempty);
       }
    }
 
@@ -2046,6 +2249,7 @@ hypre_BoomerAMGCoarsenRuge( hypre_ParCSRMatrix    *S,
    hypre_TFree(ci_array, HYPRE_MEMORY_HOST);
    /*} */
    hypre_TFree(graph_array, HYPRE_MEMORY_HOST);
+   hypre_TFree(bdry_points, HYPRE_MEMORY_HOST);
    if ((meas_type || (coarsen_type != 1 && coarsen_type != 11)) && num_procs > 1)
    {
       hypre_CSRMatrixDestroy(S_ext);
@@ -2060,6 +2264,7 @@ hypre_BoomerAMGCoarsenFalgout( hypre_ParCSRMatrix  *S,
                                hypre_ParCSRMatrix  *A,
                                HYPRE_Int            measure_type,
                                HYPRE_Int            cut_factor,
+                               HYPRE_Int            thread_blocks,
                                HYPRE_Int            debug_flag,
                                hypre_IntArray     **CF_marker_ptr)
 {
@@ -2070,7 +2275,7 @@ hypre_BoomerAMGCoarsenFalgout( hypre_ParCSRMatrix  *S,
     *-------------------------------------------------------*/
 
    ierr += hypre_BoomerAMGCoarsenRuge (S, A, measure_type, 6, cut_factor,
-                                       debug_flag, CF_marker_ptr);
+                                       thread_blocks, debug_flag, CF_marker_ptr);
 
    ierr += hypre_BoomerAMGCoarsen (S, A, 1, debug_flag, CF_marker_ptr);
 
@@ -2847,6 +3052,7 @@ hypre_BoomerAMGCoarsenHMIS( hypre_ParCSRMatrix    *S,
                             hypre_ParCSRMatrix    *A,
                             HYPRE_Int              measure_type,
                             HYPRE_Int              cut_factor,
+                            HYPRE_Int              thread_blocks,
                             HYPRE_Int              debug_flag,
                             hypre_IntArray       **CF_marker_ptr)
 {
@@ -2857,7 +3063,7 @@ hypre_BoomerAMGCoarsenHMIS( hypre_ParCSRMatrix    *S,
     *-------------------------------------------------------*/
 
    ierr += hypre_BoomerAMGCoarsenRuge (S, A, measure_type, 10, cut_factor,
-                                       debug_flag, CF_marker_ptr);
+                                       thread_blocks, debug_flag, CF_marker_ptr);
 
    ierr += hypre_BoomerAMGCoarsenPMISHost (S, A, 1, debug_flag, CF_marker_ptr);
 
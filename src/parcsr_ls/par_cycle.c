@@ -16,13 +16,18 @@
 #include "../parcsr_block_mv/par_csr_block_matrix.h"
 
 /*--------------------------------------------------------------------------
- * hypre_BoomerAMGCycle
+ * hypre_BoomerAMGCycleLevels
+ *
+ * Performs one cycle that starts and ends on level first_level.  Coarse
+ * levels with a K-cycle solver get their correction from a few flexible
+ * Krylov iterations preconditioned by this routine started on that level.
  *--------------------------------------------------------------------------*/
 
-HYPRE_Int
-hypre_BoomerAMGCycle( void              *amg_vdata,
-                      hypre_ParVector  **F_array,
-                      hypre_ParVector  **U_array   )
+static HYPRE_Int
+hypre_BoomerAMGCycleLevels( void              *amg_vdata,
+                            hypre_ParVector  **F_array,
+                            hypre_ParVector  **U_array,
+                            HYPRE_Int          first_level )
 {
    hypre_ParAMGData *amg_data = (hypre_ParAMGData*) amg_vdata;
 
@@ -96,9 +101,13 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
    hypre_Vector   *l1_norms_level;
    hypre_Vector  **ds = hypre_ParAMGDataChebyDS(amg_data);
    HYPRE_Real    **coefs = hypre_ParAMGDataChebyCoefs(amg_data);
+   hypre_ParCSRMatPowers **cheby_powers = hypre_ParAMGDataChebyPowers(amg_data);
    HYPRE_Int       seq_cg = 0;
    HYPRE_Int       partial_cycle_coarsest_level;
    HYPRE_Int       partial_cycle_control;
+   HYPRE_Solver   *kcycle_solvers;
+   HYPRE_Int       kcycle_solved = 0;
+   HYPRE_Int       conv_err;
    MPI_Comm        comm;
 
 #if defined (HYPRE_USING_NVTX) || defined (HYPRE_USING_ROCTX)
@@ -149,6 +158,7 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
 
    partial_cycle_coarsest_level = hypre_ParAMGDataPartialCycleCoarsestLevel(amg_data);
    partial_cycle_control = hypre_ParAMGDataPartialCycleControl(amg_data);
+   kcycle_solvers = hypre_ParAMGDataKCycleSolvers(amg_data);
 
    /*max_eig_est = hypre_ParAMGDataMaxEigEst(amg_data);
    min_eig_est = hypre_ParAMGDataMinEigEst(amg_data);
@@ -203,8 +213,8 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
     *     negative, we go to the next coarser level. The
     *     following actions control cycling:
     *
-    *     a. lev_counter[0] is initialized to 1.
-    *     b. lev_counter[k] is initialized to cycle_type for k>0.
+    *     a. lev_counter[first_level] is initialized to 1.
+    *     b. lev_counter[k] is initialized to cycle_type for k>first_level.
     *
     *     c. During cycling, when going down to level k, lev_counter[k]
     *        is set to the max of (lev_counter[k],cycle_type)
@@ -224,9 +234,10 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
          lev_counter[k] = cycle_type;
       }
    }
+   lev_counter[first_level] = 1;
    fcycle_lev = num_levels - 2;
 
-   level = 0;
+   level = first_level;
    cycle_param = 1;
 
    smoother = hypre_ParAMGDataSmoother(amg_data);
@@ -366,7 +377,12 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
          l1_norms_level = NULL;
       }
 
-      if (cycle_param == 3 && seq_cg)
+      if (kcycle_solved)
+      {
+         /* The correction on this level was computed by the K-cycle solver */
+         kcycle_solved = 0;
+      }
+      else if (cycle_param == 3 && seq_cg)
       {
          HYPRE_ANNOTATE_REGION_BEGIN("%s", "Coarse solve");
 #if defined (HYPRE_USING_NVTX) || defined (HYPRE_USING_ROCTX)
@@ -544,10 +560,20 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
                   /* scaled Chebyshev */
                   HYPRE_Int scale = hypre_ParAMGDataChebyScale(amg_data);
                   HYPRE_Int variant = hypre_ParAMGDataChebyVariant(amg_data);
-                  hypre_ParCSRRelax_Cheby_Solve(A_array[level], Aux_F,
-                                                hypre_VectorData(ds[level]), coefs[level],
-                                                cheby_order, scale,
-                                                variant, Aux_U, Vtemp, Ztemp, Ptemp, Rtemp );
+                  if (cheby_powers && cheby_powers[level])
+                  {
+                     hypre_ParCSRRelax_Cheby_SolvePowers(A_array[level], Aux_F,
+                                                         hypre_VectorData(ds[level]), coefs[level],
+                                                         cheby_order, scale, cheby_powers[level],
+                                                         Aux_U, Vtemp, Ztemp);
+                  }
+                  else
+                  {
+                     hypre_ParCSRRelax_Cheby_Solve(A_array[level], Aux_F,
+                                                   hypre_VectorData(ds[level]), coefs[level],
+                                                   cheby_order, scale,
+                                                   variant, Aux_U, Vtemp, Ztemp, Ptemp, Rtemp );
+                  }
                }
                else if (relax_type == 17)
                {
@@ -750,8 +776,29 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
          hypre_sprintf(nvtx_name, "%s-%d", "AMG Level", level);
          hypre_GpuProfilingPushRange(nvtx_name);
 #endif
+
+         if (kcycle_solvers && kcycle_solvers[level] && partial_cycle_coarsest_level < 0)
+         {
+            /* K-cycle: replace the visits to this level by a Krylov solve.
+               Unconverged inner solves are expected and must not be reported. */
+            conv_err = hypre_error_flag & HYPRE_ERROR_CONV;
+            hypre_ParAMGDataCycleOpCount(amg_data) = cycle_op_count;
+
+            HYPRE_ParCSRFlexGMRESSolve(kcycle_solvers[level],
+                                       (HYPRE_ParCSRMatrix) A_array[level],
+                                       (HYPRE_ParVector) F_array[level],
+                                       (HYPRE_ParVector) U_array[level]);
+
+            cycle_op_count = hypre_ParAMGDataCycleOpCount(amg_data);
+            if (!conv_err)
+            {
+               HYPRE_ClearError(HYPRE_ERROR_CONV);
+            }
+            lev_counter[level] = 0;
+            kcycle_solved = 1;
+         }
       }
-      else if (level != 0)
+      else if (level != first_level)
       {
          /*---------------------------------------------------------------
           * Visit finer level next.
@@ -837,3 +884,141 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
 
    return (Solve_err_flag);
 }
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGCycle
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGCycle( void              *amg_vdata,
+                      hypre_ParVector  **F_array,
+                      hypre_ParVector  **U_array   )
+{
+   return hypre_BoomerAMGCycleLevels(amg_vdata, F_array, U_array, 0);
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGKCyclePrecond
+ *
+ * Preconditioner of the K-cycle Krylov solvers: one cycle started on the
+ * level of A, with b and x taking the place of that level's vectors.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_BoomerAMGKCyclePrecond( HYPRE_Solver        solver,
+                              HYPRE_ParCSRMatrix  A,
+                              HYPRE_ParVector     b,
+                              HYPRE_ParVector     x )
+{
+   hypre_ParAMGData    *amg_data   = (hypre_ParAMGData*) solver;
+   hypre_ParCSRMatrix **A_array    = hypre_ParAMGDataAArray(amg_data);
+   hypre_ParVector    **F_array    = hypre_ParAMGDataFArray(amg_data);
+   hypre_ParVector    **U_array    = hypre_ParAMGDataUArray(amg_data);
+   HYPRE_Int            num_levels = hypre_ParAMGDataNumLevels(amg_data);
+   hypre_ParVector     *F_level;
+   hypre_ParVector     *U_level;
+   HYPRE_Int            level;
+
+   for (level = 1; level < num_levels - 1; level++)
+   {
+      if (A_array[level] == (hypre_ParCSRMatrix *) A)
+      {
+         break;
+      }
+   }
+
+   F_level = F_array[level];
+   U_level = U_array[level];
+   F_array[level] = (hypre_ParVector *) b;
+   U_array[level] = (hypre_ParVector *) x;
+
+   hypre_ParVectorSetZeros(U_array[level]);
+   hypre_BoomerAMGCycleLevels((void *) amg_data, F_array, U_array, level);
+
+   F_array[level] = F_level;
+   U_array[level] = U_level;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGKCycleSetup
+ *
+ * Creates the flexible GMRES solvers used by the K-cycle on levels 1 through
+ * min(kcycle, num_levels - 2).  The Krylov work vectors are allocated here,
+ * once per hierarchy.  An inner solve stops after kcycle_num_iter iterations
+ * or once the coarse residual has been reduced by a factor of 4.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGKCycleSetup( void *amg_vdata )
+{
+   hypre_ParAMGData    *amg_data   = (hypre_ParAMGData*) amg_vdata;
+   hypre_ParCSRMatrix **A_array    = hypre_ParAMGDataAArray(amg_data);
+   hypre_ParVector    **F_array    = hypre_ParAMGDataFArray(amg_data);
+   hypre_ParVector    **U_array    = hypre_ParAMGDataUArray(amg_data);
+   HYPRE_Int            num_levels = hypre_ParAMGDataNumLevels(amg_data);
+   HYPRE_Int            num_iter   = hypre_ParAMGDataKCycleNumIter(amg_data);
+   HYPRE_Int            last_level;
+   HYPRE_Int            level;
+   HYPRE_Solver        *kcycle_solvers;
+
+   last_level = hypre_min(hypre_ParAMGDataKCycle(amg_data), num_levels - 2);
+
+   if (last_level < 1 || hypre_ParAMGDataBlockMode(amg_data) ||
+       hypre_ParVectorNumVectors(F_array[0]) > 1)
+   {
+      return hypre_error_flag;
+   }
+
+   kcycle_solvers = hypre_CTAlloc(HYPRE_Solver, num_levels, HYPRE_MEMORY_HOST);
+
+   for (level = 1; level <= last_level; level++)
+   {
+      HYPRE_ParCSRFlexGMRESCreate(hypre_ParCSRMatrixComm(A_array[level]),
+                                  &kcycle_solvers[level]);
+      HYPRE_ParCSRFlexGMRESSetKDim(kcycle_solvers[level], num_iter);
+      HYPRE_ParCSRFlexGMRESSetMaxIter(kcycle_solvers[level], num_iter);
+      HYPRE_ParCSRFlexGMRESSetTol(kcycle_solvers[level], 0.25);
+      HYPRE_ParCSRFlexGMRESSetPrecond(kcycle_solvers[level],
+                                      hypre_BoomerAMGKCyclePrecond,
+                                      (HYPRE_PtrToParSolverFcn) hypre_ParKrylovIdentitySetup,
+                                      (HYPRE_Solver) amg_data);
+      HYPRE_ParCSRFlexGMRESSetup(kcycle_solvers[level],
+                                 (HYPRE_ParCSRMatrix) A_array[level],
+                                 (HYPRE_ParVector) F_array[level],
+                                 (HYPRE_ParVector) U_array[level]);
+   }
+
+   hypre_ParAMGDataKCycleSolvers(amg_data) = kcycle_solvers;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGKCycleDestroy
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGKCycleDestroy( void      *amg_vdata,
+                              HYPRE_Int  num_levels )
+{
+   hypre_ParAMGData *amg_data       = (hypre_ParAMGData*) amg_vdata;
+   HYPRE_Solver     *kcycle_solvers = hypre_ParAMGDataKCycleSolvers(amg_data);
+   HYPRE_Int         level;
+
+   if (kcycle_solvers)
+   {
+      for (level = 0; level < num_levels; level++)
+      {
+         if (kcycle_solvers[level])
+         {
+            HYPRE_ParCSRFlexGMRESDestroy(kcycle_solvers[level]);
+         }
+      }
+      hypre_TFree(kcycle_solvers, HYPRE_MEMORY_HOST);
+      hypre_ParAMGDataKCycleSolvers(amg_data) = NULL;
+   }
+
+   return hypre_error_flag;
+}
@@ -2654,6 +2654,148 @@ hypre_BoomerAMGInterpTruncation( hypre_ParCSRMatrix *P,
    }
 }
 
+/*------------------------------------------------
+ * Drop entries in one row of an interpolation matrix, in place.
+ * The diag and offd parts of the row are passed separately and their
+ * lengths are updated on return.  The result is the same as that of
+ * hypre_BoomerAMGInterpTruncation on the host, which lets interpolation
+ * routines truncate each row right after it is built.  aux_j and aux_data
+ * must hold at least *diag_size + *offd_size entries.
+ *------------------------------------------------*/
+HYPRE_Int
+hypre_BoomerAMGInterpTruncateRow( HYPRE_Real   trunc_factor,
+                                  HYPRE_Int    max_elmts,
+                                  HYPRE_Int    num_cols_diag,
+                                  HYPRE_Int   *diag_j,
+                                  HYPRE_Real  *diag_data,
+                                  HYPRE_Int   *diag_size,
+                                  HYPRE_Int   *offd_j,
+                                  HYPRE_Real  *offd_data,
+                                  HYPRE_Int   *offd_size,
+                                  HYPRE_Int   *aux_j,
+                                  HYPRE_Real  *aux_data )
+{
+   HYPRE_Int   num_diag = *diag_size;
+   HYPRE_Int   num_offd = *offd_size;
+   HYPRE_Int   j, cnt, cnt_diag, cnt_offd;
+   HYPRE_Real  row_nrm, drop_coeff, row_sum, scale;
+
+   /* drop entries smaller than trunc_factor times the largest one */
+   if (trunc_factor > 0.0)
+   {
+      row_nrm = 0.0;
+      for (j = 0; j < num_diag; j++)
+      {
+         row_nrm = hypre_max(row_nrm, hypre_cabs(diag_data[j]));
+      }
+      for (j = 0; j < num_offd; j++)
+      {
+         row_nrm = hypre_max(row_nrm, hypre_cabs(offd_data[j]));
+      }
+      drop_coeff = trunc_factor * row_nrm;
+
+      row_sum = 0.0;
+      scale = 0.0;
+      cnt_diag = 0;
+      for (j = 0; j < num_diag; j++)
+      {
+         row_sum += diag_data[j];
+         if (hypre_cabs(diag_data[j]) >= drop_coeff)
+         {
+            scale += diag_data[j];
+            diag_j[cnt_diag] = diag_j[j];
+            diag_data[cnt_diag++] = diag_data[j];
+         }
+      }
+      cnt_offd = 0;
+      for (j = 0; j < num_offd; j++)
+      {
+         row_sum += offd_data[j];
+         if (hypre_cabs(offd_data[j]) >= drop_coeff)
+         {
+            scale += offd_data[j];
+            offd_j[cnt_offd] = offd_j[j];
+            offd_data[cnt_offd++] = offd_data[j];
+         }
+      }
+      num_diag = cnt_diag;
+      num_offd = cnt_offd;
+
+      /* preserve the row sum */
+      if (scale != 0.0 && scale != row_sum)
+      {
+         scale = row_sum / scale;
+         for (j = 0; j < num_diag; j++)
+         {
+            diag_data[j] *= scale;
+         }
+         for (j = 0; j < num_offd; j++)
+         {
+            offd_data[j] *= scale;
+         }
+      }
+   }
+
+   /* keep the max_elmts largest entries */
+   if (max_elmts > 0 && num_diag + num_offd > max_elmts)
+   {
+      row_sum = 0.0;
+      cnt = 0;
+      for (j = 0; j < num_diag; j++)
+      {
+         aux_j[cnt] = diag_j[j];
+         aux_data[cnt++] = diag_data[j];
+         row_sum += diag_data[j];
+      }
+      for (j = 0; j < num_offd; j++)
+      {
+         aux_j[cnt] = offd_j[j] + num_cols_diag;
+         aux_data[cnt++] = offd_data[j];
+         row_sum += offd_data[j];
+      }
+
+      hypre_qsort2_abs(aux_j, aux_data, 0, cnt - 1);
+
+      scale = 0.0;
+      cnt_diag = 0;
+      cnt_offd = 0;
+      for (j = 0; j < max_elmts; j++)
+      {
+         scale += aux_data[j];
+         if (aux_j[j] < num_cols_diag)
+         {
+            diag_j[cnt_diag] = aux_j[j];
+            diag_data[cnt_diag++] = aux_data[j];
+         }
+         else
+         {
+            offd_j[cnt_offd] = aux_j[j] - num_cols_diag;
+            offd_data[cnt_offd++] = aux_data[j];
+         }
+      }
+      num_diag = cnt_diag;
+      num_offd = cnt_offd;
+
+      if (scale != 0.0 && scale != row_sum)
+      {
+         scale = row_sum / scale;
+         for (j = 0; j < num_diag; j++)
+         {
+            diag_data[j] *= scale;
+         }
+         for (j = 0; j < num_offd; j++)
+         {
+            offd_data[j] *= scale;
+         }
+      }
+   }
+
+   *diag_size = num_diag;
+   *offd_size = num_offd;
+
+   return hypre_error_flag;
+}
+
 /*---------------------------------------------------------------------------
  * hypre_BoomerAMGBuildInterpModUnk - this is a modified interpolation for the unknown approach.
  * here we need to pass in a strength matrix built on the entire matrix.
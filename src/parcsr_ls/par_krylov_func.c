@@ -179,6 +179,28 @@ hypre_ParKrylovInnerProd( void *x,
                                       (hypre_ParVector *) y ) );
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_ParKrylovResidualInnerProd
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParKrylovResidualInnerProd( void       *matvec_data,
+                                  void       *A,
+                                  void       *x,
+                                  void       *b,
+                                  void       *r,
+                                  void       *z,
+                                  HYPRE_Real *rr,
+                                  HYPRE_Real *rz )
+{
+   return ( hypre_ParCSRMatrixResidualInnerProd( (hypre_ParCSRMatrix *) A,
+                                                 (hypre_ParVector *) x,
+                                                 (hypre_ParVector *) b,
+                                                 (hypre_ParVector *) r,
+                                                 (hypre_ParVector *) z,
+                                                 rr, rz ) );
+}
+
 /*--------------------------------------------------------------------------
  * hypre_ParKrylovMassInnerProd
  *--------------------------------------------------------------------------*/
@@ -250,6 +272,40 @@ hypre_ParKrylovAxpy( HYPRE_Complex alpha,
                                  (hypre_ParVector *) y ) );
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_ParKrylovAxpby
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParKrylovAxpby( HYPRE_Complex alpha,
+                      void         *x,
+                      HYPRE_Complex beta,
+                      void         *y )
+{
+   return ( hypre_ParVectorAxpby( alpha, (hypre_ParVector *) x,
+                                  beta, (hypre_ParVector *) y ) );
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParKrylovUpdateSolutionResidual
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParKrylovUpdateSolutionResidual( HYPRE_Complex  alpha,
+                                       void          *p,
+                                       void          *s,
+                                       void          *x,
+                                       void          *r,
+                                       HYPRE_Real    *r_prod )
+{
+   return ( hypre_ParVectorUpdateSolutionResidual( alpha,
+                                                   (hypre_ParVector *) p,
+                                                   (hypre_ParVector *) s,
+                                                   (hypre_ParVector *) x,
+                                                   (hypre_ParVector *) r,
+                                                   r_prod ) );
+}
+
 /*--------------------------------------------------------------------------
  * hypre_ParKrylovMassAxpy
  *--------------------------------------------------------------------------*/
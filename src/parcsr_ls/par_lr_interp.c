@@ -11,6 +11,48 @@
 #define MAX_C_CONNECTIONS 100
 #define HAVE_COMMON_C 1
 
+/*---------------------------------------------------------------------------
+ * hypre_BoomerAMGInterpShiftRows
+ *
+ * Called by all threads of the OpenMP regions of the threaded interpolation
+ * routines below, after the pass that counts the entries of P.  Each thread
+ * has numbered the entries of its rows [start, stop) of P_diag and P_offd, and
+ * the coarse points among them, starting from zero.  Shift them by the counts
+ * of the preceding threads and set the last row pointers.
+ *
+ * workspace has length at least 3 * (num_threads + 1).
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_BoomerAMGInterpShiftRows( HYPRE_Int start, HYPRE_Int stop, HYPRE_Int n_fine, HYPRE_Int diag_count, HYPRE_Int offd_count, HYPRE_Int coarse_count, HYPRE_Int *P_diag_i, HYPRE_Int *P_offd_i, HYPRE_Int *fine_to_coarse, HYPRE_Int *workspace )
+{
+   HYPRE_Int  P_diag_size, P_offd_size, num_coarse;
+   HYPRE_Int  i;
+
+   hypre_prefix_sum_triple(&diag_count, &P_diag_size, &offd_count, &P_offd_size,
+                           &coarse_count, &num_coarse, workspace);
+
+   for (i = start; i < stop; i++)
+   {
+      P_diag_i[i] += diag_count;
+      P_offd_i[i] += offd_count;
+      if (fine_to_coarse[i] >= 0)
+      {
+         fine_to_coarse[i] += coarse_count;
+      }
+   }
+
+   if (hypre_GetThreadNum() == 0)
+   {
+      P_diag_i[n_fine] = P_diag_size;
+      P_offd_i[n_fine] = P_offd_size;
+   }
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp barrier
+#endif
+}
+
 /*---------------------------------------------------------------------------
  * hypre_BoomerAMGBuildStdInterp
  *  Comment: The interpolatory weighting can be changed with the sep_weight
@@ -112,7 +154,7 @@ hypre_BoomerAMGBuildStdInterp(hypre_ParCSRMatrix  *A,
    HYPRE_Int       *ihat_offd = NULL;
    HYPRE_Int       *ipnt = NULL;
    HYPRE_Int       *ipnt_offd = NULL;
-   HYPRE_Int        strong_f_marker = -2;
+   HYPRE_Int        strong_f_marker;
 
    /* Interpolation weight variables */
    HYPRE_Real      *ahat = NULL;
@@ -129,13 +171,14 @@ hypre_BoomerAMGBuildStdInterp(hypre_ParCSRMatrix  *A,
    HYPRE_Int        cnt_c, cnt_f, cnt_c_offd, cnt_f_offd, indx;
    HYPRE_BigInt     big_k1;
 
+   /* Threading variables */
+   HYPRE_Int        start, stop;
+   HYPRE_Int       *workspace;
+
    /* Definitions */
    HYPRE_Real       zero = 0.0;
    HYPRE_Real       one  = 1.0;
    HYPRE_Real       wall_time;
-   HYPRE_Real       wall_1 = 0;
-   HYPRE_Real       wall_2 = 0;
-   HYPRE_Real       wall_3 = 0;
 
 
    hypre_ParCSRCommPkg   *extend_comm_pkg = NULL;
@@ -191,12 +234,10 @@ hypre_BoomerAMGBuildStdInterp(hypre_ParCSRMatrix  *A,
    if (n_fine)
    {
       fine_to_coarse = hypre_CTAlloc(HYPRE_Int, n_fine, HYPRE_MEMORY_HOST);
-      P_marker       = hypre_CTAlloc(HYPRE_Int, n_fine, HYPRE_MEMORY_HOST);
    }
 
    if (full_off_procNodes)
    {
-      P_marker_offd       = hypre_CTAlloc(HYPRE_Int,    full_off_procNodes, HYPRE_MEMORY_HOST);
       fine_to_coarse_offd = hypre_CTAlloc(HYPRE_BigInt, full_off_procNodes, HYPRE_MEMORY_HOST);
       tmp_CF_marker_offd  = hypre_CTAlloc(HYPRE_Int,    full_off_procNodes, HYPRE_MEMORY_HOST);
    }
@@ -205,125 +246,156 @@ hypre_BoomerAMGBuildStdInterp(hypre_ParCSRMatrix  *A,
                          fine_to_coarse_offd, P_marker, P_marker_offd,
                          tmp_CF_marker_offd);
 
-   jj_counter = start_indexing;
-   jj_counter_offd = start_indexing;
-   coarse_counter = 0;
-
    /*-----------------------------------------------------------------------
-    *  Loop over fine grid.
+    *  Loop over fine grid.  Each thread handles a contiguous range of rows
+    *  with its own marker arrays: it first counts the entries of its rows of
+    *  P, the row pointers are then shifted by the counts of the preceding
+    *  threads, and finally each thread fills its rows.  P does not depend on
+    *  the number of threads.
     *-----------------------------------------------------------------------*/
-   for (i = 0; i < n_fine; i++)
+   workspace = hypre_TAlloc(HYPRE_Int, 3 * (hypre_NumThreads() + 1), HYPRE_MEMORY_HOST);
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel private(i, start, stop, coarse_counter, jj_counter, jj_counter_offd, \
+                               P_marker, P_marker_offd, ahat, ihat, ipnt, ahat_offd, ihat_offd, \
+                               ipnt_offd, jj, kk, i1, j1, k1, loc_col, indx, jj_begin_row, \
+                               jj_begin_row_offd, jj_end_row, jj_end_row_offd, cnt_c, cnt_f, \
+                               cnt_c_offd, cnt_f_offd, sum_pos, sum_pos_C, sum_neg, sum_neg_C, sum, \
+                               sum_C, diagonal, distribute, alfa, beta, strong_f_marker, big_k1)
+#endif
    {
-      P_diag_i[i] = jj_counter;
-      if (num_procs > 1)
+      /* initialize thread-wise variables */
+      strong_f_marker = -2;
+      coarse_counter = 0;
+      jj_counter = start_indexing;
+      jj_counter_offd = start_indexing;
+      P_marker = hypre_TAlloc(HYPRE_Int, n_fine, HYPRE_MEMORY_HOST);
+      P_marker_offd = hypre_TAlloc(HYPRE_Int, full_off_procNodes, HYPRE_MEMORY_HOST);
+      for (i = 0; i < n_fine; i++)
       {
-         P_offd_i[i] = jj_counter_offd;
+         P_marker[i] = -1;
       }
-
-      if (CF_marker[i] >= 0)
+      for (i = 0; i < full_off_procNodes; i++)
       {
-         jj_counter++;
-         fine_to_coarse[i] = coarse_counter;
-         coarse_counter++;
+         P_marker_offd[i] = -1;
       }
-      /*--------------------------------------------------------------------
-       *  If i is an F-point, interpolation is from the C-points that
-       *  strongly influence i, or C-points that stronly influence F-points
-       *  that strongly influence i.
-       *--------------------------------------------------------------------*/
-      else if (CF_marker[i] != -3)
+
+      /* this thread's row range */
+      hypre_GetSimpleThreadPartition(&start, &stop, n_fine);
+
+      for (i = start; i < stop; i++)
       {
-         for (jj = S_diag_i[i]; jj < S_diag_i[i + 1]; jj++)
+         P_diag_i[i] = jj_counter;
+         if (num_procs > 1)
          {
-            i1 = S_diag_j[jj];
-            if (CF_marker[i1] >= 0)
+            P_offd_i[i] = jj_counter_offd;
+         }
+
+         if (CF_marker[i] >= 0)
+         {
+            jj_counter++;
+            fine_to_coarse[i] = coarse_counter;
+            coarse_counter++;
+         }
+         /*--------------------------------------------------------------------
+          *  If i is an F-point, interpolation is from the C-points that
+          *  strongly influence i, or C-points that stronly influence F-points
+          *  that strongly influence i.
+          *--------------------------------------------------------------------*/
+         else if (CF_marker[i] != -3)
+         {
+            for (jj = S_diag_i[i]; jj < S_diag_i[i + 1]; jj++)
             {
-               /* i1 is a C point */
-               if (P_marker[i1] < P_diag_i[i])
+               i1 = S_diag_j[jj];
+               if (CF_marker[i1] >= 0)
                {
-                  P_marker[i1] = jj_counter;
-                  jj_counter++;
+                  /* i1 is a C point */
+                  if (P_marker[i1] < P_diag_i[i])
+                  {
+                     P_marker[i1] = jj_counter;
+                     jj_counter++;
+                  }
                }
-            }
-            else if (CF_marker[i1] != -3)
-            {
-               /* i1 is a F point, loop through it's strong neighbors */
-               for (kk = S_diag_i[i1]; kk < S_diag_i[i1 + 1]; kk++)
+               else if (CF_marker[i1] != -3)
                {
-                  k1 = S_diag_j[kk];
-                  if (CF_marker[k1] >= 0)
+                  /* i1 is a F point, loop through it's strong neighbors */
+                  for (kk = S_diag_i[i1]; kk < S_diag_i[i1 + 1]; kk++)
                   {
-                     if (P_marker[k1] < P_diag_i[i])
+                     k1 = S_diag_j[kk];
+                     if (CF_marker[k1] >= 0)
                      {
-                        P_marker[k1] = jj_counter;
-                        jj_counter++;
+                        if (P_marker[k1] < P_diag_i[i])
+                        {
+                           P_marker[k1] = jj_counter;
+                           jj_counter++;
+                        }
                      }
                   }
-               }
-               if (num_procs > 1)
-               {
-                  for (kk = S_offd_i[i1]; kk < S_offd_i[i1 + 1]; kk++)
+                  if (num_procs > 1)
                   {
-                     k1 = S_offd_j[kk];
-                     if (CF_marker_offd[k1] >= 0)
+                     for (kk = S_offd_i[i1]; kk < S_offd_i[i1 + 1]; kk++)
                      {
-                        if (P_marker_offd[k1] < P_offd_i[i])
+                        k1 = S_offd_j[kk];
+                        if (CF_marker_offd[k1] >= 0)
                         {
-                           tmp_CF_marker_offd[k1] = 1;
-                           P_marker_offd[k1] = jj_counter_offd;
-                           jj_counter_offd++;
+                           if (P_marker_offd[k1] < P_offd_i[i])
+                           {
+                              tmp_CF_marker_offd[k1] = 1;
+                              P_marker_offd[k1] = jj_counter_offd;
+                              jj_counter_offd++;
+                           }
                         }
                      }
                   }
                }
             }
-         }
-         /* Look at off diag strong connections of i */
-         if (num_procs > 1)
-         {
-            for (jj = S_offd_i[i]; jj < S_offd_i[i + 1]; jj++)
+            /* Look at off diag strong connections of i */
+            if (num_procs > 1)
             {
-               i1 = S_offd_j[jj];
-               if (CF_marker_offd[i1] >= 0)
+               for (jj = S_offd_i[i]; jj < S_offd_i[i + 1]; jj++)
                {
-                  if (P_marker_offd[i1] < P_offd_i[i])
+                  i1 = S_offd_j[jj];
+                  if (CF_marker_offd[i1] >= 0)
                   {
-                     tmp_CF_marker_offd[i1] = 1;
-                     P_marker_offd[i1] = jj_counter_offd;
-                     jj_counter_offd++;
+                     if (P_marker_offd[i1] < P_offd_i[i])
+                     {
+                        tmp_CF_marker_offd[i1] = 1;
+                        P_marker_offd[i1] = jj_counter_offd;
+                        jj_counter_offd++;
+                     }
                   }
-               }
-               else if (CF_marker_offd[i1] != -3)
-               {
-                  /* F point; look at neighbors of i1. Sop contains global col
-                  * numbers and entries that could be in S_diag or S_offd or
-                  * neither. */
-                  for (kk = Sop_i[i1]; kk < Sop_i[i1 + 1]; kk++)
+                  else if (CF_marker_offd[i1] != -3)
                   {
-                     big_k1 = Sop_j[kk];
-                     if (big_k1 >= col_1 && big_k1 < col_n)
+                     /* F point; look at neighbors of i1. Sop contains global col
+                     * numbers and entries that could be in S_diag or S_offd or
+                     * neither. */
+                     for (kk = Sop_i[i1]; kk < Sop_i[i1 + 1]; kk++)
                      {
-                        /* In S_diag */
-                        loc_col = (HYPRE_Int)(big_k1 - col_1);
-                        if (CF_marker[loc_col] >= 0)
+                        big_k1 = Sop_j[kk];
+                        if (big_k1 >= col_1 && big_k1 < col_n)
                         {
-                           if (P_marker[loc_col] < P_diag_i[i])
+                           /* In S_diag */
+                           loc_col = (HYPRE_Int)(big_k1 - col_1);
+                           if (CF_marker[loc_col] >= 0)
                            {
-                              P_marker[loc_col] = jj_counter;
-                              jj_counter++;
+                              if (P_marker[loc_col] < P_diag_i[i])
+                              {
+                                 P_marker[loc_col] = jj_counter;
+                                 jj_counter++;
+                              }
                            }
                         }
-                     }
-                     else
-                     {
-                        loc_col = (HYPRE_Int)(-big_k1 - 1);
-                        if (CF_marker_offd[loc_col] >= 0)
+                        else
                         {
-                           if (P_marker_offd[loc_col] < P_offd_i[i])
+                           loc_col = (HYPRE_Int)(-big_k1 - 1);
+                           if (CF_marker_offd[loc_col] >= 0)
                            {
-                              P_marker_offd[loc_col] = jj_counter_offd;
-                              tmp_CF_marker_offd[loc_col] = 1;
-                              jj_counter_offd++;
+                              if (P_marker_offd[loc_col] < P_offd_i[i])
+                              {
+                                 P_marker_offd[loc_col] = jj_counter_offd;
+                                 tmp_CF_marker_offd[loc_col] = 1;
+                                 jj_counter_offd++;
+                              }
                            }
                         }
                      }
@@ -332,207 +404,151 @@ hypre_BoomerAMGBuildStdInterp(hypre_ParCSRMatrix  *A,
             }
          }
       }
-   }
-
-   if (debug_flag == 4)
-   {
-      wall_time = time_getWallclockSeconds() - wall_time;
-      hypre_printf("Proc = %d     determine structure    %f\n",
-                   my_id, wall_time);
-      fflush(NULL);
-   }
-   /*-----------------------------------------------------------------------
-    *  Allocate  arrays.
-    *-----------------------------------------------------------------------*/
 
+      /* Stitch P_diag_i, P_offd_i and fine_to_coarse together */
+      hypre_BoomerAMGInterpShiftRows(start, stop, n_fine, jj_counter, jj_counter_offd,
+                                     coarse_counter, P_diag_i, P_offd_i, fine_to_coarse,
+                                     workspace);
 
-   P_diag_size = jj_counter;
-   P_offd_size = jj_counter_offd;
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp master
+#endif
+      {
+         if (debug_flag == 4)
+         {
+            wall_time = time_getWallclockSeconds() - wall_time;
+            hypre_printf("Proc = %d     determine structure    %f\n",
+                         my_id, wall_time);
+            fflush(NULL);
+            wall_time = time_getWallclockSeconds();
+         }
 
-   if (P_diag_size)
-   {
-      P_diag_j    = hypre_CTAlloc(HYPRE_Int,  P_diag_size, memory_location_P);
-      P_diag_data = hypre_CTAlloc(HYPRE_Real, P_diag_size, memory_location_P);
-   }
+         /*-----------------------------------------------------------------------
+          *  Allocate  arrays.
+          *-----------------------------------------------------------------------*/
 
-   if (P_offd_size)
-   {
-      P_offd_j    = hypre_CTAlloc(HYPRE_Int,  P_offd_size, memory_location_P);
-      P_offd_data = hypre_CTAlloc(HYPRE_Real, P_offd_size, memory_location_P);
-   }
+         P_diag_size = P_diag_i[n_fine];
+         P_offd_size = P_offd_i[n_fine];
 
-   P_diag_i[n_fine] = jj_counter;
-   P_offd_i[n_fine] = jj_counter_offd;
+         if (P_diag_size)
+         {
+            P_diag_j    = hypre_CTAlloc(HYPRE_Int,  P_diag_size, memory_location_P);
+            P_diag_data = hypre_CTAlloc(HYPRE_Real, P_diag_size, memory_location_P);
+         }
 
-   jj_counter = start_indexing;
-   jj_counter_offd = start_indexing;
+         if (P_offd_size)
+         {
+            P_offd_j    = hypre_CTAlloc(HYPRE_Int,  P_offd_size, memory_location_P);
+            P_offd_data = hypre_CTAlloc(HYPRE_Real, P_offd_size, memory_location_P);
+         }
 
-   /* Fine to coarse mapping */
-   if (num_procs > 1)
-   {
-      hypre_big_insert_new_nodes(comm_pkg, extend_comm_pkg, fine_to_coarse,
-                                 full_off_procNodes, my_first_cpt,
-                                 fine_to_coarse_offd);
-   }
+         /* Fine to coarse mapping */
+         if (num_procs > 1)
+         {
+            hypre_big_insert_new_nodes(comm_pkg, extend_comm_pkg, fine_to_coarse,
+                                       full_off_procNodes, my_first_cpt,
+                                       fine_to_coarse_offd);
+         }
+      }
 
-   /* Initialize ahat, which is a modification to a, used in the standard
-    * interpolation routine. */
-   if (n_fine)
-   {
-      ahat = hypre_CTAlloc(HYPRE_Real, n_fine, HYPRE_MEMORY_HOST);
-      ihat = hypre_CTAlloc(HYPRE_Int,  n_fine, HYPRE_MEMORY_HOST);
-      ipnt = hypre_CTAlloc(HYPRE_Int,  n_fine, HYPRE_MEMORY_HOST);
-   }
-   if (full_off_procNodes)
-   {
+      /* Initialize ahat, which is a modification to a, used in the standard
+       * interpolation routine. */
+      ahat      = hypre_CTAlloc(HYPRE_Real, n_fine, HYPRE_MEMORY_HOST);
+      ihat      = hypre_TAlloc(HYPRE_Int,   n_fine, HYPRE_MEMORY_HOST);
+      ipnt      = hypre_TAlloc(HYPRE_Int,   n_fine, HYPRE_MEMORY_HOST);
       ahat_offd = hypre_CTAlloc(HYPRE_Real, full_off_procNodes, HYPRE_MEMORY_HOST);
-      ihat_offd = hypre_CTAlloc(HYPRE_Int,  full_off_procNodes, HYPRE_MEMORY_HOST);
-      ipnt_offd = hypre_CTAlloc(HYPRE_Int,  full_off_procNodes, HYPRE_MEMORY_HOST);
-   }
+      ihat_offd = hypre_TAlloc(HYPRE_Int,   full_off_procNodes, HYPRE_MEMORY_HOST);
+      ipnt_offd = hypre_TAlloc(HYPRE_Int,   full_off_procNodes, HYPRE_MEMORY_HOST);
 
-   for (i = 0; i < n_fine; i++)
-   {
-      P_marker[i] = -1;
-      ahat[i] = 0;
-      ihat[i] = -1;
-   }
-   for (i = 0; i < full_off_procNodes; i++)
-   {
-      P_marker_offd[i] = -1;
-      ahat_offd[i] = 0;
-      ihat_offd[i] = -1;
-   }
-
-   /*-----------------------------------------------------------------------
-    *  Loop over fine grid points.
-    *-----------------------------------------------------------------------*/
-   for (i = 0; i < n_fine; i++)
-   {
-      jj_begin_row = jj_counter;
-      if (num_procs > 1)
+      for (i = 0; i < n_fine; i++)
       {
-         jj_begin_row_offd = jj_counter_offd;
+         P_marker[i] = -1;
+         ihat[i] = -1;
       }
-
-      /*--------------------------------------------------------------------
-       *  If i is a c-point, interpolation is the identity.
-       *--------------------------------------------------------------------*/
-
-      if (CF_marker[i] >= 0)
+      for (i = 0; i < full_off_procNodes; i++)
       {
-         P_diag_j[jj_counter]    = fine_to_coarse[i];
-         P_diag_data[jj_counter] = one;
-         jj_counter++;
+         P_marker_offd[i] = -1;
+         ihat_offd[i] = -1;
       }
 
-      /*--------------------------------------------------------------------
-       *  If i is an F-point, build interpolation.
-       *--------------------------------------------------------------------*/
-
-      else if (CF_marker[i] != -3)
+      /*-----------------------------------------------------------------------
+       *  Loop over fine grid points.
+       *-----------------------------------------------------------------------*/
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp barrier
+#endif
+      for (i = start; i < stop; i++)
       {
-         if (debug_flag == 4) { wall_time = time_getWallclockSeconds(); }
-         strong_f_marker--;
-         for (jj = S_diag_i[i]; jj < S_diag_i[i + 1]; jj++)
-         {
-            i1 = S_diag_j[jj];
+         jj_begin_row = P_diag_i[i];
+         jj_begin_row_offd = P_offd_i[i];
+         jj_counter = jj_begin_row;
+         jj_counter_offd = jj_begin_row_offd;
 
-            /*--------------------------------------------------------------
-             * If neighbor i1 is a C-point, set column number in P_diag_j
-             * and initialize interpolation weight to zero.
-             *--------------------------------------------------------------*/
+         /*--------------------------------------------------------------------
+          *  If i is a c-point, interpolation is the identity.
+          *--------------------------------------------------------------------*/
 
-            if (CF_marker[i1] >= 0)
-            {
-               if (P_marker[i1] < jj_begin_row)
-               {
-                  P_marker[i1] = jj_counter;
-                  P_diag_j[jj_counter]    = i1;
-                  P_diag_data[jj_counter] = zero;
-                  jj_counter++;
-               }
-            }
-            else  if (CF_marker[i1] != -3)
-            {
-               P_marker[i1] = strong_f_marker;
-               for (kk = S_diag_i[i1]; kk < S_diag_i[i1 + 1]; kk++)
-               {
-                  k1 = S_diag_j[kk];
-                  if (CF_marker[k1] >= 0)
-                  {
-                     if (P_marker[k1] < jj_begin_row)
-                     {
-                        P_marker[k1] = jj_counter;
-                        P_diag_j[jj_counter] = k1;
-                        P_diag_data[jj_counter] = zero;
-                        jj_counter++;
-                     }
-                  }
-               }
-               if (num_procs > 1)
-               {
-                  for (kk = S_offd_i[i1]; kk < S_offd_i[i1 + 1]; kk++)
-                  {
-                     k1 = S_offd_j[kk];
-                     if (CF_marker_offd[k1] >= 0)
-                     {
-                        if (P_marker_offd[k1] < jj_begin_row_offd)
-                        {
-                           P_marker_offd[k1] = jj_counter_offd;
-                           P_offd_j[jj_counter_offd] = k1;
-                           P_offd_data[jj_counter_offd] = zero;
-                           jj_counter_offd++;
-                        }
-                     }
-                  }
-               }
-            }
+         if (CF_marker[i] >= 0)
+         {
+            P_diag_j[jj_counter]    = fine_to_coarse[i];
+            P_diag_data[jj_counter] = one;
+            jj_counter++;
          }
 
-         if ( num_procs > 1)
+         /*--------------------------------------------------------------------
+          *  If i is an F-point, build interpolation.
+          *--------------------------------------------------------------------*/
+
+         else if (CF_marker[i] != -3)
          {
-            for (jj = S_offd_i[i]; jj < S_offd_i[i + 1]; jj++)
+            strong_f_marker--;
+            for (jj = S_diag_i[i]; jj < S_diag_i[i + 1]; jj++)
             {
-               i1 = S_offd_j[jj];
-               if ( CF_marker_offd[i1] >= 0)
+               i1 = S_diag_j[jj];
+
+               /*--------------------------------------------------------------
+                * If neighbor i1 is a C-point, set column number in P_diag_j
+                * and initialize interpolation weight to zero.
+                *--------------------------------------------------------------*/
+
+               if (CF_marker[i1] >= 0)
                {
-                  if (P_marker_offd[i1] < jj_begin_row_offd)
+                  if (P_marker[i1] < jj_begin_row)
                   {
-                     P_marker_offd[i1] = jj_counter_offd;
-                     P_offd_j[jj_counter_offd] = i1;
-                     P_offd_data[jj_counter_offd] = zero;
-                     jj_counter_offd++;
+                     P_marker[i1] = jj_counter;
+                     P_diag_j[jj_counter]    = i1;
+                     P_diag_data[jj_counter] = zero;
+                     jj_counter++;
                   }
                }
-               else if (CF_marker_offd[i1] != -3)
+               else  if (CF_marker[i1] != -3)
                {
-                  P_marker_offd[i1] = strong_f_marker;
-                  for (kk = Sop_i[i1]; kk < Sop_i[i1 + 1]; kk++)
+                  P_marker[i1] = strong_f_marker;
+                  for (kk = S_diag_i[i1]; kk < S_diag_i[i1 + 1]; kk++)
                   {
-                     big_k1 = Sop_j[kk];
-                     if (big_k1 >= col_1 && big_k1 < col_n)
+                     k1 = S_diag_j[kk];
+                     if (CF_marker[k1] >= 0)
                      {
-                        loc_col = (HYPRE_Int)(big_k1 - col_1);
-                        if (CF_marker[loc_col] >= 0)
+                        if (P_marker[k1] < jj_begin_row)
                         {
-                           if (P_marker[loc_col] < jj_begin_row)
-                           {
-                              P_marker[loc_col] = jj_counter;
-                              P_diag_j[jj_counter] = loc_col;
-                              P_diag_data[jj_counter] = zero;
-                              jj_counter++;
-                           }
+                           P_marker[k1] = jj_counter;
+                           P_diag_j[jj_counter] = k1;
+                           P_diag_data[jj_counter] = zero;
+                           jj_counter++;
                         }
                      }
-                     else
+                  }
+                  if (num_procs > 1)
+                  {
+                     for (kk = S_offd_i[i1]; kk < S_offd_i[i1 + 1]; kk++)
                      {
-                        loc_col = (HYPRE_Int)(-big_k1 - 1);
-                        if (CF_marker_offd[loc_col] >= 0)
+                        k1 = S_offd_j[kk];
+                        if (CF_marker_offd[k1] >= 0)
                         {
-                           if (P_marker_offd[loc_col] < jj_begin_row_offd)
+                           if (P_marker_offd[k1] < jj_begin_row_offd)
                            {
-                              P_marker_offd[loc_col] = jj_counter_offd;
-                              P_offd_j[jj_counter_offd] = loc_col;
+                              P_marker_offd[k1] = jj_counter_offd;
+                              P_offd_j[jj_counter_offd] = k1;
                               P_offd_data[jj_counter_offd] = zero;
                               jj_counter_offd++;
                            }
@@ -541,184 +557,144 @@ hypre_BoomerAMGBuildStdInterp(hypre_ParCSRMatrix  *A,
                   }
                }
             }
-         }
 
-         jj_end_row = jj_counter;
-         jj_end_row_offd = jj_counter_offd;
-
-         if (debug_flag == 4)
-         {
-            wall_time = time_getWallclockSeconds() - wall_time;
-            wall_1 += wall_time;
-            fflush(NULL);
-         }
-         if (debug_flag == 4)
-         {
-            wall_time = time_getWallclockSeconds();
-         }
-         cnt_c = 0;
-         cnt_f = jj_end_row - jj_begin_row;
-         cnt_c_offd = 0;
-         cnt_f_offd = jj_end_row_offd - jj_begin_row_offd;
-         ihat[i] = cnt_f;
-         ipnt[cnt_f] = i;
-         ahat[cnt_f++] = A_diag_data[A_diag_i[i]];
-         for (jj = A_diag_i[i] + 1; jj < A_diag_i[i + 1]; jj++)
-         {
-            /* i1 is direct neighbor */
-            i1 = A_diag_j[jj];
-            if (P_marker[i1] != strong_f_marker)
-            {
-               indx = ihat[i1];
-               if (indx > -1)
-               {
-                  ahat[indx] += A_diag_data[jj];
-               }
-               else if (P_marker[i1] >= jj_begin_row)
-               {
-                  ihat[i1] = cnt_c;
-                  ipnt[cnt_c] = i1;
-                  ahat[cnt_c++] += A_diag_data[jj];
-               }
-               else if (CF_marker[i1] != -3)
-               {
-                  ihat[i1] = cnt_f;
-                  ipnt[cnt_f] = i1;
-                  ahat[cnt_f++] += A_diag_data[jj];
-               }
-            }
-            else
+            if ( num_procs > 1)
             {
-               if (num_functions == 1 || dof_func[i] == dof_func[i1])
+               for (jj = S_offd_i[i]; jj < S_offd_i[i + 1]; jj++)
                {
-                  distribute = A_diag_data[jj] / A_diag_data[A_diag_i[i1]];
-                  for (kk = A_diag_i[i1] + 1; kk < A_diag_i[i1 + 1]; kk++)
+                  i1 = S_offd_j[jj];
+                  if ( CF_marker_offd[i1] >= 0)
                   {
-                     k1 = A_diag_j[kk];
-                     indx = ihat[k1];
-                     if (indx > -1)
-                     {
-                        ahat[indx] -= A_diag_data[kk] * distribute;
-                     }
-                     else if (P_marker[k1] >= jj_begin_row)
-                     {
-                        ihat[k1] = cnt_c;
-                        ipnt[cnt_c] = k1;
-                        ahat[cnt_c++] -= A_diag_data[kk] * distribute;
-                     }
-                     else
+                     if (P_marker_offd[i1] < jj_begin_row_offd)
                      {
-                        ihat[k1] = cnt_f;
-                        ipnt[cnt_f] = k1;
-                        ahat[cnt_f++] -= A_diag_data[kk] * distribute;
+                        P_marker_offd[i1] = jj_counter_offd;
+                        P_offd_j[jj_counter_offd] = i1;
+                        P_offd_data[jj_counter_offd] = zero;
+                        jj_counter_offd++;
                      }
                   }
-                  if (num_procs > 1)
+                  else if (CF_marker_offd[i1] != -3)
                   {
-                     for (kk = A_offd_i[i1]; kk < A_offd_i[i1 + 1]; kk++)
+                     P_marker_offd[i1] = strong_f_marker;
+                     for (kk = Sop_i[i1]; kk < Sop_i[i1 + 1]; kk++)
                      {
-                        k1 = A_offd_j[kk];
-                        indx = ihat_offd[k1];
-                        if (num_functions == 1 || dof_func[i1] == dof_func_offd[k1])
+                        big_k1 = Sop_j[kk];
+                        if (big_k1 >= col_1 && big_k1 < col_n)
                         {
-                           if (indx > -1)
-                           {
-                              ahat_offd[indx] -= A_offd_data[kk] * distribute;
-                           }
-                           else if (P_marker_offd[k1] >= jj_begin_row_offd)
+                           loc_col = (HYPRE_Int)(big_k1 - col_1);
+                           if (CF_marker[loc_col] >= 0)
                            {
-                              ihat_offd[k1] = cnt_c_offd;
-                              ipnt_offd[cnt_c_offd] = k1;
-                              ahat_offd[cnt_c_offd++] -= A_offd_data[kk] * distribute;
+                              if (P_marker[loc_col] < jj_begin_row)
+                              {
+                                 P_marker[loc_col] = jj_counter;
+                                 P_diag_j[jj_counter] = loc_col;
+                                 P_diag_data[jj_counter] = zero;
+                                 jj_counter++;
+                              }
                            }
-                           else
+                        }
+                        else
+                        {
+                           loc_col = (HYPRE_Int)(-big_k1 - 1);
+                           if (CF_marker_offd[loc_col] >= 0)
                            {
-                              ihat_offd[k1] = cnt_f_offd;
-                              ipnt_offd[cnt_f_offd] = k1;
-                              ahat_offd[cnt_f_offd++] -= A_offd_data[kk] * distribute;
+                              if (P_marker_offd[loc_col] < jj_begin_row_offd)
+                              {
+                                 P_marker_offd[loc_col] = jj_counter_offd;
+                                 P_offd_j[jj_counter_offd] = loc_col;
+                                 P_offd_data[jj_counter_offd] = zero;
+                                 jj_counter_offd++;
+                              }
                            }
                         }
                      }
                   }
                }
             }
-         }
-         if (num_procs > 1)
-         {
-            for (jj = A_offd_i[i]; jj < A_offd_i[i + 1]; jj++)
+
+            jj_end_row = jj_counter;
+            jj_end_row_offd = jj_counter_offd;
+
+            cnt_c = 0;
+            cnt_f = jj_end_row - jj_begin_row;
+            cnt_c_offd = 0;
+            cnt_f_offd = jj_end_row_offd - jj_begin_row_offd;
+            ihat[i] = cnt_f;
+            ipnt[cnt_f] = i;
+            ahat[cnt_f++] = A_diag_data[A_diag_i[i]];
+            for (jj = A_diag_i[i] + 1; jj < A_diag_i[i + 1]; jj++)
             {
-               i1 = A_offd_j[jj];
-               if (P_marker_offd[i1] != strong_f_marker)
+               /* i1 is direct neighbor */
+               i1 = A_diag_j[jj];
+               if (P_marker[i1] != strong_f_marker)
                {
-                  indx = ihat_offd[i1];
+                  indx = ihat[i1];
                   if (indx > -1)
                   {
-                     ahat_offd[indx] += A_offd_data[jj];
+                     ahat[indx] += A_diag_data[jj];
                   }
-                  else if (P_marker_offd[i1] >= jj_begin_row_offd)
+                  else if (P_marker[i1] >= jj_begin_row)
                   {
-                     ihat_offd[i1] = cnt_c_offd;
-                     ipnt_offd[cnt_c_offd] = i1;
-                     ahat_offd[cnt_c_offd++] += A_offd_data[jj];
+                     ihat[i1] = cnt_c;
+                     ipnt[cnt_c] = i1;
+                     ahat[cnt_c++] += A_diag_data[jj];
                   }
-                  else if (CF_marker_offd[i1] != -3)
+                  else if (CF_marker[i1] != -3)
                   {
-                     ihat_offd[i1] = cnt_f_offd;
-                     ipnt_offd[cnt_f_offd] = i1;
-                     ahat_offd[cnt_f_offd++] += A_offd_data[jj];
+                     ihat[i1] = cnt_f;
+                     ipnt[cnt_f] = i1;
+                     ahat[cnt_f++] += A_diag_data[jj];
                   }
                }
                else
                {
-                  if (num_functions == 1 || dof_func[i] == dof_func_offd[i1])
+                  if (num_functions == 1 || dof_func[i] == dof_func[i1])
                   {
-                     distribute = A_offd_data[jj] / A_ext_data[A_ext_i[i1]];
-                     for (kk = A_ext_i[i1] + 1; kk < A_ext_i[i1 + 1]; kk++)
+                     distribute = A_diag_data[jj] / A_diag_data[A_diag_i[i1]];
+                     for (kk = A_diag_i[i1] + 1; kk < A_diag_i[i1 + 1]; kk++)
                      {
-                        big_k1 = A_ext_j[kk];
-                        if (big_k1 >= col_1 && big_k1 < col_n)
+                        k1 = A_diag_j[kk];
+                        indx = ihat[k1];
+                        if (indx > -1)
                         {
-                           /*diag*/
-                           loc_col = (HYPRE_Int)(big_k1 - col_1);
-                           indx = ihat[loc_col];
-                           if (indx > -1)
-                           {
-                              ahat[indx] -= A_ext_data[kk] * distribute;
-                           }
-                           else if (P_marker[loc_col] >= jj_begin_row)
-                           {
-                              ihat[loc_col] = cnt_c;
-                              ipnt[cnt_c] = loc_col;
-                              ahat[cnt_c++] -= A_ext_data[kk] * distribute;
-                           }
-                           else
-                           {
-                              ihat[loc_col] = cnt_f;
-                              ipnt[cnt_f] = loc_col;
-                              ahat[cnt_f++] -= A_ext_data[kk] * distribute;
-                           }
+                           ahat[indx] -= A_diag_data[kk] * distribute;
+                        }
+                        else if (P_marker[k1] >= jj_begin_row)
+                        {
+                           ihat[k1] = cnt_c;
+                           ipnt[cnt_c] = k1;
+                           ahat[cnt_c++] -= A_diag_data[kk] * distribute;
                         }
                         else
                         {
-                           loc_col = (HYPRE_Int)(-big_k1 - 1);
-                           if (num_functions == 1 || dof_func_offd[loc_col] == dof_func_offd[i1])
+                           ihat[k1] = cnt_f;
+                           ipnt[cnt_f] = k1;
+                           ahat[cnt_f++] -= A_diag_data[kk] * distribute;
+                        }
+                     }
+                     if (num_procs > 1)
+                     {
+                        for (kk = A_offd_i[i1]; kk < A_offd_i[i1 + 1]; kk++)
+                        {
+                           k1 = A_offd_j[kk];
+                           indx = ihat_offd[k1];
+                           if (num_functions == 1 || dof_func[i1] == dof_func_offd[k1])
                            {
-                              indx = ihat_offd[loc_col];
                               if (indx > -1)
                               {
-                                 ahat_offd[indx] -= A_ext_data[kk] * distribute;
+                                 ahat_offd[indx] -= A_offd_data[kk] * distribute;
                               }
-                              else if (P_marker_offd[loc_col] >= jj_begin_row_offd)
+                              else if (P_marker_offd[k1] >= jj_begin_row_offd)
                               {
-                                 ihat_offd[loc_col] = cnt_c_offd;
-                                 ipnt_offd[cnt_c_offd] = loc_col;
-                                 ahat_offd[cnt_c_offd++] -= A_ext_data[kk] * distribute;
+                                 ihat_offd[k1] = cnt_c_offd;
+                                 ipnt_offd[cnt_c_offd] = k1;
+                                 ahat_offd[cnt_c_offd++] -= A_offd_data[kk] * distribute;
                               }
                               else
                               {
-                                 ihat_offd[loc_col] = cnt_f_offd;
-                                 ipnt_offd[cnt_f_offd] = loc_col;
-                                 ahat_offd[cnt_f_offd++] -= A_ext_data[kk] * distribute;
+                                 ihat_offd[k1] = cnt_f_offd;
+                                 ipnt_offd[cnt_f_offd] = k1;
+                                 ahat_offd[cnt_f_offd++] -= A_offd_data[kk] * distribute;
                               }
                            }
                         }
@@ -726,209 +702,293 @@ hypre_BoomerAMGBuildStdInterp(hypre_ParCSRMatrix  *A,
                   }
                }
             }
-         }
-         if (debug_flag == 4)
-         {
-            wall_time = time_getWallclockSeconds() - wall_time;
-            wall_2 += wall_time;
-            fflush(NULL);
-         }
-
-         if (debug_flag == 4) { wall_time = time_getWallclockSeconds(); }
-         diagonal = ahat[cnt_c];
-         ahat[cnt_c] = 0;
-         sum_pos = 0;
-         sum_pos_C = 0;
-         sum_neg = 0;
-         sum_neg_C = 0;
-         sum = 0;
-         sum_C = 0;
-         if (sep_weight == 1)
-         {
-            for (jj = 0; jj < cnt_c; jj++)
-            {
-               if (ahat[jj] > 0)
-               {
-                  sum_pos_C += ahat[jj];
-               }
-               else
-               {
-                  sum_neg_C += ahat[jj];
-               }
-            }
             if (num_procs > 1)
             {
-               for (jj = 0; jj < cnt_c_offd; jj++)
+               for (jj = A_offd_i[i]; jj < A_offd_i[i + 1]; jj++)
                {
-                  if (ahat_offd[jj] > 0)
+                  i1 = A_offd_j[jj];
+                  if (P_marker_offd[i1] != strong_f_marker)
                   {
-                     sum_pos_C += ahat_offd[jj];
+                     indx = ihat_offd[i1];
+                     if (indx > -1)
+                     {
+                        ahat_offd[indx] += A_offd_data[jj];
+                     }
+                     else if (P_marker_offd[i1] >= jj_begin_row_offd)
+                     {
+                        ihat_offd[i1] = cnt_c_offd;
+                        ipnt_offd[cnt_c_offd] = i1;
+                        ahat_offd[cnt_c_offd++] += A_offd_data[jj];
+                     }
+                     else if (CF_marker_offd[i1] != -3)
+                     {
+                        ihat_offd[i1] = cnt_f_offd;
+                        ipnt_offd[cnt_f_offd] = i1;
+                        ahat_offd[cnt_f_offd++] += A_offd_data[jj];
+                     }
                   }
                   else
                   {
-                     sum_neg_C += ahat_offd[jj];
+                     if (num_functions == 1 || dof_func[i] == dof_func_offd[i1])
+                     {
+                        distribute = A_offd_data[jj] / A_ext_data[A_ext_i[i1]];
+                        for (kk = A_ext_i[i1] + 1; kk < A_ext_i[i1 + 1]; kk++)
+                        {
+                           big_k1 = A_ext_j[kk];
+                           if (big_k1 >= col_1 && big_k1 < col_n)
+                           {
+                              /*diag*/
+                              loc_col = (HYPRE_Int)(big_k1 - col_1);
+                              indx = ihat[loc_col];
+                              if (indx > -1)
+                              {
+                                 ahat[indx] -= A_ext_data[kk] * distribute;
+                              }
+                              else if (P_marker[loc_col] >= jj_begin_row)
+                              {
+                                 ihat[loc_col] = cnt_c;
+                                 ipnt[cnt_c] = loc_col;
+                                 ahat[cnt_c++] -= A_ext_data[kk] * distribute;
+                              }
+                              else
+                              {
+                                 ihat[loc_col] = cnt_f;
+                                 ipnt[cnt_f] = loc_col;
+                                 ahat[cnt_f++] -= A_ext_data[kk] * distribute;
+                              }
+                           }
+                           else
+                           {
+                              loc_col = (HYPRE_Int)(-big_k1 - 1);
+                              if (num_functions == 1 || dof_func_offd[loc_col] == dof_func_offd[i1])
+                              {
+                                 indx = ihat_offd[loc_col];
+                                 if (indx > -1)
+                                 {
+                                    ahat_offd[indx] -= A_ext_data[kk] * distribute;
+                                 }
+                                 else if (P_marker_offd[loc_col] >= jj_begin_row_offd)
+                                 {
+                                    ihat_offd[loc_col] = cnt_c_offd;
+                                    ipnt_offd[cnt_c_offd] = loc_col;
+                                    ahat_offd[cnt_c_offd++] -= A_ext_data[kk] * distribute;
+                                 }
+                                 else
+                                 {
+                                    ihat_offd[loc_col] = cnt_f_offd;
+                                    ipnt_offd[cnt_f_offd] = loc_col;
+                                    ahat_offd[cnt_f_offd++] -= A_ext_data[kk] * distribute;
+                                 }
+                              }
+                           }
+                        }
+                     }
                   }
                }
             }
-            sum_pos = sum_pos_C;
-            sum_neg = sum_neg_C;
-            for (jj = cnt_c + 1; jj < cnt_f; jj++)
+
+            diagonal = ahat[cnt_c];
+            ahat[cnt_c] = 0;
+            sum_pos = 0;
+            sum_pos_C = 0;
+            sum_neg = 0;
+            sum_neg_C = 0;
+            sum = 0;
+            sum_C = 0;
+            alfa = 1.;
+            beta = 1.;
+            if (sep_weight == 1)
             {
-               if (ahat[jj] > 0)
+               for (jj = 0; jj < cnt_c; jj++)
                {
-                  sum_pos += ahat[jj];
+                  if (ahat[jj] > 0)
+                  {
+                     sum_pos_C += ahat[jj];
+                  }
+                  else
+                  {
+                     sum_neg_C += ahat[jj];
+                  }
                }
-               else
+               if (num_procs > 1)
                {
-                  sum_neg += ahat[jj];
+                  for (jj = 0; jj < cnt_c_offd; jj++)
+                  {
+                     if (ahat_offd[jj] > 0)
+                     {
+                        sum_pos_C += ahat_offd[jj];
+                     }
+                     else
+                     {
+                        sum_neg_C += ahat_offd[jj];
+                     }
+                  }
                }
-               ahat[jj] = 0;
-            }
-            if (num_procs > 1)
-            {
-               for (jj = cnt_c_offd; jj < cnt_f_offd; jj++)
+               sum_pos = sum_pos_C;
+               sum_neg = sum_neg_C;
+               for (jj = cnt_c + 1; jj < cnt_f; jj++)
                {
-                  if (ahat_offd[jj] > 0)
+                  if (ahat[jj] > 0)
                   {
-                     sum_pos += ahat_offd[jj];
+                     sum_pos += ahat[jj];
                   }
                   else
                   {
-                     sum_neg += ahat_offd[jj];
+                     sum_neg += ahat[jj];
                   }
-                  ahat_offd[jj] = 0;
+                  ahat[jj] = 0;
                }
-            }
-            if (sum_neg_C * diagonal != 0)
-            {
-               alfa = sum_neg / sum_neg_C / diagonal;
-            }
-            if (sum_pos_C * diagonal != 0)
-            {
-               beta = sum_pos / sum_pos_C / diagonal;
-            }
-
-            /*-----------------------------------------------------------------
-             * Set interpolation weight by dividing by the diagonal.
-             *-----------------------------------------------------------------*/
-
-            for (jj = jj_begin_row; jj < jj_end_row; jj++)
-            {
-               j1 = ihat[P_diag_j[jj]];
-               if (ahat[j1] > 0)
+               if (num_procs > 1)
+               {
+                  for (jj = cnt_c_offd; jj < cnt_f_offd; jj++)
+                  {
+                     if (ahat_offd[jj] > 0)
+                     {
+                        sum_pos += ahat_offd[jj];
+                     }
+                     else
+                     {
+                        sum_neg += ahat_offd[jj];
+                     }
+                     ahat_offd[jj] = 0;
+                  }
+               }
+               if (sum_neg_C * diagonal != 0)
                {
-                  P_diag_data[jj] = -beta * ahat[j1];
+                  alfa = sum_neg / sum_neg_C / diagonal;
                }
-               else
+               if (sum_pos_C * diagonal != 0)
                {
-                  P_diag_data[jj] = -alfa * ahat[j1];
+                  beta = sum_pos / sum_pos_C / diagonal;
                }
 
-               P_diag_j[jj] = fine_to_coarse[P_diag_j[jj]];
-               ahat[j1] = 0;
-            }
-
-            for (jj = 0; jj < cnt_f; jj++)
-            {
-               ihat[ipnt[jj]] = -1;
-            }
+               /*-----------------------------------------------------------------
+                * Set interpolation weight by dividing by the diagonal.
+                *-----------------------------------------------------------------*/
 
-            if (num_procs > 1)
-            {
-               for (jj = jj_begin_row_offd; jj < jj_end_row_offd; jj++)
+               for (jj = jj_begin_row; jj < jj_end_row; jj++)
                {
-                  j1 = ihat_offd[P_offd_j[jj]];
-                  if (ahat_offd[j1] > 0)
+                  j1 = ihat[P_diag_j[jj]];
+                  if (ahat[j1] > 0)
                   {
-                     P_offd_data[jj] = -beta * ahat_offd[j1];
+                     P_diag_data[jj] = -beta * ahat[j1];
                   }
                   else
                   {
-                     P_offd_data[jj] = -alfa * ahat_offd[j1];
+                     P_diag_data[jj] = -alfa * ahat[j1];
                   }
 
-                  ahat_offd[j1] = 0;
+                  P_diag_j[jj] = fine_to_coarse[P_diag_j[jj]];
+                  ahat[j1] = 0;
                }
-               for (jj = 0; jj < cnt_f_offd; jj++)
+
+               for (jj = 0; jj < cnt_f; jj++)
                {
-                  ihat_offd[ipnt_offd[jj]] = -1;
+                  ihat[ipnt[jj]] = -1;
                }
-            }
-         }
-         else
-         {
-            for (jj = 0; jj < cnt_c; jj++)
-            {
-               sum_C += ahat[jj];
-            }
-            if (num_procs > 1)
-            {
-               for (jj = 0; jj < cnt_c_offd; jj++)
+
+               if (num_procs > 1)
                {
-                  sum_C += ahat_offd[jj];
+                  for (jj = jj_begin_row_offd; jj < jj_end_row_offd; jj++)
+                  {
+                     j1 = ihat_offd[P_offd_j[jj]];
+                     if (ahat_offd[j1] > 0)
+                     {
+                        P_offd_data[jj] = -beta * ahat_offd[j1];
+                     }
+                     else
+                     {
+                        P_offd_data[jj] = -alfa * ahat_offd[j1];
+                     }
+
+                     ahat_offd[j1] = 0;
+                  }
+                  for (jj = 0; jj < cnt_f_offd; jj++)
+                  {
+                     ihat_offd[ipnt_offd[jj]] = -1;
+                  }
                }
             }
-            sum = sum_C;
-            for (jj = cnt_c + 1; jj < cnt_f; jj++)
-            {
-               sum += ahat[jj];
-               ahat[jj] = 0;
-            }
-            if (num_procs > 1)
+            else
             {
-               for (jj = cnt_c_offd; jj < cnt_f_offd; jj++)
+               for (jj = 0; jj < cnt_c; jj++)
                {
-                  sum += ahat_offd[jj];
-                  ahat_offd[jj] = 0;
+                  sum_C += ahat[jj];
+               }
+               if (num_procs > 1)
+               {
+                  for (jj = 0; jj < cnt_c_offd; jj++)
+                  {
+                     sum_C += ahat_offd[jj];
+                  }
+               }
+               sum = sum_C;
+               for (jj = cnt_c + 1; jj < cnt_f; jj++)
+               {
+                  sum += ahat[jj];
+                  ahat[jj] = 0;
+               }
+               if (num_procs > 1)
+               {
+                  for (jj = cnt_c_offd; jj < cnt_f_offd; jj++)
+                  {
+                     sum += ahat_offd[jj];
+                     ahat_offd[jj] = 0;
+                  }
+               }
+               if (sum_C * diagonal != 0)
+               {
+                  alfa = sum / sum_C / diagonal;
                }
-            }
-            if (sum_C * diagonal != 0)
-            {
-               alfa = sum / sum_C / diagonal;
-            }
 
-            /*-----------------------------------------------------------------
-             * Set interpolation weight by dividing by the diagonal.
-             *-----------------------------------------------------------------*/
+               /*-----------------------------------------------------------------
+                * Set interpolation weight by dividing by the diagonal.
+                *-----------------------------------------------------------------*/
 
-            for (jj = jj_begin_row; jj < jj_end_row; jj++)
-            {
-               j1 = ihat[P_diag_j[jj]];
-               P_diag_data[jj] = -alfa * ahat[j1];
-               P_diag_j[jj] = fine_to_coarse[P_diag_j[jj]];
-               ahat[j1] = 0;
-            }
-            for (jj = 0; jj < cnt_f; jj++)
-            {
-               ihat[ipnt[jj]] = -1;
-            }
-            if (num_procs > 1)
-            {
-               for (jj = jj_begin_row_offd; jj < jj_end_row_offd; jj++)
+               for (jj = jj_begin_row; jj < jj_end_row; jj++)
+               {
+                  j1 = ihat[P_diag_j[jj]];
+                  P_diag_data[jj] = -alfa * ahat[j1];
+                  P_diag_j[jj] = fine_to_coarse[P_diag_j[jj]];
+                  ahat[j1] = 0;
+               }
+               for (jj = 0; jj < cnt_f; jj++)
                {
-                  j1 = ihat_offd[P_offd_j[jj]];
-                  P_offd_data[jj] = -alfa * ahat_offd[j1];
-                  ahat_offd[j1] = 0;
+                  ihat[ipnt[jj]] = -1;
                }
-               for (jj = 0; jj < cnt_f_offd; jj++)
+               if (num_procs > 1)
                {
-                  ihat_offd[ipnt_offd[jj]] = -1;
+                  for (jj = jj_begin_row_offd; jj < jj_end_row_offd; jj++)
+                  {
+                     j1 = ihat_offd[P_offd_j[jj]];
+                     P_offd_data[jj] = -alfa * ahat_offd[j1];
+                     ahat_offd[j1] = 0;
+                  }
+                  for (jj = 0; jj < cnt_f_offd; jj++)
+                  {
+                     ihat_offd[ipnt_offd[jj]] = -1;
+                  }
                }
             }
          }
-         if (debug_flag == 4)
-         {
-            wall_time = time_getWallclockSeconds() - wall_time;
-            wall_3 += wall_time;
-            fflush(NULL);
-         }
       }
+
+      hypre_TFree(P_marker, HYPRE_MEMORY_HOST);
+      hypre_TFree(P_marker_offd, HYPRE_MEMORY_HOST);
+      hypre_TFree(ahat, HYPRE_MEMORY_HOST);
+      hypre_TFree(ihat, HYPRE_MEMORY_HOST);
+      hypre_TFree(ipnt, HYPRE_MEMORY_HOST);
+      hypre_TFree(ahat_offd, HYPRE_MEMORY_HOST);
+      hypre_TFree(ihat_offd, HYPRE_MEMORY_HOST);
+      hypre_TFree(ipnt_offd, HYPRE_MEMORY_HOST);
    }
 
+   hypre_TFree(workspace, HYPRE_MEMORY_HOST);
+
    if (debug_flag == 4)
    {
-      hypre_printf("Proc = %d fill part 1 %f part 2 %f  part 3 %f\n",
-                   my_id, wall_1, wall_2, wall_3);
+      wall_time = time_getWallclockSeconds() - wall_time;
+      hypre_printf("Proc = %d     fill structure    %f\n", my_id, wall_time);
       fflush(NULL);
    }
    P = hypre_ParCSRMatrixCreate(comm,
@@ -987,23 +1047,11 @@ hypre_BoomerAMGBuildStdInterp(hypre_ParCSRMatrix  *A,
 
    /* Deallocate memory */
    hypre_TFree(fine_to_coarse, HYPRE_MEMORY_HOST);
-   hypre_TFree(P_marker, HYPRE_MEMORY_HOST);
-   hypre_TFree(ahat, HYPRE_MEMORY_HOST);
-   hypre_TFree(ihat, HYPRE_MEMORY_HOST);
-   hypre_TFree(ipnt, HYPRE_MEMORY_HOST);
-
-   if (full_off_procNodes)
-   {
-      hypre_TFree(ahat_offd, HYPRE_MEMORY_HOST);
-      hypre_TFree(ihat_offd, HYPRE_MEMORY_HOST);
-      hypre_TFree(ipnt_offd, HYPRE_MEMORY_HOST);
-   }
    if (num_procs > 1)
    {
       hypre_CSRMatrixDestroy(Sop);
       hypre_CSRMatrixDestroy(A_ext);
       hypre_TFree(fine_to_coarse_offd, HYPRE_MEMORY_HOST);
-      hypre_TFree(P_marker_offd, HYPRE_MEMORY_HOST);
       hypre_TFree(CF_marker_offd, HYPRE_MEMORY_HOST);
       hypre_TFree(tmp_CF_marker_offd, HYPRE_MEMORY_HOST);
       if (num_functions > 1)
@@ -1133,6 +1181,21 @@ hypre_BoomerAMGBuildExtPIInterpHost(hypre_ParCSRMatrix   *A,
    HYPRE_Int * fine_to_coarse_offset;
    HYPRE_Int * offd_offset;
 
+   /* Streaming truncation: each row of P is truncated as soon as it is
+    * built, so that the untruncated P is never stored.  Each thread writes
+    * its rows into its own part of P, sized for max_elmts entries per row
+    * plus room for building its longest row. */
+   HYPRE_Int   do_trunc = (trunc_factor > 0.0 || max_elmts > 0);
+   HYPRE_Int   n_coarse = (HYPRE_Int)(num_cpts_global[1] - num_cpts_global[0]);
+   HYPRE_Int  *coarse_to_fine = NULL;
+   HYPRE_Int  *diag_part_start;
+   HYPRE_Int  *offd_part_start;
+   HYPRE_Int   diag_pos, offd_pos, diag_slack, offd_slack;
+   HYPRE_Int   row_diag, row_offd, max_row;
+   HYPRE_Int   t, t_start, t_stop, shift_diag, shift_offd;
+   HYPRE_Int  *aux_j = NULL;
+   HYPRE_Real *aux_data = NULL;
+
    /* Definitions */
    HYPRE_Real       zero = 0.0;
    HYPRE_Real       one  = 1.0;
@@ -1214,18 +1277,24 @@ hypre_BoomerAMGBuildExtPIInterpHost(hypre_ParCSRMatrix   *A,
    diag_offset           = hypre_CTAlloc(HYPRE_Int, max_num_threads[0], HYPRE_MEMORY_HOST);
    fine_to_coarse_offset = hypre_CTAlloc(HYPRE_Int, max_num_threads[0], HYPRE_MEMORY_HOST);
    offd_offset           = hypre_CTAlloc(HYPRE_Int, max_num_threads[0], HYPRE_MEMORY_HOST);
+   diag_part_start       = hypre_CTAlloc(HYPRE_Int, max_num_threads[0], HYPRE_MEMORY_HOST);
+   offd_part_start       = hypre_CTAlloc(HYPRE_Int, max_num_threads[0], HYPRE_MEMORY_HOST);
    for (i = 0; i < max_num_threads[0]; i++)
    {
       diag_offset[i] = 0;
       fine_to_coarse_offset[i] = 0;
       offd_offset[i] = 0;
    }
+   if (do_trunc && n_coarse)
+   {
+      coarse_to_fine = hypre_CTAlloc(HYPRE_Int, n_coarse, HYPRE_MEMORY_HOST);
+   }
 
    /*-----------------------------------------------------------------------
     *  Loop over fine grid.
     *-----------------------------------------------------------------------*/
 #ifdef HYPRE_USING_OPENMP
-   #pragma omp parallel private(i,my_thread_num,num_threads,start,stop,coarse_counter,jj_counter,jj_counter_offd, P_marker, P_marker_offd,jj,kk,i1,k1,loc_col,jj_begin_row,jj_begin_row_offd,jj_end_row,jj_end_row_offd,diagonal,sum,sgn,jj1,i2,distribute,strong_f_marker, big_k1)
+   #pragma omp parallel private(i,my_thread_num,num_threads,start,stop,coarse_counter,jj_counter,jj_counter_offd, P_marker, P_marker_offd,jj,kk,i1,k1,loc_col,jj_begin_row,jj_begin_row_offd,jj_end_row,jj_end_row_offd,diagonal,sum,sgn,jj1,i2,distribute,strong_f_marker, big_k1,diag_pos,offd_pos,diag_slack,offd_slack,row_diag,row_offd,max_row,t,t_start,t_stop,shift_diag,shift_offd,aux_j,aux_data)
 #endif
    {
 
@@ -1250,6 +1319,8 @@ hypre_BoomerAMGBuildExtPIInterpHost(hypre_ParCSRMatrix   *A,
       coarse_counter = 0;
       jj_counter = start_indexing;
       jj_counter_offd = start_indexing;
+      P_marker = NULL;
+      P_marker_offd = NULL;
       if (n_fine)
       {
          P_marker = hypre_CTAlloc(HYPRE_Int,  n_fine, HYPRE_MEMORY_HOST);
@@ -1444,6 +1515,47 @@ hypre_BoomerAMGBuildExtPIInterpHost(hypre_ParCSRMatrix   *A,
       #pragma omp barrier
 #endif
 
+      /* size of this thread's part of P */
+      diag_pos = 0;
+      offd_pos = 0;
+      diag_slack = 0;
+      offd_slack = 0;
+      max_row = 0;
+      for (i = start; i < stop; i++)
+      {
+         row_diag = P_diag_i[i + 1] - P_diag_i[i];
+         row_offd = P_offd_i[i + 1] - P_offd_i[i];
+         max_row = hypre_max(max_row, row_diag + row_offd);
+         if (max_elmts > 0)
+         {
+            diag_pos += hypre_min(row_diag, max_elmts);
+            offd_pos += hypre_min(row_offd, max_elmts);
+            diag_slack = hypre_max(diag_slack, row_diag - max_elmts);
+            offd_slack = hypre_max(offd_slack, row_offd - max_elmts);
+         }
+         else
+         {
+            diag_pos += row_diag;
+            offd_pos += row_offd;
+         }
+         if (do_trunc && CF_marker[i] >= 0)
+         {
+            coarse_to_fine[fine_to_coarse[i]] = i;
+         }
+      }
+      diag_part_start[my_thread_num] = diag_pos + diag_slack;
+      offd_part_start[my_thread_num] = offd_pos + offd_slack;
+      aux_j = NULL;
+      aux_data = NULL;
+      if (do_trunc && max_row)
+      {
+         aux_j    = hypre_CTAlloc(HYPRE_Int,  max_row, HYPRE_MEMORY_HOST);
+         aux_data = hypre_CTAlloc(HYPRE_Real, max_row, HYPRE_MEMORY_HOST);
+      }
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp barrier
+#endif
+
       if (my_thread_num == 0)
       {
          if (debug_flag == 4)
@@ -1459,8 +1571,17 @@ hypre_BoomerAMGBuildExtPIInterpHost(hypre_ParCSRMatrix   *A,
 
          if (debug_flag == 4) { wall_time = time_getWallclockSeconds(); }
 
-         P_diag_size =  P_diag_i[n_fine];
-         P_offd_size = P_offd_i[n_fine];
+         P_diag_size = 0;
+         P_offd_size = 0;
+         for (t = 0; t < num_threads; t++)
+         {
+            row_diag = diag_part_start[t];
+            row_offd = offd_part_start[t];
+            diag_part_start[t] = P_diag_size;
+            offd_part_start[t] = P_offd_size;
+            P_diag_size += row_diag;
+            P_offd_size += row_offd;
+         }
 
          if (P_diag_size)
          {
@@ -1499,10 +1620,12 @@ hypre_BoomerAMGBuildExtPIInterpHost(hypre_ParCSRMatrix   *A,
 #ifdef HYPRE_USING_OPENMP
       #pragma omp barrier
 #endif
+      diag_pos = diag_part_start[my_thread_num];
+      offd_pos = offd_part_start[my_thread_num];
       for (i = start; i < stop; i++)
       {
-         jj_begin_row = P_diag_i[i];
-         jj_begin_row_offd = P_offd_i[i];
+         jj_begin_row = diag_pos;
+         jj_begin_row_offd = offd_pos;
          jj_counter = jj_begin_row;
          jj_counter_offd = jj_begin_row_offd;
 
@@ -1798,12 +1921,80 @@ hypre_BoomerAMGBuildExtPIInterpHost(hypre_ParCSRMatrix   *A,
                }
             }
          }
+
+         if (do_trunc)
+         {
+            /* The next row starts where the truncated row ends, so clear
+             * the markers pointing into this row */
+            for (jj = jj_begin_row; jj < jj_counter; jj++)
+            {
+               P_marker[coarse_to_fine[P_diag_j[jj]]] = -1;
+            }
+            for (jj = jj_begin_row_offd; jj < jj_counter_offd; jj++)
+            {
+               P_marker_offd[P_offd_j[jj]] = -1;
+            }
+
+            row_diag = jj_counter - jj_begin_row;
+            row_offd = jj_counter_offd - jj_begin_row_offd;
+            hypre_BoomerAMGInterpTruncateRow(trunc_factor, max_elmts, n_coarse,
+                                             P_diag_j + jj_begin_row,
+                                             P_diag_data + jj_begin_row, &row_diag,
+                                             P_offd_j + jj_begin_row_offd,
+                                             P_offd_data + jj_begin_row_offd, &row_offd,
+                                             aux_j, aux_data);
+            jj_counter = jj_begin_row + row_diag;
+            jj_counter_offd = jj_begin_row_offd + row_offd;
+         }
+         P_diag_i[i] = jj_begin_row;
+         P_offd_i[i] = jj_begin_row_offd;
+         diag_pos = jj_counter;
+         offd_pos = jj_counter_offd;
          strong_f_marker--;
       }
       /*-----------------------------------------------------------------------
        *  End large for loop over nfine
        *-----------------------------------------------------------------------*/
 
+      /* Close the gaps left by truncation between the parts of the threads */
+      diag_offset[my_thread_num] = diag_pos;
+      offd_offset[my_thread_num] = offd_pos;
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp barrier
+#endif
+      if (do_trunc && my_thread_num == 0)
+      {
+         diag_pos = diag_offset[0];
+         offd_pos = offd_offset[0];
+         for (t = 1; t < num_threads; t++)
+         {
+            t_start = (n_fine / num_threads) * t;
+            t_stop  = (t == num_threads - 1) ? n_fine : (n_fine / num_threads) * (t + 1);
+            shift_diag = diag_part_start[t] - diag_pos;
+            shift_offd = offd_part_start[t] - offd_pos;
+            for (jj = diag_part_start[t]; jj < diag_offset[t]; jj++)
+            {
+               P_diag_j[diag_pos] = P_diag_j[jj];
+               P_diag_data[diag_pos++] = P_diag_data[jj];
+            }
+            for (jj = offd_part_start[t]; jj < offd_offset[t]; jj++)
+            {
+               P_offd_j[offd_pos] = P_offd_j[jj];
+               P_offd_data[offd_pos++] = P_offd_data[jj];
+            }
+            for (i = t_start; i < t_stop; i++)
+            {
+               P_diag_i[i] -= shift_diag;
+               P_offd_i[i] -= shift_offd;
+            }
+         }
+         P_diag_i[n_fine] = diag_pos;
+         P_offd_i[n_fine] = offd_pos;
+      }
+
+      hypre_TFree(aux_j, HYPRE_MEMORY_HOST);
+      hypre_TFree(aux_data, HYPRE_MEMORY_HOST);
+
       if (n_fine)
       {
          hypre_TFree(P_marker, HYPRE_MEMORY_HOST);
@@ -1825,6 +2016,28 @@ hypre_BoomerAMGBuildExtPIInterpHost(hypre_ParCSRMatrix   *A,
                    my_id, wall_time);
       fflush(NULL);
    }
+
+   /* P was truncated row by row; release the unused space */
+   if (do_trunc)
+   {
+      if (P_diag_i[n_fine] < P_diag_size)
+      {
+         P_diag_j    = hypre_TReAlloc_v2(P_diag_j, HYPRE_Int, P_diag_size, HYPRE_Int,
+                                         P_diag_i[n_fine], memory_location_P);
+         P_diag_data = hypre_TReAlloc_v2(P_diag_data, HYPRE_Real, P_diag_size, HYPRE_Real,
+                                         P_diag_i[n_fine], memory_location_P);
+      }
+      if (P_offd_i[n_fine] < P_offd_size)
+      {
+         P_offd_j    = hypre_TReAlloc_v2(P_offd_j, HYPRE_Int, P_offd_size, HYPRE_Int,
+                                         P_offd_i[n_fine], memory_location_P);
+         P_offd_data = hypre_TReAlloc_v2(P_offd_data, HYPRE_Real, P_offd_size, HYPRE_Real,
+                                         P_offd_i[n_fine], memory_location_P);
+      }
+      P_diag_size = P_diag_i[n_fine];
+      P_offd_size = P_offd_i[n_fine];
+   }
+
    /*-----------------------------------------------------------------------
     *  Allocate  arrays.
     *-----------------------------------------------------------------------*/
@@ -1850,27 +2063,6 @@ hypre_BoomerAMGBuildExtPIInterpHost(hypre_ParCSRMatrix   *A,
    hypre_CSRMatrixMemoryLocation(P_diag) = memory_location_P;
    hypre_CSRMatrixMemoryLocation(P_offd) = memory_location_P;
 
-   /* Compress P, removing coefficients smaller than trunc_factor * Max */
-   if (trunc_factor != 0.0 || max_elmts > 0)
-   {
-#ifdef HYPRE_PROFILE
-      hypre_profile_times[HYPRE_TIMER_ID_EXTENDED_I_INTERP] += hypre_MPI_Wtime();
-#endif
-      hypre_BoomerAMGInterpTruncation(P, trunc_factor, max_elmts);
-#ifdef HYPRE_PROFILE
-      hypre_profile_times[HYPRE_TIMER_ID_EXTENDED_I_INTERP] -= hypre_MPI_Wtime();
-#endif
-
-      P_diag_data = hypre_CSRMatrixData(P_diag);
-      P_diag_i = hypre_CSRMatrixI(P_diag);
-      P_diag_j = hypre_CSRMatrixJ(P_diag);
-      P_offd_data = hypre_CSRMatrixData(P_offd);
-      P_offd_i = hypre_CSRMatrixI(P_offd);
-      P_offd_j = hypre_CSRMatrixJ(P_offd);
-      P_diag_size = P_diag_i[n_fine];
-      P_offd_size = P_offd_i[n_fine];
-   }
-
    /* This builds col_map, col_map should be monotone increasing and contain
     * global numbers. */
    if (P_offd_size)
@@ -1899,6 +2091,9 @@ hypre_BoomerAMGBuildExtPIInterpHost(hypre_ParCSRMatrix   *A,
    hypre_TFree(diag_offset, HYPRE_MEMORY_HOST);
    hypre_TFree(offd_offset, HYPRE_MEMORY_HOST);
    hypre_TFree(fine_to_coarse_offset, HYPRE_MEMORY_HOST);
+   hypre_TFree(diag_part_start, HYPRE_MEMORY_HOST);
+   hypre_TFree(offd_part_start, HYPRE_MEMORY_HOST);
+   hypre_TFree(coarse_to_fine, HYPRE_MEMORY_HOST);
 
    if (num_procs > 1)
    {
@@ -2981,7 +3176,6 @@ hypre_BoomerAMGBuildFFInterp(hypre_ParCSRMatrix  *A,
    HYPRE_Int       *CF_marker_offd = NULL;
    HYPRE_Int       *tmp_CF_marker_offd = NULL;
    HYPRE_Int       *dof_func_offd = NULL;
-   /*HYPRE_Int              ccounter_offd;*/
    HYPRE_Int        common_c;
 
    /* Full row information for columns of A that are off diag*/
@@ -3006,10 +3200,11 @@ hypre_BoomerAMGBuildFFInterp(hypre_ParCSRMatrix  *A,
    HYPRE_Int        jj_begin_row_offd = 0;
    HYPRE_Int        jj_end_row_offd = 0;
    HYPRE_Int        coarse_counter;
+   HYPRE_Int        ccounter, ccounter_offd;
 
    /* Interpolation weight variables */
    HYPRE_Real       sum, diagonal, distribute;
-   HYPRE_Int        strong_f_marker = -2;
+   HYPRE_Int        strong_f_marker;
    HYPRE_Int        sgn = 1;
 
    /* Loop variables */
@@ -3017,8 +3212,10 @@ hypre_BoomerAMGBuildFFInterp(hypre_ParCSRMatrix  *A,
    HYPRE_Int        start_indexing = 0;
    HYPRE_Int        i, i1, i2, jj, kk, k1, jj1;
    HYPRE_BigInt     big_k1;
-   /*HYPRE_Int              ccounter;
-     HYPRE_Int             *clist, ccounter;*/
+
+   /* Threading variables */
+   HYPRE_Int        start, stop;
+   HYPRE_Int       *workspace;
 
    /* Definitions */
    HYPRE_Real       zero = 0.0;
@@ -3075,12 +3272,10 @@ hypre_BoomerAMGBuildFFInterp(hypre_ParCSRMatrix  *A,
    if (n_fine)
    {
       fine_to_coarse = hypre_CTAlloc(HYPRE_Int,  n_fine, HYPRE_MEMORY_HOST);
-      P_marker = hypre_CTAlloc(HYPRE_Int,  n_fine, HYPRE_MEMORY_HOST);
    }
 
    if (full_off_procNodes)
    {
-      P_marker_offd = hypre_CTAlloc(HYPRE_Int,  full_off_procNodes, HYPRE_MEMORY_HOST);
       fine_to_coarse_offd = hypre_CTAlloc(HYPRE_BigInt,  full_off_procNodes, HYPRE_MEMORY_HOST);
       tmp_CF_marker_offd = hypre_CTAlloc(HYPRE_Int,  full_off_procNodes, HYPRE_MEMORY_HOST);
    }
@@ -3089,175 +3284,177 @@ hypre_BoomerAMGBuildFFInterp(hypre_ParCSRMatrix  *A,
                          fine_to_coarse_offd, P_marker, P_marker_offd,
                          tmp_CF_marker_offd);
 
-   jj_counter = start_indexing;
-   jj_counter_offd = start_indexing;
-   coarse_counter = 0;
-
    /*-----------------------------------------------------------------------
-    *  Loop over fine grid.
+    *  Loop over fine grid.  Each thread handles a contiguous range of rows
+    *  with its own marker arrays: it first counts the entries of its rows of
+    *  P, the row pointers are then shifted by the counts of the preceding
+    *  threads, and finally each thread fills its rows.  P does not depend on
+    *  the number of threads.
     *-----------------------------------------------------------------------*/
-   for (i = 0; i < n_fine; i++)
-   {
-      P_diag_i[i] = jj_counter;
-      if (num_procs > 1)
-      {
-         P_offd_i[i] = jj_counter_offd;
-      }
+   workspace = hypre_TAlloc(HYPRE_Int, 3 * (hypre_NumThreads() + 1), HYPRE_MEMORY_HOST);
 
-      if (CF_marker[i] >= 0)
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel private(i, start, stop, coarse_counter, jj_counter, jj_counter_offd, \
+                               P_marker, P_marker_offd, jj, kk, i1, k1, loc_col, jj_begin_row, \
+                               jj_begin_row_offd, jj_end_row, jj_end_row_offd, ccounter, \
+                               ccounter_offd, common_c, diagonal, sum, sgn, jj1, i2, distribute, \
+                               strong_f_marker, big_k1)
+#endif
+   {
+      /* initialize thread-wise variables */
+      strong_f_marker = -2;
+      coarse_counter = 0;
+      jj_counter = start_indexing;
+      jj_counter_offd = start_indexing;
+      P_marker = hypre_TAlloc(HYPRE_Int, n_fine, HYPRE_MEMORY_HOST);
+      P_marker_offd = hypre_TAlloc(HYPRE_Int, full_off_procNodes, HYPRE_MEMORY_HOST);
+      for (i = 0; i < n_fine; i++)
       {
-         jj_counter++;
-         fine_to_coarse[i] = coarse_counter;
-         coarse_counter++;
+         P_marker[i] = -1;
+      }
+      for (i = 0; i < full_off_procNodes; i++)
+      {
+         P_marker_offd[i] = -1;
       }
 
-      /*--------------------------------------------------------------------
-       *  If i is an F-point, interpolation is from the C-points that
-       *  strongly influence i, or C-points that stronly influence F-points
-       *  that strongly influence i.
-       *--------------------------------------------------------------------*/
-      else
+      /* this thread's row range */
+      hypre_GetSimpleThreadPartition(&start, &stop, n_fine);
+
+      for (i = start; i < stop; i++)
       {
-         /* Initialize ccounter for each f point */
-         /*ccounter = 0;
-           ccounter_offd = 0;*/
-         for (jj = S_diag_i[i]; jj < S_diag_i[i + 1]; jj++)
+         P_diag_i[i] = jj_counter;
+         if (num_procs > 1)
          {
-            /* search through diag to find all c neighbors */
-            i1 = S_diag_j[jj];
-            if (CF_marker[i1] > 0)
-            {
-               /* i1 is a C point */
-               CF_marker[i1] = 2;
-               if (P_marker[i1] < P_diag_i[i])
-               {
-                  P_marker[i1] = jj_counter;
-                  jj_counter++;
-               }
-            }
+            P_offd_i[i] = jj_counter_offd;
          }
-         if (num_procs > 1)
+
+         if (CF_marker[i] >= 0)
          {
-            for (jj = S_offd_i[i]; jj < S_offd_i[i + 1]; jj++)
-            {
-               /* search through offd to find all c neighbors */
-               i1 = S_offd_j[jj];
-               if (CF_marker_offd[i1] > 0)
-               {
-                  /* i1 is a C point direct neighbor */
-                  CF_marker_offd[i1] = 2;
-                  if (P_marker_offd[i1] < P_offd_i[i])
-                  {
-                     tmp_CF_marker_offd[i1] = 1;
-                     P_marker_offd[i1] = jj_counter_offd;
-                     jj_counter_offd++;
-                  }
-               }
-            }
+            jj_counter++;
+            fine_to_coarse[i] = coarse_counter;
+            coarse_counter++;
          }
-         for (jj = S_diag_i[i]; jj < S_diag_i[i + 1]; jj++)
+
+         /*--------------------------------------------------------------------
+          *  If i is an F-point, interpolation is from the C-points that
+          *  strongly influence i, or C-points that stronly influence F-points
+          *  that strongly influence i.
+          *--------------------------------------------------------------------*/
+         else if (CF_marker[i] != -3)
          {
-            /* Search diag to find f neighbors and determine if common c point */
-            i1 = S_diag_j[jj];
-            if (CF_marker[i1] < 0)
+            for (jj = S_diag_i[i]; jj < S_diag_i[i + 1]; jj++)
             {
-               /* i1 is a F point, loop through it's strong neighbors */
-               common_c = 0;
-               for (kk = S_diag_i[i1]; kk < S_diag_i[i1 + 1]; kk++)
+               /* search through diag to find all c neighbors */
+               i1 = S_diag_j[jj];
+               if (CF_marker[i1] > 0)
                {
-                  k1 = S_diag_j[kk];
-                  if (CF_marker[k1] == 2)
+                  /* i1 is a C point */
+                  if (P_marker[i1] < P_diag_i[i])
                   {
-                     common_c = 1;
-                     break;
+                     P_marker[i1] = jj_counter;
+                     jj_counter++;
                   }
                }
-               if (num_procs > 1 && common_c == 0)
+            }
+            if (num_procs > 1)
+            {
+               for (jj = S_offd_i[i]; jj < S_offd_i[i + 1]; jj++)
                {
-                  /* no common c point yet, check offd */
-                  for (kk = S_offd_i[i1]; kk < S_offd_i[i1 + 1]; kk++)
+                  /* search through offd to find all c neighbors */
+                  i1 = S_offd_j[jj];
+                  if (CF_marker_offd[i1] > 0)
                   {
-                     k1 = S_offd_j[kk];
-
-                     if (CF_marker_offd[k1] == 2)
+                     /* i1 is a C point direct neighbor */
+                     if (P_marker_offd[i1] < P_offd_i[i])
                      {
-                        common_c = 1;
-                        break;
+                        tmp_CF_marker_offd[i1] = 1;
+                        P_marker_offd[i1] = jj_counter_offd;
+                        jj_counter_offd++;
                      }
                   }
                }
-               if (!common_c)
+            }
+            /* the direct C neighbors of i are numbered below ccounter */
+            ccounter = jj_counter;
+            ccounter_offd = jj_counter_offd;
+
+            for (jj = S_diag_i[i]; jj < S_diag_i[i + 1]; jj++)
+            {
+               /* Search diag to find f neighbors and determine if common c point */
+               i1 = S_diag_j[jj];
+               if (CF_marker[i1] < 0)
                {
-                  /* No common c point, extend the interp set */
+                  /* i1 is a F point, loop through it's strong neighbors */
+                  common_c = 0;
                   for (kk = S_diag_i[i1]; kk < S_diag_i[i1 + 1]; kk++)
                   {
                      k1 = S_diag_j[kk];
-                     if (CF_marker[k1] > 0)
+                     if (P_marker[k1] >= P_diag_i[i] && P_marker[k1] < ccounter)
                      {
-                        if (P_marker[k1] < P_diag_i[i])
-                        {
-                           P_marker[k1] = jj_counter;
-                           jj_counter++;
-                        }
+                        common_c = 1;
+                        break;
                      }
                   }
-                  if (num_procs > 1)
+                  if (num_procs > 1 && common_c == 0)
                   {
+                     /* no common c point yet, check offd */
                      for (kk = S_offd_i[i1]; kk < S_offd_i[i1 + 1]; kk++)
                      {
                         k1 = S_offd_j[kk];
-                        if (CF_marker_offd[k1] >  0)
+
+                        if (P_marker_offd[k1] >= P_offd_i[i] && P_marker_offd[k1] < ccounter_offd)
                         {
-                           if (P_marker_offd[k1] < P_offd_i[i])
-                           {
-                              tmp_CF_marker_offd[k1] = 1;
-                              P_marker_offd[k1] = jj_counter_offd;
-                              jj_counter_offd++;
-                           }
+                           common_c = 1;
+                           break;
                         }
                      }
                   }
-               }
-            }
-         }
-         /* Look at off diag strong connections of i */
-         if (num_procs > 1)
-         {
-            for (jj = S_offd_i[i]; jj < S_offd_i[i + 1]; jj++)
-            {
-               i1 = S_offd_j[jj];
-               if (CF_marker_offd[i1] < 0)
-               {
-                  /* F point; look at neighbors of i1. Sop contains global col
-                   * numbers and entries that could be in S_diag or S_offd or
-                   * neither. */
-                  common_c = 0;
-                  for (kk = Sop_i[i1]; kk < Sop_i[i1 + 1]; kk++)
+                  if (!common_c)
                   {
-                     /* Check if common c */
-                     big_k1 = Sop_j[kk];
-                     if (big_k1 >= col_1 && big_k1 < col_n)
+                     /* No common c point, extend the interp set */
+                     for (kk = S_diag_i[i1]; kk < S_diag_i[i1 + 1]; kk++)
                      {
-                        /* In S_diag */
-                        loc_col = (HYPRE_Int)(big_k1 - col_1);
-                        if (CF_marker[loc_col] == 2)
+                        k1 = S_diag_j[kk];
+                        if (CF_marker[k1] > 0)
                         {
-                           common_c = 1;
-                           break;
+                           if (P_marker[k1] < P_diag_i[i])
+                           {
+                              P_marker[k1] = jj_counter;
+                              jj_counter++;
+                           }
                         }
                      }
-                     else
+                     if (num_procs > 1)
                      {
-                        loc_col = -(HYPRE_Int)big_k1 - 1;
-                        if (CF_marker_offd[loc_col] == 2)
+                        for (kk = S_offd_i[i1]; kk < S_offd_i[i1 + 1]; kk++)
                         {
-                           common_c = 1;
-                           break;
+                           k1 = S_offd_j[kk];
+                           if (CF_marker_offd[k1] >  0)
+                           {
+                              if (P_marker_offd[k1] < P_offd_i[i])
+                              {
+                                 tmp_CF_marker_offd[k1] = 1;
+                                 P_marker_offd[k1] = jj_counter_offd;
+                                 jj_counter_offd++;
+                              }
+                           }
                         }
                      }
                   }
-                  if (!common_c)
+               }
+            }
+            /* Look at off diag strong connections of i */
+            if (num_procs > 1)
+            {
+               for (jj = S_offd_i[i]; jj < S_offd_i[i + 1]; jj++)
+               {
+                  i1 = S_offd_j[jj];
+                  if (CF_marker_offd[i1] < 0)
                   {
+                     /* F point; look at neighbors of i1. Sop contains global col
+                      * numbers and entries that could be in S_diag or S_offd or
+                      * neither. */
+                     common_c = 0;
                      for (kk = Sop_i[i1]; kk < Sop_i[i1 + 1]; kk++)
                      {
                         /* Check if common c */
@@ -3266,20 +3463,47 @@ hypre_BoomerAMGBuildFFInterp(hypre_ParCSRMatrix  *A,
                         {
                            /* In S_diag */
                            loc_col = (HYPRE_Int)(big_k1 - col_1);
-                           if (P_marker[loc_col] < P_diag_i[i])
+                           if (P_marker[loc_col] >= P_diag_i[i] && P_marker[loc_col] < ccounter)
                            {
-                              P_marker[loc_col] = jj_counter;
-                              jj_counter++;
+                              common_c = 1;
+                              break;
                            }
                         }
                         else
                         {
                            loc_col = -(HYPRE_Int)big_k1 - 1;
-                           if (P_marker_offd[loc_col] < P_offd_i[i])
+                           if (P_marker_offd[loc_col] >= P_offd_i[i] && P_marker_offd[loc_col] < ccounter_offd)
                            {
-                              P_marker_offd[loc_col] = jj_counter_offd;
-                              tmp_CF_marker_offd[loc_col] = 1;
-                              jj_counter_offd++;
+                              common_c = 1;
+                              break;
+                           }
+                        }
+                     }
+                     if (!common_c)
+                     {
+                        for (kk = Sop_i[i1]; kk < Sop_i[i1 + 1]; kk++)
+                        {
+                           /* Check if common c */
+                           big_k1 = Sop_j[kk];
+                           if (big_k1 >= col_1 && big_k1 < col_n)
+                           {
+                              /* In S_diag */
+                              loc_col = (HYPRE_Int)(big_k1 - col_1);
+                              if (P_marker[loc_col] < P_diag_i[i])
+                              {
+                                 P_marker[loc_col] = jj_counter;
+                                 jj_counter++;
+                              }
+                           }
+                           else
+                           {
+                              loc_col = -(HYPRE_Int)big_k1 - 1;
+                              if (P_marker_offd[loc_col] < P_offd_i[i])
+                              {
+                                 P_marker_offd[loc_col] = jj_counter_offd;
+                                 tmp_CF_marker_offd[loc_col] = 1;
+                                 jj_counter_offd++;
+                              }
                            }
                         }
                      }
@@ -3287,362 +3511,293 @@ hypre_BoomerAMGBuildFFInterp(hypre_ParCSRMatrix  *A,
                }
             }
          }
-         for (jj = S_diag_i[i]; jj < S_diag_i[i + 1]; jj++)
+      }
+
+      /* Stitch P_diag_i, P_offd_i and fine_to_coarse together */
+      hypre_BoomerAMGInterpShiftRows(start, stop, n_fine, jj_counter, jj_counter_offd,
+                                     coarse_counter, P_diag_i, P_offd_i, fine_to_coarse,
+                                     workspace);
+
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp master
+#endif
+      {
+         /*-----------------------------------------------------------------------
+          *  Allocate  arrays.
+          *-----------------------------------------------------------------------*/
+
+         P_diag_size = P_diag_i[n_fine];
+         P_offd_size = P_offd_i[n_fine];
+
+         if (P_diag_size)
          {
-            /* search through diag to find all c neighbors */
-            i1 = S_diag_j[jj];
-            if (CF_marker[i1] == 2)
-            {
-               CF_marker[i1] = 1;
-            }
+            P_diag_j    = hypre_CTAlloc(HYPRE_Int,  P_diag_size, memory_location_P);
+            P_diag_data = hypre_CTAlloc(HYPRE_Real, P_diag_size, memory_location_P);
+         }
+
+         if (P_offd_size)
+         {
+            P_offd_j    = hypre_CTAlloc(HYPRE_Int,  P_offd_size, memory_location_P);
+            P_offd_data = hypre_CTAlloc(HYPRE_Real, P_offd_size, memory_location_P);
          }
+
+         /* Fine to coarse mapping */
          if (num_procs > 1)
          {
-            for (jj = S_offd_i[i]; jj < S_offd_i[i + 1]; jj++)
-            {
-               /* search through offd to find all c neighbors */
-               i1 = S_offd_j[jj];
-               if (CF_marker_offd[i1] == 2)
-               {
-                  /* i1 is a C point direct neighbor */
-                  CF_marker_offd[i1] = 1;
-               }
-            }
+            hypre_big_insert_new_nodes(comm_pkg, extend_comm_pkg, fine_to_coarse,
+                                       full_off_procNodes, my_first_cpt,
+                                       fine_to_coarse_offd);
          }
       }
-   }
-
-   /*-----------------------------------------------------------------------
-    *  Allocate  arrays.
-    *-----------------------------------------------------------------------*/
 
-   P_diag_size = jj_counter;
-   P_offd_size = jj_counter_offd;
-
-   if (P_diag_size)
-   {
-      P_diag_j    = hypre_CTAlloc(HYPRE_Int,  P_diag_size, memory_location_P);
-      P_diag_data = hypre_CTAlloc(HYPRE_Real, P_diag_size, memory_location_P);
-   }
-
-   if (P_offd_size)
-   {
-      P_offd_j    = hypre_CTAlloc(HYPRE_Int,  P_offd_size, memory_location_P);
-      P_offd_data = hypre_CTAlloc(HYPRE_Real, P_offd_size, memory_location_P);
-   }
-
-   P_diag_i[n_fine] = jj_counter;
-   P_offd_i[n_fine] = jj_counter_offd;
-
-   jj_counter = start_indexing;
-   jj_counter_offd = start_indexing;
-   /*ccounter = start_indexing;
-     ccounter_offd = start_indexing;*/
-
-   /* Fine to coarse mapping */
-   if (num_procs > 1)
-   {
-      hypre_big_insert_new_nodes(comm_pkg, extend_comm_pkg, fine_to_coarse,
-                                 full_off_procNodes, my_first_cpt,
-                                 fine_to_coarse_offd);
-   }
-
-   for (i = 0; i < n_fine; i++)
-   {
-      P_marker[i] = -1;
-   }
-
-   for (i = 0; i < full_off_procNodes; i++)
-   {
-      P_marker_offd[i] = -1;
-   }
-
-   /*-----------------------------------------------------------------------
-    *  Loop over fine grid points.
-    *-----------------------------------------------------------------------*/
-   jj_begin_row_offd = 0;
-   for (i = 0; i < n_fine; i++)
-   {
-      jj_begin_row = jj_counter;
-      if (num_procs > 1)
+      for (i = 0; i < n_fine; i++)
       {
-         jj_begin_row_offd = jj_counter_offd;
+         P_marker[i] = -1;
       }
-
-      /*--------------------------------------------------------------------
-       *  If i is a c-point, interpolation is the identity.
-       *--------------------------------------------------------------------*/
-
-      if (CF_marker[i] >= 0)
+      for (i = 0; i < full_off_procNodes; i++)
       {
-         P_diag_j[jj_counter]    = fine_to_coarse[i];
-         P_diag_data[jj_counter] = one;
-         jj_counter++;
+         P_marker_offd[i] = -1;
       }
 
-      /*--------------------------------------------------------------------
-       *  If i is an F-point, build interpolation.
-       *--------------------------------------------------------------------*/
-
-      else if (CF_marker[i] != -3)
+      /*-----------------------------------------------------------------------
+       *  Loop over fine grid points.
+       *-----------------------------------------------------------------------*/
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp barrier
+#endif
+      for (i = start; i < stop; i++)
       {
-         /*ccounter = 0;
-           ccounter_offd = 0;*/
-         strong_f_marker--;
+         jj_begin_row = P_diag_i[i];
+         jj_begin_row_offd = P_offd_i[i];
+         jj_counter = jj_begin_row;
+         jj_counter_offd = jj_begin_row_offd;
 
-         for (jj = S_diag_i[i]; jj < S_diag_i[i + 1]; jj++)
+         /*--------------------------------------------------------------------
+          *  If i is a c-point, interpolation is the identity.
+          *--------------------------------------------------------------------*/
+
+         if (CF_marker[i] >= 0)
          {
-            /* Search C points only */
-            i1 = S_diag_j[jj];
+            P_diag_j[jj_counter]    = fine_to_coarse[i];
+            P_diag_data[jj_counter] = one;
+            jj_counter++;
+         }
 
-            /*--------------------------------------------------------------
-             * If neighbor i1 is a C-point, set column number in P_diag_j
-             * and initialize interpolation weight to zero.
-             *--------------------------------------------------------------*/
+         /*--------------------------------------------------------------------
+          *  If i is an F-point, build interpolation.
+          *--------------------------------------------------------------------*/
 
-            if (CF_marker[i1] >  0)
-            {
-               CF_marker[i1]  = 2;
-               if (P_marker[i1] < jj_begin_row)
-               {
-                  P_marker[i1] = jj_counter;
-                  P_diag_j[jj_counter]    = fine_to_coarse[i1];
-                  P_diag_data[jj_counter] = zero;
-                  jj_counter++;
-               }
-            }
-         }
-         if ( num_procs > 1)
+         else if (CF_marker[i] != -3)
          {
-            for (jj = S_offd_i[i]; jj < S_offd_i[i + 1]; jj++)
+            strong_f_marker--;
+
+            for (jj = S_diag_i[i]; jj < S_diag_i[i + 1]; jj++)
             {
-               i1 = S_offd_j[jj];
-               if ( CF_marker_offd[i1] > 0)
+               /* Search C points only */
+               i1 = S_diag_j[jj];
+
+               /*--------------------------------------------------------------
+                * If neighbor i1 is a C-point, set column number in P_diag_j
+                * and initialize interpolation weight to zero.
+                *--------------------------------------------------------------*/
+
+               if (CF_marker[i1] >  0)
                {
-                  CF_marker_offd[i1]  = 2;
-                  if (P_marker_offd[i1] < jj_begin_row_offd)
+                  if (P_marker[i1] < jj_begin_row)
                   {
-                     P_marker_offd[i1] = jj_counter_offd;
-                     P_offd_j[jj_counter_offd] = i1;
-                     P_offd_data[jj_counter_offd] = zero;
-                     jj_counter_offd++;
+                     P_marker[i1] = jj_counter;
+                     P_diag_j[jj_counter]    = fine_to_coarse[i1];
+                     P_diag_data[jj_counter] = zero;
+                     jj_counter++;
                   }
                }
             }
-         }
-
-         for (jj = S_diag_i[i]; jj < S_diag_i[i + 1]; jj++)
-         {
-            /* Search through F points */
-            i1 = S_diag_j[jj];
-            if (CF_marker[i1] == -1)
+            if ( num_procs > 1)
             {
-               P_marker[i1] = strong_f_marker;
-               common_c = 0;
-               for (kk = S_diag_i[i1]; kk < S_diag_i[i1 + 1]; kk++)
-               {
-                  k1 = S_diag_j[kk];
-                  if (CF_marker[k1] == 2)
-                  {
-                     common_c = 1;
-                     break;
-                  }
-               }
-               if (num_procs > 1 && common_c == 0)
+               for (jj = S_offd_i[i]; jj < S_offd_i[i + 1]; jj++)
                {
-                  /* no common c point yet, check offd */
-                  for (kk = S_offd_i[i1]; kk < S_offd_i[i1 + 1]; kk++)
+                  i1 = S_offd_j[jj];
+                  if ( CF_marker_offd[i1] > 0)
                   {
-                     k1 = S_offd_j[kk];
-
-                     if (CF_marker_offd[k1] == 2)
+                     if (P_marker_offd[i1] < jj_begin_row_offd)
                      {
-                        common_c = 1;
-                        break;
+                        P_marker_offd[i1] = jj_counter_offd;
+                        P_offd_j[jj_counter_offd] = i1;
+                        P_offd_data[jj_counter_offd] = zero;
+                        jj_counter_offd++;
                      }
                   }
                }
-               if (!common_c)
+            }
+
+            /* the direct C neighbors of i are numbered below ccounter */
+            ccounter = jj_counter;
+            ccounter_offd = jj_counter_offd;
+
+            for (jj = S_diag_i[i]; jj < S_diag_i[i + 1]; jj++)
+            {
+               /* Search through F points */
+               i1 = S_diag_j[jj];
+               if (CF_marker[i1] == -1)
                {
-                  /* No common c point, extend the interp set */
+                  P_marker[i1] = strong_f_marker;
+                  common_c = 0;
                   for (kk = S_diag_i[i1]; kk < S_diag_i[i1 + 1]; kk++)
                   {
                      k1 = S_diag_j[kk];
-                     if (CF_marker[k1] >= 0)
+                     if (P_marker[k1] >= jj_begin_row && P_marker[k1] < ccounter)
                      {
-                        if (P_marker[k1] < jj_begin_row)
-                        {
-                           P_marker[k1] = jj_counter;
-                           P_diag_j[jj_counter] = fine_to_coarse[k1];
-                           P_diag_data[jj_counter] = zero;
-                           jj_counter++;
-                        }
+                        common_c = 1;
+                        break;
                      }
                   }
-                  if (num_procs > 1)
+                  if (num_procs > 1 && common_c == 0)
                   {
+                     /* no common c point yet, check offd */
                      for (kk = S_offd_i[i1]; kk < S_offd_i[i1 + 1]; kk++)
                      {
                         k1 = S_offd_j[kk];
-                        if (CF_marker_offd[k1] >= 0)
+
+                        if (P_marker_offd[k1] >= jj_begin_row_offd && P_marker_offd[k1] < ccounter_offd)
                         {
-                           if (P_marker_offd[k1] < jj_begin_row_offd)
-                           {
-                              P_marker_offd[k1] = jj_counter_offd;
-                              P_offd_j[jj_counter_offd] = k1;
-                              P_offd_data[jj_counter_offd] = zero;
-                              jj_counter_offd++;
-                           }
+                           common_c = 1;
+                           break;
                         }
                      }
                   }
-               }
-            }
-         }
-         if ( num_procs > 1)
-         {
-            for (jj = S_offd_i[i]; jj < S_offd_i[i + 1]; jj++)
-            {
-               i1 = S_offd_j[jj];
-               if (CF_marker_offd[i1] == -1)
-               {
-                  /* F points that are off proc */
-                  P_marker_offd[i1] = strong_f_marker;
-                  common_c = 0;
-                  for (kk = Sop_i[i1]; kk < Sop_i[i1 + 1]; kk++)
+                  if (!common_c)
                   {
-                     /* Check if common c */
-                     big_k1 = Sop_j[kk];
-                     if (big_k1 >= col_1 && big_k1 < col_n)
+                     /* No common c point, extend the interp set */
+                     for (kk = S_diag_i[i1]; kk < S_diag_i[i1 + 1]; kk++)
                      {
-                        /* In S_diag */
-                        loc_col = (HYPRE_Int)(big_k1 - col_1);
-                        if (CF_marker[loc_col] == 2)
+                        k1 = S_diag_j[kk];
+                        if (CF_marker[k1] >= 0)
                         {
-                           common_c = 1;
-                           break;
+                           if (P_marker[k1] < jj_begin_row)
+                           {
+                              P_marker[k1] = jj_counter;
+                              P_diag_j[jj_counter] = fine_to_coarse[k1];
+                              P_diag_data[jj_counter] = zero;
+                              jj_counter++;
+                           }
                         }
                      }
-                     else
+                     if (num_procs > 1)
                      {
-                        loc_col = -(HYPRE_Int)big_k1 - 1;
-                        if (CF_marker_offd[loc_col] == 2)
+                        for (kk = S_offd_i[i1]; kk < S_offd_i[i1 + 1]; kk++)
                         {
-                           common_c = 1;
-                           break;
+                           k1 = S_offd_j[kk];
+                           if (CF_marker_offd[k1] >= 0)
+                           {
+                              if (P_marker_offd[k1] < jj_begin_row_offd)
+                              {
+                                 P_marker_offd[k1] = jj_counter_offd;
+                                 P_offd_j[jj_counter_offd] = k1;
+                                 P_offd_data[jj_counter_offd] = zero;
+                                 jj_counter_offd++;
+                              }
+                           }
                         }
                      }
                   }
-                  if (!common_c)
+               }
+            }
+            if ( num_procs > 1)
+            {
+               for (jj = S_offd_i[i]; jj < S_offd_i[i + 1]; jj++)
+               {
+                  i1 = S_offd_j[jj];
+                  if (CF_marker_offd[i1] == -1)
                   {
+                     /* F points that are off proc */
+                     P_marker_offd[i1] = strong_f_marker;
+                     common_c = 0;
                      for (kk = Sop_i[i1]; kk < Sop_i[i1 + 1]; kk++)
                      {
+                        /* Check if common c */
                         big_k1 = Sop_j[kk];
-                        /* Find local col number */
                         if (big_k1 >= col_1 && big_k1 < col_n)
                         {
+                           /* In S_diag */
                            loc_col = (HYPRE_Int)(big_k1 - col_1);
-                           if (P_marker[loc_col] < jj_begin_row)
+                           if (P_marker[loc_col] >= jj_begin_row && P_marker[loc_col] < ccounter)
                            {
-                              P_marker[loc_col] = jj_counter;
-                              P_diag_j[jj_counter] = fine_to_coarse[loc_col];
-                              P_diag_data[jj_counter] = zero;
-                              jj_counter++;
+                              common_c = 1;
+                              break;
                            }
                         }
                         else
                         {
                            loc_col = -(HYPRE_Int)big_k1 - 1;
-                           if (P_marker_offd[loc_col] < jj_begin_row_offd)
+                           if (P_marker_offd[loc_col] >= jj_begin_row_offd && P_marker_offd[loc_col] < ccounter_offd)
                            {
-                              P_marker_offd[loc_col] = jj_counter_offd;
-                              P_offd_j[jj_counter_offd] = loc_col;
-                              P_offd_data[jj_counter_offd] = zero;
-                              jj_counter_offd++;
+                              common_c = 1;
+                              break;
+                           }
+                        }
+                     }
+                     if (!common_c)
+                     {
+                        for (kk = Sop_i[i1]; kk < Sop_i[i1 + 1]; kk++)
+                        {
+                           big_k1 = Sop_j[kk];
+                           /* Find local col number */
+                           if (big_k1 >= col_1 && big_k1 < col_n)
+                           {
+                              loc_col = (HYPRE_Int)(big_k1 - col_1);
+                              if (P_marker[loc_col] < jj_begin_row)
+                              {
+                                 P_marker[loc_col] = jj_counter;
+                                 P_diag_j[jj_counter] = fine_to_coarse[loc_col];
+                                 P_diag_data[jj_counter] = zero;
+                                 jj_counter++;
+                              }
+                           }
+                           else
+                           {
+                              loc_col = -(HYPRE_Int)big_k1 - 1;
+                              if (P_marker_offd[loc_col] < jj_begin_row_offd)
+                              {
+                                 P_marker_offd[loc_col] = jj_counter_offd;
+                                 P_offd_j[jj_counter_offd] = loc_col;
+                                 P_offd_data[jj_counter_offd] = zero;
+                                 jj_counter_offd++;
+                              }
                            }
                         }
                      }
                   }
                }
             }
-         }
-         for (jj = S_diag_i[i]; jj < S_diag_i[i + 1]; jj++)
-         {
-            /* Search C points only */
-            i1 = S_diag_j[jj];
-
-            /*--------------------------------------------------------------
-             * If neighbor i1 is a C-point, set column number in P_diag_j
-             * and initialize interpolation weight to zero.
-             *--------------------------------------------------------------*/
-
-            if (CF_marker[i1] == 2)
-            {
-               CF_marker[i1]  = 1;
-            }
-         }
-         if ( num_procs > 1)
-         {
-            for (jj = S_offd_i[i]; jj < S_offd_i[i + 1]; jj++)
-            {
-               i1 = S_offd_j[jj];
-               if ( CF_marker_offd[i1] == 2)
-               {
-                  CF_marker_offd[i1]  = 1;
-               }
-            }
-         }
 
 
-         jj_end_row = jj_counter;
-         jj_end_row_offd = jj_counter_offd;
+            jj_end_row = jj_counter;
+            jj_end_row_offd = jj_counter_offd;
 
-         diagonal = A_diag_data[A_diag_i[i]];
-         for (jj = A_diag_i[i] + 1; jj < A_diag_i[i + 1]; jj++)
-         {
-            /* i1 is a c-point and strongly influences i, accumulate
-             * a_(i,i1) into interpolation weight */
-            i1 = A_diag_j[jj];
-            if (P_marker[i1] >= jj_begin_row)
-            {
-               P_diag_data[P_marker[i1]] += A_diag_data[jj];
-            }
-            else if (P_marker[i1] == strong_f_marker)
+            diagonal = A_diag_data[A_diag_i[i]];
+            for (jj = A_diag_i[i] + 1; jj < A_diag_i[i + 1]; jj++)
             {
-               sum = zero;
-               if (A_diag_data[A_diag_i[i1]] < 0) { sgn = -1; }
-               /* Loop over row of A for point i1 and calculate the sum
-                * of the connections to c-points that strongly incluence i. */
-               for (jj1 = A_diag_i[i1]; jj1 < A_diag_i[i1 + 1]; jj1++)
-               {
-                  i2 = A_diag_j[jj1];
-                  if (P_marker[i2] >= jj_begin_row && (sgn * A_diag_data[jj1]) < 0)
-                  {
-                     sum += A_diag_data[jj1];
-                  }
-               }
-               if (num_procs > 1)
+               /* i1 is a c-point and strongly influences i, accumulate
+                * a_(i,i1) into interpolation weight */
+               i1 = A_diag_j[jj];
+               if (P_marker[i1] >= jj_begin_row)
                {
-                  for (jj1 = A_offd_i[i1]; jj1 < A_offd_i[i1 + 1]; jj1++)
-                  {
-                     i2 = A_offd_j[jj1];
-                     if (P_marker_offd[i2] >= jj_begin_row_offd &&
-                         (sgn * A_offd_data[jj1]) < 0)
-                     {
-                        sum += A_offd_data[jj1];
-                     }
-                  }
+                  P_diag_data[P_marker[i1]] += A_diag_data[jj];
                }
-               if (sum != 0)
+               else if (P_marker[i1] == strong_f_marker)
                {
-                  distribute = A_diag_data[jj] / sum;
-                  /* Loop over row of A for point i1 and do the distribution */
+                  sum = zero;
+                  sgn = 1;
+               if (A_diag_data[A_diag_i[i1]] < 0) { sgn = -1; }
+                  /* Loop over row of A for point i1 and calculate the sum
+                   * of the connections to c-points that strongly incluence i. */
                   for (jj1 = A_diag_i[i1]; jj1 < A_diag_i[i1 + 1]; jj1++)
                   {
                      i2 = A_diag_j[jj1];
                      if (P_marker[i2] >= jj_begin_row && (sgn * A_diag_data[jj1]) < 0)
-                        P_diag_data[P_marker[i2]] +=
-                           distribute * A_diag_data[jj1];
+                     {
+                        sum += A_diag_data[jj1];
+                     }
                   }
                   if (num_procs > 1)
                   {
@@ -3651,62 +3806,61 @@ hypre_BoomerAMGBuildFFInterp(hypre_ParCSRMatrix  *A,
                         i2 = A_offd_j[jj1];
                         if (P_marker_offd[i2] >= jj_begin_row_offd &&
                             (sgn * A_offd_data[jj1]) < 0)
-                           P_offd_data[P_marker_offd[i2]] +=
-                              distribute * A_offd_data[jj1];
+                        {
+                           sum += A_offd_data[jj1];
+                        }
                      }
                   }
-               }
-               else
-               {
-                  diagonal += A_diag_data[jj];
-               }
-            }
-            /* neighbor i1 weakly influences i, accumulate a_(i,i1) into
-             * diagonal */
-            else if (CF_marker[i1] != -3)
-            {
-               if (num_functions == 1 || dof_func[i] == dof_func[i1])
-               {
-                  diagonal += A_diag_data[jj];
-               }
-            }
-         }
-         if (num_procs > 1)
-         {
-            for (jj = A_offd_i[i]; jj < A_offd_i[i + 1]; jj++)
-            {
-               i1 = A_offd_j[jj];
-               if (P_marker_offd[i1] >= jj_begin_row_offd)
-               {
-                  P_offd_data[P_marker_offd[i1]] += A_offd_data[jj];
-               }
-               else if (P_marker_offd[i1] == strong_f_marker)
-               {
-                  sum = zero;
-                  for (jj1 = A_ext_i[i1]; jj1 < A_ext_i[i1 + 1]; jj1++)
+                  if (sum != 0)
                   {
-                     big_k1 = A_ext_j[jj1];
-                     if (big_k1 >= col_1 && big_k1 < col_n)
+                     distribute = A_diag_data[jj] / sum;
+                     /* Loop over row of A for point i1 and do the distribution */
+                     for (jj1 = A_diag_i[i1]; jj1 < A_diag_i[i1 + 1]; jj1++)
                      {
-                        /* diag */
-                        loc_col = (HYPRE_Int)(big_k1 - col_1);
-                        if (P_marker[loc_col] >= jj_begin_row)
-                        {
-                           sum += A_ext_data[jj1];
-                        }
+                        i2 = A_diag_j[jj1];
+                        if (P_marker[i2] >= jj_begin_row && (sgn * A_diag_data[jj1]) < 0)
+                           P_diag_data[P_marker[i2]] +=
+                              distribute * A_diag_data[jj1];
                      }
-                     else
+                     if (num_procs > 1)
                      {
-                        loc_col = -(HYPRE_Int)big_k1 - 1;
-                        if (P_marker_offd[loc_col] >= jj_begin_row_offd)
+                        for (jj1 = A_offd_i[i1]; jj1 < A_offd_i[i1 + 1]; jj1++)
                         {
-                           sum += A_ext_data[jj1];
+                           i2 = A_offd_j[jj1];
+                           if (P_marker_offd[i2] >= jj_begin_row_offd &&
+                               (sgn * A_offd_data[jj1]) < 0)
+                              P_offd_data[P_marker_offd[i2]] +=
+                                 distribute * A_offd_data[jj1];
                         }
                      }
                   }
-                  if (sum != 0)
+                  else
                   {
-                     distribute = A_offd_data[jj] / sum;
+                     diagonal += A_diag_data[jj];
+                  }
+               }
+               /* neighbor i1 weakly influences i, accumulate a_(i,i1) into
+                * diagonal */
+               else if (CF_marker[i1] != -3)
+               {
+                  if (num_functions == 1 || dof_func[i] == dof_func[i1])
+                  {
+                     diagonal += A_diag_data[jj];
+                  }
+               }
+            }
+            if (num_procs > 1)
+            {
+               for (jj = A_offd_i[i]; jj < A_offd_i[i + 1]; jj++)
+               {
+                  i1 = A_offd_j[jj];
+                  if (P_marker_offd[i1] >= jj_begin_row_offd)
+                  {
+                     P_offd_data[P_marker_offd[i1]] += A_offd_data[jj];
+                  }
+                  else if (P_marker_offd[i1] == strong_f_marker)
+                  {
+                     sum = zero;
                      for (jj1 = A_ext_i[i1]; jj1 < A_ext_i[i1 + 1]; jj1++)
                      {
                         big_k1 = A_ext_j[jj1];
@@ -3715,47 +3869,77 @@ hypre_BoomerAMGBuildFFInterp(hypre_ParCSRMatrix  *A,
                            /* diag */
                            loc_col = (HYPRE_Int)(big_k1 - col_1);
                            if (P_marker[loc_col] >= jj_begin_row)
-                              P_diag_data[P_marker[loc_col]] += distribute *
-                                                                A_ext_data[jj1];
+                           {
+                              sum += A_ext_data[jj1];
+                           }
                         }
                         else
                         {
                            loc_col = -(HYPRE_Int)big_k1 - 1;
                            if (P_marker_offd[loc_col] >= jj_begin_row_offd)
-                              P_offd_data[P_marker_offd[loc_col]] += distribute *
-                                                                     A_ext_data[jj1];
+                           {
+                              sum += A_ext_data[jj1];
+                           }
+                        }
+                     }
+                     if (sum != 0)
+                     {
+                        distribute = A_offd_data[jj] / sum;
+                        for (jj1 = A_ext_i[i1]; jj1 < A_ext_i[i1 + 1]; jj1++)
+                        {
+                           big_k1 = A_ext_j[jj1];
+                           if (big_k1 >= col_1 && big_k1 < col_n)
+                           {
+                              /* diag */
+                              loc_col = (HYPRE_Int)(big_k1 - col_1);
+                              if (P_marker[loc_col] >= jj_begin_row)
+                                 P_diag_data[P_marker[loc_col]] += distribute *
+                                                                   A_ext_data[jj1];
+                           }
+                           else
+                           {
+                              loc_col = -(HYPRE_Int)big_k1 - 1;
+                              if (P_marker_offd[loc_col] >= jj_begin_row_offd)
+                                 P_offd_data[P_marker_offd[loc_col]] += distribute *
+                                                                        A_ext_data[jj1];
+                           }
                         }
                      }
+                     else
+                     {
+                        diagonal += A_offd_data[jj];
+                     }
                   }
-                  else
+                  else if (CF_marker_offd[i1] != -3)
                   {
-                     diagonal += A_offd_data[jj];
+                     if (num_functions == 1 || dof_func[i] == dof_func_offd[i1])
+                     {
+                        diagonal += A_offd_data[jj];
+                     }
                   }
                }
-               else if (CF_marker_offd[i1] != -3)
+            }
+            if (diagonal)
+            {
+               for (jj = jj_begin_row; jj < jj_end_row; jj++)
                {
-                  if (num_functions == 1 || dof_func[i] == dof_func_offd[i1])
-                  {
-                     diagonal += A_offd_data[jj];
-                  }
+                  P_diag_data[jj] /= -diagonal;
+               }
+               for (jj = jj_begin_row_offd; jj < jj_end_row_offd; jj++)
+               {
+                  P_offd_data[jj] /= -diagonal;
                }
             }
          }
-         if (diagonal)
-         {
-            for (jj = jj_begin_row; jj < jj_end_row; jj++)
-            {
-               P_diag_data[jj] /= -diagonal;
-            }
-            for (jj = jj_begin_row_offd; jj < jj_end_row_offd; jj++)
-            {
-               P_offd_data[jj] /= -diagonal;
-            }
-         }
+         strong_f_marker--;
       }
-      strong_f_marker--;
+
+      hypre_TFree(P_marker, HYPRE_MEMORY_HOST);
+      hypre_TFree(P_marker_offd, HYPRE_MEMORY_HOST);
    }
 
+   hypre_TFree(workspace, HYPRE_MEMORY_HOST);
+
    P = hypre_ParCSRMatrixCreate(comm,
                                 hypre_ParCSRMatrixGlobalNumRows(A),
                                 total_global_cpts,
@@ -3807,14 +3991,12 @@ hypre_BoomerAMGBuildFFInterp(hypre_ParCSRMatrix  *A,
 
    /* Deallocate memory */
    hypre_TFree(fine_to_coarse, HYPRE_MEMORY_HOST);
-   hypre_TFree(P_marker, HYPRE_MEMORY_HOST);
 
    if (num_procs > 1)
    {
       hypre_CSRMatrixDestroy(Sop);
       hypre_CSRMatrixDestroy(A_ext);
       hypre_TFree(fine_to_coarse_offd, HYPRE_MEMORY_HOST);
-      hypre_TFree(P_marker_offd, HYPRE_MEMORY_HOST);
       hypre_TFree(CF_marker_offd, HYPRE_MEMORY_HOST);
       hypre_TFree(tmp_CF_marker_offd, HYPRE_MEMORY_HOST);
       if (num_functions > 1)
@@ -4859,7 +5041,7 @@ hypre_BoomerAMGBuildExtInterpHost(hypre_ParCSRMatrix  *A,
 
    /* Interpolation weight variables */
    HYPRE_Real       sum, diagonal, distribute;
-   HYPRE_Int        strong_f_marker = -2;
+   HYPRE_Int        strong_f_marker;
 
    /* Loop variables */
    /*HYPRE_Int              index;*/
@@ -4867,6 +5049,10 @@ hypre_BoomerAMGBuildExtInterpHost(hypre_ParCSRMatrix  *A,
    HYPRE_Int        i, i1, i2, jj, kk, k1, jj1;
    HYPRE_BigInt     big_k1;
 
+   /* Threading variables */
+   HYPRE_Int        start, stop;
+   HYPRE_Int       *workspace;
+
    /* Definitions */
    HYPRE_Real       zero = 0.0;
    HYPRE_Real       one  = 1.0;
@@ -4930,12 +5116,10 @@ hypre_BoomerAMGBuildExtInterpHost(hypre_ParCSRMatrix  *A,
    if (n_fine)
    {
       fine_to_coarse = hypre_CTAlloc(HYPRE_Int,  n_fine, HYPRE_MEMORY_HOST);
-      P_marker       = hypre_CTAlloc(HYPRE_Int,  n_fine, HYPRE_MEMORY_HOST);
    }
 
    if (full_off_procNodes)
    {
-      P_marker_offd       = hypre_CTAlloc(HYPRE_Int,    full_off_procNodes, HYPRE_MEMORY_HOST);
       fine_to_coarse_offd = hypre_CTAlloc(HYPRE_BigInt, full_off_procNodes, HYPRE_MEMORY_HOST);
       tmp_CF_marker_offd  = hypre_CTAlloc(HYPRE_Int,    full_off_procNodes, HYPRE_MEMORY_HOST);
    }
@@ -4944,121 +5128,150 @@ hypre_BoomerAMGBuildExtInterpHost(hypre_ParCSRMatrix  *A,
                          fine_to_coarse_offd, P_marker, P_marker_offd,
                          tmp_CF_marker_offd);
 
-   jj_counter = start_indexing;
-   jj_counter_offd = start_indexing;
-   coarse_counter = 0;
-
    /*-----------------------------------------------------------------------
-    *  Loop over fine grid.
+    *  Loop over fine grid.  Each thread handles a contiguous range of rows
+    *  with its own marker arrays: it first counts the entries of its rows of
+    *  P, the row pointers are then shifted by the counts of the preceding
+    *  threads, and finally each thread fills its rows.  P does not depend on
+    *  the number of threads.
     *-----------------------------------------------------------------------*/
-   for (i = 0; i < n_fine; i++)
+   workspace = hypre_TAlloc(HYPRE_Int, 3 * (hypre_NumThreads() + 1), HYPRE_MEMORY_HOST);
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel private(i, start, stop, coarse_counter, jj_counter, jj_counter_offd, \
+                               P_marker, P_marker_offd, jj, kk, i1, k1, loc_col, jj_begin_row, \
+                               jj_begin_row_offd, jj_end_row, jj_end_row_offd, diagonal, sum, sgn, \
+                               jj1, i2, distribute, strong_f_marker, big_k1)
+#endif
    {
-      P_diag_i[i] = jj_counter;
-      if (num_procs > 1)
+      /* initialize thread-wise variables */
+      strong_f_marker = -2;
+      coarse_counter = 0;
+      jj_counter = start_indexing;
+      jj_counter_offd = start_indexing;
+      P_marker = hypre_TAlloc(HYPRE_Int, n_fine, HYPRE_MEMORY_HOST);
+      P_marker_offd = hypre_TAlloc(HYPRE_Int, full_off_procNodes, HYPRE_MEMORY_HOST);
+      for (i = 0; i < n_fine; i++)
       {
-         P_offd_i[i] = jj_counter_offd;
+         P_marker[i] = -1;
       }
-
-      if (CF_marker[i] >= 0)
+      for (i = 0; i < full_off_procNodes; i++)
       {
-         jj_counter++;
-         fine_to_coarse[i] = coarse_counter;
-         coarse_counter++;
+         P_marker_offd[i] = -1;
       }
 
-      /*--------------------------------------------------------------------
-       *  If i is an F-point, interpolation is from the C-points that
-       *  strongly influence i, or C-points that stronly influence F-points
-       *  that strongly influence i.
-       *--------------------------------------------------------------------*/
-      else if (CF_marker[i] != -3)
+      /* this thread's row range */
+      hypre_GetSimpleThreadPartition(&start, &stop, n_fine);
+
+      for (i = start; i < stop; i++)
       {
-         for (jj = S_diag_i[i]; jj < S_diag_i[i + 1]; jj++)
+         P_diag_i[i] = jj_counter;
+         if (num_procs > 1)
          {
-            i1 = S_diag_j[jj];
-            if (CF_marker[i1] >= 0)
+            P_offd_i[i] = jj_counter_offd;
+         }
+
+         if (CF_marker[i] >= 0)
+         {
+            jj_counter++;
+            fine_to_coarse[i] = coarse_counter;
+            coarse_counter++;
+         }
+
+         /*--------------------------------------------------------------------
+          *  If i is an F-point, interpolation is from the C-points that
+          *  strongly influence i, or C-points that stronly influence F-points
+          *  that strongly influence i.
+          *--------------------------------------------------------------------*/
+         else if (CF_marker[i] != -3)
+         {
+            for (jj = S_diag_i[i]; jj < S_diag_i[i + 1]; jj++)
             {
-               /* i1 is a C point */
-               if (P_marker[i1] < P_diag_i[i])
+               i1 = S_diag_j[jj];
+               if (CF_marker[i1] >= 0)
                {
-                  P_marker[i1] = jj_counter;
-                  jj_counter++;
+                  /* i1 is a C point */
+                  if (P_marker[i1] < P_diag_i[i])
+                  {
+                     P_marker[i1] = jj_counter;
+                     jj_counter++;
+                  }
                }
-            }
-            else if (CF_marker[i1] != -3)
-            {
-               /* i1 is a F point, loop through it's strong neighbors */
-               for (kk = S_diag_i[i1]; kk < S_diag_i[i1 + 1]; kk++)
+               else if (CF_marker[i1] != -3)
                {
-                  k1 = S_diag_j[kk];
-                  if (CF_marker[k1] >= 0)
+                  /* i1 is a F point, loop through it's strong neighbors */
+                  for (kk = S_diag_i[i1]; kk < S_diag_i[i1 + 1]; kk++)
                   {
-                     if (P_marker[k1] < P_diag_i[i])
+                     k1 = S_diag_j[kk];
+                     if (CF_marker[k1] >= 0)
                      {
-                        P_marker[k1] = jj_counter;
-                        jj_counter++;
+                        if (P_marker[k1] < P_diag_i[i])
+                        {
+                           P_marker[k1] = jj_counter;
+                           jj_counter++;
+                        }
                      }
                   }
-               }
-               if (num_procs > 1)
-               {
-                  for (kk = S_offd_i[i1]; kk < S_offd_i[i1 + 1]; kk++)
+                  if (num_procs > 1)
                   {
-                     k1 = S_offd_j[kk];
-                     if (CF_marker_offd[k1] >= 0)
+                     for (kk = S_offd_i[i1]; kk < S_offd_i[i1 + 1]; kk++)
                      {
-                        if (P_marker_offd[k1] < P_offd_i[i])
+                        k1 = S_offd_j[kk];
+                        if (CF_marker_offd[k1] >= 0)
                         {
-                           tmp_CF_marker_offd[k1] = 1;
-                           P_marker_offd[k1] = jj_counter_offd;
-                           jj_counter_offd++;
+                           if (P_marker_offd[k1] < P_offd_i[i])
+                           {
+                              tmp_CF_marker_offd[k1] = 1;
+                              P_marker_offd[k1] = jj_counter_offd;
+                              jj_counter_offd++;
+                           }
                         }
                      }
                   }
                }
             }
-         }
-         /* Look at off diag strong connections of i */
-         if (num_procs > 1)
-         {
-            for (jj = S_offd_i[i]; jj < S_offd_i[i + 1]; jj++)
+            /* Look at off diag strong connections of i */
+            if (num_procs > 1)
             {
-               i1 = S_offd_j[jj];
-               if (CF_marker_offd[i1] >= 0)
+               for (jj = S_offd_i[i]; jj < S_offd_i[i + 1]; jj++)
                {
-                  if (P_marker_offd[i1] < P_offd_i[i])
+                  i1 = S_offd_j[jj];
+                  if (CF_marker_offd[i1] >= 0)
                   {
-                     tmp_CF_marker_offd[i1] = 1;
-                     P_marker_offd[i1] = jj_counter_offd;
-                     jj_counter_offd++;
+                     if (P_marker_offd[i1] < P_offd_i[i])
+                     {
+                        tmp_CF_marker_offd[i1] = 1;
+                        P_marker_offd[i1] = jj_counter_offd;
+                        jj_counter_offd++;
+                     }
                   }
-               }
-               else if (CF_marker_offd[i1] != -3)
-               {
-                  /* F point; look at neighbors of i1. Sop contains global col
-                   * numbers and entries that could be in S_diag or S_offd or
-                   * neither. */
-                  for (kk = Sop_i[i1]; kk < Sop_i[i1 + 1]; kk++)
+                  else if (CF_marker_offd[i1] != -3)
                   {
-                     big_k1 = Sop_j[kk];
-                     if (big_k1 >= col_1 && big_k1 < col_n)
+                     /* F point; look at neighbors of i1. Sop contains global col
+                      * numbers and entries that could be in S_diag or S_offd or
+                      * neither. */
+                     for (kk = Sop_i[i1]; kk < Sop_i[i1 + 1]; kk++)
                      {
-                        /* In S_diag */
-                        loc_col = (HYPRE_Int)(big_k1 - col_1);
-                        if (P_marker[loc_col] < P_diag_i[i])
+                        big_k1 = Sop_j[kk];
+                        if (big_k1 >= col_1 && big_k1 < col_n)
                         {
-                           P_marker[loc_col] = jj_counter;
-                           jj_counter++;
+                           /* In S_diag */
+                           loc_col = (HYPRE_Int)(big_k1 - col_1);
+                           if (P_marker[loc_col] < P_diag_i[i])
+                           {
+                              P_marker[loc_col] = jj_counter;
+                              jj_counter++;
+                           }
                         }
-                     }
-                     else
-                     {
-                        loc_col = -(HYPRE_Int)big_k1 - 1;
-                        if (P_marker_offd[loc_col] < P_offd_i[i])
+                        else
                         {
-                           P_marker_offd[loc_col] = jj_counter_offd;
-                           tmp_CF_marker_offd[loc_col] = 1;
-                           jj_counter_offd++;
+                           loc_col = -(HYPRE_Int)big_k1 - 1;
+                           if (P_marker_offd[loc_col] < P_offd_i[i])
+                           {
+                              P_marker_offd[loc_col] = jj_counter_offd;
+                              tmp_CF_marker_offd[loc_col] = 1;
+                              jj_counter_offd++;
+                           }
                         }
                      }
                   }
@@ -5066,247 +5279,228 @@ hypre_BoomerAMGBuildExtInterpHost(hypre_ParCSRMatrix  *A,
             }
          }
       }
-   }
 
-   if (debug_flag == 4)
-   {
-      wall_time = time_getWallclockSeconds() - wall_time;
-      hypre_printf("Proc = %d     determine structure    %f\n",
-                   my_id, wall_time);
-      fflush(NULL);
-   }
-   /*-----------------------------------------------------------------------
-    *  Allocate  arrays.
-    *-----------------------------------------------------------------------*/
-
-   if (debug_flag == 4)
-   {
-      wall_time = time_getWallclockSeconds();
-   }
-
-   P_diag_size = jj_counter;
-   P_offd_size = jj_counter_offd;
-
-   if (P_diag_size)
-   {
-      P_diag_j    = hypre_CTAlloc(HYPRE_Int,  P_diag_size, memory_location_P);
-      P_diag_data = hypre_CTAlloc(HYPRE_Real, P_diag_size, memory_location_P);
-   }
-
-   if (P_offd_size)
-   {
-      P_offd_j    = hypre_CTAlloc(HYPRE_Int,  P_offd_size, memory_location_P);
-      P_offd_data = hypre_CTAlloc(HYPRE_Real, P_offd_size, memory_location_P);
-   }
-
-   P_diag_i[n_fine] = jj_counter;
-   P_offd_i[n_fine] = jj_counter_offd;
+      /* Stitch P_diag_i, P_offd_i and fine_to_coarse together */
+      hypre_BoomerAMGInterpShiftRows(start, stop, n_fine, jj_counter, jj_counter_offd,
+                                     coarse_counter, P_diag_i, P_offd_i, fine_to_coarse,
+                                     workspace);
 
-   jj_counter = start_indexing;
-   jj_counter_offd = start_indexing;
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp master
+#endif
+      {
+         if (debug_flag == 4)
+         {
+            wall_time = time_getWallclockSeconds() - wall_time;
+            hypre_printf("Proc = %d     determine structure    %f\n",
+                         my_id, wall_time);
+            fflush(NULL);
+            wall_time = time_getWallclockSeconds();
+         }
 
-   /* Fine to coarse mapping */
-   if (num_procs > 1)
-   {
-      hypre_big_insert_new_nodes(comm_pkg, extend_comm_pkg, fine_to_coarse,
-                                 full_off_procNodes, my_first_cpt,
-                                 fine_to_coarse_offd);
-   }
+         /*-----------------------------------------------------------------------
+          *  Allocate  arrays.
+          *-----------------------------------------------------------------------*/
 
-   for (i = 0; i < n_fine; i++)
-   {
-      P_marker[i] = -1;
-   }
+         P_diag_size = P_diag_i[n_fine];
+         P_offd_size = P_offd_i[n_fine];
 
-   for (i = 0; i < full_off_procNodes; i++)
-   {
-      P_marker_offd[i] = -1;
-   }
+         if (P_diag_size)
+         {
+            P_diag_j    = hypre_CTAlloc(HYPRE_Int,  P_diag_size, memory_location_P);
+            P_diag_data = hypre_CTAlloc(HYPRE_Real, P_diag_size, memory_location_P);
+         }
 
-   /*-----------------------------------------------------------------------
-    *  Loop over fine grid points.
-    *-----------------------------------------------------------------------*/
-   for (i = 0; i < n_fine; i++)
-   {
-      jj_begin_row = jj_counter;
-      jj_begin_row_offd = jj_counter_offd;
+         if (P_offd_size)
+         {
+            P_offd_j    = hypre_CTAlloc(HYPRE_Int,  P_offd_size, memory_location_P);
+            P_offd_data = hypre_CTAlloc(HYPRE_Real, P_offd_size, memory_location_P);
+         }
 
-      /*--------------------------------------------------------------------
-       *  If i is a c-point, interpolation is the identity.
-       *--------------------------------------------------------------------*/
+         /* Fine to coarse mapping */
+         if (num_procs > 1)
+         {
+            hypre_big_insert_new_nodes(comm_pkg, extend_comm_pkg, fine_to_coarse,
+                                       full_off_procNodes, my_first_cpt,
+                                       fine_to_coarse_offd);
+         }
+      }
 
-      if (CF_marker[i] >= 0)
+      for (i = 0; i < n_fine; i++)
       {
-         P_diag_j[jj_counter]    = fine_to_coarse[i];
-         P_diag_data[jj_counter] = one;
-         jj_counter++;
+         P_marker[i] = -1;
+      }
+      for (i = 0; i < full_off_procNodes; i++)
+      {
+         P_marker_offd[i] = -1;
       }
 
-      /*--------------------------------------------------------------------
-       *  If i is an F-point, build interpolation.
-       *--------------------------------------------------------------------*/
-
-      else if (CF_marker[i] != -3)
+      /*-----------------------------------------------------------------------
+       *  Loop over fine grid points.
+       *-----------------------------------------------------------------------*/
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp barrier
+#endif
+      for (i = start; i < stop; i++)
       {
-         strong_f_marker--;
-         for (jj = S_diag_i[i]; jj < S_diag_i[i + 1]; jj++)
+         jj_begin_row = P_diag_i[i];
+         jj_begin_row_offd = P_offd_i[i];
+         jj_counter = jj_begin_row;
+         jj_counter_offd = jj_begin_row_offd;
+
+         /*--------------------------------------------------------------------
+          *  If i is a c-point, interpolation is the identity.
+          *--------------------------------------------------------------------*/
+
+         if (CF_marker[i] >= 0)
          {
-            i1 = S_diag_j[jj];
+            P_diag_j[jj_counter]    = fine_to_coarse[i];
+            P_diag_data[jj_counter] = one;
+            jj_counter++;
+         }
 
-            /*--------------------------------------------------------------
-             * If neighbor i1 is a C-point, set column number in P_diag_j
-             * and initialize interpolation weight to zero.
-             *--------------------------------------------------------------*/
+         /*--------------------------------------------------------------------
+          *  If i is an F-point, build interpolation.
+          *--------------------------------------------------------------------*/
 
-            if (CF_marker[i1] >= 0)
+         else if (CF_marker[i] != -3)
+         {
+            strong_f_marker--;
+            for (jj = S_diag_i[i]; jj < S_diag_i[i + 1]; jj++)
             {
-               if (P_marker[i1] < jj_begin_row)
+               i1 = S_diag_j[jj];
+
+               /*--------------------------------------------------------------
+                * If neighbor i1 is a C-point, set column number in P_diag_j
+                * and initialize interpolation weight to zero.
+                *--------------------------------------------------------------*/
+
+               if (CF_marker[i1] >= 0)
                {
-                  P_marker[i1] = jj_counter;
-                  P_diag_j[jj_counter]    = fine_to_coarse[i1];
-                  P_diag_data[jj_counter] = zero;
-                  jj_counter++;
+                  if (P_marker[i1] < jj_begin_row)
+                  {
+                     P_marker[i1] = jj_counter;
+                     P_diag_j[jj_counter]    = fine_to_coarse[i1];
+                     P_diag_data[jj_counter] = zero;
+                     jj_counter++;
+                  }
                }
-            }
-            else  if (CF_marker[i1] != -3)
-            {
-               P_marker[i1] = strong_f_marker;
-               for (kk = S_diag_i[i1]; kk < S_diag_i[i1 + 1]; kk++)
+               else  if (CF_marker[i1] != -3)
                {
-                  k1 = S_diag_j[kk];
-                  if (CF_marker[k1] >= 0)
+                  P_marker[i1] = strong_f_marker;
+                  for (kk = S_diag_i[i1]; kk < S_diag_i[i1 + 1]; kk++)
                   {
-                     if (P_marker[k1] < jj_begin_row)
+                     k1 = S_diag_j[kk];
+                     if (CF_marker[k1] >= 0)
                      {
-                        P_marker[k1] = jj_counter;
-                        P_diag_j[jj_counter] = fine_to_coarse[k1];
-                        P_diag_data[jj_counter] = zero;
-                        jj_counter++;
+                        if (P_marker[k1] < jj_begin_row)
+                        {
+                           P_marker[k1] = jj_counter;
+                           P_diag_j[jj_counter] = fine_to_coarse[k1];
+                           P_diag_data[jj_counter] = zero;
+                           jj_counter++;
+                        }
                      }
                   }
-               }
-               if (num_procs > 1)
-               {
-                  for (kk = S_offd_i[i1]; kk < S_offd_i[i1 + 1]; kk++)
+                  if (num_procs > 1)
                   {
-                     k1 = S_offd_j[kk];
-                     if (CF_marker_offd[k1] >= 0)
+                     for (kk = S_offd_i[i1]; kk < S_offd_i[i1 + 1]; kk++)
                      {
-                        if (P_marker_offd[k1] < jj_begin_row_offd)
+                        k1 = S_offd_j[kk];
+                        if (CF_marker_offd[k1] >= 0)
                         {
-                           P_marker_offd[k1] = jj_counter_offd;
-                           P_offd_j[jj_counter_offd] = k1;
-                           P_offd_data[jj_counter_offd] = zero;
-                           jj_counter_offd++;
+                           if (P_marker_offd[k1] < jj_begin_row_offd)
+                           {
+                              P_marker_offd[k1] = jj_counter_offd;
+                              P_offd_j[jj_counter_offd] = k1;
+                              P_offd_data[jj_counter_offd] = zero;
+                              jj_counter_offd++;
+                           }
                         }
                      }
                   }
                }
             }
-         }
 
-         if ( num_procs > 1)
-         {
-            for (jj = S_offd_i[i]; jj < S_offd_i[i + 1]; jj++)
+            if ( num_procs > 1)
             {
-               i1 = S_offd_j[jj];
-               if ( CF_marker_offd[i1] >= 0)
+               for (jj = S_offd_i[i]; jj < S_offd_i[i + 1]; jj++)
                {
-                  if (P_marker_offd[i1] < jj_begin_row_offd)
+                  i1 = S_offd_j[jj];
+                  if ( CF_marker_offd[i1] >= 0)
                   {
-                     P_marker_offd[i1] = jj_counter_offd;
-                     P_offd_j[jj_counter_offd] = i1;
-                     P_offd_data[jj_counter_offd] = zero;
-                     jj_counter_offd++;
+                     if (P_marker_offd[i1] < jj_begin_row_offd)
+                     {
+                        P_marker_offd[i1] = jj_counter_offd;
+                        P_offd_j[jj_counter_offd] = i1;
+                        P_offd_data[jj_counter_offd] = zero;
+                        jj_counter_offd++;
+                     }
                   }
-               }
-               else if (CF_marker_offd[i1] != -3)
-               {
-                  P_marker_offd[i1] = strong_f_marker;
-                  for (kk = Sop_i[i1]; kk < Sop_i[i1 + 1]; kk++)
+                  else if (CF_marker_offd[i1] != -3)
                   {
-                     big_k1 = Sop_j[kk];
-                     /* Find local col number */
-                     if (big_k1 >= col_1 && big_k1 < col_n)
+                     P_marker_offd[i1] = strong_f_marker;
+                     for (kk = Sop_i[i1]; kk < Sop_i[i1 + 1]; kk++)
                      {
-                        loc_col = (HYPRE_Int)(big_k1 - col_1);
-                        if (P_marker[loc_col] < jj_begin_row)
+                        big_k1 = Sop_j[kk];
+                        /* Find local col number */
+                        if (big_k1 >= col_1 && big_k1 < col_n)
                         {
-                           P_marker[loc_col] = jj_counter;
-                           P_diag_j[jj_counter] = fine_to_coarse[loc_col];
-                           P_diag_data[jj_counter] = zero;
-                           jj_counter++;
+                           loc_col = (HYPRE_Int)(big_k1 - col_1);
+                           if (P_marker[loc_col] < jj_begin_row)
+                           {
+                              P_marker[loc_col] = jj_counter;
+                              P_diag_j[jj_counter] = fine_to_coarse[loc_col];
+                              P_diag_data[jj_counter] = zero;
+                              jj_counter++;
+                           }
                         }
-                     }
-                     else
-                     {
-                        loc_col = -(HYPRE_Int)big_k1 - 1;
-                        if (P_marker_offd[loc_col] < jj_begin_row_offd)
+                        else
                         {
-                           P_marker_offd[loc_col] = jj_counter_offd;
-                           P_offd_j[jj_counter_offd] = loc_col;
-                           P_offd_data[jj_counter_offd] = zero;
-                           jj_counter_offd++;
+                           loc_col = -(HYPRE_Int)big_k1 - 1;
+                           if (P_marker_offd[loc_col] < jj_begin_row_offd)
+                           {
+                              P_marker_offd[loc_col] = jj_counter_offd;
+                              P_offd_j[jj_counter_offd] = loc_col;
+                              P_offd_data[jj_counter_offd] = zero;
+                              jj_counter_offd++;
+                           }
                         }
                      }
                   }
                }
             }
-         }
 
-         jj_end_row = jj_counter;
-         jj_end_row_offd = jj_counter_offd;
+            jj_end_row = jj_counter;
+            jj_end_row_offd = jj_counter_offd;
 
-         diagonal = A_diag_data[A_diag_i[i]];
+            diagonal = A_diag_data[A_diag_i[i]];
 
-         for (jj = A_diag_i[i] + 1; jj < A_diag_i[i + 1]; jj++)
-         {
-            /* i1 is a c-point and strongly influences i, accumulate
-             * a_(i,i1) into interpolation weight */
-            i1 = A_diag_j[jj];
-            if (P_marker[i1] >= jj_begin_row)
-            {
-               P_diag_data[P_marker[i1]] += A_diag_data[jj];
-            }
-            else if (P_marker[i1] == strong_f_marker)
+            for (jj = A_diag_i[i] + 1; jj < A_diag_i[i + 1]; jj++)
             {
-               sum = zero;
-               sgn = 1;
-               if (A_diag_data[A_diag_i[i1]] < 0)
-               {
-                  sgn = -1;
-               }
-               /* Loop over row of A for point i1 and calculate the sum
-                * of the connections to c-points that strongly incluence i. */
-               for (jj1 = A_diag_i[i1] + 1; jj1 < A_diag_i[i1 + 1]; jj1++)
+               /* i1 is a c-point and strongly influences i, accumulate
+                * a_(i,i1) into interpolation weight */
+               i1 = A_diag_j[jj];
+               if (P_marker[i1] >= jj_begin_row)
                {
-                  i2 = A_diag_j[jj1];
-                  if ((P_marker[i2] >= jj_begin_row ) && (sgn * A_diag_data[jj1]) < 0)
-                  {
-                     sum += A_diag_data[jj1];
-                  }
+                  P_diag_data[P_marker[i1]] += A_diag_data[jj];
                }
-               if (num_procs > 1)
+               else if (P_marker[i1] == strong_f_marker)
                {
-                  for (jj1 = A_offd_i[i1]; jj1 < A_offd_i[i1 + 1]; jj1++)
+                  sum = zero;
+                  sgn = 1;
+                  if (A_diag_data[A_diag_i[i1]] < 0)
                   {
-                     i2 = A_offd_j[jj1];
-                     if (P_marker_offd[i2] >= jj_begin_row_offd && (sgn * A_offd_data[jj1]) < 0)
-                     {
-                        sum += A_offd_data[jj1];
-                     }
+                     sgn = -1;
                   }
-               }
-               if (sum != 0)
-               {
-                  distribute = A_diag_data[jj] / sum;
-                  /* Loop over row of A for point i1 and do the distribution */
+                  /* Loop over row of A for point i1 and calculate the sum
+                   * of the connections to c-points that strongly incluence i. */
                   for (jj1 = A_diag_i[i1] + 1; jj1 < A_diag_i[i1 + 1]; jj1++)
                   {
                      i2 = A_diag_j[jj1];
-                     if (P_marker[i2] >= jj_begin_row && (sgn * A_diag_data[jj1]) < 0)
+                     if ((P_marker[i2] >= jj_begin_row ) && (sgn * A_diag_data[jj1]) < 0)
                      {
-                        P_diag_data[P_marker[i2]] += distribute * A_diag_data[jj1];
+                        sum += A_diag_data[jj1];
                      }
                   }
                   if (num_procs > 1)
@@ -5316,62 +5510,61 @@ hypre_BoomerAMGBuildExtInterpHost(hypre_ParCSRMatrix  *A,
                         i2 = A_offd_j[jj1];
                         if (P_marker_offd[i2] >= jj_begin_row_offd && (sgn * A_offd_data[jj1]) < 0)
                         {
-                           P_offd_data[P_marker_offd[i2]] += distribute * A_offd_data[jj1];
+                           sum += A_offd_data[jj1];
                         }
                      }
                   }
-               }
-               else
-               {
-                  diagonal += A_diag_data[jj];
-               }
-            }
-            /* neighbor i1 weakly influences i, accumulate a_(i,i1) into
-             * diagonal */
-            else if (CF_marker[i1] != -3)
-            {
-               if (num_functions == 1 || dof_func[i] == dof_func[i1])
-               {
-                  diagonal += A_diag_data[jj];
-               }
-            }
-         }
-         if (num_procs > 1)
-         {
-            for (jj = A_offd_i[i]; jj < A_offd_i[i + 1]; jj++)
-            {
-               i1 = A_offd_j[jj];
-               if (P_marker_offd[i1] >= jj_begin_row_offd)
-               {
-                  P_offd_data[P_marker_offd[i1]] += A_offd_data[jj];
-               }
-               else if (P_marker_offd[i1] == strong_f_marker)
-               {
-                  sum = zero;
-                  for (jj1 = A_ext_i[i1]; jj1 < A_ext_i[i1 + 1]; jj1++)
+                  if (sum != 0)
                   {
-                     big_k1 = A_ext_j[jj1];
-                     if (big_k1 >= col_1 && big_k1 < col_n)
+                     distribute = A_diag_data[jj] / sum;
+                     /* Loop over row of A for point i1 and do the distribution */
+                     for (jj1 = A_diag_i[i1] + 1; jj1 < A_diag_i[i1 + 1]; jj1++)
                      {
-                        /* diag */
-                        loc_col = (HYPRE_Int)(big_k1 - col_1);
-                        if (P_marker[loc_col] >= jj_begin_row )
+                        i2 = A_diag_j[jj1];
+                        if (P_marker[i2] >= jj_begin_row && (sgn * A_diag_data[jj1]) < 0)
                         {
-                           sum += A_ext_data[jj1];
+                           P_diag_data[P_marker[i2]] += distribute * A_diag_data[jj1];
                         }
                      }
-                     else
+                     if (num_procs > 1)
                      {
-                        loc_col = -(HYPRE_Int)big_k1 - 1;
-                        if (P_marker_offd[loc_col] >= jj_begin_row_offd)
+                        for (jj1 = A_offd_i[i1]; jj1 < A_offd_i[i1 + 1]; jj1++)
                         {
-                           sum += A_ext_data[jj1];
+                           i2 = A_offd_j[jj1];
+                           if (P_marker_offd[i2] >= jj_begin_row_offd && (sgn * A_offd_data[jj1]) < 0)
+                           {
+                              P_offd_data[P_marker_offd[i2]] += distribute * A_offd_data[jj1];
+                           }
                         }
                      }
                   }
-                  if (sum != 0)
+                  else
                   {
-                     distribute = A_offd_data[jj] / sum;
+                     diagonal += A_diag_data[jj];
+                  }
+               }
+               /* neighbor i1 weakly influences i, accumulate a_(i,i1) into
+                * diagonal */
+               else if (CF_marker[i1] != -3)
+               {
+                  if (num_functions == 1 || dof_func[i] == dof_func[i1])
+                  {
+                     diagonal += A_diag_data[jj];
+                  }
+               }
+            }
+            if (num_procs > 1)
+            {
+               for (jj = A_offd_i[i]; jj < A_offd_i[i + 1]; jj++)
+               {
+                  i1 = A_offd_j[jj];
+                  if (P_marker_offd[i1] >= jj_begin_row_offd)
+                  {
+                     P_offd_data[P_marker_offd[i1]] += A_offd_data[jj];
+                  }
+                  else if (P_marker_offd[i1] == strong_f_marker)
+                  {
+                     sum = zero;
                      for (jj1 = A_ext_i[i1]; jj1 < A_ext_i[i1 + 1]; jj1++)
                      {
                         big_k1 = A_ext_j[jj1];
@@ -5379,9 +5572,9 @@ hypre_BoomerAMGBuildExtInterpHost(hypre_ParCSRMatrix  *A,
                         {
                            /* diag */
                            loc_col = (HYPRE_Int)(big_k1 - col_1);
-                           if (P_marker[loc_col] >= jj_begin_row)
+                           if (P_marker[loc_col] >= jj_begin_row )
                            {
-                              P_diag_data[P_marker[loc_col]] += distribute * A_ext_data[jj1];
+                              sum += A_ext_data[jj1];
                            }
                         }
                         else
@@ -5389,40 +5582,70 @@ hypre_BoomerAMGBuildExtInterpHost(hypre_ParCSRMatrix  *A,
                            loc_col = -(HYPRE_Int)big_k1 - 1;
                            if (P_marker_offd[loc_col] >= jj_begin_row_offd)
                            {
-                              P_offd_data[P_marker_offd[loc_col]] += distribute * A_ext_data[jj1];
+                              sum += A_ext_data[jj1];
                            }
                         }
                      }
+                     if (sum != 0)
+                     {
+                        distribute = A_offd_data[jj] / sum;
+                        for (jj1 = A_ext_i[i1]; jj1 < A_ext_i[i1 + 1]; jj1++)
+                        {
+                           big_k1 = A_ext_j[jj1];
+                           if (big_k1 >= col_1 && big_k1 < col_n)
+                           {
+                              /* diag */
+                              loc_col = (HYPRE_Int)(big_k1 - col_1);
+                              if (P_marker[loc_col] >= jj_begin_row)
+                              {
+                                 P_diag_data[P_marker[loc_col]] += distribute * A_ext_data[jj1];
+                              }
+                           }
+                           else
+                           {
+                              loc_col = -(HYPRE_Int)big_k1 - 1;
+                              if (P_marker_offd[loc_col] >= jj_begin_row_offd)
+                              {
+                                 P_offd_data[P_marker_offd[loc_col]] += distribute * A_ext_data[jj1];
+                              }
+                           }
+                        }
+                     }
+                     else
+                     {
+                        diagonal += A_offd_data[jj];
+                     }
                   }
-                  else
-                  {
-                     diagonal += A_offd_data[jj];
-                  }
-               }
-               else if (CF_marker_offd[i1] != -3)
-               {
-                  if (num_functions == 1 || dof_func[i] == dof_func_offd[i1])
+                  else if (CF_marker_offd[i1] != -3)
                   {
-                     diagonal += A_offd_data[jj];
+                     if (num_functions == 1 || dof_func[i] == dof_func_offd[i1])
+                     {
+                        diagonal += A_offd_data[jj];
+                     }
                   }
                }
             }
-         }
-         if (diagonal)
-         {
-            for (jj = jj_begin_row; jj < jj_end_row; jj++)
-            {
-               P_diag_data[jj] /= -diagonal;
-            }
-            for (jj = jj_begin_row_offd; jj < jj_end_row_offd; jj++)
+            if (diagonal)
             {
-               P_offd_data[jj] /= -diagonal;
+               for (jj = jj_begin_row; jj < jj_end_row; jj++)
+               {
+                  P_diag_data[jj] /= -diagonal;
+               }
+               for (jj = jj_begin_row_offd; jj < jj_end_row_offd; jj++)
+               {
+                  P_offd_data[jj] /= -diagonal;
+               }
             }
          }
+         strong_f_marker--;
       }
-      strong_f_marker--;
+
+      hypre_TFree(P_marker, HYPRE_MEMORY_HOST);
+      hypre_TFree(P_marker_offd, HYPRE_MEMORY_HOST);
    }
 
+   hypre_TFree(workspace, HYPRE_MEMORY_HOST);
+
    if (debug_flag == 4)
    {
       wall_time = time_getWallclockSeconds() - wall_time;
@@ -5489,14 +5712,12 @@ hypre_BoomerAMGBuildExtInterpHost(hypre_ParCSRMatrix  *A,
 
    /* Deallocate memory */
    hypre_TFree(fine_to_coarse, HYPRE_MEMORY_HOST);
-   hypre_TFree(P_marker,       HYPRE_MEMORY_HOST);
 
    if (num_procs > 1)
    {
       hypre_CSRMatrixDestroy(Sop);
       hypre_CSRMatrixDestroy(A_ext);
       hypre_TFree(fine_to_coarse_offd, HYPRE_MEMORY_HOST);
-      hypre_TFree(P_marker_offd,       HYPRE_MEMORY_HOST);
       hypre_TFree(CF_marker_offd,      HYPRE_MEMORY_HOST);
       hypre_TFree(tmp_CF_marker_offd,  HYPRE_MEMORY_HOST);
       if (num_functions > 1)
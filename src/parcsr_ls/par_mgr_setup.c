@@ -1776,7 +1776,7 @@ hypre_MGRSetupFrelaxVcycleData( void *mgr_vdata,
 
       HYPRE_Int coarsen_cut_factor = 0;
       hypre_BoomerAMGCoarsenHMIS(S_local, A_array_local[lev_local], measure_type, coarsen_cut_factor,
-                                 debug_flag, &(CF_marker_array_local[lev_local]));
+                                 0, debug_flag, &(CF_marker_array_local[lev_local]));
 
 
       hypre_BoomerAMGCoarseParms(comm, local_size,
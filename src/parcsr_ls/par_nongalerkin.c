@@ -1234,6 +1234,139 @@ hypre_NonGalerkinSparsityPattern(hypre_ParCSRMatrix *R_IAP,
    return Pattern_CSR;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_NonGalerkinDropRow
+ *
+ * Row-wise sparsification used when the non-Galerkin operator is formed
+ * directly inside the RAP kernel.  On input, diag_j/diag_data and
+ * offd_j/offd_data point to the first entry of one completed row of RAP,
+ * with the diagonal stored first.  Off-diagonal entries are kept if they
+ * are larger than droptol times the largest off-diagonal magnitude of the
+ * row, or if keep_marker (indexed like the RAP kernel's P_marker, i.e.
+ * diag columns followed by num_cols_diag + offd columns) equals
+ * row_marker.  The row is compacted in place and the new sizes returned.
+ *
+ * Only the row itself is available, so instead of collapsing onto strong
+ * neighbors as in hypre_BoomerAMGBuildNonGalerkinCoarseOperator, dropped
+ * entries with sign opposite to the diagonal are distributed over the kept
+ * entries of that sign, proportionally to their size, and the remaining
+ * dropped entries are lumped to the diagonal.  Row sums are preserved.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_NonGalerkinDropRow( HYPRE_Real  droptol,
+                          HYPRE_Int   row_marker,
+                          HYPRE_Int  *keep_marker,
+                          HYPRE_Int   num_cols_diag,
+                          HYPRE_Int  *diag_j,
+                          HYPRE_Real *diag_data,
+                          HYPRE_Int  *diag_size_ptr,
+                          HYPRE_Int  *offd_j,
+                          HYPRE_Real *offd_data,
+                          HYPRE_Int  *offd_size_ptr )
+{
+   HYPRE_Int   diag_size  = *diag_size_ptr;
+   HYPRE_Int   offd_size  = *offd_size_ptr;
+   HYPRE_Real  max_entry  = 0.0;
+   HYPRE_Real  lump_value = 0.0;
+   HYPRE_Real  neg_lump   = 0.0;
+   HYPRE_Real  neg_kept   = 0.0;
+   HYPRE_Real  sign, value;
+   HYPRE_Int   j, cnt;
+
+   if (diag_size < 1)
+   {
+      return hypre_error_flag;
+   }
+   sign = (diag_data[0] < 0.0) ? -1.0 : 1.0;
+
+   /* Compute the drop tolerance for this row, abs(max off-diag)*droptol */
+   for (j = 1; j < diag_size; j++)
+   {
+      if (max_entry < hypre_abs(diag_data[j]))
+      {
+         max_entry = hypre_abs(diag_data[j]);
+      }
+   }
+   for (j = 0; j < offd_size; j++)
+   {
+      if (max_entry < hypre_abs(offd_data[j]))
+      {
+         max_entry = hypre_abs(offd_data[j]);
+      }
+   }
+   max_entry *= droptol;
+
+   /* Compact the diag portion, skipping the diagonal */
+   cnt = 1;
+   for (j = 1; j < diag_size; j++)
+   {
+      value = diag_data[j];
+      if (hypre_abs(value) > max_entry ||
+          (keep_marker && keep_marker[diag_j[j]] == row_marker))
+      {
+         diag_j[cnt]      = diag_j[j];
+         diag_data[cnt++] = value;
+         if (sign * value < 0.0) { neg_kept += value; }
+      }
+      else if (sign * value < 0.0)
+      {
+         neg_lump += value;
+      }
+      else
+      {
+         lump_value += value;
+      }
+   }
+   diag_size = cnt;
+
+   /* Compact the offd portion */
+   cnt = 0;
+   for (j = 0; j < offd_size; j++)
+   {
+      value = offd_data[j];
+      if (hypre_abs(value) > max_entry ||
+          (keep_marker && keep_marker[num_cols_diag + offd_j[j]] == row_marker))
+      {
+         offd_j[cnt]      = offd_j[j];
+         offd_data[cnt++] = value;
+         if (sign * value < 0.0) { neg_kept += value; }
+      }
+      else if (sign * value < 0.0)
+      {
+         neg_lump += value;
+      }
+      else
+      {
+         lump_value += value;
+      }
+   }
+   offd_size = cnt;
+
+   /* Distribute the dropped off-diagonal couplings */
+   if (neg_lump != 0.0 && neg_kept != 0.0)
+   {
+      value = 1.0 + neg_lump / neg_kept;
+      for (j = 1; j < diag_size; j++)
+      {
+         if (sign * diag_data[j] < 0.0) { diag_data[j] *= value; }
+      }
+      for (j = 0; j < offd_size; j++)
+      {
+         if (sign * offd_data[j] < 0.0) { offd_data[j] *= value; }
+      }
+   }
+   else
+   {
+      lump_value += neg_lump;
+   }
+   diag_data[0] += lump_value;
+
+   *diag_size_ptr = diag_size;
+   *offd_size_ptr = offd_size;
+
+   return hypre_error_flag;
+}
 
 HYPRE_Int
 hypre_BoomerAMGBuildNonGalerkinCoarseOperator( hypre_ParCSRMatrix **RAP_ptr,
@@ -28,6 +28,35 @@ hypre_BoomerAMGBuildCoarseOperatorKT( hypre_ParCSRMatrix  *RT,
                                       hypre_ParCSRMatrix  *P,
                                       HYPRE_Int keepTranspose,
                                       hypre_ParCSRMatrix **RAP_ptr )
+{
+   return hypre_BoomerAMGBuildCoarseOperatorDropKT(RT, A, P, keepTranspose,
+                                                   NULL, 0.0, RAP_ptr);
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGBuildCoarseOperatorDropKT
+ *
+ * Same triple product as hypre_BoomerAMGBuildCoarseOperatorKT.  If
+ * droptol > 0 (square case only), each row of RAP is sparsified as soon as
+ * it is complete with hypre_NonGalerkinDropRow: off-diagonal entries
+ * smaller than droptol times the largest off-diagonal entry of the row are
+ * lumped to the diagonal, except for entries in the pattern of the
+ * injected product (A P)_{C,:} when CF_marker is given.  Dropped entries
+ * are never stored: the second pass writes the sparsified rows to growing
+ * per-thread buffers, and the arrays of RAP are allocated with the
+ * sparsified size, so no array of the Galerkin size is ever allocated.
+ * This makes it a cheaper, row-wise alternative to
+ * hypre_BoomerAMGBuildNonGalerkinCoarseOperator.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGBuildCoarseOperatorDropKT( hypre_ParCSRMatrix  *RT,
+                                          hypre_ParCSRMatrix  *A,
+                                          hypre_ParCSRMatrix  *P,
+                                          HYPRE_Int            keepTranspose,
+                                          HYPRE_Int           *CF_marker,
+                                          HYPRE_Real           droptol,
+                                          hypre_ParCSRMatrix **RAP_ptr )
 
 {
 #ifdef HYPRE_PROFILE
@@ -99,12 +128,13 @@ hypre_BoomerAMGBuildCoarseOperatorKT( hypre_ParCSRMatrix  *RT,
    HYPRE_Real      *RAP_ext_data = NULL;
    HYPRE_Int             *RAP_ext_i = NULL;
    HYPRE_BigInt    *RAP_ext_j = NULL;
+   HYPRE_Int       *RAP_ext_offd_j = NULL;
 
    hypre_CSRMatrix *RAP_diag;
 
-   HYPRE_Real      *RAP_diag_data;
+   HYPRE_Real      *RAP_diag_data = NULL;
    HYPRE_Int             *RAP_diag_i;
-   HYPRE_Int             *RAP_diag_j;
+   HYPRE_Int             *RAP_diag_j = NULL;
 
    hypre_CSRMatrix *RAP_offd;
 
@@ -189,6 +219,16 @@ hypre_BoomerAMGBuildCoarseOperatorKT( hypre_ParCSRMatrix  *RT,
    HYPRE_Real       zero = 0.0;
    HYPRE_Int      *prefix_sum_workspace;
 
+   /* row-wise sparsification (non-Galerkin) */
+   HYPRE_Int        do_drop = 0;
+   HYPRE_Int       *coarse_to_fine = NULL;
+   HYPRE_Int       *K_marker;
+   HYPRE_Int       *jj_end_diag = NULL, *jj_end_offd = NULL;
+   HYPRE_Int        row_size_diag, row_size_offd;
+   HYPRE_Int        part_start_diag, part_start_offd;
+   HYPRE_Int      **part_diag_j = NULL, **part_offd_j = NULL;
+   HYPRE_Real     **part_diag_data = NULL, **part_offd_data = NULL;
+
    /*-----------------------------------------------------------------------
     *  Copy ParCSRMatrix RT into CSRMatrix R so that we have row-wise access
     *  to restriction .
@@ -242,6 +282,34 @@ hypre_BoomerAMGBuildCoarseOperatorKT( hypre_ParCSRMatrix  *RT,
       square = 0;
    }
 
+   /* Dropping lumps to the diagonal, so it is only done for square RAP.
+      coarse_to_fine maps coarse row ic to its fine grid C-point */
+   if (droptol > 0.0 && square)
+   {
+      do_drop = 1;
+      if (CF_marker)
+      {
+         coarse_to_fine = hypre_TAlloc(HYPRE_Int, num_cols_diag_P, HYPRE_MEMORY_HOST);
+         cnt = 0;
+         for (i = 0; i < hypre_CSRMatrixNumRows(A_diag); i++)
+         {
+            if (CF_marker[i] == 1)
+            {
+               if (cnt < num_cols_diag_P)
+               {
+                  coarse_to_fine[cnt] = i;
+               }
+               cnt++;
+            }
+         }
+         if (cnt != num_cols_diag_P)
+         {
+            hypre_TFree(coarse_to_fine, HYPRE_MEMORY_HOST);
+         }
+         cnt = 0;
+      }
+   }
+
    /*-----------------------------------------------------------------------
     *  Generate Ps_ext, i.e. portion of P that is stored on neighbor procs
     *  and needed locally for triple matrix product
@@ -417,124 +485,17 @@ hypre_BoomerAMGBuildCoarseOperatorKT( hypre_ParCSRMatrix  *RT,
       Ps_ext = NULL;
    }
 
-#ifdef HYPRE_CONCURRENT_HOPSCOTCH
-   if (P_ext_offd_size || num_cols_offd_P)
-   {
-      hypre_UnorderedBigIntSet found_set;
-      hypre_UnorderedBigIntSetCreate(&found_set, P_ext_offd_size + num_cols_offd_P,
-                                     16 * hypre_NumThreads());
-
-      #pragma omp parallel private(i)
-      {
-         #pragma omp for HYPRE_SMP_SCHEDULE
-         for (i = 0; i < P_ext_offd_size; i++)
-         {
-            //hypre_UnorderedBigIntSetPut(&found_set, Ps_ext_j[i]);
-            hypre_UnorderedBigIntSetPut(&found_set, P_big_offd_j[i]);
-         }
-
-         #pragma omp for HYPRE_SMP_SCHEDULE
-         for (i = 0; i < num_cols_offd_P; i++)
-         {
-            hypre_UnorderedBigIntSetPut(&found_set, col_map_offd_P[i]);
-         }
-      } /* omp parallel */
-
-      /* Warning on getting temp right !!!!! */
-
-      temp = hypre_UnorderedBigIntSetCopyToArray(&found_set, &num_cols_offd_Pext);
-      hypre_UnorderedBigIntSetDestroy(&found_set);
-
-      hypre_UnorderedBigIntMap col_map_offd_Pext_inverse;
-      hypre_big_sort_and_create_inverse_map(temp, num_cols_offd_Pext, &col_map_offd_Pext,
-                                            &col_map_offd_Pext_inverse);
-
-      #pragma omp parallel for HYPRE_SMP_SCHEDULE
-      for (i = 0 ; i < P_ext_offd_size; i++)
-         //Ps_ext_j[i] = hypre_UnorderedBigIntMapGet(&col_map_offd_Pext_inverse, Ps_ext_j[i]);
-      {
-         P_ext_offd_j[i] = hypre_UnorderedBigIntMapGet(&col_map_offd_Pext_inverse, P_big_offd_j[i]);
-      }
-      if (num_cols_offd_Pext) { hypre_UnorderedBigIntMapDestroy(&col_map_offd_Pext_inverse); }
-   }
-#else /* !HYPRE_CONCURRENT_HOPSCOTCH */
-   if (P_ext_offd_size || num_cols_offd_P)
-   {
-      temp = hypre_CTAlloc(HYPRE_BigInt,  P_ext_offd_size + num_cols_offd_P, HYPRE_MEMORY_HOST);
-      for (i = 0; i < P_ext_offd_size; i++)
-         //Ps_ext_j[i] = temp[i];
-         //temp[i] = Ps_ext_j[i];
-      {
-         temp[i] = P_big_offd_j[i];
-      }
-      cnt = P_ext_offd_size;
-      for (i = 0; i < num_cols_offd_P; i++)
-      {
-         temp[cnt++] = col_map_offd_P[i];
-      }
-   }
-   if (cnt)
-   {
-      hypre_BigQsort0(temp, 0, cnt - 1);
-
-      num_cols_offd_Pext = 1;
-      HYPRE_BigInt value = temp[0];
-      for (i = 1; i < cnt; i++)
-      {
-         if (temp[i] > value)
-         {
-            value = temp[i];
-            temp[num_cols_offd_Pext++] = value;
-         }
-      }
-   }
-
-   if (num_cols_offd_Pext)
-   {
-      col_map_offd_Pext = hypre_CTAlloc(HYPRE_BigInt, num_cols_offd_Pext, HYPRE_MEMORY_HOST);
-   }
-
-   for (i = 0; i < num_cols_offd_Pext; i++)
-   {
-      col_map_offd_Pext[i] = temp[i];
-   }
-
-   if (P_ext_offd_size || num_cols_offd_P)
+   if (num_cols_offd_P)
    {
-      hypre_TFree(temp, HYPRE_MEMORY_HOST);
+      map_P_to_Pext = hypre_CTAlloc(HYPRE_Int, num_cols_offd_P, HYPRE_MEMORY_HOST);
    }
-
-   /*if (P_ext_offd_size)
-     P_ext_offd_j = hypre_CTAlloc(HYPRE_Int,  P_ext_offd_size, HYPRE_MEMORY_HOST);*/
-   for (i = 0 ; i < P_ext_offd_size; i++)
-      P_ext_offd_j[i] = hypre_BigBinarySearch(col_map_offd_Pext,
-                                              //Ps_ext_j[i],
-                                              P_big_offd_j[i],
-                                              num_cols_offd_Pext);
-#endif /* !HYPRE_CONCURRENT_HOPSCOTCH */
+   hypre_GlobalToLocalColumns(P_ext_offd_size, P_big_offd_j, num_cols_offd_P, col_map_offd_P,
+                              P_ext_offd_j, map_P_to_Pext, &num_cols_offd_Pext, &col_map_offd_Pext);
 
    if (P_ext_offd_size)
    {
       hypre_TFree(P_big_offd_j, HYPRE_MEMORY_HOST);
    }
-   /*if (num_procs > 1)
-     {
-     hypre_CSRMatrixDestroy(Ps_ext);
-     Ps_ext = NULL;
-     }*/
-
-   if (num_cols_offd_P)
-   {
-      map_P_to_Pext = hypre_CTAlloc(HYPRE_Int, num_cols_offd_P, HYPRE_MEMORY_HOST);
-
-      cnt = 0;
-      for (i = 0; i < num_cols_offd_Pext; i++)
-         if (col_map_offd_Pext[i] == col_map_offd_P[cnt])
-         {
-            map_P_to_Pext[cnt++] = i;
-            if (cnt == num_cols_offd_P) { break; }
-         }
-   }
 #ifdef HYPRE_PROFILE
    hypre_profile_times[HYPRE_TIMER_ID_RENUMBER_COLIDX] += hypre_MPI_Wtime();
    hypre_profile_times[HYPRE_TIMER_ID_RENUMBER_COLIDX_RAP] += hypre_MPI_Wtime();
@@ -1068,43 +1029,10 @@ hypre_BoomerAMGBuildCoarseOperatorKT( hypre_ParCSRMatrix  *RT,
     *  check for new nonzero columns in RAP_offd generated through RAP_ext
     *-----------------------------------------------------------------------*/
 
-#ifdef HYPRE_CONCURRENT_HOPSCOTCH
-   hypre_UnorderedBigIntMap col_map_offd_RAP_inverse;
-   if (RAP_ext_size || num_cols_offd_Pext)
-   {
-      hypre_UnorderedBigIntSet found_set;
-      hypre_UnorderedBigIntSetCreate(&found_set, 2 * (RAP_ext_size + num_cols_offd_Pext),
-                                     16 * hypre_NumThreads());
-      cnt = 0;
-
-      #pragma omp parallel private(i)
-      {
-         #pragma omp for HYPRE_SMP_SCHEDULE
-         for (i = 0; i < RAP_ext_size; i++)
-         {
-            if (RAP_ext_j[i] < first_col_diag_RAP
-                || RAP_ext_j[i] > last_col_diag_RAP)
-            {
-               hypre_UnorderedBigIntSetPut(&found_set, RAP_ext_j[i]);
-            }
-         }
-
-         #pragma omp for HYPRE_SMP_SCHEDULE
-         for (i = 0; i < num_cols_offd_Pext; i++)
-         {
-            hypre_UnorderedBigIntSetPut(&found_set, col_map_offd_Pext[i]);
-         }
-      } /* omp parallel */
-
-      temp = hypre_UnorderedBigIntSetCopyToArray(&found_set, &num_cols_offd_RAP);
-      hypre_UnorderedBigIntSetDestroy(&found_set);
-      hypre_big_sort_and_create_inverse_map(temp, num_cols_offd_RAP, &col_map_offd_RAP,
-                                            &col_map_offd_RAP_inverse);
-   }
-#else /* !HYPRE_CONCURRENT_HOPSCOTCH */
    if (RAP_ext_size || num_cols_offd_Pext)
    {
-      temp = hypre_CTAlloc(HYPRE_BigInt, RAP_ext_size + num_cols_offd_Pext, HYPRE_MEMORY_HOST);
+      temp = hypre_CTAlloc(HYPRE_BigInt, RAP_ext_size, HYPRE_MEMORY_HOST);
+      RAP_ext_offd_j = hypre_CTAlloc(HYPRE_Int, RAP_ext_size, HYPRE_MEMORY_HOST);
       cnt = 0;
       for (i = 0; i < RAP_ext_size; i++)
          if (RAP_ext_j[i] < first_col_diag_RAP
@@ -1112,41 +1040,33 @@ hypre_BoomerAMGBuildCoarseOperatorKT( hypre_ParCSRMatrix  *RT,
          {
             temp[cnt++] = RAP_ext_j[i];
          }
-      for (i = 0; i < num_cols_offd_Pext; i++)
+
+      if (num_cols_offd_Pext)
       {
-         temp[cnt++] = col_map_offd_Pext[i];
+         map_Pext_to_RAP = hypre_TAlloc(HYPRE_Int, num_cols_offd_Pext, HYPRE_MEMORY_HOST);
       }
+      hypre_GlobalToLocalColumns(cnt, temp, num_cols_offd_Pext, col_map_offd_Pext,
+                                 RAP_ext_offd_j, map_Pext_to_RAP,
+                                 &num_cols_offd_RAP, &col_map_offd_RAP);
+      hypre_TFree(temp, HYPRE_MEMORY_HOST);
 
+      /*-----------------------------------------------------------------------
+       *  Convert RAP_ext column indices
+       *-----------------------------------------------------------------------*/
 
-      if (cnt)
-      {
-         hypre_BigQsort0(temp, 0, cnt - 1);
-         HYPRE_BigInt value = temp[0];
-         num_cols_offd_RAP = 1;
-         for (i = 1; i < cnt; i++)
+      cnt = 0;
+      for (i = 0; i < RAP_ext_size; i++)
+         if (RAP_ext_j[i] < first_col_diag_RAP
+             || RAP_ext_j[i] > last_col_diag_RAP)
          {
-            if (temp[i] > value)
-            {
-               value = temp[i];
-               temp[num_cols_offd_RAP++] = value;
-            }
+            RAP_ext_j[i] = (HYPRE_BigInt)num_cols_diag_P + (HYPRE_BigInt)RAP_ext_offd_j[cnt++];
          }
-      }
-
-      /* now evaluate col_map_offd_RAP */
-      if (num_cols_offd_RAP)
-      {
-         col_map_offd_RAP = hypre_CTAlloc(HYPRE_BigInt,  num_cols_offd_RAP, HYPRE_MEMORY_HOST);
-      }
-
-      for (i = 0 ; i < num_cols_offd_RAP; i++)
-      {
-         col_map_offd_RAP[i] = temp[i];
-      }
-
-      hypre_TFree(temp, HYPRE_MEMORY_HOST);
+         else
+         {
+            RAP_ext_j[i] -= first_col_diag_RAP;
+         }
+      hypre_TFree(RAP_ext_offd_j, HYPRE_MEMORY_HOST);
    }
-#endif /* !HYPRE_CONCURRENT_HOPSCOTCH */
 
    if (num_cols_offd_P)
    {
@@ -1161,47 +1081,6 @@ hypre_BoomerAMGBuildCoarseOperatorKT( hypre_ParCSRMatrix  *RT,
          }
    }
 
-   if (num_cols_offd_Pext)
-   {
-      map_Pext_to_RAP = hypre_TAlloc(HYPRE_Int, num_cols_offd_Pext, HYPRE_MEMORY_HOST);
-
-      cnt = 0;
-      for (i = 0; i < num_cols_offd_RAP; i++)
-         if (col_map_offd_RAP[i] == col_map_offd_Pext[cnt])
-         {
-            map_Pext_to_RAP[cnt++] = i;
-            if (cnt == num_cols_offd_Pext) { break; }
-         }
-   }
-
-   /*-----------------------------------------------------------------------
-    *  Convert RAP_ext column indices
-    *-----------------------------------------------------------------------*/
-
-#ifdef HYPRE_USING_OPENMP
-   #pragma omp parallel for HYPRE_SMP_SCHEDULE
-#endif
-   for (i = 0; i < RAP_ext_size; i++)
-      if (RAP_ext_j[i] < first_col_diag_RAP
-          || RAP_ext_j[i] > last_col_diag_RAP)
-         RAP_ext_j[i] = (HYPRE_BigInt)num_cols_diag_P
-#ifdef HYPRE_CONCURRENT_HOPSCOTCH
-                        + (HYPRE_BigInt)hypre_UnorderedBigIntMapGet(&col_map_offd_RAP_inverse, RAP_ext_j[i]);
-#else
-                        +(HYPRE_BigInt)hypre_BigBinarySearch(col_map_offd_RAP, RAP_ext_j[i], num_cols_offd_RAP);
-#endif
-      else
-      {
-         RAP_ext_j[i] -= first_col_diag_RAP;
-      }
-
-#ifdef HYPRE_CONCURRENT_HOPSCOTCH
-   if (num_cols_offd_RAP)
-   {
-      hypre_UnorderedBigIntMapDestroy(&col_map_offd_RAP_inverse);
-   }
-#endif
-
 #ifdef HYPRE_PROFILE
    hypre_profile_times[HYPRE_TIMER_ID_RENUMBER_COLIDX] += hypre_MPI_Wtime();
    hypre_profile_times[HYPRE_TIMER_ID_RENUMBER_COLIDX_RAP] += hypre_MPI_Wtime();
@@ -1478,6 +1357,14 @@ hypre_BoomerAMGBuildCoarseOperatorKT( hypre_ParCSRMatrix  *RT,
             RAP_diag_i[ic] = jj_row_begin_diag;
             RAP_offd_i[ic] = jj_row_begin_offd;
             */
+
+         /* Non-Galerkin: keep the unsparsified row lengths, which bound the
+            buffer space the second pass needs for this row */
+         if (do_drop)
+         {
+            RAP_diag_i[ic] = jj_count_diag - jj_row_begin_diag;
+            RAP_offd_i[ic] = jj_count_offd - jj_row_begin_offd;
+         }
       }
       jj_cnt_diag[ii] = jj_count_diag;
       jj_cnt_offd[ii] = jj_count_offd;
@@ -1501,14 +1388,14 @@ hypre_BoomerAMGBuildCoarseOperatorKT( hypre_ParCSRMatrix  *RT,
     *-----------------------------------------------------------------------*/
 
    RAP_diag_size = jj_count_diag;
-   if (RAP_diag_size)
+   if (RAP_diag_size && !do_drop)
    {
       RAP_diag_data = hypre_CTAlloc(HYPRE_Real, RAP_diag_size, memory_location_RAP);
       RAP_diag_j    = hypre_CTAlloc(HYPRE_Int,  RAP_diag_size, memory_location_RAP);
    }
 
    RAP_offd_size = jj_count_offd;
-   if (RAP_offd_size)
+   if (RAP_offd_size && !do_drop)
    {
       RAP_offd_data = hypre_CTAlloc(HYPRE_Real, RAP_offd_size, memory_location_RAP);
       RAP_offd_j    = hypre_CTAlloc(HYPRE_Int,  RAP_offd_size, memory_location_RAP);
@@ -1528,13 +1415,27 @@ hypre_BoomerAMGBuildCoarseOperatorKT( hypre_ParCSRMatrix  *RT,
       RA_offd_j_array = hypre_TAlloc(HYPRE_Int,  num_cols_offd_A * num_threads, HYPRE_MEMORY_HOST);
    }
 
+   /* Non-Galerkin: the rows are sparsified while they are computed, so the
+      Galerkin sized arrays are never allocated.  Each thread appends its
+      sparsified rows to buffers of its own instead, which are joined into
+      arrays of the final size after the second pass. */
+   if (do_drop)
+   {
+      jj_end_diag    = hypre_CTAlloc(HYPRE_Int,   num_threads, HYPRE_MEMORY_HOST);
+      jj_end_offd    = hypre_CTAlloc(HYPRE_Int,   num_threads, HYPRE_MEMORY_HOST);
+      part_diag_j    = hypre_CTAlloc(HYPRE_Int *,  num_threads, HYPRE_MEMORY_HOST);
+      part_diag_data = hypre_CTAlloc(HYPRE_Real *, num_threads, HYPRE_MEMORY_HOST);
+      part_offd_j    = hypre_CTAlloc(HYPRE_Int *,  num_threads, HYPRE_MEMORY_HOST);
+      part_offd_data = hypre_CTAlloc(HYPRE_Real *, num_threads, HYPRE_MEMORY_HOST);
+   }
+
    /*-----------------------------------------------------------------------
     *  Second Pass: Fill in RAP_diag_data and RAP_diag_j.
     *  Second Pass: Fill in RAP_offd_data and RAP_offd_j.
     *-----------------------------------------------------------------------*/
 
 #ifdef HYPRE_USING_OPENMP
-   #pragma omp parallel for private(i,j,k,jcol,ii,ic,i1,i2,i3,jj1,jj2,jj3,ns,ne,size,rest,jj_count_diag,jj_count_offd,jj_row_begin_diag,jj_row_begin_offd,A_marker,P_marker,r_entry,r_a_product,r_a_p_product) HYPRE_SMP_SCHEDULE
+   #pragma omp parallel for private(i,j,k,jcol,ii,ic,i1,i2,i3,jj1,jj2,jj3,ns,ne,size,rest,jj_count_diag,jj_count_offd,jj_row_begin_diag,jj_row_begin_offd,A_marker,P_marker,K_marker,row_size_diag,row_size_offd,r_entry,r_a_product,r_a_p_product) HYPRE_SMP_SCHEDULE
 #endif
    for (ii = 0; ii < num_threads; ii++)
    {
@@ -1568,12 +1469,38 @@ hypre_BoomerAMGBuildCoarseOperatorKT( hypre_ParCSRMatrix  *RT,
 
       jj_count_diag = start_indexing;
       jj_count_offd = start_indexing;
-      if (ii > 0)
+
+      HYPRE_Int  *rap_diag_j    = RAP_diag_j;
+      HYPRE_Real *rap_diag_data = RAP_diag_data;
+      HYPRE_Int  *rap_offd_j    = RAP_offd_j;
+      HYPRE_Real *rap_offd_data = RAP_offd_data;
+      HYPRE_Int   rap_diag_cap  = 0;
+      HYPRE_Int   rap_offd_cap  = 0;
+
+      if (do_drop)
+      {
+         /* rows go to the buffers of this thread, counted from 0 */
+         rap_diag_j    = NULL;
+         rap_diag_data = NULL;
+         rap_offd_j    = NULL;
+         rap_offd_data = NULL;
+      }
+      else if (ii > 0)
       {
          jj_count_diag = jj_cnt_diag[ii - 1];
          jj_count_offd = jj_cnt_offd[ii - 1];
       }
 
+      K_marker = NULL;
+      if (coarse_to_fine)
+      {
+         K_marker = hypre_TAlloc(HYPRE_Int, num_cols_diag_P + num_cols_offd_RAP, HYPRE_MEMORY_HOST);
+         for (ic = 0; ic < num_cols_diag_P + num_cols_offd_RAP; ic++)
+         {
+            K_marker[ic] = -1;
+         }
+      }
+
       // temporal matrix RA = R*A
       // only need to store one row per thread because R*A and (R*A)*P are fused
       // into one loop.
@@ -1602,6 +1529,33 @@ hypre_BoomerAMGBuildCoarseOperatorKT( hypre_ParCSRMatrix  *RT,
 
          jj_row_begin_diag = jj_count_diag;
          jj_row_begin_offd = jj_count_offd;
+
+         /* make room for the unsparsified row, whose lengths the first pass
+            left in RAP_diag_i and RAP_offd_i */
+         if (do_drop)
+         {
+            if (jj_count_diag + RAP_diag_i[ic] > rap_diag_cap)
+            {
+               HYPRE_Int cap = hypre_max(2 * rap_diag_cap, jj_count_diag + RAP_diag_i[ic]);
+
+               rap_diag_j    = hypre_TReAlloc_v2(rap_diag_j, HYPRE_Int, rap_diag_cap,
+                                                 HYPRE_Int, cap, memory_location_RAP);
+               rap_diag_data = hypre_TReAlloc_v2(rap_diag_data, HYPRE_Real, rap_diag_cap,
+                                                 HYPRE_Real, cap, memory_location_RAP);
+               rap_diag_cap  = cap;
+            }
+            if (jj_count_offd + RAP_offd_i[ic] > rap_offd_cap)
+            {
+               HYPRE_Int cap = hypre_max(2 * rap_offd_cap, jj_count_offd + RAP_offd_i[ic]);
+
+               rap_offd_j    = hypre_TReAlloc_v2(rap_offd_j, HYPRE_Int, rap_offd_cap,
+                                                 HYPRE_Int, cap, memory_location_RAP);
+               rap_offd_data = hypre_TReAlloc_v2(rap_offd_data, HYPRE_Real, rap_offd_cap,
+                                                 HYPRE_Real, cap, memory_location_RAP);
+               rap_offd_cap  = cap;
+            }
+         }
+
          RAP_diag_i[ic] = jj_row_begin_diag;
          RAP_offd_i[ic] = jj_row_begin_offd;
 
@@ -1611,8 +1565,8 @@ hypre_BoomerAMGBuildCoarseOperatorKT( hypre_ParCSRMatrix  *RT,
          if (square)
          {
             P_marker[ic] = jj_count_diag;
-            RAP_diag_data[jj_count_diag] = zero;
-            RAP_diag_j[jj_count_diag] = ic;
+            rap_diag_data[jj_count_diag] = zero;
+            rap_diag_j[jj_count_diag] = ic;
             jj_count_diag++;
          }
 
@@ -1634,13 +1588,13 @@ hypre_BoomerAMGBuildCoarseOperatorKT( hypre_ParCSRMatrix  *RT,
                         if (P_marker[jcol] < jj_row_begin_diag)
                         {
                            P_marker[jcol] = jj_count_diag;
-                           RAP_diag_data[jj_count_diag]
+                           rap_diag_data[jj_count_diag]
                               = RAP_ext_data[k];
-                           RAP_diag_j[jj_count_diag] = jcol;
+                           rap_diag_j[jj_count_diag] = jcol;
                            jj_count_diag++;
                         }
                         else
-                           RAP_diag_data[P_marker[jcol]]
+                           rap_diag_data[P_marker[jcol]]
                            += RAP_ext_data[k];
                      }
                      else
@@ -1648,14 +1602,14 @@ hypre_BoomerAMGBuildCoarseOperatorKT( hypre_ParCSRMatrix  *RT,
                         if (P_marker[jcol] < jj_row_begin_offd)
                         {
                            P_marker[jcol] = jj_count_offd;
-                           RAP_offd_data[jj_count_offd]
+                           rap_offd_data[jj_count_offd]
                               = RAP_ext_data[k];
-                           RAP_offd_j[jj_count_offd]
+                           rap_offd_j[jj_count_offd]
                               = jcol - num_cols_diag_P;
                            jj_count_offd++;
                         }
                         else
-                           RAP_offd_data[P_marker[jcol]]
+                           rap_offd_data[P_marker[jcol]]
                            += RAP_ext_data[k];
                      }
                   }
@@ -1675,13 +1629,13 @@ hypre_BoomerAMGBuildCoarseOperatorKT( hypre_ParCSRMatrix  *RT,
                         if (P_marker[jcol] < jj_row_begin_diag)
                         {
                            P_marker[jcol] = jj_count_diag;
-                           RAP_diag_data[jj_count_diag]
+                           rap_diag_data[jj_count_diag]
                               = RAP_ext_data[k];
-                           RAP_diag_j[jj_count_diag] = jcol;
+                           rap_diag_j[jj_count_diag] = jcol;
                            jj_count_diag++;
                         }
                         else
-                           RAP_diag_data[P_marker[jcol]]
+                           rap_diag_data[P_marker[jcol]]
                            += RAP_ext_data[k];
                      }
                      else
@@ -1689,14 +1643,14 @@ hypre_BoomerAMGBuildCoarseOperatorKT( hypre_ParCSRMatrix  *RT,
                         if (P_marker[jcol] < jj_row_begin_offd)
                         {
                            P_marker[jcol] = jj_count_offd;
-                           RAP_offd_data[jj_count_offd]
+                           rap_offd_data[jj_count_offd]
                               = RAP_ext_data[k];
-                           RAP_offd_j[jj_count_offd]
+                           rap_offd_j[jj_count_offd]
                               = jcol - num_cols_diag_P;
                            jj_count_offd++;
                         }
                         else
-                           RAP_offd_data[P_marker[jcol]]
+                           rap_offd_data[P_marker[jcol]]
                            += RAP_ext_data[k];
                      }
                   }
@@ -1817,13 +1771,13 @@ hypre_BoomerAMGBuildCoarseOperatorKT( hypre_ParCSRMatrix  *RT,
                if (marker < jj_row_begin_diag)
                {
                   P_marker[i2] = jj_count_diag;
-                  RAP_diag_data[jj_count_diag] = r_a_product * p_entry;
-                  RAP_diag_j[jj_count_diag] = i2;
+                  rap_diag_data[jj_count_diag] = r_a_product * p_entry;
+                  rap_diag_j[jj_count_diag] = i2;
                   jj_count_diag++;
                }
                else
                {
-                  RAP_diag_data[marker] += r_a_product * p_entry;
+                  rap_diag_data[marker] += r_a_product * p_entry;
                }
             }
             for (jj2 = P_ext_offd_i[i1]; jj2 < P_ext_offd_i[i1 + 1]; jj2++)
@@ -1840,13 +1794,13 @@ hypre_BoomerAMGBuildCoarseOperatorKT( hypre_ParCSRMatrix  *RT,
                if (marker < jj_row_begin_offd)
                {
                   P_marker[i2] = jj_count_offd;
-                  RAP_offd_data[jj_count_offd] = r_a_product * p_entry;
-                  RAP_offd_j[jj_count_offd] = i2 - num_cols_diag_P;
+                  rap_offd_data[jj_count_offd] = r_a_product * p_entry;
+                  rap_offd_j[jj_count_offd] = i2 - num_cols_diag_P;
                   jj_count_offd++;
                }
                else
                {
-                  RAP_offd_data[marker] += r_a_product * p_entry;
+                  rap_offd_data[marker] += r_a_product * p_entry;
                }
             }
          } // loop over entries in row ic of RA_offd
@@ -1878,13 +1832,13 @@ hypre_BoomerAMGBuildCoarseOperatorKT( hypre_ParCSRMatrix  *RT,
                if (marker < jj_row_begin_diag)
                {
                   P_marker[i2] = jj_count_diag;
-                  RAP_diag_data[jj_count_diag] = r_a_product * p_entry;
-                  RAP_diag_j[jj_count_diag] = i2;
+                  rap_diag_data[jj_count_diag] = r_a_product * p_entry;
+                  rap_diag_j[jj_count_diag] = i2;
                   jj_count_diag++;
                }
                else
                {
-                  RAP_diag_data[marker] += r_a_product * p_entry;
+                  rap_diag_data[marker] += r_a_product * p_entry;
                }
             }
             if (num_cols_offd_P)
@@ -1904,22 +1858,168 @@ hypre_BoomerAMGBuildCoarseOperatorKT( hypre_ParCSRMatrix  *RT,
                   if (marker < jj_row_begin_offd)
                   {
                      P_marker[i2] = jj_count_offd;
-                     RAP_offd_data[jj_count_offd] = r_a_product * p_entry;
-                     RAP_offd_j[jj_count_offd] = i2 - num_cols_diag_P;
+                     rap_offd_data[jj_count_offd] = r_a_product * p_entry;
+                     rap_offd_j[jj_count_offd] = i2 - num_cols_diag_P;
                      jj_count_offd++;
                   }
                   else
                   {
-                     RAP_offd_data[marker] += r_a_product * p_entry;
+                     rap_offd_data[marker] += r_a_product * p_entry;
                   }
                }
             } // num_cols_offd_P
          } // loop over entries in row ic of RA_diag.
+
+         /*--------------------------------------------------------------------
+          * Non-Galerkin: sparsify the completed row ic in place.  Markers of
+          * the row are reset first, because compaction moves the beginning
+          * of the next row below positions already stored in P_marker.
+          *--------------------------------------------------------------------*/
+
+         if (do_drop)
+         {
+            if (K_marker)
+            {
+               /* mark the pattern of row coarse_to_fine[ic] of A*P */
+               i = coarse_to_fine[ic];
+               for (jj1 = A_diag_i[i]; jj1 < A_diag_i[i + 1]; jj1++)
+               {
+                  i1 = A_diag_j[jj1];
+                  for (jj2 = P_diag_i[i1]; jj2 < P_diag_i[i1 + 1]; jj2++)
+                  {
+                     K_marker[P_diag_j[jj2]] = ic;
+                  }
+                  if (num_cols_offd_P)
+                  {
+                     for (jj2 = P_offd_i[i1]; jj2 < P_offd_i[i1 + 1]; jj2++)
+                     {
+                        K_marker[map_P_to_RAP[P_offd_j[jj2]] + num_cols_diag_P] = ic;
+                     }
+                  }
+               }
+               if (num_cols_offd_A)
+               {
+                  for (jj1 = A_offd_i[i]; jj1 < A_offd_i[i + 1]; jj1++)
+                  {
+                     i1 = A_offd_j[jj1];
+                     for (jj2 = P_ext_diag_i[i1]; jj2 < P_ext_diag_i[i1 + 1]; jj2++)
+                     {
+                        K_marker[P_ext_diag_j[jj2]] = ic;
+                     }
+                     for (jj2 = P_ext_offd_i[i1]; jj2 < P_ext_offd_i[i1 + 1]; jj2++)
+                     {
+                        K_marker[map_Pext_to_RAP[P_ext_offd_j[jj2]] + num_cols_diag_P] = ic;
+                     }
+                  }
+               }
+            }
+
+            for (jj3 = jj_row_begin_diag; jj3 < jj_count_diag; jj3++)
+            {
+               P_marker[rap_diag_j[jj3]] = -1;
+            }
+            for (jj3 = jj_row_begin_offd; jj3 < jj_count_offd; jj3++)
+            {
+               P_marker[rap_offd_j[jj3] + num_cols_diag_P] = -1;
+            }
+
+            row_size_diag = jj_count_diag - jj_row_begin_diag;
+            row_size_offd = jj_count_offd - jj_row_begin_offd;
+            hypre_NonGalerkinDropRow(droptol, ic, K_marker, num_cols_diag_P,
+                                     rap_diag_j + jj_row_begin_diag,
+                                     rap_diag_data + jj_row_begin_diag, &row_size_diag,
+                                     rap_offd_j + jj_row_begin_offd,
+                                     rap_offd_data + jj_row_begin_offd, &row_size_offd);
+            jj_count_diag = jj_row_begin_diag + row_size_diag;
+            jj_count_offd = jj_row_begin_offd + row_size_offd;
+         }
       } // Loop over interior c-points.
+      if (do_drop)
+      {
+         jj_end_diag[ii]    = jj_count_diag;
+         jj_end_offd[ii]    = jj_count_offd;
+         part_diag_j[ii]    = rap_diag_j;
+         part_diag_data[ii] = rap_diag_data;
+         part_offd_j[ii]    = rap_offd_j;
+         part_offd_data[ii] = rap_offd_data;
+      }
+      hypre_TFree(K_marker, HYPRE_MEMORY_HOST);
       hypre_TFree(P_mark_array[ii], HYPRE_MEMORY_HOST);
       hypre_TFree(A_mark_array[ii], HYPRE_MEMORY_HOST);
    } // omp parallel for
 
+   /* Non-Galerkin: join the buffers of the threads into arrays of the
+      sparsified size, releasing each buffer as soon as it is copied */
+   if (do_drop)
+   {
+      RAP_diag_size = 0;
+      RAP_offd_size = 0;
+      for (ii = 0; ii < num_threads; ii++)
+      {
+         RAP_diag_size += jj_end_diag[ii];
+         RAP_offd_size += jj_end_offd[ii];
+      }
+      if (RAP_diag_size)
+      {
+         RAP_diag_data = hypre_CTAlloc(HYPRE_Real, RAP_diag_size, memory_location_RAP);
+         RAP_diag_j    = hypre_CTAlloc(HYPRE_Int,  RAP_diag_size, memory_location_RAP);
+      }
+      if (RAP_offd_size)
+      {
+         RAP_offd_data = hypre_CTAlloc(HYPRE_Real, RAP_offd_size, memory_location_RAP);
+         RAP_offd_j    = hypre_CTAlloc(HYPRE_Int,  RAP_offd_size, memory_location_RAP);
+      }
+
+      part_start_diag = 0;
+      part_start_offd = 0;
+      for (ii = 0; ii < num_threads; ii++)
+      {
+         size = num_cols_diag_RT / num_threads;
+         rest = num_cols_diag_RT - size * num_threads;
+         if (ii < rest)
+         {
+            ns = ii * size + ii;
+            ne = (ii + 1) * size + ii + 1;
+         }
+         else
+         {
+            ns = ii * size + rest;
+            ne = (ii + 1) * size + rest;
+         }
+
+         for (ic = ns; ic < ne; ic++)
+         {
+            RAP_diag_i[ic] += part_start_diag;
+            RAP_offd_i[ic] += part_start_offd;
+         }
+         hypre_TMemcpy(RAP_diag_j + part_start_diag, part_diag_j[ii], HYPRE_Int,
+                       jj_end_diag[ii], memory_location_RAP, memory_location_RAP);
+         hypre_TMemcpy(RAP_diag_data + part_start_diag, part_diag_data[ii], HYPRE_Real,
+                       jj_end_diag[ii], memory_location_RAP, memory_location_RAP);
+         hypre_TMemcpy(RAP_offd_j + part_start_offd, part_offd_j[ii], HYPRE_Int,
+                       jj_end_offd[ii], memory_location_RAP, memory_location_RAP);
+         hypre_TMemcpy(RAP_offd_data + part_start_offd, part_offd_data[ii], HYPRE_Real,
+                       jj_end_offd[ii], memory_location_RAP, memory_location_RAP);
+         hypre_TFree(part_diag_j[ii], memory_location_RAP);
+         hypre_TFree(part_diag_data[ii], memory_location_RAP);
+         hypre_TFree(part_offd_j[ii], memory_location_RAP);
+         hypre_TFree(part_offd_data[ii], memory_location_RAP);
+
+         part_start_diag += jj_end_diag[ii];
+         part_start_offd += jj_end_offd[ii];
+      }
+      RAP_diag_i[num_cols_diag_RT] = RAP_diag_size;
+      RAP_offd_i[num_cols_diag_RT] = RAP_offd_size;
+
+      hypre_TFree(part_diag_j, HYPRE_MEMORY_HOST);
+      hypre_TFree(part_diag_data, HYPRE_MEMORY_HOST);
+      hypre_TFree(part_offd_j, HYPRE_MEMORY_HOST);
+      hypre_TFree(part_offd_data, HYPRE_MEMORY_HOST);
+      hypre_TFree(jj_end_diag, HYPRE_MEMORY_HOST);
+      hypre_TFree(jj_end_offd, HYPRE_MEMORY_HOST);
+      hypre_TFree(coarse_to_fine, HYPRE_MEMORY_HOST);
+   }
+
    /* check if really all off-diagonal entries occurring in col_map_offd_RAP
       are represented and eliminate if necessary */
 
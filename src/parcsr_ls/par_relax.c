@@ -200,6 +200,8 @@ hypre_BoomerAMGRelaxWeightedJacobi_core( hypre_ParCSRMatrix *A,
    HYPRE_Int           *A_offd_i      = hypre_CSRMatrixI(A_offd);
    HYPRE_Real          *A_offd_data   = hypre_CSRMatrixData(A_offd);
    HYPRE_Int           *A_offd_j      = hypre_CSRMatrixJ(A_offd);
+   hypre_CSRMatrix     *A_merged      = hypre_ParCSRMatrixMerged(A);
+   HYPRE_Int           *A_split       = hypre_ParCSRMatrixMergedSplit(A);
    hypre_ParCSRCommPkg *comm_pkg      = hypre_ParCSRMatrixCommPkg(A);
    HYPRE_Int            num_rows      = hypre_CSRMatrixNumRows(A_diag);
    HYPRE_Int            num_cols_offd = hypre_CSRMatrixNumCols(A_offd);
@@ -217,7 +219,8 @@ hypre_BoomerAMGRelaxWeightedJacobi_core( hypre_ParCSRMatrix *A,
    HYPRE_Complex        res;
 
    HYPRE_Int num_procs, my_id, i, j, ii, jj, index, num_sends, start;
-   hypre_ParCSRCommHandle *comm_handle;
+   hypre_ParCSRCommHandle *comm_handle = NULL;
+   hypre_ParCSRPersistentCommHandle *persistent_comm_handle = NULL;
 
    hypre_MPI_Comm_size(comm, &num_procs);
    hypre_MPI_Comm_rank(comm, &my_id);
@@ -225,9 +228,18 @@ hypre_BoomerAMGRelaxWeightedJacobi_core( hypre_ParCSRMatrix *A,
    if (num_procs > 1)
    {
       num_sends = hypre_ParCSRCommPkgNumSends(comm_pkg);
-      v_buf_data = hypre_CTAlloc(HYPRE_Real, hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends),
-                                 HYPRE_MEMORY_HOST);
-      v_ext_data = hypre_CTAlloc(HYPRE_Real, num_cols_offd, HYPRE_MEMORY_HOST);
+      persistent_comm_handle = hypre_ParCSRCommPkgFindPersistentCommHandle(1, comm_pkg);
+      if (persistent_comm_handle)
+      {
+         v_buf_data = (HYPRE_Real *) hypre_ParCSRCommHandleSendDataBuffer(persistent_comm_handle);
+         v_ext_data = (HYPRE_Real *) hypre_ParCSRCommHandleRecvDataBuffer(persistent_comm_handle);
+      }
+      else
+      {
+         v_buf_data = hypre_CTAlloc(HYPRE_Real, hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends),
+                                    HYPRE_MEMORY_HOST);
+         v_ext_data = hypre_CTAlloc(HYPRE_Real, num_cols_offd, HYPRE_MEMORY_HOST);
+      }
 
       index = 0;
       for (i = 0; i < num_sends; i++)
@@ -239,7 +251,14 @@ hypre_BoomerAMGRelaxWeightedJacobi_core( hypre_ParCSRMatrix *A,
          }
       }
 
-      comm_handle = hypre_ParCSRCommHandleCreate(1, comm_pkg, v_buf_data, v_ext_data);
+      if (persistent_comm_handle)
+      {
+         hypre_ParCSRPersistentCommHandleStart(persistent_comm_handle, HYPRE_MEMORY_HOST, v_buf_data);
+      }
+      else
+      {
+         comm_handle = hypre_ParCSRCommHandleCreate(1, comm_pkg, v_buf_data, v_ext_data);
+      }
    }
 
    /*-----------------------------------------------------------------
@@ -255,13 +274,27 @@ hypre_BoomerAMGRelaxWeightedJacobi_core( hypre_ParCSRMatrix *A,
 
    if (num_procs > 1)
    {
-      hypre_ParCSRCommHandleDestroy(comm_handle);
-      comm_handle = NULL;
+      if (persistent_comm_handle)
+      {
+         hypre_ParCSRPersistentCommHandleWait(persistent_comm_handle, HYPRE_MEMORY_HOST, v_ext_data);
+      }
+      else
+      {
+         hypre_ParCSRCommHandleDestroy(comm_handle);
+         comm_handle = NULL;
+      }
    }
 
    /*-----------------------------------------------------------------
-    * Relax all points.
+    * Relax all points, in one pass over the merged layout if available.
     *-----------------------------------------------------------------*/
+   if (A_merged)
+   {
+      A_diag_i    = hypre_CSRMatrixI(A_merged);
+      A_diag_j    = hypre_CSRMatrixJ(A_merged);
+      A_diag_data = hypre_CSRMatrixData(A_merged);
+   }
+
 #ifdef HYPRE_USING_OPENMP
    #pragma omp parallel for private(i,ii,jj,res) HYPRE_SMP_SCHEDULE
 #endif
@@ -277,15 +310,31 @@ hypre_BoomerAMGRelaxWeightedJacobi_core( hypre_ParCSRMatrix *A,
       if ( (relax_points == 0 || cf_marker[i] == relax_points) && di != zero )
       {
          res = f_data[i];
-         for (jj = A_diag_i[i] + Skip_diag; jj < A_diag_i[i + 1]; jj++)
+         if (A_merged)
          {
-            ii = A_diag_j[jj];
-            res -= A_diag_data[jj] * Vtemp_data[ii];
+            for (jj = A_diag_i[i] + Skip_diag; jj < A_split[i]; jj++)
+            {
+               ii = A_diag_j[jj];
+               res -= A_diag_data[jj] * Vtemp_data[ii];
+            }
+            for (jj = A_split[i]; jj < A_diag_i[i + 1]; jj++)
+            {
+               ii = A_diag_j[jj];
+               res -= A_diag_data[jj] * v_ext_data[ii];
+            }
          }
-         for (jj = A_offd_i[i]; jj < A_offd_i[i + 1]; jj++)
+         else
          {
-            ii = A_offd_j[jj];
-            res -= A_offd_data[jj] * v_ext_data[ii];
+            for (jj = A_diag_i[i] + Skip_diag; jj < A_diag_i[i + 1]; jj++)
+            {
+               ii = A_diag_j[jj];
+               res -= A_diag_data[jj] * Vtemp_data[ii];
+            }
+            for (jj = A_offd_i[i]; jj < A_offd_i[i + 1]; jj++)
+            {
+               ii = A_offd_j[jj];
+               res -= A_offd_data[jj] * v_ext_data[ii];
+            }
          }
 
          if (Skip_diag)
@@ -300,7 +349,7 @@ hypre_BoomerAMGRelaxWeightedJacobi_core( hypre_ParCSRMatrix *A,
       }
    }
 
-   if (num_procs > 1)
+   if (num_procs > 1 && !persistent_comm_handle)
    {
       hypre_TFree(v_ext_data, HYPRE_MEMORY_HOST);
       hypre_TFree(v_buf_data, HYPRE_MEMORY_HOST);
@@ -659,6 +708,13 @@ hypre_BoomerAMGRelaxHybridGaussSeidel_core( hypre_ParCSRMatrix *A,
    HYPRE_Real          *A_diag_data   = hypre_CSRMatrixData(A_diag);
    HYPRE_Int           *A_diag_i      = hypre_CSRMatrixI(A_diag);
    HYPRE_Int           *A_diag_j      = hypre_CSRMatrixJ(A_diag);
+   hypre_short         *A_diag_jdelta = hypre_CSRMatrixJDelta(A_diag);
+   HYPRE_Int           *A_diag_jbase  = hypre_CSRMatrixJBase(A_diag);
+   hypre_CSRMatrix     *A_merged      = hypre_ParCSRMatrixMerged(A);
+   HYPRE_Int           *A_merged_i    = A_merged ? hypre_CSRMatrixI(A_merged) : NULL;
+   HYPRE_Int           *A_merged_j    = A_merged ? hypre_CSRMatrixJ(A_merged) : NULL;
+   HYPRE_Complex       *A_merged_data = A_merged ? hypre_CSRMatrixData(A_merged) : NULL;
+   HYPRE_Int           *A_split       = hypre_ParCSRMatrixMergedSplit(A);
    hypre_CSRMatrix     *A_offd        = hypre_ParCSRMatrixOffd(A);
    HYPRE_Int           *A_offd_i      = hypre_CSRMatrixI(A_offd);
    HYPRE_Real          *A_offd_data   = hypre_CSRMatrixData(A_offd);
@@ -682,13 +738,9 @@ hypre_BoomerAMGRelaxHybridGaussSeidel_core( hypre_ParCSRMatrix *A,
    const HYPRE_Real     one_minus_omega  = 1.0 - omega;
    HYPRE_Int            num_procs, my_id, num_threads, j, num_sends;
 
-#if defined(HYPRE_USING_PERSISTENT_COMM)
-   // JSP: persistent comm can be similarly used for other smoothers
-   hypre_ParCSRPersistentCommHandle *persistent_comm_handle;
-#else
-   hypre_ParCSRCommHandle           *comm_handle;
+   hypre_ParCSRPersistentCommHandle *persistent_comm_handle = NULL;
+   hypre_ParCSRCommHandle           *comm_handle = NULL;
    HYPRE_Int                         num_cols_offd = hypre_CSRMatrixNumCols(A_offd);
-#endif
 
    hypre_MPI_Comm_size(comm, &num_procs);
    hypre_MPI_Comm_rank(comm, &my_id);
@@ -725,15 +777,18 @@ hypre_BoomerAMGRelaxHybridGaussSeidel_core( hypre_ParCSRMatrix *A,
 
       num_sends = hypre_ParCSRCommPkgNumSends(comm_pkg);
 
-#if defined(HYPRE_USING_PERSISTENT_COMM)
-      persistent_comm_handle = hypre_ParCSRCommPkgGetPersistentCommHandle(1, comm_pkg);
-      v_buf_data = (HYPRE_Real *) hypre_ParCSRCommHandleSendDataBuffer(persistent_comm_handle);
-      v_ext_data  = (HYPRE_Real *) hypre_ParCSRCommHandleRecvDataBuffer(persistent_comm_handle);
-#else
-      v_buf_data = hypre_CTAlloc(HYPRE_Real, hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends),
-                                 HYPRE_MEMORY_HOST);
-      v_ext_data = hypre_CTAlloc(HYPRE_Real, num_cols_offd, HYPRE_MEMORY_HOST);
-#endif
+      persistent_comm_handle = hypre_ParCSRCommPkgFindPersistentCommHandle(1, comm_pkg);
+      if (persistent_comm_handle)
+      {
+         v_buf_data = (HYPRE_Real *) hypre_ParCSRCommHandleSendDataBuffer(persistent_comm_handle);
+         v_ext_data = (HYPRE_Real *) hypre_ParCSRCommHandleRecvDataBuffer(persistent_comm_handle);
+      }
+      else
+      {
+         v_buf_data = hypre_CTAlloc(HYPRE_Real, hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends),
+                                    HYPRE_MEMORY_HOST);
+         v_ext_data = hypre_CTAlloc(HYPRE_Real, num_cols_offd, HYPRE_MEMORY_HOST);
+      }
 
       HYPRE_Int begin = hypre_ParCSRCommPkgSendMapStart(comm_pkg, 0);
       HYPRE_Int end   = hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends);
@@ -750,17 +805,16 @@ hypre_BoomerAMGRelaxHybridGaussSeidel_core( hypre_ParCSRMatrix *A,
       hypre_profile_times[HYPRE_TIMER_ID_HALO_EXCHANGE] -= hypre_MPI_Wtime();
 #endif
 
-#if defined(HYPRE_USING_PERSISTENT_COMM)
-      hypre_ParCSRPersistentCommHandleStart(persistent_comm_handle, HYPRE_MEMORY_HOST, v_buf_data);
-#else
-      comm_handle = hypre_ParCSRCommHandleCreate(1, comm_pkg, v_buf_data, v_ext_data);
-#endif
-
-#if defined(HYPRE_USING_PERSISTENT_COMM)
-      hypre_ParCSRPersistentCommHandleWait(persistent_comm_handle, HYPRE_MEMORY_HOST, v_ext_data);
-#else
-      hypre_ParCSRCommHandleDestroy(comm_handle);
-#endif
+      if (persistent_comm_handle)
+      {
+         hypre_ParCSRPersistentCommHandleStart(persistent_comm_handle, HYPRE_MEMORY_HOST, v_buf_data);
+         hypre_ParCSRPersistentCommHandleWait(persistent_comm_handle, HYPRE_MEMORY_HOST, v_ext_data);
+      }
+      else
+      {
+         comm_handle = hypre_ParCSRCommHandleCreate(1, comm_pkg, v_buf_data, v_ext_data);
+         hypre_ParCSRCommHandleDestroy(comm_handle);
+      }
 
 #ifdef HYPRE_PROFILE
       hypre_profile_times[HYPRE_TIMER_ID_HALO_EXCHANGE] += hypre_MPI_Wtime();
@@ -819,7 +873,21 @@ hypre_BoomerAMGRelaxHybridGaussSeidel_core( hypre_ParCSRMatrix *A,
             const HYPRE_Int ibegin = iorder > 0 ? ns : ne - 1;
             const HYPRE_Int iend = iorder > 0 ? ne : ns - 1;
 
-            if (non_scale)
+            if (non_scale && A_merged)
+            {
+               hypre_HybridGaussSeidelNSMerged(A_merged_i, A_split, A_merged_j, A_merged_data,
+                                               f_data, cf_marker, relax_points, l1_norms, u_data,
+                                               Vtemp_data, v_ext_data, ns, ne, ibegin, iend, iorder,
+                                               Skip_diag);
+            }
+            else if (non_scale && A_diag_jdelta)
+            {
+               hypre_HybridGaussSeidelNSCompressed(A_diag_i, A_diag_jdelta, A_diag_jbase, A_diag_data,
+                                                   A_offd_i, A_offd_j, A_offd_data, f_data, cf_marker,
+                                                   relax_points, l1_norms, u_data, Vtemp_data, v_ext_data,
+                                                   ns, ne, ibegin, iend, iorder, Skip_diag);
+            }
+            else if (non_scale)
             {
                hypre_HybridGaussSeidelNSThreads(A_diag_i, A_diag_j, A_diag_data, A_offd_i, A_offd_j, A_offd_data,
                                                 f_data, cf_marker, relax_points, l1_norms, u_data, Vtemp_data, v_ext_data,
@@ -851,7 +919,21 @@ hypre_BoomerAMGRelaxHybridGaussSeidel_core( hypre_ParCSRMatrix *A,
          }
          else
          {
-            if (non_scale)
+            if (non_scale && A_merged)
+            {
+               hypre_HybridGaussSeidelNSMerged(A_merged_i, A_split, A_merged_j, A_merged_data,
+                                               f_data, cf_marker, relax_points, l1_norms, u_data,
+                                               Vtemp_data, v_ext_data, 0, num_rows, ibegin, iend, iorder,
+                                               Skip_diag);
+            }
+            else if (non_scale && A_diag_jdelta)
+            {
+               hypre_HybridGaussSeidelNSCompressed(A_diag_i, A_diag_jdelta, A_diag_jbase, A_diag_data,
+                                                   A_offd_i, A_offd_j, A_offd_data, f_data, cf_marker,
+                                                   relax_points, l1_norms, u_data, Vtemp_data, v_ext_data,
+                                                   0, num_rows, ibegin, iend, iorder, Skip_diag);
+            }
+            else if (non_scale)
             {
                hypre_HybridGaussSeidelNS(A_diag_i, A_diag_j, A_diag_data, A_offd_i, A_offd_j, A_offd_data,
                                          f_data, cf_marker, relax_points, l1_norms, u_data, Vtemp_data, v_ext_data,
@@ -867,13 +949,11 @@ hypre_BoomerAMGRelaxHybridGaussSeidel_core( hypre_ParCSRMatrix *A,
       } /* for (sweep = 0; sweep < num_sweeps; sweep++) */
    } /* if (num_threads > 1) */
 
-#ifndef HYPRE_USING_PERSISTENT_COMM
-   if (num_procs > 1)
+   if (num_procs > 1 && !persistent_comm_handle)
    {
       hypre_TFree(v_ext_data, HYPRE_MEMORY_HOST);
       hypre_TFree(v_buf_data, HYPRE_MEMORY_HOST);
    }
-#endif
 
 #ifdef HYPRE_PROFILE
    hypre_profile_times[HYPRE_TIMER_ID_RELAX] += hypre_MPI_Wtime();
@@ -218,6 +218,139 @@ hypre_HybridGaussSeidelNSThreads( HYPRE_Int     *A_diag_i,
    }
 }
 
+/* Non-Scale version reading the compressed diag column indices (see
+ * hypre_CSRMatrixCompressIndices).  Rows [ns, ne) belong to the calling
+ * thread; the other diag columns are read from v_tmp_data. */
+static inline void
+hypre_HybridGaussSeidelNSCompressed( HYPRE_Int     *A_diag_i,
+                                     hypre_short   *A_diag_jdelta,
+                                     HYPRE_Int     *A_diag_jbase,
+                                     HYPRE_Complex *A_diag_data,
+                                     HYPRE_Int     *A_offd_i,
+                                     HYPRE_Int     *A_offd_j,
+                                     HYPRE_Complex *A_offd_data,
+                                     HYPRE_Complex *f_data,
+                                     HYPRE_Int     *cf_marker,
+                                     HYPRE_Int      relax_points,
+                                     HYPRE_Complex *l1_norms,
+                                     HYPRE_Complex *u_data,
+                                     HYPRE_Complex *v_tmp_data,
+                                     HYPRE_Complex *v_ext_data,
+                                     HYPRE_Int      ns,
+                                     HYPRE_Int      ne,
+                                     HYPRE_Int      ibegin,
+                                     HYPRE_Int      iend,
+                                     HYPRE_Int      iorder,
+                                     HYPRE_Int      Skip_diag )
+{
+   HYPRE_Int i;
+   const HYPRE_Complex zero = 0.0;
+
+   for (i = ibegin; i != iend; i += iorder)
+   {
+      const HYPRE_Complex diag = l1_norms ? l1_norms[i] : A_diag_data[A_diag_i[i]];
+
+      if ( (relax_points == 0 || cf_marker[i] == relax_points) && diag != zero )
+      {
+         const HYPRE_Int base = A_diag_jbase ? A_diag_jbase[i] : i;
+         HYPRE_Int jj;
+         HYPRE_Complex res = f_data[i];
+
+         for (jj = A_diag_i[i] + Skip_diag; jj < A_diag_i[i + 1]; jj++)
+         {
+            const HYPRE_Int ii = base + A_diag_jdelta[jj];
+            if (ii >= ns && ii < ne)
+            {
+               res -= A_diag_data[jj] * u_data[ii];
+            }
+            else
+            {
+               res -= A_diag_data[jj] * v_tmp_data[ii];
+            }
+         }
+
+         for (jj = A_offd_i[i]; jj < A_offd_i[i + 1]; jj++)
+         {
+            const HYPRE_Int ii = A_offd_j[jj];
+            res -= A_offd_data[jj] * v_ext_data[ii];
+         }
+
+         if (Skip_diag)
+         {
+            u_data[i] = res / diag;
+         }
+         else
+         {
+            u_data[i] += res / diag;
+         }
+      }
+   } /* for ( i = ...) */
+}
+
+/* Non-Scale version reading the merged layout of A (see
+ * hypre_ParCSRMatrixCreateMergedLayout).  Rows [ns, ne) belong to the calling
+ * thread; the other diag columns are read from v_tmp_data. */
+static inline void
+hypre_HybridGaussSeidelNSMerged( HYPRE_Int     *A_i,
+                                 HYPRE_Int     *A_split,
+                                 HYPRE_Int     *A_j,
+                                 HYPRE_Complex *A_data,
+                                 HYPRE_Complex *f_data,
+                                 HYPRE_Int     *cf_marker,
+                                 HYPRE_Int      relax_points,
+                                 HYPRE_Complex *l1_norms,
+                                 HYPRE_Complex *u_data,
+                                 HYPRE_Complex *v_tmp_data,
+                                 HYPRE_Complex *v_ext_data,
+                                 HYPRE_Int      ns,
+                                 HYPRE_Int      ne,
+                                 HYPRE_Int      ibegin,
+                                 HYPRE_Int      iend,
+                                 HYPRE_Int      iorder,
+                                 HYPRE_Int      Skip_diag )
+{
+   HYPRE_Int i;
+   const HYPRE_Complex zero = 0.0;
+
+   for (i = ibegin; i != iend; i += iorder)
+   {
+      const HYPRE_Complex diag = l1_norms ? l1_norms[i] : A_data[A_i[i]];
+
+      if ( (relax_points == 0 || cf_marker[i] == relax_points) && diag != zero )
+      {
+         HYPRE_Int jj;
+         HYPRE_Complex res = f_data[i];
+
+         for (jj = A_i[i] + Skip_diag; jj < A_split[i]; jj++)
+         {
+            const HYPRE_Int ii = A_j[jj];
+            if (ii >= ns && ii < ne)
+            {
+               res -= A_data[jj] * u_data[ii];
+            }
+            else
+            {
+               res -= A_data[jj] * v_tmp_data[ii];
+            }
+         }
+
+         for (jj = A_split[i]; jj < A_i[i + 1]; jj++)
+         {
+            res -= A_data[jj] * v_ext_data[A_j[jj]];
+         }
+
+         if (Skip_diag)
+         {
+            u_data[i] = res / diag;
+         }
+         else
+         {
+            u_data[i] += res / diag;
+         }
+      }
+   } /* for ( i = ...) */
+}
+
 /* Scaled version */
 static inline void
 hypre_HybridGaussSeidel( HYPRE_Int     *A_diag_i,
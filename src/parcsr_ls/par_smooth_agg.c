@@ -0,0 +1,616 @@
+/******************************************************************************
+ * Copyright (c) 1998 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Smoothed aggregation coarsening and interpolation for BoomerAMG
+ *
+ * The aggregates are built from the local (diag) part of the strength matrix,
+ * so no aggregate crosses a processor boundary.  The unknowns of a node are
+ * assumed to be numbered contiguously, as for nodal coarsening.  The
+ * near-nullspace is stored column-wise in a dense array B with one column per
+ * vector, B[i + k * n] being entry i of vector k on a level with n local rows.
+ *
+ *****************************************************************************/
+
+#include "_hypre_parcsr_ls.h"
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGSmoothAggNullspace
+ *
+ * Builds the near-nullspace of the finest level: one piecewise constant
+ * vector per function, followed by the (local parts of the) interpolation
+ * vectors given by the user, e.g. the rotational rigid body modes.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGSmoothAggNullspace( hypre_ParCSRMatrix  *A,
+                                   HYPRE_Int            num_functions,
+                                   HYPRE_Int           *dof_func,
+                                   HYPRE_Int            num_interp_vectors,
+                                   hypre_ParVector    **interp_vectors,
+                                   HYPRE_Int           *num_vectors_ptr,
+                                   HYPRE_Real         **B_ptr )
+{
+   HYPRE_Int    n = hypre_CSRMatrixNumRows(hypre_ParCSRMatrixDiag(A));
+   HYPRE_Int    num_vectors;
+   HYPRE_Int    i, k;
+   HYPRE_Real  *B;
+   HYPRE_Real  *vec_data;
+
+   if (!interp_vectors)
+   {
+      num_interp_vectors = 0;
+   }
+   num_vectors = num_functions + num_interp_vectors;
+
+   B = hypre_CTAlloc(HYPRE_Real, n * num_vectors, HYPRE_MEMORY_HOST);
+
+   for (i = 0; i < n; i++)
+   {
+      k = (num_functions > 1) ? (dof_func ? dof_func[i] : i % num_functions) : 0;
+      B[i + k * n] = 1.0;
+   }
+
+   for (k = 0; k < num_interp_vectors; k++)
+   {
+      vec_data = hypre_VectorData(hypre_ParVectorLocalVector(interp_vectors[k]));
+      for (i = 0; i < n; i++)
+      {
+         B[i + (num_functions + k) * n] = vec_data[i];
+      }
+   }
+
+   *num_vectors_ptr = num_vectors;
+   *B_ptr = B;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGCoarsenAggregates
+ *
+ * Greedy uncoupled aggregation of the nodes of the local strength graph.
+ * S is either the nodal strength matrix or the strength matrix of the
+ * unknowns, whose connections are then contracted to nodes.
+ *
+ * Phase 1 turns every node whose strong neighbors are all unaggregated into
+ * the root of a new aggregate holding the node and its neighbors.  Phase 2
+ * attaches the remaining nodes to an aggregate of phase 1 they are strongly
+ * connected to.  Phase 3 makes the nodes that are still left singleton
+ * aggregates, unless a single node cannot represent num_vectors vectors;
+ * such nodes stay unaggregated and only get interpolation weights from the
+ * prolongator smoothing.
+ *
+ * On return aggregates holds the aggregate of every local node (-1 if none),
+ * and CF_marker is 1 at the unknowns of the root nodes and -1 elsewhere
+ * (user-defined isolated F-points are kept and left unaggregated).
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGCoarsenAggregates( hypre_ParCSRMatrix  *S,
+                                  HYPRE_Int            num_functions,
+                                  HYPRE_Int            num_vectors,
+                                  hypre_IntArray      *CF_marker,
+                                  hypre_IntArray     **aggregates_ptr,
+                                  HYPRE_Int           *num_aggregates_ptr )
+{
+   hypre_CSRMatrix *S_diag       = hypre_ParCSRMatrixDiag(S);
+   HYPRE_Int       *S_diag_i     = hypre_CSRMatrixI(S_diag);
+   HYPRE_Int       *S_diag_j     = hypre_CSRMatrixJ(S_diag);
+   HYPRE_Int        num_rows_S   = hypre_CSRMatrixNumRows(S_diag);
+
+   HYPRE_Int       *CF_marker_data = hypre_IntArrayData(CF_marker);
+   HYPRE_Int        n              = hypre_IntArraySize(CF_marker);
+   HYPRE_Int        num_nodes      = n / num_functions;
+
+   HYPRE_Int       *agg;
+   HYPRE_Int       *node_i;
+   HYPRE_Int       *node_j;
+   HYPRE_Int       *skip;
+   HYPRE_Int        S_nf, num_aggregates;
+   HYPRE_Int        i, j, jj, k, r, row, cnt, fits;
+
+   /* S_nf is the number of rows of S per node */
+   S_nf = (num_rows_S == num_nodes) ? 1 : num_functions;
+
+   /* Node graph, without self-connections; skip marks the nodes holding
+      isolated F-points */
+   node_i = hypre_CTAlloc(HYPRE_Int, num_nodes + 1, HYPRE_MEMORY_HOST);
+   node_j = hypre_CTAlloc(HYPRE_Int, S_diag_i[num_rows_S], HYPRE_MEMORY_HOST);
+   skip   = hypre_CTAlloc(HYPRE_Int, num_nodes, HYPRE_MEMORY_HOST);
+   cnt = 0;
+   for (i = 0; i < num_nodes; i++)
+   {
+      for (r = 0; r < S_nf; r++)
+      {
+         row = i * S_nf + r;
+         for (jj = S_diag_i[row]; jj < S_diag_i[row + 1]; jj++)
+         {
+            j = S_diag_j[jj] / S_nf;
+            if (S_diag_j[jj] >= 0 && j != i)
+            {
+               node_j[cnt++] = j;
+            }
+         }
+      }
+      node_i[i + 1] = cnt;
+      for (r = 0; r < num_functions; r++)
+      {
+         if (CF_marker_data[i * num_functions + r] == -3)
+         {
+            skip[i] = 1;
+         }
+      }
+   }
+
+   *aggregates_ptr = hypre_IntArrayCreate(num_nodes);
+   hypre_IntArrayInitialize_v2(*aggregates_ptr, HYPRE_MEMORY_HOST);
+   agg = hypre_IntArrayData(*aggregates_ptr);
+   for (i = 0; i < num_nodes; i++)
+   {
+      agg[i] = -1;
+   }
+   for (i = 0; i < n; i++)
+   {
+      if (CF_marker_data[i] != -3)
+      {
+         CF_marker_data[i] = -1;
+      }
+   }
+   num_aggregates = 0;
+
+   /* Phase 1: roots with unaggregated neighborhoods */
+   for (i = 0; i < num_nodes; i++)
+   {
+      if (agg[i] != -1 || skip[i] || node_i[i + 1] == node_i[i])
+      {
+         continue;
+      }
+      fits = 1;
+      for (jj = node_i[i]; jj < node_i[i + 1]; jj++)
+      {
+         if (agg[node_j[jj]] != -1 || skip[node_j[jj]])
+         {
+            fits = 0;
+            break;
+         }
+      }
+      if (fits)
+      {
+         agg[i] = num_aggregates;
+         for (jj = node_i[i]; jj < node_i[i + 1]; jj++)
+         {
+            agg[node_j[jj]] = num_aggregates;
+         }
+         for (r = 0; r < num_functions; r++)
+         {
+            CF_marker_data[i * num_functions + r] = 1;
+         }
+         num_aggregates++;
+      }
+   }
+
+   /* Phase 2: attach to a neighboring aggregate of phase 1; the new members
+      are marked with -2-agg so they are not used as attachment points */
+   for (i = 0; i < num_nodes; i++)
+   {
+      if (agg[i] != -1 || skip[i])
+      {
+         continue;
+      }
+      for (jj = node_i[i]; jj < node_i[i + 1]; jj++)
+      {
+         if (agg[node_j[jj]] >= 0)
+         {
+            agg[i] = -2 - agg[node_j[jj]];
+            break;
+         }
+      }
+   }
+   for (i = 0; i < num_nodes; i++)
+   {
+      if (agg[i] < -1)
+      {
+         agg[i] = -2 - agg[i];
+      }
+   }
+
+   /* Phase 3: leftover nodes */
+   for (i = 0; i < num_nodes; i++)
+   {
+      if (agg[i] != -1 || skip[i])
+      {
+         continue;
+      }
+      if (num_vectors <= num_functions)
+      {
+         agg[i] = num_aggregates++;
+         for (k = 0; k < num_functions; k++)
+         {
+            CF_marker_data[i * num_functions + k] = 1;
+         }
+      }
+   }
+
+   hypre_TFree(node_i, HYPRE_MEMORY_HOST);
+   hypre_TFree(node_j, HYPRE_MEMORY_HOST);
+   hypre_TFree(skip, HYPRE_MEMORY_HOST);
+
+   *num_aggregates_ptr = num_aggregates;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGSmoothAggCoarseParms
+ *
+ * Global coarse partitioning and coarse dof_func for num_vectors coarse
+ * unknowns per aggregate, cf. hypre_BoomerAMGCoarseParms.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGSmoothAggCoarseParms( MPI_Comm          comm,
+                                     HYPRE_Int         num_aggregates,
+                                     HYPRE_Int         num_vectors,
+                                     hypre_IntArray  **coarse_dof_func_ptr,
+                                     HYPRE_BigInt     *coarse_pnts_global )
+{
+   HYPRE_BigInt  local_coarse_size = (HYPRE_BigInt) num_aggregates * num_vectors;
+   HYPRE_BigInt  scan_recv;
+   HYPRE_Int    *coarse_dof_func;
+   HYPRE_Int     i;
+
+   if (num_vectors > 1)
+   {
+      *coarse_dof_func_ptr = hypre_IntArrayCreate((HYPRE_Int) local_coarse_size);
+      hypre_IntArrayInitialize(*coarse_dof_func_ptr);
+      coarse_dof_func = hypre_IntArrayData(*coarse_dof_func_ptr);
+      for (i = 0; i < (HYPRE_Int) local_coarse_size; i++)
+      {
+         coarse_dof_func[i] = i % num_vectors;
+      }
+   }
+
+   hypre_MPI_Scan(&local_coarse_size, &scan_recv, 1, HYPRE_MPI_BIG_INT, hypre_MPI_SUM, comm);
+
+   coarse_pnts_global[0] = scan_recv - local_coarse_size;
+   coarse_pnts_global[1] = scan_recv;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGBuildSmoothAggInterp
+ *
+ * Builds the tentative prolongator by orthonormalizing the near-nullspace B
+ * on every aggregate (P_tent * B_coarse = B), and smooths it with one damped
+ * Jacobi step, P = (I - omega D^{-1} A) P_tent with omega = 4/(3 rho), where
+ * rho is a CG estimate of the spectral radius of D^{-1} A.  Coarse unknown k
+ * of aggregate a is a * num_vectors + k.  If the vectors of an aggregate are
+ * linearly dependent, the basis is completed with unit vectors so that no
+ * column of P is empty.  P is only truncated if the near-nullspace consists
+ * of the constant vectors.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGBuildSmoothAggInterp( hypre_ParCSRMatrix  *A,
+                                     hypre_IntArray      *aggregates,
+                                     HYPRE_Int            num_functions,
+                                     HYPRE_Int            num_vectors,
+                                     HYPRE_Real          *B,
+                                     HYPRE_BigInt        *coarse_pnts_global,
+                                     HYPRE_Real           trunc_factor,
+                                     HYPRE_Int            max_elmts,
+                                     HYPRE_Real         **B_coarse_ptr,
+                                     hypre_ParCSRMatrix **P_ptr )
+{
+   MPI_Comm            comm        = hypre_ParCSRMatrixComm(A);
+   hypre_CSRMatrix    *A_diag      = hypre_ParCSRMatrixDiag(A);
+   HYPRE_Int          *A_diag_i    = hypre_CSRMatrixI(A_diag);
+   HYPRE_Int          *A_diag_j    = hypre_CSRMatrixJ(A_diag);
+   HYPRE_Real         *A_diag_data = hypre_CSRMatrixData(A_diag);
+   HYPRE_Int           n           = hypre_CSRMatrixNumRows(A_diag);
+   HYPRE_Int          *agg         = hypre_IntArrayData(aggregates);
+   HYPRE_Int           num_nodes   = n / num_functions;
+
+   hypre_ParCSRMatrix *P_tent, *AP, *P;
+   hypre_CSRMatrix    *P_diag, *AP_diag, *AP_offd;
+   HYPRE_Int          *P_diag_i, *P_diag_j;
+   HYPRE_Real         *P_diag_data;
+   HYPRE_Int          *AP_i, *AP_offd_i;
+   HYPRE_Real         *AP_data, *AP_offd_data;
+
+   HYPRE_BigInt        total_global_cpts;
+   HYPRE_Int           num_procs, my_id;
+   HYPRE_Int           num_coarse, num_aggregates;
+   HYPRE_Int          *agg_i, *agg_j, *pos;
+   HYPRE_Real         *Q, *R, *B_coarse;
+   HYPRE_Real          max_eig, min_eig, omega, scale;
+   HYPRE_Real          nrm, nrm0, dot, best, res;
+   HYPRE_Int           i, j, jj, k, kk, a, m, d, pass;
+
+   hypre_MPI_Comm_size(comm, &num_procs);
+   hypre_MPI_Comm_rank(comm, &my_id);
+
+   if (my_id == (num_procs - 1))
+   {
+      total_global_cpts = coarse_pnts_global[1];
+   }
+   hypre_MPI_Bcast(&total_global_cpts, 1, HYPRE_MPI_BIG_INT, num_procs - 1, comm);
+
+   num_coarse     = (HYPRE_Int) (coarse_pnts_global[1] - coarse_pnts_global[0]);
+   num_aggregates = num_coarse / num_vectors;
+
+   /*-----------------------------------------------------------------------
+    * Unknowns of every aggregate
+    *-----------------------------------------------------------------------*/
+
+   agg_i = hypre_CTAlloc(HYPRE_Int, num_aggregates + 1, HYPRE_MEMORY_HOST);
+   agg_j = hypre_CTAlloc(HYPRE_Int, n, HYPRE_MEMORY_HOST);
+   pos   = hypre_CTAlloc(HYPRE_Int, num_aggregates, HYPRE_MEMORY_HOST);
+   for (i = 0; i < num_nodes; i++)
+   {
+      if (agg[i] >= 0)
+      {
+         agg_i[agg[i] + 1] += num_functions;
+      }
+   }
+   for (a = 0; a < num_aggregates; a++)
+   {
+      agg_i[a + 1] += agg_i[a];
+      pos[a] = agg_i[a];
+   }
+   for (i = 0; i < num_nodes; i++)
+   {
+      if (agg[i] >= 0)
+      {
+         for (k = 0; k < num_functions; k++)
+         {
+            agg_j[pos[agg[i]]++] = i * num_functions + k;
+         }
+      }
+   }
+
+   /*-----------------------------------------------------------------------
+    * Tentative prolongator: modified Gram-Schmidt with reorthogonalization
+    * on every aggregate; R becomes the coarse near-nullspace
+    *-----------------------------------------------------------------------*/
+
+   P_tent = hypre_ParCSRMatrixCreate(comm,
+                                     hypre_ParCSRMatrixGlobalNumRows(A),
+                                     total_global_cpts,
+                                     hypre_ParCSRMatrixRowStarts(A),
+                                     coarse_pnts_global,
+                                     0,
+                                     agg_i[num_aggregates] * num_vectors,
+                                     0);
+   hypre_ParCSRMatrixInitialize_v2(P_tent, HYPRE_MEMORY_HOST);
+   P_diag      = hypre_ParCSRMatrixDiag(P_tent);
+   P_diag_i    = hypre_CSRMatrixI(P_diag);
+   P_diag_j    = hypre_CSRMatrixJ(P_diag);
+   P_diag_data = hypre_CSRMatrixData(P_diag);
+
+   for (i = 0; i < n; i++)
+   {
+      P_diag_i[i + 1] = P_diag_i[i] + ((agg[i / num_functions] >= 0) ? num_vectors : 0);
+   }
+
+   B_coarse = hypre_CTAlloc(HYPRE_Real, num_coarse * num_vectors, HYPRE_MEMORY_HOST);
+   Q = hypre_CTAlloc(HYPRE_Real, agg_i[num_aggregates] * num_vectors, HYPRE_MEMORY_HOST);
+   R = hypre_CTAlloc(HYPRE_Real, num_vectors * num_vectors, HYPRE_MEMORY_HOST);
+
+   for (a = 0; a < num_aggregates; a++)
+   {
+      HYPRE_Int  first = agg_i[a];
+      HYPRE_Real *Qa;
+
+      m  = agg_i[a + 1] - first;
+      Qa = Q + first * num_vectors;
+
+      /* Qa is m x num_vectors, column-major */
+      for (k = 0; k < num_vectors; k++)
+      {
+         for (i = 0; i < m; i++)
+         {
+            Qa[i + k * m] = B[agg_j[first + i] + k * n];
+         }
+      }
+      for (k = 0; k < num_vectors * num_vectors; k++)
+      {
+         R[k] = 0.0;
+      }
+
+      for (k = 0; k < num_vectors; k++)
+      {
+         nrm0 = 0.0;
+         for (i = 0; i < m; i++)
+         {
+            nrm0 += Qa[i + k * m] * Qa[i + k * m];
+         }
+         nrm0 = sqrt(nrm0);
+
+         for (pass = 0; pass < 2; pass++)
+         {
+            for (kk = 0; kk < k; kk++)
+            {
+               dot = 0.0;
+               for (i = 0; i < m; i++)
+               {
+                  dot += Qa[i + kk * m] * Qa[i + k * m];
+               }
+               R[kk + k * num_vectors] += dot;
+               for (i = 0; i < m; i++)
+               {
+                  Qa[i + k * m] -= dot * Qa[i + kk * m];
+               }
+            }
+         }
+         nrm = 0.0;
+         for (i = 0; i < m; i++)
+         {
+            nrm += Qa[i + k * m] * Qa[i + k * m];
+         }
+         nrm = sqrt(nrm);
+
+         if (nrm > 1.0e-10 * nrm0 && nrm > 0.0)
+         {
+            R[k + k * num_vectors] = nrm;
+         }
+         else
+         {
+            /* dependent vector: complete the basis with the unit vector
+               that is furthest from the span of the previous columns */
+            d = -1;
+            best = 0.0;
+            for (i = 0; i < m; i++)
+            {
+               res = 1.0;
+               for (kk = 0; kk < k; kk++)
+               {
+                  res -= Qa[i + kk * m] * Qa[i + kk * m];
+               }
+               if (res > best + 1.0e-12)
+               {
+                  best = res;
+                  d = i;
+               }
+            }
+            for (i = 0; i < m; i++)
+            {
+               Qa[i + k * m] = 0.0;
+            }
+            nrm = 0.0;
+            if (d > -1)
+            {
+               Qa[d + k * m] = 1.0;
+               for (pass = 0; pass < 2; pass++)
+               {
+                  for (kk = 0; kk < k; kk++)
+                  {
+                     dot = 0.0;
+                     for (i = 0; i < m; i++)
+                     {
+                        dot += Qa[i + kk * m] * Qa[i + k * m];
+                     }
+                     for (i = 0; i < m; i++)
+                     {
+                        Qa[i + k * m] -= dot * Qa[i + kk * m];
+                     }
+                  }
+               }
+               for (i = 0; i < m; i++)
+               {
+                  nrm += Qa[i + k * m] * Qa[i + k * m];
+               }
+               nrm = sqrt(nrm);
+            }
+         }
+         if (nrm > 0.0)
+         {
+            scale = 1.0 / nrm;
+            for (i = 0; i < m; i++)
+            {
+               Qa[i + k * m] *= scale;
+            }
+         }
+      }
+
+      /* rows of P_tent and coarse near-nullspace */
+      for (i = 0; i < m; i++)
+      {
+         jj = P_diag_i[agg_j[first + i]];
+         for (k = 0; k < num_vectors; k++)
+         {
+            P_diag_j[jj + k]    = a * num_vectors + k;
+            P_diag_data[jj + k] = Qa[i + k * m];
+         }
+      }
+      for (k = 0; k < num_vectors; k++)
+      {
+         for (kk = 0; kk < num_vectors; kk++)
+         {
+            B_coarse[a * num_vectors + kk + k * num_coarse] = R[kk + k * num_vectors];
+         }
+      }
+   }
+
+   hypre_TFree(agg_i, HYPRE_MEMORY_HOST);
+   hypre_TFree(agg_j, HYPRE_MEMORY_HOST);
+   hypre_TFree(pos, HYPRE_MEMORY_HOST);
+   hypre_TFree(Q, HYPRE_MEMORY_HOST);
+   hypre_TFree(R, HYPRE_MEMORY_HOST);
+
+   /*-----------------------------------------------------------------------
+    * Prolongator smoothing
+    *-----------------------------------------------------------------------*/
+
+   hypre_ParCSRMaxEigEstimateCG(A, 1, 10, &max_eig, &min_eig);
+
+   if (max_eig > 0.0)
+   {
+      omega = 4.0 / (3.0 * max_eig);
+
+      AP           = hypre_ParCSRMatMat(A, P_tent);
+      AP_diag      = hypre_ParCSRMatrixDiag(AP);
+      AP_i         = hypre_CSRMatrixI(AP_diag);
+      AP_data      = hypre_CSRMatrixData(AP_diag);
+      AP_offd      = hypre_ParCSRMatrixOffd(AP);
+      AP_offd_i    = hypre_CSRMatrixI(AP_offd);
+      AP_offd_data = hypre_CSRMatrixData(AP_offd);
+
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel for private(i, j, jj, scale) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < n; i++)
+      {
+         scale = 0.0;
+         for (jj = A_diag_i[i]; jj < A_diag_i[i + 1]; jj++)
+         {
+            if (A_diag_j[jj] == i)
+            {
+               scale = A_diag_data[jj];
+               break;
+            }
+         }
+         scale = (scale != 0.0) ? -omega / scale : 0.0;
+         for (j = AP_i[i]; j < AP_i[i + 1]; j++)
+         {
+            AP_data[j] *= scale;
+         }
+         for (j = AP_offd_i[i]; j < AP_offd_i[i + 1]; j++)
+         {
+            AP_offd_data[j] *= scale;
+         }
+      }
+
+      hypre_ParCSRMatrixAdd(1.0, P_tent, 1.0, AP, &P);
+      hypre_ParCSRMatrixDestroy(AP);
+      hypre_ParCSRMatrixDestroy(P_tent);
+   }
+   else
+   {
+      P = P_tent;
+   }
+
+   /* the truncation rescales the rows to preserve the row sums, which would
+      destroy the interpolation of the non-constant vectors */
+   if ((trunc_factor != 0.0 || max_elmts > 0) && num_vectors == num_functions)
+   {
+      hypre_BoomerAMGInterpTruncation(P, trunc_factor, max_elmts);
+   }
+
+   if (!hypre_ParCSRMatrixCommPkg(P))
+   {
+      hypre_MatvecCommPkgCreate(P);
+   }
+
+   *B_coarse_ptr = B_coarse;
+   *P_ptr = P;
+
+   return hypre_error_flag;
+}
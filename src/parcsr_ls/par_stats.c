@@ -73,6 +73,7 @@ hypre_BoomerAMGSetupStats( void               *amg_vdata,
    HYPRE_Int      agg_interp_type;
    HYPRE_Int      measure_type;
    HYPRE_Int      agg_num_levels;
+   HYPRE_Int      sa_num_levels;
    HYPRE_Real   global_nonzeros;
 
    HYPRE_Real  *send_buff;
@@ -169,6 +170,7 @@ hypre_BoomerAMGSetupStats( void               *amg_vdata,
    smooth_type = hypre_ParAMGDataSmoothType(amg_data);
    smooth_num_levels = hypre_ParAMGDataSmoothNumLevels(amg_data);
    agg_num_levels = hypre_ParAMGDataAggNumLevels(amg_data);
+   sa_num_levels = hypre_ParAMGDataSmoothAggNumLevels(amg_data);
    additive = hypre_ParAMGDataAdditive(amg_data);
    mult_additive = hypre_ParAMGDataMultAdditive(amg_data);
    simple = hypre_ParAMGDataSimple(amg_data);
@@ -296,6 +298,11 @@ hypre_BoomerAMGSetupStats( void               *amg_vdata,
          }
       }
 
+      if (sa_num_levels > 0)
+      {
+         hypre_printf("\n No. of levels of smoothed aggregation: %d\n\n", sa_num_levels);
+      }
+
 
       if (coarsen_type)
          hypre_printf(" measures are determined %s\n\n",
@@ -995,6 +1002,44 @@ hypre_BoomerAMGSetupStats( void               *amg_vdata,
       hypre_printf("\n\n");
    }
 
+   /* memory of each level and the adaptation to the memory budget */
+   if (hypre_ParAMGDataMemoryAdapt(amg_data) && !block_mode)
+   {
+      HYPRE_Int  *memory_adapt = hypre_ParAMGDataMemoryAdapt(amg_data);
+      HYPRE_Real *level_mem = hypre_CTAlloc(HYPRE_Real, 2 * num_levels + 1, HYPRE_MEMORY_HOST);
+      HYPRE_Real *max_mem = hypre_CTAlloc(HYPRE_Real, 2 * num_levels + 1, HYPRE_MEMORY_HOST);
+      const char *adapt_name[4] = {"none", "Pmx 3", "Pmx 3, agg", "Pmx 3, agg, non-Galerkin"};
+
+      for (level = 0; level < num_levels; level++)
+      {
+         level_mem[level] = hypre_BoomerAMGMatrixMemory(A_array[level]) / 1048576.0;
+         if (level < num_levels - 1)
+         {
+            level_mem[num_levels + level] = hypre_BoomerAMGMatrixMemory(P_array[level]) / 1048576.0;
+         }
+         level_mem[2 * num_levels] += level_mem[level] + level_mem[num_levels + level];
+      }
+      hypre_MPI_Reduce(level_mem, max_mem, 2 * num_levels + 1, HYPRE_MPI_REAL,
+                       hypre_MPI_MAX, 0, comm);
+
+      if (my_id == 0)
+      {
+         hypre_printf("     Memory (MB, max over processes), budget = %f\n\n",
+                      hypre_ParAMGDataMemoryBudget(amg_data));
+         hypre_printf(" lev          A          P   adaptation\n");
+         for (level = 0; level < num_levels - 1; level++)
+         {
+            hypre_printf("%3d  %9.4f  %9.4f   %s\n", level, max_mem[level],
+                         max_mem[num_levels + level], adapt_name[memory_adapt[level]]);
+         }
+         hypre_printf("%3d  %9.4f\n\n", num_levels - 1, max_mem[num_levels - 1]);
+         hypre_printf("     total = %f\n\n\n", max_mem[2 * num_levels]);
+      }
+
+      hypre_TFree(level_mem, HYPRE_MEMORY_HOST);
+      hypre_TFree(max_mem, HYPRE_MEMORY_HOST);
+   }
+
    if (my_id == 0)
    {
       hypre_printf("\n\nBoomerAMG SOLVER PARAMETERS:\n\n");
@@ -1313,6 +1358,35 @@ hypre_BoomerAMGSetupStats( void               *amg_vdata,
 
 
 
+/*---------------------------------------------------------------
+ * hypre_BoomerAMGMatrixMemory
+ *
+ * Bytes used by the local part of a ParCSR matrix: row pointers,
+ * column indices, values and the column map of the offd part.
+ *---------------------------------------------------------------*/
+
+HYPRE_Real
+hypre_BoomerAMGMatrixMemory( hypre_ParCSRMatrix *A )
+{
+   hypre_CSRMatrix *A_diag, *A_offd;
+   HYPRE_Real       bytes;
+
+   if (!A)
+   {
+      return 0.0;
+   }
+
+   A_diag = hypre_ParCSRMatrixDiag(A);
+   A_offd = hypre_ParCSRMatrixOffd(A);
+
+   bytes  = 2.0 * (hypre_CSRMatrixNumRows(A_diag) + 1) * sizeof(HYPRE_Int);
+   bytes += (HYPRE_Real) (hypre_CSRMatrixNumNonzeros(A_diag) + hypre_CSRMatrixNumNonzeros(A_offd)) *
+            (sizeof(HYPRE_Int) + sizeof(HYPRE_Complex));
+   bytes += (HYPRE_Real) hypre_CSRMatrixNumCols(A_offd) * sizeof(HYPRE_BigInt);
+
+   return bytes;
+}
+
 /*---------------------------------------------------------------
  * hypre_BoomerAMGWriteSolverParams
  *---------------------------------------------------------------*/
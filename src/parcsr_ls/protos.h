@@ -161,6 +161,10 @@ HYPRE_Int hypre_ParCSRMatrixFixZeroRows ( hypre_ParCSRMatrix *A );
 HYPRE_Int hypre_ParCSRComputeL1Norms ( hypre_ParCSRMatrix *A, HYPRE_Int option,
                                        HYPRE_Int *cf_marker, HYPRE_Real **l1_norm_ptr );
 HYPRE_Int hypre_ParCSRMatrixSetDiagRows ( hypre_ParCSRMatrix *A, HYPRE_Real d );
+HYPRE_Int hypre_ParCSRMatrixBlockColSplit ( hypre_ParCSRMatrix *A, hypre_ParCSRMatrix *A_ [3 ],
+                                            HYPRE_Int dim );
+HYPRE_Int hypre_ParCSRComponentRAP ( hypre_ParCSRMatrix *A, hypre_ParCSRMatrix *Pi, HYPRE_Int dim,
+                                     hypre_ParCSRMatrix *Pi_ [3 ], hypre_ParCSRMatrix *A_ [3 ] );
 void *hypre_AMSCreate ( void );
 HYPRE_Int hypre_AMSDestroy ( void *solver );
 HYPRE_Int hypre_AMSSetDimension ( void *solver, HYPRE_Int dim );
@@ -384,6 +388,9 @@ HYPRE_Int HYPRE_BoomerAMGSolve ( HYPRE_Solver solver, HYPRE_ParCSRMatrix A, HYPR
                                  HYPRE_ParVector x );
 HYPRE_Int HYPRE_BoomerAMGSolveT ( HYPRE_Solver solver, HYPRE_ParCSRMatrix A, HYPRE_ParVector b,
                                   HYPRE_ParVector x );
+HYPRE_Int HYPRE_BoomerAMGTune ( HYPRE_Solver solver, HYPRE_ParCSRMatrix A, HYPRE_Real time_budget,
+                                HYPRE_Int num_solves, const char *filename );
+HYPRE_Int HYPRE_BoomerAMGReadTunedParams ( HYPRE_Solver solver, const char *filename );
 HYPRE_Int HYPRE_BoomerAMGSetRestriction ( HYPRE_Solver solver, HYPRE_Int restr_par );
 HYPRE_Int HYPRE_BoomerAMGSetIsTriangular ( HYPRE_Solver solver, HYPRE_Int is_triangular );
 HYPRE_Int HYPRE_BoomerAMGSetGMRESSwitchR ( HYPRE_Solver solver, HYPRE_Int gmres_switch );
@@ -399,6 +406,10 @@ HYPRE_Int HYPRE_BoomerAMGSetRedundant ( HYPRE_Solver solver, HYPRE_Int redundant
 HYPRE_Int HYPRE_BoomerAMGGetRedundant ( HYPRE_Solver solver, HYPRE_Int *redundant );
 HYPRE_Int HYPRE_BoomerAMGSetCoarsenCutFactor( HYPRE_Solver solver, HYPRE_Int coarsen_cut_factor );
 HYPRE_Int HYPRE_BoomerAMGGetCoarsenCutFactor( HYPRE_Solver solver, HYPRE_Int *coarsen_cut_factor );
+HYPRE_Int HYPRE_BoomerAMGSetCoarsenThreadBlocks( HYPRE_Solver solver,
+                                                 HYPRE_Int coarsen_thread_blocks );
+HYPRE_Int HYPRE_BoomerAMGGetCoarsenThreadBlocks( HYPRE_Solver solver,
+                                                 HYPRE_Int *coarsen_thread_blocks );
 HYPRE_Int HYPRE_BoomerAMGSetStrongThreshold ( HYPRE_Solver solver, HYPRE_Real strong_threshold );
 HYPRE_Int HYPRE_BoomerAMGGetStrongThreshold ( HYPRE_Solver solver, HYPRE_Real *strong_threshold );
 HYPRE_Int HYPRE_BoomerAMGSetStrongThresholdR ( HYPRE_Solver solver, HYPRE_Real strong_threshold );
@@ -433,6 +444,10 @@ HYPRE_Int HYPRE_BoomerAMGSetSetupType ( HYPRE_Solver solver, HYPRE_Int setup_typ
 HYPRE_Int HYPRE_BoomerAMGSetOldDefault ( HYPRE_Solver solver );
 HYPRE_Int HYPRE_BoomerAMGSetFCycle ( HYPRE_Solver solver, HYPRE_Int fcycle );
 HYPRE_Int HYPRE_BoomerAMGGetFCycle ( HYPRE_Solver solver, HYPRE_Int *fcycle );
+HYPRE_Int HYPRE_BoomerAMGSetKCycle ( HYPRE_Solver solver, HYPRE_Int kcycle );
+HYPRE_Int HYPRE_BoomerAMGGetKCycle ( HYPRE_Solver solver, HYPRE_Int *kcycle );
+HYPRE_Int HYPRE_BoomerAMGSetKCycleNumIter ( HYPRE_Solver solver, HYPRE_Int num_iter );
+HYPRE_Int HYPRE_BoomerAMGGetKCycleNumIter ( HYPRE_Solver solver, HYPRE_Int *num_iter );
 HYPRE_Int HYPRE_BoomerAMGSetCycleType ( HYPRE_Solver solver, HYPRE_Int cycle_type );
 HYPRE_Int HYPRE_BoomerAMGGetCycleType ( HYPRE_Solver solver, HYPRE_Int *cycle_type );
 HYPRE_Int HYPRE_BoomerAMGSetConvergeType ( HYPRE_Solver solver, HYPRE_Int type );
@@ -526,6 +541,7 @@ HYPRE_Int HYPRE_BoomerAMGSetKeepSameSign ( HYPRE_Solver solver, HYPRE_Int keep_s
 HYPRE_Int HYPRE_BoomerAMGSetDofFunc ( HYPRE_Solver solver, HYPRE_Int *dof_func );
 HYPRE_Int HYPRE_BoomerAMGSetNumPaths ( HYPRE_Solver solver, HYPRE_Int num_paths );
 HYPRE_Int HYPRE_BoomerAMGSetAggNumLevels ( HYPRE_Solver solver, HYPRE_Int agg_num_levels );
+HYPRE_Int HYPRE_BoomerAMGSetSmoothAggNumLevels ( HYPRE_Solver solver, HYPRE_Int sa_num_levels );
 HYPRE_Int HYPRE_BoomerAMGSetAggInterpType ( HYPRE_Solver solver, HYPRE_Int agg_interp_type );
 HYPRE_Int HYPRE_BoomerAMGSetAggTruncFactor ( HYPRE_Solver solver, HYPRE_Real agg_trunc_factor );
 HYPRE_Int HYPRE_BoomerAMGSetAddTruncFactor ( HYPRE_Solver solver, HYPRE_Real add_trunc_factor );
@@ -558,6 +574,7 @@ HYPRE_Int HYPRE_BoomerAMGSetChebyFraction ( HYPRE_Solver solver, HYPRE_Real rati
 HYPRE_Int HYPRE_BoomerAMGSetChebyEigEst ( HYPRE_Solver solver, HYPRE_Int eig_est );
 HYPRE_Int HYPRE_BoomerAMGSetChebyVariant ( HYPRE_Solver solver, HYPRE_Int variant );
 HYPRE_Int HYPRE_BoomerAMGSetChebyScale ( HYPRE_Solver solver, HYPRE_Int scale );
+HYPRE_Int HYPRE_BoomerAMGSetChebyMatPowers ( HYPRE_Solver solver, HYPRE_Int mat_powers );
 HYPRE_Int HYPRE_BoomerAMGSetInterpVectors ( HYPRE_Solver solver, HYPRE_Int num_vectors,
                                             HYPRE_ParVector *vectors );
 HYPRE_Int HYPRE_BoomerAMGSetInterpVecVariant ( HYPRE_Solver solver, HYPRE_Int num );
@@ -574,14 +591,21 @@ HYPRE_Int HYPRE_BoomerAMGGetMultAdditive ( HYPRE_Solver solver, HYPRE_Int *mult_
 HYPRE_Int HYPRE_BoomerAMGSetSimple ( HYPRE_Solver solver, HYPRE_Int simple );
 HYPRE_Int HYPRE_BoomerAMGGetSimple ( HYPRE_Solver solver, HYPRE_Int *simple );
 HYPRE_Int HYPRE_BoomerAMGSetAddLastLvl ( HYPRE_Solver solver, HYPRE_Int add_last_lvl );
+HYPRE_Int HYPRE_BoomerAMGSetAddComposite ( HYPRE_Solver solver, HYPRE_Int add_composite );
 HYPRE_Int HYPRE_BoomerAMGSetNonGalerkinTol ( HYPRE_Solver solver, HYPRE_Real nongalerkin_tol );
 HYPRE_Int HYPRE_BoomerAMGSetLevelNonGalerkinTol ( HYPRE_Solver solver, HYPRE_Real nongalerkin_tol,
                                                   HYPRE_Int level );
 HYPRE_Int HYPRE_BoomerAMGSetNonGalerkTol ( HYPRE_Solver solver, HYPRE_Int nongalerk_num_tol,
                                            HYPRE_Real *nongalerk_tol );
+HYPRE_Int HYPRE_BoomerAMGSetNonGalerkinRAP ( HYPRE_Solver solver, HYPRE_Int nongalerkin_rap );
 HYPRE_Int HYPRE_BoomerAMGSetRAP2 ( HYPRE_Solver solver, HYPRE_Int rap2 );
 HYPRE_Int HYPRE_BoomerAMGSetModuleRAP2 ( HYPRE_Solver solver, HYPRE_Int mod_rap2 );
 HYPRE_Int HYPRE_BoomerAMGSetKeepTranspose ( HYPRE_Solver solver, HYPRE_Int keepTranspose );
+HYPRE_Int HYPRE_BoomerAMGSetCompressIndices ( HYPRE_Solver solver, HYPRE_Int compress_indices );
+HYPRE_Int HYPRE_BoomerAMGSetPersistentComm ( HYPRE_Solver solver, HYPRE_Int persistent_comm );
+HYPRE_Int HYPRE_BoomerAMGSetMergedLayout ( HYPRE_Solver solver, HYPRE_Int merged_layout );
+HYPRE_Int HYPRE_BoomerAMGSetSetupTimings ( HYPRE_Solver solver, HYPRE_Int setup_timings );
+HYPRE_Int HYPRE_BoomerAMGSetMemoryBudget ( HYPRE_Solver solver, HYPRE_Real memory_budget );
 #ifdef HYPRE_USING_DSUPERLU
 HYPRE_Int HYPRE_BoomerAMGSetDSLUThreshold ( HYPRE_Solver solver, HYPRE_Int slu_threshold );
 #endif
@@ -839,6 +863,15 @@ HYPRE_Int HYPRE_ParCSRMultiVectorPrint ( void *x_, const char *fileName );
 void *HYPRE_ParCSRMultiVectorRead ( MPI_Comm comm, void *ii_, const char *fileName );
 HYPRE_Int aux_maskCount ( HYPRE_Int n, HYPRE_Int *mask );
 void aux_indexFromMask ( HYPRE_Int n, HYPRE_Int *mask, HYPRE_Int *index );
+void hypre_ParCSRMultiVectorByMultiVector ( void *x_, void *y_, HYPRE_Int xyGHeight,
+                                            HYPRE_Int xyHeight, HYPRE_Int xyWidth,
+                                            HYPRE_Complex *xyVal );
+void hypre_ParCSRMultiVectorByMultiVectorDiag ( void *x_, void *y_, HYPRE_Int *mask, HYPRE_Int n,
+                                                HYPRE_Complex *diag );
+void hypre_ParCSRMultiVectorByMatrix ( void *x_, HYPRE_Int rGHeight, HYPRE_Int rHeight,
+                                       HYPRE_Int rWidth, HYPRE_Complex *rVal, void *y_ );
+void hypre_ParCSRMultiVectorXapy ( void *x_, HYPRE_Int rGHeight, HYPRE_Int rHeight,
+                                   HYPRE_Int rWidth, HYPRE_Complex *rVal, void *y_ );
 HYPRE_Int HYPRE_TempParCSRSetupInterpreter ( mv_InterfaceInterpreter *i );
 HYPRE_Int HYPRE_ParCSRSetupInterpreter ( mv_InterfaceInterpreter *i );
 HYPRE_Int HYPRE_ParCSRSetupMatvec ( HYPRE_MatvecFunctions *mv );
@@ -993,6 +1026,7 @@ HYPRE_Int HYPRE_SchwarzSetDofFunc ( HYPRE_Solver solver, HYPRE_Int *dof_func );
 HYPRE_Int hypre_BoomerAMGAdditiveCycle ( void *amg_vdata );
 HYPRE_Int hypre_CreateLambda ( void *amg_vdata );
 HYPRE_Int hypre_CreateDinv ( void *amg_vdata );
+HYPRE_Int hypre_CreateAddComposite ( void *amg_vdata );
 
 /* par_amg.c */
 void *hypre_BoomerAMGCreate ( void );
@@ -1010,6 +1044,8 @@ HYPRE_Int hypre_BoomerAMGSetSeqThreshold ( void *data, HYPRE_Int seq_threshold )
 HYPRE_Int hypre_BoomerAMGGetSeqThreshold ( void *data, HYPRE_Int *seq_threshold );
 HYPRE_Int hypre_BoomerAMGSetCoarsenCutFactor( void *data, HYPRE_Int coarsen_cut_factor );
 HYPRE_Int hypre_BoomerAMGGetCoarsenCutFactor( void *data, HYPRE_Int *coarsen_cut_factor );
+HYPRE_Int hypre_BoomerAMGSetCoarsenThreadBlocks( void *data, HYPRE_Int coarsen_thread_blocks );
+HYPRE_Int hypre_BoomerAMGGetCoarsenThreadBlocks( void *data, HYPRE_Int *coarsen_thread_blocks );
 HYPRE_Int hypre_BoomerAMGSetRedundant ( void *data, HYPRE_Int redundant );
 HYPRE_Int hypre_BoomerAMGGetRedundant ( void *data, HYPRE_Int *redundant );
 HYPRE_Int hypre_BoomerAMGSetStrongThreshold ( void *data, HYPRE_Real strong_threshold );
@@ -1044,6 +1080,10 @@ HYPRE_Int hypre_BoomerAMGSetSetupType ( void *data, HYPRE_Int setup_type );
 HYPRE_Int hypre_BoomerAMGGetSetupType ( void *data, HYPRE_Int *setup_type );
 HYPRE_Int hypre_BoomerAMGSetFCycle ( void *data, HYPRE_Int fcycle );
 HYPRE_Int hypre_BoomerAMGGetFCycle ( void *data, HYPRE_Int *fcycle );
+HYPRE_Int hypre_BoomerAMGSetKCycle ( void *data, HYPRE_Int kcycle );
+HYPRE_Int hypre_BoomerAMGGetKCycle ( void *data, HYPRE_Int *kcycle );
+HYPRE_Int hypre_BoomerAMGSetKCycleNumIter ( void *data, HYPRE_Int num_iter );
+HYPRE_Int hypre_BoomerAMGGetKCycleNumIter ( void *data, HYPRE_Int *num_iter );
 HYPRE_Int hypre_BoomerAMGSetCycleType ( void *data, HYPRE_Int cycle_type );
 HYPRE_Int hypre_BoomerAMGGetCycleType ( void *data, HYPRE_Int *cycle_type );
 HYPRE_Int hypre_BoomerAMGSetConvergeType ( void *data, HYPRE_Int type );
@@ -1105,6 +1145,7 @@ HYPRE_Int hypre_BoomerAMGSetNodalDiag ( void *data, HYPRE_Int nodal );
 HYPRE_Int hypre_BoomerAMGSetKeepSameSign ( void *data, HYPRE_Int keep_same_sign );
 HYPRE_Int hypre_BoomerAMGSetNumPaths ( void *data, HYPRE_Int num_paths );
 HYPRE_Int hypre_BoomerAMGSetAggNumLevels ( void *data, HYPRE_Int agg_num_levels );
+HYPRE_Int hypre_BoomerAMGSetSmoothAggNumLevels ( void *data, HYPRE_Int sa_num_levels );
 HYPRE_Int hypre_BoomerAMGSetAggInterpType ( void *data, HYPRE_Int agg_interp_type );
 HYPRE_Int hypre_BoomerAMGSetAggPMaxElmts ( void *data, HYPRE_Int agg_P_max_elmts );
 HYPRE_Int hypre_BoomerAMGSetMultAddPMaxElmts ( void *data, HYPRE_Int add_P_max_elmts );
@@ -1166,6 +1207,7 @@ HYPRE_Int hypre_BoomerAMGSetChebyFraction ( void *data, HYPRE_Real ratio );
 HYPRE_Int hypre_BoomerAMGSetChebyEigEst ( void *data, HYPRE_Int eig_est );
 HYPRE_Int hypre_BoomerAMGSetChebyVariant ( void *data, HYPRE_Int variant );
 HYPRE_Int hypre_BoomerAMGSetChebyScale ( void *data, HYPRE_Int scale );
+HYPRE_Int hypre_BoomerAMGSetChebyMatPowers ( void *data, HYPRE_Int mat_powers );
 HYPRE_Int hypre_BoomerAMGSetInterpVectors ( void *solver, HYPRE_Int num_vectors,
                                             hypre_ParVector **interp_vectors );
 HYPRE_Int hypre_BoomerAMGSetInterpVecVariant ( void *solver, HYPRE_Int var );
@@ -1181,14 +1223,22 @@ HYPRE_Int hypre_BoomerAMGGetMultAdditive ( void *data, HYPRE_Int *mult_additive
 HYPRE_Int hypre_BoomerAMGSetSimple ( void *data, HYPRE_Int simple );
 HYPRE_Int hypre_BoomerAMGGetSimple ( void *data, HYPRE_Int *simple );
 HYPRE_Int hypre_BoomerAMGSetAddLastLvl ( void *data, HYPRE_Int add_last_lvl );
+HYPRE_Int hypre_BoomerAMGSetAddComposite ( void *data, HYPRE_Int add_composite );
+HYPRE_Int hypre_BoomerAMGGetAddComposite ( void *data, HYPRE_Int *add_composite );
 HYPRE_Int hypre_BoomerAMGSetNonGalerkinTol ( void *data, HYPRE_Real nongalerkin_tol );
 HYPRE_Int hypre_BoomerAMGSetLevelNonGalerkinTol ( void *data, HYPRE_Real nongalerkin_tol,
                                                   HYPRE_Int level );
 HYPRE_Int hypre_BoomerAMGSetNonGalerkTol ( void *data, HYPRE_Int nongalerk_num_tol,
                                            HYPRE_Real *nongalerk_tol );
+HYPRE_Int hypre_BoomerAMGSetNonGalerkinRAP ( void *data, HYPRE_Int nongalerkin_rap );
 HYPRE_Int hypre_BoomerAMGSetRAP2 ( void *data, HYPRE_Int rap2 );
 HYPRE_Int hypre_BoomerAMGSetModuleRAP2 ( void *data, HYPRE_Int mod_rap2 );
 HYPRE_Int hypre_BoomerAMGSetKeepTranspose ( void *data, HYPRE_Int keepTranspose );
+HYPRE_Int hypre_BoomerAMGSetCompressIndices ( void *data, HYPRE_Int compress_indices );
+HYPRE_Int hypre_BoomerAMGSetPersistentComm ( void *data, HYPRE_Int persistent_comm );
+HYPRE_Int hypre_BoomerAMGSetMergedLayout ( void *data, HYPRE_Int merged_layout );
+HYPRE_Int hypre_BoomerAMGSetSetupTimings ( void *data, HYPRE_Int setup_timings );
+HYPRE_Int hypre_BoomerAMGSetMemoryBudget ( void *data, HYPRE_Real memory_budget );
 #ifdef HYPRE_USING_DSUPERLU
 HYPRE_Int hypre_BoomerAMGSetDSLUThreshold ( void *data, HYPRE_Int slu_threshold );
 #endif
@@ -1216,6 +1266,11 @@ HYPRE_Int hypre_BoomerAMGRelaxT ( hypre_ParCSRMatrix *A, hypre_ParVector *f, HYP
                                   HYPRE_Int relax_type, HYPRE_Int relax_points, HYPRE_Real relax_weight, hypre_ParVector *u,
                                   hypre_ParVector *Vtemp );
 
+/* par_amg_tune.c */
+HYPRE_Int hypre_BoomerAMGTune ( void *amg_vdata, hypre_ParCSRMatrix *A, HYPRE_Real time_budget,
+                                HYPRE_Int num_solves, const char *filename );
+HYPRE_Int hypre_BoomerAMGReadTunedParams ( void *amg_vdata, const char *filename );
+
 /* par_cgc_coarsen.c */
 HYPRE_Int hypre_BoomerAMGCoarsenCGCb ( hypre_ParCSRMatrix *S, hypre_ParCSRMatrix *A,
                                        HYPRE_Int measure_type, HYPRE_Int coarsen_type, HYPRE_Int cgc_its, HYPRE_Int debug_flag,
@@ -1251,6 +1306,9 @@ HYPRE_Int hypre_ParCSRRelax_Cheby_SolveHost ( hypre_ParCSRMatrix *A, hypre_ParVe
                                               HYPRE_Real *ds_data, HYPRE_Real *coefs, HYPRE_Int order, HYPRE_Int scale, HYPRE_Int variant,
                                               hypre_ParVector *u, hypre_ParVector *v, hypre_ParVector *r, hypre_ParVector *orig_u_vec,
                                               hypre_ParVector *tmp_vec);
+HYPRE_Int hypre_ParCSRRelax_Cheby_SolvePowers ( hypre_ParCSRMatrix *A, hypre_ParVector *f,
+                                                HYPRE_Real *ds_data, HYPRE_Real *coefs, HYPRE_Int order, HYPRE_Int scale,
+                                                hypre_ParCSRMatPowers *mp, hypre_ParVector *u, hypre_ParVector *v, hypre_ParVector *r );
 
 /* par_cheby_device.c */
 HYPRE_Int hypre_ParCSRRelax_Cheby_SolveDevice ( hypre_ParCSRMatrix *A, hypre_ParVector *f,
@@ -1262,14 +1320,14 @@ HYPRE_Int hypre_ParCSRRelax_Cheby_SolveDevice ( hypre_ParCSRMatrix *A, hypre_Par
 HYPRE_Int hypre_BoomerAMGCoarsen ( hypre_ParCSRMatrix *S, hypre_ParCSRMatrix *A, HYPRE_Int CF_init,
                                    HYPRE_Int debug_flag, hypre_IntArray **CF_marker_ptr );
 HYPRE_Int hypre_BoomerAMGCoarsenRuge ( hypre_ParCSRMatrix *S, hypre_ParCSRMatrix *A,
-                                       HYPRE_Int measure_type, HYPRE_Int coarsen_type, HYPRE_Int cut_factor, HYPRE_Int debug_flag,
-                                       hypre_IntArray **CF_marker_ptr );
+                                       HYPRE_Int measure_type, HYPRE_Int coarsen_type, HYPRE_Int cut_factor, HYPRE_Int thread_blocks,
+                                       HYPRE_Int debug_flag, hypre_IntArray **CF_marker_ptr );
 HYPRE_Int hypre_BoomerAMGCoarsenFalgout ( hypre_ParCSRMatrix *S, hypre_ParCSRMatrix *A,
-                                          HYPRE_Int measure_type, HYPRE_Int cut_factor, HYPRE_Int debug_flag,
-                                          hypre_IntArray **CF_marker_ptr );
+                                          HYPRE_Int measure_type, HYPRE_Int cut_factor, HYPRE_Int thread_blocks,
+                                          HYPRE_Int debug_flag, hypre_IntArray **CF_marker_ptr );
 HYPRE_Int hypre_BoomerAMGCoarsenHMIS ( hypre_ParCSRMatrix *S, hypre_ParCSRMatrix *A,
-                                       HYPRE_Int measure_type, HYPRE_Int cut_factor, HYPRE_Int debug_flag,
-                                       hypre_IntArray **CF_marker_ptr );
+                                       HYPRE_Int measure_type, HYPRE_Int cut_factor, HYPRE_Int thread_blocks,
+                                       HYPRE_Int debug_flag, hypre_IntArray **CF_marker_ptr );
 HYPRE_Int hypre_BoomerAMGCoarsenPMIS ( hypre_ParCSRMatrix *S, hypre_ParCSRMatrix *A,
                                        HYPRE_Int CF_init, HYPRE_Int debug_flag, hypre_IntArray **CF_marker_ptr );
 HYPRE_Int hypre_BoomerAMGCoarsenPMISHost ( hypre_ParCSRMatrix *S, hypre_ParCSRMatrix *A,
@@ -1338,6 +1396,8 @@ HYPRE_Int hypre_BoomerAMGCoarsenCR ( hypre_ParCSRMatrix *A, hypre_IntArray **CF_
 /* par_cycle.c */
 HYPRE_Int hypre_BoomerAMGCycle ( void *amg_vdata, hypre_ParVector **F_array,
                                  hypre_ParVector **U_array );
+HYPRE_Int hypre_BoomerAMGKCycleSetup ( void *amg_vdata );
+HYPRE_Int hypre_BoomerAMGKCycleDestroy ( void *amg_vdata, HYPRE_Int num_levels );
 
 /* par_difconv.c */
 HYPRE_ParCSRMatrix GenerateDifConv ( MPI_Comm comm, HYPRE_BigInt nx, HYPRE_BigInt ny,
@@ -1400,6 +1460,10 @@ HYPRE_Int hypre_BoomerAMGInterpTruncation ( hypre_ParCSRMatrix *P, HYPRE_Real tr
                                             HYPRE_Int max_elmts );
 HYPRE_Int hypre_BoomerAMGInterpTruncationDevice( hypre_ParCSRMatrix *P, HYPRE_Real trunc_factor,
                                                  HYPRE_Int max_elmts );
+HYPRE_Int hypre_BoomerAMGInterpTruncateRow ( HYPRE_Real trunc_factor, HYPRE_Int max_elmts,
+                                            HYPRE_Int num_cols_diag, HYPRE_Int *diag_j, HYPRE_Real *diag_data, HYPRE_Int *diag_size,
+                                            HYPRE_Int *offd_j, HYPRE_Real *offd_data, HYPRE_Int *offd_size, HYPRE_Int *aux_j,
+                                            HYPRE_Real *aux_data );
 
 HYPRE_Int hypre_BoomerAMGBuildInterpModUnk ( hypre_ParCSRMatrix *A, HYPRE_Int *CF_marker,
                                              hypre_ParCSRMatrix *S, HYPRE_BigInt *num_cpts_global, HYPRE_Int num_functions, HYPRE_Int *dof_func,
@@ -1620,6 +1684,9 @@ HYPRE_Int hypre_NonGalerkinIJBufferEmpty ( HYPRE_IJMatrix B, HYPRE_Int ijbuf_siz
 hypre_ParCSRMatrix * hypre_NonGalerkinSparsityPattern(hypre_ParCSRMatrix *R_IAP,
                                                       hypre_ParCSRMatrix *RAP, HYPRE_Int * CF_marker, HYPRE_Real droptol, HYPRE_Int sym_collapse,
                                                       HYPRE_Int collapse_beta );
+HYPRE_Int hypre_NonGalerkinDropRow ( HYPRE_Real droptol, HYPRE_Int row_marker,
+                                     HYPRE_Int *keep_marker, HYPRE_Int num_cols_diag, HYPRE_Int *diag_j, HYPRE_Real *diag_data,
+                                     HYPRE_Int *diag_size_ptr, HYPRE_Int *offd_j, HYPRE_Real *offd_data, HYPRE_Int *offd_size_ptr );
 HYPRE_Int hypre_BoomerAMGBuildNonGalerkinCoarseOperator( hypre_ParCSRMatrix **RAP_ptr,
                                                          hypre_ParCSRMatrix *AP, HYPRE_Real strong_threshold, HYPRE_Real max_row_sum,
                                                          HYPRE_Int num_functions, HYPRE_Int * dof_func_value, HYPRE_Int * CF_marker, HYPRE_Real droptol,
@@ -1630,6 +1697,9 @@ HYPRE_Int hypre_BoomerAMGBuildCoarseOperator ( hypre_ParCSRMatrix *RT, hypre_Par
                                                hypre_ParCSRMatrix *P, hypre_ParCSRMatrix **RAP_ptr );
 HYPRE_Int hypre_BoomerAMGBuildCoarseOperatorKT ( hypre_ParCSRMatrix *RT, hypre_ParCSRMatrix *A,
                                                  hypre_ParCSRMatrix *P, HYPRE_Int keepTranspose, hypre_ParCSRMatrix **RAP_ptr );
+HYPRE_Int hypre_BoomerAMGBuildCoarseOperatorDropKT ( hypre_ParCSRMatrix *RT, hypre_ParCSRMatrix *A,
+                                                     hypre_ParCSRMatrix *P, HYPRE_Int keepTranspose, HYPRE_Int *CF_marker, HYPRE_Real droptol,
+                                                     hypre_ParCSRMatrix **RAP_ptr );
 
 /* par_rap_communication.c */
 HYPRE_Int hypre_GetCommPkgRTFromCommPkgA ( hypre_ParCSRMatrix *RT, hypre_ParCSRMatrix *A,
@@ -1803,9 +1873,25 @@ HYPRE_Int hypre_SchwarzSetScale ( void *data, HYPRE_Real *scale );
 HYPRE_Int hypre_SchwarzReScale ( void *data, HYPRE_Int size, HYPRE_Real value );
 HYPRE_Int hypre_SchwarzSetDofFunc ( void *data, HYPRE_Int *dof_func );
 
+/* par_smooth_agg.c */
+HYPRE_Int hypre_BoomerAMGSmoothAggNullspace ( hypre_ParCSRMatrix *A, HYPRE_Int num_functions,
+                                              HYPRE_Int *dof_func, HYPRE_Int num_interp_vectors, hypre_ParVector **interp_vectors,
+                                              HYPRE_Int *num_vectors_ptr, HYPRE_Real **B_ptr );
+HYPRE_Int hypre_BoomerAMGCoarsenAggregates ( hypre_ParCSRMatrix *S, HYPRE_Int num_functions,
+                                             HYPRE_Int num_vectors, hypre_IntArray *CF_marker, hypre_IntArray **aggregates_ptr,
+                                             HYPRE_Int *num_aggregates_ptr );
+HYPRE_Int hypre_BoomerAMGSmoothAggCoarseParms ( MPI_Comm comm, HYPRE_Int num_aggregates,
+                                                HYPRE_Int num_vectors, hypre_IntArray **coarse_dof_func_ptr,
+                                                HYPRE_BigInt *coarse_pnts_global );
+HYPRE_Int hypre_BoomerAMGBuildSmoothAggInterp ( hypre_ParCSRMatrix *A, hypre_IntArray *aggregates,
+                                                HYPRE_Int num_functions, HYPRE_Int num_vectors, HYPRE_Real *B,
+                                                HYPRE_BigInt *coarse_pnts_global, HYPRE_Real trunc_factor, HYPRE_Int max_elmts,
+                                                HYPRE_Real **B_coarse_ptr, hypre_ParCSRMatrix **P_ptr );
+
 /* par_stats.c */
 HYPRE_Int hypre_BoomerAMGSetupStats ( void *amg_vdata, hypre_ParCSRMatrix *A );
 HYPRE_Int hypre_BoomerAMGWriteSolverParams ( void *data );
+HYPRE_Real hypre_BoomerAMGMatrixMemory ( hypre_ParCSRMatrix *A );
 
 /* par_strength.c */
 HYPRE_Int hypre_BoomerAMGCreateS ( hypre_ParCSRMatrix *A, HYPRE_Real strength_threshold,
@@ -1923,6 +2009,8 @@ HYPRE_Int hypre_ParKrylovMatvecT ( void *matvec_data, HYPRE_Complex alpha, void
                                    HYPRE_Complex beta, void *y );
 HYPRE_Int hypre_ParKrylovMatvecDestroy ( void *matvec_data );
 HYPRE_Real hypre_ParKrylovInnerProd ( void *x, void *y );
+HYPRE_Int hypre_ParKrylovResidualInnerProd ( void *matvec_data, void *A, void *x, void *b,
+                                            void *r, void *z, HYPRE_Real *rr, HYPRE_Real *rz );
 HYPRE_Int hypre_ParKrylovMassInnerProd ( void *x, void **y, HYPRE_Int k, HYPRE_Int unroll,
                                          void *result );
 HYPRE_Int hypre_ParKrylovMassDotpTwo ( void *x, void *y, void **z, HYPRE_Int k, HYPRE_Int unroll,
@@ -1933,6 +2021,9 @@ HYPRE_Int hypre_ParKrylovCopyVector ( void *x, void *y );
 HYPRE_Int hypre_ParKrylovClearVector ( void *x );
 HYPRE_Int hypre_ParKrylovScaleVector ( HYPRE_Complex alpha, void *x );
 HYPRE_Int hypre_ParKrylovAxpy ( HYPRE_Complex alpha, void *x, void *y );
+HYPRE_Int hypre_ParKrylovAxpby ( HYPRE_Complex alpha, void *x, HYPRE_Complex beta, void *y );
+HYPRE_Int hypre_ParKrylovUpdateSolutionResidual ( HYPRE_Complex alpha, void *p, void *s, void *x,
+                                                 void *r, HYPRE_Real *r_prod );
 HYPRE_Int hypre_ParKrylovCommInfo ( void *A, HYPRE_Int *my_id, HYPRE_Int *num_procs );
 HYPRE_Int hypre_ParKrylovIdentitySetup ( void *vdata, void *A, void *b, void *x );
 HYPRE_Int hypre_ParKrylovIdentity ( void *vdata, void *A, void *b, void *x );
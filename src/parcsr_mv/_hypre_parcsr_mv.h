@@ -28,7 +28,6 @@ extern "C" {
  *   Structure containing information for doing communications
  *--------------------------------------------------------------------------*/
 
-#ifdef HYPRE_USING_PERSISTENT_COMM
 typedef enum CommPkgJobType
 {
    HYPRE_COMM_PKG_JOB_COMPLEX = 0,
@@ -39,16 +38,19 @@ typedef enum CommPkgJobType
    HYPRE_COMM_PKG_JOB_BIGINT_TRANSPOSE,
    NUM_OF_COMM_PKG_JOB_TYPE,
 } CommPkgJobType;
-#endif
 
 /*--------------------------------------------------------------------------
  * hypre_ParCSRCommHandle, hypre_ParCSRPersistentCommHandle
  *--------------------------------------------------------------------------*/
 struct _hypre_ParCSRCommPkg;
+struct _hypre_ParCSRNodeCommPkg;
+struct _hypre_ParCSRShmCommPkg;
 
 typedef struct
 {
    struct _hypre_ParCSRCommPkg *comm_pkg;
+   struct _hypre_ParCSRNodeCommPkg *node_pkg; /* set if the exchange is node-aware */
+   struct _hypre_ParCSRShmCommPkg  *shm_pkg;  /* set if on-node data is shared */
    HYPRE_MemoryLocation  send_memory_location;
    HYPRE_MemoryLocation  recv_memory_location;
    HYPRE_Int             num_send_bytes;
@@ -63,6 +65,111 @@ typedef struct
 
 typedef hypre_ParCSRCommHandle hypre_ParCSRPersistentCommHandle;
 
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRNodeCommPkg:
+ *   Node-aware (hierarchical) schedule for the job 1 exchange of a comm_pkg.
+ *   Ranks are split into groups (the ranks of a node, or part of it), each
+ *   with a leader.  Messages within a group are sent directly.  Data going
+ *   to other groups is gathered by the leader, sent as one message per pair
+ *   of groups, and scattered by the receiving leader.
+ *--------------------------------------------------------------------------*/
+
+typedef struct _hypre_ParCSRNodeCommPkg
+{
+   MPI_Comm                 comm;               /* duplicate of the comm_pkg comm (not owned) */
+   HYPRE_Int                leader;             /* rank of the group leader */
+   HYPRE_Int                send_size;          /* length of send_data */
+   HYPRE_Int                recv_size;          /* length of recv_data */
+
+   /* direct messages within the group (indices into the comm_pkg lists) */
+   HYPRE_Int                num_local_sends;
+   HYPRE_Int               *local_sends;
+   HYPRE_Int                num_local_recvs;
+   HYPRE_Int               *local_recvs;
+
+   /* entries of send_data for other groups, sent to the leader */
+   HYPRE_Int                gather_size;
+   HYPRE_Int               *gather_elmts;
+   HYPRE_Complex           *gather_buf;
+
+   /* positions in recv_data of the entries sent by the leader */
+   HYPRE_Int                scatter_size;
+   HYPRE_Int               *scatter_elmts;
+   HYPRE_Complex           *scatter_buf;
+
+   /* leader only: gather from the group into group_buf */
+   HYPRE_Int                num_group_recvs;
+   HYPRE_Int               *group_recv_procs;
+   HYPRE_Int               *group_recv_starts;
+   HYPRE_Complex           *group_buf;
+
+   /* leader only: exchange between leaders, from group_buf into leader_buf */
+   HYPRE_Int                num_leader_sends;
+   HYPRE_Int               *leader_send_procs;
+   HYPRE_Int               *leader_send_starts;
+   HYPRE_Int               *leader_send_elmts;
+   HYPRE_Complex           *leader_send_buf;
+   HYPRE_Int                num_leader_recvs;
+   HYPRE_Int               *leader_recv_procs;
+   HYPRE_Int               *leader_recv_starts;
+   HYPRE_Complex           *leader_buf;
+
+   /* leader only: scatter from leader_buf to the group */
+   HYPRE_Int                num_group_sends;
+   HYPRE_Int               *group_send_procs;
+   HYPRE_Int               *group_send_starts;
+   HYPRE_Int               *group_send_elmts;
+   HYPRE_Complex           *group_send_buf;
+
+   /* exchange in progress */
+   hypre_ParCSRCommHandle  *comm_handle;
+   HYPRE_Complex           *recv_data;
+   HYPRE_Int                num_requests;
+   hypre_MPI_Request       *requests;
+} hypre_ParCSRNodeCommPkg;
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRShmCommPkg:
+ *   Shared-memory schedule for the job 1 exchange of a comm_pkg.  Every rank
+ *   owns a piece of its segment of an MPI-3 shared-memory window, laid out
+ *   like its send buffer; the windows are shared by all comm_pkgs of the
+ *   node (see hypre_NodeCommShmAlloc).  Ranks of the same node load the values they need directly from
+ *   the segment of the sender after a zero-byte notification, and return a
+ *   zero-byte acknowledgement once done.  Other ranks exchange messages.
+ *--------------------------------------------------------------------------*/
+
+typedef struct _hypre_ParCSRShmCommPkg
+{
+   MPI_Comm                 node_comm;          /* ranks sharing the window (not owned) */
+   hypre_ShmWindow         *shm_win;            /* pooled window (not owned) */
+   HYPRE_Complex           *send_buf;           /* piece of the segment of this rank */
+   HYPRE_Int                send_size;          /* length of send_data */
+   HYPRE_Int                recv_size;          /* length of recv_data */
+
+   /* messages to/from other nodes (indices into the comm_pkg lists) */
+   HYPRE_Int                num_remote_sends;
+   HYPRE_Int               *remote_sends;
+   HYPRE_Int                num_remote_recvs;
+   HYPRE_Int               *remote_recvs;
+
+   /* on-node neighbors (indices into the comm_pkg lists, node_comm ranks) */
+   HYPRE_Int                num_shm_sends;
+   HYPRE_Int               *shm_sends;
+   HYPRE_Int               *shm_send_procs;
+   HYPRE_Int                num_shm_recvs;
+   HYPRE_Int               *shm_recv_procs;
+   HYPRE_Int               *shm_recv_starts;    /* position in recv_data */
+   HYPRE_Int               *shm_recv_sizes;
+   HYPRE_Complex          **shm_recv_data;      /* location in the sender segment */
+
+   /* exchange in progress */
+   hypre_ParCSRCommHandle  *comm_handle;
+   HYPRE_Complex           *recv_data;
+   HYPRE_Int                num_requests;
+   hypre_MPI_Request       *requests;
+   hypre_MPI_Request       *ack_requests;       /* segment may be overwritten when done */
+} hypre_ParCSRShmCommPkg;
+
 typedef struct _hypre_ParCSRCommPkg
 {
    MPI_Comm                          comm;
@@ -78,9 +185,12 @@ typedef struct _hypre_ParCSRCommPkg
    /* remote communication information */
    hypre_MPI_Datatype               *send_mpi_types;
    hypre_MPI_Datatype               *recv_mpi_types;
-#ifdef HYPRE_USING_PERSISTENT_COMM
+   /* node-aware schedule for job 1, NULL if not used */
+   hypre_ParCSRNodeCommPkg          *node_pkg;
+   /* shared-memory schedule for job 1, NULL if not used */
+   hypre_ParCSRShmCommPkg           *shm_pkg;
+   /* persistent requests and buffers per job type, NULL if not created */
    hypre_ParCSRPersistentCommHandle *persistent_comm_handles[NUM_OF_COMM_PKG_JOB_TYPE];
-#endif
 #if defined(HYPRE_USING_GPU)
    /* temporary memory for matvec. cudaMalloc is expensive. alloc once and reuse */
    HYPRE_Complex                    *tmp_data;
@@ -113,6 +223,8 @@ typedef struct _hypre_ParCSRCommPkg
 #define hypre_ParCSRCommPkgSendMPIType(comm_pkg,i)       (comm_pkg -> send_mpi_types[i])
 #define hypre_ParCSRCommPkgRecvMPITypes(comm_pkg)        (comm_pkg -> recv_mpi_types)
 #define hypre_ParCSRCommPkgRecvMPIType(comm_pkg,i)       (comm_pkg -> recv_mpi_types[i])
+#define hypre_ParCSRCommPkgNodePkg(comm_pkg)             (comm_pkg -> node_pkg)
+#define hypre_ParCSRCommPkgShmPkg(comm_pkg)              (comm_pkg -> shm_pkg)
 
 #if defined(HYPRE_USING_GPU)
 #define hypre_ParCSRCommPkgTmpData(comm_pkg)             ((comm_pkg) -> tmp_data)
@@ -148,6 +260,8 @@ hypre_ParCSRCommPkgCopySendMapElmtsToDevice(hypre_ParCSRCommPkg *comm_pkg)
  *--------------------------------------------------------------------------*/
 
 #define hypre_ParCSRCommHandleCommPkg(comm_handle)                (comm_handle -> comm_pkg)
+#define hypre_ParCSRCommHandleNodePkg(comm_handle)                (comm_handle -> node_pkg)
+#define hypre_ParCSRCommHandleShmPkg(comm_handle)                 (comm_handle -> shm_pkg)
 #define hypre_ParCSRCommHandleSendMemoryLocation(comm_handle)     (comm_handle -> send_memory_location)
 #define hypre_ParCSRCommHandleRecvMemoryLocation(comm_handle)     (comm_handle -> recv_memory_location)
 #define hypre_ParCSRCommHandleNumSendBytes(comm_handle)           (comm_handle -> num_send_bytes)
@@ -160,6 +274,74 @@ hypre_ParCSRCommPkgCopySendMapElmtsToDevice(hypre_ParCSRCommPkg *comm_pkg)
 #define hypre_ParCSRCommHandleRequests(comm_handle)               (comm_handle -> requests)
 #define hypre_ParCSRCommHandleRequest(comm_handle, i)             (comm_handle -> requests[i])
 
+/*--------------------------------------------------------------------------
+ * Accessor macros: hypre_ParCSRNodeCommPkg
+ *--------------------------------------------------------------------------*/
+
+#define hypre_ParCSRNodeCommPkgComm(node_pkg)                     (node_pkg -> comm)
+#define hypre_ParCSRNodeCommPkgLeader(node_pkg)                   (node_pkg -> leader)
+#define hypre_ParCSRNodeCommPkgSendSize(node_pkg)                 (node_pkg -> send_size)
+#define hypre_ParCSRNodeCommPkgRecvSize(node_pkg)                 (node_pkg -> recv_size)
+#define hypre_ParCSRNodeCommPkgNumLocalSends(node_pkg)            (node_pkg -> num_local_sends)
+#define hypre_ParCSRNodeCommPkgLocalSends(node_pkg)               (node_pkg -> local_sends)
+#define hypre_ParCSRNodeCommPkgNumLocalRecvs(node_pkg)            (node_pkg -> num_local_recvs)
+#define hypre_ParCSRNodeCommPkgLocalRecvs(node_pkg)               (node_pkg -> local_recvs)
+#define hypre_ParCSRNodeCommPkgGatherSize(node_pkg)               (node_pkg -> gather_size)
+#define hypre_ParCSRNodeCommPkgGatherElmts(node_pkg)              (node_pkg -> gather_elmts)
+#define hypre_ParCSRNodeCommPkgGatherBuf(node_pkg)                (node_pkg -> gather_buf)
+#define hypre_ParCSRNodeCommPkgScatterSize(node_pkg)              (node_pkg -> scatter_size)
+#define hypre_ParCSRNodeCommPkgScatterElmts(node_pkg)             (node_pkg -> scatter_elmts)
+#define hypre_ParCSRNodeCommPkgScatterBuf(node_pkg)               (node_pkg -> scatter_buf)
+#define hypre_ParCSRNodeCommPkgNumGroupRecvs(node_pkg)            (node_pkg -> num_group_recvs)
+#define hypre_ParCSRNodeCommPkgGroupRecvProcs(node_pkg)           (node_pkg -> group_recv_procs)
+#define hypre_ParCSRNodeCommPkgGroupRecvStarts(node_pkg)          (node_pkg -> group_recv_starts)
+#define hypre_ParCSRNodeCommPkgGroupBuf(node_pkg)                 (node_pkg -> group_buf)
+#define hypre_ParCSRNodeCommPkgNumLeaderSends(node_pkg)           (node_pkg -> num_leader_sends)
+#define hypre_ParCSRNodeCommPkgLeaderSendProcs(node_pkg)          (node_pkg -> leader_send_procs)
+#define hypre_ParCSRNodeCommPkgLeaderSendStarts(node_pkg)         (node_pkg -> leader_send_starts)
+#define hypre_ParCSRNodeCommPkgLeaderSendElmts(node_pkg)          (node_pkg -> leader_send_elmts)
+#define hypre_ParCSRNodeCommPkgLeaderSendBuf(node_pkg)            (node_pkg -> leader_send_buf)
+#define hypre_ParCSRNodeCommPkgNumLeaderRecvs(node_pkg)           (node_pkg -> num_leader_recvs)
+#define hypre_ParCSRNodeCommPkgLeaderRecvProcs(node_pkg)          (node_pkg -> leader_recv_procs)
+#define hypre_ParCSRNodeCommPkgLeaderRecvStarts(node_pkg)         (node_pkg -> leader_recv_starts)
+#define hypre_ParCSRNodeCommPkgLeaderBuf(node_pkg)                (node_pkg -> leader_buf)
+#define hypre_ParCSRNodeCommPkgNumGroupSends(node_pkg)            (node_pkg -> num_group_sends)
+#define hypre_ParCSRNodeCommPkgGroupSendProcs(node_pkg)           (node_pkg -> group_send_procs)
+#define hypre_ParCSRNodeCommPkgGroupSendStarts(node_pkg)          (node_pkg -> group_send_starts)
+#define hypre_ParCSRNodeCommPkgGroupSendElmts(node_pkg)           (node_pkg -> group_send_elmts)
+#define hypre_ParCSRNodeCommPkgGroupSendBuf(node_pkg)             (node_pkg -> group_send_buf)
+#define hypre_ParCSRNodeCommPkgCommHandle(node_pkg)               (node_pkg -> comm_handle)
+#define hypre_ParCSRNodeCommPkgRecvData(node_pkg)                 (node_pkg -> recv_data)
+#define hypre_ParCSRNodeCommPkgNumRequests(node_pkg)              (node_pkg -> num_requests)
+#define hypre_ParCSRNodeCommPkgRequests(node_pkg)                 (node_pkg -> requests)
+
+/*--------------------------------------------------------------------------
+ * Accessor macros: hypre_ParCSRShmCommPkg
+ *--------------------------------------------------------------------------*/
+
+#define hypre_ParCSRShmCommPkgNodeComm(shm_pkg)                   (shm_pkg -> node_comm)
+#define hypre_ParCSRShmCommPkgShmWin(shm_pkg)                     (shm_pkg -> shm_win)
+#define hypre_ParCSRShmCommPkgSendBuf(shm_pkg)                    (shm_pkg -> send_buf)
+#define hypre_ParCSRShmCommPkgSendSize(shm_pkg)                   (shm_pkg -> send_size)
+#define hypre_ParCSRShmCommPkgRecvSize(shm_pkg)                   (shm_pkg -> recv_size)
+#define hypre_ParCSRShmCommPkgNumRemoteSends(shm_pkg)             (shm_pkg -> num_remote_sends)
+#define hypre_ParCSRShmCommPkgRemoteSends(shm_pkg)                (shm_pkg -> remote_sends)
+#define hypre_ParCSRShmCommPkgNumRemoteRecvs(shm_pkg)             (shm_pkg -> num_remote_recvs)
+#define hypre_ParCSRShmCommPkgRemoteRecvs(shm_pkg)                (shm_pkg -> remote_recvs)
+#define hypre_ParCSRShmCommPkgNumShmSends(shm_pkg)                (shm_pkg -> num_shm_sends)
+#define hypre_ParCSRShmCommPkgShmSends(shm_pkg)                   (shm_pkg -> shm_sends)
+#define hypre_ParCSRShmCommPkgShmSendProcs(shm_pkg)               (shm_pkg -> shm_send_procs)
+#define hypre_ParCSRShmCommPkgNumShmRecvs(shm_pkg)                (shm_pkg -> num_shm_recvs)
+#define hypre_ParCSRShmCommPkgShmRecvProcs(shm_pkg)               (shm_pkg -> shm_recv_procs)
+#define hypre_ParCSRShmCommPkgShmRecvStarts(shm_pkg)              (shm_pkg -> shm_recv_starts)
+#define hypre_ParCSRShmCommPkgShmRecvSizes(shm_pkg)               (shm_pkg -> shm_recv_sizes)
+#define hypre_ParCSRShmCommPkgShmRecvData(shm_pkg)                (shm_pkg -> shm_recv_data)
+#define hypre_ParCSRShmCommPkgCommHandle(shm_pkg)                 (shm_pkg -> comm_handle)
+#define hypre_ParCSRShmCommPkgRecvData(shm_pkg)                   (shm_pkg -> recv_data)
+#define hypre_ParCSRShmCommPkgNumRequests(shm_pkg)                (shm_pkg -> num_requests)
+#define hypre_ParCSRShmCommPkgRequests(shm_pkg)                   (shm_pkg -> requests)
+#define hypre_ParCSRShmCommPkgAckRequests(shm_pkg)                (shm_pkg -> ack_requests)
+
 #endif /* HYPRE_PAR_CSR_COMMUNICATION_HEADER */
 /******************************************************************************
  * Copyright (c) 1998 Lawrence Livermore National Security, LLC and other
@@ -356,6 +538,13 @@ typedef struct hypre_ParCSRMatrix_struct
    HYPRE_Complex        *bdiaginv;
    hypre_ParCSRCommPkg  *bdiaginv_comm_pkg;
 
+   /* Optional merged copy of diag and offd used by the host solve-phase
+      kernels: row i holds its diag entries in [i[i], merged_split[i]) and
+      its offd entries (with offd column indices) in [merged_split[i], i[i+1]).
+      See hypre_ParCSRMatrixCreateMergedLayout. */
+   hypre_CSRMatrix      *merged;
+   HYPRE_Int            *merged_split;
+
 #if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_HIP) || defined(HYPRE_USING_SYCL)
    /* these two arrays are reserveed for SoC matrices on GPUs to help build interpolation */
    HYPRE_Int            *soc_diag_j;
@@ -395,6 +584,8 @@ typedef struct hypre_ParCSRMatrix_struct
 #define hypre_ParCSRMatrixAssumedPartition(matrix)       ((matrix) -> assumed_partition)
 #define hypre_ParCSRMatrixOwnsAssumedPartition(matrix)   ((matrix) -> owns_assumed_partition)
 #define hypre_ParCSRMatrixProcOrdering(matrix)           ((matrix) -> proc_ordering)
+#define hypre_ParCSRMatrixMerged(matrix)                 ((matrix) -> merged)
+#define hypre_ParCSRMatrixMergedSplit(matrix)            ((matrix) -> merged_split)
 #if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_HIP) || defined(HYPRE_USING_SYCL)
 #define hypre_ParCSRMatrixSocDiagJ(matrix)               ((matrix) -> soc_diag_j)
 #define hypre_ParCSRMatrixSocOffdJ(matrix)               ((matrix) -> soc_offd_j)
@@ -437,6 +628,51 @@ hypre_ParCSRMatrixMemoryLocation(hypre_ParCSRMatrix *matrix)
    return HYPRE_MEMORY_UNDEFINED;
 }
 
+/*--------------------------------------------------------------------------
+ * Matrix powers kernel
+ *
+ * Ghost region of depth num_powers around the local rows of A. Ghost
+ * columns are numbered after the local ones, ordered by their distance to
+ * the local rows: ghosts at distance d are [ghost_starts[d-1], ghost_starts[d]).
+ * Distance one ghosts are in the order of col_map_offd, so that the offd
+ * block of A indexes them directly. ghost_rows holds the rows of A at the
+ * ghosts of distance 1 ... num_powers-1 with columns in this numbering.
+ *--------------------------------------------------------------------------*/
+
+typedef struct
+{
+   hypre_ParCSRMatrix     *A;
+   HYPRE_Int               num_powers;
+   HYPRE_Int               num_ghosts;
+   HYPRE_Int              *ghost_starts;
+   hypre_CSRMatrix        *ghost_rows;
+
+   /* all ghosts are received with one exchange in ascending global order,
+      recv_perm maps the receive buffer to the ghost numbering */
+   hypre_ParCSRCommPkg    *comm_pkg;
+   HYPRE_Int              *recv_perm;
+
+   /* optional symmetric diagonal scaling on local rows and ghosts */
+   HYPRE_Real             *scale;
+
+   HYPRE_Complex          *send_buf;
+   HYPRE_Complex          *recv_buf;
+   HYPRE_Complex          *work;
+
+} hypre_ParCSRMatPowers;
+
+#define hypre_ParCSRMatPowersMatrix(mp)                  ((mp) -> A)
+#define hypre_ParCSRMatPowersNumPowers(mp)               ((mp) -> num_powers)
+#define hypre_ParCSRMatPowersNumGhosts(mp)               ((mp) -> num_ghosts)
+#define hypre_ParCSRMatPowersGhostStarts(mp)             ((mp) -> ghost_starts)
+#define hypre_ParCSRMatPowersGhostRows(mp)               ((mp) -> ghost_rows)
+#define hypre_ParCSRMatPowersCommPkg(mp)                 ((mp) -> comm_pkg)
+#define hypre_ParCSRMatPowersRecvPerm(mp)                ((mp) -> recv_perm)
+#define hypre_ParCSRMatPowersScale(mp)                   ((mp) -> scale)
+#define hypre_ParCSRMatPowersSendBuf(mp)                 ((mp) -> send_buf)
+#define hypre_ParCSRMatPowersRecvBuf(mp)                 ((mp) -> recv_buf)
+#define hypre_ParCSRMatPowersWork(mp)                    ((mp) -> work)
+
 /*--------------------------------------------------------------------------
  * Parallel CSR Boolean Matrix
  *--------------------------------------------------------------------------*/
@@ -949,6 +1185,9 @@ void hypre_ParCSRMatrixExtractBExt_Arrays_Overlap ( HYPRE_Int **pB_ext_i, HYPRE_
                                                     HYPRE_BigInt *col_map_offd, HYPRE_Real *diag_data, HYPRE_Real *offd_data,
                                                     hypre_ParCSRCommHandle **comm_handle_idx, hypre_ParCSRCommHandle **comm_handle_data,
                                                     HYPRE_Int *CF_marker, HYPRE_Int *CF_marker_offd, HYPRE_Int skip_fine, HYPRE_Int skip_same_sign );
+HYPRE_Int hypre_ParCSRMatrixExtractBExtInit ( hypre_ParCSRMatrix *B, hypre_ParCSRMatrix *A,
+                                             HYPRE_Int want_data, void **request_ptr );
+hypre_CSRMatrix *hypre_ParCSRMatrixExtractBExtWait ( void *request );
 hypre_CSRMatrix *hypre_ParCSRMatrixExtractBExt ( hypre_ParCSRMatrix *B, hypre_ParCSRMatrix *A,
                                                  HYPRE_Int data );
 hypre_CSRMatrix *hypre_ParCSRMatrixExtractBExt_Overlap ( hypre_ParCSRMatrix *B,
@@ -1011,17 +1250,18 @@ HYPRE_Int hypre_ParCSRMatrixDropSmallEntriesDevice( hypre_ParCSRMatrix *A, HYPRE
 
 HYPRE_Int hypre_ParCSRCommPkgCreateMatrixE( hypre_ParCSRCommPkg *comm_pkg, HYPRE_Int local_ncols );
 
-#ifdef HYPRE_USING_PERSISTENT_COMM
 hypre_ParCSRPersistentCommHandle* hypre_ParCSRPersistentCommHandleCreate(HYPRE_Int job,
                                                                          hypre_ParCSRCommPkg *comm_pkg);
 hypre_ParCSRPersistentCommHandle* hypre_ParCSRCommPkgGetPersistentCommHandle(HYPRE_Int job,
                                                                              hypre_ParCSRCommPkg *comm_pkg);
+hypre_ParCSRPersistentCommHandle* hypre_ParCSRCommPkgFindPersistentCommHandle(HYPRE_Int job,
+                                                                              hypre_ParCSRCommPkg *comm_pkg);
+HYPRE_Int hypre_ParCSRCommPkgDestroyPersistentCommHandles( hypre_ParCSRCommPkg *comm_pkg );
 void hypre_ParCSRPersistentCommHandleDestroy(hypre_ParCSRPersistentCommHandle *comm_handle);
 void hypre_ParCSRPersistentCommHandleStart(hypre_ParCSRPersistentCommHandle *comm_handle,
                                            HYPRE_MemoryLocation send_memory_location, void *send_data);
 void hypre_ParCSRPersistentCommHandleWait(hypre_ParCSRPersistentCommHandle *comm_handle,
                                           HYPRE_MemoryLocation recv_memory_location, void *recv_data);
-#endif
 
 HYPRE_Int hypre_ParcsrGetExternalRowsInit( hypre_ParCSRMatrix *A, HYPRE_Int indices_len,
                                            HYPRE_BigInt *indices, hypre_ParCSRCommPkg *comm_pkg, HYPRE_Int want_data, void **request_ptr);
@@ -1112,6 +1352,17 @@ hypre_ParCSRMatrix* hypre_ParCSRMatrixClone_v2 ( hypre_ParCSRMatrix *A, HYPRE_In
 HYPRE_Int hypre_ParCSRMatrixMigrate(hypre_ParCSRMatrix *A, HYPRE_MemoryLocation memory_location);
 HYPRE_Int hypre_ParCSRMatrixSetConstantValues( hypre_ParCSRMatrix *A, HYPRE_Complex value );
 void hypre_ParCSRMatrixCopyColMapOffdToDevice(hypre_ParCSRMatrix *A);
+HYPRE_Int hypre_ParCSRMatrixCreateMergedLayout( hypre_ParCSRMatrix *A );
+HYPRE_Int hypre_ParCSRMatrixDestroyMergedLayout( hypre_ParCSRMatrix *A );
+
+/* par_csr_matpowers.c */
+hypre_ParCSRMatPowers *hypre_ParCSRMatPowersCreate ( hypre_ParCSRMatrix *A, HYPRE_Int num_powers,
+                                                     HYPRE_Real *scale );
+HYPRE_Int hypre_ParCSRMatPowersDestroy ( hypre_ParCSRMatPowers *mp );
+HYPRE_Int hypre_ParCSRMatPowersApply ( hypre_ParCSRMatPowers *mp, hypre_ParVector *x,
+                                       HYPRE_Int num_powers, hypre_ParVector **y );
+HYPRE_Int hypre_ParCSRMatPowersApplyPoly ( hypre_ParCSRMatPowers *mp, hypre_ParVector *x,
+                                           HYPRE_Int degree, HYPRE_Real *coefs, hypre_ParVector *y );
 
 /* par_csr_matvec.c */
 // y = alpha*A*x + beta*b
@@ -1131,10 +1382,40 @@ HYPRE_Int hypre_ParCSRMatrixMatvecTDevice ( HYPRE_Complex alpha, hypre_ParCSRMat
                                             hypre_ParVector *y );
 HYPRE_Int hypre_ParCSRMatrixMatvecT_unpack( hypre_ParCSRCommPkg *comm_pkg, HYPRE_Int num_cols,
                                             HYPRE_Complex *recv_data, HYPRE_Complex *local_data );
+// y = alpha*A*x + beta*b, with <y,y> and <y,z> in a single reduction
+HYPRE_Int hypre_ParCSRMatrixMatvecOutOfPlaceInnerProd ( HYPRE_Complex alpha, hypre_ParCSRMatrix *A,
+                                                        hypre_ParVector *x, HYPRE_Complex beta,
+                                                        hypre_ParVector *b, hypre_ParVector *y,
+                                                        hypre_ParVector *z, HYPRE_Real *yy,
+                                                        HYPRE_Real *yz );
+// r = b - A*x, with <r,r> and <r,z> in a single reduction
+HYPRE_Int hypre_ParCSRMatrixResidualInnerProd ( hypre_ParCSRMatrix *A, hypre_ParVector *x,
+                                               hypre_ParVector *b, hypre_ParVector *r,
+                                               hypre_ParVector *z, HYPRE_Real *rr,
+                                               HYPRE_Real *rz );
 HYPRE_Int hypre_ParCSRMatrixMatvec_FF ( HYPRE_Complex alpha, hypre_ParCSRMatrix *A,
                                         hypre_ParVector *x, HYPRE_Complex beta, hypre_ParVector *y,
                                         HYPRE_Int *CF_marker, HYPRE_Int fpt );
 
+/* par_csr_node_comm.c */
+HYPRE_Int hypre_ParCSRNodeCommPkgCreate ( hypre_ParCSRCommPkg *comm_pkg, HYPRE_Int group_size );
+HYPRE_Int hypre_ParCSRNodeCommPkgDestroy ( hypre_ParCSRNodeCommPkg *node_pkg );
+HYPRE_Int hypre_ParCSRNodeCommStart ( hypre_ParCSRNodeCommPkg *node_pkg,
+                                      hypre_ParCSRCommPkg *comm_pkg,
+                                      hypre_ParCSRCommHandle *comm_handle,
+                                      HYPRE_Complex *send_data, HYPRE_Complex *recv_data );
+HYPRE_Int hypre_ParCSRNodeCommFinish ( hypre_ParCSRNodeCommPkg *node_pkg );
+
+/* par_csr_shm_comm.c */
+HYPRE_Int hypre_ParCSRShmCommPkgCreate ( hypre_ParCSRCommPkg *comm_pkg );
+HYPRE_Int hypre_ParCSRShmCommPkgDestroy ( hypre_ParCSRShmCommPkg *shm_pkg );
+HYPRE_Complex *hypre_ParCSRShmCommSendBuffer ( hypre_ParCSRCommPkg *comm_pkg );
+HYPRE_Int hypre_ParCSRShmCommStart ( hypre_ParCSRShmCommPkg *shm_pkg,
+                                     hypre_ParCSRCommPkg *comm_pkg,
+                                     hypre_ParCSRCommHandle *comm_handle,
+                                     HYPRE_Complex *send_data, HYPRE_Complex *recv_data );
+HYPRE_Int hypre_ParCSRShmCommFinish ( hypre_ParCSRShmCommPkg *shm_pkg );
+
 /* par_csr_triplemat.c */
 HYPRE_Int hypre_ParCSRTMatMatPartialAddDevice( hypre_ParCSRCommPkg *comm_pkg_A,
                                                HYPRE_Int num_cols_A, HYPRE_Int num_cols_B, HYPRE_BigInt first_col_diag_B,
@@ -1192,9 +1473,14 @@ hypre_ParVector *hypre_ParVectorCloneDeep_v2( hypre_ParVector *x,
 HYPRE_Int hypre_ParVectorMigrate(hypre_ParVector *x, HYPRE_MemoryLocation memory_location);
 HYPRE_Int hypre_ParVectorScale ( HYPRE_Complex alpha, hypre_ParVector *y );
 HYPRE_Int hypre_ParVectorAxpy ( HYPRE_Complex alpha, hypre_ParVector *x, hypre_ParVector *y );
+HYPRE_Int hypre_ParVectorAxpby ( HYPRE_Complex alpha, hypre_ParVector *x, HYPRE_Complex beta,
+                                hypre_ParVector *y );
 HYPRE_Int hypre_ParVectorMassAxpy ( HYPRE_Complex *alpha, hypre_ParVector **x, hypre_ParVector *y,
                                     HYPRE_Int k, HYPRE_Int unroll);
 HYPRE_Real hypre_ParVectorInnerProd ( hypre_ParVector *x, hypre_ParVector *y );
+HYPRE_Int hypre_ParVectorUpdateSolutionResidual ( HYPRE_Complex alpha, hypre_ParVector *p,
+                                                 hypre_ParVector *s, hypre_ParVector *x,
+                                                 hypre_ParVector *r, HYPRE_Real *r_prod );
 HYPRE_Int hypre_ParVectorMassInnerProd ( hypre_ParVector *x, hypre_ParVector **y, HYPRE_Int k,
                                          HYPRE_Int unroll, HYPRE_Real *prod );
 HYPRE_Int hypre_ParVectorMassDotpTwo ( hypre_ParVector *x, hypre_ParVector *y, hypre_ParVector **z,
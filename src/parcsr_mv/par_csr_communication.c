@@ -9,7 +9,6 @@
 
 /*==========================================================================*/
 
-#ifdef HYPRE_USING_PERSISTENT_COMM
 static CommPkgJobType getJobTypeOf(HYPRE_Int job)
 {
    CommPkgJobType job_type = HYPRE_COMM_PKG_JOB_COMPLEX;
@@ -255,6 +254,43 @@ hypre_ParCSRCommPkgGetPersistentCommHandle( HYPRE_Int job, hypre_ParCSRCommPkg *
    return comm_pkg->persistent_comm_handles[type];
 }
 
+/*------------------------------------------------------------------
+ * hypre_ParCSRCommPkgFindPersistentCommHandle
+ *
+ * Returns the persistent handle of comm_pkg for job if one has been
+ * created (e.g., by hypre_BoomerAMGSetup), and NULL otherwise, in which
+ * case the caller falls back to hypre_ParCSRCommHandleCreate.  With
+ * HYPRE_USING_PERSISTENT_COMM, the handle is created on first use.
+ *------------------------------------------------------------------*/
+
+hypre_ParCSRPersistentCommHandle*
+hypre_ParCSRCommPkgFindPersistentCommHandle( HYPRE_Int job, hypre_ParCSRCommPkg *comm_pkg )
+{
+#if defined(HYPRE_USING_PERSISTENT_COMM)
+   return hypre_ParCSRCommPkgGetPersistentCommHandle(job, comm_pkg);
+#else
+   return comm_pkg->persistent_comm_handles[getJobTypeOf(job)];
+#endif
+}
+
+/*------------------------------------------------------------------
+ * hypre_ParCSRCommPkgDestroyPersistentCommHandles
+ *------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRCommPkgDestroyPersistentCommHandles( hypre_ParCSRCommPkg *comm_pkg )
+{
+   HYPRE_Int i;
+
+   for (i = HYPRE_COMM_PKG_JOB_COMPLEX; i < NUM_OF_COMM_PKG_JOB_TYPE; i++)
+   {
+      hypre_ParCSRPersistentCommHandleDestroy(comm_pkg->persistent_comm_handles[i]);
+      comm_pkg->persistent_comm_handles[i] = NULL;
+   }
+
+   return hypre_error_flag;
+}
+
 /*------------------------------------------------------------------
  * hypre_ParCSRPersistentCommHandleDestroy
  *------------------------------------------------------------------*/
@@ -262,8 +298,14 @@ hypre_ParCSRCommPkgGetPersistentCommHandle( HYPRE_Int job, hypre_ParCSRCommPkg *
 void
 hypre_ParCSRPersistentCommHandleDestroy( hypre_ParCSRPersistentCommHandle *comm_handle )
 {
+   HYPRE_Int i;
+
    if (comm_handle)
    {
+      for (i = 0; i < hypre_ParCSRCommHandleNumRequests(comm_handle); i++)
+      {
+         hypre_MPI_Request_free(&hypre_ParCSRCommHandleRequests(comm_handle)[i]);
+      }
       hypre_TFree(hypre_ParCSRCommHandleSendDataBuffer(comm_handle), HYPRE_MEMORY_HOST);
       hypre_TFree(hypre_ParCSRCommHandleRecvDataBuffer(comm_handle), HYPRE_MEMORY_HOST);
       hypre_TFree(comm_handle->requests, HYPRE_MEMORY_HOST);
@@ -286,12 +328,16 @@ hypre_ParCSRPersistentCommHandleStart( hypre_ParCSRPersistentCommHandle *comm_ha
 
    if (hypre_ParCSRCommHandleNumRequests(comm_handle) > 0)
    {
-      hypre_TMemcpy( hypre_ParCSRCommHandleSendDataBuffer(comm_handle),
-                     send_data,
-                     char,
-                     hypre_ParCSRCommHandleNumSendBytes(comm_handle),
-                     HYPRE_MEMORY_HOST,
-                     send_memory_location );
+      /* no copy if the data was packed into the send buffer */
+      if (send_data != hypre_ParCSRCommHandleSendDataBuffer(comm_handle))
+      {
+         hypre_TMemcpy( hypre_ParCSRCommHandleSendDataBuffer(comm_handle),
+                        send_data,
+                        char,
+                        hypre_ParCSRCommHandleNumSendBytes(comm_handle),
+                        HYPRE_MEMORY_HOST,
+                        send_memory_location );
+      }
 
       HYPRE_Int ret = hypre_MPI_Startall(hypre_ParCSRCommHandleNumRequests(comm_handle),
                                          hypre_ParCSRCommHandleRequests(comm_handle));
@@ -300,6 +346,9 @@ hypre_ParCSRPersistentCommHandleStart( hypre_ParCSRPersistentCommHandle *comm_ha
          hypre_error_w_msg(HYPRE_ERROR_GENERIC, "MPI error\n");
          /*hypre_printf("MPI error %d in %s (%s, line %u)\n", ret, __FUNCTION__, __FILE__, __LINE__);*/
       }
+
+      hypre_CommProgressAdd(hypre_ParCSRCommHandleNumRequests(comm_handle),
+                            hypre_ParCSRCommHandleRequests(comm_handle));
    }
 }
 
@@ -317,6 +366,8 @@ hypre_ParCSRPersistentCommHandleWait( hypre_ParCSRPersistentCommHandle *comm_han
 
    if (hypre_ParCSRCommHandleNumRequests(comm_handle) > 0)
    {
+      hypre_CommProgressRemove(hypre_ParCSRCommHandleRequests(comm_handle));
+
       HYPRE_Int ret = hypre_MPI_Waitall(hypre_ParCSRCommHandleNumRequests(comm_handle),
                                         hypre_ParCSRCommHandleRequests(comm_handle),
                                         hypre_MPI_STATUSES_IGNORE);
@@ -326,15 +377,18 @@ hypre_ParCSRPersistentCommHandleWait( hypre_ParCSRPersistentCommHandle *comm_han
          /*hypre_printf("MPI error %d in %s (%s, line %u)\n", ret, __FUNCTION__, __FILE__, __LINE__);*/
       }
 
-      hypre_TMemcpy(recv_data,
-                    hypre_ParCSRCommHandleRecvDataBuffer(comm_handle),
-                    char,
-                    hypre_ParCSRCommHandleNumRecvBytes(comm_handle),
-                    recv_memory_location,
-                    HYPRE_MEMORY_HOST);
+      /* no copy if the data is read from the receive buffer */
+      if (recv_data != hypre_ParCSRCommHandleRecvDataBuffer(comm_handle))
+      {
+         hypre_TMemcpy(recv_data,
+                       hypre_ParCSRCommHandleRecvDataBuffer(comm_handle),
+                       char,
+                       hypre_ParCSRCommHandleNumRecvBytes(comm_handle),
+                       recv_memory_location,
+                       HYPRE_MEMORY_HOST);
+      }
    }
 }
-#endif // HYPRE_USING_PERSISTENT_COMM
 
 /*------------------------------------------------------------------
  * hypre_ParCSRCommHandleCreate
@@ -371,6 +425,8 @@ hypre_ParCSRCommHandleCreate_v2 ( HYPRE_Int            job,
    MPI_Comm                   comm      = hypre_ParCSRCommPkgComm(comm_pkg);
    HYPRE_Int                  num_send_bytes = 0;
    HYPRE_Int                  num_recv_bytes = 0;
+   hypre_ParCSRNodeCommPkg   *node_pkg = NULL;
+   hypre_ParCSRShmCommPkg    *shm_pkg = NULL;
    hypre_ParCSRCommHandle    *comm_handle;
    HYPRE_Int                  num_requests;
    hypre_MPI_Request         *requests;
@@ -477,7 +533,46 @@ hypre_ParCSRCommHandleCreate_v2 ( HYPRE_Int            job,
    recv_data = recv_data_in;
 #endif
 
-   num_requests = num_sends + num_recvs;
+   /* Use the shared-memory or node-aware schedule, if any */
+   if (job == 1)
+   {
+      shm_pkg  = hypre_ParCSRCommPkgShmPkg(comm_pkg);
+      node_pkg = hypre_ParCSRCommPkgNodePkg(comm_pkg);
+   }
+   /* The messages of these schedules do not match those of the flat
+      exchange, so a schedule must be used by all ranks or by none.  An
+      exchange still running on it is therefore completed first rather than
+      bypassed, and the schedule is dropped on all ranks whenever the sizes
+      of comm_pkg change (see hypre_ParCSRCommPkgUpdateVecStarts). */
+   if (shm_pkg)
+   {
+      hypre_assert(hypre_ParCSRShmCommPkgSendSize(shm_pkg) ==
+                   hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends));
+      hypre_assert(hypre_ParCSRShmCommPkgRecvSize(shm_pkg) ==
+                   hypre_ParCSRCommPkgRecvVecStart(comm_pkg, num_recvs));
+
+      if (hypre_ParCSRShmCommPkgCommHandle(shm_pkg))
+      {
+         hypre_CommProgressRemove(hypre_ParCSRShmCommPkgRequests(shm_pkg));
+         hypre_ParCSRShmCommFinish(shm_pkg);
+      }
+      node_pkg = NULL;
+   }
+   if (node_pkg)
+   {
+      hypre_assert(hypre_ParCSRNodeCommPkgSendSize(node_pkg) ==
+                   hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends));
+      hypre_assert(hypre_ParCSRNodeCommPkgRecvSize(node_pkg) ==
+                   hypre_ParCSRCommPkgRecvVecStart(comm_pkg, num_recvs));
+
+      if (hypre_ParCSRNodeCommPkgCommHandle(node_pkg))
+      {
+         hypre_CommProgressRemove(hypre_ParCSRNodeCommPkgRequests(node_pkg));
+         hypre_ParCSRNodeCommFinish(node_pkg);
+      }
+   }
+
+   num_requests = (node_pkg || shm_pkg) ? 0 : num_sends + num_recvs;
    requests = hypre_CTAlloc(hypre_MPI_Request, num_requests, HYPRE_MEMORY_HOST);
 
    hypre_MPI_Comm_size(comm, &num_procs);
@@ -490,6 +585,12 @@ hypre_ParCSRCommHandleCreate_v2 ( HYPRE_Int            job,
       {
          HYPRE_Complex *d_send_data = (HYPRE_Complex *) send_data;
          HYPRE_Complex *d_recv_data = (HYPRE_Complex *) recv_data;
+         if (node_pkg || shm_pkg)
+         {
+            /* requests are kept in node_pkg or shm_pkg, see
+               hypre_ParCSRNodeCommStart and hypre_ParCSRShmCommStart */
+            break;
+         }
          for (i = 0; i < num_recvs; i++)
          {
             ip = hypre_ParCSRCommPkgRecvProc(comm_pkg, i);
@@ -636,6 +737,27 @@ hypre_ParCSRCommHandleCreate_v2 ( HYPRE_Int            job,
    hypre_ParCSRCommHandleRecvDataBuffer(comm_handle)     = recv_data;
    hypre_ParCSRCommHandleNumRequests(comm_handle)        = num_requests;
    hypre_ParCSRCommHandleRequests(comm_handle)           = requests;
+   hypre_ParCSRCommHandleNodePkg(comm_handle)            = node_pkg;
+   hypre_ParCSRCommHandleShmPkg(comm_handle)             = shm_pkg;
+
+   if (node_pkg)
+   {
+      hypre_ParCSRNodeCommStart(node_pkg, comm_pkg, comm_handle,
+                                (HYPRE_Complex *) send_data, (HYPRE_Complex *) recv_data);
+      hypre_CommProgressAdd(hypre_ParCSRNodeCommPkgNumRequests(node_pkg),
+                            hypre_ParCSRNodeCommPkgRequests(node_pkg));
+   }
+   else if (shm_pkg)
+   {
+      hypre_ParCSRShmCommStart(shm_pkg, comm_pkg, comm_handle,
+                               (HYPRE_Complex *) send_data, (HYPRE_Complex *) recv_data);
+      hypre_CommProgressAdd(hypre_ParCSRShmCommPkgNumRequests(shm_pkg),
+                            hypre_ParCSRShmCommPkgRequests(shm_pkg));
+   }
+   else
+   {
+      hypre_CommProgressAdd(num_requests, requests);
+   }
 
 #if defined(HYPRE_USING_NVTX)
    hypre_GpuProfilingPopRange();
@@ -660,6 +782,33 @@ hypre_ParCSRCommHandleDestroy( hypre_ParCSRCommHandle *comm_handle )
    hypre_GpuProfilingPushRange("hypre_ParCSRCommHandleDestroy");
 #endif
 
+   if (hypre_ParCSRCommHandleNodePkg(comm_handle))
+   {
+      hypre_ParCSRNodeCommPkg *node_pkg = hypre_ParCSRCommHandleNodePkg(comm_handle);
+
+      /* unless a later exchange on the schedule has already completed it */
+      if (hypre_ParCSRNodeCommPkgCommHandle(node_pkg) == comm_handle)
+      {
+         hypre_CommProgressRemove(hypre_ParCSRNodeCommPkgRequests(node_pkg));
+         hypre_ParCSRNodeCommFinish(node_pkg);
+      }
+   }
+   else if (hypre_ParCSRCommHandleShmPkg(comm_handle))
+   {
+      hypre_ParCSRShmCommPkg *shm_pkg = hypre_ParCSRCommHandleShmPkg(comm_handle);
+
+      /* unless a later exchange on the schedule has already completed it */
+      if (hypre_ParCSRShmCommPkgCommHandle(shm_pkg) == comm_handle)
+      {
+         hypre_CommProgressRemove(hypre_ParCSRShmCommPkgRequests(shm_pkg));
+         hypre_ParCSRShmCommFinish(shm_pkg);
+      }
+   }
+   else
+   {
+      hypre_CommProgressRemove(hypre_ParCSRCommHandleRequests(comm_handle));
+   }
+
    if (hypre_ParCSRCommHandleNumRequests(comm_handle))
    {
       hypre_MPI_Status *status0;
@@ -1022,6 +1171,7 @@ hypre_ParCSRCommPkgCreateAndFill( MPI_Comm              comm,
                                   hypre_ParCSRCommPkg **comm_pkg_ptr )
 {
    hypre_ParCSRCommPkg  *comm_pkg;
+   HYPRE_Int             i;
 
    /* Allocate memory for comm_pkg if needed */
    if (*comm_pkg_ptr == NULL)
@@ -1036,19 +1186,17 @@ hypre_ParCSRCommPkgCreateAndFill( MPI_Comm              comm,
    /* Set default info */
    hypre_ParCSRCommPkgNumComponents(comm_pkg)      = 1;
    hypre_ParCSRCommPkgDeviceSendMapElmts(comm_pkg) = NULL;
+   hypre_ParCSRCommPkgNodePkg(comm_pkg)            = NULL;
+   hypre_ParCSRCommPkgShmPkg(comm_pkg)             = NULL;
 #if defined(HYPRE_USING_GPU)
    hypre_ParCSRCommPkgTmpData(comm_pkg)            = NULL;
    hypre_ParCSRCommPkgBufData(comm_pkg)            = NULL;
    hypre_ParCSRCommPkgMatrixE(comm_pkg)            = NULL;
 #endif
-#if defined(HYPRE_USING_PERSISTENT_COMM)
-   HYPRE_Int i;
-
    for (i = 0; i < NUM_OF_COMM_PKG_JOB_TYPE; i++)
    {
       comm_pkg->persistent_comm_handles[i] = NULL;
    }
-#endif
 
    /* Set input info */
    hypre_ParCSRCommPkgComm(comm_pkg)          = comm;
@@ -1102,6 +1250,14 @@ hypre_ParCSRCommPkgUpdateVecStarts( hypre_ParCSRCommPkg *comm_pkg,
                                          send_map_starts[num_sends] * num_vectors,
                                          HYPRE_MEMORY_HOST);
 
+      /* The node-aware and shared-memory schedules and the persistent
+         buffers are built for the old sizes */
+      hypre_ParCSRNodeCommPkgDestroy(hypre_ParCSRCommPkgNodePkg(comm_pkg));
+      hypre_ParCSRCommPkgNodePkg(comm_pkg) = NULL;
+      hypre_ParCSRShmCommPkgDestroy(hypre_ParCSRCommPkgShmPkg(comm_pkg));
+      hypre_ParCSRCommPkgShmPkg(comm_pkg) = NULL;
+      hypre_ParCSRCommPkgDestroyPersistentCommHandles(comm_pkg);
+
       /* Update send_maps_elmts */
       if (num_vectors > num_components)
       {
@@ -1215,6 +1371,19 @@ hypre_MatvecCommPkgCreate ( hypre_ParCSRMatrix *A )
                                    apart,
                                    comm_pkg );
 
+   /* Shared-memory or node-aware schedule for matvecs and relaxations */
+#ifndef HYPRE_WITH_GPU_AWARE_MPI
+   /* both schedules pack and unpack on the host */
+   if (hypre_HandleSharedMemComm(hypre_handle()))
+   {
+      hypre_ParCSRShmCommPkgCreate(comm_pkg);
+   }
+   else if (hypre_HandleNodeAwareComm(hypre_handle()))
+   {
+      hypre_ParCSRNodeCommPkgCreate(comm_pkg, hypre_HandleNodeAwareComm(hypre_handle()));
+   }
+#endif
+
    HYPRE_ANNOTATE_FUNC_END;
 
    return hypre_error_flag;
@@ -1227,16 +1396,9 @@ hypre_MatvecCommPkgCreate ( hypre_ParCSRMatrix *A )
 HYPRE_Int
 hypre_MatvecCommPkgDestroy( hypre_ParCSRCommPkg *comm_pkg )
 {
-#ifdef HYPRE_USING_PERSISTENT_COMM
-   HYPRE_Int i;
-   for (i = HYPRE_COMM_PKG_JOB_COMPLEX; i < NUM_OF_COMM_PKG_JOB_TYPE; ++i)
-   {
-      if (comm_pkg->persistent_comm_handles[i])
-      {
-         hypre_ParCSRPersistentCommHandleDestroy(comm_pkg->persistent_comm_handles[i]);
-      }
-   }
-#endif
+   hypre_ParCSRCommPkgDestroyPersistentCommHandles(comm_pkg);
+   hypre_ParCSRNodeCommPkgDestroy(hypre_ParCSRCommPkgNodePkg(comm_pkg));
+   hypre_ParCSRShmCommPkgDestroy(hypre_ParCSRCommPkgShmPkg(comm_pkg));
 
    if (hypre_ParCSRCommPkgNumSends(comm_pkg))
    {
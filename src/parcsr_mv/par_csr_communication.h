@@ -13,7 +13,6 @@
  *   Structure containing information for doing communications
  *--------------------------------------------------------------------------*/
 
-#ifdef HYPRE_USING_PERSISTENT_COMM
 typedef enum CommPkgJobType
 {
    HYPRE_COMM_PKG_JOB_COMPLEX = 0,
@@ -24,16 +23,19 @@ typedef enum CommPkgJobType
    HYPRE_COMM_PKG_JOB_BIGINT_TRANSPOSE,
    NUM_OF_COMM_PKG_JOB_TYPE,
 } CommPkgJobType;
-#endif
 
 /*--------------------------------------------------------------------------
  * hypre_ParCSRCommHandle, hypre_ParCSRPersistentCommHandle
  *--------------------------------------------------------------------------*/
 struct _hypre_ParCSRCommPkg;
+struct _hypre_ParCSRNodeCommPkg;
+struct _hypre_ParCSRShmCommPkg;
 
 typedef struct
 {
    struct _hypre_ParCSRCommPkg *comm_pkg;
+   struct _hypre_ParCSRNodeCommPkg *node_pkg; /* set if the exchange is node-aware */
+   struct _hypre_ParCSRShmCommPkg  *shm_pkg;  /* set if on-node data is shared */
    HYPRE_MemoryLocation  send_memory_location;
    HYPRE_MemoryLocation  recv_memory_location;
    HYPRE_Int             num_send_bytes;
@@ -48,6 +50,111 @@ typedef struct
 
 typedef hypre_ParCSRCommHandle hypre_ParCSRPersistentCommHandle;
 
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRNodeCommPkg:
+ *   Node-aware (hierarchical) schedule for the job 1 exchange of a comm_pkg.
+ *   Ranks are split into groups (the ranks of a node, or part of it), each
+ *   with a leader.  Messages within a group are sent directly.  Data going
+ *   to other groups is gathered by the leader, sent as one message per pair
+ *   of groups, and scattered by the receiving leader.
+ *--------------------------------------------------------------------------*/
+
+typedef struct _hypre_ParCSRNodeCommPkg
+{
+   MPI_Comm                 comm;               /* duplicate of the comm_pkg comm (not owned) */
+   HYPRE_Int                leader;             /* rank of the group leader */
+   HYPRE_Int                send_size;          /* length of send_data */
+   HYPRE_Int                recv_size;          /* length of recv_data */
+
+   /* direct messages within the group (indices into the comm_pkg lists) */
+   HYPRE_Int                num_local_sends;
+   HYPRE_Int               *local_sends;
+   HYPRE_Int                num_local_recvs;
+   HYPRE_Int               *local_recvs;
+
+   /* entries of send_data for other groups, sent to the leader */
+   HYPRE_Int                gather_size;
+   HYPRE_Int               *gather_elmts;
+   HYPRE_Complex           *gather_buf;
+
+   /* positions in recv_data of the entries sent by the leader */
+   HYPRE_Int                scatter_size;
+   HYPRE_Int               *scatter_elmts;
+   HYPRE_Complex           *scatter_buf;
+
+   /* leader only: gather from the group into group_buf */
+   HYPRE_Int                num_group_recvs;
+   HYPRE_Int               *group_recv_procs;
+   HYPRE_Int               *group_recv_starts;
+   HYPRE_Complex           *group_buf;
+
+   /* leader only: exchange between leaders, from group_buf into leader_buf */
+   HYPRE_Int                num_leader_sends;
+   HYPRE_Int               *leader_send_procs;
+   HYPRE_Int               *leader_send_starts;
+   HYPRE_Int               *leader_send_elmts;
+   HYPRE_Complex           *leader_send_buf;
+   HYPRE_Int                num_leader_recvs;
+   HYPRE_Int               *leader_recv_procs;
+   HYPRE_Int               *leader_recv_starts;
+   HYPRE_Complex           *leader_buf;
+
+   /* leader only: scatter from leader_buf to the group */
+   HYPRE_Int                num_group_sends;
+   HYPRE_Int               *group_send_procs;
+   HYPRE_Int               *group_send_starts;
+   HYPRE_Int               *group_send_elmts;
+   HYPRE_Complex           *group_send_buf;
+
+   /* exchange in progress */
+   hypre_ParCSRCommHandle  *comm_handle;
+   HYPRE_Complex           *recv_data;
+   HYPRE_Int                num_requests;
+   hypre_MPI_Request       *requests;
+} hypre_ParCSRNodeCommPkg;
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRShmCommPkg:
+ *   Shared-memory schedule for the job 1 exchange of a comm_pkg.  Every rank
+ *   owns a piece of its segment of an MPI-3 shared-memory window, laid out
+ *   like its send buffer; the windows are shared by all comm_pkgs of the
+ *   node (see hypre_NodeCommShmAlloc).  Ranks of the same node load the values they need directly from
+ *   the segment of the sender after a zero-byte notification, and return a
+ *   zero-byte acknowledgement once done.  Other ranks exchange messages.
+ *--------------------------------------------------------------------------*/
+
+typedef struct _hypre_ParCSRShmCommPkg
+{
+   MPI_Comm                 node_comm;          /* ranks sharing the window (not owned) */
+   hypre_ShmWindow         *shm_win;            /* pooled window (not owned) */
+   HYPRE_Complex           *send_buf;           /* piece of the segment of this rank */
+   HYPRE_Int                send_size;          /* length of send_data */
+   HYPRE_Int                recv_size;          /* length of recv_data */
+
+   /* messages to/from other nodes (indices into the comm_pkg lists) */
+   HYPRE_Int                num_remote_sends;
+   HYPRE_Int               *remote_sends;
+   HYPRE_Int                num_remote_recvs;
+   HYPRE_Int               *remote_recvs;
+
+   /* on-node neighbors (indices into the comm_pkg lists, node_comm ranks) */
+   HYPRE_Int                num_shm_sends;
+   HYPRE_Int               *shm_sends;
+   HYPRE_Int               *shm_send_procs;
+   HYPRE_Int                num_shm_recvs;
+   HYPRE_Int               *shm_recv_procs;
+   HYPRE_Int               *shm_recv_starts;    /* position in recv_data */
+   HYPRE_Int               *shm_recv_sizes;
+   HYPRE_Complex          **shm_recv_data;      /* location in the sender segment */
+
+   /* exchange in progress */
+   hypre_ParCSRCommHandle  *comm_handle;
+   HYPRE_Complex           *recv_data;
+   HYPRE_Int                num_requests;
+   hypre_MPI_Request       *requests;
+   hypre_MPI_Request       *ack_requests;       /* segment may be overwritten when done */
+} hypre_ParCSRShmCommPkg;
+
 typedef struct _hypre_ParCSRCommPkg
 {
    MPI_Comm                          comm;
@@ -63,9 +170,12 @@ typedef struct _hypre_ParCSRCommPkg
    /* remote communication information */
    hypre_MPI_Datatype               *send_mpi_types;
    hypre_MPI_Datatype               *recv_mpi_types;
-#ifdef HYPRE_USING_PERSISTENT_COMM
+   /* node-aware schedule for job 1, NULL if not used */
+   hypre_ParCSRNodeCommPkg          *node_pkg;
+   /* shared-memory schedule for job 1, NULL if not used */
+   hypre_ParCSRShmCommPkg           *shm_pkg;
+   /* persistent requests and buffers per job type, NULL if not created */
    hypre_ParCSRPersistentCommHandle *persistent_comm_handles[NUM_OF_COMM_PKG_JOB_TYPE];
-#endif
 #if defined(HYPRE_USING_GPU)
    /* temporary memory for matvec. cudaMalloc is expensive. alloc once and reuse */
    HYPRE_Complex                    *tmp_data;
@@ -98,6 +208,8 @@ typedef struct _hypre_ParCSRCommPkg
 #define hypre_ParCSRCommPkgSendMPIType(comm_pkg,i)       (comm_pkg -> send_mpi_types[i])
 #define hypre_ParCSRCommPkgRecvMPITypes(comm_pkg)        (comm_pkg -> recv_mpi_types)
 #define hypre_ParCSRCommPkgRecvMPIType(comm_pkg,i)       (comm_pkg -> recv_mpi_types[i])
+#define hypre_ParCSRCommPkgNodePkg(comm_pkg)             (comm_pkg -> node_pkg)
+#define hypre_ParCSRCommPkgShmPkg(comm_pkg)              (comm_pkg -> shm_pkg)
 
 #if defined(HYPRE_USING_GPU)
 #define hypre_ParCSRCommPkgTmpData(comm_pkg)             ((comm_pkg) -> tmp_data)
@@ -133,6 +245,8 @@ hypre_ParCSRCommPkgCopySendMapElmtsToDevice(hypre_ParCSRCommPkg *comm_pkg)
  *--------------------------------------------------------------------------*/
 
 #define hypre_ParCSRCommHandleCommPkg(comm_handle)                (comm_handle -> comm_pkg)
+#define hypre_ParCSRCommHandleNodePkg(comm_handle)                (comm_handle -> node_pkg)
+#define hypre_ParCSRCommHandleShmPkg(comm_handle)                 (comm_handle -> shm_pkg)
 #define hypre_ParCSRCommHandleSendMemoryLocation(comm_handle)     (comm_handle -> send_memory_location)
 #define hypre_ParCSRCommHandleRecvMemoryLocation(comm_handle)     (comm_handle -> recv_memory_location)
 #define hypre_ParCSRCommHandleNumSendBytes(comm_handle)           (comm_handle -> num_send_bytes)
@@ -145,4 +259,72 @@ hypre_ParCSRCommPkgCopySendMapElmtsToDevice(hypre_ParCSRCommPkg *comm_pkg)
 #define hypre_ParCSRCommHandleRequests(comm_handle)               (comm_handle -> requests)
 #define hypre_ParCSRCommHandleRequest(comm_handle, i)             (comm_handle -> requests[i])
 
+/*--------------------------------------------------------------------------
+ * Accessor macros: hypre_ParCSRNodeCommPkg
+ *--------------------------------------------------------------------------*/
+
+#define hypre_ParCSRNodeCommPkgComm(node_pkg)                     (node_pkg -> comm)
+#define hypre_ParCSRNodeCommPkgLeader(node_pkg)                   (node_pkg -> leader)
+#define hypre_ParCSRNodeCommPkgSendSize(node_pkg)                 (node_pkg -> send_size)
+#define hypre_ParCSRNodeCommPkgRecvSize(node_pkg)                 (node_pkg -> recv_size)
+#define hypre_ParCSRNodeCommPkgNumLocalSends(node_pkg)            (node_pkg -> num_local_sends)
+#define hypre_ParCSRNodeCommPkgLocalSends(node_pkg)               (node_pkg -> local_sends)
+#define hypre_ParCSRNodeCommPkgNumLocalRecvs(node_pkg)            (node_pkg -> num_local_recvs)
+#define hypre_ParCSRNodeCommPkgLocalRecvs(node_pkg)               (node_pkg -> local_recvs)
+#define hypre_ParCSRNodeCommPkgGatherSize(node_pkg)               (node_pkg -> gather_size)
+#define hypre_ParCSRNodeCommPkgGatherElmts(node_pkg)              (node_pkg -> gather_elmts)
+#define hypre_ParCSRNodeCommPkgGatherBuf(node_pkg)                (node_pkg -> gather_buf)
+#define hypre_ParCSRNodeCommPkgScatterSize(node_pkg)              (node_pkg -> scatter_size)
+#define hypre_ParCSRNodeCommPkgScatterElmts(node_pkg)             (node_pkg -> scatter_elmts)
+#define hypre_ParCSRNodeCommPkgScatterBuf(node_pkg)               (node_pkg -> scatter_buf)
+#define hypre_ParCSRNodeCommPkgNumGroupRecvs(node_pkg)            (node_pkg -> num_group_recvs)
+#define hypre_ParCSRNodeCommPkgGroupRecvProcs(node_pkg)           (node_pkg -> group_recv_procs)
+#define hypre_ParCSRNodeCommPkgGroupRecvStarts(node_pkg)          (node_pkg -> group_recv_starts)
+#define hypre_ParCSRNodeCommPkgGroupBuf(node_pkg)                 (node_pkg -> group_buf)
+#define hypre_ParCSRNodeCommPkgNumLeaderSends(node_pkg)           (node_pkg -> num_leader_sends)
+#define hypre_ParCSRNodeCommPkgLeaderSendProcs(node_pkg)          (node_pkg -> leader_send_procs)
+#define hypre_ParCSRNodeCommPkgLeaderSendStarts(node_pkg)         (node_pkg -> leader_send_starts)
+#define hypre_ParCSRNodeCommPkgLeaderSendElmts(node_pkg)          (node_pkg -> leader_send_elmts)
+#define hypre_ParCSRNodeCommPkgLeaderSendBuf(node_pkg)            (node_pkg -> leader_send_buf)
+#define hypre_ParCSRNodeCommPkgNumLeaderRecvs(node_pkg)           (node_pkg -> num_leader_recvs)
+#define hypre_ParCSRNodeCommPkgLeaderRecvProcs(node_pkg)          (node_pkg -> leader_recv_procs)
+#define hypre_ParCSRNodeCommPkgLeaderRecvStarts(node_pkg)         (node_pkg -> leader_recv_starts)
+#define hypre_ParCSRNodeCommPkgLeaderBuf(node_pkg)                (node_pkg -> leader_buf)
+#define hypre_ParCSRNodeCommPkgNumGroupSends(node_pkg)            (node_pkg -> num_group_sends)
+#define hypre_ParCSRNodeCommPkgGroupSendProcs(node_pkg)           (node_pkg -> group_send_procs)
+#define hypre_ParCSRNodeCommPkgGroupSendStarts(node_pkg)          (node_pkg -> group_send_starts)
+#define hypre_ParCSRNodeCommPkgGroupSendElmts(node_pkg)           (node_pkg -> group_send_elmts)
+#define hypre_ParCSRNodeCommPkgGroupSendBuf(node_pkg)             (node_pkg -> group_send_buf)
+#define hypre_ParCSRNodeCommPkgCommHandle(node_pkg)               (node_pkg -> comm_handle)
+#define hypre_ParCSRNodeCommPkgRecvData(node_pkg)                 (node_pkg -> recv_data)
+#define hypre_ParCSRNodeCommPkgNumRequests(node_pkg)              (node_pkg -> num_requests)
+#define hypre_ParCSRNodeCommPkgRequests(node_pkg)                 (node_pkg -> requests)
+
+/*--------------------------------------------------------------------------
+ * Accessor macros: hypre_ParCSRShmCommPkg
+ *--------------------------------------------------------------------------*/
+
+#define hypre_ParCSRShmCommPkgNodeComm(shm_pkg)                   (shm_pkg -> node_comm)
+#define hypre_ParCSRShmCommPkgShmWin(shm_pkg)                     (shm_pkg -> shm_win)
+#define hypre_ParCSRShmCommPkgSendBuf(shm_pkg)                    (shm_pkg -> send_buf)
+#define hypre_ParCSRShmCommPkgSendSize(shm_pkg)                   (shm_pkg -> send_size)
+#define hypre_ParCSRShmCommPkgRecvSize(shm_pkg)                   (shm_pkg -> recv_size)
+#define hypre_ParCSRShmCommPkgNumRemoteSends(shm_pkg)             (shm_pkg -> num_remote_sends)
+#define hypre_ParCSRShmCommPkgRemoteSends(shm_pkg)                (shm_pkg -> remote_sends)
+#define hypre_ParCSRShmCommPkgNumRemoteRecvs(shm_pkg)             (shm_pkg -> num_remote_recvs)
+#define hypre_ParCSRShmCommPkgRemoteRecvs(shm_pkg)                (shm_pkg -> remote_recvs)
+#define hypre_ParCSRShmCommPkgNumShmSends(shm_pkg)                (shm_pkg -> num_shm_sends)
+#define hypre_ParCSRShmCommPkgShmSends(shm_pkg)                   (shm_pkg -> shm_sends)
+#define hypre_ParCSRShmCommPkgShmSendProcs(shm_pkg)               (shm_pkg -> shm_send_procs)
+#define hypre_ParCSRShmCommPkgNumShmRecvs(shm_pkg)                (shm_pkg -> num_shm_recvs)
+#define hypre_ParCSRShmCommPkgShmRecvProcs(shm_pkg)               (shm_pkg -> shm_recv_procs)
+#define hypre_ParCSRShmCommPkgShmRecvStarts(shm_pkg)              (shm_pkg -> shm_recv_starts)
+#define hypre_ParCSRShmCommPkgShmRecvSizes(shm_pkg)               (shm_pkg -> shm_recv_sizes)
+#define hypre_ParCSRShmCommPkgShmRecvData(shm_pkg)                (shm_pkg -> shm_recv_data)
+#define hypre_ParCSRShmCommPkgCommHandle(shm_pkg)                 (shm_pkg -> comm_handle)
+#define hypre_ParCSRShmCommPkgRecvData(shm_pkg)                   (shm_pkg -> recv_data)
+#define hypre_ParCSRShmCommPkgNumRequests(shm_pkg)                (shm_pkg -> num_requests)
+#define hypre_ParCSRShmCommPkgRequests(shm_pkg)                   (shm_pkg -> requests)
+#define hypre_ParCSRShmCommPkgAckRequests(shm_pkg)                (shm_pkg -> ack_requests)
+
 #endif /* HYPRE_PAR_CSR_COMMUNICATION_HEADER */
@@ -122,23 +122,16 @@ hypre_ParMatmul_RowSizes( HYPRE_MemoryLocation memory_location,
       {
          jj_row_begin_diag = jj_count_diag;
          jj_row_begin_offd = jj_count_offd;
-         if (rownnz_A)
-         {
-            ii1 = rownnz_A[i1];
-         }
-         else
-         {
-            ii1 = i1;
+         ii1 = rownnz_A ? rownnz_A[i1] : i1;
 
-            /*--------------------------------------------------------------------
-             *  Set marker for diagonal entry, C_{i1,i1} (for square matrices).
-             *--------------------------------------------------------------------*/
+         /*--------------------------------------------------------------------
+          *  Set marker for diagonal entry, C_{ii1,ii1} (for square matrices).
+          *--------------------------------------------------------------------*/
 
-            if (allsquare)
-            {
-               B_marker[i1] = jj_count_diag;
-               jj_count_diag++;
-            }
+         if (allsquare)
+         {
+            B_marker[ii1] = jj_count_diag;
+            jj_count_diag++;
          }
 
          /*-----------------------------------------------------------------
@@ -299,7 +292,7 @@ hypre_ParMatmul_RowSizes( HYPRE_MemoryLocation memory_location,
             }
          }
 
-         if (ii < (num_threads - 1))
+         if (ne < num_rownnz_A)
          {
             for (ii1 = rownnz_A[ne - 1] + 1; ii1 < rownnz_A[ne]; ii1++)
             {
@@ -338,214 +331,194 @@ hypre_ParMatmul_RowSizes( HYPRE_MemoryLocation memory_location,
 }
 
 /*--------------------------------------------------------------------------
- * hypre_ParMatmul:
+ * hypre_ParMatmul_ShiftRows:
  *
- * Multiplies two ParCSRMatrices A and B and returns the product in
- * ParCSRMatrix C.
+ * Adds the row pointer old_i of the rows already stored in (*j_ptr,
+ * *data_ptr) to the row pointer new_i of rows about to be added, grows the
+ * arrays to old_size + new_size entries, and moves the stored rows to their
+ * final positions given by new_i. Every row is stored in at most one of the
+ * two sets, so the stored rows only move towards the end of the arrays and
+ * moving them from the last row on never overwrites a row not yet moved.
+ * old_i is freed.
  *--------------------------------------------------------------------------*/
 
-hypre_ParCSRMatrix*
-hypre_ParMatmul( hypre_ParCSRMatrix  *A,
-                 hypre_ParCSRMatrix  *B )
+static void
+hypre_ParMatmul_ShiftRows( HYPRE_MemoryLocation   memory_location,
+                           HYPRE_Int              num_rows,
+                           HYPRE_Int             *new_i,
+                           HYPRE_Int              new_size,
+                           HYPRE_Int             *old_i,
+                           HYPRE_Int              old_size,
+                           HYPRE_Int            **j_ptr,
+                           HYPRE_Complex        **data_ptr )
 {
-#ifdef HYPRE_PROFILE
-   hypre_profile_times[HYPRE_TIMER_ID_MATMUL] -= hypre_MPI_Wtime();
-#endif
-
-   /* ParCSRMatrix A */
-   MPI_Comm            comm              = hypre_ParCSRMatrixComm(A);
-   HYPRE_BigInt        nrows_A           = hypre_ParCSRMatrixGlobalNumRows(A);
-   HYPRE_BigInt        ncols_A           = hypre_ParCSRMatrixGlobalNumCols(A);
-   HYPRE_BigInt       *row_starts_A      = hypre_ParCSRMatrixRowStarts(A);
-   HYPRE_Int           num_rownnz_A;
-   HYPRE_Int          *rownnz_A = NULL;
+   HYPRE_Int          *j    = *j_ptr;
+   HYPRE_Complex      *data = *data_ptr;
+   HYPRE_Int           i, jj, shift;
 
-   /* ParCSRMatrix B */
-   HYPRE_BigInt        nrows_B           = hypre_ParCSRMatrixGlobalNumRows(B);
-   HYPRE_BigInt        ncols_B           = hypre_ParCSRMatrixGlobalNumCols(B);
-   HYPRE_BigInt        first_col_diag_B  = hypre_ParCSRMatrixFirstColDiag(B);
-   HYPRE_BigInt       *col_starts_B      = hypre_ParCSRMatrixColStarts(B);
-   HYPRE_BigInt        last_col_diag_B;
+#if defined(HYPRE_USING_OPENMP)
+   #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i <= num_rows; i++)
+   {
+      new_i[i] += old_i[i];
+   }
 
-   /* A_diag */
-   hypre_CSRMatrix    *A_diag            = hypre_ParCSRMatrixDiag(A);
-   HYPRE_Complex      *A_diag_data       = hypre_CSRMatrixData(A_diag);
-   HYPRE_Int          *A_diag_i          = hypre_CSRMatrixI(A_diag);
-   HYPRE_Int          *A_diag_j          = hypre_CSRMatrixJ(A_diag);
-   HYPRE_Int          *A_diag_ir         = hypre_CSRMatrixRownnz(A_diag);
-   HYPRE_Int           num_rownnz_diag_A = hypre_CSRMatrixNumRownnz(A_diag);
-   HYPRE_Int           num_rows_diag_A   = hypre_CSRMatrixNumRows(A_diag);
-   HYPRE_Int           num_cols_diag_A   = hypre_CSRMatrixNumCols(A_diag);
+   if (new_size)
+   {
+      j    = hypre_TReAlloc_v2(j, HYPRE_Int, old_size, HYPRE_Int,
+                               old_size + new_size, memory_location);
+      data = hypre_TReAlloc_v2(data, HYPRE_Complex, old_size, HYPRE_Complex,
+                               old_size + new_size, memory_location);
 
-   /* A_offd */
-   hypre_CSRMatrix    *A_offd            = hypre_ParCSRMatrixOffd(A);
-   HYPRE_Complex      *A_offd_data       = hypre_CSRMatrixData(A_offd);
-   HYPRE_Int          *A_offd_i          = hypre_CSRMatrixI(A_offd);
-   HYPRE_Int          *A_offd_j          = hypre_CSRMatrixJ(A_offd);
-   HYPRE_Int          *A_offd_ir         = hypre_CSRMatrixRownnz(A_offd);
-   HYPRE_Int           num_rownnz_offd_A = hypre_CSRMatrixNumRownnz(A_offd);
-   HYPRE_Int           num_rows_offd_A   = hypre_CSRMatrixNumRows(A_offd);
-   HYPRE_Int           num_cols_offd_A   = hypre_CSRMatrixNumCols(A_offd);
+      for (i = num_rows - 1; i >= 0; i--)
+      {
+         shift = new_i[i] - old_i[i];
+         if (shift)
+         {
+            for (jj = old_i[i + 1] - 1; jj >= old_i[i]; jj--)
+            {
+               j[jj + shift]    = j[jj];
+               data[jj + shift] = data[jj];
+            }
+         }
+      }
+   }
 
-   /* B_diag */
-   hypre_CSRMatrix    *B_diag            = hypre_ParCSRMatrixDiag(B);
-   HYPRE_Complex      *B_diag_data       = hypre_CSRMatrixData(B_diag);
-   HYPRE_Int          *B_diag_i          = hypre_CSRMatrixI(B_diag);
-   HYPRE_Int          *B_diag_j          = hypre_CSRMatrixJ(B_diag);
-   HYPRE_Int           num_rows_diag_B   = hypre_CSRMatrixNumRows(B_diag);
-   HYPRE_Int           num_cols_diag_B   = hypre_CSRMatrixNumCols(B_diag);
+   hypre_TFree(old_i, memory_location);
 
-   /* B_offd */
-   hypre_CSRMatrix    *B_offd            = hypre_ParCSRMatrixOffd(B);
-   HYPRE_BigInt       *col_map_offd_B    = hypre_ParCSRMatrixColMapOffd(B);
-   HYPRE_Complex      *B_offd_data       = hypre_CSRMatrixData(B_offd);
-   HYPRE_Int          *B_offd_i          = hypre_CSRMatrixI(B_offd);
-   HYPRE_Int          *B_offd_j          = hypre_CSRMatrixJ(B_offd);
-   HYPRE_Int           num_cols_offd_B   = hypre_CSRMatrixNumCols(B_offd);
+   *j_ptr    = j;
+   *data_ptr = data;
+}
 
-   /* ParCSRMatrix C */
-   hypre_ParCSRMatrix *C;
-   HYPRE_BigInt       *col_map_offd_C;
-   HYPRE_Int          *map_B_to_C = NULL;
+/*--------------------------------------------------------------------------
+ * hypre_ParMatmul_Product:
+ *
+ * Computes the rows of C = A_diag * [B_diag, B_offd] + A_offd * B_ext with
+ * the two-pass algorithm of hypre_ParMatmul. The A_offd * B_ext part is
+ * skipped when num_cols_offd_A is zero. Columns of B_offd are mapped to C
+ * through map_B_to_C, columns of B_ext_offd are already local to C.
+ *
+ * If *C_diag_i_ptr is not NULL, the arrays passed in already hold other
+ * rows of C. They are grown and the new rows are written into them, so
+ * that on return they hold both sets of rows.
+ *--------------------------------------------------------------------------*/
 
-   /* C_diag */
-   hypre_CSRMatrix    *C_diag;
-   HYPRE_Complex      *C_diag_data;
+static void
+hypre_ParMatmul_Product( HYPRE_MemoryLocation   memory_location,
+                         HYPRE_Int             *rownnz_A,
+                         HYPRE_Int              num_rownnz_A,
+                         HYPRE_Int              num_rows_diag_A,
+                         HYPRE_Int              allsquare,
+                         HYPRE_Int             *A_diag_i,
+                         HYPRE_Int             *A_diag_j,
+                         HYPRE_Complex         *A_diag_data,
+                         HYPRE_Int              num_cols_offd_A,
+                         HYPRE_Int             *A_offd_i,
+                         HYPRE_Int             *A_offd_j,
+                         HYPRE_Complex         *A_offd_data,
+                         HYPRE_Int              num_cols_diag_B,
+                         HYPRE_Int             *B_diag_i,
+                         HYPRE_Int             *B_diag_j,
+                         HYPRE_Complex         *B_diag_data,
+                         HYPRE_Int              num_cols_offd_B,
+                         HYPRE_Int             *B_offd_i,
+                         HYPRE_Int             *B_offd_j,
+                         HYPRE_Complex         *B_offd_data,
+                         HYPRE_Int             *map_B_to_C,
+                         HYPRE_Int              num_cols_offd_C,
+                         HYPRE_Int             *B_ext_diag_i,
+                         HYPRE_Int             *B_ext_diag_j,
+                         HYPRE_Complex         *B_ext_diag_data,
+                         HYPRE_Int             *B_ext_offd_i,
+                         HYPRE_Int             *B_ext_offd_j,
+                         HYPRE_Complex         *B_ext_offd_data,
+                         HYPRE_Int            **C_diag_i_ptr,
+                         HYPRE_Int            **C_diag_j_ptr,
+                         HYPRE_Complex        **C_diag_data_ptr,
+                         HYPRE_Int             *C_diag_size_ptr,
+                         HYPRE_Int            **C_offd_i_ptr,
+                         HYPRE_Int            **C_offd_j_ptr,
+                         HYPRE_Complex        **C_offd_data_ptr,
+                         HYPRE_Int             *C_offd_size_ptr )
+{
    HYPRE_Int          *C_diag_i;
    HYPRE_Int          *C_diag_j;
-   HYPRE_Int           C_offd_size;
-   HYPRE_Int           num_cols_offd_C = 0;
-
-   /* C_offd */
-   hypre_CSRMatrix    *C_offd;
-   HYPRE_Complex      *C_offd_data = NULL;
-   HYPRE_Int          *C_offd_i = NULL;
-   HYPRE_Int          *C_offd_j = NULL;
+   HYPRE_Complex      *C_diag_data;
    HYPRE_Int           C_diag_size;
-
-   /* Bs_ext */
-   hypre_CSRMatrix    *Bs_ext;
-   HYPRE_Complex      *Bs_ext_data;
-   HYPRE_Int          *Bs_ext_i;
-   HYPRE_BigInt       *Bs_ext_j;
-   HYPRE_Complex      *B_ext_diag_data;
-   HYPRE_Int          *B_ext_diag_i;
-   HYPRE_Int          *B_ext_diag_j;
-   HYPRE_Int           B_ext_diag_size;
-   HYPRE_Complex      *B_ext_offd_data;
-   HYPRE_Int          *B_ext_offd_i;
-   HYPRE_Int          *B_ext_offd_j;
-   HYPRE_BigInt       *B_big_offd_j = NULL;
-   HYPRE_Int           B_ext_offd_size;
-
-   HYPRE_Int           allsquare = 0;
-   HYPRE_Int           num_procs;
-   HYPRE_Int          *my_diag_array;
-   HYPRE_Int          *my_offd_array;
-   HYPRE_Int           max_num_threads;
+   HYPRE_Int          *C_offd_i;
+   HYPRE_Int          *C_offd_j = NULL;
+   HYPRE_Complex      *C_offd_data = NULL;
+   HYPRE_Int           C_offd_size;
 
    HYPRE_Complex       zero = 0.0;
 
-   HYPRE_MemoryLocation memory_location_A = hypre_ParCSRMatrixMemoryLocation(A);
-   HYPRE_MemoryLocation memory_location_B = hypre_ParCSRMatrixMemoryLocation(B);
-
-   /* RL: TODO cannot guarantee, maybe should never assert
-   hypre_assert(memory_location_A == memory_location_B);
-   */
-
-   /* RL: in the case of A=H, B=D, or A=D, B=H, let C = D,
-    * not sure if this is the right thing to do.
-    * Also, need something like this in other places
-    * TODO */
-   HYPRE_MemoryLocation memory_location_C = hypre_max(memory_location_A, memory_location_B);
-
-   HYPRE_ANNOTATE_FUNC_BEGIN;
-
-   max_num_threads = hypre_NumThreads();
-   my_diag_array = hypre_CTAlloc(HYPRE_Int, max_num_threads, HYPRE_MEMORY_HOST);
-   my_offd_array = hypre_CTAlloc(HYPRE_Int, max_num_threads, HYPRE_MEMORY_HOST);
-
-   if (ncols_A != nrows_B || num_cols_diag_A != num_rows_diag_B)
-   {
-      hypre_error_w_msg(HYPRE_ERROR_GENERIC, " Error! Incompatible matrix dimensions!\n");
-
-      HYPRE_ANNOTATE_FUNC_END;
-      return NULL;
-   }
+   HYPRE_ANNOTATE_REGION_BEGIN("%s", "First pass");
+   hypre_ParMatmul_RowSizes(memory_location, &C_diag_i, &C_offd_i,
+                            rownnz_A, A_diag_i, A_diag_j,
+                            A_offd_i, A_offd_j,
+                            B_diag_i, B_diag_j,
+                            B_offd_i, B_offd_j,
+                            B_ext_diag_i, B_ext_diag_j,
+                            B_ext_offd_i, B_ext_offd_j, map_B_to_C,
+                            &C_diag_size, &C_offd_size,
+                            num_rownnz_A, num_rows_diag_A, num_cols_offd_A,
+                            allsquare, num_cols_diag_B, num_cols_offd_B,
+                            num_cols_offd_C);
+   HYPRE_ANNOTATE_REGION_END("%s", "First pass");
 
-   /* if C=A*B is square globally and locally, then C_diag should be square also */
-   if ( num_rows_diag_A == num_cols_diag_B && nrows_A == ncols_B )
-   {
-      allsquare = 1;
-   }
+   /*-----------------------------------------------------------------------
+    *  Allocate C_diag_data and C_diag_j arrays.
+    *  Allocate C_offd_data and C_offd_j arrays.
+    *-----------------------------------------------------------------------*/
 
-   /* Set rownnz of A */
-   if (num_rownnz_diag_A != num_rows_diag_A &&
-       num_rownnz_offd_A != num_rows_offd_A )
+   if (*C_diag_i_ptr)
    {
-      hypre_IntArray arr_diag;
-      hypre_IntArray arr_offd;
-      hypre_IntArray arr_rownnz;
-
-      hypre_IntArrayData(&arr_diag) = A_diag_ir;
-      hypre_IntArrayData(&arr_offd) = A_offd_ir;
-      hypre_IntArraySize(&arr_diag) = num_rownnz_diag_A;
-      hypre_IntArraySize(&arr_offd) = num_rownnz_offd_A;
-      hypre_IntArrayMemoryLocation(&arr_rownnz) = memory_location_A;
-
-      hypre_IntArrayMergeOrdered(&arr_diag, &arr_offd, &arr_rownnz);
-
-      num_rownnz_A = hypre_IntArraySize(&arr_rownnz);
-      rownnz_A     = hypre_IntArrayData(&arr_rownnz);
+      C_diag_j    = *C_diag_j_ptr;
+      C_diag_data = *C_diag_data_ptr;
+      C_offd_j    = *C_offd_j_ptr;
+      C_offd_data = *C_offd_data_ptr;
+      hypre_ParMatmul_ShiftRows(memory_location, num_rows_diag_A, C_diag_i, C_diag_size,
+                                *C_diag_i_ptr, *C_diag_size_ptr, &C_diag_j, &C_diag_data);
+      hypre_ParMatmul_ShiftRows(memory_location, num_rows_diag_A, C_offd_i, C_offd_size,
+                                *C_offd_i_ptr, *C_offd_size_ptr, &C_offd_j, &C_offd_data);
+      C_diag_size += *C_diag_size_ptr;
+      C_offd_size += *C_offd_size_ptr;
    }
    else
    {
-      num_rownnz_A = hypre_max(num_rows_diag_A, num_rows_offd_A);
+      C_diag_data = hypre_CTAlloc(HYPRE_Complex, C_diag_size, memory_location);
+      C_diag_j    = hypre_CTAlloc(HYPRE_Int, C_diag_size, memory_location);
+      if (C_offd_size)
+      {
+         C_offd_data = hypre_CTAlloc(HYPRE_Complex, C_offd_size, memory_location);
+         C_offd_j    = hypre_CTAlloc(HYPRE_Int, C_offd_size, memory_location);
+      }
    }
 
    /*-----------------------------------------------------------------------
-    *  Extract B_ext, i.e. portion of B that is stored on neighbor procs
-    *  and needed locally for matrix matrix product
+    *  Second Pass: Fill in C_diag_data and C_diag_j.
+    *  Second Pass: Fill in C_offd_data and C_offd_j.
     *-----------------------------------------------------------------------*/
 
-   hypre_MPI_Comm_size(comm, &num_procs);
+   HYPRE_ANNOTATE_REGION_BEGIN("%s", "Second pass");
 
-#ifdef HYPRE_PROFILE
-   hypre_profile_times[HYPRE_TIMER_ID_RENUMBER_COLIDX] -= hypre_MPI_Wtime();
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel
 #endif
-
-   if (num_procs > 1)
    {
-      /*---------------------------------------------------------------------
-       * If there exists no CommPkg for A, a CommPkg is generated using
-       * equally load balanced partitionings within
-       * hypre_ParCSRMatrixExtractBExt
-       *--------------------------------------------------------------------*/
-      Bs_ext      = hypre_ParCSRMatrixExtractBExt(B, A, 1);
-      Bs_ext_data = hypre_CSRMatrixData(Bs_ext);
-      Bs_ext_i    = hypre_CSRMatrixI(Bs_ext);
-      Bs_ext_j    = hypre_CSRMatrixBigJ(Bs_ext);
-   }
-   B_ext_diag_i = hypre_CTAlloc(HYPRE_Int, num_cols_offd_A + 1, HYPRE_MEMORY_HOST);
-   B_ext_offd_i = hypre_CTAlloc(HYPRE_Int, num_cols_offd_A + 1, HYPRE_MEMORY_HOST);
-   B_ext_diag_size = 0;
-   B_ext_offd_size = 0;
-   last_col_diag_B = first_col_diag_B + (HYPRE_BigInt) num_cols_diag_B - 1;
-
-#ifdef HYPRE_CONCURRENT_HOPSCOTCH
-   hypre_UnorderedBigIntSet set;
+      HYPRE_Int     *B_marker = NULL;
+      HYPRE_Int      ns, ne, size, rest, ii;
+      HYPRE_Int      i1, ii1, i2, i3, jj2, jj3;
+      HYPRE_Int      jj_row_begin_diag, jj_count_diag;
+      HYPRE_Int      jj_row_begin_offd, jj_count_offd;
+      HYPRE_Int      num_threads;
+      HYPRE_Complex  a_entry; /*, a_b_product;*/
 
-   #pragma omp parallel
-   {
-      HYPRE_Int size, rest, ii;
-      HYPRE_Int ns, ne;
-      HYPRE_Int i1, i, j;
-      HYPRE_Int my_offd_size, my_diag_size;
-      HYPRE_Int cnt_offd, cnt_diag;
-      HYPRE_Int num_threads = hypre_NumActiveThreads();
+      num_threads = hypre_NumActiveThreads();
+      size = num_rownnz_A / num_threads;
+      rest = num_rownnz_A - size * num_threads;
 
-      size = num_cols_offd_A / num_threads;
-      rest = num_cols_offd_A - size * num_threads;
       ii = hypre_GetThreadNum();
       if (ii < rest)
       {
@@ -557,169 +530,429 @@ hypre_ParMatmul( hypre_ParCSRMatrix  *A,
          ns = ii * size + rest;
          ne = (ii + 1) * size + rest;
       }
-
-      my_diag_size = 0;
-      my_offd_size = 0;
-      for (i = ns; i < ne; i++)
+      if (num_cols_diag_B || num_cols_offd_C)
       {
-         B_ext_diag_i[i] = my_diag_size;
-         B_ext_offd_i[i] = my_offd_size;
-         for (j = Bs_ext_i[i]; j < Bs_ext_i[i + 1]; j++)
+         B_marker = hypre_CTAlloc(HYPRE_Int, num_cols_diag_B + num_cols_offd_C,
+                                  HYPRE_MEMORY_HOST);
+         for (i1 = 0; i1 < num_cols_diag_B + num_cols_offd_C; i1++)
          {
-            if (Bs_ext_j[j] < first_col_diag_B ||
-                Bs_ext_j[j] > last_col_diag_B)
-            {
-               my_offd_size++;
-            }
-            else
-            {
-               my_diag_size++;
-            }
+            B_marker[i1] = -1;
          }
       }
-      my_diag_array[ii] = my_diag_size;
-      my_offd_array[ii] = my_offd_size;
-
-      #pragma omp barrier
 
-      if (ii)
+      /*-----------------------------------------------------------------------
+       *  Loop over interior c-points.
+       *-----------------------------------------------------------------------*/
+      for (i1 = ns; i1 < ne; i1++)
       {
-         my_diag_size = my_diag_array[0];
-         my_offd_size = my_offd_array[0];
-         for (i1 = 1; i1 < ii; i1++)
-         {
-            my_diag_size += my_diag_array[i1];
-            my_offd_size += my_offd_array[i1];
-         }
+         ii1 = rownnz_A ? rownnz_A[i1] : i1;
+         jj_count_diag = C_diag_i[ii1];
+         jj_count_offd = C_offd_i[ii1];
+         jj_row_begin_diag = jj_count_diag;
+         jj_row_begin_offd = jj_count_offd;
 
-         for (i1 = ns; i1 < ne; i1++)
-         {
-            B_ext_diag_i[i1] += my_diag_size;
-            B_ext_offd_i[i1] += my_offd_size;
-         }
-      }
-      else
-      {
-         B_ext_diag_size = 0;
-         B_ext_offd_size = 0;
-         for (i1 = 0; i1 < num_threads; i1++)
-         {
-            B_ext_diag_size += my_diag_array[i1];
-            B_ext_offd_size += my_offd_array[i1];
-         }
-         B_ext_diag_i[num_cols_offd_A] = B_ext_diag_size;
-         B_ext_offd_i[num_cols_offd_A] = B_ext_offd_size;
+         /*--------------------------------------------------------------------
+          *  Create diagonal entry, C_{ii1,ii1}
+          *--------------------------------------------------------------------*/
 
-         if (B_ext_diag_size)
+         if (allsquare)
          {
-            B_ext_diag_j = hypre_CTAlloc(HYPRE_Int,  B_ext_diag_size, HYPRE_MEMORY_HOST);
-            B_ext_diag_data = hypre_CTAlloc(HYPRE_Complex, B_ext_diag_size, HYPRE_MEMORY_HOST);
+            B_marker[ii1] = jj_count_diag;
+            C_diag_data[jj_count_diag] = zero;
+            C_diag_j[jj_count_diag] = ii1;
+            jj_count_diag++;
          }
-         if (B_ext_offd_size)
+
+         /*-----------------------------------------------------------------
+          *  Loop over entries in row i1 of A_offd.
+          *-----------------------------------------------------------------*/
+
+         if (num_cols_offd_A)
          {
-            B_ext_offd_j = hypre_CTAlloc(HYPRE_Int, B_ext_offd_size, HYPRE_MEMORY_HOST);
-            B_big_offd_j = hypre_CTAlloc(HYPRE_BigInt, B_ext_offd_size, HYPRE_MEMORY_HOST);
-            B_ext_offd_data = hypre_CTAlloc(HYPRE_Complex, B_ext_offd_size, HYPRE_MEMORY_HOST);
-         }
-         hypre_UnorderedBigIntSetCreate(&set, B_ext_offd_size + num_cols_offd_B, 16 * hypre_NumThreads());
-      }
+            for (jj2 = A_offd_i[ii1]; jj2 < A_offd_i[ii1 + 1]; jj2++)
+            {
+               i2 = A_offd_j[jj2];
+               a_entry = A_offd_data[jj2];
 
+               /*-----------------------------------------------------------
+                *  Loop over entries in row i2 of B_ext.
+                *-----------------------------------------------------------*/
 
-      #pragma omp barrier
+               for (jj3 = B_ext_offd_i[i2]; jj3 < B_ext_offd_i[i2 + 1]; jj3++)
+               {
+                  i3 = num_cols_diag_B + B_ext_offd_j[jj3];
 
-      cnt_offd = B_ext_offd_i[ns];
-      cnt_diag = B_ext_diag_i[ns];
-      for (i = ns; i < ne; i++)
-      {
-         for (j = Bs_ext_i[i]; j < Bs_ext_i[i + 1]; j++)
+                  /*--------------------------------------------------------
+                   *  Check B_marker to see that C_{ii1,i3} has not already
+                   *  been accounted for. If it has not, create a new entry.
+                   *  If it has, add new contribution.
+                   *--------------------------------------------------------*/
+
+                  if (B_marker[i3] < jj_row_begin_offd)
+                  {
+                     B_marker[i3] = jj_count_offd;
+                     C_offd_data[jj_count_offd] = a_entry * B_ext_offd_data[jj3];
+                     C_offd_j[jj_count_offd] = i3 - num_cols_diag_B;
+                     jj_count_offd++;
+                  }
+                  else
+                  {
+                     C_offd_data[B_marker[i3]] += a_entry * B_ext_offd_data[jj3];
+                  }
+               }
+               for (jj3 = B_ext_diag_i[i2]; jj3 < B_ext_diag_i[i2 + 1]; jj3++)
+               {
+                  i3 = B_ext_diag_j[jj3];
+                  if (B_marker[i3] < jj_row_begin_diag)
+                  {
+                     B_marker[i3] = jj_count_diag;
+                     C_diag_data[jj_count_diag] = a_entry * B_ext_diag_data[jj3];
+                     C_diag_j[jj_count_diag] = i3;
+                     jj_count_diag++;
+                  }
+                  else
+                  {
+                     C_diag_data[B_marker[i3]] += a_entry * B_ext_diag_data[jj3];
+                  }
+               }
+            }
+         }
+
+         /*-----------------------------------------------------------------
+          *  Loop over entries in row ii1 of A_diag.
+          *-----------------------------------------------------------------*/
+
+         for (jj2 = A_diag_i[ii1]; jj2 < A_diag_i[ii1 + 1]; jj2++)
          {
-            if (Bs_ext_j[j] < first_col_diag_B ||
-                Bs_ext_j[j] > last_col_diag_B)
+            i2 = A_diag_j[jj2];
+            a_entry = A_diag_data[jj2];
+
+            /*-----------------------------------------------------------
+             *  Loop over entries in row i2 of B_diag.
+             *-----------------------------------------------------------*/
+
+            for (jj3 = B_diag_i[i2]; jj3 < B_diag_i[i2 + 1]; jj3++)
             {
-               hypre_UnorderedBigIntSetPut(&set, Bs_ext_j[j]);
-               B_big_offd_j[cnt_offd] = Bs_ext_j[j];
-               //Bs_ext_j[cnt_offd] = Bs_ext_j[j];
-               B_ext_offd_data[cnt_offd++] = Bs_ext_data[j];
+               i3 = B_diag_j[jj3];
+
+               /*--------------------------------------------------------
+                *  Check B_marker to see that C_{ii1,i3} has not already
+                *  been accounted for. If it has not, create a new entry.
+                *  If it has, add new contribution.
+                *--------------------------------------------------------*/
+
+               if (B_marker[i3] < jj_row_begin_diag)
+               {
+                  B_marker[i3] = jj_count_diag;
+                  C_diag_data[jj_count_diag] = a_entry * B_diag_data[jj3];
+                  C_diag_j[jj_count_diag] = i3;
+                  jj_count_diag++;
+               }
+               else
+               {
+                  C_diag_data[B_marker[i3]] += a_entry * B_diag_data[jj3];
+               }
             }
-            else
+            if (num_cols_offd_B)
             {
-               B_ext_diag_j[cnt_diag] = (HYPRE_Int)(Bs_ext_j[j] - first_col_diag_B);
-               B_ext_diag_data[cnt_diag++] = Bs_ext_data[j];
+               for (jj3 = B_offd_i[i2]; jj3 < B_offd_i[i2 + 1]; jj3++)
+               {
+                  i3 = num_cols_diag_B + map_B_to_C[B_offd_j[jj3]];
+
+                  /*--------------------------------------------------------
+                   *  Check B_marker to see that C_{ii1,i3} has not already
+                   *  been accounted for. If it has not, create a new entry.
+                   *  If it has, add new contribution.
+                   *--------------------------------------------------------*/
+
+                  if (B_marker[i3] < jj_row_begin_offd)
+                  {
+                     B_marker[i3] = jj_count_offd;
+                     C_offd_data[jj_count_offd] = a_entry * B_offd_data[jj3];
+                     C_offd_j[jj_count_offd] = i3 - num_cols_diag_B;
+                     jj_count_offd++;
+                  }
+                  else
+                  {
+                     C_offd_data[B_marker[i3]] += a_entry * B_offd_data[jj3];
+                  }
+               }
             }
          }
       }
 
-      HYPRE_Int i_begin, i_end;
-      hypre_GetSimpleThreadPartition(&i_begin, &i_end, num_cols_offd_B);
-      for (i = i_begin; i < i_end; i++)
-      {
-         hypre_UnorderedBigIntSetPut(&set, col_map_offd_B[i]);
-      }
-   } /* omp parallel */
+      hypre_TFree(B_marker, HYPRE_MEMORY_HOST);
+   } /*end parallel region */
+   HYPRE_ANNOTATE_REGION_END("%s", "Second pass");
+
+   *C_diag_i_ptr    = C_diag_i;
+   *C_diag_j_ptr    = C_diag_j;
+   *C_diag_data_ptr = C_diag_data;
+   *C_diag_size_ptr = C_diag_size;
+   *C_offd_i_ptr    = C_offd_i;
+   *C_offd_j_ptr    = C_offd_j;
+   *C_offd_data_ptr = C_offd_data;
+   *C_offd_size_ptr = C_offd_size;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParMatmul:
+ *
+ * Multiplies two ParCSRMatrices A and B and returns the product in
+ * ParCSRMatrix C.
+ *--------------------------------------------------------------------------*/
+
+hypre_ParCSRMatrix*
+hypre_ParMatmul( hypre_ParCSRMatrix  *A,
+                 hypre_ParCSRMatrix  *B )
+{
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_MATMUL] -= hypre_MPI_Wtime();
+#endif
+
+   /* ParCSRMatrix A */
+   MPI_Comm            comm              = hypre_ParCSRMatrixComm(A);
+   HYPRE_BigInt        nrows_A           = hypre_ParCSRMatrixGlobalNumRows(A);
+   HYPRE_BigInt        ncols_A           = hypre_ParCSRMatrixGlobalNumCols(A);
+   HYPRE_BigInt       *row_starts_A      = hypre_ParCSRMatrixRowStarts(A);
+   HYPRE_Int           num_rownnz_A;
+   HYPRE_Int          *rownnz_A = NULL;
+
+   /* ParCSRMatrix B */
+   HYPRE_BigInt        nrows_B           = hypre_ParCSRMatrixGlobalNumRows(B);
+   HYPRE_BigInt        ncols_B           = hypre_ParCSRMatrixGlobalNumCols(B);
+   HYPRE_BigInt        first_col_diag_B  = hypre_ParCSRMatrixFirstColDiag(B);
+   HYPRE_BigInt       *col_starts_B      = hypre_ParCSRMatrixColStarts(B);
+   HYPRE_BigInt        last_col_diag_B;
+
+   /* A_diag */
+   hypre_CSRMatrix    *A_diag            = hypre_ParCSRMatrixDiag(A);
+   HYPRE_Complex      *A_diag_data       = hypre_CSRMatrixData(A_diag);
+   HYPRE_Int          *A_diag_i          = hypre_CSRMatrixI(A_diag);
+   HYPRE_Int          *A_diag_j          = hypre_CSRMatrixJ(A_diag);
+   HYPRE_Int          *A_diag_ir         = hypre_CSRMatrixRownnz(A_diag);
+   HYPRE_Int           num_rownnz_diag_A = hypre_CSRMatrixNumRownnz(A_diag);
+   HYPRE_Int           num_rows_diag_A   = hypre_CSRMatrixNumRows(A_diag);
+   HYPRE_Int           num_cols_diag_A   = hypre_CSRMatrixNumCols(A_diag);
+
+   /* A_offd */
+   hypre_CSRMatrix    *A_offd            = hypre_ParCSRMatrixOffd(A);
+   HYPRE_Complex      *A_offd_data       = hypre_CSRMatrixData(A_offd);
+   HYPRE_Int          *A_offd_i          = hypre_CSRMatrixI(A_offd);
+   HYPRE_Int          *A_offd_j          = hypre_CSRMatrixJ(A_offd);
+   HYPRE_Int          *A_offd_ir         = hypre_CSRMatrixRownnz(A_offd);
+   HYPRE_Int           num_rownnz_offd_A = hypre_CSRMatrixNumRownnz(A_offd);
+   HYPRE_Int           num_rows_offd_A   = hypre_CSRMatrixNumRows(A_offd);
+   HYPRE_Int           num_cols_offd_A   = hypre_CSRMatrixNumCols(A_offd);
+
+   /* B_diag */
+   hypre_CSRMatrix    *B_diag            = hypre_ParCSRMatrixDiag(B);
+   HYPRE_Complex      *B_diag_data       = hypre_CSRMatrixData(B_diag);
+   HYPRE_Int          *B_diag_i          = hypre_CSRMatrixI(B_diag);
+   HYPRE_Int          *B_diag_j          = hypre_CSRMatrixJ(B_diag);
+   HYPRE_Int           num_rows_diag_B   = hypre_CSRMatrixNumRows(B_diag);
+   HYPRE_Int           num_cols_diag_B   = hypre_CSRMatrixNumCols(B_diag);
+
+   /* B_offd */
+   hypre_CSRMatrix    *B_offd            = hypre_ParCSRMatrixOffd(B);
+   HYPRE_BigInt       *col_map_offd_B    = hypre_ParCSRMatrixColMapOffd(B);
+   HYPRE_Complex      *B_offd_data       = hypre_CSRMatrixData(B_offd);
+   HYPRE_Int          *B_offd_i          = hypre_CSRMatrixI(B_offd);
+   HYPRE_Int          *B_offd_j          = hypre_CSRMatrixJ(B_offd);
+   HYPRE_Int           num_cols_offd_B   = hypre_CSRMatrixNumCols(B_offd);
+
+   /* ParCSRMatrix C */
+   hypre_ParCSRMatrix *C;
+   HYPRE_BigInt       *col_map_offd_C;
+   HYPRE_Int          *map_B_to_C = NULL;
+
+   /* C_diag */
+   hypre_CSRMatrix    *C_diag;
+   HYPRE_Complex      *C_diag_data = NULL;
+   HYPRE_Int          *C_diag_i = NULL;
+   HYPRE_Int          *C_diag_j = NULL;
+   HYPRE_Int           C_offd_size = 0;
+   HYPRE_Int           num_cols_offd_C = 0;
+
+   /* C_offd */
+   hypre_CSRMatrix    *C_offd;
+   HYPRE_Complex      *C_offd_data = NULL;
+   HYPRE_Int          *C_offd_i = NULL;
+   HYPRE_Int          *C_offd_j = NULL;
+   HYPRE_Int           C_diag_size = 0;
+
+   /* Bs_ext */
+   hypre_CSRMatrix    *Bs_ext      = NULL;
+   HYPRE_Complex      *Bs_ext_data = NULL;
+   HYPRE_Int          *Bs_ext_i    = NULL;
+   HYPRE_BigInt       *Bs_ext_j    = NULL;
+   HYPRE_Complex      *B_ext_diag_data;
+   HYPRE_Int          *B_ext_diag_i;
+   HYPRE_Int          *B_ext_diag_j;
+   HYPRE_Int           B_ext_diag_size;
+   HYPRE_Complex      *B_ext_offd_data;
+   HYPRE_Int          *B_ext_offd_i;
+   HYPRE_Int          *B_ext_offd_j;
+   HYPRE_BigInt       *B_big_offd_j = NULL;
+   HYPRE_Int           B_ext_offd_size;
+
+   /* Interior rows of A have no entries in A_offd. The corresponding rows of C
+      are computed while B_ext is in flight, the boundary rows are added to
+      them afterwards */
+   void               *request;
+   HYPRE_Int          *map_B_to_B = NULL;
+   HYPRE_Int          *rows_int = NULL;
+   HYPRE_Int          *rows_bdry = NULL;
+   HYPRE_Int           num_rows_int = 0;
+   HYPRE_Int           num_rows_bdry = 0;
+
+   HYPRE_Int           allsquare = 0;
+   HYPRE_Int           num_procs;
+   HYPRE_Int          *my_diag_array;
+   HYPRE_Int          *my_offd_array;
+   HYPRE_Int           max_num_threads;
+   HYPRE_Int           i, ii;
+
+   HYPRE_MemoryLocation memory_location_A = hypre_ParCSRMatrixMemoryLocation(A);
+   HYPRE_MemoryLocation memory_location_B = hypre_ParCSRMatrixMemoryLocation(B);
+
+   /* RL: TODO cannot guarantee, maybe should never assert
+   hypre_assert(memory_location_A == memory_location_B);
+   */
+
+   /* RL: in the case of A=H, B=D, or A=D, B=H, let C = D,
+    * not sure if this is the right thing to do.
+    * Also, need something like this in other places
+    * TODO */
+   HYPRE_MemoryLocation memory_location_C = hypre_max(memory_location_A, memory_location_B);
+
+   HYPRE_ANNOTATE_FUNC_BEGIN;
+
+   max_num_threads = hypre_NumThreads();
+   my_diag_array = hypre_CTAlloc(HYPRE_Int, max_num_threads, HYPRE_MEMORY_HOST);
+   my_offd_array = hypre_CTAlloc(HYPRE_Int, max_num_threads, HYPRE_MEMORY_HOST);
+
+   if (ncols_A != nrows_B || num_cols_diag_A != num_rows_diag_B)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, " Error! Incompatible matrix dimensions!\n");
 
-   col_map_offd_C = hypre_UnorderedBigIntSetCopyToArray(&set, &num_cols_offd_C);
-   hypre_UnorderedBigIntSetDestroy(&set);
-   hypre_UnorderedBigIntMap col_map_offd_C_inverse;
-   hypre_big_sort_and_create_inverse_map(col_map_offd_C,
-                                         num_cols_offd_C,
-                                         &col_map_offd_C,
-                                         &col_map_offd_C_inverse);
+      HYPRE_ANNOTATE_FUNC_END;
+      return NULL;
+   }
 
-   HYPRE_Int i, j;
-   #pragma omp parallel for private(j) HYPRE_SMP_SCHEDULE
-   for (i = 0; i < num_cols_offd_A; i++)
+   /* if C=A*B is square globally and locally, then C_diag should be square also */
+   if ( num_rows_diag_A == num_cols_diag_B && nrows_A == ncols_B )
    {
-      for (j = B_ext_offd_i[i]; j < B_ext_offd_i[i + 1]; j++)
-      {
-         //B_ext_offd_j[j] = hypre_UnorderedIntMapGet(&col_map_offd_C_inverse, B_ext_offd_j[j]);
-         B_ext_offd_j[j] = hypre_UnorderedBigIntMapGet(&col_map_offd_C_inverse, B_big_offd_j[j]);
-      }
+      allsquare = 1;
    }
 
-   if (num_cols_offd_C)
+   /* Set rownnz of A */
+   if (num_rownnz_diag_A != num_rows_diag_A &&
+       num_rownnz_offd_A != num_rows_offd_A )
+   {
+      hypre_IntArray arr_diag;
+      hypre_IntArray arr_offd;
+      hypre_IntArray arr_rownnz;
+
+      hypre_IntArrayData(&arr_diag) = A_diag_ir;
+      hypre_IntArrayData(&arr_offd) = A_offd_ir;
+      hypre_IntArraySize(&arr_diag) = num_rownnz_diag_A;
+      hypre_IntArraySize(&arr_offd) = num_rownnz_offd_A;
+      hypre_IntArrayMemoryLocation(&arr_rownnz) = memory_location_A;
+
+      hypre_IntArrayMergeOrdered(&arr_diag, &arr_offd, &arr_rownnz);
+
+      num_rownnz_A = hypre_IntArraySize(&arr_rownnz);
+      rownnz_A     = hypre_IntArrayData(&arr_rownnz);
+   }
+   else
    {
-      hypre_UnorderedBigIntMapDestroy(&col_map_offd_C_inverse);
+      num_rownnz_A = hypre_max(num_rows_diag_A, num_rows_offd_A);
    }
 
-   hypre_TFree(my_diag_array, HYPRE_MEMORY_HOST);
-   hypre_TFree(my_offd_array, HYPRE_MEMORY_HOST);
+   /*-----------------------------------------------------------------------
+    *  Extract B_ext, i.e. portion of B that is stored on neighbor procs
+    *  and needed locally for matrix matrix product
+    *-----------------------------------------------------------------------*/
 
-   if (num_cols_offd_B)
+   /* The diagonal of C is stored first only if all rows of A are nonzero */
+   if (rownnz_A)
    {
-      HYPRE_Int i;
-      map_B_to_C = hypre_CTAlloc(HYPRE_Int, num_cols_offd_B, HYPRE_MEMORY_HOST);
+      allsquare = 0;
+   }
 
-      #pragma omp parallel private(i)
-      {
-         HYPRE_Int i_begin, i_end;
-         hypre_GetSimpleThreadPartition(&i_begin, &i_end, num_cols_offd_C);
+   hypre_MPI_Comm_size(comm, &num_procs);
 
-         HYPRE_Int cnt;
-         if (i_end > i_begin)
+   if (num_procs > 1)
+   {
+      /*---------------------------------------------------------------------
+       * If there exists no CommPkg for A, a CommPkg is generated using
+       * equally load balanced partitionings within
+       * hypre_ParCSRMatrixExtractBExtInit
+       *--------------------------------------------------------------------*/
+      hypre_ParCSRMatrixExtractBExtInit(B, A, 1, &request);
+
+      /*---------------------------------------------------------------------
+       * While B_ext is in flight, compute the rows of C belonging to
+       * interior rows of A, keeping the column numbering of B_offd
+       *--------------------------------------------------------------------*/
+      rows_int  = hypre_TAlloc(HYPRE_Int, num_rownnz_A, HYPRE_MEMORY_HOST);
+      rows_bdry = hypre_TAlloc(HYPRE_Int, num_rownnz_A, HYPRE_MEMORY_HOST);
+      for (i = 0; i < num_rownnz_A; i++)
+      {
+         ii = rownnz_A ? rownnz_A[i] : i;
+         if (num_cols_offd_A && A_offd_i[ii + 1] > A_offd_i[ii])
+         {
+            rows_bdry[num_rows_bdry++] = ii;
+         }
+         else
          {
-            cnt = hypre_BigLowerBound(col_map_offd_B,
-                                      col_map_offd_B + (HYPRE_BigInt)num_cols_offd_B,
-                                      col_map_offd_C[i_begin]) - col_map_offd_B;
+            rows_int[num_rows_int++] = ii;
          }
+      }
 
-         for (i = i_begin; i < i_end && cnt < num_cols_offd_B; i++)
+      if (num_rows_int)
+      {
+         if (num_cols_offd_B)
          {
-            if (col_map_offd_C[i] == col_map_offd_B[cnt])
+            map_B_to_B = hypre_TAlloc(HYPRE_Int, num_cols_offd_B, HYPRE_MEMORY_HOST);
+            for (i = 0; i < num_cols_offd_B; i++)
             {
-               map_B_to_C[cnt++] = i;
+               map_B_to_B[i] = i;
             }
          }
+
+         hypre_ParMatmul_Product(memory_location_C, rows_int, num_rows_int, num_rows_diag_A,
+                                 allsquare, A_diag_i, A_diag_j, A_diag_data,
+                                 0, NULL, NULL, NULL,
+                                 num_cols_diag_B, B_diag_i, B_diag_j, B_diag_data,
+                                 num_cols_offd_B, B_offd_i, B_offd_j, B_offd_data,
+                                 map_B_to_B, num_cols_offd_B,
+                                 NULL, NULL, NULL, NULL, NULL, NULL,
+                                 &C_diag_i, &C_diag_j, &C_diag_data, &C_diag_size,
+                                 &C_offd_i, &C_offd_j, &C_offd_data, &C_offd_size);
+
+         hypre_TFree(map_B_to_B, HYPRE_MEMORY_HOST);
       }
    }
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_RENUMBER_COLIDX] -= hypre_MPI_Wtime();
+#endif
+
    if (num_procs > 1)
    {
-      hypre_CSRMatrixDestroy(Bs_ext);
-      Bs_ext = NULL;
+      Bs_ext      = hypre_ParCSRMatrixExtractBExtWait(request);
+      Bs_ext_data = hypre_CSRMatrixData(Bs_ext);
+      Bs_ext_i    = hypre_CSRMatrixI(Bs_ext);
+      Bs_ext_j    = hypre_CSRMatrixBigJ(Bs_ext);
    }
+   B_ext_diag_i = hypre_CTAlloc(HYPRE_Int, num_cols_offd_A + 1, HYPRE_MEMORY_HOST);
+   B_ext_offd_i = hypre_CTAlloc(HYPRE_Int, num_cols_offd_A + 1, HYPRE_MEMORY_HOST);
+   B_ext_diag_size = 0;
+   B_ext_offd_size = 0;
+   last_col_diag_B = first_col_diag_B + (HYPRE_BigInt) num_cols_diag_B - 1;
 
-#else /* !HYPRE_CONCURRENT_HOPSCOTCH */
-
-   HYPRE_BigInt *temp;
 #ifdef HYPRE_USING_OPENMP
    #pragma omp parallel
 #endif
@@ -806,366 +1039,115 @@ hypre_ParMatmul( hypre_ParCSRMatrix  *A,
             B_ext_diag_data = hypre_CTAlloc(HYPRE_Complex, B_ext_diag_size, HYPRE_MEMORY_HOST);
          }
 
-         if (B_ext_offd_size)
-         {
-            B_ext_offd_j = hypre_CTAlloc(HYPRE_Int, B_ext_offd_size, HYPRE_MEMORY_HOST);
-            B_big_offd_j = hypre_CTAlloc(HYPRE_BigInt, B_ext_offd_size, HYPRE_MEMORY_HOST);
-            B_ext_offd_data = hypre_CTAlloc(HYPRE_Complex, B_ext_offd_size, HYPRE_MEMORY_HOST);
-         }
-
-         if (B_ext_offd_size || num_cols_offd_B)
-         {
-            temp = hypre_CTAlloc(HYPRE_BigInt, B_ext_offd_size + num_cols_offd_B, HYPRE_MEMORY_HOST);
-         }
-      }
-
-#ifdef HYPRE_USING_OPENMP
-      #pragma omp barrier
-#endif
-
-      cnt_offd = B_ext_offd_i[ns];
-      cnt_diag = B_ext_diag_i[ns];
-      for (i = ns; i < ne; i++)
-      {
-         for (j = Bs_ext_i[i]; j < Bs_ext_i[i + 1]; j++)
-         {
-            if (Bs_ext_j[j] < first_col_diag_B ||
-                Bs_ext_j[j] > last_col_diag_B)
-            {
-               temp[cnt_offd] = Bs_ext_j[j];
-               B_big_offd_j[cnt_offd] = Bs_ext_j[j];
-               //Bs_ext_j[cnt_offd] = Bs_ext_j[j];
-               B_ext_offd_data[cnt_offd++] = Bs_ext_data[j];
-            }
-            else
-            {
-               B_ext_diag_j[cnt_diag] = (HYPRE_Int)(Bs_ext_j[j] - first_col_diag_B);
-               B_ext_diag_data[cnt_diag++] = Bs_ext_data[j];
-            }
-         }
-      }
-
-#ifdef HYPRE_USING_OPENMP
-      #pragma omp barrier
-#endif
-
-      if (ii == 0)
-      {
-         HYPRE_Int cnt;
-
-         if (num_procs > 1)
-         {
-            hypre_CSRMatrixDestroy(Bs_ext);
-            Bs_ext = NULL;
-         }
-
-         cnt = 0;
-         if (B_ext_offd_size || num_cols_offd_B)
-         {
-            cnt = B_ext_offd_size;
-            for (i = 0; i < num_cols_offd_B; i++)
-            {
-               temp[cnt++] = col_map_offd_B[i];
-            }
-
-            if (cnt)
-            {
-               HYPRE_BigInt value;
-
-               hypre_BigQsort0(temp, 0, cnt - 1);
-               num_cols_offd_C = 1;
-               value = temp[0];
-               for (i = 1; i < cnt; i++)
-               {
-                  if (temp[i] > value)
-                  {
-                     value = temp[i];
-                     temp[num_cols_offd_C++] = value;
-                  }
-               }
-            }
-
-            if (num_cols_offd_C)
-            {
-               col_map_offd_C = hypre_CTAlloc(HYPRE_BigInt, num_cols_offd_C, HYPRE_MEMORY_HOST);
-            }
-
-            for (i = 0; i < num_cols_offd_C; i++)
-            {
-               col_map_offd_C[i] = temp[i];
-            }
-
-            hypre_TFree(temp, HYPRE_MEMORY_HOST);
-         }
-      }
-
-
-#ifdef HYPRE_USING_OPENMP
-      #pragma omp barrier
-#endif
-
-      for (i = ns; i < ne; i++)
-      {
-         for (j = B_ext_offd_i[i]; j < B_ext_offd_i[i + 1]; j++)
-         {
-            B_ext_offd_j[j] = hypre_BigBinarySearch(col_map_offd_C, B_big_offd_j[j],
-                                                    //B_ext_offd_j[j] = hypre_BigBinarySearch(col_map_offd_C, Bs_ext_j[j],
-                                                    num_cols_offd_C);
-         }
-      }
-
-   } /* end parallel region */
-   hypre_TFree(B_big_offd_j, HYPRE_MEMORY_HOST);
-
-   hypre_TFree(my_diag_array, HYPRE_MEMORY_HOST);
-   hypre_TFree(my_offd_array, HYPRE_MEMORY_HOST);
-
-   if (num_cols_offd_B)
-   {
-      HYPRE_Int i, cnt;
-      map_B_to_C = hypre_CTAlloc(HYPRE_Int, num_cols_offd_B, HYPRE_MEMORY_HOST);
-
-      cnt = 0;
-      for (i = 0; i < num_cols_offd_C; i++)
-      {
-         if (col_map_offd_C[i] == col_map_offd_B[cnt])
-         {
-            map_B_to_C[cnt++] = i;
-            if (cnt == num_cols_offd_B) { break; }
-         }
-      }
-   }
-
-#endif /* !HYPRE_CONCURRENT_HOPSCOTCH */
-
-#ifdef HYPRE_PROFILE
-   hypre_profile_times[HYPRE_TIMER_ID_RENUMBER_COLIDX] += hypre_MPI_Wtime();
-#endif
-
-   HYPRE_ANNOTATE_REGION_BEGIN("%s", "First pass");
-   hypre_ParMatmul_RowSizes(memory_location_C, &C_diag_i, &C_offd_i,
-                            rownnz_A, A_diag_i, A_diag_j,
-                            A_offd_i, A_offd_j,
-                            B_diag_i, B_diag_j,
-                            B_offd_i, B_offd_j,
-                            B_ext_diag_i, B_ext_diag_j,
-                            B_ext_offd_i, B_ext_offd_j, map_B_to_C,
-                            &C_diag_size, &C_offd_size,
-                            num_rownnz_A, num_rows_diag_A, num_cols_offd_A,
-                            allsquare, num_cols_diag_B, num_cols_offd_B,
-                            num_cols_offd_C);
-   HYPRE_ANNOTATE_REGION_END("%s", "First pass");
-
-   /*-----------------------------------------------------------------------
-    *  Allocate C_diag_data and C_diag_j arrays.
-    *  Allocate C_offd_data and C_offd_j arrays.
-    *-----------------------------------------------------------------------*/
-
-   last_col_diag_B = first_col_diag_B + (HYPRE_BigInt)num_cols_diag_B - 1;
-   C_diag_data = hypre_CTAlloc(HYPRE_Complex, C_diag_size, memory_location_C);
-   C_diag_j    = hypre_CTAlloc(HYPRE_Int, C_diag_size, memory_location_C);
-   if (C_offd_size)
-   {
-      C_offd_data = hypre_CTAlloc(HYPRE_Complex, C_offd_size, memory_location_C);
-      C_offd_j    = hypre_CTAlloc(HYPRE_Int, C_offd_size, memory_location_C);
-   }
-
-   /*-----------------------------------------------------------------------
-    *  Second Pass: Fill in C_diag_data and C_diag_j.
-    *  Second Pass: Fill in C_offd_data and C_offd_j.
-    *-----------------------------------------------------------------------*/
-
-   HYPRE_ANNOTATE_REGION_BEGIN("%s", "Second pass");
-
-#ifdef HYPRE_USING_OPENMP
-   #pragma omp parallel
-#endif
-   {
-      HYPRE_Int     *B_marker = NULL;
-      HYPRE_Int      ns, ne, size, rest, ii;
-      HYPRE_Int      i1, ii1, i2, i3, jj2, jj3;
-      HYPRE_Int      jj_row_begin_diag, jj_count_diag;
-      HYPRE_Int      jj_row_begin_offd, jj_count_offd;
-      HYPRE_Int      num_threads;
-      HYPRE_Complex  a_entry; /*, a_b_product;*/
-
-      num_threads = hypre_NumActiveThreads();
-      size = num_rownnz_A / num_threads;
-      rest = num_rownnz_A - size * num_threads;
-
-      ii = hypre_GetThreadNum();
-      if (ii < rest)
-      {
-         ns = ii * size + ii;
-         ne = (ii + 1) * size + ii + 1;
-      }
-      else
-      {
-         ns = ii * size + rest;
-         ne = (ii + 1) * size + rest;
-      }
-      jj_count_diag = C_diag_i[rownnz_A ? rownnz_A[ns] : ns];
-      jj_count_offd = C_offd_i[rownnz_A ? rownnz_A[ns] : ns];
-
-      if (num_cols_diag_B || num_cols_offd_C)
-      {
-         B_marker = hypre_CTAlloc(HYPRE_Int, num_cols_diag_B + num_cols_offd_C,
-                                  HYPRE_MEMORY_HOST);
-         for (i1 = 0; i1 < num_cols_diag_B + num_cols_offd_C; i1++)
-         {
-            B_marker[i1] = -1;
-         }
-      }
-
-      /*-----------------------------------------------------------------------
-       *  Loop over interior c-points.
-       *-----------------------------------------------------------------------*/
-      for (i1 = ns; i1 < ne; i1++)
-      {
-         jj_row_begin_diag = jj_count_diag;
-         jj_row_begin_offd = jj_count_offd;
-         if (rownnz_A)
+         if (B_ext_offd_size)
          {
-            ii1 = rownnz_A[i1];
+            B_ext_offd_j = hypre_CTAlloc(HYPRE_Int, B_ext_offd_size, HYPRE_MEMORY_HOST);
+            B_big_offd_j = hypre_CTAlloc(HYPRE_BigInt, B_ext_offd_size, HYPRE_MEMORY_HOST);
+            B_ext_offd_data = hypre_CTAlloc(HYPRE_Complex, B_ext_offd_size, HYPRE_MEMORY_HOST);
          }
-         else
-         {
-            ii1 = i1;
+      }
 
-            /*--------------------------------------------------------------------
-             *  Create diagonal entry, C_{i1,i1}
-             *--------------------------------------------------------------------*/
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp barrier
+#endif
 
-            if (allsquare)
+      cnt_offd = B_ext_offd_i[ns];
+      cnt_diag = B_ext_diag_i[ns];
+      for (i = ns; i < ne; i++)
+      {
+         for (j = Bs_ext_i[i]; j < Bs_ext_i[i + 1]; j++)
+         {
+            if (Bs_ext_j[j] < first_col_diag_B ||
+                Bs_ext_j[j] > last_col_diag_B)
             {
-               B_marker[i1] = jj_count_diag;
-               C_diag_data[jj_count_diag] = zero;
-               C_diag_j[jj_count_diag] = i1;
-               jj_count_diag++;
+               B_big_offd_j[cnt_offd] = Bs_ext_j[j];
+               //Bs_ext_j[cnt_offd] = Bs_ext_j[j];
+               B_ext_offd_data[cnt_offd++] = Bs_ext_data[j];
             }
-         }
-
-         /*-----------------------------------------------------------------
-          *  Loop over entries in row i1 of A_offd.
-          *-----------------------------------------------------------------*/
-
-         if (num_cols_offd_A)
-         {
-            for (jj2 = A_offd_i[ii1]; jj2 < A_offd_i[ii1 + 1]; jj2++)
+            else
             {
-               i2 = A_offd_j[jj2];
-               a_entry = A_offd_data[jj2];
-
-               /*-----------------------------------------------------------
-                *  Loop over entries in row i2 of B_ext.
-                *-----------------------------------------------------------*/
-
-               for (jj3 = B_ext_offd_i[i2]; jj3 < B_ext_offd_i[i2 + 1]; jj3++)
-               {
-                  i3 = num_cols_diag_B + B_ext_offd_j[jj3];
-
-                  /*--------------------------------------------------------
-                   *  Check B_marker to see that C_{ii1,i3} has not already
-                   *  been accounted for. If it has not, create a new entry.
-                   *  If it has, add new contribution.
-                   *--------------------------------------------------------*/
-
-                  if (B_marker[i3] < jj_row_begin_offd)
-                  {
-                     B_marker[i3] = jj_count_offd;
-                     C_offd_data[jj_count_offd] = a_entry * B_ext_offd_data[jj3];
-                     C_offd_j[jj_count_offd] = i3 - num_cols_diag_B;
-                     jj_count_offd++;
-                  }
-                  else
-                  {
-                     C_offd_data[B_marker[i3]] += a_entry * B_ext_offd_data[jj3];
-                  }
-               }
-               for (jj3 = B_ext_diag_i[i2]; jj3 < B_ext_diag_i[i2 + 1]; jj3++)
-               {
-                  i3 = B_ext_diag_j[jj3];
-                  if (B_marker[i3] < jj_row_begin_diag)
-                  {
-                     B_marker[i3] = jj_count_diag;
-                     C_diag_data[jj_count_diag] = a_entry * B_ext_diag_data[jj3];
-                     C_diag_j[jj_count_diag] = i3;
-                     jj_count_diag++;
-                  }
-                  else
-                  {
-                     C_diag_data[B_marker[i3]] += a_entry * B_ext_diag_data[jj3];
-                  }
-               }
+               B_ext_diag_j[cnt_diag] = (HYPRE_Int)(Bs_ext_j[j] - first_col_diag_B);
+               B_ext_diag_data[cnt_diag++] = Bs_ext_data[j];
             }
          }
+      }
+   } /* end parallel region */
 
-         /*-----------------------------------------------------------------
-          *  Loop over entries in row ii1 of A_diag.
-          *-----------------------------------------------------------------*/
+   if (num_procs > 1)
+   {
+      hypre_CSRMatrixDestroy(Bs_ext);
+      Bs_ext = NULL;
+   }
 
-         for (jj2 = A_diag_i[ii1]; jj2 < A_diag_i[ii1 + 1]; jj2++)
-         {
-            i2 = A_diag_j[jj2];
-            a_entry = A_diag_data[jj2];
+   hypre_TFree(my_diag_array, HYPRE_MEMORY_HOST);
+   hypre_TFree(my_offd_array, HYPRE_MEMORY_HOST);
 
-            /*-----------------------------------------------------------
-             *  Loop over entries in row i2 of B_diag.
-             *-----------------------------------------------------------*/
+   /* col_map_offd_C, local B_ext_offd_j and the map from B's offd columns */
+   if (num_cols_offd_B)
+   {
+      map_B_to_C = hypre_CTAlloc(HYPRE_Int, num_cols_offd_B, HYPRE_MEMORY_HOST);
+   }
+   hypre_GlobalToLocalColumns(B_ext_offd_size, B_big_offd_j, num_cols_offd_B, col_map_offd_B,
+                              B_ext_offd_j, map_B_to_C, &num_cols_offd_C, &col_map_offd_C);
+   hypre_TFree(B_big_offd_j, HYPRE_MEMORY_HOST);
 
-            for (jj3 = B_diag_i[i2]; jj3 < B_diag_i[i2 + 1]; jj3++)
-            {
-               i3 = B_diag_j[jj3];
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_RENUMBER_COLIDX] += hypre_MPI_Wtime();
+#endif
 
-               /*--------------------------------------------------------
-                *  Check B_marker to see that C_{ii1,i3} has not already
-                *  been accounted for. If it has not, create a new entry.
-                *  If it has, add new contribution.
-                *--------------------------------------------------------*/
+   if (num_procs > 1)
+   {
+      /* Renumber the offd columns of the interior rows */
+#if defined(HYPRE_USING_OPENMP)
+      #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < C_offd_size; i++)
+      {
+         C_offd_j[i] = map_B_to_C[C_offd_j[i]];
+      }
 
-               if (B_marker[i3] < jj_row_begin_diag)
-               {
-                  B_marker[i3] = jj_count_diag;
-                  C_diag_data[jj_count_diag] = a_entry * B_diag_data[jj3];
-                  C_diag_j[jj_count_diag] = i3;
-                  jj_count_diag++;
-               }
-               else
-               {
-                  C_diag_data[B_marker[i3]] += a_entry * B_diag_data[jj3];
-               }
-            }
-            if (num_cols_offd_B)
-            {
-               for (jj3 = B_offd_i[i2]; jj3 < B_offd_i[i2 + 1]; jj3++)
-               {
-                  i3 = num_cols_diag_B + map_B_to_C[B_offd_j[jj3]];
+      /*-----------------------------------------------------------------------
+       *  Compute the rows of C belonging to boundary rows of A, directly in
+       *  the arrays holding the interior rows
+       *-----------------------------------------------------------------------*/
 
-                  /*--------------------------------------------------------
-                   *  Check B_marker to see that C_{ii1,i3} has not already
-                   *  been accounted for. If it has not, create a new entry.
-                   *  If it has, add new contribution.
-                   *--------------------------------------------------------*/
+      if (num_rows_bdry)
+      {
+         hypre_ParMatmul_Product(memory_location_C, rows_bdry, num_rows_bdry, num_rows_diag_A,
+                                 allsquare, A_diag_i, A_diag_j, A_diag_data,
+                                 num_cols_offd_A, A_offd_i, A_offd_j, A_offd_data,
+                                 num_cols_diag_B, B_diag_i, B_diag_j, B_diag_data,
+                                 num_cols_offd_B, B_offd_i, B_offd_j, B_offd_data,
+                                 map_B_to_C, num_cols_offd_C,
+                                 B_ext_diag_i, B_ext_diag_j, B_ext_diag_data,
+                                 B_ext_offd_i, B_ext_offd_j, B_ext_offd_data,
+                                 &C_diag_i, &C_diag_j, &C_diag_data, &C_diag_size,
+                                 &C_offd_i, &C_offd_j, &C_offd_data, &C_offd_size);
+      }
 
-                  if (B_marker[i3] < jj_row_begin_offd)
-                  {
-                     B_marker[i3] = jj_count_offd;
-                     C_offd_data[jj_count_offd] = a_entry * B_offd_data[jj3];
-                     C_offd_j[jj_count_offd] = i3 - num_cols_diag_B;
-                     jj_count_offd++;
-                  }
-                  else
-                  {
-                     C_offd_data[B_marker[i3]] += a_entry * B_offd_data[jj3];
-                  }
-               }
-            }
-         }
+      /* A has no nonzero rows */
+      if (!C_diag_i)
+      {
+         C_diag_i = hypre_CTAlloc(HYPRE_Int, num_rows_diag_A + 1, memory_location_C);
+         C_offd_i = hypre_CTAlloc(HYPRE_Int, num_rows_diag_A + 1, memory_location_C);
       }
 
-      hypre_TFree(B_marker, HYPRE_MEMORY_HOST);
-   } /*end parallel region */
-   HYPRE_ANNOTATE_REGION_END("%s", "Second pass");
+      hypre_TFree(rows_int, HYPRE_MEMORY_HOST);
+      hypre_TFree(rows_bdry, HYPRE_MEMORY_HOST);
+   }
+   else
+   {
+      hypre_ParMatmul_Product(memory_location_C, rownnz_A, num_rownnz_A, num_rows_diag_A,
+                              allsquare, A_diag_i, A_diag_j, A_diag_data,
+                              num_cols_offd_A, A_offd_i, A_offd_j, A_offd_data,
+                              num_cols_diag_B, B_diag_i, B_diag_j, B_diag_data,
+                              num_cols_offd_B, B_offd_i, B_offd_j, B_offd_data,
+                              map_B_to_C, num_cols_offd_C,
+                              B_ext_diag_i, B_ext_diag_j, B_ext_diag_data,
+                              B_ext_offd_i, B_ext_offd_j, B_ext_offd_data,
+                              &C_diag_i, &C_diag_j, &C_diag_data, &C_diag_size,
+                              &C_offd_i, &C_offd_j, &C_offd_data, &C_offd_size);
+   }
 
    C = hypre_ParCSRMatrixCreate(comm, nrows_A, ncols_B, row_starts_A,
                                 col_starts_B, num_cols_offd_C,
@@ -1800,6 +1782,43 @@ hypre_ParCSRMatrixExtractBExt_Overlap( hypre_ParCSRMatrix *B,
    return B_ext;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixExtractBExtInit : starts the communication of the rows of
+ * B needed for multiplication with A locally. The rows are obtained from the
+ * returned request with hypre_ParCSRMatrixExtractBExtWait, so that local work
+ * can be done while messages are in flight.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRMatrixExtractBExtInit( hypre_ParCSRMatrix  *B,
+                                   hypre_ParCSRMatrix  *A,
+                                   HYPRE_Int            want_data,
+                                   void               **request_ptr )
+{
+   hypre_assert( hypre_CSRMatrixMemoryLocation(hypre_ParCSRMatrixDiag(B)) ==
+                 hypre_CSRMatrixMemoryLocation(hypre_ParCSRMatrixOffd(B)) );
+
+   if (!hypre_ParCSRMatrixCommPkg(A))
+   {
+      hypre_MatvecCommPkgCreate(A);
+   }
+
+   hypre_ParcsrGetExternalRowsInit(B,
+                                   hypre_CSRMatrixNumCols(hypre_ParCSRMatrixOffd(A)),
+                                   hypre_ParCSRMatrixColMapOffd(A),
+                                   hypre_ParCSRMatrixCommPkg(A),
+                                   want_data,
+                                   request_ptr);
+
+   return hypre_error_flag;
+}
+
+hypre_CSRMatrix *
+hypre_ParCSRMatrixExtractBExtWait( void *request )
+{
+   return hypre_ParcsrGetExternalRowsWait(request);
+}
+
 hypre_CSRMatrix *
 hypre_ParCSRMatrixExtractBExt( hypre_ParCSRMatrix *B,
                                hypre_ParCSRMatrix *A,
@@ -1822,25 +1841,11 @@ hypre_ParCSRMatrixExtractBExt( hypre_ParCSRMatrix *B,
       hypre_TFree(send_data, HYPRE_MEMORY_HOST);
    }
 #else
-   hypre_assert( hypre_CSRMatrixMemoryLocation(hypre_ParCSRMatrixDiag(B)) ==
-                 hypre_CSRMatrixMemoryLocation(hypre_ParCSRMatrixOffd(B)) );
-
    hypre_CSRMatrix *B_ext;
    void            *request;
 
-   if (!hypre_ParCSRMatrixCommPkg(A))
-   {
-      hypre_MatvecCommPkgCreate(A);
-   }
-
-   hypre_ParcsrGetExternalRowsInit(B,
-                                   hypre_CSRMatrixNumCols(hypre_ParCSRMatrixOffd(A)),
-                                   hypre_ParCSRMatrixColMapOffd(A),
-                                   hypre_ParCSRMatrixCommPkg(A),
-                                   want_data,
-                                   &request);
-
-   B_ext = hypre_ParcsrGetExternalRowsWait(request);
+   hypre_ParCSRMatrixExtractBExtInit(B, A, want_data, &request);
+   B_ext = hypre_ParCSRMatrixExtractBExtWait(request);
 #endif
 
    return B_ext;
@@ -1867,7 +1872,6 @@ hypre_ParCSRMatrixTransposeHost( hypre_ParCSRMatrix  *A,
    HYPRE_Int                num_cols_offd = hypre_CSRMatrixNumCols(A_offd);
    HYPRE_Int                num_sends, num_recvs, num_cols_offd_AT;
    HYPRE_Int                i, j, k, index, counter, j_row;
-   HYPRE_BigInt             value;
 
    hypre_ParCSRMatrix      *AT;
    hypre_CSRMatrix         *AT_diag;
@@ -2069,34 +2073,6 @@ hypre_ParCSRMatrixTransposeHost( hypre_ParCSRMatrix  *A,
       }
       AT_offd_i[0] = 0;
 
-      if (counter)
-      {
-         hypre_BigQsort0(AT_buf_j, 0, counter - 1);
-         num_cols_offd_AT = 1;
-         value = AT_buf_j[0];
-         for (i = 1; i < counter; i++)
-         {
-            if (value < AT_buf_j[i])
-            {
-               AT_buf_j[num_cols_offd_AT++] = AT_buf_j[i];
-               value = AT_buf_j[i];
-            }
-         }
-      }
-
-      if (num_cols_offd_AT)
-      {
-         col_map_offd_AT = hypre_CTAlloc(HYPRE_BigInt, num_cols_offd_AT, HYPRE_MEMORY_HOST);
-      }
-      else
-      {
-         col_map_offd_AT = NULL;
-      }
-
-      for (i = 0; i < num_cols_offd_AT; i++)
-      {
-         col_map_offd_AT[i] = AT_buf_j[i];
-      }
       hypre_TFree(AT_buf_i, HYPRE_MEMORY_HOST);
       hypre_TFree(AT_buf_j, HYPRE_MEMORY_HOST);
       if (data)
@@ -2104,11 +2080,8 @@ hypre_ParCSRMatrixTransposeHost( hypre_ParCSRMatrix  *A,
          hypre_TFree(AT_buf_data, HYPRE_MEMORY_HOST);
       }
 
-      for (i = 0; i < counter; i++)
-      {
-         AT_offd_j[i] = hypre_BigBinarySearch(col_map_offd_AT, AT_big_j[i],
-                                              num_cols_offd_AT);
-      }
+      hypre_GlobalToLocalColumns(counter, AT_big_j, 0, NULL, AT_offd_j, NULL,
+                                 &num_cols_offd_AT, &col_map_offd_AT);
       hypre_TFree(AT_big_j, HYPRE_MEMORY_HOST);
    }
 
@@ -3488,7 +3461,7 @@ hypre_ParTMatmul( hypre_ParCSRMatrix  *A,
 
    hypre_ParCSRMatrix *C;
    HYPRE_BigInt       *col_map_offd_C = NULL;
-   HYPRE_Int          *map_B_to_C;
+   HYPRE_Int          *map_B_to_C = NULL;
 
    hypre_CSRMatrix *C_diag = NULL;
    hypre_CSRMatrix *C_tmp_diag = NULL;
@@ -3542,8 +3515,7 @@ hypre_ParTMatmul( hypre_ParCSRMatrix  *A,
    HYPRE_BigInt     nrows_A, ncols_A;
    HYPRE_BigInt     nrows_B, ncols_B;
    /*HYPRE_Int              allsquare = 0;*/
-   HYPRE_Int        cnt, cnt_offd, cnt_diag;
-   HYPRE_BigInt     value;
+   HYPRE_Int        cnt_offd, cnt_diag;
    HYPRE_Int        num_procs, my_id;
    HYPRE_Int        max_num_threads;
    HYPRE_Int       *C_diag_array = NULL;
@@ -3676,37 +3648,6 @@ hypre_ParTMatmul( hypre_ParCSRMatrix  *A,
          C_ext_diag_i[i + 1] = C_ext_diag_size;
          C_ext_offd_i[i + 1] = C_ext_offd_size;
       }
-      cnt = C_ext_offd_size;
-      for (i = 0; i < num_cols_offd_B; i++)
-      {
-         temp[cnt++] = col_map_offd_B[i];
-      }
-
-      if (cnt)
-      {
-         hypre_BigQsort0(temp, 0, cnt - 1);
-         value = temp[0];
-         num_cols_offd_C = 1;
-         for (i = 1; i < cnt; i++)
-         {
-            if (temp[i] > value)
-            {
-               value = temp[i];
-               temp[num_cols_offd_C++] = value;
-            }
-         }
-      }
-
-      if (num_cols_offd_C)
-      {
-         col_map_offd_C = hypre_CTAlloc(HYPRE_BigInt, num_cols_offd_C, HYPRE_MEMORY_HOST);
-      }
-      for (i = 0; i < num_cols_offd_C; i++)
-      {
-         col_map_offd_C[i] = temp[i];
-      }
-
-      hypre_TFree(temp, HYPRE_MEMORY_HOST);
 
       if (C_ext_diag_size)
       {
@@ -3718,6 +3659,15 @@ hypre_ParTMatmul( hypre_ParCSRMatrix  *A,
          C_ext_offd_j = hypre_CTAlloc(HYPRE_Int,  C_ext_offd_size, HYPRE_MEMORY_HOST);
          C_ext_offd_data = hypre_CTAlloc(HYPRE_Complex,  C_ext_offd_size, HYPRE_MEMORY_HOST);
       }
+      if (num_cols_offd_B)
+      {
+         map_B_to_C = hypre_CTAlloc(HYPRE_Int, num_cols_offd_B, HYPRE_MEMORY_HOST);
+      }
+
+      /* col_map_offd_C, local C_ext_offd_j and the map from B's offd columns */
+      hypre_GlobalToLocalColumns(C_ext_offd_size, temp, num_cols_offd_B, col_map_offd_B,
+                                 C_ext_offd_j, map_B_to_C, &num_cols_offd_C, &col_map_offd_C);
+      hypre_TFree(temp, HYPRE_MEMORY_HOST);
 
       C_tmp_diag_j = hypre_CSRMatrixJ(C_tmp_diag);
       C_tmp_diag_data = hypre_CSRMatrixData(C_tmp_diag);
@@ -3735,9 +3685,6 @@ hypre_ParTMatmul( hypre_ParCSRMatrix  *A,
             if (C_ext_j[j] < first_col_diag_C ||
                 C_ext_j[j] > last_col_diag_C)
             {
-               C_ext_offd_j[cnt_offd] = hypre_BigBinarySearch(col_map_offd_C,
-                                                              C_ext_j[j],
-                                                              num_cols_offd_C);
                C_ext_offd_data[cnt_offd++] = C_ext_data[j];
             }
             else
@@ -3757,17 +3704,6 @@ hypre_ParTMatmul( hypre_ParCSRMatrix  *A,
 
    if (num_cols_offd_B)
    {
-      map_B_to_C = hypre_CTAlloc(HYPRE_Int, num_cols_offd_B, HYPRE_MEMORY_HOST);
-
-      cnt = 0;
-      for (i = 0; i < num_cols_offd_C; i++)
-      {
-         if (col_map_offd_C[i] == col_map_offd_B[cnt])
-         {
-            map_B_to_C[cnt++] = i;
-            if (cnt == num_cols_offd_B) { break; }
-         }
-      }
       for (i = 0; i < hypre_CSRMatrixI(C_tmp_offd)[hypre_CSRMatrixNumRows(C_tmp_offd)]; i++)
       {
          j_indx = C_tmp_offd_j[i];
@@ -6221,6 +6157,9 @@ hypre_ParCSRMatrixDropSmallEntries( hypre_ParCSRMatrix *A,
    hypre_GpuProfilingPushRange("ParCSRMatrixDropSmallEntries");
 #endif
 
+   hypre_ParCSRMatrixDestroyMergedLayout(A);
+   hypre_CSRMatrixUncompressIndices(hypre_ParCSRMatrixDiag(A));
+
    HYPRE_Int ierr = 0;
 
 #if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_HIP)
@@ -6258,6 +6197,8 @@ hypre_ParCSRMatrixScale(hypre_ParCSRMatrix *A,
    hypre_CSRMatrix *A_diag = hypre_ParCSRMatrixDiag(A);
    hypre_CSRMatrix *A_offd = hypre_ParCSRMatrixOffd(A);
 
+   hypre_ParCSRMatrixDestroyMergedLayout(A);
+
    hypre_CSRMatrixScale(A_diag, scalar);
    hypre_CSRMatrixScale(A_offd, scalar);
 
@@ -6284,6 +6225,7 @@ hypre_ParCSRMatrixReorder(hypre_ParCSRMatrix *A)
       return hypre_error_flag;
    }
 
+   hypre_ParCSRMatrixDestroyMergedLayout(A);
    hypre_CSRMatrixReorder(A_diag);
 
    return hypre_error_flag;
@@ -0,0 +1,584 @@
+/******************************************************************************
+ * Copyright (c) 1998 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Matrix powers kernel: computes A x, A^2 x, ..., A^k x with a single halo
+ * exchange, by replicating the rows of A on a ghost region of depth k.
+ *
+ *****************************************************************************/
+
+#include "_hypre_parcsr_mv.h"
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatPowersCreate
+ *
+ * Sets up the ghost region of depth num_powers for the square matrix A.
+ * If scale is not NULL, the kernel applies diag(scale) A diag(scale)
+ * instead of A, where scale is given on the local rows.
+ *--------------------------------------------------------------------------*/
+
+hypre_ParCSRMatPowers *
+hypre_ParCSRMatPowersCreate( hypre_ParCSRMatrix *A,
+                             HYPRE_Int           num_powers,
+                             HYPRE_Real         *scale )
+{
+   MPI_Comm                 comm          = hypre_ParCSRMatrixComm(A);
+   HYPRE_BigInt             global_num    = hypre_ParCSRMatrixGlobalNumRows(A);
+   HYPRE_BigInt             first_row     = hypre_ParCSRMatrixFirstRowIndex(A);
+   HYPRE_BigInt            *row_starts    = hypre_ParCSRMatrixRowStarts(A);
+   HYPRE_BigInt            *col_map_offd  = hypre_ParCSRMatrixColMapOffd(A);
+   HYPRE_Int                num_rows      = hypre_ParCSRMatrixNumRows(A);
+   HYPRE_Int                num_cols_offd = hypre_CSRMatrixNumCols(hypre_ParCSRMatrixOffd(A));
+   HYPRE_BigInt             end_row       = first_row + (HYPRE_BigInt) num_rows;
+
+   hypre_ParCSRMatPowers   *mp;
+   hypre_ParCSRCommPkg     *ext_comm_pkg;
+   hypre_ParCSRCommPkg     *comm_pkg;
+   hypre_ParCSRCommHandle  *comm_handle;
+   hypre_CSRMatrix        **A_ext;
+   hypre_CSRMatrix         *ghost_rows;
+   void                    *request;
+
+   HYPRE_Int               *ghost_starts;
+   HYPRE_BigInt            *ghost_map;
+   HYPRE_BigInt            *sorted_map;
+   HYPRE_Int               *sorted_idx;
+   HYPRE_Int               *recv_perm;
+   HYPRE_Int                ghost_map_size;
+   HYPRE_Int                num_ghosts, num_new, num_sends;
+
+   HYPRE_Int               *A_ext_i;
+   HYPRE_BigInt            *A_ext_j;
+   HYPRE_Complex           *A_ext_data;
+   HYPRE_Int               *ghost_rows_i;
+   HYPRE_Int               *ghost_rows_j;
+   HYPRE_Complex           *ghost_rows_data;
+   HYPRE_Int                num_ghost_rows, nnz;
+
+   HYPRE_Real              *scale_ext = NULL;
+   HYPRE_Complex           *scale_buf, *scale_recv;
+
+   HYPRE_BigInt             col;
+   HYPRE_Int                d, i, j, k, cnt;
+
+   if (num_powers < 1)
+   {
+      hypre_error_in_arg(2);
+      return NULL;
+   }
+
+   if (!hypre_ParCSRMatrixAssumedPartition(A))
+   {
+      hypre_ParCSRMatrixCreateAssumedPartition(A);
+   }
+
+   /*-----------------------------------------------------------------------
+    * Distance one ghosts are the off-processor columns of A
+    *-----------------------------------------------------------------------*/
+
+   ghost_starts   = hypre_CTAlloc(HYPRE_Int, num_powers + 1, HYPRE_MEMORY_HOST);
+   ghost_map_size = hypre_max(2 * num_cols_offd, 1);
+   ghost_map      = hypre_TAlloc(HYPRE_BigInt, ghost_map_size, HYPRE_MEMORY_HOST);
+   sorted_map     = hypre_TAlloc(HYPRE_BigInt, ghost_map_size, HYPRE_MEMORY_HOST);
+   for (i = 0; i < num_cols_offd; i++)
+   {
+      ghost_map[i]  = col_map_offd[i];
+      sorted_map[i] = col_map_offd[i];
+   }
+   ghost_starts[1] = num_cols_offd;
+
+   /*-----------------------------------------------------------------------
+    * Fetch the rows at distance d and collect the ghosts at distance d+1
+    *-----------------------------------------------------------------------*/
+
+   A_ext = hypre_CTAlloc(hypre_CSRMatrix *, num_powers, HYPRE_MEMORY_HOST);
+   for (d = 1; d < num_powers; d++)
+   {
+      HYPRE_Int     num_ext  = ghost_starts[d] - ghost_starts[d - 1];
+      HYPRE_BigInt *ext_map  = ghost_map + ghost_starts[d - 1];
+
+      hypre_ParCSRFindExtendCommPkg(comm, global_num, first_row, num_rows, row_starts,
+                                    hypre_ParCSRMatrixAssumedPartition(A),
+                                    num_ext, ext_map, &ext_comm_pkg);
+      hypre_ParcsrGetExternalRowsInit(A, num_ext, ext_map, ext_comm_pkg, 1, &request);
+      A_ext[d - 1] = hypre_ParcsrGetExternalRowsWait(request);
+      hypre_MatvecCommPkgDestroy(ext_comm_pkg);
+
+      A_ext_i = hypre_CSRMatrixI(A_ext[d - 1]);
+      A_ext_j = hypre_CSRMatrixBigJ(A_ext[d - 1]);
+      nnz     = A_ext_i[num_ext];
+
+      if (ghost_starts[d] + nnz > ghost_map_size)
+      {
+         ghost_map_size = 2 * (ghost_starts[d] + nnz);
+         ghost_map  = hypre_TReAlloc(ghost_map,  HYPRE_BigInt, ghost_map_size, HYPRE_MEMORY_HOST);
+         sorted_map = hypre_TReAlloc(sorted_map, HYPRE_BigInt, ghost_map_size, HYPRE_MEMORY_HOST);
+      }
+
+      /* sorted_map holds the ghosts found so far in ascending order */
+      hypre_BigQsort0(sorted_map, 0, ghost_starts[d] - 1);
+
+      num_new = 0;
+      for (j = 0; j < nnz; j++)
+      {
+         col = A_ext_j[j];
+         if (col >= first_row && col < end_row)
+         {
+            continue;
+         }
+         if (hypre_BigBinarySearch(sorted_map, col, ghost_starts[d]) == -1)
+         {
+            ghost_map[ghost_starts[d] + num_new++] = col;
+         }
+      }
+
+      /* remove duplicates among the new ghosts */
+      if (num_new)
+      {
+         HYPRE_BigInt *new_map = ghost_map + ghost_starts[d];
+
+         hypre_BigQsort0(new_map, 0, num_new - 1);
+         k = 0;
+         for (j = 1; j < num_new; j++)
+         {
+            if (new_map[j] > new_map[k])
+            {
+               new_map[++k] = new_map[j];
+            }
+         }
+         num_new = k + 1;
+      }
+
+      for (j = ghost_starts[d]; j < ghost_starts[d] + num_new; j++)
+      {
+         sorted_map[j] = ghost_map[j];
+      }
+      ghost_starts[d + 1] = ghost_starts[d] + num_new;
+   }
+   num_ghosts = ghost_starts[num_powers];
+   hypre_TFree(sorted_map, HYPRE_MEMORY_HOST);
+
+   /* global to ghost index lookup */
+   sorted_map = hypre_TAlloc(HYPRE_BigInt, num_ghosts, HYPRE_MEMORY_HOST);
+   sorted_idx = hypre_TAlloc(HYPRE_Int, num_ghosts, HYPRE_MEMORY_HOST);
+   for (i = 0; i < num_ghosts; i++)
+   {
+      sorted_map[i] = ghost_map[i];
+      sorted_idx[i] = i;
+   }
+   hypre_BigQsortbi(sorted_map, sorted_idx, 0, num_ghosts - 1);
+
+   /*-----------------------------------------------------------------------
+    * Ghost rows in the local + ghost numbering
+    *-----------------------------------------------------------------------*/
+
+   num_ghost_rows = ghost_starts[num_powers - 1];
+   nnz = 0;
+   for (d = 1; d < num_powers; d++)
+   {
+      nnz += hypre_CSRMatrixI(A_ext[d - 1])[ghost_starts[d] - ghost_starts[d - 1]];
+   }
+
+   ghost_rows = hypre_CSRMatrixCreate(num_ghost_rows, num_rows + num_ghosts, nnz);
+   hypre_CSRMatrixInitialize_v2(ghost_rows, 0, HYPRE_MEMORY_HOST);
+   ghost_rows_i    = hypre_CSRMatrixI(ghost_rows);
+   ghost_rows_j    = hypre_CSRMatrixJ(ghost_rows);
+   ghost_rows_data = hypre_CSRMatrixData(ghost_rows);
+
+   cnt = 0;
+   ghost_rows_i[0] = 0;
+   for (d = 1; d < num_powers; d++)
+   {
+      A_ext_i    = hypre_CSRMatrixI(A_ext[d - 1]);
+      A_ext_j    = hypre_CSRMatrixBigJ(A_ext[d - 1]);
+      A_ext_data = hypre_CSRMatrixData(A_ext[d - 1]);
+
+      for (i = 0; i < ghost_starts[d] - ghost_starts[d - 1]; i++)
+      {
+         for (j = A_ext_i[i]; j < A_ext_i[i + 1]; j++)
+         {
+            col = A_ext_j[j];
+            if (col >= first_row && col < end_row)
+            {
+               ghost_rows_j[cnt] = (HYPRE_Int) (col - first_row);
+            }
+            else
+            {
+               k = hypre_BigBinarySearch(sorted_map, col, num_ghosts);
+               ghost_rows_j[cnt] = num_rows + sorted_idx[k];
+            }
+            ghost_rows_data[cnt++] = A_ext_data[j];
+         }
+         ghost_rows_i[ghost_starts[d - 1] + i + 1] = cnt;
+      }
+      hypre_CSRMatrixDestroy(A_ext[d - 1]);
+   }
+   hypre_TFree(A_ext, HYPRE_MEMORY_HOST);
+
+   /*-----------------------------------------------------------------------
+    * Communication package for all ghosts, ordered by global index
+    *-----------------------------------------------------------------------*/
+
+   hypre_ParCSRFindExtendCommPkg(comm, global_num, first_row, num_rows, row_starts,
+                                 hypre_ParCSRMatrixAssumedPartition(A),
+                                 num_ghosts, sorted_map, &comm_pkg);
+   num_sends = hypre_ParCSRCommPkgNumSends(comm_pkg);
+   recv_perm = sorted_idx;
+
+   /*-----------------------------------------------------------------------
+    * Scaling on the ghost region
+    *-----------------------------------------------------------------------*/
+
+   if (scale)
+   {
+      scale_ext  = hypre_TAlloc(HYPRE_Real, num_rows + num_ghosts, HYPRE_MEMORY_HOST);
+      scale_buf  = hypre_TAlloc(HYPRE_Complex, hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends),
+                                HYPRE_MEMORY_HOST);
+      scale_recv = hypre_TAlloc(HYPRE_Complex, num_ghosts, HYPRE_MEMORY_HOST);
+
+      for (i = 0; i < hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends); i++)
+      {
+         scale_buf[i] = (HYPRE_Complex) scale[hypre_ParCSRCommPkgSendMapElmt(comm_pkg, i)];
+      }
+      comm_handle = hypre_ParCSRCommHandleCreate(1, comm_pkg, scale_buf, scale_recv);
+
+      for (i = 0; i < num_rows; i++)
+      {
+         scale_ext[i] = scale[i];
+      }
+      hypre_ParCSRCommHandleDestroy(comm_handle);
+
+      for (i = 0; i < num_ghosts; i++)
+      {
+         scale_ext[num_rows + recv_perm[i]] = hypre_creal(scale_recv[i]);
+      }
+
+      hypre_TFree(scale_buf, HYPRE_MEMORY_HOST);
+      hypre_TFree(scale_recv, HYPRE_MEMORY_HOST);
+   }
+
+   hypre_TFree(ghost_map, HYPRE_MEMORY_HOST);
+   hypre_TFree(sorted_map, HYPRE_MEMORY_HOST);
+
+   mp = hypre_CTAlloc(hypre_ParCSRMatPowers, 1, HYPRE_MEMORY_HOST);
+
+   hypre_ParCSRMatPowersMatrix(mp)      = A;
+   hypre_ParCSRMatPowersNumPowers(mp)   = num_powers;
+   hypre_ParCSRMatPowersNumGhosts(mp)   = num_ghosts;
+   hypre_ParCSRMatPowersGhostStarts(mp) = ghost_starts;
+   hypre_ParCSRMatPowersGhostRows(mp)   = ghost_rows;
+   hypre_ParCSRMatPowersCommPkg(mp)     = comm_pkg;
+   hypre_ParCSRMatPowersRecvPerm(mp)    = recv_perm;
+   hypre_ParCSRMatPowersScale(mp)       = scale_ext;
+   hypre_ParCSRMatPowersSendBuf(mp)     =
+      hypre_TAlloc(HYPRE_Complex, hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends),
+                   HYPRE_MEMORY_HOST);
+   hypre_ParCSRMatPowersRecvBuf(mp)     = hypre_TAlloc(HYPRE_Complex, num_ghosts, HYPRE_MEMORY_HOST);
+   hypre_ParCSRMatPowersWork(mp)        = hypre_TAlloc(HYPRE_Complex, 3 * (num_rows + num_ghosts),
+                                                       HYPRE_MEMORY_HOST);
+
+   return mp;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatPowersDestroy
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRMatPowersDestroy( hypre_ParCSRMatPowers *mp )
+{
+   if (mp)
+   {
+      hypre_TFree(hypre_ParCSRMatPowersGhostStarts(mp), HYPRE_MEMORY_HOST);
+      hypre_CSRMatrixDestroy(hypre_ParCSRMatPowersGhostRows(mp));
+      hypre_MatvecCommPkgDestroy(hypre_ParCSRMatPowersCommPkg(mp));
+      hypre_TFree(hypre_ParCSRMatPowersRecvPerm(mp), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_ParCSRMatPowersScale(mp), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_ParCSRMatPowersSendBuf(mp), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_ParCSRMatPowersRecvBuf(mp), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_ParCSRMatPowersWork(mp), HYPRE_MEMORY_HOST);
+      hypre_TFree(mp, HYPRE_MEMORY_HOST);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatPowersApplyCore
+ *
+ * Shared kernel of the Apply routines. If y is not NULL, y[j-1] = S^j x
+ * for j = 1, ..., num_powers. If y_poly is not NULL, y_poly is set to
+ * sum_{j=0}^{num_powers} coefs[j] S^j x, evaluated with Horner's rule
+ * on the ghost region without storing the powers.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_ParCSRMatPowersApplyCore( hypre_ParCSRMatPowers  *mp,
+                                hypre_ParVector        *x,
+                                HYPRE_Int               num_powers,
+                                hypre_ParVector       **y,
+                                HYPRE_Real             *coefs,
+                                hypre_ParVector        *y_poly )
+{
+   hypre_ParCSRMatrix      *A            = hypre_ParCSRMatPowersMatrix(mp);
+   hypre_ParCSRCommPkg     *comm_pkg     = hypre_ParCSRMatPowersCommPkg(mp);
+   HYPRE_Int               *ghost_starts = hypre_ParCSRMatPowersGhostStarts(mp);
+   HYPRE_Int               *recv_perm    = hypre_ParCSRMatPowersRecvPerm(mp);
+   HYPRE_Real              *scale        = hypre_ParCSRMatPowersScale(mp);
+   HYPRE_Complex           *send_buf     = hypre_ParCSRMatPowersSendBuf(mp);
+   HYPRE_Complex           *recv_buf     = hypre_ParCSRMatPowersRecvBuf(mp);
+   HYPRE_Int                num_ghosts   = hypre_ParCSRMatPowersNumGhosts(mp);
+
+   hypre_CSRMatrix         *A_diag       = hypre_ParCSRMatrixDiag(A);
+   hypre_CSRMatrix         *A_offd       = hypre_ParCSRMatrixOffd(A);
+   hypre_CSRMatrix         *ghost_rows   = hypre_ParCSRMatPowersGhostRows(mp);
+   HYPRE_Int               *A_diag_i     = hypre_CSRMatrixI(A_diag);
+   HYPRE_Int               *A_diag_j     = hypre_CSRMatrixJ(A_diag);
+   HYPRE_Complex           *A_diag_data  = hypre_CSRMatrixData(A_diag);
+   HYPRE_Int               *A_offd_i     = hypre_CSRMatrixI(A_offd);
+   HYPRE_Int               *A_offd_j     = hypre_CSRMatrixJ(A_offd);
+   HYPRE_Complex           *A_offd_data  = hypre_CSRMatrixData(A_offd);
+   HYPRE_Int               *G_i          = hypre_CSRMatrixI(ghost_rows);
+   HYPRE_Int               *G_j          = hypre_CSRMatrixJ(ghost_rows);
+   HYPRE_Complex           *G_data       = hypre_CSRMatrixData(ghost_rows);
+   HYPRE_Int                num_rows     = hypre_CSRMatrixNumRows(A_diag);
+   HYPRE_Int                num_ext      = num_rows + num_ghosts;
+
+   HYPRE_Complex           *x_data       = hypre_VectorData(hypre_ParVectorLocalVector(x));
+   HYPRE_Complex           *p_data       = NULL;
+   HYPRE_Complex           *x_ext, *v_in, *v_out, *y_data;
+   hypre_ParCSRCommHandle  *comm_handle;
+
+   HYPRE_Int                num_sends, num_ghost_rows;
+   HYPRE_Int                i, j, jj;
+   HYPRE_Complex            sum, sum_offd;
+
+   HYPRE_ANNOTATE_FUNC_BEGIN;
+
+   if (y_poly)
+   {
+      p_data = hypre_VectorData(hypre_ParVectorLocalVector(y_poly));
+   }
+
+   /*-----------------------------------------------------------------------
+    * Single exchange of x on the whole ghost region
+    *-----------------------------------------------------------------------*/
+
+   num_sends = hypre_ParCSRCommPkgNumSends(comm_pkg);
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends); i++)
+   {
+      send_buf[i] = x_data[hypre_ParCSRCommPkgSendMapElmt(comm_pkg, i)];
+   }
+
+   comm_handle = hypre_ParCSRCommHandleCreate_v2(1, comm_pkg, HYPRE_MEMORY_HOST, send_buf,
+                                                 HYPRE_MEMORY_HOST, recv_buf);
+
+   x_ext = hypre_ParCSRMatPowersWork(mp);
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < num_rows; i++)
+   {
+      x_ext[i] = x_data[i];
+   }
+
+   hypre_ParCSRCommHandleDestroy(comm_handle);
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < num_ghosts; i++)
+   {
+      x_ext[num_rows + recv_perm[i]] = recv_buf[i];
+   }
+
+   /*-----------------------------------------------------------------------
+    * Powers: v_j = S v_{j-1} with v_0 = x.
+    * Polynomial: Horner's rule, v_0 = c_n x and v_j = S v_{j-1} + c_{n-j} x,
+    * which is the recurrence of the standard Chebyshev smoother.
+    *-----------------------------------------------------------------------*/
+
+   if (p_data)
+   {
+      v_in  = x_ext + num_ext;
+      v_out = v_in + num_ext;
+
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < num_ext; i++)
+      {
+         v_in[i] = x_ext[i] * coefs[num_powers];
+      }
+   }
+   else
+   {
+      v_in  = x_ext;
+      v_out = x_ext + num_ext;
+   }
+
+   /*-----------------------------------------------------------------------
+    * Step j is needed on the ghosts at distance <= num_powers - j only
+    *-----------------------------------------------------------------------*/
+
+   for (j = 1; j <= num_powers; j++)
+   {
+      HYPRE_Complex *v_tmp;
+      HYPRE_Complex  c = p_data ? coefs[num_powers - j] : 0.0;
+
+      y_data         = y ? hypre_VectorData(hypre_ParVectorLocalVector(y[j - 1])) : NULL;
+      num_ghost_rows = ghost_starts[num_powers - j];
+
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel private(i, jj, sum, sum_offd)
+#endif
+      {
+#ifdef HYPRE_USING_OPENMP
+         #pragma omp for HYPRE_SMP_SCHEDULE
+#endif
+         for (i = 0; i < num_rows; i++)
+         {
+            /* diag and offd are summed separately, as in the ParCSR Matvec */
+            sum      = 0.0;
+            sum_offd = 0.0;
+            if (scale)
+            {
+               for (jj = A_diag_i[i]; jj < A_diag_i[i + 1]; jj++)
+               {
+                  sum += A_diag_data[jj] * (scale[A_diag_j[jj]] * v_in[A_diag_j[jj]]);
+               }
+               for (jj = A_offd_i[i]; jj < A_offd_i[i + 1]; jj++)
+               {
+                  sum_offd += A_offd_data[jj] * (scale[num_rows + A_offd_j[jj]] *
+                                                 v_in[num_rows + A_offd_j[jj]]);
+               }
+               sum = scale[i] * (sum + sum_offd);
+            }
+            else
+            {
+               for (jj = A_diag_i[i]; jj < A_diag_i[i + 1]; jj++)
+               {
+                  sum += A_diag_data[jj] * v_in[A_diag_j[jj]];
+               }
+               for (jj = A_offd_i[i]; jj < A_offd_i[i + 1]; jj++)
+               {
+                  sum_offd += A_offd_data[jj] * v_in[num_rows + A_offd_j[jj]];
+               }
+               sum += sum_offd;
+            }
+            if (p_data)
+            {
+               sum = c * x_ext[i] + sum;
+            }
+            v_out[i] = sum;
+            if (y_data)
+            {
+               y_data[i] = sum;
+            }
+         }
+
+#ifdef HYPRE_USING_OPENMP
+         #pragma omp for HYPRE_SMP_SCHEDULE
+#endif
+         for (i = 0; i < num_ghost_rows; i++)
+         {
+            sum = 0.0;
+            if (scale)
+            {
+               for (jj = G_i[i]; jj < G_i[i + 1]; jj++)
+               {
+                  sum += G_data[jj] * (scale[G_j[jj]] * v_in[G_j[jj]]);
+               }
+               sum *= scale[num_rows + i];
+            }
+            else
+            {
+               for (jj = G_i[i]; jj < G_i[i + 1]; jj++)
+               {
+                  sum += G_data[jj] * v_in[G_j[jj]];
+               }
+            }
+            if (p_data)
+            {
+               sum = c * x_ext[num_rows + i] + sum;
+            }
+            v_out[num_rows + i] = sum;
+         }
+      }
+
+      v_tmp = v_in;
+      v_in  = v_out;
+      v_out = v_tmp;
+   }
+
+   if (p_data)
+   {
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < num_rows; i++)
+      {
+         p_data[i] = v_in[i];
+      }
+   }
+
+   HYPRE_ANNOTATE_FUNC_END;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatPowersApply
+ *
+ * Computes y[j-1] = S^j x for j = 1, ..., num_powers, where S is A or
+ * diag(scale) A diag(scale), with a single halo exchange of x. The number
+ * of powers may not exceed the depth the kernel was created with.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRMatPowersApply( hypre_ParCSRMatPowers  *mp,
+                            hypre_ParVector        *x,
+                            HYPRE_Int               num_powers,
+                            hypre_ParVector       **y )
+{
+   if (num_powers > hypre_ParCSRMatPowersNumPowers(mp))
+   {
+      hypre_error_in_arg(3);
+      return hypre_error_flag;
+   }
+
+   return hypre_ParCSRMatPowersApplyCore(mp, x, num_powers, y, NULL, NULL);
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatPowersApplyPoly
+ *
+ * Computes y = sum_{j=0}^{degree} coefs[j] S^j x with a single halo
+ * exchange of x. This is the building block of polynomial smoothers.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRMatPowersApplyPoly( hypre_ParCSRMatPowers  *mp,
+                                hypre_ParVector        *x,
+                                HYPRE_Int               degree,
+                                HYPRE_Real             *coefs,
+                                hypre_ParVector        *y )
+{
+   if (degree > hypre_ParCSRMatPowersNumPowers(mp))
+   {
+      hypre_error_in_arg(3);
+      return hypre_error_flag;
+   }
+
+   return hypre_ParCSRMatPowersApplyCore(mp, x, degree, NULL, coefs, y);
+}
@@ -125,6 +125,9 @@ hypre_ParCSRMatrixCreate( MPI_Comm      comm,
    matrix->bdiaginv_comm_pkg = NULL;
    matrix->bdiag_size = -1;
 
+   hypre_ParCSRMatrixMerged(matrix)      = NULL;
+   hypre_ParCSRMatrixMergedSplit(matrix) = NULL;
+
 #if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_HIP) || defined(HYPRE_USING_SYCL)
    hypre_ParCSRMatrixSocDiagJ(matrix) = NULL;
    hypre_ParCSRMatrixSocOffdJ(matrix) = NULL;
@@ -201,6 +204,8 @@ hypre_ParCSRMatrixDestroy( hypre_ParCSRMatrix *matrix )
          hypre_MatvecCommPkgDestroy(matrix->bdiaginv_comm_pkg);
       }
 
+      hypre_ParCSRMatrixDestroyMergedLayout(matrix);
+
 #if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_HIP) || defined(HYPRE_USING_SYCL)
       hypre_TFree(hypre_ParCSRMatrixSocDiagJ(matrix), HYPRE_MEMORY_DEVICE);
       hypre_TFree(hypre_ParCSRMatrixSocOffdJ(matrix), HYPRE_MEMORY_DEVICE);
@@ -2341,6 +2346,9 @@ hypre_ParCSRMatrixTruncate(hypre_ParCSRMatrix *A,
       num_lost_offd_per_thread[i] = 0;
    }
 
+   hypre_ParCSRMatrixDestroyMergedLayout(A);
+   hypre_CSRMatrixUncompressIndices(A_diag);
+
 #ifdef HYPRE_USING_OPENMP
    #pragma omp parallel private(i,my_thread_num,num_threads,row_nrm, drop_coeff,j,start_j,row_sum,scale,num_lost,now_checking,next_open,num_lost_offd,now_checking_offd,next_open_offd,start,stop,cnt_diag,cnt_offd,num_elmts,cnt)
 #endif
@@ -2864,6 +2872,8 @@ HYPRE_Int
 hypre_ParCSRMatrixSetConstantValues( hypre_ParCSRMatrix *A,
                                      HYPRE_Complex       value )
 {
+   hypre_ParCSRMatrixDestroyMergedLayout(A);
+
    hypre_CSRMatrixSetConstantValues(hypre_ParCSRMatrixDiag(A), value);
    hypre_CSRMatrixSetConstantValues(hypre_ParCSRMatrixOffd(A), value);
 
@@ -2885,3 +2895,117 @@ hypre_ParCSRMatrixCopyColMapOffdToDevice(hypre_ParCSRMatrix *A)
    }
 #endif
 }
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixCreateMergedLayout
+ *
+ * Build the merged copy of the diag and offd blocks of a host matrix A, so
+ * that the solve-phase kernels (matvec, residual, Jacobi and hybrid
+ * Gauss-Seidel) traverse a single i/j/data stream per row once the halo
+ * values have arrived.  Row i of the merged matrix holds the diag entries
+ * of row i (in their original order, so the diagonal comes first) followed
+ * by its offd entries, whose column indices are kept as offd (ghost) column
+ * indices.  merged_split[i] marks the first offd entry of row i.
+ *
+ * The copy is not updated when the values of A change.  The routines that
+ * modify a ParCSR matrix in place (scaling, setting constant values,
+ * reordering, dropping or truncating entries, and IJ assembly) drop it;
+ * code that writes to the diag or offd arrays directly must call
+ * hypre_ParCSRMatrixDestroyMergedLayout itself.  An existing merged copy is
+ * replaced.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRMatrixCreateMergedLayout( hypre_ParCSRMatrix *A )
+{
+   hypre_CSRMatrix  *diag          = hypre_ParCSRMatrixDiag(A);
+   hypre_CSRMatrix  *offd          = hypre_ParCSRMatrixOffd(A);
+   HYPRE_Int         num_rows      = hypre_CSRMatrixNumRows(diag);
+   HYPRE_Int         num_cols_diag = hypre_CSRMatrixNumCols(diag);
+   HYPRE_Int         num_cols_offd = hypre_CSRMatrixNumCols(offd);
+   HYPRE_Int         nnz_diag      = hypre_CSRMatrixNumNonzeros(diag);
+   HYPRE_Int         nnz_offd      = hypre_CSRMatrixNumNonzeros(offd);
+   HYPRE_Int        *diag_i        = hypre_CSRMatrixI(diag);
+   HYPRE_Int        *diag_j        = hypre_CSRMatrixJ(diag);
+   HYPRE_Complex    *diag_data     = hypre_CSRMatrixData(diag);
+   HYPRE_Int        *offd_i        = hypre_CSRMatrixI(offd);
+   HYPRE_Int        *offd_j        = hypre_CSRMatrixJ(offd);
+   HYPRE_Complex    *offd_data     = hypre_CSRMatrixData(offd);
+
+   hypre_CSRMatrix  *merged;
+   HYPRE_Int        *merged_i;
+   HYPRE_Int        *merged_j;
+   HYPRE_Complex    *merged_data;
+   HYPRE_Int        *merged_split;
+   HYPRE_Int         i;
+
+   if (hypre_GetActualMemLocation(hypre_ParCSRMatrixMemoryLocation(A)) != hypre_MEMORY_HOST)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "The merged layout is only available on the host\n");
+      return hypre_error_flag;
+   }
+
+   hypre_ParCSRMatrixDestroyMergedLayout(A);
+
+   merged = hypre_CSRMatrixCreate(num_rows, num_cols_diag + num_cols_offd, nnz_diag + nnz_offd);
+   hypre_CSRMatrixInitialize_v2(merged, 0, HYPRE_MEMORY_HOST);
+   merged_i     = hypre_CSRMatrixI(merged);
+   merged_j     = hypre_CSRMatrixJ(merged);
+   merged_data  = hypre_CSRMatrixData(merged);
+   merged_split = hypre_TAlloc(HYPRE_Int, num_rows, HYPRE_MEMORY_HOST);
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < num_rows + 1; i++)
+   {
+      merged_i[i] = diag_i[i] + (offd_i ? offd_i[i] : 0);
+   }
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < num_rows; i++)
+   {
+      HYPRE_Int jj, k = merged_i[i];
+
+      for (jj = diag_i[i]; jj < diag_i[i + 1]; jj++, k++)
+      {
+         merged_j[k]    = diag_j[jj];
+         merged_data[k] = diag_data[jj];
+      }
+
+      merged_split[i] = k;
+
+      if (offd_i)
+      {
+         for (jj = offd_i[i]; jj < offd_i[i + 1]; jj++, k++)
+         {
+            merged_j[k]    = offd_j[jj];
+            merged_data[k] = offd_data[jj];
+         }
+      }
+   }
+
+   hypre_ParCSRMatrixMerged(A)      = merged;
+   hypre_ParCSRMatrixMergedSplit(A) = merged_split;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixDestroyMergedLayout
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRMatrixDestroyMergedLayout( hypre_ParCSRMatrix *A )
+{
+   if (A)
+   {
+      hypre_CSRMatrixDestroy(hypre_ParCSRMatrixMerged(A));
+      hypre_TFree(hypre_ParCSRMatrixMergedSplit(A), HYPRE_MEMORY_HOST);
+      hypre_ParCSRMatrixMerged(A) = NULL;
+   }
+
+   return hypre_error_flag;
+}
@@ -77,6 +77,13 @@ typedef struct hypre_ParCSRMatrix_struct
    HYPRE_Complex        *bdiaginv;
    hypre_ParCSRCommPkg  *bdiaginv_comm_pkg;
 
+   /* Optional merged copy of diag and offd used by the host solve-phase
+      kernels: row i holds its diag entries in [i[i], merged_split[i]) and
+      its offd entries (with offd column indices) in [merged_split[i], i[i+1]).
+      See hypre_ParCSRMatrixCreateMergedLayout. */
+   hypre_CSRMatrix      *merged;
+   HYPRE_Int            *merged_split;
+
 #if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_HIP) || defined(HYPRE_USING_SYCL)
    /* these two arrays are reserveed for SoC matrices on GPUs to help build interpolation */
    HYPRE_Int            *soc_diag_j;
@@ -116,6 +123,8 @@ typedef struct hypre_ParCSRMatrix_struct
 #define hypre_ParCSRMatrixAssumedPartition(matrix)       ((matrix) -> assumed_partition)
 #define hypre_ParCSRMatrixOwnsAssumedPartition(matrix)   ((matrix) -> owns_assumed_partition)
 #define hypre_ParCSRMatrixProcOrdering(matrix)           ((matrix) -> proc_ordering)
+#define hypre_ParCSRMatrixMerged(matrix)                 ((matrix) -> merged)
+#define hypre_ParCSRMatrixMergedSplit(matrix)            ((matrix) -> merged_split)
 #if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_HIP) || defined(HYPRE_USING_SYCL)
 #define hypre_ParCSRMatrixSocDiagJ(matrix)               ((matrix) -> soc_diag_j)
 #define hypre_ParCSRMatrixSocOffdJ(matrix)               ((matrix) -> soc_offd_j)
@@ -158,6 +167,51 @@ hypre_ParCSRMatrixMemoryLocation(hypre_ParCSRMatrix *matrix)
    return HYPRE_MEMORY_UNDEFINED;
 }
 
+/*--------------------------------------------------------------------------
+ * Matrix powers kernel
+ *
+ * Ghost region of depth num_powers around the local rows of A. Ghost
+ * columns are numbered after the local ones, ordered by their distance to
+ * the local rows: ghosts at distance d are [ghost_starts[d-1], ghost_starts[d]).
+ * Distance one ghosts are in the order of col_map_offd, so that the offd
+ * block of A indexes them directly. ghost_rows holds the rows of A at the
+ * ghosts of distance 1 ... num_powers-1 with columns in this numbering.
+ *--------------------------------------------------------------------------*/
+
+typedef struct
+{
+   hypre_ParCSRMatrix     *A;
+   HYPRE_Int               num_powers;
+   HYPRE_Int               num_ghosts;
+   HYPRE_Int              *ghost_starts;
+   hypre_CSRMatrix        *ghost_rows;
+
+   /* all ghosts are received with one exchange in ascending global order,
+      recv_perm maps the receive buffer to the ghost numbering */
+   hypre_ParCSRCommPkg    *comm_pkg;
+   HYPRE_Int              *recv_perm;
+
+   /* optional symmetric diagonal scaling on local rows and ghosts */
+   HYPRE_Real             *scale;
+
+   HYPRE_Complex          *send_buf;
+   HYPRE_Complex          *recv_buf;
+   HYPRE_Complex          *work;
+
+} hypre_ParCSRMatPowers;
+
+#define hypre_ParCSRMatPowersMatrix(mp)                  ((mp) -> A)
+#define hypre_ParCSRMatPowersNumPowers(mp)               ((mp) -> num_powers)
+#define hypre_ParCSRMatPowersNumGhosts(mp)               ((mp) -> num_ghosts)
+#define hypre_ParCSRMatPowersGhostStarts(mp)             ((mp) -> ghost_starts)
+#define hypre_ParCSRMatPowersGhostRows(mp)               ((mp) -> ghost_rows)
+#define hypre_ParCSRMatPowersCommPkg(mp)                 ((mp) -> comm_pkg)
+#define hypre_ParCSRMatPowersRecvPerm(mp)                ((mp) -> recv_perm)
+#define hypre_ParCSRMatPowersScale(mp)                   ((mp) -> scale)
+#define hypre_ParCSRMatPowersSendBuf(mp)                 ((mp) -> send_buf)
+#define hypre_ParCSRMatPowersRecvBuf(mp)                 ((mp) -> recv_buf)
+#define hypre_ParCSRMatPowersWork(mp)                    ((mp) -> work)
+
 /*--------------------------------------------------------------------------
  * Parallel CSR Boolean Matrix
  *--------------------------------------------------------------------------*/
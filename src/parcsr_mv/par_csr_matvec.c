@@ -14,21 +14,172 @@
 #include "_hypre_parcsr_mv.h"
 
 /*--------------------------------------------------------------------------
- * hypre_ParCSRMatrixMatvecOutOfPlaceHost
+ * hypre_ParCSRMatrixMatvecMergedHost
+ *
+ * y = alpha*A*x + beta*b in a single pass over the merged layout of A (see
+ * hypre_ParCSRMatrixCreateMergedLayout), once the halo values x_ext_data
+ * have arrived.  If dots is not NULL, the local parts of <y,y> and (if
+ * z_data is not NULL) <y,z> are accumulated in the same pass into dots[0]
+ * and dots[1].
  *--------------------------------------------------------------------------*/
 
-HYPRE_Int
-hypre_ParCSRMatrixMatvecOutOfPlaceHost( HYPRE_Complex       alpha,
-                                        hypre_ParCSRMatrix *A,
-                                        hypre_ParVector    *x,
-                                        HYPRE_Complex       beta,
-                                        hypre_ParVector    *b,
-                                        hypre_ParVector    *y )
+static HYPRE_Int
+hypre_ParCSRMatrixMatvecMergedHost( HYPRE_Complex       alpha,
+                                    hypre_ParCSRMatrix *A,
+                                    HYPRE_Complex      *x_data,
+                                    HYPRE_Complex      *x_ext_data,
+                                    HYPRE_Complex       beta,
+                                    HYPRE_Complex      *b_data,
+                                    HYPRE_Complex      *y_data,
+                                    HYPRE_Complex      *z_data,
+                                    HYPRE_Real         *dots )
+{
+   hypre_CSRMatrix  *merged       = hypre_ParCSRMatrixMerged(A);
+   HYPRE_Int        *merged_split = hypre_ParCSRMatrixMergedSplit(A);
+   HYPRE_Int         num_rows     = hypre_CSRMatrixNumRows(merged);
+   HYPRE_Int        *A_i          = hypre_CSRMatrixI(merged);
+   HYPRE_Int        *A_j          = hypre_CSRMatrixJ(merged);
+   HYPRE_Complex    *A_data       = hypre_CSRMatrixData(merged);
+   HYPRE_Real        yy = 0.0, yz = 0.0;
+   HYPRE_Int         i;
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(i) reduction(+:yy,yz) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < num_rows; i++)
+   {
+      HYPRE_Complex tempx = 0.0;
+      HYPRE_Int     jj;
+
+      for (jj = A_i[i]; jj < merged_split[i]; jj++)
+      {
+         tempx += A_data[jj] * x_data[A_j[jj]];
+      }
+      for (jj = merged_split[i]; jj < A_i[i + 1]; jj++)
+      {
+         tempx += A_data[jj] * x_ext_data[A_j[jj]];
+      }
+
+      if (beta == 0.0)
+      {
+         tempx = alpha * tempx;
+      }
+      else
+      {
+         tempx = alpha * tempx + beta * b_data[i];
+      }
+
+      if (dots)
+      {
+         yy += hypre_conj(tempx) * tempx;
+         if (z_data)
+         {
+            yz += hypre_conj(z_data[i]) * tempx;
+         }
+      }
+      y_data[i] = tempx;
+   }
+
+   if (dots)
+   {
+      dots[0] = yy;
+      dots[1] = yz;
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixMatvecDotsHost
+ *
+ * y = alpha*A_local*x + beta*b for the rows of a local block (A_local = NULL
+ * is a zero block), accumulating the local parts of <y,y> and (if z_data is
+ * not NULL) <y,z> in the same pass into dots[0] and dots[1].  b_data may be
+ * y_data.  The rows are combined as in hypre_CSRMatrixMatvecOutOfPlace and
+ * the products as in hypre_SeqVectorInnerProd, so the results are the same
+ * as those of the separate calls.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_ParCSRMatrixMatvecDotsHost( HYPRE_Complex    alpha,
+                                  hypre_CSRMatrix *A_local,
+                                  HYPRE_Complex   *x_data,
+                                  HYPRE_Complex    beta,
+                                  HYPRE_Complex   *b_data,
+                                  HYPRE_Complex   *y_data,
+                                  HYPRE_Int        num_rows,
+                                  HYPRE_Complex   *z_data,
+                                  HYPRE_Real      *dots )
+{
+   HYPRE_Int        *A_i    = A_local ? hypre_CSRMatrixI(A_local) : NULL;
+   HYPRE_Int        *A_j    = A_local ? hypre_CSRMatrixJ(A_local) : NULL;
+   HYPRE_Complex    *A_data = A_local ? hypre_CSRMatrixData(A_local) : NULL;
+   HYPRE_Real        yy = 0.0, yz = 0.0;
+   HYPRE_Int         i;
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(i) reduction(+:yy,yz) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < num_rows; i++)
+   {
+      HYPRE_Complex tempx = 0.0;
+      HYPRE_Int     jj;
+
+      if (A_i)
+      {
+         for (jj = A_i[i]; jj < A_i[i + 1]; jj++)
+         {
+            tempx += A_data[jj] * x_data[A_j[jj]];
+         }
+      }
+      if (beta == 0.0)
+      {
+         tempx = alpha * tempx;
+      }
+      else
+      {
+         tempx = alpha * tempx + beta * b_data[i];
+      }
+
+      yy += hypre_conj(tempx) * tempx;
+      if (z_data)
+      {
+         yz += hypre_conj(z_data[i]) * tempx;
+      }
+      y_data[i] = tempx;
+   }
+
+   dots[0] = yy;
+   dots[1] = yz;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixMatvecOutOfPlaceDotsHost
+ *
+ * y = alpha*A*x + beta*b.  If dots is not NULL (single vectors only), the
+ * local parts of <y,y> and, if z is not NULL, <y,z> are returned in dots[0]
+ * and dots[1].  They are accumulated in the last pass over the rows of y:
+ * the pass over the offd block, or the pass over the diag block (still
+ * overlapped with the halo exchange) when there are no offd columns.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_ParCSRMatrixMatvecOutOfPlaceDotsHost( HYPRE_Complex       alpha,
+                                            hypre_ParCSRMatrix *A,
+                                            hypre_ParVector    *x,
+                                            HYPRE_Complex       beta,
+                                            hypre_ParVector    *b,
+                                            hypre_ParVector    *y,
+                                            hypre_ParVector    *z,
+                                            HYPRE_Real         *dots )
 {
    hypre_ParCSRCommPkg     *comm_pkg = hypre_ParCSRMatrixCommPkg(A);
 
    hypre_CSRMatrix         *diag = hypre_ParCSRMatrixDiag(A);
    hypre_CSRMatrix         *offd = hypre_ParCSRMatrixOffd(A);
+   hypre_CSRMatrix         *merged = hypre_ParCSRMatrixMerged(A);
 
    hypre_Vector            *x_local  = hypre_ParVectorLocalVector(x);
    hypre_Vector            *b_local  = hypre_ParVectorLocalVector(b);
@@ -51,6 +202,12 @@ hypre_ParCSRMatrixMatvecOutOfPlaceHost( HYPRE_Complex       alpha,
    HYPRE_Complex           *x_local_data = hypre_VectorData(x_local);
    HYPRE_Complex           *x_tmp_data;
    HYPRE_Complex           *x_buf_data;
+   HYPRE_Int                own_x_buf_data = 0;
+   HYPRE_Complex           *z_data = z ? hypre_VectorData(hypre_ParVectorLocalVector(z)) : NULL;
+   HYPRE_Int                fused_diag;
+
+   hypre_ParCSRPersistentCommHandle *persistent_comm_handle;
+   hypre_ParCSRCommHandle           *comm_handle = NULL;
 
    HYPRE_ANNOTATE_FUNC_BEGIN;
 
@@ -83,6 +240,7 @@ hypre_ParCSRMatrixMatvecOutOfPlaceHost( HYPRE_Complex       alpha,
 
    hypre_assert( hypre_VectorNumVectors(b_local) == num_vectors );
    hypre_assert( hypre_VectorNumVectors(y_local) == num_vectors );
+   hypre_assert( !dots || num_vectors == 1 );
 
    if (num_vectors == 1)
    {
@@ -93,6 +251,9 @@ hypre_ParCSRMatrixMatvecOutOfPlaceHost( HYPRE_Complex       alpha,
       hypre_assert(num_vectors > 1);
       x_tmp = hypre_SeqMultiVectorCreate(num_cols_offd, num_vectors);
       hypre_VectorMultiVecStorageMethod(x_tmp) = 1;
+
+      /* the merged layout is only used for single vectors */
+      merged = NULL;
    }
 
    /*---------------------------------------------------------------------
@@ -121,23 +282,20 @@ hypre_ParCSRMatrixMatvecOutOfPlaceHost( HYPRE_Complex       alpha,
    hypre_profile_times[HYPRE_TIMER_ID_PACK_UNPACK] -= hypre_MPI_Wtime();
 #endif
 
-#if defined(HYPRE_USING_PERSISTENT_COMM)
-   hypre_ParCSRPersistentCommHandle *persistent_comm_handle =
-      hypre_ParCSRCommPkgGetPersistentCommHandle(1, comm_pkg);
-#else
-   hypre_ParCSRCommHandle *comm_handle;
-#endif
+   /* Persistent requests and buffers, if any were created for comm_pkg */
+   persistent_comm_handle = hypre_ParCSRCommPkgFindPersistentCommHandle(1, comm_pkg);
 
    /*---------------------------------------------------------------------
     * Allocate (during hypre_SeqVectorInitialize_v2) or retrieve
     * persistent receive data buffer for x_tmp (if persistent is enabled).
     *--------------------------------------------------------------------*/
 
-#if defined(HYPRE_USING_PERSISTENT_COMM)
-   hypre_VectorData(x_tmp) = (HYPRE_Complex *)
-                             hypre_ParCSRCommHandleRecvDataBuffer(persistent_comm_handle);
-   hypre_SeqVectorSetDataOwner(x_tmp, 0);
-#endif
+   if (persistent_comm_handle)
+   {
+      hypre_VectorData(x_tmp) = (HYPRE_Complex *)
+                                hypre_ParCSRCommHandleRecvDataBuffer(persistent_comm_handle);
+      hypre_SeqVectorSetDataOwner(x_tmp, 0);
+   }
 
    hypre_SeqVectorInitialize_v2(x_tmp, HYPRE_MEMORY_HOST);
    x_tmp_data = hypre_VectorData(x_tmp);
@@ -146,14 +304,22 @@ hypre_ParCSRMatrixMatvecOutOfPlaceHost( HYPRE_Complex       alpha,
     * Allocate data send buffer
     *--------------------------------------------------------------------*/
 
-#if defined(HYPRE_USING_PERSISTENT_COMM)
-   x_buf_data = (HYPRE_Complex *) hypre_ParCSRCommHandleSendDataBuffer(persistent_comm_handle);
-
-#else
-   x_buf_data = hypre_TAlloc(HYPRE_Complex,
-                             hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends),
-                             HYPRE_MEMORY_HOST);
-#endif
+   if (persistent_comm_handle)
+   {
+      x_buf_data = (HYPRE_Complex *) hypre_ParCSRCommHandleSendDataBuffer(persistent_comm_handle);
+   }
+   else
+   {
+      /* Pack directly into the shared-memory window, if any */
+      x_buf_data = hypre_ParCSRShmCommSendBuffer(comm_pkg);
+      if (!x_buf_data)
+      {
+         x_buf_data = hypre_TAlloc(HYPRE_Complex,
+                                   hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends),
+                                   HYPRE_MEMORY_HOST);
+         own_x_buf_data = 1;
+      }
+   }
 
    /* The assert is because this code has been tested for column-wise vector storage only. */
    hypre_assert(idxstride == 1);
@@ -178,39 +344,69 @@ hypre_ParCSRMatrixMatvecOutOfPlaceHost( HYPRE_Complex       alpha,
 #endif
 
    /* Non-blocking communication starts */
-#ifdef HYPRE_USING_PERSISTENT_COMM
-   hypre_ParCSRPersistentCommHandleStart(persistent_comm_handle,
-                                         HYPRE_MEMORY_HOST, x_buf_data);
-#else
-   comm_handle = hypre_ParCSRCommHandleCreate_v2(1, comm_pkg,
-                                                 HYPRE_MEMORY_HOST, x_buf_data,
-                                                 HYPRE_MEMORY_HOST, x_tmp_data);
-#endif
+   if (persistent_comm_handle)
+   {
+      hypre_ParCSRPersistentCommHandleStart(persistent_comm_handle,
+                                            HYPRE_MEMORY_HOST, x_buf_data);
+   }
+   else
+   {
+      comm_handle = hypre_ParCSRCommHandleCreate_v2(1, comm_pkg,
+                                                    HYPRE_MEMORY_HOST, x_buf_data,
+                                                    HYPRE_MEMORY_HOST, x_tmp_data);
+   }
 
 #ifdef HYPRE_PROFILE
    hypre_profile_times[HYPRE_TIMER_ID_HALO_EXCHANGE] += hypre_MPI_Wtime();
 #endif
 
-   /* overlapped local computation */
-   hypre_CSRMatrixMatvecOutOfPlace(alpha, diag, x_local, beta, b_local, y_local, 0);
+   /* overlapped local computation, unless the merged layout is used.  The
+      products are taken in this pass if the offd block is empty (and the
+      diag block does not use compressed column indices). */
+   fused_diag = (dots && !num_cols_offd && !hypre_CSRMatrixJDelta(diag));
+   if (fused_diag)
+   {
+      hypre_ParCSRMatrixMatvecDotsHost(alpha, diag, x_local_data, beta,
+                                       hypre_VectorData(b_local), hypre_VectorData(y_local),
+                                       hypre_VectorSize(y_local), z_data, dots);
+   }
+   else if (!merged)
+   {
+      hypre_CSRMatrixMatvecOutOfPlace(alpha, diag, x_local, beta, b_local, y_local, 0);
+   }
 
 #ifdef HYPRE_PROFILE
    hypre_profile_times[HYPRE_TIMER_ID_HALO_EXCHANGE] -= hypre_MPI_Wtime();
 #endif
 
    /* Non-blocking communication ends */
-#ifdef HYPRE_USING_PERSISTENT_COMM
-   hypre_ParCSRPersistentCommHandleWait(persistent_comm_handle, HYPRE_MEMORY_HOST, x_tmp_data);
-#else
-   hypre_ParCSRCommHandleDestroy(comm_handle);
-#endif
+   if (persistent_comm_handle)
+   {
+      hypre_ParCSRPersistentCommHandleWait(persistent_comm_handle, HYPRE_MEMORY_HOST, x_tmp_data);
+   }
+   else
+   {
+      hypre_ParCSRCommHandleDestroy(comm_handle);
+   }
 
 #ifdef HYPRE_PROFILE
    hypre_profile_times[HYPRE_TIMER_ID_HALO_EXCHANGE] += hypre_MPI_Wtime();
 #endif
 
-   /* computation offd part */
-   if (num_cols_offd)
+   /* computation offd part, or all rows in one pass with the merged layout */
+   if (merged && !fused_diag)
+   {
+      hypre_ParCSRMatrixMatvecMergedHost(alpha, A, x_local_data, x_tmp_data, beta,
+                                         hypre_VectorData(b_local), hypre_VectorData(y_local),
+                                         z_data, dots);
+   }
+   else if (dots && !fused_diag)
+   {
+      hypre_ParCSRMatrixMatvecDotsHost(alpha, num_cols_offd ? offd : NULL, x_tmp_data, 1.0,
+                                       hypre_VectorData(y_local), hypre_VectorData(y_local),
+                                       hypre_VectorSize(y_local), z_data, dots);
+   }
+   else if (num_cols_offd)
    {
       hypre_CSRMatrixMatvec(alpha, offd, x_tmp, 1.0, y_local);
    }
@@ -220,15 +416,31 @@ hypre_ParCSRMatrixMatvecOutOfPlaceHost( HYPRE_Complex       alpha,
     *--------------------------------------------------------------------*/
    hypre_SeqVectorDestroy(x_tmp);
 
-#if !defined(HYPRE_USING_PERSISTENT_COMM)
-   hypre_TFree(x_buf_data, HYPRE_MEMORY_HOST);
-#endif
+   if (own_x_buf_data)
+   {
+      hypre_TFree(x_buf_data, HYPRE_MEMORY_HOST);
+   }
 
    HYPRE_ANNOTATE_FUNC_END;
 
    return ierr;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixMatvecOutOfPlaceHost
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRMatrixMatvecOutOfPlaceHost( HYPRE_Complex       alpha,
+                                        hypre_ParCSRMatrix *A,
+                                        hypre_ParVector    *x,
+                                        HYPRE_Complex       beta,
+                                        hypre_ParVector    *b,
+                                        hypre_ParVector    *y )
+{
+   return hypre_ParCSRMatrixMatvecOutOfPlaceDotsHost(alpha, A, x, beta, b, y, NULL, NULL);
+}
+
 /*--------------------------------------------------------------------------
  * hypre_ParCSRMatrixMatvecOutOfPlace
  *
@@ -278,6 +490,118 @@ hypre_ParCSRMatrixMatvec( HYPRE_Complex       alpha,
    return hypre_ParCSRMatrixMatvecOutOfPlace(alpha, A, x, beta, y, y);
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixMatvecOutOfPlaceInnerProd
+ *
+ * Performs y <- alpha * A * x + beta * b and computes yy = <y,y> (if yy is
+ * not NULL) and yz = <y,z> (if z and yz are not NULL) with a single global
+ * reduction.  For single vectors on the host, the inner products are
+ * accumulated while y is computed, so y is not read again.  y may be b, but
+ * must not share its data with x or z.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRMatrixMatvecOutOfPlaceInnerProd( HYPRE_Complex       alpha,
+                                             hypre_ParCSRMatrix *A,
+                                             hypre_ParVector    *x,
+                                             HYPRE_Complex       beta,
+                                             hypre_ParVector    *b,
+                                             hypre_ParVector    *y,
+                                             hypre_ParVector    *z,
+                                             HYPRE_Real         *yy,
+                                             HYPRE_Real         *yz )
+{
+   MPI_Comm      comm    = hypre_ParCSRMatrixComm(A);
+   hypre_Vector *y_local = hypre_ParVectorLocalVector(y);
+   HYPRE_Int     fused   = (hypre_VectorNumVectors(y_local) == 1);
+   HYPRE_Real    local_dots[2], dots[2];
+   HYPRE_Int     num_dots;
+   HYPRE_Int     ierr = 0;
+
+   if (!z || !yz)
+   {
+      z  = NULL;
+      yz = NULL;
+   }
+
+   if (!yy && !yz)
+   {
+      return hypre_ParCSRMatrixMatvecOutOfPlace(alpha, A, x, beta, b, y);
+   }
+
+#if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_HIP) || defined(HYPRE_USING_SYCL)
+   HYPRE_ExecutionPolicy exec = hypre_GetExecPolicy2( hypre_ParCSRMatrixMemoryLocation(A),
+                                                      hypre_ParVectorMemoryLocation(x) );
+
+   if (exec == HYPRE_EXEC_DEVICE)
+   {
+      fused = 0;
+   }
+#endif
+
+   if (fused)
+   {
+      ierr = hypre_ParCSRMatrixMatvecOutOfPlaceDotsHost(alpha, A, x, beta, b, y, z, local_dots);
+   }
+   else
+   {
+      /* separate passes, but still a single reduction */
+      ierr = hypre_ParCSRMatrixMatvecOutOfPlace(alpha, A, x, beta, b, y);
+      local_dots[0] = yy ? hypre_SeqVectorInnerProd(y_local, y_local) : 0.0;
+      local_dots[1] = z ? hypre_SeqVectorInnerProd(y_local, hypre_ParVectorLocalVector(z)) : 0.0;
+   }
+
+   /* reduce only the requested products */
+   num_dots = 2;
+   if (!yz)
+   {
+      num_dots = 1;
+   }
+   else if (!yy)
+   {
+      local_dots[0] = local_dots[1];
+      num_dots = 1;
+   }
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_ALL_REDUCE] -= hypre_MPI_Wtime();
+#endif
+   hypre_MPI_Allreduce(local_dots, dots, num_dots, HYPRE_MPI_REAL, hypre_MPI_SUM, comm);
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_ALL_REDUCE] += hypre_MPI_Wtime();
+#endif
+
+   if (yy)
+   {
+      *yy = dots[0];
+   }
+   if (yz)
+   {
+      *yz = dots[num_dots - 1];
+   }
+
+   return ierr;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixResidualInnerProd
+ *
+ * Computes r = b - A*x together with rr = <r,r> and rz = <r,z> (see
+ * hypre_ParCSRMatrixMatvecOutOfPlaceInnerProd).
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRMatrixResidualInnerProd( hypre_ParCSRMatrix *A,
+                                     hypre_ParVector    *x,
+                                     hypre_ParVector    *b,
+                                     hypre_ParVector    *r,
+                                     hypre_ParVector    *z,
+                                     HYPRE_Real         *rr,
+                                     HYPRE_Real         *rz )
+{
+   return hypre_ParCSRMatrixMatvecOutOfPlaceInnerProd(-1.0, A, x, 1.0, b, r, z, rr, rz);
+}
+
 /*--------------------------------------------------------------------------
  * hypre_ParCSRMatrixMatvecTHost
  *--------------------------------------------------------------------------*/
@@ -316,6 +640,9 @@ hypre_ParCSRMatrixMatvecTHost( HYPRE_Complex       alpha,
    HYPRE_Int                i;
    HYPRE_Int                ierr = 0;
 
+   hypre_ParCSRPersistentCommHandle *persistent_comm_handle;
+   hypre_ParCSRCommHandle           *comm_handle = NULL;
+
    HYPRE_ANNOTATE_FUNC_BEGIN;
 
    /*---------------------------------------------------------------------
@@ -382,23 +709,20 @@ hypre_ParCSRMatrixMatvecTHost( HYPRE_Complex       alpha,
    hypre_profile_times[HYPRE_TIMER_ID_PACK_UNPACK] -= hypre_MPI_Wtime();
 #endif
 
-#if defined(HYPRE_USING_PERSISTENT_COMM)
-   hypre_ParCSRPersistentCommHandle *persistent_comm_handle =
-      hypre_ParCSRCommPkgGetPersistentCommHandle(2, comm_pkg);
-#else
-   hypre_ParCSRCommHandle *comm_handle;
-#endif
+   /* Persistent requests and buffers, if any were created for comm_pkg */
+   persistent_comm_handle = hypre_ParCSRCommPkgFindPersistentCommHandle(2, comm_pkg);
 
    /*---------------------------------------------------------------------
     * Allocate (during hypre_SeqVectorInitialize_v2) or retrieve
     * persistent send data buffer for y_tmp (if persistent is enabled).
     *--------------------------------------------------------------------*/
 
-#if defined(HYPRE_USING_PERSISTENT_COMM)
-   hypre_VectorData(y_tmp) = (HYPRE_Complex *)
-                             hypre_ParCSRCommHandleSendDataBuffer(persistent_comm_handle);
-   hypre_SeqVectorSetDataOwner(y_tmp, 0);
-#endif
+   if (persistent_comm_handle)
+   {
+      hypre_VectorData(y_tmp) = (HYPRE_Complex *)
+                                hypre_ParCSRCommHandleSendDataBuffer(persistent_comm_handle);
+      hypre_SeqVectorSetDataOwner(y_tmp, 0);
+   }
 
    hypre_SeqVectorInitialize_v2(y_tmp, HYPRE_MEMORY_HOST);
    y_tmp_data = hypre_VectorData(y_tmp);
@@ -407,14 +731,16 @@ hypre_ParCSRMatrixMatvecTHost( HYPRE_Complex       alpha,
     * Allocate receive data buffer
     *--------------------------------------------------------------------*/
 
-#if defined(HYPRE_USING_PERSISTENT_COMM)
-   y_buf_data = (HYPRE_Complex *) hypre_ParCSRCommHandleRecvDataBuffer(persistent_comm_handle);
-
-#else
-   y_buf_data = hypre_TAlloc(HYPRE_Complex,
-                             hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends),
-                             HYPRE_MEMORY_HOST);
-#endif
+   if (persistent_comm_handle)
+   {
+      y_buf_data = (HYPRE_Complex *) hypre_ParCSRCommHandleRecvDataBuffer(persistent_comm_handle);
+   }
+   else
+   {
+      y_buf_data = hypre_TAlloc(HYPRE_Complex,
+                                hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends),
+                                HYPRE_MEMORY_HOST);
+   }
 
 #ifdef HYPRE_PROFILE
    hypre_profile_times[HYPRE_TIMER_ID_PACK_UNPACK] += hypre_MPI_Wtime();
@@ -439,14 +765,16 @@ hypre_ParCSRMatrixMatvecTHost( HYPRE_Complex       alpha,
 #endif
 
    /* Non-blocking communication starts */
-#if defined(HYPRE_USING_PERSISTENT_COMM)
-   hypre_ParCSRPersistentCommHandleStart(persistent_comm_handle, HYPRE_MEMORY_HOST, y_tmp_data);
-
-#else
-   comm_handle = hypre_ParCSRCommHandleCreate_v2(2, comm_pkg,
-                                                 HYPRE_MEMORY_HOST, y_tmp_data,
-                                                 HYPRE_MEMORY_HOST, y_buf_data );
-#endif
+   if (persistent_comm_handle)
+   {
+      hypre_ParCSRPersistentCommHandleStart(persistent_comm_handle, HYPRE_MEMORY_HOST, y_tmp_data);
+   }
+   else
+   {
+      comm_handle = hypre_ParCSRCommHandleCreate_v2(2, comm_pkg,
+                                                    HYPRE_MEMORY_HOST, y_tmp_data,
+                                                    HYPRE_MEMORY_HOST, y_buf_data );
+   }
 
 #ifdef HYPRE_PROFILE
    hypre_profile_times[HYPRE_TIMER_ID_HALO_EXCHANGE] += hypre_MPI_Wtime();
@@ -468,12 +796,15 @@ hypre_ParCSRMatrixMatvecTHost( HYPRE_Complex       alpha,
 #endif
 
    /* Non-blocking communication ends */
-#if defined(HYPRE_USING_PERSISTENT_COMM)
-   hypre_ParCSRPersistentCommHandleWait(persistent_comm_handle,
-                                        HYPRE_MEMORY_HOST, y_buf_data);
-#else
-   hypre_ParCSRCommHandleDestroy(comm_handle);
-#endif
+   if (persistent_comm_handle)
+   {
+      hypre_ParCSRPersistentCommHandleWait(persistent_comm_handle,
+                                           HYPRE_MEMORY_HOST, y_buf_data);
+   }
+   else
+   {
+      hypre_ParCSRCommHandleDestroy(comm_handle);
+   }
 
 #ifdef HYPRE_PROFILE
    hypre_profile_times[HYPRE_TIMER_ID_HALO_EXCHANGE] += hypre_MPI_Wtime();
@@ -496,9 +827,10 @@ hypre_ParCSRMatrixMatvecTHost( HYPRE_Complex       alpha,
     *--------------------------------------------------------------------*/
    hypre_SeqVectorDestroy(y_tmp);
 
-#if !defined(HYPRE_USING_PERSISTENT_COMM)
-   hypre_TFree(y_buf_data, HYPRE_MEMORY_HOST);
-#endif
+   if (!persistent_comm_handle)
+   {
+      hypre_TFree(y_buf_data, HYPRE_MEMORY_HOST);
+   }
 
    HYPRE_ANNOTATE_FUNC_END;
 
@@ -0,0 +1,788 @@
+/******************************************************************************
+ * Copyright (c) 1998 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Node-aware (hierarchical) halo exchange for ParCSR communication packages.
+ *
+ * The ranks of comm are split into groups that share a node (optionally,
+ * groups of at most group_size ranks of a node), each with a leader.  A job 1
+ * exchange of the comm_pkg is then done in three steps:
+ *
+ *    1. every rank sends the data for other groups to its leader, and
+ *       exchanges data within the group directly;
+ *    2. the leaders exchange one aggregated message per pair of groups;
+ *    3. the leaders scatter the received data to the ranks of their group.
+ *
+ * Steps 1 and the receives are posted by hypre_ParCSRNodeCommStart, and steps
+ * 2 and 3 are done by hypre_ParCSRNodeCommFinish, so computation can still be
+ * overlapped with the on-node part of the exchange.
+ *
+ *****************************************************************************/
+
+#include "_hypre_parcsr_mv.h"
+
+#define HYPRE_NODE_COMM_LOCAL_TAG    0
+#define HYPRE_NODE_COMM_GATHER_TAG   1
+#define HYPRE_NODE_COMM_LEADER_TAG   2
+#define HYPRE_NODE_COMM_SCATTER_TAG  3
+#define HYPRE_NODE_COMM_SETUP_TAG    4
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRNodeCommPkgCreate
+ *
+ * Builds the node-aware schedule of comm_pkg and stores it in the comm_pkg.
+ * Nothing is attached if all ranks are in one group or every rank is its own
+ * group, since the flat exchange is then as good.  The group and leader
+ * communicators are shared by all comm_pkgs of the same ranks, see
+ * hypre_NodeCommGet, and the schedule exchanges its messages on the
+ * duplicated comm kept there.  Collective on the communicator of comm_pkg.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRNodeCommPkgCreate( hypre_ParCSRCommPkg *comm_pkg,
+                               HYPRE_Int            group_size )
+{
+   MPI_Comm                  comm            = hypre_ParCSRCommPkgComm(comm_pkg);
+   HYPRE_Int                 num_sends       = hypre_ParCSRCommPkgNumSends(comm_pkg);
+   HYPRE_Int                *send_procs      = hypre_ParCSRCommPkgSendProcs(comm_pkg);
+   HYPRE_Int                *send_map_starts = hypre_ParCSRCommPkgSendMapStarts(comm_pkg);
+   HYPRE_Int                 num_recvs       = hypre_ParCSRCommPkgNumRecvs(comm_pkg);
+   HYPRE_Int                *recv_procs      = hypre_ParCSRCommPkgRecvProcs(comm_pkg);
+   HYPRE_Int                *recv_vec_starts = hypre_ParCSRCommPkgRecvVecStarts(comm_pkg);
+
+   hypre_ParCSRNodeCommPkg  *node_pkg;
+   hypre_NodeComm           *node_comm;
+   MPI_Comm                  group_comm;
+   MPI_Comm                  leader_comm;
+   HYPRE_Int                 my_id, num_procs;
+   HYPRE_Int                 group_nprocs, num_groups;
+   HYPRE_Int                 leader, is_leader, num_leaders;
+   HYPRE_Int                *leaders;
+   HYPRE_Int                *leader_ids;
+
+   /* this rank */
+   HYPRE_Int                 num_local_sends = 0;
+   HYPRE_Int                *local_sends;
+   HYPRE_Int                 num_local_recvs = 0;
+   HYPRE_Int                *local_recvs;
+   HYPRE_Int                 gather_size = 0;
+   HYPRE_Int                *gather_elmts;
+   HYPRE_Int                 scatter_size = 0;
+   HYPRE_Int                *scatter_elmts;
+   HYPRE_Int                 num_pairs = 0;
+   HYPRE_Int                *pairs;
+   HYPRE_Int                 num_scatter_ints = 0;
+   HYPRE_Int                *scatter_pairs;
+
+   /* leader */
+   HYPRE_Int                *members = NULL;
+   HYPRE_Int                *counts = NULL;
+   HYPRE_Int                *displs = NULL;
+   HYPRE_Int                *all_pairs = NULL;
+   HYPRE_Int                 num_entries = 0;
+   HYPRE_Int                *entry_src = NULL;
+   HYPRE_Int                *entry_dst = NULL;
+   HYPRE_Int                *entry_len = NULL;
+   HYPRE_Int                *entry_off = NULL;
+   HYPRE_Int                *keys = NULL;
+   HYPRE_Int                *perm = NULL;
+   HYPRE_Int                 num_group_recvs = 0;
+   HYPRE_Int                *group_recv_procs = NULL;
+   HYPRE_Int                *group_recv_starts = NULL;
+   HYPRE_Int                 num_leader_sends = 0;
+   HYPRE_Int                *leader_send_procs = NULL;
+   HYPRE_Int                *leader_send_starts = NULL;
+   HYPRE_Int                *leader_send_elmts = NULL;
+   HYPRE_Int                 num_leader_recvs = 0;
+   HYPRE_Int                *leader_recv_procs = NULL;
+   HYPRE_Int                *leader_recv_starts = NULL;
+   HYPRE_Int                 num_group_sends = 0;
+   HYPRE_Int                *group_send_procs = NULL;
+   HYPRE_Int                *group_send_starts = NULL;
+   HYPRE_Int                *group_send_elmts = NULL;
+   HYPRE_Int                *meta_send = NULL;
+   HYPRE_Int                *meta_send_counts = NULL;
+   HYPRE_Int                *meta_recv = NULL;
+   HYPRE_Int                *meta_recv_counts = NULL;
+   HYPRE_Int                *meta_recv_starts = NULL;
+   HYPRE_Int                *meta_starts = NULL;
+   hypre_MPI_Request        *requests;
+   HYPRE_Int                 num_requests;
+
+   HYPRE_Int                 i, j, k, m, e, len, start, proc;
+
+   hypre_MPI_Comm_rank(comm, &my_id);
+   hypre_MPI_Comm_size(comm, &num_procs);
+
+   if (num_procs < 2 || group_size < 1)
+   {
+      return hypre_error_flag;
+   }
+
+   /*-----------------------------------------------------------------------
+    * Groups, leaders and their communicators (built once per comm)
+    *-----------------------------------------------------------------------*/
+
+   node_comm   = hypre_NodeCommGet(comm, group_size);
+   comm        = hypre_NodeCommComm(node_comm);
+   group_comm  = hypre_NodeCommGroupComm(node_comm);
+   leader_comm = hypre_NodeCommLeaderComm(node_comm);
+   leader      = hypre_NodeCommLeader(node_comm);
+   leaders     = hypre_NodeCommLeaders(node_comm);
+   num_groups  = hypre_NodeCommNumGroups(node_comm);
+   num_leaders = hypre_NodeCommNumLeaders(node_comm);
+   leader_ids  = hypre_NodeCommLeaderIds(node_comm);
+   is_leader   = (leader == my_id);
+   hypre_MPI_Comm_size(group_comm, &group_nprocs);
+
+   if (num_groups == 1 || num_groups == num_procs)
+   {
+      return hypre_error_flag;
+   }
+
+   /*-----------------------------------------------------------------------
+    * Split the sends and receives of this rank into direct (same group)
+    * and aggregated (other groups) ones
+    *-----------------------------------------------------------------------*/
+
+   local_sends = hypre_TAlloc(HYPRE_Int, num_sends, HYPRE_MEMORY_HOST);
+   local_recvs = hypre_TAlloc(HYPRE_Int, num_recvs, HYPRE_MEMORY_HOST);
+
+   for (i = 0; i < num_sends; i++)
+   {
+      if (leaders[send_procs[i]] == leader)
+      {
+         local_sends[num_local_sends++] = i;
+      }
+      else
+      {
+         num_pairs++;
+         gather_size += send_map_starts[i + 1] - send_map_starts[i];
+      }
+   }
+
+   for (i = 0; i < num_recvs; i++)
+   {
+      if (leaders[recv_procs[i]] == leader)
+      {
+         local_recvs[num_local_recvs++] = i;
+      }
+      else
+      {
+         scatter_size += recv_vec_starts[i + 1] - recv_vec_starts[i];
+      }
+   }
+
+   /* (destination, length) of each aggregated send, and the entries sent */
+   pairs        = hypre_TAlloc(HYPRE_Int, 2 * num_pairs, HYPRE_MEMORY_HOST);
+   gather_elmts = hypre_TAlloc(HYPRE_Int, gather_size, HYPRE_MEMORY_HOST);
+   for (i = 0, k = 0, e = 0; i < num_sends; i++)
+   {
+      if (leaders[send_procs[i]] != leader)
+      {
+         pairs[k++] = send_procs[i];
+         pairs[k++] = send_map_starts[i + 1] - send_map_starts[i];
+         for (j = send_map_starts[i]; j < send_map_starts[i + 1]; j++)
+         {
+            gather_elmts[e++] = j;
+         }
+      }
+   }
+
+   /*-----------------------------------------------------------------------
+    * Gather the aggregated sends of the group on the leader
+    *-----------------------------------------------------------------------*/
+
+   if (is_leader)
+   {
+      members = hypre_TAlloc(HYPRE_Int, group_nprocs, HYPRE_MEMORY_HOST);
+      counts  = hypre_TAlloc(HYPRE_Int, group_nprocs, HYPRE_MEMORY_HOST);
+      displs  = hypre_TAlloc(HYPRE_Int, group_nprocs + 1, HYPRE_MEMORY_HOST);
+   }
+
+   num_pairs *= 2;
+   hypre_MPI_Gather(&my_id, 1, HYPRE_MPI_INT, members, 1, HYPRE_MPI_INT, 0, group_comm);
+   hypre_MPI_Gather(&num_pairs, 1, HYPRE_MPI_INT, counts, 1, HYPRE_MPI_INT, 0, group_comm);
+
+   if (is_leader)
+   {
+      displs[0] = 0;
+      for (m = 0; m < group_nprocs; m++)
+      {
+         displs[m + 1] = displs[m] + counts[m];
+      }
+      all_pairs = hypre_TAlloc(HYPRE_Int, displs[group_nprocs], HYPRE_MEMORY_HOST);
+   }
+
+   hypre_MPI_Gatherv(pairs, num_pairs, HYPRE_MPI_INT,
+                     all_pairs, counts, displs, HYPRE_MPI_INT, 0, group_comm);
+   hypre_TFree(pairs, HYPRE_MEMORY_HOST);
+
+   if (is_leader)
+   {
+      /* One entry per aggregated (source, destination) pair, laid out in
+         group_buf in the order of the group ranks */
+      num_entries = displs[group_nprocs] / 2;
+      entry_src   = hypre_TAlloc(HYPRE_Int, num_entries, HYPRE_MEMORY_HOST);
+      entry_dst   = hypre_TAlloc(HYPRE_Int, num_entries, HYPRE_MEMORY_HOST);
+      entry_len   = hypre_TAlloc(HYPRE_Int, num_entries, HYPRE_MEMORY_HOST);
+      entry_off   = hypre_TAlloc(HYPRE_Int, num_entries, HYPRE_MEMORY_HOST);
+
+      group_recv_procs  = hypre_TAlloc(HYPRE_Int, group_nprocs, HYPRE_MEMORY_HOST);
+      group_recv_starts = hypre_TAlloc(HYPRE_Int, group_nprocs + 1, HYPRE_MEMORY_HOST);
+      group_recv_starts[0] = 0;
+
+      for (m = 0, e = 0, start = 0; m < group_nprocs; m++)
+      {
+         for (k = displs[m]; k < displs[m + 1]; k += 2)
+         {
+            entry_src[e] = members[m];
+            entry_dst[e] = all_pairs[k];
+            entry_len[e] = all_pairs[k + 1];
+            entry_off[e] = start;
+            start += entry_len[e];
+            e++;
+         }
+         if (start > group_recv_starts[num_group_recvs])
+         {
+            group_recv_procs[num_group_recvs] = members[m];
+            group_recv_starts[++num_group_recvs] = start;
+         }
+      }
+      hypre_TFree(all_pairs, HYPRE_MEMORY_HOST);
+
+      /* Sort the entries by destination group: one message per group */
+      keys = hypre_TAlloc(HYPRE_Int, num_entries, HYPRE_MEMORY_HOST);
+      perm = hypre_TAlloc(HYPRE_Int, num_entries, HYPRE_MEMORY_HOST);
+      for (e = 0; e < num_entries; e++)
+      {
+         keys[e] = leaders[entry_dst[e]];
+         perm[e] = e;
+      }
+      hypre_qsort2i(keys, perm, 0, num_entries - 1);
+
+      leader_send_procs  = hypre_TAlloc(HYPRE_Int, num_entries, HYPRE_MEMORY_HOST);
+      leader_send_starts = hypre_TAlloc(HYPRE_Int, num_entries + 1, HYPRE_MEMORY_HOST);
+      leader_send_elmts  = hypre_TAlloc(HYPRE_Int, group_recv_starts[num_group_recvs],
+                                        HYPRE_MEMORY_HOST);
+      meta_send          = hypre_TAlloc(HYPRE_Int, 3 * num_entries, HYPRE_MEMORY_HOST);
+      meta_starts        = hypre_TAlloc(HYPRE_Int, num_entries + 1, HYPRE_MEMORY_HOST);
+      leader_send_starts[0] = 0;
+      meta_starts[0] = 0;
+
+      for (k = 0, j = 0; k < num_entries; k++)
+      {
+         e = perm[k];
+         if (k == 0 || keys[k] != keys[k - 1])
+         {
+            leader_send_procs[num_leader_sends++] = keys[k];
+         }
+         for (i = 0; i < entry_len[e]; i++)
+         {
+            leader_send_elmts[j++] = entry_off[e] + i;
+         }
+         leader_send_starts[num_leader_sends] = j;
+         meta_send[3 * k]     = entry_src[e];
+         meta_send[3 * k + 1] = entry_dst[e];
+         meta_send[3 * k + 2] = entry_len[e];
+         meta_starts[num_leader_sends] = 3 * (k + 1);
+      }
+
+      hypre_TFree(entry_src, HYPRE_MEMORY_HOST);
+      hypre_TFree(entry_dst, HYPRE_MEMORY_HOST);
+      hypre_TFree(entry_len, HYPRE_MEMORY_HOST);
+      hypre_TFree(entry_off, HYPRE_MEMORY_HOST);
+      hypre_TFree(keys, HYPRE_MEMORY_HOST);
+      hypre_TFree(perm, HYPRE_MEMORY_HOST);
+   }
+
+   /*-----------------------------------------------------------------------
+    * Tell every leader which entries it will receive from the other leaders
+    *-----------------------------------------------------------------------*/
+
+   if (is_leader)
+   {
+      meta_send_counts = hypre_CTAlloc(HYPRE_Int, num_leaders, HYPRE_MEMORY_HOST);
+      meta_recv_counts = hypre_TAlloc(HYPRE_Int, num_leaders, HYPRE_MEMORY_HOST);
+
+      /* leader_ids is sorted, since the ranks of leader_comm follow my_id */
+      for (i = 0; i < num_leader_sends; i++)
+      {
+         k = hypre_BinarySearch(leader_ids, leader_send_procs[i], num_leaders);
+         meta_send_counts[k] = meta_starts[i + 1] - meta_starts[i];
+      }
+      hypre_MPI_Alltoall(meta_send_counts, 1, HYPRE_MPI_INT,
+                         meta_recv_counts, 1, HYPRE_MPI_INT, leader_comm);
+
+      leader_recv_procs  = hypre_TAlloc(HYPRE_Int, num_leaders, HYPRE_MEMORY_HOST);
+      leader_recv_starts = hypre_TAlloc(HYPRE_Int, num_leaders + 1, HYPRE_MEMORY_HOST);
+      meta_recv_starts   = hypre_TAlloc(HYPRE_Int, num_leaders + 1, HYPRE_MEMORY_HOST);
+      meta_recv_starts[0] = 0;
+      for (k = 0; k < num_leaders; k++)
+      {
+         if (meta_recv_counts[k] > 0)
+         {
+            leader_recv_procs[num_leader_recvs] = leader_ids[k];
+            meta_recv_starts[num_leader_recvs + 1] = meta_recv_starts[num_leader_recvs] +
+                                                     meta_recv_counts[k];
+            num_leader_recvs++;
+         }
+      }
+      meta_recv = hypre_TAlloc(HYPRE_Int, meta_recv_starts[num_leader_recvs], HYPRE_MEMORY_HOST);
+
+      num_requests = num_leader_recvs + num_leader_sends;
+      requests = hypre_CTAlloc(hypre_MPI_Request, num_requests, HYPRE_MEMORY_HOST);
+      for (i = 0, j = 0; i < num_leader_recvs; i++)
+      {
+         start = meta_recv_starts[i];
+         hypre_MPI_Irecv(&meta_recv[start], meta_recv_starts[i + 1] - start, HYPRE_MPI_INT,
+                         leader_recv_procs[i], HYPRE_NODE_COMM_SETUP_TAG, comm, &requests[j++]);
+      }
+      for (i = 0; i < num_leader_sends; i++)
+      {
+         start = meta_starts[i];
+         hypre_MPI_Isend(&meta_send[start], meta_starts[i + 1] - start, HYPRE_MPI_INT,
+                         leader_send_procs[i], HYPRE_NODE_COMM_SETUP_TAG, comm, &requests[j++]);
+      }
+      hypre_MPI_Waitall(num_requests, requests, hypre_MPI_STATUSES_IGNORE);
+      hypre_TFree(requests, HYPRE_MEMORY_HOST);
+
+      /* Entries received by this leader, laid out in leader_buf in the order
+         of the triples (source, destination, length) */
+      num_entries = meta_recv_starts[num_leader_recvs] / 3;
+      entry_src   = hypre_TAlloc(HYPRE_Int, num_entries, HYPRE_MEMORY_HOST);
+      entry_len   = hypre_TAlloc(HYPRE_Int, num_entries, HYPRE_MEMORY_HOST);
+      entry_off   = hypre_TAlloc(HYPRE_Int, num_entries, HYPRE_MEMORY_HOST);
+      keys        = hypre_TAlloc(HYPRE_Int, num_entries, HYPRE_MEMORY_HOST);
+      perm        = hypre_TAlloc(HYPRE_Int, num_entries, HYPRE_MEMORY_HOST);
+
+      leader_recv_starts[0] = 0;
+      for (i = 0, e = 0, start = 0; i < num_leader_recvs; i++)
+      {
+         for (k = meta_recv_starts[i]; k < meta_recv_starts[i + 1]; k += 3)
+         {
+            entry_src[e] = meta_recv[k];
+            keys[e]      = meta_recv[k + 1];
+            entry_len[e] = meta_recv[k + 2];
+            entry_off[e] = start;
+            perm[e]      = e;
+            start += entry_len[e];
+            e++;
+         }
+         leader_recv_starts[i + 1] = start;
+      }
+
+      hypre_TFree(meta_send, HYPRE_MEMORY_HOST);
+      hypre_TFree(meta_starts, HYPRE_MEMORY_HOST);
+      hypre_TFree(meta_send_counts, HYPRE_MEMORY_HOST);
+      hypre_TFree(meta_recv_counts, HYPRE_MEMORY_HOST);
+      hypre_TFree(meta_recv_starts, HYPRE_MEMORY_HOST);
+      hypre_TFree(meta_recv, HYPRE_MEMORY_HOST);
+
+      /*--------------------------------------------------------------------
+       * Sort the received entries by destination rank: one message per rank
+       * of the group, described to it by (source, length) pairs
+       *--------------------------------------------------------------------*/
+
+      hypre_qsort2i(keys, perm, 0, num_entries - 1);
+
+      group_send_procs  = hypre_TAlloc(HYPRE_Int, group_nprocs, HYPRE_MEMORY_HOST);
+      group_send_starts = hypre_TAlloc(HYPRE_Int, group_nprocs + 1, HYPRE_MEMORY_HOST);
+      group_send_elmts  = hypre_TAlloc(HYPRE_Int, leader_recv_starts[num_leader_recvs],
+                                       HYPRE_MEMORY_HOST);
+      scatter_pairs     = hypre_TAlloc(HYPRE_Int, 2 * num_entries, HYPRE_MEMORY_HOST);
+      group_send_starts[0] = 0;
+
+      for (m = 0; m < group_nprocs; m++)
+      {
+         counts[m] = 0;
+      }
+      for (k = 0, j = 0; k < num_entries; k++)
+      {
+         e = perm[k];
+         if (k == 0 || keys[k] != keys[k - 1])
+         {
+            group_send_procs[num_group_sends++] = keys[k];
+         }
+         for (i = 0; i < entry_len[e]; i++)
+         {
+            group_send_elmts[j++] = entry_off[e] + i;
+         }
+         group_send_starts[num_group_sends] = j;
+         scatter_pairs[2 * k]     = entry_src[e];
+         scatter_pairs[2 * k + 1] = entry_len[e];
+
+         /* members is sorted, since the ranks of group_comm follow my_id */
+         m = hypre_BinarySearch(members, keys[k], group_nprocs);
+         counts[m] += 2;
+      }
+
+      /* The destinations are sorted, so the pairs are in group rank order */
+      displs[0] = 0;
+      for (m = 0; m < group_nprocs; m++)
+      {
+         displs[m + 1] = displs[m] + counts[m];
+      }
+
+      hypre_TFree(entry_src, HYPRE_MEMORY_HOST);
+      hypre_TFree(entry_len, HYPRE_MEMORY_HOST);
+      hypre_TFree(entry_off, HYPRE_MEMORY_HOST);
+      hypre_TFree(keys, HYPRE_MEMORY_HOST);
+      hypre_TFree(perm, HYPRE_MEMORY_HOST);
+   }
+   else
+   {
+      scatter_pairs = NULL;
+   }
+
+   /*-----------------------------------------------------------------------
+    * Scatter the (source, length) pairs and map them into recv_data
+    *-----------------------------------------------------------------------*/
+
+   hypre_MPI_Scatter(counts, 1, HYPRE_MPI_INT, &num_scatter_ints, 1, HYPRE_MPI_INT,
+                     0, group_comm);
+   pairs = hypre_TAlloc(HYPRE_Int, num_scatter_ints, HYPRE_MEMORY_HOST);
+   hypre_MPI_Scatterv(scatter_pairs, counts, displs, HYPRE_MPI_INT,
+                      pairs, num_scatter_ints, HYPRE_MPI_INT, 0, group_comm);
+   hypre_TFree(scatter_pairs, HYPRE_MEMORY_HOST);
+
+   keys = hypre_TAlloc(HYPRE_Int, num_recvs, HYPRE_MEMORY_HOST);
+   perm = hypre_TAlloc(HYPRE_Int, num_recvs, HYPRE_MEMORY_HOST);
+   for (i = 0; i < num_recvs; i++)
+   {
+      keys[i] = recv_procs[i];
+      perm[i] = i;
+   }
+   hypre_qsort2i(keys, perm, 0, num_recvs - 1);
+
+   scatter_elmts = hypre_TAlloc(HYPRE_Int, scatter_size, HYPRE_MEMORY_HOST);
+   for (k = 0, e = 0; k < num_scatter_ints; k += 2)
+   {
+      proc = pairs[k];
+      len  = pairs[k + 1];
+      i    = perm[hypre_BinarySearch(keys, proc, num_recvs)];
+      hypre_assert(len == recv_vec_starts[i + 1] - recv_vec_starts[i]);
+      for (j = 0; j < len; j++)
+      {
+         scatter_elmts[e++] = recv_vec_starts[i] + j;
+      }
+   }
+   hypre_assert(e == scatter_size);
+
+   hypre_TFree(keys, HYPRE_MEMORY_HOST);
+   hypre_TFree(perm, HYPRE_MEMORY_HOST);
+   hypre_TFree(pairs, HYPRE_MEMORY_HOST);
+   hypre_TFree(members, HYPRE_MEMORY_HOST);
+   hypre_TFree(counts, HYPRE_MEMORY_HOST);
+   hypre_TFree(displs, HYPRE_MEMORY_HOST);
+
+   /*-----------------------------------------------------------------------
+    * Fill the node-aware package
+    *-----------------------------------------------------------------------*/
+
+   node_pkg = hypre_CTAlloc(hypre_ParCSRNodeCommPkg, 1, HYPRE_MEMORY_HOST);
+
+   hypre_ParCSRNodeCommPkgComm(node_pkg)             = comm;
+   hypre_ParCSRNodeCommPkgLeader(node_pkg)           = leader;
+   hypre_ParCSRNodeCommPkgSendSize(node_pkg)         = send_map_starts[num_sends];
+   hypre_ParCSRNodeCommPkgRecvSize(node_pkg)         = recv_vec_starts[num_recvs];
+
+   hypre_ParCSRNodeCommPkgNumLocalSends(node_pkg)    = num_local_sends;
+   hypre_ParCSRNodeCommPkgLocalSends(node_pkg)       = local_sends;
+   hypre_ParCSRNodeCommPkgNumLocalRecvs(node_pkg)    = num_local_recvs;
+   hypre_ParCSRNodeCommPkgLocalRecvs(node_pkg)       = local_recvs;
+
+   hypre_ParCSRNodeCommPkgGatherSize(node_pkg)       = gather_size;
+   hypre_ParCSRNodeCommPkgGatherElmts(node_pkg)      = gather_elmts;
+   hypre_ParCSRNodeCommPkgGatherBuf(node_pkg)        =
+      hypre_TAlloc(HYPRE_Complex, gather_size, HYPRE_MEMORY_HOST);
+   hypre_ParCSRNodeCommPkgScatterSize(node_pkg)      = scatter_size;
+   hypre_ParCSRNodeCommPkgScatterElmts(node_pkg)     = scatter_elmts;
+   hypre_ParCSRNodeCommPkgScatterBuf(node_pkg)       =
+      hypre_TAlloc(HYPRE_Complex, scatter_size, HYPRE_MEMORY_HOST);
+
+   if (is_leader)
+   {
+      hypre_ParCSRNodeCommPkgNumGroupRecvs(node_pkg)    = num_group_recvs;
+      hypre_ParCSRNodeCommPkgGroupRecvProcs(node_pkg)   = group_recv_procs;
+      hypre_ParCSRNodeCommPkgGroupRecvStarts(node_pkg)  = group_recv_starts;
+      hypre_ParCSRNodeCommPkgGroupBuf(node_pkg)         =
+         hypre_TAlloc(HYPRE_Complex, group_recv_starts[num_group_recvs], HYPRE_MEMORY_HOST);
+
+      hypre_ParCSRNodeCommPkgNumLeaderSends(node_pkg)   = num_leader_sends;
+      hypre_ParCSRNodeCommPkgLeaderSendProcs(node_pkg)  = leader_send_procs;
+      hypre_ParCSRNodeCommPkgLeaderSendStarts(node_pkg) = leader_send_starts;
+      hypre_ParCSRNodeCommPkgLeaderSendElmts(node_pkg)  = leader_send_elmts;
+      hypre_ParCSRNodeCommPkgLeaderSendBuf(node_pkg)    =
+         hypre_TAlloc(HYPRE_Complex, leader_send_starts[num_leader_sends], HYPRE_MEMORY_HOST);
+      hypre_ParCSRNodeCommPkgNumLeaderRecvs(node_pkg)   = num_leader_recvs;
+      hypre_ParCSRNodeCommPkgLeaderRecvProcs(node_pkg)  = leader_recv_procs;
+      hypre_ParCSRNodeCommPkgLeaderRecvStarts(node_pkg) = leader_recv_starts;
+      hypre_ParCSRNodeCommPkgLeaderBuf(node_pkg)        =
+         hypre_TAlloc(HYPRE_Complex, leader_recv_starts[num_leader_recvs], HYPRE_MEMORY_HOST);
+
+      hypre_ParCSRNodeCommPkgNumGroupSends(node_pkg)    = num_group_sends;
+      hypre_ParCSRNodeCommPkgGroupSendProcs(node_pkg)   = group_send_procs;
+      hypre_ParCSRNodeCommPkgGroupSendStarts(node_pkg)  = group_send_starts;
+      hypre_ParCSRNodeCommPkgGroupSendElmts(node_pkg)   = group_send_elmts;
+      hypre_ParCSRNodeCommPkgGroupSendBuf(node_pkg)     =
+         hypre_TAlloc(HYPRE_Complex, group_send_starts[num_group_sends], HYPRE_MEMORY_HOST);
+   }
+
+   num_requests = num_local_sends + num_local_recvs + 2 + num_group_recvs +
+                  num_leader_sends + num_leader_recvs + num_group_sends;
+   hypre_ParCSRNodeCommPkgRequests(node_pkg) =
+      hypre_CTAlloc(hypre_MPI_Request, num_requests, HYPRE_MEMORY_HOST);
+
+   hypre_ParCSRCommPkgNodePkg(comm_pkg) = node_pkg;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRNodeCommPkgDestroy
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRNodeCommPkgDestroy( hypre_ParCSRNodeCommPkg *node_pkg )
+{
+   if (!node_pkg)
+   {
+      return hypre_error_flag;
+   }
+
+   hypre_TFree(hypre_ParCSRNodeCommPkgLocalSends(node_pkg), HYPRE_MEMORY_HOST);
+   hypre_TFree(hypre_ParCSRNodeCommPkgLocalRecvs(node_pkg), HYPRE_MEMORY_HOST);
+   hypre_TFree(hypre_ParCSRNodeCommPkgGatherElmts(node_pkg), HYPRE_MEMORY_HOST);
+   hypre_TFree(hypre_ParCSRNodeCommPkgGatherBuf(node_pkg), HYPRE_MEMORY_HOST);
+   hypre_TFree(hypre_ParCSRNodeCommPkgScatterElmts(node_pkg), HYPRE_MEMORY_HOST);
+   hypre_TFree(hypre_ParCSRNodeCommPkgScatterBuf(node_pkg), HYPRE_MEMORY_HOST);
+
+   hypre_TFree(hypre_ParCSRNodeCommPkgGroupRecvProcs(node_pkg), HYPRE_MEMORY_HOST);
+   hypre_TFree(hypre_ParCSRNodeCommPkgGroupRecvStarts(node_pkg), HYPRE_MEMORY_HOST);
+   hypre_TFree(hypre_ParCSRNodeCommPkgGroupBuf(node_pkg), HYPRE_MEMORY_HOST);
+   hypre_TFree(hypre_ParCSRNodeCommPkgLeaderSendProcs(node_pkg), HYPRE_MEMORY_HOST);
+   hypre_TFree(hypre_ParCSRNodeCommPkgLeaderSendStarts(node_pkg), HYPRE_MEMORY_HOST);
+   hypre_TFree(hypre_ParCSRNodeCommPkgLeaderSendElmts(node_pkg), HYPRE_MEMORY_HOST);
+   hypre_TFree(hypre_ParCSRNodeCommPkgLeaderSendBuf(node_pkg), HYPRE_MEMORY_HOST);
+   hypre_TFree(hypre_ParCSRNodeCommPkgLeaderRecvProcs(node_pkg), HYPRE_MEMORY_HOST);
+   hypre_TFree(hypre_ParCSRNodeCommPkgLeaderRecvStarts(node_pkg), HYPRE_MEMORY_HOST);
+   hypre_TFree(hypre_ParCSRNodeCommPkgLeaderBuf(node_pkg), HYPRE_MEMORY_HOST);
+   hypre_TFree(hypre_ParCSRNodeCommPkgGroupSendProcs(node_pkg), HYPRE_MEMORY_HOST);
+   hypre_TFree(hypre_ParCSRNodeCommPkgGroupSendStarts(node_pkg), HYPRE_MEMORY_HOST);
+   hypre_TFree(hypre_ParCSRNodeCommPkgGroupSendElmts(node_pkg), HYPRE_MEMORY_HOST);
+   hypre_TFree(hypre_ParCSRNodeCommPkgGroupSendBuf(node_pkg), HYPRE_MEMORY_HOST);
+
+   hypre_TFree(hypre_ParCSRNodeCommPkgRequests(node_pkg), HYPRE_MEMORY_HOST);
+   hypre_TFree(node_pkg, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRNodeCommStart
+ *
+ * Posts the receives and the on-node sends of a job 1 exchange of comm_pkg
+ * with send_data and recv_data (host arrays), on behalf of comm_handle.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRNodeCommStart( hypre_ParCSRNodeCommPkg *node_pkg,
+                           hypre_ParCSRCommPkg     *comm_pkg,
+                           hypre_ParCSRCommHandle  *comm_handle,
+                           HYPRE_Complex           *send_data,
+                           HYPRE_Complex           *recv_data )
+{
+   MPI_Comm            comm              = hypre_ParCSRNodeCommPkgComm(node_pkg);
+   HYPRE_Int           leader            = hypre_ParCSRNodeCommPkgLeader(node_pkg);
+   HYPRE_Int           num_group_recvs   = hypre_ParCSRNodeCommPkgNumGroupRecvs(node_pkg);
+   HYPRE_Int          *group_recv_procs  = hypre_ParCSRNodeCommPkgGroupRecvProcs(node_pkg);
+   HYPRE_Int          *group_recv_starts = hypre_ParCSRNodeCommPkgGroupRecvStarts(node_pkg);
+   HYPRE_Complex      *group_buf         = hypre_ParCSRNodeCommPkgGroupBuf(node_pkg);
+   HYPRE_Int           num_leader_recvs  = hypre_ParCSRNodeCommPkgNumLeaderRecvs(node_pkg);
+   HYPRE_Int          *leader_recv_procs = hypre_ParCSRNodeCommPkgLeaderRecvProcs(node_pkg);
+   HYPRE_Int          *leader_recv_starts = hypre_ParCSRNodeCommPkgLeaderRecvStarts(node_pkg);
+   HYPRE_Complex      *leader_buf        = hypre_ParCSRNodeCommPkgLeaderBuf(node_pkg);
+   HYPRE_Int           num_local_sends   = hypre_ParCSRNodeCommPkgNumLocalSends(node_pkg);
+   HYPRE_Int          *local_sends       = hypre_ParCSRNodeCommPkgLocalSends(node_pkg);
+   HYPRE_Int           num_local_recvs   = hypre_ParCSRNodeCommPkgNumLocalRecvs(node_pkg);
+   HYPRE_Int          *local_recvs       = hypre_ParCSRNodeCommPkgLocalRecvs(node_pkg);
+   HYPRE_Int           gather_size       = hypre_ParCSRNodeCommPkgGatherSize(node_pkg);
+   HYPRE_Int          *gather_elmts      = hypre_ParCSRNodeCommPkgGatherElmts(node_pkg);
+   HYPRE_Complex      *gather_buf        = hypre_ParCSRNodeCommPkgGatherBuf(node_pkg);
+   HYPRE_Int           scatter_size      = hypre_ParCSRNodeCommPkgScatterSize(node_pkg);
+   HYPRE_Complex      *scatter_buf       = hypre_ParCSRNodeCommPkgScatterBuf(node_pkg);
+   hypre_MPI_Request  *requests          = hypre_ParCSRNodeCommPkgRequests(node_pkg);
+
+   HYPRE_Int          *send_procs        = hypre_ParCSRCommPkgSendProcs(comm_pkg);
+   HYPRE_Int          *send_map_starts   = hypre_ParCSRCommPkgSendMapStarts(comm_pkg);
+   HYPRE_Int          *recv_procs        = hypre_ParCSRCommPkgRecvProcs(comm_pkg);
+   HYPRE_Int          *recv_vec_starts   = hypre_ParCSRCommPkgRecvVecStarts(comm_pkg);
+
+   HYPRE_Int           i, j, k, start;
+
+   /* The receives of steps 1 and 2 (leader only) come first in requests */
+   j = 0;
+   for (i = 0; i < num_group_recvs; i++)
+   {
+      start = group_recv_starts[i];
+      hypre_MPI_Irecv(&group_buf[start], group_recv_starts[i + 1] - start, HYPRE_MPI_COMPLEX,
+                      group_recv_procs[i], HYPRE_NODE_COMM_GATHER_TAG, comm, &requests[j++]);
+   }
+   for (i = 0; i < num_leader_recvs; i++)
+   {
+      start = leader_recv_starts[i];
+      hypre_MPI_Irecv(&leader_buf[start], leader_recv_starts[i + 1] - start, HYPRE_MPI_COMPLEX,
+                      leader_recv_procs[i], HYPRE_NODE_COMM_LEADER_TAG, comm, &requests[j++]);
+   }
+
+   if (scatter_size)
+   {
+      hypre_MPI_Irecv(scatter_buf, scatter_size, HYPRE_MPI_COMPLEX,
+                      leader, HYPRE_NODE_COMM_SCATTER_TAG, comm, &requests[j++]);
+   }
+
+   /* Direct exchange within the group */
+   for (i = 0; i < num_local_recvs; i++)
+   {
+      k = local_recvs[i];
+      start = recv_vec_starts[k];
+      hypre_MPI_Irecv(&recv_data[start], recv_vec_starts[k + 1] - start, HYPRE_MPI_COMPLEX,
+                      recv_procs[k], HYPRE_NODE_COMM_LOCAL_TAG, comm, &requests[j++]);
+   }
+   for (i = 0; i < num_local_sends; i++)
+   {
+      k = local_sends[i];
+      start = send_map_starts[k];
+      hypre_MPI_Isend(&send_data[start], send_map_starts[k + 1] - start, HYPRE_MPI_COMPLEX,
+                      send_procs[k], HYPRE_NODE_COMM_LOCAL_TAG, comm, &requests[j++]);
+   }
+
+   /* Step 1: data for other groups goes to the leader */
+   if (gather_size)
+   {
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < gather_size; i++)
+      {
+         gather_buf[i] = send_data[gather_elmts[i]];
+      }
+      hypre_MPI_Isend(gather_buf, gather_size, HYPRE_MPI_COMPLEX,
+                      leader, HYPRE_NODE_COMM_GATHER_TAG, comm, &requests[j++]);
+   }
+
+   hypre_ParCSRNodeCommPkgNumRequests(node_pkg) = j;
+   hypre_ParCSRNodeCommPkgCommHandle(node_pkg)  = comm_handle;
+   hypre_ParCSRNodeCommPkgRecvData(node_pkg)    = recv_data;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRNodeCommFinish
+ *
+ * Completes the exchange started by hypre_ParCSRNodeCommStart.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRNodeCommFinish( hypre_ParCSRNodeCommPkg *node_pkg )
+{
+   MPI_Comm            comm               = hypre_ParCSRNodeCommPkgComm(node_pkg);
+   HYPRE_Int           num_group_recvs    = hypre_ParCSRNodeCommPkgNumGroupRecvs(node_pkg);
+   HYPRE_Complex      *group_buf          = hypre_ParCSRNodeCommPkgGroupBuf(node_pkg);
+   HYPRE_Int           num_leader_sends   = hypre_ParCSRNodeCommPkgNumLeaderSends(node_pkg);
+   HYPRE_Int          *leader_send_procs  = hypre_ParCSRNodeCommPkgLeaderSendProcs(node_pkg);
+   HYPRE_Int          *leader_send_starts = hypre_ParCSRNodeCommPkgLeaderSendStarts(node_pkg);
+   HYPRE_Int          *leader_send_elmts  = hypre_ParCSRNodeCommPkgLeaderSendElmts(node_pkg);
+   HYPRE_Complex      *leader_send_buf    = hypre_ParCSRNodeCommPkgLeaderSendBuf(node_pkg);
+   HYPRE_Int           num_leader_recvs   = hypre_ParCSRNodeCommPkgNumLeaderRecvs(node_pkg);
+   HYPRE_Complex      *leader_buf         = hypre_ParCSRNodeCommPkgLeaderBuf(node_pkg);
+   HYPRE_Int           num_group_sends    = hypre_ParCSRNodeCommPkgNumGroupSends(node_pkg);
+   HYPRE_Int          *group_send_procs   = hypre_ParCSRNodeCommPkgGroupSendProcs(node_pkg);
+   HYPRE_Int          *group_send_starts  = hypre_ParCSRNodeCommPkgGroupSendStarts(node_pkg);
+   HYPRE_Int          *group_send_elmts   = hypre_ParCSRNodeCommPkgGroupSendElmts(node_pkg);
+   HYPRE_Complex      *group_send_buf     = hypre_ParCSRNodeCommPkgGroupSendBuf(node_pkg);
+   HYPRE_Int           scatter_size       = hypre_ParCSRNodeCommPkgScatterSize(node_pkg);
+   HYPRE_Int          *scatter_elmts      = hypre_ParCSRNodeCommPkgScatterElmts(node_pkg);
+   HYPRE_Complex      *scatter_buf        = hypre_ParCSRNodeCommPkgScatterBuf(node_pkg);
+   HYPRE_Complex      *recv_data          = hypre_ParCSRNodeCommPkgRecvData(node_pkg);
+   HYPRE_Int           num_requests       = hypre_ParCSRNodeCommPkgNumRequests(node_pkg);
+   hypre_MPI_Request  *requests           = hypre_ParCSRNodeCommPkgRequests(node_pkg);
+
+   HYPRE_Int           i, j, start;
+
+   j = num_requests;
+
+   /* Step 2: forward the data gathered from the group to the other leaders */
+   if (num_group_recvs)
+   {
+      hypre_MPI_Waitall(num_group_recvs, requests, hypre_MPI_STATUSES_IGNORE);
+   }
+
+   if (num_leader_sends)
+   {
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < leader_send_starts[num_leader_sends]; i++)
+      {
+         leader_send_buf[i] = group_buf[leader_send_elmts[i]];
+      }
+   }
+   for (i = 0; i < num_leader_sends; i++)
+   {
+      start = leader_send_starts[i];
+      hypre_MPI_Isend(&leader_send_buf[start], leader_send_starts[i + 1] - start,
+                      HYPRE_MPI_COMPLEX, leader_send_procs[i], HYPRE_NODE_COMM_LEADER_TAG,
+                      comm, &requests[j++]);
+   }
+
+   /* Step 3: scatter the data received from the other leaders to the group */
+   if (num_leader_recvs)
+   {
+      hypre_MPI_Waitall(num_leader_recvs, &requests[num_group_recvs],
+                        hypre_MPI_STATUSES_IGNORE);
+   }
+
+   if (num_group_sends)
+   {
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < group_send_starts[num_group_sends]; i++)
+      {
+         group_send_buf[i] = leader_buf[group_send_elmts[i]];
+      }
+   }
+   for (i = 0; i < num_group_sends; i++)
+   {
+      start = group_send_starts[i];
+      hypre_MPI_Isend(&group_send_buf[start], group_send_starts[i + 1] - start,
+                      HYPRE_MPI_COMPLEX, group_send_procs[i], HYPRE_NODE_COMM_SCATTER_TAG,
+                      comm, &requests[j++]);
+   }
+
+   /* Complete everything else and unpack the data from the leader */
+   start = num_group_recvs + num_leader_recvs;
+   hypre_MPI_Waitall(j - start, &requests[start], hypre_MPI_STATUSES_IGNORE);
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < scatter_size; i++)
+   {
+      recv_data[scatter_elmts[i]] = scatter_buf[i];
+   }
+
+   hypre_ParCSRNodeCommPkgNumRequests(node_pkg) = 0;
+   hypre_ParCSRNodeCommPkgCommHandle(node_pkg)  = NULL;
+   hypre_ParCSRNodeCommPkgRecvData(node_pkg)    = NULL;
+
+   return hypre_error_flag;
+}
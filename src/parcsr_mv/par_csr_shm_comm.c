@@ -0,0 +1,462 @@
+/******************************************************************************
+ * Copyright (c) 1998 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Shared-memory halo exchange for ParCSR communication packages.
+ *
+ * The send buffer of every rank lives in its segment of an MPI-3 shared-memory
+ * window allocated on the ranks of the node.  The windows are pooled per
+ * node communicator (see hypre_NodeCommShmAlloc), so that building a
+ * schedule does not allocate a window of its own.  In a job 1 exchange, a rank
+ * places the values for its on-node neighbors in its segment (nothing needs
+ * to be copied if the caller packed them there, see
+ * hypre_ParCSRShmCommSendBuffer) and sends each of them a zero-byte
+ * notification.  The neighbors then load the values directly from the
+ * segment and answer with a zero-byte acknowledgement, after which the
+ * segment can be overwritten by the next exchange.  Data for ranks of other
+ * nodes is still exchanged with MPI messages.
+ *
+ *****************************************************************************/
+
+#include "_hypre_parcsr_mv.h"
+
+/* Remote messages use the comm_pkg comm and tag of the flat exchange, since
+   ranks without on-node neighbors do not build the schedule */
+#define HYPRE_SHM_COMM_REMOTE_TAG  0
+#define HYPRE_SHM_COMM_SETUP_TAG   1
+#define HYPRE_SHM_COMM_NOTIFY_TAG  2
+#define HYPRE_SHM_COMM_ACK_TAG     3
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRShmCommPkgCreate
+ *
+ * Builds the shared-memory schedule of comm_pkg and stores it in the
+ * comm_pkg.  Nothing is attached if no other rank of comm shares the node,
+ * or if no rank of the node sends anything; either holds for all ranks of a
+ * node.  Collective on the communicator of comm_pkg.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRShmCommPkgCreate( hypre_ParCSRCommPkg *comm_pkg )
+{
+   MPI_Comm                  comm            = hypre_ParCSRCommPkgComm(comm_pkg);
+   HYPRE_Int                 num_sends       = hypre_ParCSRCommPkgNumSends(comm_pkg);
+   HYPRE_Int                *send_procs      = hypre_ParCSRCommPkgSendProcs(comm_pkg);
+   HYPRE_Int                *send_map_starts = hypre_ParCSRCommPkgSendMapStarts(comm_pkg);
+   HYPRE_Int                 num_recvs       = hypre_ParCSRCommPkgNumRecvs(comm_pkg);
+   HYPRE_Int                *recv_procs      = hypre_ParCSRCommPkgRecvProcs(comm_pkg);
+   HYPRE_Int                *recv_vec_starts = hypre_ParCSRCommPkgRecvVecStarts(comm_pkg);
+
+   hypre_ParCSRShmCommPkg   *shm_pkg;
+   hypre_NodeComm           *node_info;
+   MPI_Comm                  node_comm;
+   hypre_ShmWindow          *shm_win;
+   HYPRE_Int                 send_offset;
+   HYPRE_Int                *send_offsets;
+   HYPRE_Int                 my_id, num_procs, node_nprocs;
+   HYPRE_Int                *node_procs;
+   HYPRE_Int                *node_ids;
+
+   HYPRE_Int                 num_remote_sends = 0;
+   HYPRE_Int                *remote_sends;
+   HYPRE_Int                 num_remote_recvs = 0;
+   HYPRE_Int                *remote_recvs;
+   HYPRE_Int                 num_shm_sends = 0;
+   HYPRE_Int                *shm_sends;
+   HYPRE_Int                *shm_send_procs;
+   HYPRE_Int                 num_shm_recvs = 0;
+   HYPRE_Int                *shm_recv_procs;
+   HYPRE_Int                *shm_recv_starts;
+   HYPRE_Int                *shm_recv_sizes;
+   HYPRE_Int                *shm_recv_offsets;
+   HYPRE_Complex           **shm_recv_data;
+   HYPRE_Complex            *base;
+   hypre_MPI_Aint            size;
+   HYPRE_Int                 disp_unit;
+   hypre_MPI_Request        *requests;
+   HYPRE_Int                 num_requests;
+
+   HYPRE_Int                 i, j, k;
+
+   hypre_MPI_Comm_rank(comm, &my_id);
+   hypre_MPI_Comm_size(comm, &num_procs);
+
+   if (num_procs < 2)
+   {
+      return hypre_error_flag;
+   }
+
+   /*-----------------------------------------------------------------------
+    * Find the ranks of comm on this node
+    *-----------------------------------------------------------------------*/
+
+   node_info = hypre_NodeCommGet(comm, 1);
+   node_comm = hypre_NodeCommGroupComm(node_info);
+   hypre_MPI_Comm_size(node_comm, &node_nprocs);
+
+   if (node_nprocs < 2)
+   {
+      return hypre_error_flag;
+   }
+
+   /* Sorted ranks (in comm) of the node, with their rank in node_comm */
+   node_procs = hypre_TAlloc(HYPRE_Int, node_nprocs, HYPRE_MEMORY_HOST);
+   node_ids   = hypre_TAlloc(HYPRE_Int, node_nprocs, HYPRE_MEMORY_HOST);
+   hypre_MPI_Allgather(&my_id, 1, HYPRE_MPI_INT, node_procs, 1, HYPRE_MPI_INT, node_comm);
+   for (i = 0; i < node_nprocs; i++)
+   {
+      node_ids[i] = i;
+   }
+   hypre_qsort2i(node_procs, node_ids, 0, node_nprocs - 1);
+
+   /*-----------------------------------------------------------------------
+    * Split the sends and receives into on-node and remote ones
+    *-----------------------------------------------------------------------*/
+
+   remote_sends   = hypre_TAlloc(HYPRE_Int, num_sends, HYPRE_MEMORY_HOST);
+   shm_sends      = hypre_TAlloc(HYPRE_Int, num_sends, HYPRE_MEMORY_HOST);
+   shm_send_procs = hypre_TAlloc(HYPRE_Int, num_sends, HYPRE_MEMORY_HOST);
+   for (i = 0; i < num_sends; i++)
+   {
+      k = hypre_BinarySearch(node_procs, send_procs[i], node_nprocs);
+      if (k < 0)
+      {
+         remote_sends[num_remote_sends++] = i;
+      }
+      else
+      {
+         shm_sends[num_shm_sends]        = i;
+         shm_send_procs[num_shm_sends++] = node_ids[k];
+      }
+   }
+
+   remote_recvs    = hypre_TAlloc(HYPRE_Int, num_recvs, HYPRE_MEMORY_HOST);
+   shm_recv_procs  = hypre_TAlloc(HYPRE_Int, num_recvs, HYPRE_MEMORY_HOST);
+   shm_recv_starts = hypre_TAlloc(HYPRE_Int, num_recvs, HYPRE_MEMORY_HOST);
+   shm_recv_sizes  = hypre_TAlloc(HYPRE_Int, num_recvs, HYPRE_MEMORY_HOST);
+   for (i = 0; i < num_recvs; i++)
+   {
+      k = hypre_BinarySearch(node_procs, recv_procs[i], node_nprocs);
+      if (k < 0)
+      {
+         remote_recvs[num_remote_recvs++] = i;
+      }
+      else
+      {
+         shm_recv_procs[num_shm_recvs]  = node_ids[k];
+         shm_recv_starts[num_shm_recvs] = recv_vec_starts[i];
+         shm_recv_sizes[num_shm_recvs]  = recv_vec_starts[i + 1] - recv_vec_starts[i];
+         num_shm_recvs++;
+      }
+   }
+
+   hypre_TFree(node_procs, HYPRE_MEMORY_HOST);
+   hypre_TFree(node_ids, HYPRE_MEMORY_HOST);
+
+   /*-----------------------------------------------------------------------
+    * Take the send buffer from the window pool and locate the data of the
+    * on-node senders
+    *-----------------------------------------------------------------------*/
+
+   shm_win = hypre_NodeCommShmAlloc(node_info, send_map_starts[num_sends], &send_offset);
+
+   if (!shm_win)
+   {
+      hypre_TFree(remote_sends, HYPRE_MEMORY_HOST);
+      hypre_TFree(shm_sends, HYPRE_MEMORY_HOST);
+      hypre_TFree(shm_send_procs, HYPRE_MEMORY_HOST);
+      hypre_TFree(remote_recvs, HYPRE_MEMORY_HOST);
+      hypre_TFree(shm_recv_procs, HYPRE_MEMORY_HOST);
+      hypre_TFree(shm_recv_starts, HYPRE_MEMORY_HOST);
+      hypre_TFree(shm_recv_sizes, HYPRE_MEMORY_HOST);
+
+      return hypre_error_flag;
+   }
+
+   /* Every sender tells its on-node receivers where their data starts */
+   send_offsets     = hypre_TAlloc(HYPRE_Int, num_shm_sends, HYPRE_MEMORY_HOST);
+   shm_recv_offsets = hypre_TAlloc(HYPRE_Int, num_shm_recvs, HYPRE_MEMORY_HOST);
+   requests = hypre_TAlloc(hypre_MPI_Request, num_shm_sends + num_shm_recvs,
+                           HYPRE_MEMORY_HOST);
+   j = 0;
+   for (i = 0; i < num_shm_recvs; i++)
+   {
+      hypre_MPI_Irecv(&shm_recv_offsets[i], 1, HYPRE_MPI_INT, shm_recv_procs[i],
+                      HYPRE_SHM_COMM_SETUP_TAG, node_comm, &requests[j++]);
+   }
+   for (i = 0; i < num_shm_sends; i++)
+   {
+      send_offsets[i] = send_offset + send_map_starts[shm_sends[i]];
+      hypre_MPI_Isend(&send_offsets[i], 1, HYPRE_MPI_INT, shm_send_procs[i],
+                      HYPRE_SHM_COMM_SETUP_TAG, node_comm, &requests[j++]);
+   }
+   hypre_MPI_Waitall(j, requests, hypre_MPI_STATUSES_IGNORE);
+   hypre_TFree(requests, HYPRE_MEMORY_HOST);
+   hypre_TFree(send_offsets, HYPRE_MEMORY_HOST);
+
+   shm_recv_data = hypre_TAlloc(HYPRE_Complex *, num_shm_recvs, HYPRE_MEMORY_HOST);
+   for (i = 0; i < num_shm_recvs; i++)
+   {
+      hypre_MPI_Win_shared_query(hypre_ShmWindowWin(shm_win), shm_recv_procs[i],
+                                 &size, &disp_unit, &base);
+      shm_recv_data[i] = base + shm_recv_offsets[i];
+   }
+   hypre_TFree(shm_recv_offsets, HYPRE_MEMORY_HOST);
+
+   /*-----------------------------------------------------------------------
+    * Store the schedule
+    *-----------------------------------------------------------------------*/
+
+   shm_pkg = hypre_CTAlloc(hypre_ParCSRShmCommPkg, 1, HYPRE_MEMORY_HOST);
+
+   hypre_ParCSRShmCommPkgNodeComm(shm_pkg)      = node_comm;
+   hypre_ParCSRShmCommPkgShmWin(shm_pkg)        = shm_win;
+   hypre_ParCSRShmCommPkgSendBuf(shm_pkg)       = hypre_ShmWindowBase(shm_win) + send_offset;
+   hypre_ParCSRShmCommPkgSendSize(shm_pkg)      = send_map_starts[num_sends];
+   hypre_ParCSRShmCommPkgRecvSize(shm_pkg)      = recv_vec_starts[num_recvs];
+   hypre_ParCSRShmCommPkgNumRemoteSends(shm_pkg) = num_remote_sends;
+   hypre_ParCSRShmCommPkgRemoteSends(shm_pkg)   = remote_sends;
+   hypre_ParCSRShmCommPkgNumRemoteRecvs(shm_pkg) = num_remote_recvs;
+   hypre_ParCSRShmCommPkgRemoteRecvs(shm_pkg)   = remote_recvs;
+   hypre_ParCSRShmCommPkgNumShmSends(shm_pkg)   = num_shm_sends;
+   hypre_ParCSRShmCommPkgShmSends(shm_pkg)      = shm_sends;
+   hypre_ParCSRShmCommPkgShmSendProcs(shm_pkg)  = shm_send_procs;
+   hypre_ParCSRShmCommPkgNumShmRecvs(shm_pkg)   = num_shm_recvs;
+   hypre_ParCSRShmCommPkgShmRecvProcs(shm_pkg)  = shm_recv_procs;
+   hypre_ParCSRShmCommPkgShmRecvStarts(shm_pkg) = shm_recv_starts;
+   hypre_ParCSRShmCommPkgShmRecvSizes(shm_pkg)  = shm_recv_sizes;
+   hypre_ParCSRShmCommPkgShmRecvData(shm_pkg)   = shm_recv_data;
+
+   /* Notifications and acknowledgements are sent from both sides */
+   num_requests = num_remote_sends + num_remote_recvs + num_shm_sends + 2 * num_shm_recvs;
+   hypre_ParCSRShmCommPkgRequests(shm_pkg) =
+      hypre_TAlloc(hypre_MPI_Request, num_requests, HYPRE_MEMORY_HOST);
+   hypre_ParCSRShmCommPkgAckRequests(shm_pkg) =
+      hypre_TAlloc(hypre_MPI_Request, num_shm_sends, HYPRE_MEMORY_HOST);
+   for (i = 0; i < num_shm_sends; i++)
+   {
+      hypre_ParCSRShmCommPkgAckRequests(shm_pkg)[i] = hypre_MPI_REQUEST_NULL;
+   }
+
+   hypre_ParCSRCommPkgShmPkg(comm_pkg) = shm_pkg;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRShmCommPkgDestroy
+ *
+ * Returns the send buffer to the window pool once the on-node neighbors are
+ * done with it.  Not collective.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRShmCommPkgDestroy( hypre_ParCSRShmCommPkg *shm_pkg )
+{
+   if (!shm_pkg)
+   {
+      return hypre_error_flag;
+   }
+
+   /* Wait until the neighbors are done with the last exchange */
+   hypre_MPI_Waitall(hypre_ParCSRShmCommPkgNumShmSends(shm_pkg),
+                     hypre_ParCSRShmCommPkgAckRequests(shm_pkg), hypre_MPI_STATUSES_IGNORE);
+
+   hypre_NodeCommShmRelease(hypre_ParCSRShmCommPkgShmWin(shm_pkg));
+
+   hypre_TFree(hypre_ParCSRShmCommPkgRemoteSends(shm_pkg), HYPRE_MEMORY_HOST);
+   hypre_TFree(hypre_ParCSRShmCommPkgRemoteRecvs(shm_pkg), HYPRE_MEMORY_HOST);
+   hypre_TFree(hypre_ParCSRShmCommPkgShmSends(shm_pkg), HYPRE_MEMORY_HOST);
+   hypre_TFree(hypre_ParCSRShmCommPkgShmSendProcs(shm_pkg), HYPRE_MEMORY_HOST);
+   hypre_TFree(hypre_ParCSRShmCommPkgShmRecvProcs(shm_pkg), HYPRE_MEMORY_HOST);
+   hypre_TFree(hypre_ParCSRShmCommPkgShmRecvStarts(shm_pkg), HYPRE_MEMORY_HOST);
+   hypre_TFree(hypre_ParCSRShmCommPkgShmRecvSizes(shm_pkg), HYPRE_MEMORY_HOST);
+   hypre_TFree(hypre_ParCSRShmCommPkgShmRecvData(shm_pkg), HYPRE_MEMORY_HOST);
+
+   hypre_TFree(hypre_ParCSRShmCommPkgRequests(shm_pkg), HYPRE_MEMORY_HOST);
+   hypre_TFree(hypre_ParCSRShmCommPkgAckRequests(shm_pkg), HYPRE_MEMORY_HOST);
+   hypre_TFree(shm_pkg, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRShmCommSendBuffer
+ *
+ * Returns the window segment of this rank if the next job 1 exchange of
+ * comm_pkg can go through the shared-memory schedule, and NULL otherwise.
+ * The caller may pack its send data directly into the returned buffer, which
+ * has the layout of send_data (hypre_ParCSRCommPkgSendMapStart), and then
+ * passes it to hypre_ParCSRCommHandleCreate.  The buffer is owned by
+ * comm_pkg and must not be freed.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Complex *
+hypre_ParCSRShmCommSendBuffer( hypre_ParCSRCommPkg *comm_pkg )
+{
+   hypre_ParCSRShmCommPkg  *shm_pkg = hypre_ParCSRCommPkgShmPkg(comm_pkg);
+
+   if (!shm_pkg || hypre_ParCSRShmCommPkgCommHandle(shm_pkg) ||
+       hypre_ParCSRShmCommPkgSendSize(shm_pkg) !=
+       hypre_ParCSRCommPkgSendMapStart(comm_pkg, hypre_ParCSRCommPkgNumSends(comm_pkg)))
+   {
+      return NULL;
+   }
+
+   /* The neighbors must be done with the values of the previous exchange */
+   hypre_MPI_Waitall(hypre_ParCSRShmCommPkgNumShmSends(shm_pkg),
+                     hypre_ParCSRShmCommPkgAckRequests(shm_pkg), hypre_MPI_STATUSES_IGNORE);
+
+   return hypre_ParCSRShmCommPkgSendBuf(shm_pkg);
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRShmCommStart
+ *
+ * Starts a job 1 exchange of comm_pkg with the shared-memory schedule.
+ * send_data and recv_data are host arrays laid out as in the flat exchange.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRShmCommStart( hypre_ParCSRShmCommPkg  *shm_pkg,
+                          hypre_ParCSRCommPkg     *comm_pkg,
+                          hypre_ParCSRCommHandle  *comm_handle,
+                          HYPRE_Complex           *send_data,
+                          HYPRE_Complex           *recv_data )
+{
+   MPI_Comm            node_comm        = hypre_ParCSRShmCommPkgNodeComm(shm_pkg);
+   HYPRE_Complex      *send_buf         = hypre_ParCSRShmCommPkgSendBuf(shm_pkg);
+   HYPRE_Int           num_remote_sends = hypre_ParCSRShmCommPkgNumRemoteSends(shm_pkg);
+   HYPRE_Int          *remote_sends     = hypre_ParCSRShmCommPkgRemoteSends(shm_pkg);
+   HYPRE_Int           num_remote_recvs = hypre_ParCSRShmCommPkgNumRemoteRecvs(shm_pkg);
+   HYPRE_Int          *remote_recvs     = hypre_ParCSRShmCommPkgRemoteRecvs(shm_pkg);
+   HYPRE_Int           num_shm_sends    = hypre_ParCSRShmCommPkgNumShmSends(shm_pkg);
+   HYPRE_Int          *shm_sends        = hypre_ParCSRShmCommPkgShmSends(shm_pkg);
+   HYPRE_Int          *shm_send_procs   = hypre_ParCSRShmCommPkgShmSendProcs(shm_pkg);
+   HYPRE_Int           num_shm_recvs    = hypre_ParCSRShmCommPkgNumShmRecvs(shm_pkg);
+   HYPRE_Int          *shm_recv_procs   = hypre_ParCSRShmCommPkgShmRecvProcs(shm_pkg);
+   hypre_MPI_Request  *requests         = hypre_ParCSRShmCommPkgRequests(shm_pkg);
+   hypre_MPI_Request  *ack_requests     = hypre_ParCSRShmCommPkgAckRequests(shm_pkg);
+
+   MPI_Comm            comm             = hypre_ParCSRCommPkgComm(comm_pkg);
+   HYPRE_Int          *send_procs       = hypre_ParCSRCommPkgSendProcs(comm_pkg);
+   HYPRE_Int          *send_map_starts  = hypre_ParCSRCommPkgSendMapStarts(comm_pkg);
+   HYPRE_Int          *recv_procs       = hypre_ParCSRCommPkgRecvProcs(comm_pkg);
+   HYPRE_Int          *recv_vec_starts  = hypre_ParCSRCommPkgRecvVecStarts(comm_pkg);
+
+   HYPRE_Int           i, j, k, start;
+
+   /* The notifications come first in requests, see hypre_ParCSRShmCommFinish */
+   j = 0;
+   for (i = 0; i < num_shm_recvs; i++)
+   {
+      hypre_MPI_Irecv(NULL, 0, HYPRE_MPI_COMPLEX, shm_recv_procs[i],
+                      HYPRE_SHM_COMM_NOTIFY_TAG, node_comm, &requests[j++]);
+   }
+
+   /* Messages to and from other nodes */
+   for (i = 0; i < num_remote_recvs; i++)
+   {
+      k = remote_recvs[i];
+      start = recv_vec_starts[k];
+      hypre_MPI_Irecv(&recv_data[start], recv_vec_starts[k + 1] - start, HYPRE_MPI_COMPLEX,
+                      recv_procs[k], HYPRE_SHM_COMM_REMOTE_TAG, comm, &requests[j++]);
+   }
+   for (i = 0; i < num_remote_sends; i++)
+   {
+      k = remote_sends[i];
+      start = send_map_starts[k];
+      hypre_MPI_Isend(&send_data[start], send_map_starts[k + 1] - start, HYPRE_MPI_COMPLEX,
+                      send_procs[k], HYPRE_SHM_COMM_REMOTE_TAG, comm, &requests[j++]);
+   }
+
+   /* Publish the on-node values, unless the caller packed them in place */
+   if (num_shm_sends)
+   {
+      hypre_MPI_Waitall(num_shm_sends, ack_requests, hypre_MPI_STATUSES_IGNORE);
+   }
+
+   if (send_data != send_buf)
+   {
+      for (i = 0; i < num_shm_sends; i++)
+      {
+         k = shm_sends[i];
+         start = send_map_starts[k];
+         hypre_TMemcpy(&send_buf[start], &send_data[start], HYPRE_Complex,
+                       send_map_starts[k + 1] - start, HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+      }
+   }
+   hypre_MPI_Win_sync(hypre_ShmWindowWin(hypre_ParCSRShmCommPkgShmWin(shm_pkg)));
+
+   for (i = 0; i < num_shm_sends; i++)
+   {
+      hypre_MPI_Irecv(NULL, 0, HYPRE_MPI_COMPLEX, shm_send_procs[i],
+                      HYPRE_SHM_COMM_ACK_TAG, node_comm, &ack_requests[i]);
+      hypre_MPI_Isend(NULL, 0, HYPRE_MPI_COMPLEX, shm_send_procs[i],
+                      HYPRE_SHM_COMM_NOTIFY_TAG, node_comm, &requests[j++]);
+   }
+
+   hypre_ParCSRShmCommPkgNumRequests(shm_pkg) = j;
+   hypre_ParCSRShmCommPkgCommHandle(shm_pkg)  = comm_handle;
+   hypre_ParCSRShmCommPkgRecvData(shm_pkg)    = recv_data;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRShmCommFinish
+ *
+ * Completes the exchange started by hypre_ParCSRShmCommStart.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRShmCommFinish( hypre_ParCSRShmCommPkg *shm_pkg )
+{
+   MPI_Comm            node_comm       = hypre_ParCSRShmCommPkgNodeComm(shm_pkg);
+   HYPRE_Int           num_shm_recvs   = hypre_ParCSRShmCommPkgNumShmRecvs(shm_pkg);
+   HYPRE_Int          *shm_recv_procs  = hypre_ParCSRShmCommPkgShmRecvProcs(shm_pkg);
+   HYPRE_Int          *shm_recv_starts = hypre_ParCSRShmCommPkgShmRecvStarts(shm_pkg);
+   HYPRE_Int          *shm_recv_sizes  = hypre_ParCSRShmCommPkgShmRecvSizes(shm_pkg);
+   HYPRE_Complex     **shm_recv_data   = hypre_ParCSRShmCommPkgShmRecvData(shm_pkg);
+   HYPRE_Complex      *recv_data       = hypre_ParCSRShmCommPkgRecvData(shm_pkg);
+   HYPRE_Int           num_requests    = hypre_ParCSRShmCommPkgNumRequests(shm_pkg);
+   hypre_MPI_Request  *requests        = hypre_ParCSRShmCommPkgRequests(shm_pkg);
+
+   HYPRE_Int           i, j;
+
+   /* Load the values of the on-node senders once they are published */
+   if (num_shm_recvs)
+   {
+      hypre_MPI_Waitall(num_shm_recvs, requests, hypre_MPI_STATUSES_IGNORE);
+      hypre_MPI_Win_sync(hypre_ShmWindowWin(hypre_ParCSRShmCommPkgShmWin(shm_pkg)));
+
+      for (i = 0; i < num_shm_recvs; i++)
+      {
+         hypre_TMemcpy(&recv_data[shm_recv_starts[i]], shm_recv_data[i], HYPRE_Complex,
+                       shm_recv_sizes[i], HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+      }
+
+      hypre_MPI_Win_sync(hypre_ShmWindowWin(hypre_ParCSRShmCommPkgShmWin(shm_pkg)));
+   }
+
+   j = num_requests;
+   for (i = 0; i < num_shm_recvs; i++)
+   {
+      hypre_MPI_Isend(NULL, 0, HYPRE_MPI_COMPLEX, shm_recv_procs[i],
+                      HYPRE_SHM_COMM_ACK_TAG, node_comm, &requests[j++]);
+   }
+
+   /* Complete the remote messages, the notifications and the acknowledgements */
+   hypre_MPI_Waitall(j - num_shm_recvs, &requests[num_shm_recvs], hypre_MPI_STATUSES_IGNORE);
+
+   hypre_ParCSRShmCommPkgNumRequests(shm_pkg) = 0;
+   hypre_ParCSRShmCommPkgCommHandle(shm_pkg)  = NULL;
+   hypre_ParCSRShmCommPkgRecvData(shm_pkg)    = NULL;
+
+   return hypre_error_flag;
+}
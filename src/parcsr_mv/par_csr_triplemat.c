@@ -95,24 +95,26 @@ hypre_ParCSRMatMatHost( hypre_ParCSRMatrix  *A,
 
    if (num_procs > 1)
    {
+      void *request;
+
       /*---------------------------------------------------------------------
        * If there exists no CommPkg for A, a CommPkg is generated using
        * equally load balanced partitionings within
-       * hypre_ParCSRMatrixExtractBExt
+       * hypre_ParCSRMatrixExtractBExtInit
        *--------------------------------------------------------------------*/
-      Bs_ext = hypre_ParCSRMatrixExtractBExt(B, A, 1); /* contains communication
-                                                          which should be explicitly included to allow for overlap */
+      hypre_ParCSRMatrixExtractBExtInit(B, A, 1, &request);
+
+      /* These are local and overlapped with communication */
+      AB_diag = hypre_CSRMatrixMultiplyHost(A_diag, B_diag);
+      AB_offd = hypre_CSRMatrixMultiplyHost(A_diag, B_offd);
 
+      Bs_ext = hypre_ParCSRMatrixExtractBExtWait(request);
 
       hypre_CSRMatrixSplit(Bs_ext, first_col_diag_B, last_col_diag_B, num_cols_offd_B, col_map_offd_B,
                            &num_cols_offd_C, &col_map_offd_C, &Bext_diag, &Bext_offd);
 
       hypre_CSRMatrixDestroy(Bs_ext);
 
-      /* These are local and could be overlapped with communication */
-      AB_diag = hypre_CSRMatrixMultiplyHost(A_diag, B_diag);
-      AB_offd = hypre_CSRMatrixMultiplyHost(A_diag, B_offd);
-
       /* These require data from other processes */
       ABext_diag = hypre_CSRMatrixMultiplyHost(A_offd, Bext_diag);
       ABext_offd = hypre_CSRMatrixMultiplyHost(A_offd, Bext_offd);
@@ -611,10 +613,23 @@ hypre_ParCSRMatrixRAPKTHost( hypre_ParCSRMatrix *R,
       /*---------------------------------------------------------------------
        * If there exists no CommPkg for A, a CommPkg is generated using
        * equally load balanced partitionings within
-       * hypre_ParCSRMatrixExtractBExt
+       * hypre_ParCSRMatrixExtractBExtInit
        *--------------------------------------------------------------------*/
-      Ps_ext = hypre_ParCSRMatrixExtractBExt(P, A, 1); /* contains communication
-                                                          which should be explicitly included to allow for overlap */
+      hypre_ParCSRMatrixExtractBExtInit(P, A, 1, &request);
+
+      /* These are local and overlapped with communication */
+      AP_diag = hypre_CSRMatrixMultiplyHost(A_diag, P_diag);
+      if (num_cols_offd_P)
+      {
+         AP_offd = hypre_CSRMatrixMultiplyHost(A_diag, P_offd);
+      }
+      hypre_CSRMatrixTranspose(R_diag, &RT_diag, 1);
+      if (num_cols_offd_R)
+      {
+         hypre_CSRMatrixTranspose(R_offd, &RT_offd, 1);
+      }
+
+      Ps_ext = hypre_ParCSRMatrixExtractBExtWait(request);
       if (num_cols_offd_A)
       {
          last_col_diag_P = first_col_diag_P + num_cols_diag_P - 1;
@@ -637,13 +652,10 @@ hypre_ParCSRMatrixRAPKTHost( hypre_ParCSRMatrix *R,
          }
       }
       hypre_CSRMatrixDestroy(Ps_ext);
-      /* These are local and could be overlapped with communication */
-      AP_diag = hypre_CSRMatrixMultiplyHost(A_diag, P_diag);
 
       if (num_cols_offd_P)
       {
          HYPRE_Int i;
-         AP_offd = hypre_CSRMatrixMultiplyHost(A_diag, P_offd);
          if (num_cols_offd_Q > num_cols_offd_P)
          {
             map_P_to_Q = hypre_CTAlloc(HYPRE_Int, num_cols_offd_P, HYPRE_MEMORY_HOST);
@@ -712,7 +724,26 @@ hypre_ParCSRMatrixRAPKTHost( hypre_ParCSRMatrix *R,
       hypre_ParCSRMatrixOffd(Q) = Q_offd;
       hypre_ParCSRMatrixColMapOffd(Q) = col_map_offd_Q;
 
-      hypre_CSRMatrixTranspose(R_diag, &RT_diag, 1);
+      if (num_cols_offd_R)
+      {
+         C_int_diag = hypre_CSRMatrixMultiplyHost(RT_offd, Q_diag);
+         C_int_offd = hypre_CSRMatrixMultiplyHost(RT_offd, Q_offd);
+
+         hypre_ParCSRMatrixDiag(Q) = C_int_diag;
+         hypre_ParCSRMatrixOffd(Q) = C_int_offd;
+         C_int = hypre_MergeDiagAndOffd(Q);
+         hypre_ParCSRMatrixDiag(Q) = Q_diag;
+         hypre_ParCSRMatrixOffd(Q) = Q_offd;
+      }
+      else
+      {
+         C_int = hypre_CSRMatrixCreate(0, 0, 0);
+         hypre_CSRMatrixInitialize(C_int);
+      }
+
+      /* contains communication, overlapped with the local product R_diag^T Q */
+      hypre_ExchangeExternalRowsInit(C_int, comm_pkg_R, &request);
+
       C_tmp_diag = hypre_CSRMatrixMultiplyHost(RT_diag, Q_diag);
       if (num_cols_offd_Q)
       {
@@ -733,26 +764,6 @@ hypre_ParCSRMatrixRAPKTHost( hypre_ParCSRMatrix *R,
          hypre_CSRMatrixDestroy(RT_diag);
       }
 
-      if (num_cols_offd_R)
-      {
-         hypre_CSRMatrixTranspose(R_offd, &RT_offd, 1);
-         C_int_diag = hypre_CSRMatrixMultiplyHost(RT_offd, Q_diag);
-         C_int_offd = hypre_CSRMatrixMultiplyHost(RT_offd, Q_offd);
-
-         hypre_ParCSRMatrixDiag(Q) = C_int_diag;
-         hypre_ParCSRMatrixOffd(Q) = C_int_offd;
-         C_int = hypre_MergeDiagAndOffd(Q);
-         hypre_ParCSRMatrixDiag(Q) = Q_diag;
-         hypre_ParCSRMatrixOffd(Q) = Q_offd;
-      }
-      else
-      {
-         C_int = hypre_CSRMatrixCreate(0, 0, 0);
-         hypre_CSRMatrixInitialize(C_int);
-      }
-
-      /* contains communication; should be explicitly included to allow for overlap */
-      hypre_ExchangeExternalRowsInit(C_int, comm_pkg_R, &request);
       C_ext = hypre_ExchangeExternalRowsWait(request);
 
       hypre_CSRMatrixDestroy(C_int);
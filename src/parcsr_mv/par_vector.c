@@ -442,6 +442,24 @@ hypre_ParVectorAxpy( HYPRE_Complex    alpha,
    return hypre_SeqVectorAxpy(alpha, x_local, y_local);
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_ParVectorAxpby
+ *
+ * y = alpha*x + beta*y
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParVectorAxpby( HYPRE_Complex    alpha,
+                      hypre_ParVector *x,
+                      HYPRE_Complex    beta,
+                      hypre_ParVector *y )
+{
+   hypre_Vector *x_local = hypre_ParVectorLocalVector(x);
+   hypre_Vector *y_local = hypre_ParVectorLocalVector(y);
+
+   return hypre_SeqVectorAxpby(alpha, x_local, beta, y_local);
+}
+
 /*--------------------------------------------------------------------------
  * hypre_ParVectorInnerProd
  *--------------------------------------------------------------------------*/
@@ -469,6 +487,46 @@ hypre_ParVectorInnerProd( hypre_ParVector *x,
    return result;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_ParVectorUpdateSolutionResidual
+ *
+ * x = x + alpha*p and r = r - alpha*s in a single pass.  If r_prod is not
+ * NULL, <r,r> is accumulated in the same pass and returned in r_prod.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParVectorUpdateSolutionResidual( HYPRE_Complex    alpha,
+                                       hypre_ParVector *p,
+                                       hypre_ParVector *s,
+                                       hypre_ParVector *x,
+                                       hypre_ParVector *r,
+                                       HYPRE_Real      *r_prod )
+{
+   MPI_Comm      comm    = hypre_ParVectorComm(r);
+   HYPRE_Real    local_result;
+
+   hypre_SeqVectorUpdateSolutionResidual(alpha,
+                                         hypre_ParVectorLocalVector(p),
+                                         hypre_ParVectorLocalVector(s),
+                                         hypre_ParVectorLocalVector(x),
+                                         hypre_ParVectorLocalVector(r),
+                                         r_prod ? &local_result : NULL);
+
+   if (r_prod)
+   {
+#ifdef HYPRE_PROFILE
+      hypre_profile_times[HYPRE_TIMER_ID_ALL_REDUCE] -= hypre_MPI_Wtime();
+#endif
+      hypre_MPI_Allreduce(&local_result, r_prod, 1, HYPRE_MPI_REAL,
+                          hypre_MPI_SUM, comm);
+#ifdef HYPRE_PROFILE
+      hypre_profile_times[HYPRE_TIMER_ID_ALL_REDUCE] += hypre_MPI_Wtime();
+#endif
+   }
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_ParVectorElmdivpy
  * y = y + x ./ b [MATLAB Notation]
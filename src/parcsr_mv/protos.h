@@ -296,6 +296,9 @@ void hypre_ParCSRMatrixExtractBExt_Arrays_Overlap ( HYPRE_Int **pB_ext_i, HYPRE_
                                                     HYPRE_BigInt *col_map_offd, HYPRE_Real *diag_data, HYPRE_Real *offd_data,
                                                     hypre_ParCSRCommHandle **comm_handle_idx, hypre_ParCSRCommHandle **comm_handle_data,
                                                     HYPRE_Int *CF_marker, HYPRE_Int *CF_marker_offd, HYPRE_Int skip_fine, HYPRE_Int skip_same_sign );
+HYPRE_Int hypre_ParCSRMatrixExtractBExtInit ( hypre_ParCSRMatrix *B, hypre_ParCSRMatrix *A,
+                                             HYPRE_Int want_data, void **request_ptr );
+hypre_CSRMatrix *hypre_ParCSRMatrixExtractBExtWait ( void *request );
 hypre_CSRMatrix *hypre_ParCSRMatrixExtractBExt ( hypre_ParCSRMatrix *B, hypre_ParCSRMatrix *A,
                                                  HYPRE_Int data );
 hypre_CSRMatrix *hypre_ParCSRMatrixExtractBExt_Overlap ( hypre_ParCSRMatrix *B,
@@ -358,17 +361,18 @@ HYPRE_Int hypre_ParCSRMatrixDropSmallEntriesDevice( hypre_ParCSRMatrix *A, HYPRE
 
 HYPRE_Int hypre_ParCSRCommPkgCreateMatrixE( hypre_ParCSRCommPkg *comm_pkg, HYPRE_Int local_ncols );
 
-#ifdef HYPRE_USING_PERSISTENT_COMM
 hypre_ParCSRPersistentCommHandle* hypre_ParCSRPersistentCommHandleCreate(HYPRE_Int job,
                                                                          hypre_ParCSRCommPkg *comm_pkg);
 hypre_ParCSRPersistentCommHandle* hypre_ParCSRCommPkgGetPersistentCommHandle(HYPRE_Int job,
                                                                              hypre_ParCSRCommPkg *comm_pkg);
+hypre_ParCSRPersistentCommHandle* hypre_ParCSRCommPkgFindPersistentCommHandle(HYPRE_Int job,
+                                                                              hypre_ParCSRCommPkg *comm_pkg);
+HYPRE_Int hypre_ParCSRCommPkgDestroyPersistentCommHandles( hypre_ParCSRCommPkg *comm_pkg );
 void hypre_ParCSRPersistentCommHandleDestroy(hypre_ParCSRPersistentCommHandle *comm_handle);
 void hypre_ParCSRPersistentCommHandleStart(hypre_ParCSRPersistentCommHandle *comm_handle,
                                            HYPRE_MemoryLocation send_memory_location, void *send_data);
 void hypre_ParCSRPersistentCommHandleWait(hypre_ParCSRPersistentCommHandle *comm_handle,
                                           HYPRE_MemoryLocation recv_memory_location, void *recv_data);
-#endif
 
 HYPRE_Int hypre_ParcsrGetExternalRowsInit( hypre_ParCSRMatrix *A, HYPRE_Int indices_len,
                                            HYPRE_BigInt *indices, hypre_ParCSRCommPkg *comm_pkg, HYPRE_Int want_data, void **request_ptr);
@@ -459,6 +463,17 @@ hypre_ParCSRMatrix* hypre_ParCSRMatrixClone_v2 ( hypre_ParCSRMatrix *A, HYPRE_In
 HYPRE_Int hypre_ParCSRMatrixMigrate(hypre_ParCSRMatrix *A, HYPRE_MemoryLocation memory_location);
 HYPRE_Int hypre_ParCSRMatrixSetConstantValues( hypre_ParCSRMatrix *A, HYPRE_Complex value );
 void hypre_ParCSRMatrixCopyColMapOffdToDevice(hypre_ParCSRMatrix *A);
+HYPRE_Int hypre_ParCSRMatrixCreateMergedLayout( hypre_ParCSRMatrix *A );
+HYPRE_Int hypre_ParCSRMatrixDestroyMergedLayout( hypre_ParCSRMatrix *A );
+
+/* par_csr_matpowers.c */
+hypre_ParCSRMatPowers *hypre_ParCSRMatPowersCreate ( hypre_ParCSRMatrix *A, HYPRE_Int num_powers,
+                                                     HYPRE_Real *scale );
+HYPRE_Int hypre_ParCSRMatPowersDestroy ( hypre_ParCSRMatPowers *mp );
+HYPRE_Int hypre_ParCSRMatPowersApply ( hypre_ParCSRMatPowers *mp, hypre_ParVector *x,
+                                       HYPRE_Int num_powers, hypre_ParVector **y );
+HYPRE_Int hypre_ParCSRMatPowersApplyPoly ( hypre_ParCSRMatPowers *mp, hypre_ParVector *x,
+                                           HYPRE_Int degree, HYPRE_Real *coefs, hypre_ParVector *y );
 
 /* par_csr_matvec.c */
 // y = alpha*A*x + beta*b
@@ -478,10 +493,40 @@ HYPRE_Int hypre_ParCSRMatrixMatvecTDevice ( HYPRE_Complex alpha, hypre_ParCSRMat
                                             hypre_ParVector *y );
 HYPRE_Int hypre_ParCSRMatrixMatvecT_unpack( hypre_ParCSRCommPkg *comm_pkg, HYPRE_Int num_cols,
                                             HYPRE_Complex *recv_data, HYPRE_Complex *local_data );
+// y = alpha*A*x + beta*b, with <y,y> and <y,z> in a single reduction
+HYPRE_Int hypre_ParCSRMatrixMatvecOutOfPlaceInnerProd ( HYPRE_Complex alpha, hypre_ParCSRMatrix *A,
+                                                        hypre_ParVector *x, HYPRE_Complex beta,
+                                                        hypre_ParVector *b, hypre_ParVector *y,
+                                                        hypre_ParVector *z, HYPRE_Real *yy,
+                                                        HYPRE_Real *yz );
+// r = b - A*x, with <r,r> and <r,z> in a single reduction
+HYPRE_Int hypre_ParCSRMatrixResidualInnerProd ( hypre_ParCSRMatrix *A, hypre_ParVector *x,
+                                               hypre_ParVector *b, hypre_ParVector *r,
+                                               hypre_ParVector *z, HYPRE_Real *rr,
+                                               HYPRE_Real *rz );
 HYPRE_Int hypre_ParCSRMatrixMatvec_FF ( HYPRE_Complex alpha, hypre_ParCSRMatrix *A,
                                         hypre_ParVector *x, HYPRE_Complex beta, hypre_ParVector *y,
                                         HYPRE_Int *CF_marker, HYPRE_Int fpt );
 
+/* par_csr_node_comm.c */
+HYPRE_Int hypre_ParCSRNodeCommPkgCreate ( hypre_ParCSRCommPkg *comm_pkg, HYPRE_Int group_size );
+HYPRE_Int hypre_ParCSRNodeCommPkgDestroy ( hypre_ParCSRNodeCommPkg *node_pkg );
+HYPRE_Int hypre_ParCSRNodeCommStart ( hypre_ParCSRNodeCommPkg *node_pkg,
+                                      hypre_ParCSRCommPkg *comm_pkg,
+                                      hypre_ParCSRCommHandle *comm_handle,
+                                      HYPRE_Complex *send_data, HYPRE_Complex *recv_data );
+HYPRE_Int hypre_ParCSRNodeCommFinish ( hypre_ParCSRNodeCommPkg *node_pkg );
+
+/* par_csr_shm_comm.c */
+HYPRE_Int hypre_ParCSRShmCommPkgCreate ( hypre_ParCSRCommPkg *comm_pkg );
+HYPRE_Int hypre_ParCSRShmCommPkgDestroy ( hypre_ParCSRShmCommPkg *shm_pkg );
+HYPRE_Complex *hypre_ParCSRShmCommSendBuffer ( hypre_ParCSRCommPkg *comm_pkg );
+HYPRE_Int hypre_ParCSRShmCommStart ( hypre_ParCSRShmCommPkg *shm_pkg,
+                                     hypre_ParCSRCommPkg *comm_pkg,
+                                     hypre_ParCSRCommHandle *comm_handle,
+                                     HYPRE_Complex *send_data, HYPRE_Complex *recv_data );
+HYPRE_Int hypre_ParCSRShmCommFinish ( hypre_ParCSRShmCommPkg *shm_pkg );
+
 /* par_csr_triplemat.c */
 HYPRE_Int hypre_ParCSRTMatMatPartialAddDevice( hypre_ParCSRCommPkg *comm_pkg_A,
                                                HYPRE_Int num_cols_A, HYPRE_Int num_cols_B, HYPRE_BigInt first_col_diag_B,
@@ -539,9 +584,14 @@ hypre_ParVector *hypre_ParVectorCloneDeep_v2( hypre_ParVector *x,
 HYPRE_Int hypre_ParVectorMigrate(hypre_ParVector *x, HYPRE_MemoryLocation memory_location);
 HYPRE_Int hypre_ParVectorScale ( HYPRE_Complex alpha, hypre_ParVector *y );
 HYPRE_Int hypre_ParVectorAxpy ( HYPRE_Complex alpha, hypre_ParVector *x, hypre_ParVector *y );
+HYPRE_Int hypre_ParVectorAxpby ( HYPRE_Complex alpha, hypre_ParVector *x, HYPRE_Complex beta,
+                                hypre_ParVector *y );
 HYPRE_Int hypre_ParVectorMassAxpy ( HYPRE_Complex *alpha, hypre_ParVector **x, hypre_ParVector *y,
                                     HYPRE_Int k, HYPRE_Int unroll);
 HYPRE_Real hypre_ParVectorInnerProd ( hypre_ParVector *x, hypre_ParVector *y );
+HYPRE_Int hypre_ParVectorUpdateSolutionResidual ( HYPRE_Complex alpha, hypre_ParVector *p,
+                                                 hypre_ParVector *s, hypre_ParVector *x,
+                                                 hypre_ParVector *r, HYPRE_Real *r_prod );
 HYPRE_Int hypre_ParVectorMassInnerProd ( hypre_ParVector *x, hypre_ParVector **y, HYPRE_Int k,
                                          HYPRE_Int unroll, HYPRE_Real *prod );
 HYPRE_Int hypre_ParVectorMassDotpTwo ( hypre_ParVector *x, hypre_ParVector *y, hypre_ParVector **z,
@@ -40,6 +40,8 @@ hypre_CSRMatrixCreate( HYPRE_Int num_rows,
    hypre_CSRMatrixNumCols(matrix)        = num_cols;
    hypre_CSRMatrixNumNonzeros(matrix)    = num_nonzeros;
    hypre_CSRMatrixMemoryLocation(matrix) = hypre_HandleMemoryLocation(hypre_handle());
+   hypre_CSRMatrixJDelta(matrix)         = NULL;
+   hypre_CSRMatrixJBase(matrix)          = NULL;
 
    /* set defaults */
    hypre_CSRMatrixOwnsData(matrix)       = 1;
@@ -76,6 +78,8 @@ hypre_CSRMatrixDestroy( hypre_CSRMatrix *matrix )
          hypre_TFree(hypre_CSRMatrixBigJ(matrix), memory_location);
       }
 
+      hypre_CSRMatrixUncompressIndices(matrix);
+
 #if defined(HYPRE_USING_CUSPARSE) || defined(HYPRE_USING_ROCSPARSE) || defined(HYPRE_USING_ONEMKLSPARSE)
       hypre_TFree(hypre_CSRMatrixSortedData(matrix), memory_location);
       hypre_TFree(hypre_CSRMatrixSortedJ(matrix), memory_location);
@@ -143,6 +147,7 @@ hypre_CSRMatrixInitialize_v2( hypre_CSRMatrix      *matrix,
    {
       if ( !hypre_CSRMatrixJ(matrix) && num_nonzeros )
       {
+         hypre_CSRMatrixUncompressIndices(matrix);
          hypre_CSRMatrixJ(matrix) = hypre_CTAlloc(HYPRE_Int, num_nonzeros, memory_location);
       }
    }
@@ -179,6 +184,7 @@ hypre_CSRMatrixResize( hypre_CSRMatrix *matrix, HYPRE_Int new_num_rows, HYPRE_In
       return 1;
    }
 
+   hypre_CSRMatrixUncompressIndices(matrix);
    hypre_CSRMatrixNumCols(matrix) = new_num_cols;
 
    if (new_num_nonzeros != hypre_CSRMatrixNumNonzeros(matrix))
@@ -252,6 +258,7 @@ hypre_CSRMatrixBigJtoJ( hypre_CSRMatrix *matrix )
 
    if (num_nonzeros && matrix_big_j)
    {
+      hypre_CSRMatrixUncompressIndices(matrix);
 #if defined(HYPRE_MIXEDINT) || defined(HYPRE_BIGINT)
       HYPRE_Int i;
       matrix_j = hypre_TAlloc(HYPRE_Int, num_nonzeros, hypre_CSRMatrixMemoryLocation(matrix));
@@ -285,6 +292,7 @@ hypre_CSRMatrixJtoBigJ( hypre_CSRMatrix *matrix )
 
    if (num_nonzeros && matrix_j)
    {
+      hypre_CSRMatrixUncompressIndices(matrix);
 #if defined(HYPRE_MIXEDINT) || defined(HYPRE_BIGINT)
       HYPRE_Int i;
       matrix_big_j = hypre_TAlloc(HYPRE_BigInt, num_nonzeros, hypre_CSRMatrixMemoryLocation(matrix));
@@ -407,6 +415,121 @@ hypre_CSRMatrixSetRownnz( hypre_CSRMatrix *matrix )
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixCompressIndices
+ *
+ * Builds 16-bit column indices that the host matvec, transpose matvec and
+ * hybrid Gauss-Seidel kernels read instead of j.  Entry k of row i is stored
+ * as j_delta[k] = j[k] - base(i), where base(i) = i when every row fits in
+ * [i - 32768, i + 32767] (no j_base array is needed), and base(i) = j_base[i]
+ * otherwise.  Matrices having a row that spans more than 65536 columns are
+ * left uncompressed.  The compressed indices are not updated when j changes.
+ * The routines that modify or replace j of an existing matrix (resizing,
+ * reordering, copying into it, converting between j and big_j, and the
+ * ParCSR routines that drop entries or assemble IJ matrices) free them with
+ * hypre_CSRMatrixUncompressIndices; code that writes to j directly must do
+ * the same.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRMatrixCompressIndices( hypre_CSRMatrix *matrix )
+{
+   HYPRE_MemoryLocation  memory_location = hypre_CSRMatrixMemoryLocation(matrix);
+   HYPRE_Int             num_rows        = hypre_CSRMatrixNumRows(matrix);
+   HYPRE_Int             num_nonzeros    = hypre_CSRMatrixNumNonzeros(matrix);
+   HYPRE_Int            *A_i             = hypre_CSRMatrixI(matrix);
+   HYPRE_Int            *A_j             = hypre_CSRMatrixJ(matrix);
+   hypre_short          *A_jdelta;
+   HYPRE_Int            *A_jbase         = NULL;
+   HYPRE_Int             min_offset      = 0;
+   HYPRE_Int             max_offset      = 0;
+   HYPRE_Int             max_span        = 0;
+   HYPRE_Int             i, jj, jmin, jmax;
+
+   hypre_CSRMatrixUncompressIndices(matrix);
+
+   if (hypre_GetExecPolicy1(memory_location) == HYPRE_EXEC_DEVICE ||
+       !A_i || !A_j || num_rows < 1 || num_nonzeros < 1)
+   {
+      return hypre_error_flag;
+   }
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(i, jj, jmin, jmax) reduction(min:min_offset) reduction(max:max_offset, max_span) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < num_rows; i++)
+   {
+      if (A_i[i] < A_i[i + 1])
+      {
+         jmin = jmax = A_j[A_i[i]];
+         for (jj = A_i[i] + 1; jj < A_i[i + 1]; jj++)
+         {
+            jmin = hypre_min(jmin, A_j[jj]);
+            jmax = hypre_max(jmax, A_j[jj]);
+         }
+         min_offset = hypre_min(min_offset, jmin - i);
+         max_offset = hypre_max(max_offset, jmax - i);
+         max_span   = hypre_max(max_span, jmax - jmin);
+      }
+   }
+
+   if (max_span > 65535)
+   {
+      return hypre_error_flag;
+   }
+
+   A_jdelta = hypre_TAlloc(hypre_short, num_nonzeros, memory_location);
+   if (min_offset < -32768 || max_offset > 32767)
+   {
+      A_jbase = hypre_TAlloc(HYPRE_Int, num_rows, memory_location);
+   }
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(i, jj, jmin) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < num_rows; i++)
+   {
+      jmin = i;
+      if (A_jbase)
+      {
+         /* center the row span on the 16-bit range */
+         jmin = (A_i[i] < A_i[i + 1]) ? A_j[A_i[i]] : 0;
+         for (jj = A_i[i] + 1; jj < A_i[i + 1]; jj++)
+         {
+            jmin = hypre_min(jmin, A_j[jj]);
+         }
+         jmin += 32768;
+         A_jbase[i] = jmin;
+      }
+      for (jj = A_i[i]; jj < A_i[i + 1]; jj++)
+      {
+         A_jdelta[jj] = (hypre_short) (A_j[jj] - jmin);
+      }
+   }
+
+   hypre_CSRMatrixJDelta(matrix)    = A_jdelta;
+   hypre_CSRMatrixJBase(matrix)     = A_jbase;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixUncompressIndices
+ *
+ * Frees the compressed column indices, if any.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRMatrixUncompressIndices( hypre_CSRMatrix *matrix )
+{
+   HYPRE_MemoryLocation memory_location = hypre_CSRMatrixMemoryLocation(matrix);
+
+   hypre_TFree(hypre_CSRMatrixJDelta(matrix), memory_location);
+   hypre_TFree(hypre_CSRMatrixJBase(matrix), memory_location);
+
+   return hypre_error_flag;
+}
+
 /* check if numnonzeros was properly set to be ia[nrow] */
 HYPRE_Int
 hypre_CSRMatrixCheckSetNumNonzeros( hypre_CSRMatrix *matrix )
@@ -750,6 +873,9 @@ hypre_CSRMatrixCopy( hypre_CSRMatrix *A, hypre_CSRMatrix *B, HYPRE_Int copy_data
    HYPRE_MemoryLocation memory_location_A = hypre_CSRMatrixMemoryLocation(A);
    HYPRE_MemoryLocation memory_location_B = hypre_CSRMatrixMemoryLocation(B);
 
+   /* the pattern of B is overwritten */
+   hypre_CSRMatrixUncompressIndices(B);
+
    hypre_TMemcpy(B_i, A_i, HYPRE_Int, num_rows + 1, memory_location_B, memory_location_A);
 
    if (A_rownnz)
@@ -13,6 +13,249 @@
 
 #include "seq_mv.h"
 
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixMatvecCompressedHost
+ *
+ * y = alpha*A*x + beta*b for a single vector, reading the 16-bit column
+ * indices built by hypre_CSRMatrixCompressIndices.  The row sums are the
+ * same as in the uncompressed loops below, but y is formed as
+ * beta*b + alpha*(A*x) for every alpha and beta, so results may differ from
+ * those loops in the last bits.
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_CSRMatrixMatvecCompressedHost( HYPRE_Complex    alpha,
+                                     hypre_CSRMatrix *A,
+                                     HYPRE_Complex   *x_data,
+                                     HYPRE_Complex    beta,
+                                     HYPRE_Complex   *b_data,
+                                     HYPRE_Complex   *y_data )
+{
+   HYPRE_Complex    *A_data   = hypre_CSRMatrixData(A);
+   HYPRE_Int        *A_i      = hypre_CSRMatrixI(A);
+   hypre_short      *A_jdelta = hypre_CSRMatrixJDelta(A);
+   HYPRE_Int        *A_jbase  = hypre_CSRMatrixJBase(A);
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel
+#endif
+   {
+      HYPRE_Int      iBegin = hypre_CSRMatrixGetLoadBalancedPartitionBegin(A);
+      HYPRE_Int      iEnd   = hypre_CSRMatrixGetLoadBalancedPartitionEnd(A);
+      HYPRE_Int      i, jj, base;
+      HYPRE_Complex  tempx;
+
+      for (i = iBegin; i < iEnd; i++)
+      {
+         base  = A_jbase ? A_jbase[i] : i;
+         tempx = 0.0;
+         for (jj = A_i[i]; jj < A_i[i + 1]; jj++)
+         {
+            tempx += A_data[jj] * x_data[base + A_jdelta[jj]];
+         }
+
+         if (beta == 0.0)
+         {
+            y_data[i] = alpha * tempx;
+         }
+         else
+         {
+            y_data[i] = beta * b_data[i] + alpha * tempx;
+         }
+      }
+   }
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixMatvecRowsHost
+ *
+ * y[i] = alpha*A[i,:]*x + beta*b[i] for iBegin <= i < iEnd, where
+ * temp = beta/alpha.
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_CSRMatrixMatvecRowsHost( HYPRE_Complex    alpha,
+                               HYPRE_Complex    beta,
+                               HYPRE_Complex    temp,
+                               HYPRE_Int       *A_i,
+                               HYPRE_Int       *A_j,
+                               HYPRE_Complex   *A_data,
+                               HYPRE_Complex   *x_data,
+                               HYPRE_Complex   *b_data,
+                               HYPRE_Complex   *y_data,
+                               HYPRE_Int        iBegin,
+                               HYPRE_Int        iEnd )
+{
+   HYPRE_Int      i, jj;
+   HYPRE_Complex  tempx;
+
+   if (temp == 0.0)
+   {
+      if (alpha == 1.0) // JSP: a common path
+      {
+         for (i = iBegin; i < iEnd; i++)
+         {
+            tempx = 0.0;
+            for (jj = A_i[i]; jj < A_i[i + 1]; jj++)
+            {
+               tempx += A_data[jj] * x_data[A_j[jj]];
+            }
+            y_data[i] = tempx;
+         }
+      } // y = A*x
+      else if (alpha == -1.0)
+      {
+         for (i = iBegin; i < iEnd; i++)
+         {
+            tempx = 0.0;
+            for (jj = A_i[i]; jj < A_i[i + 1]; jj++)
+            {
+               tempx -= A_data[jj] * x_data[A_j[jj]];
+            }
+            y_data[i] = tempx;
+         }
+      } // y = -A*x
+      else
+      {
+         for (i = iBegin; i < iEnd; i++)
+         {
+            tempx = 0.0;
+            for (jj = A_i[i]; jj < A_i[i + 1]; jj++)
+            {
+               tempx += A_data[jj] * x_data[A_j[jj]];
+            }
+            y_data[i] = alpha * tempx;
+         }
+      } // y = alpha*A*x
+   } // temp == 0
+   else if (temp == -1.0) // beta == -alpha
+   {
+      if (alpha == 1.0) // JSP: a common path
+      {
+         for (i = iBegin; i < iEnd; i++)
+         {
+            y_data[i] = -b_data[i];
+            tempx = 0.0;
+            for (jj = A_i[i]; jj < A_i[i + 1]; jj++)
+            {
+               tempx += A_data[jj] * x_data[A_j[jj]];
+            }
+            y_data[i] += tempx;
+         }
+      } // y = A*x - y
+      else if (alpha == -1.0) // JSP: a common path
+      {
+         for (i = iBegin; i < iEnd; i++)
+         {
+            y_data[i] = b_data[i];
+            tempx = 0.0;
+            for (jj = A_i[i]; jj < A_i[i + 1]; jj++)
+            {
+               tempx -= A_data[jj] * x_data[A_j[jj]];
+            }
+            y_data[i] += tempx;
+         }
+      } // y = -A*x + y
+      else
+      {
+         for (i = iBegin; i < iEnd; i++)
+         {
+            y_data[i] = -alpha * b_data[i];
+            tempx = 0.0;
+            for (jj = A_i[i]; jj < A_i[i + 1]; jj++)
+            {
+               tempx += A_data[jj] * x_data[A_j[jj]];
+            }
+            y_data[i] += alpha * tempx;
+         }
+      } // y = alpha*(A*x - y)
+   } // temp == -1
+   else if (temp == 1.0)
+   {
+      if (alpha == 1.0) // JSP: a common path
+      {
+         for (i = iBegin; i < iEnd; i++)
+         {
+            y_data[i] = b_data[i];
+            tempx = 0.0;
+            for (jj = A_i[i]; jj < A_i[i + 1]; jj++)
+            {
+               tempx += A_data[jj] * x_data[A_j[jj]];
+            }
+            y_data[i] += tempx;
+         }
+      } // y = A*x + y
+      else if (alpha == -1.0)
+      {
+         for (i = iBegin; i < iEnd; i++)
+         {
+            y_data[i] = -b_data[i];
+            tempx = 0.0;
+            for (jj = A_i[i]; jj < A_i[i + 1]; jj++)
+            {
+               tempx -= A_data[jj] * x_data[A_j[jj]];
+            }
+            y_data[i] += tempx;
+         }
+      } // y = -A*x - y
+      else
+      {
+         for (i = iBegin; i < iEnd; i++)
+         {
+            y_data[i] = alpha * b_data[i];
+            tempx = 0.0;
+            for (jj = A_i[i]; jj < A_i[i + 1]; jj++)
+            {
+               tempx += A_data[jj] * x_data[A_j[jj]];
+            }
+            y_data[i] += alpha * tempx;
+         }
+      } // y = alpha*(A*x + y)
+   }
+   else
+   {
+      if (alpha == 1.0) // JSP: a common path
+      {
+         for (i = iBegin; i < iEnd; i++)
+         {
+            y_data[i] = b_data[i] * temp;
+            tempx = 0.0;
+            for (jj = A_i[i]; jj < A_i[i + 1]; jj++)
+            {
+               tempx += A_data[jj] * x_data[A_j[jj]];
+            }
+            y_data[i] += tempx;
+         }
+      } // y = A*x + temp*y
+      else if (alpha == -1.0)
+      {
+         for (i = iBegin; i < iEnd; i++)
+         {
+            y_data[i] = -b_data[i] * temp;
+            tempx = 0.0;
+            for (jj = A_i[i]; jj < A_i[i + 1]; jj++)
+            {
+               tempx -= A_data[jj] * x_data[A_j[jj]];
+            }
+            y_data[i] += tempx;
+         }
+      } // y = -A*x - temp*y
+      else
+      {
+         for (i = iBegin; i < iEnd; i++)
+         {
+            y_data[i] = b_data[i] * beta;
+            tempx = 0.0;
+            for (jj = A_i[i]; jj < A_i[i + 1]; jj++)
+            {
+               tempx += A_data[jj] * x_data[A_j[jj]];
+            }
+            y_data[i] += alpha * tempx;
+         }
+      } // y = alpha*(A*x + temp*y)
+   } // temp != 0 && temp != -1 && temp != 1
+}
+
 /*--------------------------------------------------------------------------
  * hypre_CSRMatrixMatvec
  *--------------------------------------------------------------------------*/
@@ -52,6 +295,7 @@ hypre_CSRMatrixMatvecOutOfPlaceHost( HYPRE_Complex    alpha,
    HYPRE_Complex     temp, tempx;
    HYPRE_Int         i, j, jj, m, ierr = 0;
    HYPRE_Real        xpar = 0.7;
+   HYPRE_Int         progress = hypre_HandleCommProgress(hypre_handle());
    hypre_Vector     *x_tmp = NULL;
 
    /*---------------------------------------------------------------------
@@ -668,10 +912,14 @@ hypre_CSRMatrixMatvecOutOfPlaceHost( HYPRE_Complex    alpha,
          } // y = alpha*(A*x + temp*b)
       } // temp != 0 && temp != -1 && temp != 1
    }
+   else if (hypre_CSRMatrixJDelta(A) && offset == 0)
+   {
+      hypre_CSRMatrixMatvecCompressedHost(alpha, A, x_data, beta, b_data, y_data);
+   }
    else
    {
 #ifdef HYPRE_USING_OPENMP
-      #pragma omp parallel private(i,jj,tempx)
+      #pragma omp parallel private(i)
 #endif
       {
          HYPRE_Int iBegin = hypre_CSRMatrixGetLoadBalancedPartitionBegin(A);
@@ -680,171 +928,23 @@ hypre_CSRMatrixMatvecOutOfPlaceHost( HYPRE_Complex    alpha,
          hypre_assert(iBegin >= 0 && iBegin <= num_rows);
          hypre_assert(iEnd >= 0 && iEnd <= num_rows);
 
-         if (temp == 0.0)
-         {
-            if (alpha == 1.0) // JSP: a common path
-            {
-               for (i = iBegin; i < iEnd; i++)
-               {
-                  tempx = 0.0;
-                  for (jj = A_i[i]; jj < A_i[i + 1]; jj++)
-                  {
-                     tempx += A_data[jj] * x_data[A_j[jj]];
-                  }
-                  y_data[i] = tempx;
-               }
-            } // y = A*x
-            else if (alpha == -1.0)
-            {
-               for (i = iBegin; i < iEnd; i++)
-               {
-                  tempx = 0.0;
-                  for (jj = A_i[i]; jj < A_i[i + 1]; jj++)
-                  {
-                     tempx -= A_data[jj] * x_data[A_j[jj]];
-                  }
-                  y_data[i] = tempx;
-               }
-            } // y = -A*x
-            else
-            {
-               for (i = iBegin; i < iEnd; i++)
-               {
-                  tempx = 0.0;
-                  for (jj = A_i[i]; jj < A_i[i + 1]; jj++)
-                  {
-                     tempx += A_data[jj] * x_data[A_j[jj]];
-                  }
-                  y_data[i] = alpha * tempx;
-               }
-            } // y = alpha*A*x
-         } // temp == 0
-         else if (temp == -1.0) // beta == -alpha
+         if (progress > 0 && hypre_GetThreadNum() == 0)
          {
-            if (alpha == 1.0) // JSP: a common path
+            /* Let the master thread advance the pending halo exchanges
+               between blocks of rows (see HYPRE_SetCommProgress) */
+            for (i = iBegin; i < iEnd; i += progress)
             {
-               for (i = iBegin; i < iEnd; i++)
-               {
-                  y_data[i] = -b_data[i];
-                  tempx = 0.0;
-                  for (jj = A_i[i]; jj < A_i[i + 1]; jj++)
-                  {
-                     tempx += A_data[jj] * x_data[A_j[jj]];
-                  }
-                  y_data[i] += tempx;
-               }
-            } // y = A*x - y
-            else if (alpha == -1.0) // JSP: a common path
-            {
-               for (i = iBegin; i < iEnd; i++)
-               {
-                  y_data[i] = b_data[i];
-                  tempx = 0.0;
-                  for (jj = A_i[i]; jj < A_i[i + 1]; jj++)
-                  {
-                     tempx -= A_data[jj] * x_data[A_j[jj]];
-                  }
-                  y_data[i] += tempx;
-               }
-            } // y = -A*x + y
-            else
-            {
-               for (i = iBegin; i < iEnd; i++)
-               {
-                  y_data[i] = -alpha * b_data[i];
-                  tempx = 0.0;
-                  for (jj = A_i[i]; jj < A_i[i + 1]; jj++)
-                  {
-                     tempx += A_data[jj] * x_data[A_j[jj]];
-                  }
-                  y_data[i] += alpha * tempx;
-               }
-            } // y = alpha*(A*x - y)
-         } // temp == -1
-         else if (temp == 1.0)
-         {
-            if (alpha == 1.0) // JSP: a common path
-            {
-               for (i = iBegin; i < iEnd; i++)
-               {
-                  y_data[i] = b_data[i];
-                  tempx = 0.0;
-                  for (jj = A_i[i]; jj < A_i[i + 1]; jj++)
-                  {
-                     tempx += A_data[jj] * x_data[A_j[jj]];
-                  }
-                  y_data[i] += tempx;
-               }
-            } // y = A*x + y
-            else if (alpha == -1.0)
-            {
-               for (i = iBegin; i < iEnd; i++)
-               {
-                  y_data[i] = -b_data[i];
-                  tempx = 0.0;
-                  for (jj = A_i[i]; jj < A_i[i + 1]; jj++)
-                  {
-                     tempx -= A_data[jj] * x_data[A_j[jj]];
-                  }
-                  y_data[i] += tempx;
-               }
-            } // y = -A*x - y
-            else
-            {
-               for (i = iBegin; i < iEnd; i++)
-               {
-                  y_data[i] = alpha * b_data[i];
-                  tempx = 0.0;
-                  for (jj = A_i[i]; jj < A_i[i + 1]; jj++)
-                  {
-                     tempx += A_data[jj] * x_data[A_j[jj]];
-                  }
-                  y_data[i] += alpha * tempx;
-               }
-            } // y = alpha*(A*x + y)
+               hypre_CSRMatrixMatvecRowsHost(alpha, beta, temp, A_i, A_j, A_data,
+                                             x_data, b_data, y_data,
+                                             i, hypre_min(i + progress, iEnd));
+               hypre_CommProgress();
+            }
          }
          else
          {
-            if (alpha == 1.0) // JSP: a common path
-            {
-               for (i = iBegin; i < iEnd; i++)
-               {
-                  y_data[i] = b_data[i] * temp;
-                  tempx = 0.0;
-                  for (jj = A_i[i]; jj < A_i[i + 1]; jj++)
-                  {
-                     tempx += A_data[jj] * x_data[A_j[jj]];
-                  }
-                  y_data[i] += tempx;
-               }
-            } // y = A*x + temp*y
-            else if (alpha == -1.0)
-            {
-               for (i = iBegin; i < iEnd; i++)
-               {
-                  y_data[i] = -b_data[i] * temp;
-                  tempx = 0.0;
-                  for (jj = A_i[i]; jj < A_i[i + 1]; jj++)
-                  {
-                     tempx -= A_data[jj] * x_data[A_j[jj]];
-                  }
-                  y_data[i] += tempx;
-               }
-            } // y = -A*x - temp*y
-            else
-            {
-               for (i = iBegin; i < iEnd; i++)
-               {
-                  y_data[i] = b_data[i] * beta;
-                  tempx = 0.0;
-                  for (jj = A_i[i]; jj < A_i[i + 1]; jj++)
-                  {
-                     tempx += A_data[jj] * x_data[A_j[jj]];
-                  }
-                  y_data[i] += alpha * tempx;
-               }
-            } // y = alpha*(A*x + temp*y)
-         } // temp != 0 && temp != -1 && temp != 1
+            hypre_CSRMatrixMatvecRowsHost(alpha, beta, temp, A_i, A_j, A_data,
+                                          x_data, b_data, y_data, iBegin, iEnd);
+         }
       } // omp parallel
    }
 
@@ -920,6 +1020,8 @@ hypre_CSRMatrixMatvecTHost( HYPRE_Complex    alpha,
    HYPRE_Complex    *A_data    = hypre_CSRMatrixData(A);
    HYPRE_Int        *A_i       = hypre_CSRMatrixI(A);
    HYPRE_Int        *A_j       = hypre_CSRMatrixJ(A);
+   hypre_short      *A_jdelta  = hypre_CSRMatrixJDelta(A);
+   HYPRE_Int        *A_jbase   = hypre_CSRMatrixJBase(A);
    HYPRE_Int         num_rows  = hypre_CSRMatrixNumRows(A);
    HYPRE_Int         num_cols  = hypre_CSRMatrixNumCols(A);
 
@@ -1042,15 +1144,32 @@ hypre_CSRMatrixMatvecTHost( HYPRE_Complex    alpha,
          {
             my_thread_num = hypre_GetThreadNum();
             offset =  y_size * my_thread_num;
+            if (A_jdelta)
+            {
 #ifdef HYPRE_USING_OPENMP
-            #pragma omp for HYPRE_SMP_SCHEDULE
+               #pragma omp for HYPRE_SMP_SCHEDULE
 #endif
-            for (i = 0; i < num_rows; i++)
+               for (i = 0; i < num_rows; i++)
+               {
+                  j = offset + (A_jbase ? A_jbase[i] : i);
+                  for (jj = A_i[i]; jj < A_i[i + 1]; jj++)
+                  {
+                     y_data_expand[j + A_jdelta[jj]] += A_data[jj] * x_data[i];
+                  }
+               }
+            }
+            else
             {
-               for (jj = A_i[i]; jj < A_i[i + 1]; jj++)
+#ifdef HYPRE_USING_OPENMP
+               #pragma omp for HYPRE_SMP_SCHEDULE
+#endif
+               for (i = 0; i < num_rows; i++)
                {
-                  j = A_j[jj];
-                  y_data_expand[offset + j] += A_data[jj] * x_data[i];
+                  for (jj = A_i[i]; jj < A_i[i + 1]; jj++)
+                  {
+                     j = A_j[jj];
+                     y_data_expand[offset + j] += A_data[jj] * x_data[i];
+                  }
                }
             }
 
@@ -1089,6 +1208,17 @@ hypre_CSRMatrixMatvecTHost( HYPRE_Complex    alpha,
       hypre_TFree(y_data_expand, HYPRE_MEMORY_HOST);
 
    }
+   else if (num_vectors == 1 && A_jdelta)
+   {
+      for (i = 0; i < num_rows; i++)
+      {
+         j = A_jbase ? A_jbase[i] : i;
+         for (jj = A_i[i]; jj < A_i[i + 1]; jj++)
+         {
+            y_data[j + A_jdelta[jj]] += A_data[jj] * x_data[i];
+         }
+      }
+   }
    else
    {
       for (i = 0; i < num_rows; i++)
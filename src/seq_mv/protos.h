@@ -108,6 +108,8 @@ HYPRE_Int hypre_CSRMatrixJtoBigJ ( hypre_CSRMatrix *matrix );
 HYPRE_Int hypre_CSRMatrixSetDataOwner ( hypre_CSRMatrix *matrix, HYPRE_Int owns_data );
 HYPRE_Int hypre_CSRMatrixSetPatternOnly( hypre_CSRMatrix *matrix, HYPRE_Int pattern_only );
 HYPRE_Int hypre_CSRMatrixSetRownnz ( hypre_CSRMatrix *matrix );
+HYPRE_Int hypre_CSRMatrixCompressIndices ( hypre_CSRMatrix *matrix );
+HYPRE_Int hypre_CSRMatrixUncompressIndices ( hypre_CSRMatrix *matrix );
 hypre_CSRMatrix *hypre_CSRMatrixRead ( char *file_name );
 HYPRE_Int hypre_CSRMatrixPrint ( hypre_CSRMatrix *matrix, const char *file_name );
 HYPRE_Int hypre_CSRMatrixPrintHB ( hypre_CSRMatrix *matrix_input, char *file_name );
@@ -253,9 +255,19 @@ HYPRE_Int hypre_SeqVectorScaleDevice( HYPRE_Complex alpha, hypre_Vector *y );
 HYPRE_Int hypre_SeqVectorAxpy ( HYPRE_Complex alpha, hypre_Vector *x, hypre_Vector *y );
 HYPRE_Int hypre_SeqVectorAxpyHost ( HYPRE_Complex alpha, hypre_Vector *x, hypre_Vector *y );
 HYPRE_Int hypre_SeqVectorAxpyDevice ( HYPRE_Complex alpha, hypre_Vector *x, hypre_Vector *y );
+HYPRE_Int hypre_SeqVectorAxpby ( HYPRE_Complex alpha, hypre_Vector *x, HYPRE_Complex beta,
+                                hypre_Vector *y );
+HYPRE_Int hypre_SeqVectorAxpbyHost ( HYPRE_Complex alpha, hypre_Vector *x, HYPRE_Complex beta,
+                                    hypre_Vector *y );
 HYPRE_Real hypre_SeqVectorInnerProd ( hypre_Vector *x, hypre_Vector *y );
 HYPRE_Real hypre_SeqVectorInnerProdHost ( hypre_Vector *x, hypre_Vector *y );
 HYPRE_Real hypre_SeqVectorInnerProdDevice ( hypre_Vector *x, hypre_Vector *y );
+HYPRE_Int hypre_SeqVectorUpdateSolutionResidual ( HYPRE_Complex alpha, hypre_Vector *p,
+                                                 hypre_Vector *s, hypre_Vector *x, hypre_Vector *r,
+                                                 HYPRE_Real *r_prod );
+HYPRE_Int hypre_SeqVectorUpdateSolutionResidualHost ( HYPRE_Complex alpha, hypre_Vector *p,
+                                                     hypre_Vector *s, hypre_Vector *x, hypre_Vector *r,
+                                                     HYPRE_Real *r_prod );
 HYPRE_Int hypre_SeqVectorMassInnerProd(hypre_Vector *x, hypre_Vector **y, HYPRE_Int k,
                                        HYPRE_Int unroll, HYPRE_Real *result);
 HYPRE_Int hypre_SeqVectorMassInnerProd4(hypre_Vector *x, hypre_Vector **y, HYPRE_Int k,
@@ -601,6 +601,71 @@ hypre_SeqVectorAxpy( HYPRE_Complex alpha,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_SeqVectorAxpbyHost
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SeqVectorAxpbyHost( HYPRE_Complex alpha,
+                          hypre_Vector *x,
+                          HYPRE_Complex beta,
+                          hypre_Vector *y )
+{
+   HYPRE_Complex *x_data      = hypre_VectorData(x);
+   HYPRE_Complex *y_data      = hypre_VectorData(y);
+   HYPRE_Int      num_vectors = hypre_VectorNumVectors(x);
+   HYPRE_Int      size        = hypre_VectorSize(x);
+   HYPRE_Int      total_size  = size * num_vectors;
+   HYPRE_Int      i;
+
+#if defined(HYPRE_USING_OPENMP)
+   #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < total_size; i++)
+   {
+      y_data[i] = alpha * x_data[i] + beta * y_data[i];
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_SeqVectorAxpby
+ *
+ * y = alpha*x + beta*y in a single pass over y.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SeqVectorAxpby( HYPRE_Complex alpha,
+                      hypre_Vector *x,
+                      HYPRE_Complex beta,
+                      hypre_Vector *y )
+{
+#if defined(HYPRE_USING_GPU)
+   HYPRE_ExecutionPolicy exec = hypre_GetExecPolicy2( hypre_VectorMemoryLocation(x),
+                                                      hypre_VectorMemoryLocation(y) );
+   if (exec == HYPRE_EXEC_DEVICE)
+   {
+      hypre_SeqVectorScale(beta, y);
+      hypre_SeqVectorAxpy(alpha, x, y);
+
+      return hypre_error_flag;
+   }
+#endif
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_BLAS1] -= hypre_MPI_Wtime();
+#endif
+
+   hypre_SeqVectorAxpbyHost(alpha, x, beta, y);
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_BLAS1] += hypre_MPI_Wtime();
+#endif
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_SeqVectorElmdivpyHost
  *
@@ -871,6 +936,103 @@ hypre_SeqVectorInnerProd( hypre_Vector *x,
    return result;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_SeqVectorUpdateSolutionResidualHost
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SeqVectorUpdateSolutionResidualHost( HYPRE_Complex  alpha,
+                                           hypre_Vector  *p,
+                                           hypre_Vector  *s,
+                                           hypre_Vector  *x,
+                                           hypre_Vector  *r,
+                                           HYPRE_Real    *r_prod )
+{
+   HYPRE_Complex *p_data      = hypre_VectorData(p);
+   HYPRE_Complex *s_data      = hypre_VectorData(s);
+   HYPRE_Complex *x_data      = hypre_VectorData(x);
+   HYPRE_Complex *r_data      = hypre_VectorData(r);
+   HYPRE_Int      num_vectors = hypre_VectorNumVectors(r);
+   HYPRE_Int      size        = hypre_VectorSize(r);
+   HYPRE_Int      total_size  = size * num_vectors;
+   HYPRE_Complex  neg_alpha   = -alpha;
+
+   HYPRE_Real     result      = 0.0;
+   HYPRE_Int      i;
+
+   if (r_prod)
+   {
+#if defined(HYPRE_USING_OPENMP)
+      #pragma omp parallel for private(i) reduction(+:result) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < total_size; i++)
+      {
+         x_data[i] += alpha * p_data[i];
+         r_data[i] += neg_alpha * s_data[i];
+         result += hypre_conj(r_data[i]) * r_data[i];
+      }
+
+      *r_prod = result;
+   }
+   else
+   {
+#if defined(HYPRE_USING_OPENMP)
+      #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < total_size; i++)
+      {
+         x_data[i] += alpha * p_data[i];
+         r_data[i] += neg_alpha * s_data[i];
+      }
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_SeqVectorUpdateSolutionResidual
+ *
+ * Fused Krylov update x = x + alpha*p, r = r - alpha*s.  If r_prod is not
+ * NULL, it returns the local part of <r,r>, computed in the same pass.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SeqVectorUpdateSolutionResidual( HYPRE_Complex  alpha,
+                                       hypre_Vector  *p,
+                                       hypre_Vector  *s,
+                                       hypre_Vector  *x,
+                                       hypre_Vector  *r,
+                                       HYPRE_Real    *r_prod )
+{
+#if defined(HYPRE_USING_GPU)
+   HYPRE_ExecutionPolicy exec = hypre_GetExecPolicy2( hypre_VectorMemoryLocation(x),
+                                                      hypre_VectorMemoryLocation(r) );
+   if (exec == HYPRE_EXEC_DEVICE)
+   {
+      hypre_SeqVectorAxpy(alpha, p, x);
+      hypre_SeqVectorAxpy(-alpha, s, r);
+      if (r_prod)
+      {
+         *r_prod = hypre_SeqVectorInnerProd(r, r);
+      }
+
+      return hypre_error_flag;
+   }
+#endif
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_BLAS1] -= hypre_MPI_Wtime();
+#endif
+
+   hypre_SeqVectorUpdateSolutionResidualHost(alpha, p, s, x, r, r_prod);
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_BLAS1] += hypre_MPI_Wtime();
+#endif
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_SeqVectorSumEltsHost
  *--------------------------------------------------------------------------*/
@@ -25,6 +25,9 @@ HYPRE_SStructBiCGSTABCreate( MPI_Comm             comm,
          hypre_SStructKrylovCommInfo,
          hypre_SStructKrylovIdentitySetup, hypre_SStructKrylovIdentity );
 
+   hypre_BiCGSTABFunctionsSetVectorUpdates(bicgstab_functions,
+                                           hypre_SStructKrylovUpdateSolutionResidual,
+                                           hypre_SStructKrylovAxpby);
    *solver = ( (HYPRE_SStructSolver) hypre_BiCGSTABCreate( bicgstab_functions ) );
 
    return hypre_error_flag;
@@ -25,6 +25,9 @@ HYPRE_SStructPCGCreate( MPI_Comm             comm,
          hypre_SStructKrylovScaleVector, hypre_SStructKrylovAxpy,
          hypre_SStructKrylovIdentitySetup, hypre_SStructKrylovIdentity );
 
+   hypre_PCGFunctionsSetVectorUpdates(pcg_functions,
+                                      hypre_SStructKrylovUpdateSolutionResidual,
+                                      hypre_SStructKrylovAxpby);
    *solver = ( (HYPRE_SStructSolver) hypre_PCGCreate( pcg_functions ) );
 
    return hypre_error_flag;
@@ -597,6 +597,9 @@ HYPRE_Int hypre_SStructKrylovCopyVector ( void *x, void *y );
 HYPRE_Int hypre_SStructKrylovClearVector ( void *x );
 HYPRE_Int hypre_SStructKrylovScaleVector ( HYPRE_Complex alpha, void *x );
 HYPRE_Int hypre_SStructKrylovAxpy ( HYPRE_Complex alpha, void *x, void *y );
+HYPRE_Int hypre_SStructKrylovAxpby ( HYPRE_Complex alpha, void *x, HYPRE_Complex beta, void *y );
+HYPRE_Int hypre_SStructKrylovUpdateSolutionResidual ( HYPRE_Complex alpha, void *p, void *s,
+                                                     void *x, void *r, HYPRE_Real *r_prod );
 HYPRE_Int hypre_SStructKrylovCommInfo ( void *A, HYPRE_Int *my_id, HYPRE_Int *num_procs );
 
 /* maxwell_grad.c */
@@ -259,6 +259,38 @@ hypre_SStructKrylovAxpy( HYPRE_Complex alpha,
                                (hypre_SStructVector *) y ) );
 }
 
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SStructKrylovAxpby( HYPRE_Complex alpha,
+                          void         *x,
+                          HYPRE_Complex beta,
+                          void         *y )
+{
+   return ( hypre_SStructAxpby( alpha, (hypre_SStructVector *) x,
+                                beta, (hypre_SStructVector *) y ) );
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SStructKrylovUpdateSolutionResidual( HYPRE_Complex  alpha,
+                                           void          *p,
+                                           void          *s,
+                                           void          *x,
+                                           void          *r,
+                                           HYPRE_Real    *r_prod )
+{
+   return ( hypre_SStructUpdateSolutionResidual( alpha,
+                                                 (hypre_SStructVector *) p,
+                                                 (hypre_SStructVector *) s,
+                                                 (hypre_SStructVector *) x,
+                                                 (hypre_SStructVector *) r,
+                                                 r_prod ) );
+}
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
@@ -62,6 +62,8 @@ HYPRE_SStructVectorCreate( MPI_Comm              comm,
    hypre_SStructVectorGlobalSize(vector) = 0;
    hypre_SStructVectorRefCount(vector)   = 1;
    hypre_SStructVectorDataSize(vector)   = 0;
+   hypre_SStructVectorFlatNRuns(vector)  = 0;
+   hypre_SStructVectorFlatRuns(vector)   = NULL;
    hypre_SStructVectorObjectType(vector) = HYPRE_SSTRUCT;
 
    *vector_ptr = vector;
@@ -106,6 +108,7 @@ HYPRE_SStructVectorDestroy( HYPRE_SStructVector vector )
 
          /* GEC if data has been allocated then free the pointer */
          hypre_TFree(hypre_SStructVectorDataIndices(vector), HYPRE_MEMORY_HOST);
+         hypre_TFree(hypre_SStructVectorFlatRuns(vector), HYPRE_MEMORY_HOST);
 
          if (hypre_SStructVectorData(vector) && (vector_type == HYPRE_PARCSR))
          {
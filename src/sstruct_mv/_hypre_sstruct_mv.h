@@ -735,6 +735,10 @@ typedef struct hypre_SStructVector_struct
                                            of vector data for the part=partx */
    HYPRE_Int               datasize;    /* GEC1002 size of all data = ghlocalsize */
 
+   /* flat iteration plan: contiguous runs of non-ghost entries in data */
+   HYPRE_Int               flat_nruns;
+   HYPRE_Int              *flat_runs;   /* (start, length) pairs, sorted by start */
+
    HYPRE_Int               global_size;  /* Total number coefficients */
    HYPRE_Int               ref_count;
 
@@ -759,6 +763,8 @@ typedef struct hypre_SStructVector_struct
 #define hypre_SStructVectorData(vec)           ((vec) -> data )
 #define hypre_SStructVectorDataIndices(vec)    ((vec) -> dataindices)
 #define hypre_SStructVectorDataSize(vec)       ((vec) -> datasize)
+#define hypre_SStructVectorFlatNRuns(vec)      ((vec) -> flat_nruns)
+#define hypre_SStructVectorFlatRuns(vec)       ((vec) -> flat_runs)
 
 
 /*--------------------------------------------------------------------------
@@ -917,6 +923,10 @@ HYPRE_Int HYPRE_SStructAxpy ( HYPRE_Complex alpha, HYPRE_SStructVector x, HYPRE_
 HYPRE_Int hypre_SStructPAxpy ( HYPRE_Complex alpha, hypre_SStructPVector *px,
                                hypre_SStructPVector *py );
 HYPRE_Int hypre_SStructAxpy ( HYPRE_Complex alpha, hypre_SStructVector *x, hypre_SStructVector *y );
+HYPRE_Int hypre_SStructPAxpby ( HYPRE_Complex alpha, hypre_SStructPVector *px, HYPRE_Complex beta,
+                               hypre_SStructPVector *py );
+HYPRE_Int hypre_SStructAxpby ( HYPRE_Complex alpha, hypre_SStructVector *x, HYPRE_Complex beta,
+                               hypre_SStructVector *y );
 
 /* sstruct_copy.c */
 HYPRE_Int hypre_SStructPCopy ( hypre_SStructPVector *px, hypre_SStructPVector *py );
@@ -999,8 +1009,15 @@ HYPRE_Int hypre_SStructGridRead ( MPI_Comm comm, FILE *file, hypre_SStructGrid *
 /* sstruct_innerprod.c */
 HYPRE_Int hypre_SStructPInnerProd ( hypre_SStructPVector *px, hypre_SStructPVector *py,
                                     HYPRE_Real *presult_ptr );
+HYPRE_Real hypre_SStructFlatInnerProdLocal ( hypre_SStructVector *x, hypre_SStructVector *y );
 HYPRE_Int hypre_SStructInnerProd ( hypre_SStructVector *x, hypre_SStructVector *y,
                                    HYPRE_Real *result_ptr );
+HYPRE_Int hypre_SStructAxpyInnerProd ( HYPRE_Complex alpha, hypre_SStructVector *x,
+                                       hypre_SStructVector *y, hypre_SStructVector *z,
+                                       HYPRE_Real *result_ptr );
+HYPRE_Int hypre_SStructUpdateSolutionResidual ( HYPRE_Complex alpha, hypre_SStructVector *p,
+                                               hypre_SStructVector *s, hypre_SStructVector *x,
+                                               hypre_SStructVector *r, HYPRE_Real *r_prod );
 
 /* sstruct_matrix.c */
 HYPRE_Int hypre_SStructPMatrixRef ( hypre_SStructPMatrix *matrix,
@@ -1103,6 +1120,8 @@ HYPRE_Int hypre_SStructPVectorInitializeShell ( hypre_SStructPVector *pvector );
 HYPRE_Int hypre_SStructVectorInitializeShell ( hypre_SStructVector *vector );
 HYPRE_Int hypre_SStructVectorClearGhostValues ( hypre_SStructVector *vector );
 HYPRE_MemoryLocation hypre_SStructVectorMemoryLocation(hypre_SStructVector *vector);
+HYPRE_Int hypre_SStructVectorSetupFlatPlan ( hypre_SStructVector *vector );
+HYPRE_Int hypre_SStructVectorFlatCompatible ( hypre_SStructVector *x, hypre_SStructVector *y );
 
 
 #ifdef __cplusplus
@@ -137,6 +137,10 @@ HYPRE_Int HYPRE_SStructAxpy ( HYPRE_Complex alpha, HYPRE_SStructVector x, HYPRE_
 HYPRE_Int hypre_SStructPAxpy ( HYPRE_Complex alpha, hypre_SStructPVector *px,
                                hypre_SStructPVector *py );
 HYPRE_Int hypre_SStructAxpy ( HYPRE_Complex alpha, hypre_SStructVector *x, hypre_SStructVector *y );
+HYPRE_Int hypre_SStructPAxpby ( HYPRE_Complex alpha, hypre_SStructPVector *px, HYPRE_Complex beta,
+                               hypre_SStructPVector *py );
+HYPRE_Int hypre_SStructAxpby ( HYPRE_Complex alpha, hypre_SStructVector *x, HYPRE_Complex beta,
+                               hypre_SStructVector *y );
 
 /* sstruct_copy.c */
 HYPRE_Int hypre_SStructPCopy ( hypre_SStructPVector *px, hypre_SStructPVector *py );
@@ -219,8 +223,15 @@ HYPRE_Int hypre_SStructGridRead ( MPI_Comm comm, FILE *file, hypre_SStructGrid *
 /* sstruct_innerprod.c */
 HYPRE_Int hypre_SStructPInnerProd ( hypre_SStructPVector *px, hypre_SStructPVector *py,
                                     HYPRE_Real *presult_ptr );
+HYPRE_Real hypre_SStructFlatInnerProdLocal ( hypre_SStructVector *x, hypre_SStructVector *y );
 HYPRE_Int hypre_SStructInnerProd ( hypre_SStructVector *x, hypre_SStructVector *y,
                                    HYPRE_Real *result_ptr );
+HYPRE_Int hypre_SStructAxpyInnerProd ( HYPRE_Complex alpha, hypre_SStructVector *x,
+                                       hypre_SStructVector *y, hypre_SStructVector *z,
+                                       HYPRE_Real *result_ptr );
+HYPRE_Int hypre_SStructUpdateSolutionResidual ( HYPRE_Complex alpha, hypre_SStructVector *p,
+                                               hypre_SStructVector *s, hypre_SStructVector *x,
+                                               hypre_SStructVector *r, HYPRE_Real *r_prod );
 
 /* sstruct_matrix.c */
 HYPRE_Int hypre_SStructPMatrixRef ( hypre_SStructPMatrix *matrix,
@@ -323,4 +334,6 @@ HYPRE_Int hypre_SStructPVectorInitializeShell ( hypre_SStructPVector *pvector );
 HYPRE_Int hypre_SStructVectorInitializeShell ( hypre_SStructVector *vector );
 HYPRE_Int hypre_SStructVectorClearGhostValues ( hypre_SStructVector *vector );
 HYPRE_MemoryLocation hypre_SStructVectorMemoryLocation(hypre_SStructVector *vector);
+HYPRE_Int hypre_SStructVectorSetupFlatPlan ( hypre_SStructVector *vector );
+HYPRE_Int hypre_SStructVectorFlatCompatible ( hypre_SStructVector *x, hypre_SStructVector *y );
 
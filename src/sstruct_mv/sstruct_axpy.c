@@ -57,7 +57,27 @@ hypre_SStructAxpy( HYPRE_Complex        alpha,
       return hypre_error_flag;
    }
 
-   if (x_object_type == HYPRE_SSTRUCT)
+   if (x_object_type == HYPRE_SSTRUCT && hypre_SStructVectorFlatCompatible(x, y))
+   {
+      HYPRE_Int      nruns = hypre_SStructVectorFlatNRuns(x);
+      HYPRE_Int     *runs  = hypre_SStructVectorFlatRuns(x);
+      HYPRE_Complex *xp    = hypre_SStructVectorData(x);
+      HYPRE_Complex *yp    = hypre_SStructVectorData(y);
+      HYPRE_Int      r, i;
+
+#if defined(HYPRE_USING_OPENMP)
+      #pragma omp parallel for private(r, i) HYPRE_SMP_SCHEDULE
+#endif
+      for (r = 0; r < nruns; r++)
+      {
+         for (i = runs[2 * r]; i < runs[2 * r] + runs[2 * r + 1]; i++)
+         {
+            yp[i] += alpha * xp[i];
+         }
+      }
+   }
+
+   else if (x_object_type == HYPRE_SSTRUCT)
    {
       for (part = 0; part < nparts; part++)
       {
@@ -80,3 +100,97 @@ hypre_SStructAxpy( HYPRE_Complex        alpha,
 
    return hypre_error_flag;
 }
+
+/*--------------------------------------------------------------------------
+ * hypre_SStructPAxpby
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SStructPAxpby( HYPRE_Complex         alpha,
+                     hypre_SStructPVector *px,
+                     HYPRE_Complex         beta,
+                     hypre_SStructPVector *py )
+{
+   HYPRE_Int nvars = hypre_SStructPVectorNVars(px);
+   HYPRE_Int var;
+
+   for (var = 0; var < nvars; var++)
+   {
+      hypre_StructAxpby(alpha,
+                        hypre_SStructPVectorSVector(px, var),
+                        beta,
+                        hypre_SStructPVectorSVector(py, var));
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_SStructAxpby
+ *
+ * y = alpha*x + beta*y
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SStructAxpby( HYPRE_Complex        alpha,
+                    hypre_SStructVector *x,
+                    HYPRE_Complex        beta,
+                    hypre_SStructVector *y )
+{
+   HYPRE_Int nparts = hypre_SStructVectorNParts(x);
+   HYPRE_Int part;
+
+   HYPRE_Int    x_object_type = hypre_SStructVectorObjectType(x);
+   HYPRE_Int    y_object_type = hypre_SStructVectorObjectType(y);
+
+   if (x_object_type != y_object_type)
+   {
+      hypre_error_in_arg(2);
+      hypre_error_in_arg(4);
+      return hypre_error_flag;
+   }
+
+   if (x_object_type == HYPRE_SSTRUCT && hypre_SStructVectorFlatCompatible(x, y))
+   {
+      HYPRE_Int      nruns = hypre_SStructVectorFlatNRuns(x);
+      HYPRE_Int     *runs  = hypre_SStructVectorFlatRuns(x);
+      HYPRE_Complex *xp    = hypre_SStructVectorData(x);
+      HYPRE_Complex *yp    = hypre_SStructVectorData(y);
+      HYPRE_Int      r, i;
+
+#if defined(HYPRE_USING_OPENMP)
+      #pragma omp parallel for private(r, i) HYPRE_SMP_SCHEDULE
+#endif
+      for (r = 0; r < nruns; r++)
+      {
+         for (i = runs[2 * r]; i < runs[2 * r] + runs[2 * r + 1]; i++)
+         {
+            yp[i] = alpha * xp[i] + beta * yp[i];
+         }
+      }
+   }
+
+   else if (x_object_type == HYPRE_SSTRUCT)
+   {
+      for (part = 0; part < nparts; part++)
+      {
+         hypre_SStructPAxpby(alpha,
+                             hypre_SStructVectorPVector(x, part),
+                             beta,
+                             hypre_SStructVectorPVector(y, part));
+      }
+   }
+
+   else if (x_object_type == HYPRE_PARCSR)
+   {
+      hypre_ParVector  *x_par;
+      hypre_ParVector  *y_par;
+
+      hypre_SStructVectorConvert(x, &x_par);
+      hypre_SStructVectorConvert(y, &y_par);
+
+      hypre_ParVectorAxpby(alpha, x_par, beta, y_par);
+   }
+
+   return hypre_error_flag;
+}
@@ -80,7 +80,27 @@ hypre_SStructCopy( hypre_SStructVector *x,
    }
 
 
-   if (x_object_type == HYPRE_SSTRUCT)
+   if (x_object_type == HYPRE_SSTRUCT && hypre_SStructVectorFlatCompatible(x, y))
+   {
+      HYPRE_Int      nruns = hypre_SStructVectorFlatNRuns(x);
+      HYPRE_Int     *runs  = hypre_SStructVectorFlatRuns(x);
+      HYPRE_Complex *xp    = hypre_SStructVectorData(x);
+      HYPRE_Complex *yp    = hypre_SStructVectorData(y);
+      HYPRE_Int      r, i;
+
+#if defined(HYPRE_USING_OPENMP)
+      #pragma omp parallel for private(r, i) HYPRE_SMP_SCHEDULE
+#endif
+      for (r = 0; r < nruns; r++)
+      {
+         for (i = runs[2 * r]; i < runs[2 * r] + runs[2 * r + 1]; i++)
+         {
+            yp[i] = xp[i];
+         }
+      }
+   }
+
+   else if (x_object_type == HYPRE_SSTRUCT)
    {
       for (part = 0; part < nparts; part++)
       {
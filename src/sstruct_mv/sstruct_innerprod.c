@@ -40,6 +40,37 @@ hypre_SStructPInnerProd( hypre_SStructPVector *px,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_SStructFlatInnerProdLocal
+ *
+ * Local inner product of two vectors with compatible flat plans.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Real
+hypre_SStructFlatInnerProdLocal( hypre_SStructVector *x,
+                                 hypre_SStructVector *y )
+{
+   HYPRE_Int      nruns  = hypre_SStructVectorFlatNRuns(x);
+   HYPRE_Int     *runs   = hypre_SStructVectorFlatRuns(x);
+   HYPRE_Complex *xp     = hypre_SStructVectorData(x);
+   HYPRE_Complex *yp     = hypre_SStructVectorData(y);
+   HYPRE_Real     result = 0.0;
+   HYPRE_Int      r, i;
+
+#if defined(HYPRE_USING_OPENMP)
+   #pragma omp parallel for private(r, i) reduction(+:result) HYPRE_SMP_SCHEDULE
+#endif
+   for (r = 0; r < nruns; r++)
+   {
+      for (i = runs[2 * r]; i < runs[2 * r] + runs[2 * r + 1]; i++)
+      {
+         result += xp[i] * hypre_conj(yp[i]);
+      }
+   }
+
+   return result;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_SStructInnerProd
  *--------------------------------------------------------------------------*/
@@ -50,9 +81,11 @@ hypre_SStructInnerProd( hypre_SStructVector *x,
                         HYPRE_Real          *result_ptr )
 {
    HYPRE_Int    nparts = hypre_SStructVectorNParts(x);
-   HYPRE_Real   result;
-   HYPRE_Real   presult;
-   HYPRE_Int    part;
+   HYPRE_Real            result;
+   HYPRE_Real            presult;
+   hypre_SStructPVector *pvector_x;
+   hypre_SStructPVector *pvector_y;
+   HYPRE_Int             part, nvars, var;
 
    HYPRE_Int    x_object_type = hypre_SStructVectorObjectType(x);
    HYPRE_Int    y_object_type = hypre_SStructVectorObjectType(y);
@@ -68,12 +101,29 @@ hypre_SStructInnerProd( hypre_SStructVector *x,
 
    if ( (x_object_type == HYPRE_SSTRUCT) || (x_object_type == HYPRE_STRUCT) )
    {
-      for (part = 0; part < nparts; part++)
+      /* accumulate the local sums of all parts and variables, then reduce once */
+      if (hypre_SStructVectorFlatCompatible(x, y))
       {
-         hypre_SStructPInnerProd(hypre_SStructVectorPVector(x, part),
-                                 hypre_SStructVectorPVector(y, part), &presult);
-         result += presult;
+         presult = hypre_SStructFlatInnerProdLocal(x, y);
       }
+      else
+      {
+         presult = 0.0;
+         for (part = 0; part < nparts; part++)
+         {
+            pvector_x = hypre_SStructVectorPVector(x, part);
+            pvector_y = hypre_SStructVectorPVector(y, part);
+            nvars     = hypre_SStructPVectorNVars(pvector_x);
+            for (var = 0; var < nvars; var++)
+            {
+               presult += hypre_StructInnerProdLocal(hypre_SStructPVectorSVector(pvector_x, var),
+                                                     hypre_SStructPVectorSVector(pvector_y, var));
+            }
+         }
+      }
+
+      hypre_MPI_Allreduce(&presult, &result, 1, HYPRE_MPI_REAL, hypre_MPI_SUM,
+                          hypre_SStructVectorComm(x));
    }
 
    else if (x_object_type == HYPRE_PARCSR)
@@ -91,3 +141,178 @@ hypre_SStructInnerProd( hypre_SStructVector *x,
 
    return hypre_error_flag;
 }
+
+/*--------------------------------------------------------------------------
+ * hypre_SStructAxpyInnerProd
+ *
+ * Fused y = y + alpha*x and result = <y, z> (z may be y).  For vectors with
+ * compatible flat plans this is a single pass over memory with a single
+ * global reduction; otherwise it falls back to hypre_SStructAxpy followed
+ * by hypre_SStructInnerProd.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SStructAxpyInnerProd( HYPRE_Complex        alpha,
+                            hypre_SStructVector *x,
+                            hypre_SStructVector *y,
+                            hypre_SStructVector *z,
+                            HYPRE_Real          *result_ptr )
+{
+   HYPRE_Int      x_object_type = hypre_SStructVectorObjectType(x);
+   HYPRE_Int      y_object_type = hypre_SStructVectorObjectType(y);
+   HYPRE_Int      z_object_type = hypre_SStructVectorObjectType(z);
+
+   HYPRE_Int      nruns;
+   HYPRE_Int     *runs;
+   HYPRE_Complex *xp, *yp, *zp;
+   HYPRE_Real     presult = 0.0;
+   HYPRE_Int      r, i;
+
+   if (x_object_type != y_object_type || x_object_type != z_object_type)
+   {
+      hypre_error_in_arg(2);
+      hypre_error_in_arg(3);
+      hypre_error_in_arg(4);
+      return hypre_error_flag;
+   }
+
+   if (x_object_type != HYPRE_SSTRUCT ||
+       !hypre_SStructVectorFlatCompatible(x, y) ||
+       !hypre_SStructVectorFlatCompatible(y, z))
+   {
+      hypre_SStructAxpy(alpha, x, y);
+      hypre_SStructInnerProd(y, z, result_ptr);
+
+      return hypre_error_flag;
+   }
+
+   nruns = hypre_SStructVectorFlatNRuns(y);
+   runs  = hypre_SStructVectorFlatRuns(y);
+   xp    = hypre_SStructVectorData(x);
+   yp    = hypre_SStructVectorData(y);
+   zp    = hypre_SStructVectorData(z);
+
+#if defined(HYPRE_USING_OPENMP)
+   #pragma omp parallel for private(r, i) reduction(+:presult) HYPRE_SMP_SCHEDULE
+#endif
+   for (r = 0; r < nruns; r++)
+   {
+      for (i = runs[2 * r]; i < runs[2 * r] + runs[2 * r + 1]; i++)
+      {
+         yp[i] += alpha * xp[i];
+         presult += yp[i] * hypre_conj(zp[i]);
+      }
+   }
+
+   hypre_MPI_Allreduce(&presult, result_ptr, 1, HYPRE_MPI_REAL, hypre_MPI_SUM,
+                       hypre_SStructVectorComm(x));
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_SStructUpdateSolutionResidual
+ *
+ * Fused Krylov update x = x + alpha*p, r = r - alpha*s.  If r_prod is not
+ * NULL, <r,r> is accumulated in the same pass and returned in r_prod.
+ * Vectors without compatible flat plans fall back to hypre_SStructAxpy
+ * and hypre_SStructInnerProd.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SStructUpdateSolutionResidual( HYPRE_Complex        alpha,
+                                     hypre_SStructVector *p,
+                                     hypre_SStructVector *s,
+                                     hypre_SStructVector *x,
+                                     hypre_SStructVector *r,
+                                     HYPRE_Real          *r_prod )
+{
+   HYPRE_Int      object_type = hypre_SStructVectorObjectType(r);
+
+   HYPRE_Int      nruns;
+   HYPRE_Int     *runs;
+   HYPRE_Complex *pp, *sp, *xp, *rp;
+   HYPRE_Complex  neg_alpha = -alpha;
+   HYPRE_Real     presult   = 0.0;
+   HYPRE_Int      k, i;
+
+   if (hypre_SStructVectorObjectType(p) != object_type ||
+       hypre_SStructVectorObjectType(s) != object_type ||
+       hypre_SStructVectorObjectType(x) != object_type)
+   {
+      hypre_error_in_arg(2);
+      hypre_error_in_arg(3);
+      hypre_error_in_arg(4);
+      hypre_error_in_arg(5);
+      return hypre_error_flag;
+   }
+
+   if (object_type == HYPRE_PARCSR)
+   {
+      hypre_ParVector  *p_par, *s_par, *x_par, *r_par;
+
+      hypre_SStructVectorConvert(p, &p_par);
+      hypre_SStructVectorConvert(s, &s_par);
+      hypre_SStructVectorConvert(x, &x_par);
+      hypre_SStructVectorConvert(r, &r_par);
+
+      return hypre_ParVectorUpdateSolutionResidual(alpha, p_par, s_par, x_par, r_par, r_prod);
+   }
+
+   if (object_type != HYPRE_SSTRUCT ||
+       !hypre_SStructVectorFlatCompatible(p, x) ||
+       !hypre_SStructVectorFlatCompatible(s, r) ||
+       !hypre_SStructVectorFlatCompatible(x, r))
+   {
+      hypre_SStructAxpy(alpha, p, x);
+      hypre_SStructAxpy(-alpha, s, r);
+      if (r_prod)
+      {
+         hypre_SStructInnerProd(r, r, r_prod);
+      }
+
+      return hypre_error_flag;
+   }
+
+   nruns = hypre_SStructVectorFlatNRuns(r);
+   runs  = hypre_SStructVectorFlatRuns(r);
+   pp    = hypre_SStructVectorData(p);
+   sp    = hypre_SStructVectorData(s);
+   xp    = hypre_SStructVectorData(x);
+   rp    = hypre_SStructVectorData(r);
+
+   if (r_prod)
+   {
+#if defined(HYPRE_USING_OPENMP)
+      #pragma omp parallel for private(k, i) reduction(+:presult) HYPRE_SMP_SCHEDULE
+#endif
+      for (k = 0; k < nruns; k++)
+      {
+         for (i = runs[2 * k]; i < runs[2 * k] + runs[2 * k + 1]; i++)
+         {
+            xp[i] += alpha * pp[i];
+            rp[i] += neg_alpha * sp[i];
+            presult += rp[i] * hypre_conj(rp[i]);
+         }
+      }
+
+      hypre_MPI_Allreduce(&presult, r_prod, 1, HYPRE_MPI_REAL, hypre_MPI_SUM,
+                          hypre_SStructVectorComm(r));
+   }
+   else
+   {
+#if defined(HYPRE_USING_OPENMP)
+      #pragma omp parallel for private(k, i) HYPRE_SMP_SCHEDULE
+#endif
+      for (k = 0; k < nruns; k++)
+      {
+         for (i = runs[2 * k]; i < runs[2 * k] + runs[2 * k + 1]; i++)
+         {
+            xp[i] += alpha * pp[i];
+            rp[i] += neg_alpha * sp[i];
+         }
+      }
+   }
+
+   return hypre_error_flag;
+}
@@ -42,7 +42,26 @@ hypre_SStructScale( HYPRE_Complex        alpha,
    HYPRE_Int part;
    HYPRE_Int y_object_type = hypre_SStructVectorObjectType(y);
 
-   if (y_object_type == HYPRE_SSTRUCT)
+   if (y_object_type == HYPRE_SSTRUCT && hypre_SStructVectorSetupFlatPlan(y))
+   {
+      HYPRE_Int      nruns = hypre_SStructVectorFlatNRuns(y);
+      HYPRE_Int     *runs  = hypre_SStructVectorFlatRuns(y);
+      HYPRE_Complex *yp    = hypre_SStructVectorData(y);
+      HYPRE_Int      r, i;
+
+#if defined(HYPRE_USING_OPENMP)
+      #pragma omp parallel for private(r, i) HYPRE_SMP_SCHEDULE
+#endif
+      for (r = 0; r < nruns; r++)
+      {
+         for (i = runs[2 * r]; i < runs[2 * r] + runs[2 * r + 1]; i++)
+         {
+            yp[i] *= alpha;
+         }
+      }
+   }
+
+   else if (y_object_type == HYPRE_SSTRUCT)
    {
       for (part = 0; part < nparts; part++)
       {
@@ -872,3 +872,172 @@ hypre_SStructVectorMemoryLocation(hypre_SStructVector *vector)
    return HYPRE_MEMORY_UNDEFINED;
 }
 
+
+/*--------------------------------------------------------------------------
+ * hypre_SStructVectorSetupFlatPlan
+ *
+ * Build the flat iteration plan of an SStruct vector: the list of
+ * contiguous runs of non-ghost entries in the single data chunk shared by
+ * all parts and variables.  With the plan, vector kernels sweep the whole
+ * vector in one loop instead of one box loop per (part, var, box).
+ *
+ * The plan is built once and kept until the vector is destroyed.  Returns
+ * 1 if the plan is available (SStruct or Struct object type with host
+ * data), 0 otherwise.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SStructVectorSetupFlatPlan( hypre_SStructVector *vector )
+{
+   HYPRE_Int              ndim        = hypre_SStructVectorNDim(vector);
+   HYPRE_Int              nparts      = hypre_SStructVectorNParts(vector);
+   HYPRE_Int              object_type = hypre_SStructVectorObjectType(vector);
+   HYPRE_Complex         *data        = hypre_SStructVectorData(vector);
+
+   hypre_SStructPVector  *pvector;
+   hypre_StructVector    *svector;
+   hypre_BoxArray        *boxes;
+   hypre_Box             *box;
+   hypre_Box             *data_box;
+   hypre_Index            loop_size;
+   hypre_Index            index;
+
+   HYPRE_Int              nruns, max_nruns;
+   HYPRE_Int             *runs;
+   HYPRE_Int              nrows, row, rem;
+   HYPRE_Int              offset, start, length;
+   HYPRE_Int              part, nvars, var, i, d;
+
+   if (hypre_SStructVectorFlatRuns(vector) != NULL)
+   {
+      return 1;
+   }
+
+   if ((object_type != HYPRE_SSTRUCT && object_type != HYPRE_STRUCT) || data == NULL ||
+       hypre_GetExecPolicy1(hypre_SStructVectorMemoryLocation(vector)) == HYPRE_EXEC_DEVICE)
+   {
+      return 0;
+   }
+
+   /* count the rows of all boxes */
+   max_nruns = 0;
+   for (part = 0; part < nparts; part++)
+   {
+      pvector = hypre_SStructVectorPVector(vector, part);
+      nvars   = hypre_SStructPVectorNVars(pvector);
+      for (var = 0; var < nvars; var++)
+      {
+         svector = hypre_SStructPVectorSVector(pvector, var);
+         boxes   = hypre_StructGridBoxes(hypre_StructVectorGrid(svector));
+         hypre_ForBoxI(i, boxes)
+         {
+            box = hypre_BoxArrayBox(boxes, i);
+            if (hypre_BoxVolume(box))
+            {
+               max_nruns += hypre_BoxVolume(box) / hypre_BoxSizeD(box, 0);
+            }
+         }
+      }
+   }
+
+   runs  = hypre_TAlloc(HYPRE_Int, 2 * hypre_max(max_nruns, 1), HYPRE_MEMORY_HOST);
+   nruns = 0;
+
+   for (part = 0; part < nparts; part++)
+   {
+      pvector = hypre_SStructVectorPVector(vector, part);
+      nvars   = hypre_SStructPVectorNVars(pvector);
+      for (var = 0; var < nvars; var++)
+      {
+         svector = hypre_SStructPVectorSVector(pvector, var);
+         boxes   = hypre_StructGridBoxes(hypre_StructVectorGrid(svector));
+         hypre_ForBoxI(i, boxes)
+         {
+            box = hypre_BoxArrayBox(boxes, i);
+            if (hypre_BoxVolume(box) == 0)
+            {
+               continue;
+            }
+
+            data_box = hypre_BoxArrayBox(hypre_StructVectorDataSpace(svector), i);
+            offset   = (HYPRE_Int) (hypre_StructVectorBoxData(svector, i) - data);
+            hypre_BoxGetSize(box, loop_size);
+            length = hypre_IndexD(loop_size, 0);
+            nrows  = hypre_BoxVolume(box) / length;
+
+            for (row = 0; row < nrows; row++)
+            {
+               hypre_CopyIndex(hypre_BoxIMin(box), index);
+               rem = row;
+               for (d = 1; d < ndim; d++)
+               {
+                  hypre_IndexD(index, d) += rem % hypre_IndexD(loop_size, d);
+                  rem /= hypre_IndexD(loop_size, d);
+               }
+               start = offset + hypre_BoxIndexRank(data_box, index);
+
+               /* merge with the previous run when contiguous */
+               if (nruns > 0 && runs[2 * nruns - 2] + runs[2 * nruns - 1] == start)
+               {
+                  runs[2 * nruns - 1] += length;
+               }
+               else
+               {
+                  runs[2 * nruns]     = start;
+                  runs[2 * nruns + 1] = length;
+                  nruns++;
+               }
+            }
+         }
+      }
+   }
+
+   hypre_SStructVectorFlatNRuns(vector) = nruns;
+   hypre_SStructVectorFlatRuns(vector)  = runs;
+
+   return 1;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_SStructVectorFlatCompatible
+ *
+ * Returns 1 if x and y both have a flat iteration plan and the same data
+ * layout, so that flat kernels can be applied to them entry by entry.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SStructVectorFlatCompatible( hypre_SStructVector *x,
+                                   hypre_SStructVector *y )
+{
+   HYPRE_Int  *x_runs, *y_runs;
+   HYPRE_Int   nruns, i;
+
+   if (!hypre_SStructVectorSetupFlatPlan(x) || !hypre_SStructVectorSetupFlatPlan(y))
+   {
+      return 0;
+   }
+
+   if (x == y)
+   {
+      return 1;
+   }
+
+   nruns = hypre_SStructVectorFlatNRuns(x);
+   if (nruns != hypre_SStructVectorFlatNRuns(y) ||
+       hypre_SStructVectorDataSize(x) != hypre_SStructVectorDataSize(y))
+   {
+      return 0;
+   }
+
+   x_runs = hypre_SStructVectorFlatRuns(x);
+   y_runs = hypre_SStructVectorFlatRuns(y);
+   for (i = 0; i < 2 * nruns; i++)
+   {
+      if (x_runs[i] != y_runs[i])
+      {
+         return 0;
+      }
+   }
+
+   return 1;
+}
@@ -62,6 +62,10 @@ typedef struct hypre_SStructVector_struct
                                            of vector data for the part=partx */
    HYPRE_Int               datasize;    /* GEC1002 size of all data = ghlocalsize */
 
+   /* flat iteration plan: contiguous runs of non-ghost entries in data */
+   HYPRE_Int               flat_nruns;
+   HYPRE_Int              *flat_runs;   /* (start, length) pairs, sorted by start */
+
    HYPRE_Int               global_size;  /* Total number coefficients */
    HYPRE_Int               ref_count;
 
@@ -86,6 +90,8 @@ typedef struct hypre_SStructVector_struct
 #define hypre_SStructVectorData(vec)           ((vec) -> data )
 #define hypre_SStructVectorDataIndices(vec)    ((vec) -> dataindices)
 #define hypre_SStructVectorDataSize(vec)       ((vec) -> datasize)
+#define hypre_SStructVectorFlatNRuns(vec)      ((vec) -> flat_nruns)
+#define hypre_SStructVectorFlatRuns(vec)       ((vec) -> flat_runs)
 
 
 /*--------------------------------------------------------------------------
@@ -23,6 +23,9 @@ HYPRE_StructBiCGSTABCreate( MPI_Comm comm, HYPRE_StructSolver *solver )
          hypre_StructKrylovCommInfo,
          hypre_StructKrylovIdentitySetup, hypre_StructKrylovIdentity );
 
+   hypre_BiCGSTABFunctionsSetVectorUpdates(bicgstab_functions,
+                                           hypre_StructKrylovUpdateSolutionResidual,
+                                           hypre_StructKrylovAxpby);
    *solver = ( (HYPRE_StructSolver) hypre_BiCGSTABCreate( bicgstab_functions ) );
 
    return hypre_error_flag;
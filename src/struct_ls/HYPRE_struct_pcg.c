@@ -30,6 +30,9 @@ HYPRE_StructPCGCreate( MPI_Comm comm, HYPRE_StructSolver *solver )
          hypre_StructKrylovScaleVector, hypre_StructKrylovAxpy,
          hypre_StructKrylovIdentitySetup, hypre_StructKrylovIdentity );
 
+   hypre_PCGFunctionsSetVectorUpdates(pcg_functions,
+                                      hypre_StructKrylovUpdateSolutionResidual,
+                                      hypre_StructKrylovAxpby);
    *solver = ( (HYPRE_StructSolver) hypre_PCGCreate( pcg_functions ) );
 
    return hypre_error_flag;
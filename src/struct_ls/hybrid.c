@@ -463,6 +463,9 @@ hypre_HybridSolveUsePCG( hypre_HybridData  *hybrid_data )
          hypre_StructKrylovClearVector,
          hypre_StructKrylovScaleVector, hypre_StructKrylovAxpy,
          hypre_StructKrylovIdentitySetup, hypre_StructKrylovIdentity );
+   hypre_PCGFunctionsSetVectorUpdates(pcg_functions,
+                                      hypre_StructKrylovUpdateSolutionResidual,
+                                      hypre_StructKrylovAxpby);
    krylov_solver = hypre_PCGCreate( pcg_functions );
 
    hypre_PCGSetTol(krylov_solver, tol);
@@ -534,6 +537,9 @@ hypre_HybridSolveUseBiCGSTAB( hypre_HybridData  *hybrid_data )
          hypre_StructKrylovScaleVector, hypre_StructKrylovAxpy,
          hypre_StructKrylovCommInfo,
          hypre_StructKrylovIdentitySetup, hypre_StructKrylovIdentity );
+   hypre_BiCGSTABFunctionsSetVectorUpdates(bicgstab_functions,
+                                           hypre_StructKrylovUpdateSolutionResidual,
+                                           hypre_StructKrylovAxpby);
    krylov_solver = hypre_BiCGSTABCreate( bicgstab_functions );
 
    hypre_BiCGSTABSetTol(krylov_solver, tol);
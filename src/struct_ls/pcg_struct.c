@@ -182,6 +182,38 @@ hypre_StructKrylovAxpy( HYPRE_Complex alpha,
                               (hypre_StructVector *) y ) );
 }
 
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_StructKrylovAxpby( HYPRE_Complex alpha,
+                         void         *x,
+                         HYPRE_Complex beta,
+                         void         *y )
+{
+   return ( hypre_StructAxpby( alpha, (hypre_StructVector *) x,
+                               beta, (hypre_StructVector *) y ) );
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_StructKrylovUpdateSolutionResidual( HYPRE_Complex  alpha,
+                                          void          *p,
+                                          void          *s,
+                                          void          *x,
+                                          void          *r,
+                                          HYPRE_Real    *r_prod )
+{
+   return ( hypre_StructUpdateSolutionResidual( alpha,
+                                                (hypre_StructVector *) p,
+                                                (hypre_StructVector *) s,
+                                                (hypre_StructVector *) x,
+                                                (hypre_StructVector *) r,
+                                                r_prod ) );
+}
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
@@ -102,6 +102,9 @@ HYPRE_Int hypre_StructKrylovCopyVector ( void *x, void *y );
 HYPRE_Int hypre_StructKrylovClearVector ( void *x );
 HYPRE_Int hypre_StructKrylovScaleVector ( HYPRE_Complex alpha, void *x );
 HYPRE_Int hypre_StructKrylovAxpy ( HYPRE_Complex alpha, void *x, void *y );
+HYPRE_Int hypre_StructKrylovAxpby ( HYPRE_Complex alpha, void *x, HYPRE_Complex beta, void *y );
+HYPRE_Int hypre_StructKrylovUpdateSolutionResidual ( HYPRE_Complex alpha, void *p, void *s,
+                                                    void *x, void *r, HYPRE_Real *r_prod );
 HYPRE_Int hypre_StructKrylovIdentitySetup ( void *vdata, void *A, void *b, void *x );
 HYPRE_Int hypre_StructKrylovIdentity ( void *vdata, void *A, void *b, void *x );
 HYPRE_Int hypre_StructKrylovCommInfo ( void *A, HYPRE_Int *my_id, HYPRE_Int *num_procs );
@@ -474,6 +477,18 @@ HYPRE_Int hypre_SMGSetStructVectorConstantValues ( hypre_StructVector *vector, H
                                                    hypre_BoxArray *box_array, hypre_Index stride );
 HYPRE_Int hypre_StructSMGSetMaxLevel( void   *smg_vdata, HYPRE_Int   max_level  );
 
+/* smg_line_solve.c */
+HYPRE_Int hypre_SMGLineSolveUsable ( hypre_StructMatrix *A, hypre_Index base_stride );
+void *hypre_SMGLineSolveCreate ( MPI_Comm comm );
+HYPRE_Int hypre_SMGLineSolveSetBase ( void *line_vdata, hypre_Index base_index,
+                                      hypre_Index base_stride );
+HYPRE_Int hypre_SMGLineSolveSetup ( void *line_vdata, hypre_StructMatrix *A,
+                                    hypre_StructVector *b, hypre_StructVector *x );
+HYPRE_Int hypre_SMGLineSolveSingular ( void *line_vdata );
+HYPRE_Int hypre_SMGLineSolve ( void *line_vdata, hypre_StructMatrix *A, hypre_StructVector *b,
+                               hypre_StructVector *x );
+HYPRE_Int hypre_SMGLineSolveDestroy ( void *line_vdata );
+
 /* smg_relax.c */
 void *hypre_SMGRelaxCreate ( MPI_Comm comm );
 HYPRE_Int hypre_SMGRelaxDestroyTempVec ( void *relax_vdata );
@@ -0,0 +1,517 @@
+/******************************************************************************
+ * Copyright (c) 1998 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Batched direct line solver for the SMG line relaxation.
+ *
+ * When every line of the (one-dimensional) solve operator lies entirely
+ * inside one grid box, the line systems are independent tridiagonal systems
+ * and can be solved with the Thomas algorithm without any communication.
+ * The LU factors of all lines are computed once in the setup phase and stored
+ * interleaved in batches of HYPRE_SMG_LINE_BATCH lines, so that the forward
+ * and backward sweeps of the solve phase advance a whole batch of lines per
+ * step (one line per SIMD lane).
+ *
+ * Lines that cross box boundaries and periodic grids are not handled here;
+ * the caller should check hypre_SMGLineSolveUsable() and fall back to cyclic
+ * reduction.  The same holds if the setup finds a zero pivot, see
+ * hypre_SMGLineSolveSingular().
+ *
+ *****************************************************************************/
+
+#include "_hypre_struct_ls.h"
+
+#define HYPRE_SMG_LINE_BATCH 8
+
+typedef struct
+{
+   MPI_Comm              comm;
+   hypre_Index           base_index;
+   hypre_Index           base_stride;
+
+   hypre_BoxArray       *line_boxes;     /* grid boxes projected onto the base */
+   HYPRE_Int            *line_sizes;     /* number of points per line (per box) */
+   HYPRE_Int            *num_lines;      /* number of lines (per box) */
+   HYPRE_Int            *factor_starts;  /* start of each box in the factors */
+
+   HYPRE_Real           *lower;          /* sub-diagonal coefficients */
+   HYPRE_Real           *upper;          /* eliminated super-diagonal */
+   HYPRE_Real           *inv_diag;       /* inverse of the LU pivots */
+   HYPRE_Int             singular;       /* some line has a zero pivot */
+
+   HYPRE_Int             time_index;
+} hypre_SMGLineSolveData;
+
+/*--------------------------------------------------------------------------
+ * Compute the first index of line 'l' of 'box' (dimension 0 is the line
+ * direction, the remaining dimensions enumerate the lines).
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_SMGLineSolveLineStart( HYPRE_Int    ndim,
+                             hypre_Box   *box,
+                             hypre_Index  stride,
+                             hypre_Index  loop_size,
+                             HYPRE_Int    l,
+                             hypre_Index  index )
+{
+   HYPRE_Int  d;
+
+   hypre_CopyIndex(hypre_BoxIMin(box), index);
+   for (d = 1; d < ndim; d++)
+   {
+      hypre_IndexD(index, d) += (l % hypre_IndexD(loop_size, d)) * hypre_IndexD(stride, d);
+      l /= hypre_IndexD(loop_size, d);
+   }
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_SMGLineSolveUsable
+ *
+ * Returns (collectively) 1 if the line systems of the one-dimensional
+ * operator A are tridiagonal and never cross a box boundary, so that they
+ * can be solved by hypre_SMGLineSolve.
+ *
+ * Periodic grids are excluded.  Cyclic reduction also updates the ghost
+ * layers of x at the periodic images through its halo exchange, and SMG on
+ * grids that are periodic with a non-power-of-two period depends on these
+ * values (TEST_struct periodic.out.60).
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SMGLineSolveUsable( hypre_StructMatrix *A,
+                          hypre_Index         base_stride )
+{
+   MPI_Comm              comm          = hypre_StructMatrixComm(A);
+   HYPRE_Int             ndim          = hypre_StructMatrixNDim(A);
+   hypre_StructGrid     *grid          = hypre_StructMatrixGrid(A);
+   hypre_BoxArray       *boxes         = hypre_StructGridBoxes(grid);
+   hypre_Box            *bounding_box  = hypre_StructGridBoundingBox(grid);
+   hypre_StructStencil  *stencil       = hypre_StructMatrixStencil(A);
+   hypre_Index          *stencil_shape = hypre_StructStencilShape(stencil);
+   HYPRE_Int             stencil_size  = hypre_StructStencilSize(stencil);
+   HYPRE_MemoryLocation  memory_location = hypre_StructMatrixMemoryLocation(A);
+
+   hypre_IndexRef        periodic      = hypre_StructGridPeriodic(grid);
+   hypre_Box            *box;
+   HYPRE_Int             usable = 1;
+   HYPRE_Int             global_usable;
+   HYPRE_Int             i, d;
+
+   if (hypre_StructMatrixConstantCoefficient(A) ||
+       hypre_GetExecPolicy1(memory_location) == HYPRE_EXEC_DEVICE ||
+       hypre_IndexD(base_stride, 0) != 1)
+   {
+      usable = 0;
+   }
+
+   for (d = 0; d < ndim; d++)
+   {
+      if (hypre_IndexD(periodic, d) != 0)
+      {
+         usable = 0;
+      }
+   }
+
+   for (i = 0; i < stencil_size && usable; i++)
+   {
+      if (hypre_abs(hypre_IndexD(stencil_shape[i], 0)) > 1)
+      {
+         usable = 0;
+      }
+      for (d = 1; d < ndim; d++)
+      {
+         if (hypre_IndexD(stencil_shape[i], d) != 0)
+         {
+            usable = 0;
+         }
+      }
+   }
+
+   /* every box must span the whole grid in the line direction */
+   hypre_ForBoxI(i, boxes)
+   {
+      box = hypre_BoxArrayBox(boxes, i);
+      if (hypre_BoxIMinD(box, 0) != hypre_BoxIMinD(bounding_box, 0) ||
+          hypre_BoxIMaxD(box, 0) != hypre_BoxIMaxD(bounding_box, 0))
+      {
+         usable = 0;
+      }
+   }
+
+   hypre_MPI_Allreduce(&usable, &global_usable, 1, HYPRE_MPI_INT, hypre_MPI_MIN, comm);
+
+   return global_usable;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_SMGLineSolveCreate
+ *--------------------------------------------------------------------------*/
+
+void *
+hypre_SMGLineSolveCreate( MPI_Comm  comm )
+{
+   hypre_SMGLineSolveData *line_data;
+
+   line_data = hypre_CTAlloc(hypre_SMGLineSolveData, 1, HYPRE_MEMORY_HOST);
+
+   (line_data -> comm)       = comm;
+   (line_data -> time_index) = hypre_InitializeTiming("SMGLineSolve");
+
+   /* set defaults */
+   hypre_SetIndex3((line_data -> base_index), 0, 0, 0);
+   hypre_SetIndex3((line_data -> base_stride), 1, 1, 1);
+
+   return (void *) line_data;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_SMGLineSolveSetBase
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SMGLineSolveSetBase( void        *line_vdata,
+                           hypre_Index  base_index,
+                           hypre_Index  base_stride )
+{
+   hypre_SMGLineSolveData *line_data = (hypre_SMGLineSolveData *) line_vdata;
+   HYPRE_Int               d;
+
+   for (d = 0; d < 3; d++)
+   {
+      hypre_IndexD((line_data -> base_index),  d) = hypre_IndexD(base_index,  d);
+      hypre_IndexD((line_data -> base_stride), d) = hypre_IndexD(base_stride, d);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_SMGLineSolveSetup
+ *
+ * Factor all line systems of A.  For the line with sub-diagonal a, diagonal
+ * d and super-diagonal c this computes the Thomas factors
+ *
+ *    inv_diag_i = 1 / (d_i - a_i * upper_{i-1}),   upper_i = c_i * inv_diag_i
+ *
+ * Couplings that point out of the line (domain boundary) are dropped.  If a
+ * zero pivot occurs on any process, no factors are kept and the solver is
+ * marked singular, so that the caller can use cyclic reduction instead.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SMGLineSolveSetup( void               *line_vdata,
+                         hypre_StructMatrix *A,
+                         hypre_StructVector *b,
+                         hypre_StructVector *x )
+{
+   hypre_SMGLineSolveData *line_data = (hypre_SMGLineSolveData *) line_vdata;
+
+   HYPRE_Int               ndim      = hypre_StructMatrixNDim(A);
+   hypre_IndexRef          base_stride = (line_data -> base_stride);
+   hypre_BoxArray         *boxes     = hypre_StructGridBoxes(hypre_StructMatrixGrid(A));
+   HYPRE_Int               symmetric = hypre_StructMatrixSymmetric(A);
+
+   hypre_BoxArray         *line_boxes;
+   HYPRE_Int              *line_sizes;
+   HYPRE_Int              *num_lines;
+   HYPRE_Int              *factor_starts;
+   HYPRE_Real             *lower;
+   HYPRE_Real             *upper;
+   HYPRE_Real             *inv_diag;
+
+   hypre_Box              *line_box;
+   hypre_Box              *A_dbox;
+   hypre_Index             loop_size;
+   hypre_Index             index;
+   HYPRE_Real             *Ap_w, *Ap_c, *Ap_e;
+   HYPRE_Int               num_boxes, n, nbatches, total;
+   HYPRE_Int               singular = 0;
+   HYPRE_Int               bi, d;
+
+   /*----------------------------------------------------------
+    * Free up old data before putting new data into structure
+    *----------------------------------------------------------*/
+
+   hypre_BoxArrayDestroy(line_data -> line_boxes);
+   hypre_TFree(line_data -> line_sizes, HYPRE_MEMORY_HOST);
+   hypre_TFree(line_data -> num_lines, HYPRE_MEMORY_HOST);
+   hypre_TFree(line_data -> factor_starts, HYPRE_MEMORY_HOST);
+   hypre_TFree(line_data -> lower, HYPRE_MEMORY_HOST);
+   hypre_TFree(line_data -> upper, HYPRE_MEMORY_HOST);
+   hypre_TFree(line_data -> inv_diag, HYPRE_MEMORY_HOST);
+
+   /*----------------------------------------------------------
+    * Compute the line layout of each box
+    *----------------------------------------------------------*/
+
+   line_boxes = hypre_BoxArrayDuplicate(boxes);
+   hypre_ProjectBoxArray(line_boxes, (line_data -> base_index), base_stride);
+
+   num_boxes     = hypre_BoxArraySize(line_boxes);
+   line_sizes    = hypre_CTAlloc(HYPRE_Int, num_boxes, HYPRE_MEMORY_HOST);
+   num_lines     = hypre_CTAlloc(HYPRE_Int, num_boxes, HYPRE_MEMORY_HOST);
+   factor_starts = hypre_CTAlloc(HYPRE_Int, num_boxes + 1, HYPRE_MEMORY_HOST);
+
+   total = 0;
+   hypre_ForBoxI(bi, line_boxes)
+   {
+      line_box = hypre_BoxArrayBox(line_boxes, bi);
+      factor_starts[bi] = total;
+      if (hypre_BoxVolume(line_box))
+      {
+         hypre_BoxGetStrideSize(line_box, base_stride, loop_size);
+         line_sizes[bi] = hypre_IndexD(loop_size, 0);
+         num_lines[bi]  = 1;
+         for (d = 1; d < ndim; d++)
+         {
+            num_lines[bi] *= hypre_IndexD(loop_size, d);
+         }
+         nbatches = (num_lines[bi] + HYPRE_SMG_LINE_BATCH - 1) / HYPRE_SMG_LINE_BATCH;
+         total += nbatches * line_sizes[bi] * HYPRE_SMG_LINE_BATCH;
+      }
+   }
+   factor_starts[num_boxes] = total;
+
+   lower    = hypre_CTAlloc(HYPRE_Real, total, HYPRE_MEMORY_HOST);
+   upper    = hypre_CTAlloc(HYPRE_Real, total, HYPRE_MEMORY_HOST);
+   inv_diag = hypre_CTAlloc(HYPRE_Real, total, HYPRE_MEMORY_HOST);
+
+   /*----------------------------------------------------------
+    * Factor the lines
+    *----------------------------------------------------------*/
+
+   hypre_ForBoxI(bi, line_boxes)
+   {
+      HYPRE_Int  l, lane, i, f, Ai;
+      HYPRE_Real a, c, pivot;
+
+      if (num_lines[bi] == 0 || singular)
+      {
+         continue;
+      }
+
+      line_box = hypre_BoxArrayBox(line_boxes, bi);
+      A_dbox   = hypre_BoxArrayBox(hypre_StructMatrixDataSpace(A), bi);
+      hypre_BoxGetStrideSize(line_box, base_stride, loop_size);
+      n = line_sizes[bi];
+
+      hypre_SetIndex(index, 0);
+      Ap_c = hypre_StructMatrixExtractPointerByIndex(A, bi, index);
+      hypre_IndexD(index, 0) = -1;
+      Ap_w = hypre_StructMatrixExtractPointerByIndex(A, bi, index);
+      hypre_IndexD(index, 0) = 1;
+      Ap_e = hypre_StructMatrixExtractPointerByIndex(A, bi, index);
+
+      for (l = 0; l < num_lines[bi] && !singular; l++)
+      {
+         hypre_SMGLineSolveLineStart(ndim, line_box, base_stride, loop_size, l, index);
+         Ai   = hypre_BoxIndexRank(A_dbox, index);
+         lane = l % HYPRE_SMG_LINE_BATCH;
+         f    = factor_starts[bi] + (l - lane) * n + lane;
+
+         for (i = 0; i < n; i++, f += HYPRE_SMG_LINE_BATCH)
+         {
+            a = (i > 0 && Ap_w) ? Ap_w[Ai + i] : 0.0;
+            if (i == n - 1)
+            {
+               c = 0.0;
+            }
+            else if (Ap_e)
+            {
+               c = Ap_e[Ai + i];
+            }
+            else
+            {
+               /* symmetric storage: east coefficient is the west one of i+1 */
+               c = (symmetric && Ap_w) ? Ap_w[Ai + i + 1] : 0.0;
+            }
+
+            pivot = Ap_c[Ai + i];
+            if (i > 0)
+            {
+               pivot -= a * upper[f - HYPRE_SMG_LINE_BATCH];
+            }
+            if (pivot == 0.0)
+            {
+               singular = 1;
+               break;
+            }
+
+            lower[f]    = a;
+            inv_diag[f] = 1.0 / pivot;
+            upper[f]    = c * inv_diag[f];
+         }
+      }
+   }
+
+   hypre_MPI_Allreduce(&singular, &(line_data -> singular), 1, HYPRE_MPI_INT,
+                       hypre_MPI_MAX, (line_data -> comm));
+   if (line_data -> singular)
+   {
+      hypre_TFree(lower, HYPRE_MEMORY_HOST);
+      hypre_TFree(upper, HYPRE_MEMORY_HOST);
+      hypre_TFree(inv_diag, HYPRE_MEMORY_HOST);
+   }
+
+   (line_data -> line_boxes)    = line_boxes;
+   (line_data -> line_sizes)    = line_sizes;
+   (line_data -> num_lines)     = num_lines;
+   (line_data -> factor_starts) = factor_starts;
+   (line_data -> lower)         = lower;
+   (line_data -> upper)         = upper;
+   (line_data -> inv_diag)      = inv_diag;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_SMGLineSolveSingular
+ *
+ * Returns (the same on all processes) 1 if the last setup found a zero
+ * pivot.  The solver must not be used then.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SMGLineSolveSingular( void *line_vdata )
+{
+   hypre_SMGLineSolveData *line_data = (hypre_SMGLineSolveData *) line_vdata;
+
+   return (line_data -> singular);
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_SMGLineSolve
+ *
+ * Solve A x = b on the base lines with the factors computed in the setup.
+ * The matrix argument is only used for interface compatibility with
+ * hypre_CyclicReduction.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SMGLineSolve( void               *line_vdata,
+                    hypre_StructMatrix *A,
+                    hypre_StructVector *b,
+                    hypre_StructVector *x )
+{
+   hypre_SMGLineSolveData *line_data = (hypre_SMGLineSolveData *) line_vdata;
+
+   HYPRE_Int               ndim          = hypre_StructVectorNDim(x);
+   hypre_IndexRef          base_stride   = (line_data -> base_stride);
+   hypre_BoxArray         *line_boxes    = (line_data -> line_boxes);
+   HYPRE_Int              *line_sizes    = (line_data -> line_sizes);
+   HYPRE_Int              *num_lines     = (line_data -> num_lines);
+   HYPRE_Int              *factor_starts = (line_data -> factor_starts);
+   HYPRE_Real             *lower         = (line_data -> lower);
+   HYPRE_Real             *upper         = (line_data -> upper);
+   HYPRE_Real             *inv_diag      = (line_data -> inv_diag);
+
+   hypre_Box              *line_box;
+   hypre_Box              *b_dbox;
+   hypre_Box              *x_dbox;
+   HYPRE_Real             *bp, *xp;
+   hypre_Index             loop_size;
+   HYPRE_Int               n, nbatches;
+   HYPRE_Int               bi, batch;
+
+   hypre_BeginTiming(line_data -> time_index);
+
+   hypre_ForBoxI(bi, line_boxes)
+   {
+      if (num_lines[bi] == 0)
+      {
+         continue;
+      }
+
+      line_box = hypre_BoxArrayBox(line_boxes, bi);
+      b_dbox   = hypre_BoxArrayBox(hypre_StructVectorDataSpace(b), bi);
+      x_dbox   = hypre_BoxArrayBox(hypre_StructVectorDataSpace(x), bi);
+      bp       = hypre_StructVectorBoxData(b, bi);
+      xp       = hypre_StructVectorBoxData(x, bi);
+      hypre_BoxGetStrideSize(line_box, base_stride, loop_size);
+      n        = line_sizes[bi];
+      nbatches = (num_lines[bi] + HYPRE_SMG_LINE_BATCH - 1) / HYPRE_SMG_LINE_BATCH;
+
+#if defined(HYPRE_USING_OPENMP)
+      #pragma omp parallel for private(batch) HYPRE_SMP_SCHEDULE
+#endif
+      for (batch = 0; batch < nbatches; batch++)
+      {
+         HYPRE_Int    bi_off[HYPRE_SMG_LINE_BATCH];
+         HYPRE_Int    xi_off[HYPRE_SMG_LINE_BATCH];
+         hypre_Index  index;
+         HYPRE_Int    first = batch * HYPRE_SMG_LINE_BATCH;
+         HYPRE_Int    nl    = hypre_min(HYPRE_SMG_LINE_BATCH, num_lines[bi] - first);
+         HYPRE_Int    f, i, lane;
+
+         for (lane = 0; lane < nl; lane++)
+         {
+            hypre_SMGLineSolveLineStart(ndim, line_box, base_stride, loop_size,
+                                        first + lane, index);
+            bi_off[lane] = hypre_BoxIndexRank(b_dbox, index);
+            xi_off[lane] = hypre_BoxIndexRank(x_dbox, index);
+         }
+
+         /* forward sweep */
+         f = factor_starts[bi] + first * n;
+         for (lane = 0; lane < nl; lane++)
+         {
+            xp[xi_off[lane]] = bp[bi_off[lane]] * inv_diag[f + lane];
+         }
+         for (i = 1; i < n; i++)
+         {
+            f += HYPRE_SMG_LINE_BATCH;
+            for (lane = 0; lane < nl; lane++)
+            {
+               xp[xi_off[lane] + i] = (bp[bi_off[lane] + i] -
+                                       lower[f + lane] * xp[xi_off[lane] + i - 1]) *
+                                      inv_diag[f + lane];
+            }
+         }
+
+         /* backward sweep */
+         for (i = n - 2; i >= 0; i--)
+         {
+            f -= HYPRE_SMG_LINE_BATCH;
+            for (lane = 0; lane < nl; lane++)
+            {
+               xp[xi_off[lane] + i] -= upper[f + lane] * xp[xi_off[lane] + i + 1];
+            }
+         }
+      }
+   }
+
+   hypre_EndTiming(line_data -> time_index);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_SMGLineSolveDestroy
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SMGLineSolveDestroy( void *line_vdata )
+{
+   hypre_SMGLineSolveData *line_data = (hypre_SMGLineSolveData *) line_vdata;
+
+   if (line_data)
+   {
+      hypre_BoxArrayDestroy(line_data -> line_boxes);
+      hypre_TFree(line_data -> line_sizes, HYPRE_MEMORY_HOST);
+      hypre_TFree(line_data -> num_lines, HYPRE_MEMORY_HOST);
+      hypre_TFree(line_data -> factor_starts, HYPRE_MEMORY_HOST);
+      hypre_TFree(line_data -> lower, HYPRE_MEMORY_HOST);
+      hypre_TFree(line_data -> upper, HYPRE_MEMORY_HOST);
+      hypre_TFree(line_data -> inv_diag, HYPRE_MEMORY_HOST);
+      hypre_FinalizeTiming(line_data -> time_index);
+      hypre_TFree(line_data, HYPRE_MEMORY_HOST);
+   }
+
+   return hypre_error_flag;
+}
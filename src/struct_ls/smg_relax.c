@@ -49,6 +49,7 @@ typedef struct
                                       A_rem = A - A_sol                  */
    void                  **residual_data;  /* Array of size `num_spaces' */
    void                  **solve_data;     /* Array of size `num_spaces' */
+   HYPRE_Int               line_solve;     /* use the batched line solver */
 
    /* log info (always logged) */
    HYPRE_Int               num_iterations;
@@ -160,6 +161,10 @@ hypre_SMGRelaxDestroyASol( void *relax_vdata )
          {
             hypre_SMGDestroy(relax_data -> solve_data[i]);
          }
+         else if (relax_data -> line_solve)
+         {
+            hypre_SMGLineSolveDestroy(relax_data -> solve_data[i]);
+         }
          else
          {
             hypre_CyclicReductionDestroy(relax_data -> solve_data[i]);
@@ -309,6 +314,10 @@ hypre_SMGRelax( void               *relax_vdata,
             {
                hypre_SMGSolve(solve_data[is], A_sol, temp_vec, x);
             }
+            else if (relax_data -> line_solve)
+            {
+               hypre_SMGLineSolve(solve_data[is], A_sol, temp_vec, x);
+            }
             else
             {
                hypre_CyclicReduction(solve_data[is], A_sol, temp_vec, x);
@@ -573,9 +582,44 @@ hypre_SMGRelaxSetupASol( void               *relax_vdata,
    hypre_StructStencilNDim(hypre_StructMatrixStencil(A_sol)) = stencil_dim - 1;
    hypre_TFree(stencil_indices, HYPRE_MEMORY_HOST);
 
+   /* Lines that never cross a box boundary are solved directly in batches,
+      otherwise use cyclic reduction */
+   (relax_data -> line_solve) = 0;
+   if (stencil_dim == 2)
+   {
+      (relax_data -> line_solve) = hypre_SMGLineSolveUsable(A_sol, base_stride);
+   }
+
    /* Set up solve_data */
    solve_data    = hypre_TAlloc(void *,  num_spaces, HYPRE_MEMORY_HOST);
 
+   /* Factor the lines first. If a line system has a zero pivot, all spaces
+      use cyclic reduction instead. */
+   if (relax_data -> line_solve)
+   {
+      for (i = 0; i < num_spaces; i++)
+      {
+         hypre_IndexD(base_index,  (stencil_dim - 1)) = space_indices[i];
+         hypre_IndexD(base_stride, (stencil_dim - 1)) = space_strides[i];
+
+         solve_data[i] = hypre_SMGLineSolveCreate(relax_data -> comm);
+         hypre_SMGLineSolveSetBase(solve_data[i], base_index, base_stride);
+         hypre_SMGLineSolveSetup(solve_data[i], A_sol, temp_vec, x);
+         if (hypre_SMGLineSolveSingular(solve_data[i]))
+         {
+            (relax_data -> line_solve) = 0;
+         }
+      }
+
+      if (!(relax_data -> line_solve))
+      {
+         for (i = 0; i < num_spaces; i++)
+         {
+            hypre_SMGLineSolveDestroy(solve_data[i]);
+         }
+      }
+   }
+
    for (i = 0; i < num_spaces; i++)
    {
       hypre_IndexD(base_index,  (stencil_dim - 1)) = space_indices[i];
@@ -593,7 +637,7 @@ hypre_SMGRelaxSetupASol( void               *relax_vdata,
          hypre_StructSMGSetMaxLevel(solve_data[i], (relax_data -> max_level));
          hypre_SMGSetup(solve_data[i], A_sol, temp_vec, x);
       }
-      else
+      else if (!(relax_data -> line_solve))
       {
          solve_data[i] = hypre_CyclicReductionCreate(relax_data -> comm);
          hypre_CyclicReductionSetBase(solve_data[i], base_index, base_stride);
@@ -1586,6 +1586,8 @@ HYPRE_Int hypre_ProjectBoxArrayArray ( hypre_BoxArrayArray *box_array_array, hyp
 
 /* struct_axpy.c */
 HYPRE_Int hypre_StructAxpy ( HYPRE_Complex alpha, hypre_StructVector *x, hypre_StructVector *y );
+HYPRE_Int hypre_StructAxpby ( HYPRE_Complex alpha, hypre_StructVector *x, HYPRE_Complex beta,
+                             hypre_StructVector *y );
 
 /* struct_communication.c */
 HYPRE_Int hypre_CommPkgCreate ( hypre_CommInfo *comm_info, hypre_BoxArray *send_data_space,
@@ -1634,7 +1636,11 @@ HYPRE_Int hypre_StructGridSetDataLocation( HYPRE_StructGrid grid,
                                            HYPRE_MemoryLocation data_location );
 #endif
 /* struct_innerprod.c */
+HYPRE_Real hypre_StructInnerProdLocal ( hypre_StructVector *x, hypre_StructVector *y );
 HYPRE_Real hypre_StructInnerProd ( hypre_StructVector *x, hypre_StructVector *y );
+HYPRE_Int hypre_StructUpdateSolutionResidual ( HYPRE_Complex alpha, hypre_StructVector *p,
+                                              hypre_StructVector *s, hypre_StructVector *x,
+                                              hypre_StructVector *r, HYPRE_Real *r_prod );
 
 /* struct_io.c */
 HYPRE_Int hypre_PrintBoxArrayData ( FILE *file, hypre_BoxArray *box_array,
@@ -81,3 +81,59 @@ hypre_StructAxpy( HYPRE_Complex       alpha,
    return hypre_error_flag;
 }
 
+
+/*--------------------------------------------------------------------------
+ * hypre_StructAxpby
+ *
+ * y = alpha*x + beta*y
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_StructAxpby( HYPRE_Complex       alpha,
+                   hypre_StructVector *x,
+                   HYPRE_Complex       beta,
+                   hypre_StructVector *y     )
+{
+   hypre_Box        *x_data_box;
+   hypre_Box        *y_data_box;
+
+   HYPRE_Complex    *xp;
+   HYPRE_Complex    *yp;
+
+   hypre_BoxArray   *boxes;
+   hypre_Box        *box;
+   hypre_Index       loop_size;
+   hypre_IndexRef    start;
+   hypre_Index       unit_stride;
+
+   HYPRE_Int         i;
+
+   hypre_SetIndex(unit_stride, 1);
+
+   boxes = hypre_StructGridBoxes(hypre_StructVectorGrid(y));
+   hypre_ForBoxI(i, boxes)
+   {
+      box   = hypre_BoxArrayBox(boxes, i);
+      start = hypre_BoxIMin(box);
+
+      x_data_box = hypre_BoxArrayBox(hypre_StructVectorDataSpace(x), i);
+      y_data_box = hypre_BoxArrayBox(hypre_StructVectorDataSpace(y), i);
+
+      xp = hypre_StructVectorBoxData(x, i);
+      yp = hypre_StructVectorBoxData(y, i);
+
+      hypre_BoxGetSize(box, loop_size);
+
+#define DEVICE_VAR is_device_ptr(yp,xp)
+      hypre_BoxLoop2Begin(hypre_StructVectorNDim(x), loop_size,
+                          x_data_box, start, unit_stride, xi,
+                          y_data_box, start, unit_stride, yi);
+      {
+         yp[yi] = alpha * xp[xi] + beta * yp[yi];
+      }
+      hypre_BoxLoop2End(xi, yi);
+#undef DEVICE_VAR
+   }
+
+   return hypre_error_flag;
+}
@@ -15,16 +15,15 @@
 #include "_hypre_struct_mv.hpp"
 
 /*--------------------------------------------------------------------------
- * hypre_StructInnerProd
+ * hypre_StructInnerProdLocal
+ *
+ * Inner product of the local parts of x and y (no global reduction).
  *--------------------------------------------------------------------------*/
 
 HYPRE_Real
-hypre_StructInnerProd( hypre_StructVector *x,
-                       hypre_StructVector *y )
+hypre_StructInnerProdLocal( hypre_StructVector *x,
+                            hypre_StructVector *y )
 {
-   HYPRE_Real       final_innerprod_result;
-   HYPRE_Real       process_result;
-
    hypre_Box       *x_data_box;
    hypre_Box       *y_data_box;
 
@@ -92,11 +91,26 @@ hypre_StructInnerProd( hypre_StructVector *x,
          box_sum += tmp;
       }
       hypre_BoxLoop2ReductionEnd(xi, yi, box_sum);
+#undef DEVICE_VAR
 
       local_result += (HYPRE_Real) box_sum;
    }
 
-   process_result = (HYPRE_Real) local_result;
+   return (HYPRE_Real) local_result;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_StructInnerProd
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Real
+hypre_StructInnerProd( hypre_StructVector *x,
+                       hypre_StructVector *y )
+{
+   HYPRE_Real       final_innerprod_result;
+   HYPRE_Real       process_result;
+
+   process_result = hypre_StructInnerProdLocal(x, y);
 
    hypre_MPI_Allreduce(&process_result, &final_innerprod_result, 1,
                        HYPRE_MPI_REAL, hypre_MPI_SUM, hypre_StructVectorComm(x));
@@ -105,3 +119,152 @@ hypre_StructInnerProd( hypre_StructVector *x,
 
    return final_innerprod_result;
 }
+
+/*--------------------------------------------------------------------------
+ * hypre_StructVectorsShareDataSpace
+ *
+ * Returns 1 if x and y have the same data boxes, so that one box loop
+ * index addresses both.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_StructVectorsShareDataSpace( hypre_StructVector *x,
+                                   hypre_StructVector *y )
+{
+   hypre_BoxArray  *x_data_space = hypre_StructVectorDataSpace(x);
+   hypre_BoxArray  *y_data_space = hypre_StructVectorDataSpace(y);
+   HYPRE_Int        ndim         = hypre_StructVectorNDim(x);
+   hypre_Box       *x_data_box;
+   hypre_Box       *y_data_box;
+   HYPRE_Int        i;
+
+   if (hypre_BoxArraySize(x_data_space) != hypre_BoxArraySize(y_data_space))
+   {
+      return 0;
+   }
+
+   hypre_ForBoxI(i, x_data_space)
+   {
+      x_data_box = hypre_BoxArrayBox(x_data_space, i);
+      y_data_box = hypre_BoxArrayBox(y_data_space, i);
+      if (!hypre_IndexesEqual(hypre_BoxIMin(x_data_box), hypre_BoxIMin(y_data_box), ndim) ||
+          !hypre_IndexesEqual(hypre_BoxIMax(x_data_box), hypre_BoxIMax(y_data_box), ndim))
+      {
+         return 0;
+      }
+   }
+
+   return 1;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_StructUpdateSolutionResidual
+ *
+ * Fused Krylov update x = x + alpha*p, r = r - alpha*s.  If r_prod is not
+ * NULL, <r,r> is returned in r_prod (it is always accumulated in the same
+ * pass, but only reduced when requested).  Falls back to separate axpys and
+ * inner product if p and x (or s and r) do not share the same data space.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_StructUpdateSolutionResidual( HYPRE_Complex       alpha,
+                                    hypre_StructVector *p,
+                                    hypre_StructVector *s,
+                                    hypre_StructVector *x,
+                                    hypre_StructVector *r,
+                                    HYPRE_Real         *r_prod )
+{
+   hypre_Box       *x_data_box;
+   hypre_Box       *r_data_box;
+
+   HYPRE_Complex   *pp, *sp, *xp, *rp;
+
+   hypre_BoxArray  *boxes;
+   hypre_Box       *box;
+   hypre_Index      loop_size;
+   hypre_IndexRef   start;
+   hypre_Index      unit_stride;
+
+   HYPRE_Int        ndim         = hypre_StructVectorNDim(r);
+   HYPRE_Complex    neg_alpha    = -alpha;
+   HYPRE_Real       local_result = 0.0;
+   HYPRE_Int        i;
+
+   if (!hypre_StructVectorsShareDataSpace(p, x) ||
+       !hypre_StructVectorsShareDataSpace(s, r))
+   {
+      hypre_StructAxpy(alpha, p, x);
+      hypre_StructAxpy(-alpha, s, r);
+      if (r_prod)
+      {
+         *r_prod = hypre_StructInnerProd(r, r);
+      }
+
+      return hypre_error_flag;
+   }
+
+   hypre_SetIndex(unit_stride, 1);
+
+   boxes = hypre_StructGridBoxes(hypre_StructVectorGrid(r));
+   hypre_ForBoxI(i, boxes)
+   {
+      box   = hypre_BoxArrayBox(boxes, i);
+      start = hypre_BoxIMin(box);
+
+      x_data_box = hypre_BoxArrayBox(hypre_StructVectorDataSpace(x), i);
+      r_data_box = hypre_BoxArrayBox(hypre_StructVectorDataSpace(r), i);
+
+      pp = hypre_StructVectorBoxData(p, i);
+      sp = hypre_StructVectorBoxData(s, i);
+      xp = hypre_StructVectorBoxData(x, i);
+      rp = hypre_StructVectorBoxData(r, i);
+
+      hypre_BoxGetSize(box, loop_size);
+
+#if defined(HYPRE_USING_KOKKOS) || defined(HYPRE_USING_SYCL)
+      HYPRE_Real box_sum = 0.0;
+#elif defined(HYPRE_USING_RAJA)
+      ReduceSum<hypre_raja_reduce_policy, HYPRE_Real> box_sum(0.0);
+#elif defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_HIP)
+      ReduceSum<HYPRE_Real> box_sum(0.0);
+#else
+      HYPRE_Real box_sum = 0.0;
+#endif
+
+#ifdef HYPRE_BOX_REDUCTION
+#undef HYPRE_BOX_REDUCTION
+#endif
+
+#if defined(HYPRE_USING_DEVICE_OPENMP)
+#define HYPRE_BOX_REDUCTION map(tofrom: box_sum) reduction(+:box_sum)
+#else
+#define HYPRE_BOX_REDUCTION reduction(+:box_sum)
+#endif
+
+#define DEVICE_VAR is_device_ptr(pp,sp,xp,rp)
+      hypre_BoxLoop2ReductionBegin(ndim, loop_size,
+                                   x_data_box, start, unit_stride, xi,
+                                   r_data_box, start, unit_stride, ri,
+                                   box_sum)
+      {
+         xp[xi] += alpha * pp[xi];
+         rp[ri] += neg_alpha * sp[ri];
+         HYPRE_Real tmp = rp[ri] * hypre_conj(rp[ri]);
+         box_sum += tmp;
+      }
+      hypre_BoxLoop2ReductionEnd(xi, ri, box_sum);
+#undef DEVICE_VAR
+
+      local_result += (HYPRE_Real) box_sum;
+   }
+
+   if (r_prod)
+   {
+      hypre_MPI_Allreduce(&local_result, r_prod, 1, HYPRE_MPI_REAL, hypre_MPI_SUM,
+                          hypre_StructVectorComm(r));
+
+      hypre_IncFLOPCount(2 * hypre_StructVectorGlobalSize(r));
+   }
+
+   return hypre_error_flag;
+}
@@ -43,6 +43,8 @@ FILES="\
  ${TNAME}.out.12\
  ${TNAME}.out.13\
  ${TNAME}.out.14\
+ ${TNAME}.out.15\
+ ${TNAME}.out.16\
 "
 #${TNAME}.out.10\
 
@@ -59,6 +61,40 @@ if [ "$OUTCOUNT" != "$RUNCOUNT" ]; then
    echo "Incorrect number of runs in ${TNAME}.out" >&2
 fi
 
+#=============================================================================
+# the parameters selected by the tuner depend on the timings, so only check
+# that it selected some and that the tuned solve converged
+#=============================================================================
+
+FILES="\
+ ${TNAME}.out.17\
+"
+
+for i in $FILES
+do
+  echo "# Output file: $i"
+  if grep -q "Selected after" $i; then echo "tuned"; else echo "not tuned"; fi
+  grep "Final Relative Residual Norm" $i | tail -1 | \
+     awk '{ if ($6 < 1.0e-8) print "converged"; else print "not converged" }'
+done > ${TNAME}.out.c
+
+#=============================================================================
+# the coarse grids of the block-partitioned first pass depend on the number of
+# threads, so only check that the solves converged
+#=============================================================================
+
+FILES="\
+ ${TNAME}.out.18\
+ ${TNAME}.out.19\
+"
+
+for i in $FILES
+do
+  echo "# Output file: $i"
+  grep "Final Relative Residual Norm" $i | tail -1 | \
+     awk '{ if ($6 < 1.0e-8) print "converged"; else print "not converged" }'
+done > ${TNAME}.out.d
+
 # put all of the output files together
 cat ${TNAME}.out.[a-z] > ${TNAME}.out
 
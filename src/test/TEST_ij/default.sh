@@ -25,6 +25,20 @@ diff ${TNAME}.testdata ${TNAME}.testdata.temp >&2
 tail -17 ${TNAME}.out.2 | head -6 > ${TNAME}.testdata.temp
 diff ${TNAME}.testdata ${TNAME}.testdata.temp >&2
 
+#=============================================================================
+
+tail -17 ${TNAME}.out.3 | head -6 > ${TNAME}.testdata.temp
+diff ${TNAME}.testdata ${TNAME}.testdata.temp >&2
+
+tail -17 ${TNAME}.out.4 | head -6 > ${TNAME}.testdata.temp
+diff ${TNAME}.testdata ${TNAME}.testdata.temp >&2
+
+tail -17 ${TNAME}.out.5 | head -6 > ${TNAME}.testdata.temp
+diff ${TNAME}.testdata ${TNAME}.testdata.temp >&2
+
+tail -17 ${TNAME}.out.6 | head -6 > ${TNAME}.testdata.temp
+diff ${TNAME}.testdata ${TNAME}.testdata.temp >&2
+
 #=============================================================================
 # compare with baseline case
 #=============================================================================
@@ -33,6 +47,10 @@ FILES="\
  ${TNAME}.out.0\
  ${TNAME}.out.1\
  ${TNAME}.out.2\
+ ${TNAME}.out.3\
+ ${TNAME}.out.4\
+ ${TNAME}.out.5\
+ ${TNAME}.out.6\
 "
 
 for i in $FILES
@@ -34,6 +34,8 @@ FILES="\
  ${TNAME}.out.18\
  ${TNAME}.out.19\
  ${TNAME}.out.20\
+ ${TNAME}.out.21\
+ ${TNAME}.out.22\
 "
 
 for i in $FILES
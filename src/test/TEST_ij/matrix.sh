@@ -42,6 +42,7 @@ FILES="\
  ${TNAME}.out.10\
  ${TNAME}.out.11\
  ${TNAME}.out.12\
+ ${TNAME}.out.13\
 "
 
 for i in $FILES
@@ -47,6 +47,9 @@ FILES="\
  ${TNAME}.out.22\
  ${TNAME}.out.23\
  ${TNAME}.out.24\
+ ${TNAME}.out.25\
+ ${TNAME}.out.26\
+ ${TNAME}.out.27\
 "
 
 for i in $FILES
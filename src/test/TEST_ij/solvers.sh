@@ -94,7 +94,9 @@ FILES="\
  ${TNAME}.out.21\
  ${TNAME}.out.22\
  ${TNAME}.out.23\
- ${TNAME}.out.24
+ ${TNAME}.out.24\
+ ${TNAME}.out.25\
+ ${TNAME}.out.26
 "
 
 for i in $FILES
@@ -145,6 +147,7 @@ FILES="\
  ${TNAME}.out.113\
  ${TNAME}.out.114\
  ${TNAME}.out.115\
+ ${TNAME}.out.124\
  ${TNAME}.out.116\
  ${TNAME}.out.117\
  ${TNAME}.out.118\
@@ -152,6 +155,7 @@ FILES="\
  ${TNAME}.out.121\
  ${TNAME}.out.122\
  ${TNAME}.out.120\
+ ${TNAME}.out.123\
 "
 
 for i in $FILES
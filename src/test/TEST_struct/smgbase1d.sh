@@ -9,11 +9,25 @@ RTOL=$1
 ATOL=$2
 
 #=============================================================================
-# struct: Test 1d run as 2d and 3d by diffing against each other.
+# struct: Test 1d run as 2d and 3d by diffing against each other.  The 2d run
+# on one box solves its lines with the Thomas algorithm and the 3d run uses
+# cyclic reduction, so the residuals are only compared to a tolerance.
 #=============================================================================
 
 tail -3 ${TNAME}.out.0 > ${TNAME}.testdata
 tail -3 ${TNAME}.out.1 > ${TNAME}.testdata.temp
+(../runcheck.sh ${TNAME}.testdata ${TNAME}.testdata.temp 0 1.e-12) >&2
+
+#=============================================================================
+# struct: Test the Thomas line solve against cyclic reduction.  The 2d lines
+# of out.2 cross box boundaries, so it solves the problem of out.0 with cyclic
+# reduction, and it must match the 3d run bit for bit.
+#=============================================================================
+
+tail -3 ${TNAME}.out.2 > ${TNAME}.testdata.temp
+(../runcheck.sh ${TNAME}.testdata ${TNAME}.testdata.temp 0 1.e-12) >&2
+
+tail -3 ${TNAME}.out.1 > ${TNAME}.testdata
 diff ${TNAME}.testdata ${TNAME}.testdata.temp  >&2
 
 #=============================================================================
@@ -23,6 +37,7 @@ diff ${TNAME}.testdata ${TNAME}.testdata.temp  >&2
 FILES="\
  ${TNAME}.out.0\
  ${TNAME}.out.1\
+ ${TNAME}.out.2\
 "
 
 for i in $FILES
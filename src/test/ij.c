@@ -111,6 +111,7 @@ main( hypre_int argc,
    HYPRE_Int           add = 0;
    HYPRE_Int           check_constant = 0;
    HYPRE_Int           off_proc = 0;
+   HYPRE_Int           update_plan = 0;
    HYPRE_Int           chunk = 0;
    HYPRE_Int           omp_flag = 0;
    HYPRE_Int           build_matrix_type;
@@ -187,6 +188,7 @@ main( hypre_int argc,
    HYPRE_Int           num_functions = 1;
    HYPRE_Int           num_paths = 1;
    HYPRE_Int           agg_num_levels = 0;
+   HYPRE_Int           sa_num_levels = 0;
    HYPRE_Int           ns_coarse = 1, ns_down = -1, ns_up = -1;
 
    HYPRE_Int           time_index;
@@ -220,6 +222,7 @@ main( hypre_int argc,
    HYPRE_Real     A_drop_tol = 0.0;
    HYPRE_Int      A_drop_type = -1;
    HYPRE_Int      coarsen_cut_factor = 0;
+   HYPRE_Int      coarsen_thread_blocks = 0;
    HYPRE_Real     strong_threshold;
    HYPRE_Real     strong_thresholdR;
    HYPRE_Real     filter_thresholdR;
@@ -232,6 +235,8 @@ main( hypre_int argc,
    HYPRE_Int      P_max_elmts = 4;
    HYPRE_Int      cycle_type;
    HYPRE_Int      fcycle;
+   HYPRE_Int      kcycle;
+   HYPRE_Int      kcycle_iter;
    HYPRE_Int      coarsen_type = 10;
    HYPRE_Int      measure_type = 0;
    HYPRE_Int      num_sweeps = 1;
@@ -260,6 +265,7 @@ main( hypre_int argc,
    HYPRE_Int    mult_add = -1;
    HYPRE_Int    simple = -1;
    HYPRE_Int    add_last_lvl = -1;
+   HYPRE_Int    add_composite = 0;
    HYPRE_Int    add_P_max_elmts = 0;
    HYPRE_Real   add_trunc_factor = 0;
    HYPRE_Int    rap2     = 0;
@@ -283,6 +289,22 @@ main( hypre_int argc,
    HYPRE_Int  cheby_eig_est = 10;
    HYPRE_Int  cheby_variant = 0;
    HYPRE_Int  cheby_scale = 1;
+   HYPRE_Int  cheby_mat_powers = 0;
+   HYPRE_Int  compress_indices = 0;
+   HYPRE_Int  persistent_comm = 0;
+   HYPRE_Int  merged_layout = 0;
+   HYPRE_Int  setup_timings = 0;
+   HYPRE_Real mem_budget = 0.0;
+   HYPRE_Int  amg_tune = 0;
+   HYPRE_Real amg_tune_budget = 0.0;
+   HYPRE_Int  amg_tune_solves = 1;
+   char      *amg_tune_file = NULL;
+   char      *amg_tune_read = NULL;
+   HYPRE_Int  node_aware_comm = 0;
+   HYPRE_Int  shared_mem_comm = 0;
+   HYPRE_Int  comm_progress = 0;
+   HYPRE_Int  mpi_thread_level = hypre_MPI_THREAD_FUNNELED;
+   HYPRE_Int  nthreads = 0;
    HYPRE_Real cheby_fraction = .3;
 
 #if defined(HYPRE_USING_GPU)
@@ -439,6 +461,7 @@ main( hypre_int argc,
 
    HYPRE_Real     *nongalerk_tol = NULL;
    HYPRE_Int       nongalerk_num_tol = 0;
+   HYPRE_Int       nongalerkin_rap = 0;
 
    /* coasening data */
    HYPRE_Int     num_cpt = 0;
@@ -526,7 +549,12 @@ main( hypre_int argc,
 #endif
 
    /* Initialize MPI */
+#ifdef HYPRE_USING_OPENMP
+   /* -comm_progress polls MPI from the master thread of parallel regions */
+   hypre_MPI_Init_thread(&argc, &argv, hypre_MPI_THREAD_FUNNELED, &mpi_thread_level);
+#else
    hypre_MPI_Init(&argc, &argv);
+#endif
 
    hypre_MPI_Comm_size(hypre_MPI_COMM_WORLD, &num_procs );
    hypre_MPI_Comm_rank(hypre_MPI_COMM_WORLD, &myid );
@@ -677,6 +705,11 @@ main( hypre_int argc,
          arg_index++;
          omp_flag = atoi(argv[arg_index++]);
       }
+      else if ( strcmp(argv[arg_index], "-update_plan") == 0 )
+      {
+         arg_index++;
+         update_plan = atoi(argv[arg_index++]);
+      }
       else if ( strcmp(argv[arg_index], "-check_constant") == 0 )
       {
          arg_index++;
@@ -990,6 +1023,11 @@ main( hypre_int argc,
          arg_index++;
          agg_num_levels = atoi(argv[arg_index++]);
       }
+      else if ( strcmp(argv[arg_index], "-sa_nl") == 0 )
+      {
+         arg_index++;
+         sa_num_levels = atoi(argv[arg_index++]);
+      }
       else if ( strcmp(argv[arg_index], "-npaths") == 0 )
       {
          arg_index++;
@@ -1428,6 +1466,8 @@ main( hypre_int argc,
       jacobi_trunc_threshold = 0.01;
       cycle_type = 1;
       fcycle = 0;
+      kcycle = 0;
+      kcycle_iter = 2;
       relax_wt = 1.;
       outer_wt = 1.;
 
@@ -1545,6 +1585,16 @@ main( hypre_int argc,
          arg_index++;
          coarsen_cut_factor = atoi(argv[arg_index++]);
       }
+      else if ( strcmp(argv[arg_index], "-cthrblk") == 0 )
+      {
+         arg_index++;
+         coarsen_thread_blocks = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-nthreads") == 0 )
+      {
+         arg_index++;
+         nthreads = atoi(argv[arg_index++]);
+      }
       else if ( strcmp(argv[arg_index], "-th") == 0 )
       {
          arg_index++;
@@ -1739,6 +1789,16 @@ main( hypre_int argc,
          arg_index++;
          fcycle  = 1;
       }
+      else if ( strcmp(argv[arg_index], "-kcycle") == 0 )
+      {
+         arg_index++;
+         kcycle  = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-kcycle_iter") == 0 )
+      {
+         arg_index++;
+         kcycle_iter  = atoi(argv[arg_index++]);
+      }
       else if ( strcmp(argv[arg_index], "-numsamp") == 0 )
       {
          arg_index++;
@@ -1819,6 +1879,11 @@ main( hypre_int argc,
          arg_index++;
          cheby_scale = atoi(argv[arg_index++]);
       }
+      else if ( strcmp(argv[arg_index], "-cheby_powers") == 0 )
+      {
+         arg_index++;
+         cheby_mat_powers = atoi(argv[arg_index++]);
+      }
       else if ( strcmp(argv[arg_index], "-cheby_fraction") == 0 )
       {
          arg_index++;
@@ -1844,6 +1909,11 @@ main( hypre_int argc,
          arg_index++;
          add_last_lvl  = atoi(argv[arg_index++]);
       }
+      else if ( strcmp(argv[arg_index], "-add_comp") == 0 )
+      {
+         arg_index++;
+         add_composite  = atoi(argv[arg_index++]);
+      }
       else if ( strcmp(argv[arg_index], "-add_Pmx") == 0 )
       {
          arg_index++;
@@ -1879,6 +1949,52 @@ main( hypre_int argc,
          arg_index++;
          keepTranspose  = atoi(argv[arg_index++]);
       }
+      else if ( strcmp(argv[arg_index], "-compress_j") == 0 )
+      {
+         arg_index++;
+         compress_indices = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-persistent_comm") == 0 )
+      {
+         arg_index++;
+         persistent_comm = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-merged_layout") == 0 )
+      {
+         arg_index++;
+         merged_layout = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-setup_timings") == 0 )
+      {
+         arg_index++;
+         setup_timings = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-mem_budget") == 0 )
+      {
+         arg_index++;
+         mem_budget = (HYPRE_Real)atof(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-amg_tune") == 0 )
+      {
+         arg_index++;
+         amg_tune = 1;
+         amg_tune_budget = (HYPRE_Real)atof(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-amg_tune_solves") == 0 )
+      {
+         arg_index++;
+         amg_tune_solves = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-amg_tune_file") == 0 )
+      {
+         arg_index++;
+         amg_tune_file = argv[arg_index++];
+      }
+      else if ( strcmp(argv[arg_index], "-amg_tune_read") == 0 )
+      {
+         arg_index++;
+         amg_tune_read = argv[arg_index++];
+      }
 #ifdef HYPRE_USING_DSUPERLU
       else if ( strcmp(argv[arg_index], "-dslu_th") == 0 )
       {
@@ -1896,6 +2012,26 @@ main( hypre_int argc,
             nongalerk_tol[i] = atof(argv[arg_index++]);
          }
       }
+      else if ( strcmp(argv[arg_index], "-nongalerk_rap") == 0 )
+      {
+         arg_index++;
+         nongalerkin_rap = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-node_comm") == 0 )
+      {
+         arg_index++;
+         node_aware_comm = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-shm_comm") == 0 )
+      {
+         arg_index++;
+         shared_mem_comm = 1;
+      }
+      else if ( strcmp(argv[arg_index], "-comm_progress") == 0 )
+      {
+         arg_index++;
+         comm_progress = atoi(argv[arg_index++]);
+      }
       else if ( strcmp(argv[arg_index], "-print") == 0 )
       {
          arg_index++;
@@ -2180,6 +2316,16 @@ main( hypre_int argc,
          hypre_printf("  -rlx_up      <val>       : set relaxation type for up cycle\n");
          hypre_printf("  -cheby_order  <val> : set order (1-4) for Chebyshev poly. smoother (default is 2)\n");
          hypre_printf("  -cheby_fraction <val> : fraction of the spectrum for Chebyshev poly. smoother (default is .3)\n");
+         hypre_printf("  -cheby_powers <val> : use a matrix powers kernel in the Chebyshev smoother (default is 0)\n");
+         hypre_printf("  -compress_j <val>   : use 16-bit diag column indices in the AMG solve phase (default is 0)\n");
+         hypre_printf("  -persistent_comm <val> : reuse persistent halo exchanges in the AMG solve phase (default is 0)\n");
+         hypre_printf("  -merged_layout <val> : merge diag and offd blocks for the AMG solve phase (default is 0)\n");
+         hypre_printf("  -setup_timings <val> : print per-phase AMG setup times (default is 0)\n");
+         hypre_printf("  -mem_budget <MB>     : memory budget per process for the AMG hierarchy (default is 0)\n");
+         hypre_printf("  -amg_tune <sec>      : tune AMG parameters within a time budget (0 = no limit)\n");
+         hypre_printf("  -amg_tune_solves <n> : number of solves the tuned setup is used for (default is 1)\n");
+         hypre_printf("  -amg_tune_file <fn>  : write the tuned AMG parameters to file fn\n");
+         hypre_printf("  -amg_tune_read <fn>  : read tuned AMG parameters from file fn\n");
          hypre_printf("  -nodal  <val>            : nodal system type\n");
          hypre_printf("       0 = Unknown approach \n");
          hypre_printf("       1 = Frobenius norm  \n");
@@ -2200,7 +2346,11 @@ main( hypre_int argc,
          hypre_printf("  -ns_up      <val>       : set no. of sweeps for up cycle\n");
          hypre_printf("\n");
          hypre_printf("  -mu   <val>            : set AMG cycles (1=V, 2=W, etc.)\n");
+         hypre_printf("  -kcycle <val>          : use a K-cycle on the first val coarse levels\n");
+         hypre_printf("  -kcycle_iter <val>     : max. number of inner K-cycle iterations (2)\n");
          hypre_printf("  -cutf <val>            : set coarsening cut factor for dense rows\n");
+         hypre_printf("  -cthrblk <val>         : 1 = first coarsening pass on one row block per thread\n");
+         hypre_printf("  -nthreads <val>        : number of OpenMP threads (default: OMP_NUM_THREADS)\n");
          hypre_printf("  -th   <val>            : set AMG threshold Theta = val \n");
          hypre_printf("  -tr   <val>            : set AMG interpolation truncation factor = val \n");
          hypre_printf("  -Pmx  <val>            : set maximal no. of elmts per row for AMG interpolation (default: 4)\n");
@@ -2228,6 +2378,7 @@ main( hypre_int argc,
          hypre_printf("  -max_iter  <val>       : set max iterations\n");
          hypre_printf("  -mg_max_iter  <val>    : set max iterations for mg solvers\n");
          hypre_printf("  -agg_nl  <val>         : set number of aggressive coarsening levels (default:0)\n");
+         hypre_printf("  -sa_nl  <val>          : set number of smoothed aggregation levels (default:0)\n");
          hypre_printf("  -np  <val>             : set number of paths of length 2 for aggr. coarsening\n");
          hypre_printf("\n");
          hypre_printf("  -sai_th   <val>        : set ParaSAILS threshold = val \n");
@@ -2250,6 +2401,12 @@ main( hypre_int argc,
          hypre_printf("  -dbg <val>             : set debug flag\n");
          hypre_printf("       0=no debugging\n       1=internal timing\n       2=interpolation truncation\n       3=more detailed timing in coarsening routine\n");
          hypre_printf("\n");
+         hypre_printf("  -node_comm <val>       : node-aware halo exchanges, through one leader\n");
+         hypre_printf("                           per node (1) or per <val> ranks (default 0)\n");
+         hypre_printf("  -shm_comm              : on-node halo values through MPI shared memory\n");
+         hypre_printf("  -comm_progress <val>   : poll pending halo exchanges every <val> rows\n");
+         hypre_printf("                           of the local matvec (default 0, no polling)\n");
+         hypre_printf("\n");
          hypre_printf("  -print                 : print out the system\n");
          hypre_printf("\n");
          /* begin lobpcg */
@@ -2328,6 +2485,7 @@ main( hypre_int argc,
          hypre_printf("  -nongalerk_tol <val> <list>    : specify the NonGalerkin drop tolerance\n");
          hypre_printf("                                   and list contains the values, where last value\n");
          hypre_printf("                                   in list is repeated if val < num_levels in AMG\n");
+         hypre_printf("  -nongalerk_rap <val>           : 1 = sparsify inside the RAP kernel\n");
 
          /* MGR options */
          hypre_printf("  -mgr_bsize   <val>               : set block size = val\n");
@@ -2462,6 +2620,19 @@ main( hypre_int argc,
    /* default execution policy */
    HYPRE_SetExecutionPolicy(default_exec_policy);
 
+   /* node-aware communication */
+   HYPRE_SetNodeAwareComm(node_aware_comm);
+   HYPRE_SetSharedMemComm(shared_mem_comm);
+   HYPRE_SetCommProgress(comm_progress);
+   if (nthreads > 0)
+   {
+      hypre_SetNumThreads(nthreads);
+   }
+   if (comm_progress > 0 && mpi_thread_level < hypre_MPI_THREAD_FUNNELED && myid == 0)
+   {
+      hypre_printf("Warning: MPI_THREAD_FUNNELED is not available, -comm_progress is ignored\n");
+   }
+
 #if defined(HYPRE_USING_GPU)
    ierr = HYPRE_SetSpMVUseVendor(spmv_use_vendor); hypre_assert(ierr == 0);
    /* use vendor implementation for SpGEMM */
@@ -2807,10 +2978,6 @@ main( hypre_int argc,
             j_indx += num_cols_h[i];
          }
       }
-      hypre_TFree(num_cols_h, HYPRE_MEMORY_HOST);
-      hypre_TFree(row_nums_h, HYPRE_MEMORY_HOST);
-      hypre_TFree(col_nums_h, HYPRE_MEMORY_HOST);
-      hypre_TFree(data_h,     HYPRE_MEMORY_HOST);
       if (hypre_GetActualMemLocation(memory_location) != hypre_MEMORY_HOST)
       {
          hypre_TFree(col_nums, memory_location);
@@ -2831,6 +2998,22 @@ main( hypre_int argc,
 
       ierr += HYPRE_IJMatrixAssemble( ij_A );
 
+      /* Refill the assembled matrix through an update plan.  Contributions
+         to the same entry are summed, so this reproduces the matrix built
+         with -add 1 */
+      if (update_plan && hypre_GetActualMemLocation(memory_location) == hypre_MEMORY_HOST)
+      {
+         ierr += HYPRE_IJMatrixSetConstantValues( ij_A, 0.0 );
+         ierr += HYPRE_IJMatrixSetUpdatePattern( ij_A, num_rows, num_cols_h, row_nums_h,
+                                                 (const HYPRE_BigInt *) col_nums_h );
+         ierr += HYPRE_IJMatrixUpdateValues( ij_A, 0, (const HYPRE_Real *) data_h );
+      }
+
+      hypre_TFree(num_cols_h, HYPRE_MEMORY_HOST);
+      hypre_TFree(row_nums_h, HYPRE_MEMORY_HOST);
+      hypre_TFree(col_nums_h, HYPRE_MEMORY_HOST);
+      hypre_TFree(data_h,     HYPRE_MEMORY_HOST);
+
       hypre_EndTiming(time_index);
       hypre_PrintTiming("IJ Matrix Setup", hypre_MPI_COMM_WORLD);
       hypre_FinalizeTiming(time_index);
@@ -3960,6 +4143,7 @@ main( hypre_int argc,
       HYPRE_BoomerAMGSetNumSamples(amg_solver, gsmg_samples);
       HYPRE_BoomerAMGSetCoarsenType(amg_solver, coarsen_type);
       HYPRE_BoomerAMGSetCoarsenCutFactor(amg_solver, coarsen_cut_factor);
+      HYPRE_BoomerAMGSetCoarsenThreadBlocks(amg_solver, coarsen_thread_blocks);
       HYPRE_BoomerAMGSetCPoints(amg_solver, max_levels, num_cpt, cpt_index);
       HYPRE_BoomerAMGSetFPoints(amg_solver, num_fpt, fpt_index);
       HYPRE_BoomerAMGSetIsolatedFPoints(amg_solver, num_isolated_fpt, isolated_fpt_index);
@@ -3981,6 +4165,8 @@ main( hypre_int argc,
       HYPRE_BoomerAMGSetPrintFileName(amg_solver, "driver.out.log");
       HYPRE_BoomerAMGSetCycleType(amg_solver, cycle_type);
       HYPRE_BoomerAMGSetFCycle(amg_solver, fcycle);
+      HYPRE_BoomerAMGSetKCycle(amg_solver, kcycle);
+      HYPRE_BoomerAMGSetKCycleNumIter(amg_solver, kcycle_iter);
       HYPRE_BoomerAMGSetNumSweeps(amg_solver, num_sweeps);
       HYPRE_BoomerAMGSetISType(amg_solver, IS_type);
       HYPRE_BoomerAMGSetNumCRRelaxSteps(amg_solver, num_CR_relax_steps);
@@ -4007,6 +4193,7 @@ main( hypre_int argc,
       HYPRE_BoomerAMGSetChebyEigEst(amg_solver, cheby_eig_est);
       HYPRE_BoomerAMGSetChebyVariant(amg_solver, cheby_variant);
       HYPRE_BoomerAMGSetChebyScale(amg_solver, cheby_scale);
+      HYPRE_BoomerAMGSetChebyMatPowers(amg_solver, cheby_mat_powers);
       HYPRE_BoomerAMGSetRelaxOrder(amg_solver, relax_order);
       HYPRE_BoomerAMGSetRelaxWt(amg_solver, relax_wt);
       HYPRE_BoomerAMGSetOuterWt(amg_solver, outer_wt);
@@ -4046,6 +4233,8 @@ main( hypre_int argc,
 
       HYPRE_BoomerAMGSetNumFunctions(amg_solver, num_functions);
       HYPRE_BoomerAMGSetAggNumLevels(amg_solver, agg_num_levels);
+      HYPRE_BoomerAMGSetMemoryBudget(amg_solver, mem_budget);
+      HYPRE_BoomerAMGSetSmoothAggNumLevels(amg_solver, sa_num_levels);
       HYPRE_BoomerAMGSetAggInterpType(amg_solver, agg_interp_type);
       HYPRE_BoomerAMGSetAggTruncFactor(amg_solver, agg_trunc_factor);
       HYPRE_BoomerAMGSetAggP12TruncFactor(amg_solver, agg_P12_trunc_factor);
@@ -4072,6 +4261,7 @@ main( hypre_int argc,
       HYPRE_BoomerAMGSetMultAdditive(amg_solver, mult_add);
       HYPRE_BoomerAMGSetSimple(amg_solver, simple);
       HYPRE_BoomerAMGSetAddLastLvl(amg_solver, add_last_lvl);
+      HYPRE_BoomerAMGSetAddComposite(amg_solver, add_composite);
       HYPRE_BoomerAMGSetMultAddPMaxElmts(amg_solver, add_P_max_elmts);
       HYPRE_BoomerAMGSetMultAddTruncFactor(amg_solver, add_trunc_factor);
 
@@ -4079,6 +4269,10 @@ main( hypre_int argc,
       HYPRE_BoomerAMGSetRAP2(amg_solver, rap2);
       HYPRE_BoomerAMGSetModuleRAP2(amg_solver, mod_rap2);
       HYPRE_BoomerAMGSetKeepTranspose(amg_solver, keepTranspose);
+      HYPRE_BoomerAMGSetCompressIndices(amg_solver, compress_indices);
+      HYPRE_BoomerAMGSetPersistentComm(amg_solver, persistent_comm);
+      HYPRE_BoomerAMGSetMergedLayout(amg_solver, merged_layout);
+      HYPRE_BoomerAMGSetSetupTimings(amg_solver, setup_timings);
 #ifdef HYPRE_USING_DSUPERLU
       HYPRE_BoomerAMGSetDSLUThreshold(amg_solver, dslu_threshold);
 #endif
@@ -4086,6 +4280,7 @@ main( hypre_int argc,
       if (nongalerk_tol)
       {
          HYPRE_BoomerAMGSetNonGalerkinTol(amg_solver, nongalerk_tol[nongalerk_num_tol - 1]);
+         HYPRE_BoomerAMGSetNonGalerkinRAP(amg_solver, nongalerkin_rap);
          for (i = 0; i < nongalerk_num_tol - 1; i++)
          {
             HYPRE_BoomerAMGSetLevelNonGalerkinTol(amg_solver, nongalerk_tol[i], i);
@@ -4098,6 +4293,15 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetInterpVecQMax(amg_solver, Q_max);
          HYPRE_BoomerAMGSetInterpVecAbsQTrunc(amg_solver, Q_trunc);
       }
+      if (amg_tune_read)
+      {
+         HYPRE_BoomerAMGReadTunedParams(amg_solver, amg_tune_read);
+      }
+      if (amg_tune && solver_id == 0)
+      {
+         HYPRE_BoomerAMGTune(amg_solver, parcsr_M, amg_tune_budget, amg_tune_solves,
+                             amg_tune_file);
+      }
 
       /* BM Oct 23, 2006 */
       if (plot_grids)
@@ -4290,6 +4494,7 @@ main( hypre_int argc,
       HYPRE_BoomerAMGSetNumSamples(amg_solver, gsmg_samples);
       HYPRE_BoomerAMGSetCoarsenType(amg_solver, coarsen_type);
       HYPRE_BoomerAMGSetCoarsenCutFactor(amg_solver, coarsen_cut_factor);
+      HYPRE_BoomerAMGSetCoarsenThreadBlocks(amg_solver, coarsen_thread_blocks);
       HYPRE_BoomerAMGSetCPoints(amg_solver, max_levels, num_cpt, cpt_index);
       HYPRE_BoomerAMGSetFPoints(amg_solver, num_fpt, fpt_index);
       HYPRE_BoomerAMGSetIsolatedFPoints(amg_solver, num_isolated_fpt, isolated_fpt_index);
@@ -4310,6 +4515,8 @@ main( hypre_int argc,
       HYPRE_BoomerAMGSetMaxIter(amg_solver, mg_max_iter);
       HYPRE_BoomerAMGSetCycleType(amg_solver, cycle_type);
       HYPRE_BoomerAMGSetFCycle(amg_solver, fcycle);
+      HYPRE_BoomerAMGSetKCycle(amg_solver, kcycle);
+      HYPRE_BoomerAMGSetKCycleNumIter(amg_solver, kcycle_iter);
       HYPRE_BoomerAMGSetNumSweeps(amg_solver, num_sweeps);
       if (relax_type > -1) { HYPRE_BoomerAMGSetRelaxType(amg_solver, relax_type); }
       if (relax_down > -1)
@@ -4331,6 +4538,7 @@ main( hypre_int argc,
       HYPRE_BoomerAMGSetChebyEigEst(amg_solver, cheby_eig_est);
       HYPRE_BoomerAMGSetChebyVariant(amg_solver, cheby_variant);
       HYPRE_BoomerAMGSetChebyScale(amg_solver, cheby_scale);
+      HYPRE_BoomerAMGSetChebyMatPowers(amg_solver, cheby_mat_powers);
       HYPRE_BoomerAMGSetRelaxOrder(amg_solver, relax_order);
       HYPRE_BoomerAMGSetRelaxWt(amg_solver, relax_wt);
       HYPRE_BoomerAMGSetOuterWt(amg_solver, outer_wt);
@@ -4363,6 +4571,8 @@ main( hypre_int argc,
       HYPRE_BoomerAMGSetFSAIKapTolerance(amg_solver, fsai_kap_tolerance);
       HYPRE_BoomerAMGSetNumFunctions(amg_solver, num_functions);
       HYPRE_BoomerAMGSetAggNumLevels(amg_solver, agg_num_levels);
+      HYPRE_BoomerAMGSetMemoryBudget(amg_solver, mem_budget);
+      HYPRE_BoomerAMGSetSmoothAggNumLevels(amg_solver, sa_num_levels);
       HYPRE_BoomerAMGSetAggInterpType(amg_solver, agg_interp_type);
       HYPRE_BoomerAMGSetAggTruncFactor(amg_solver, agg_trunc_factor);
       HYPRE_BoomerAMGSetAggP12TruncFactor(amg_solver, agg_P12_trunc_factor);
@@ -4379,14 +4589,20 @@ main( hypre_int argc,
       HYPRE_BoomerAMGSetMultAdditive(amg_solver, mult_add);
       HYPRE_BoomerAMGSetSimple(amg_solver, simple);
       HYPRE_BoomerAMGSetAddLastLvl(amg_solver, add_last_lvl);
+      HYPRE_BoomerAMGSetAddComposite(amg_solver, add_composite);
       HYPRE_BoomerAMGSetMultAddPMaxElmts(amg_solver, add_P_max_elmts);
       HYPRE_BoomerAMGSetMultAddTruncFactor(amg_solver, add_trunc_factor);
       HYPRE_BoomerAMGSetRAP2(amg_solver, rap2);
       HYPRE_BoomerAMGSetModuleRAP2(amg_solver, mod_rap2);
       HYPRE_BoomerAMGSetKeepTranspose(amg_solver, keepTranspose);
+      HYPRE_BoomerAMGSetCompressIndices(amg_solver, compress_indices);
+      HYPRE_BoomerAMGSetPersistentComm(amg_solver, persistent_comm);
+      HYPRE_BoomerAMGSetMergedLayout(amg_solver, merged_layout);
+      HYPRE_BoomerAMGSetSetupTimings(amg_solver, setup_timings);
       if (nongalerk_tol)
       {
          HYPRE_BoomerAMGSetNonGalerkinTol(amg_solver, nongalerk_tol[nongalerk_num_tol - 1]);
+         HYPRE_BoomerAMGSetNonGalerkinRAP(amg_solver, nongalerkin_rap);
          for (i = 0; i < nongalerk_num_tol - 1; i++)
          {
             HYPRE_BoomerAMGSetLevelNonGalerkinTol(amg_solver, nongalerk_tol[i], i);
@@ -4486,6 +4702,7 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetTol(pcg_precond, pc_tol);
          HYPRE_BoomerAMGSetCoarsenType(pcg_precond, coarsen_type);
          HYPRE_BoomerAMGSetCoarsenCutFactor(pcg_precond, coarsen_cut_factor);
+         HYPRE_BoomerAMGSetCoarsenThreadBlocks(pcg_precond, coarsen_thread_blocks);
          HYPRE_BoomerAMGSetMeasureType(pcg_precond, measure_type);
          HYPRE_BoomerAMGSetCPoints(pcg_precond, max_levels, num_cpt, cpt_index);
          HYPRE_BoomerAMGSetFPoints(pcg_precond, num_fpt, fpt_index);
@@ -4504,6 +4721,8 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetMaxIter(pcg_precond, precon_cycles);
          HYPRE_BoomerAMGSetCycleType(pcg_precond, cycle_type);
          HYPRE_BoomerAMGSetFCycle(pcg_precond, fcycle);
+         HYPRE_BoomerAMGSetKCycle(pcg_precond, kcycle);
+         HYPRE_BoomerAMGSetKCycleNumIter(pcg_precond, kcycle_iter);
          HYPRE_BoomerAMGSetNumSweeps(pcg_precond, num_sweeps);
          HYPRE_BoomerAMGSetISType(pcg_precond, IS_type);
          HYPRE_BoomerAMGSetNumCRRelaxSteps(pcg_precond, num_CR_relax_steps);
@@ -4530,6 +4749,7 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetChebyEigEst(pcg_precond, cheby_eig_est);
          HYPRE_BoomerAMGSetChebyVariant(pcg_precond, cheby_variant);
          HYPRE_BoomerAMGSetChebyScale(pcg_precond, cheby_scale);
+         HYPRE_BoomerAMGSetChebyMatPowers(pcg_precond, cheby_mat_powers);
          HYPRE_BoomerAMGSetRelaxOrder(pcg_precond, relax_order);
          HYPRE_BoomerAMGSetRelaxWt(pcg_precond, relax_wt);
          HYPRE_BoomerAMGSetOuterWt(pcg_precond, outer_wt);
@@ -4549,6 +4769,8 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetDebugFlag(pcg_precond, debug_flag);
          HYPRE_BoomerAMGSetNumFunctions(pcg_precond, num_functions);
          HYPRE_BoomerAMGSetAggNumLevels(pcg_precond, agg_num_levels);
+         HYPRE_BoomerAMGSetMemoryBudget(pcg_precond, mem_budget);
+         HYPRE_BoomerAMGSetSmoothAggNumLevels(pcg_precond, sa_num_levels);
          HYPRE_BoomerAMGSetAggInterpType(pcg_precond, agg_interp_type);
          HYPRE_BoomerAMGSetAggTruncFactor(pcg_precond, agg_trunc_factor);
          HYPRE_BoomerAMGSetAggP12TruncFactor(pcg_precond, agg_P12_trunc_factor);
@@ -4580,17 +4802,23 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetMultAdditive(pcg_precond, mult_add);
          HYPRE_BoomerAMGSetSimple(pcg_precond, simple);
          HYPRE_BoomerAMGSetAddLastLvl(pcg_precond, add_last_lvl);
+         HYPRE_BoomerAMGSetAddComposite(pcg_precond, add_composite);
          HYPRE_BoomerAMGSetMultAddPMaxElmts(pcg_precond, add_P_max_elmts);
          HYPRE_BoomerAMGSetMultAddTruncFactor(pcg_precond, add_trunc_factor);
          HYPRE_BoomerAMGSetRAP2(pcg_precond, rap2);
          HYPRE_BoomerAMGSetModuleRAP2(pcg_precond, mod_rap2);
          HYPRE_BoomerAMGSetKeepTranspose(pcg_precond, keepTranspose);
+         HYPRE_BoomerAMGSetCompressIndices(pcg_precond, compress_indices);
+         HYPRE_BoomerAMGSetPersistentComm(pcg_precond, persistent_comm);
+         HYPRE_BoomerAMGSetMergedLayout(pcg_precond, merged_layout);
+         HYPRE_BoomerAMGSetSetupTimings(pcg_precond, setup_timings);
 #ifdef HYPRE_USING_DSUPERLU
          HYPRE_BoomerAMGSetDSLUThreshold(pcg_precond, dslu_threshold);
 #endif
          if (nongalerk_tol)
          {
             HYPRE_BoomerAMGSetNonGalerkinTol(pcg_precond, nongalerk_tol[nongalerk_num_tol - 1]);
+            HYPRE_BoomerAMGSetNonGalerkinRAP(pcg_precond, nongalerkin_rap);
             for (i = 0; i < nongalerk_num_tol - 1; i++)
             {
                HYPRE_BoomerAMGSetLevelNonGalerkinTol(pcg_precond, nongalerk_tol[i], i);
@@ -4603,6 +4831,15 @@ main( hypre_int argc,
             HYPRE_BoomerAMGSetInterpVecQMax(pcg_precond, Q_max);
             HYPRE_BoomerAMGSetInterpVecAbsQTrunc(pcg_precond, Q_trunc);
          }
+         if (amg_tune_read)
+         {
+            HYPRE_BoomerAMGReadTunedParams(pcg_precond, amg_tune_read);
+         }
+         if (amg_tune)
+         {
+            HYPRE_BoomerAMGTune(pcg_precond, parcsr_M, amg_tune_budget, amg_tune_solves,
+                                amg_tune_file);
+         }
          HYPRE_PCGSetMaxIter(pcg_solver, mg_max_iter);
          HYPRE_PCGSetPrecond(pcg_solver,
                              (HYPRE_PtrToSolverFcn) HYPRE_BoomerAMGSolve,
@@ -4672,6 +4909,7 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetTol(pcg_precond, pc_tol);
          HYPRE_BoomerAMGSetCoarsenType(pcg_precond, coarsen_type);
          HYPRE_BoomerAMGSetCoarsenCutFactor(pcg_precond, coarsen_cut_factor);
+         HYPRE_BoomerAMGSetCoarsenThreadBlocks(pcg_precond, coarsen_thread_blocks);
          HYPRE_BoomerAMGSetMeasureType(pcg_precond, measure_type);
          HYPRE_BoomerAMGSetCPoints(pcg_precond, max_levels, num_cpt, cpt_index);
          HYPRE_BoomerAMGSetFPoints(pcg_precond, num_fpt, fpt_index);
@@ -4690,6 +4928,8 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetMaxIter(pcg_precond, precon_cycles);
          HYPRE_BoomerAMGSetCycleType(pcg_precond, cycle_type);
          HYPRE_BoomerAMGSetFCycle(pcg_precond, fcycle);
+         HYPRE_BoomerAMGSetKCycle(pcg_precond, kcycle);
+         HYPRE_BoomerAMGSetKCycleNumIter(pcg_precond, kcycle_iter);
          HYPRE_BoomerAMGSetNumSweeps(pcg_precond, num_sweeps);
          HYPRE_BoomerAMGSetISType(pcg_precond, IS_type);
          HYPRE_BoomerAMGSetNumCRRelaxSteps(pcg_precond, num_CR_relax_steps);
@@ -4717,6 +4957,7 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetChebyEigEst(pcg_precond, cheby_eig_est);
          HYPRE_BoomerAMGSetChebyVariant(pcg_precond, cheby_variant);
          HYPRE_BoomerAMGSetChebyScale(pcg_precond, cheby_scale);
+         HYPRE_BoomerAMGSetChebyMatPowers(pcg_precond, cheby_mat_powers);
          HYPRE_BoomerAMGSetRelaxWt(pcg_precond, relax_wt);
          HYPRE_BoomerAMGSetOuterWt(pcg_precond, outer_wt);
          if (level_w > -1)
@@ -4747,6 +4988,8 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetDebugFlag(pcg_precond, debug_flag);
          HYPRE_BoomerAMGSetNumFunctions(pcg_precond, num_functions);
          HYPRE_BoomerAMGSetAggNumLevels(pcg_precond, agg_num_levels);
+         HYPRE_BoomerAMGSetMemoryBudget(pcg_precond, mem_budget);
+         HYPRE_BoomerAMGSetSmoothAggNumLevels(pcg_precond, sa_num_levels);
          HYPRE_BoomerAMGSetAggInterpType(pcg_precond, agg_interp_type);
          HYPRE_BoomerAMGSetAggTruncFactor(pcg_precond, agg_trunc_factor);
          HYPRE_BoomerAMGSetAggP12TruncFactor(pcg_precond, agg_P12_trunc_factor);
@@ -4764,17 +5007,23 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetMultAdditive(pcg_precond, mult_add);
          HYPRE_BoomerAMGSetSimple(pcg_precond, simple);
          HYPRE_BoomerAMGSetAddLastLvl(pcg_precond, add_last_lvl);
+         HYPRE_BoomerAMGSetAddComposite(pcg_precond, add_composite);
          HYPRE_BoomerAMGSetMultAddPMaxElmts(pcg_precond, add_P_max_elmts);
          HYPRE_BoomerAMGSetMultAddTruncFactor(pcg_precond, add_trunc_factor);
          HYPRE_BoomerAMGSetRAP2(pcg_precond, rap2);
          HYPRE_BoomerAMGSetModuleRAP2(pcg_precond, mod_rap2);
          HYPRE_BoomerAMGSetKeepTranspose(pcg_precond, keepTranspose);
+         HYPRE_BoomerAMGSetCompressIndices(pcg_precond, compress_indices);
+         HYPRE_BoomerAMGSetPersistentComm(pcg_precond, persistent_comm);
+         HYPRE_BoomerAMGSetMergedLayout(pcg_precond, merged_layout);
+         HYPRE_BoomerAMGSetSetupTimings(pcg_precond, setup_timings);
 #ifdef HYPRE_USING_DSUPERLU
          HYPRE_BoomerAMGSetDSLUThreshold(pcg_precond, dslu_threshold);
 #endif
          if (nongalerk_tol)
          {
             HYPRE_BoomerAMGSetNonGalerkinTol(pcg_precond, nongalerk_tol[nongalerk_num_tol - 1]);
+            HYPRE_BoomerAMGSetNonGalerkinRAP(pcg_precond, nongalerkin_rap);
             for (i = 0; i < nongalerk_num_tol - 1; i++)
             {
                HYPRE_BoomerAMGSetLevelNonGalerkinTol(pcg_precond, nongalerk_tol[i], i);
@@ -4907,6 +5156,8 @@ main( hypre_int argc,
             HYPRE_BoomerAMGSetCoarsenType(amg_solver, 6);
             HYPRE_BoomerAMGSetCycleType(amg_solver, cycle_type);
             HYPRE_BoomerAMGSetFCycle(amg_solver, fcycle);
+            HYPRE_BoomerAMGSetKCycle(amg_solver, kcycle);
+            HYPRE_BoomerAMGSetKCycleNumIter(amg_solver, kcycle_iter);
             HYPRE_BoomerAMGSetRelaxType(amg_solver, 3);
             if (relax_down > -1)
             {
@@ -5269,6 +5520,7 @@ main( hypre_int argc,
             HYPRE_BoomerAMGSetTol(pcg_precond, pc_tol);
             HYPRE_BoomerAMGSetCoarsenType(pcg_precond, (hybrid * coarsen_type));
             HYPRE_BoomerAMGSetCoarsenCutFactor(pcg_precond, coarsen_cut_factor);
+            HYPRE_BoomerAMGSetCoarsenThreadBlocks(pcg_precond, coarsen_thread_blocks);
             HYPRE_BoomerAMGSetCPoints(pcg_precond, max_levels, num_cpt, cpt_index);
             HYPRE_BoomerAMGSetFPoints(pcg_precond, num_fpt, fpt_index);
             HYPRE_BoomerAMGSetIsolatedFPoints(pcg_precond, num_isolated_fpt, isolated_fpt_index);
@@ -5283,6 +5535,8 @@ main( hypre_int argc,
             HYPRE_BoomerAMGSetMaxIter(pcg_precond, precon_cycles);
             HYPRE_BoomerAMGSetCycleType(pcg_precond, cycle_type);
             HYPRE_BoomerAMGSetFCycle(pcg_precond, fcycle);
+            HYPRE_BoomerAMGSetKCycle(pcg_precond, kcycle);
+            HYPRE_BoomerAMGSetKCycleNumIter(pcg_precond, kcycle_iter);
             HYPRE_BoomerAMGSetNumSweeps(pcg_precond, num_sweeps);
             if (relax_type > -1) { HYPRE_BoomerAMGSetRelaxType(pcg_precond, relax_type); }
             if (relax_down > -1)
@@ -5311,6 +5565,8 @@ main( hypre_int argc,
             HYPRE_BoomerAMGSetNumFunctions(pcg_precond, num_functions);
             HYPRE_BoomerAMGSetNumPaths(pcg_precond, num_paths);
             HYPRE_BoomerAMGSetAggNumLevels(pcg_precond, agg_num_levels);
+            HYPRE_BoomerAMGSetMemoryBudget(pcg_precond, mem_budget);
+            HYPRE_BoomerAMGSetSmoothAggNumLevels(pcg_precond, sa_num_levels);
             HYPRE_BoomerAMGSetVariant(pcg_precond, variant);
             HYPRE_BoomerAMGSetOverlap(pcg_precond, overlap);
             HYPRE_BoomerAMGSetDomainType(pcg_precond, domain_type);
@@ -5386,6 +5642,7 @@ main( hypre_int argc,
             HYPRE_BoomerAMGSetTol(pcg_precond, pc_tol);
             HYPRE_BoomerAMGSetCoarsenType(pcg_precond, (hybrid * coarsen_type));
             HYPRE_BoomerAMGSetCoarsenCutFactor(pcg_precond, coarsen_cut_factor);
+            HYPRE_BoomerAMGSetCoarsenThreadBlocks(pcg_precond, coarsen_thread_blocks);
             HYPRE_BoomerAMGSetCPoints(pcg_precond, max_levels, num_cpt, cpt_index);
             HYPRE_BoomerAMGSetFPoints(pcg_precond, num_fpt, fpt_index);
             HYPRE_BoomerAMGSetIsolatedFPoints(pcg_precond, num_isolated_fpt, isolated_fpt_index);
@@ -5400,6 +5657,8 @@ main( hypre_int argc,
             HYPRE_BoomerAMGSetMaxIter(pcg_precond, precon_cycles);
             HYPRE_BoomerAMGSetCycleType(pcg_precond, cycle_type);
             HYPRE_BoomerAMGSetFCycle(pcg_precond, fcycle);
+            HYPRE_BoomerAMGSetKCycle(pcg_precond, kcycle);
+            HYPRE_BoomerAMGSetKCycleNumIter(pcg_precond, kcycle_iter);
             HYPRE_BoomerAMGSetNumSweeps(pcg_precond, num_sweeps);
             HYPRE_BoomerAMGSetRelaxType(pcg_precond, relax_type);
             HYPRE_BoomerAMGSetRelaxWt(pcg_precond, relax_wt);
@@ -5420,6 +5679,8 @@ main( hypre_int argc,
             HYPRE_BoomerAMGSetNumFunctions(pcg_precond, num_functions);
             HYPRE_BoomerAMGSetNumPaths(pcg_precond, num_paths);
             HYPRE_BoomerAMGSetAggNumLevels(pcg_precond, agg_num_levels);
+            HYPRE_BoomerAMGSetMemoryBudget(pcg_precond, mem_budget);
+            HYPRE_BoomerAMGSetSmoothAggNumLevels(pcg_precond, sa_num_levels);
             if (num_functions > 1)
             {
                HYPRE_BoomerAMGSetDofFunc(pcg_precond, dof_func);
@@ -5695,6 +5956,7 @@ main( hypre_int argc,
             HYPRE_BoomerAMGSetTol(pcg_precond, pc_tol);
             HYPRE_BoomerAMGSetCoarsenType(pcg_precond, (hybrid * coarsen_type));
             HYPRE_BoomerAMGSetCoarsenCutFactor(pcg_precond, coarsen_cut_factor);
+            HYPRE_BoomerAMGSetCoarsenThreadBlocks(pcg_precond, coarsen_thread_blocks);
             HYPRE_BoomerAMGSetCPoints(pcg_precond, max_levels, num_cpt, cpt_index);
             HYPRE_BoomerAMGSetFPoints(pcg_precond, num_fpt, fpt_index);
             HYPRE_BoomerAMGSetIsolatedFPoints(pcg_precond, num_isolated_fpt, isolated_fpt_index);
@@ -5709,6 +5971,8 @@ main( hypre_int argc,
             HYPRE_BoomerAMGSetMaxIter(pcg_precond, precon_cycles);
             HYPRE_BoomerAMGSetCycleType(pcg_precond, cycle_type);
             HYPRE_BoomerAMGSetFCycle(pcg_precond, fcycle);
+            HYPRE_BoomerAMGSetKCycle(pcg_precond, kcycle);
+            HYPRE_BoomerAMGSetKCycleNumIter(pcg_precond, kcycle_iter);
             HYPRE_BoomerAMGSetNumSweeps(pcg_precond, num_sweeps);
             if (relax_type > -1) { HYPRE_BoomerAMGSetRelaxType(pcg_precond, relax_type); }
             if (relax_down > -1)
@@ -5737,6 +6001,8 @@ main( hypre_int argc,
             HYPRE_BoomerAMGSetNumFunctions(pcg_precond, num_functions);
             HYPRE_BoomerAMGSetNumPaths(pcg_precond, num_paths);
             HYPRE_BoomerAMGSetAggNumLevels(pcg_precond, agg_num_levels);
+            HYPRE_BoomerAMGSetMemoryBudget(pcg_precond, mem_budget);
+            HYPRE_BoomerAMGSetSmoothAggNumLevels(pcg_precond, sa_num_levels);
             HYPRE_BoomerAMGSetVariant(pcg_precond, variant);
             HYPRE_BoomerAMGSetOverlap(pcg_precond, overlap);
             HYPRE_BoomerAMGSetDomainType(pcg_precond, domain_type);
@@ -5823,6 +6089,7 @@ main( hypre_int argc,
             HYPRE_BoomerAMGSetTol(pcg_precond, pc_tol);
             HYPRE_BoomerAMGSetCoarsenType(pcg_precond, (hybrid * coarsen_type));
             HYPRE_BoomerAMGSetCoarsenCutFactor(pcg_precond, coarsen_cut_factor);
+            HYPRE_BoomerAMGSetCoarsenThreadBlocks(pcg_precond, coarsen_thread_blocks);
             HYPRE_BoomerAMGSetCPoints(pcg_precond, max_levels, num_cpt, cpt_index);
             HYPRE_BoomerAMGSetFPoints(pcg_precond, num_fpt, fpt_index);
             HYPRE_BoomerAMGSetIsolatedFPoints(pcg_precond, num_isolated_fpt, isolated_fpt_index);
@@ -5837,6 +6104,8 @@ main( hypre_int argc,
             HYPRE_BoomerAMGSetMaxIter(pcg_precond, precon_cycles);
             HYPRE_BoomerAMGSetCycleType(pcg_precond, cycle_type);
             HYPRE_BoomerAMGSetFCycle(pcg_precond, fcycle);
+            HYPRE_BoomerAMGSetKCycle(pcg_precond, kcycle);
+            HYPRE_BoomerAMGSetKCycleNumIter(pcg_precond, kcycle_iter);
             HYPRE_BoomerAMGSetNumSweeps(pcg_precond, num_sweeps);
             HYPRE_BoomerAMGSetRelaxType(pcg_precond, relax_type);
             HYPRE_BoomerAMGSetAddRelaxType(pcg_precond, add_relax_type);
@@ -5857,6 +6126,8 @@ main( hypre_int argc,
             HYPRE_BoomerAMGSetNumFunctions(pcg_precond, num_functions);
             HYPRE_BoomerAMGSetNumPaths(pcg_precond, num_paths);
             HYPRE_BoomerAMGSetAggNumLevels(pcg_precond, agg_num_levels);
+            HYPRE_BoomerAMGSetMemoryBudget(pcg_precond, mem_budget);
+            HYPRE_BoomerAMGSetSmoothAggNumLevels(pcg_precond, sa_num_levels);
             if (num_functions > 1)
             {
                HYPRE_BoomerAMGSetDofFunc(pcg_precond, dof_func);
@@ -6173,6 +6444,7 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetTol(amg_precond, pc_tol);
          HYPRE_BoomerAMGSetCoarsenType(amg_precond, coarsen_type);
          HYPRE_BoomerAMGSetCoarsenCutFactor(amg_precond, coarsen_cut_factor);
+         HYPRE_BoomerAMGSetCoarsenThreadBlocks(amg_precond, coarsen_thread_blocks);
          HYPRE_BoomerAMGSetCPoints(amg_precond, max_levels, num_cpt, cpt_index);
          HYPRE_BoomerAMGSetFPoints(amg_precond, num_fpt, fpt_index);
          HYPRE_BoomerAMGSetIsolatedFPoints(amg_precond, num_isolated_fpt, isolated_fpt_index);
@@ -6191,6 +6463,8 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetMaxIter(amg_precond, precon_cycles);
          HYPRE_BoomerAMGSetCycleType(amg_precond, cycle_type);
          HYPRE_BoomerAMGSetFCycle(amg_precond, fcycle);
+         HYPRE_BoomerAMGSetKCycle(amg_precond, kcycle);
+         HYPRE_BoomerAMGSetKCycleNumIter(amg_precond, kcycle_iter);
          HYPRE_BoomerAMGSetNumSweeps(amg_precond, num_sweeps);
          HYPRE_BoomerAMGSetISType(amg_precond, IS_type);
          HYPRE_BoomerAMGSetNumCRRelaxSteps(amg_precond, num_CR_relax_steps);
@@ -6217,6 +6491,7 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetChebyEigEst(amg_precond, cheby_eig_est);
          HYPRE_BoomerAMGSetChebyVariant(amg_precond, cheby_variant);
          HYPRE_BoomerAMGSetChebyScale(amg_precond, cheby_scale);
+         HYPRE_BoomerAMGSetChebyMatPowers(amg_precond, cheby_mat_powers);
          HYPRE_BoomerAMGSetRelaxOrder(amg_precond, relax_order);
          HYPRE_BoomerAMGSetRelaxWt(amg_precond, relax_wt);
          HYPRE_BoomerAMGSetOuterWt(amg_precond, outer_wt);
@@ -6236,6 +6511,8 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetDebugFlag(amg_precond, debug_flag);
          HYPRE_BoomerAMGSetNumFunctions(amg_precond, num_functions);
          HYPRE_BoomerAMGSetAggNumLevels(amg_precond, agg_num_levels);
+         HYPRE_BoomerAMGSetMemoryBudget(amg_precond, mem_budget);
+         HYPRE_BoomerAMGSetSmoothAggNumLevels(amg_precond, sa_num_levels);
          HYPRE_BoomerAMGSetAggInterpType(amg_precond, agg_interp_type);
          HYPRE_BoomerAMGSetAggTruncFactor(amg_precond, agg_trunc_factor);
          HYPRE_BoomerAMGSetAggP12TruncFactor(amg_precond, agg_P12_trunc_factor);
@@ -6274,17 +6551,23 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetMultAdditive(amg_precond, mult_add);
          HYPRE_BoomerAMGSetSimple(amg_precond, simple);
          HYPRE_BoomerAMGSetAddLastLvl(amg_precond, add_last_lvl);
+         HYPRE_BoomerAMGSetAddComposite(amg_precond, add_composite);
          HYPRE_BoomerAMGSetMultAddPMaxElmts(amg_precond, add_P_max_elmts);
          HYPRE_BoomerAMGSetMultAddTruncFactor(amg_precond, add_trunc_factor);
          HYPRE_BoomerAMGSetRAP2(amg_precond, rap2);
          HYPRE_BoomerAMGSetModuleRAP2(amg_precond, mod_rap2);
          HYPRE_BoomerAMGSetKeepTranspose(amg_precond, keepTranspose);
+         HYPRE_BoomerAMGSetCompressIndices(amg_precond, compress_indices);
+         HYPRE_BoomerAMGSetPersistentComm(amg_precond, persistent_comm);
+         HYPRE_BoomerAMGSetMergedLayout(amg_precond, merged_layout);
+         HYPRE_BoomerAMGSetSetupTimings(amg_precond, setup_timings);
 #ifdef HYPRE_USING_DSUPERLU
          HYPRE_BoomerAMGSetDSLUThreshold(amg_precond, dslu_threshold);
 #endif
          if (nongalerk_tol)
          {
             HYPRE_BoomerAMGSetNonGalerkinTol(amg_precond, nongalerk_tol[nongalerk_num_tol - 1]);
+            HYPRE_BoomerAMGSetNonGalerkinRAP(amg_precond, nongalerkin_rap);
             for (i = 0; i < nongalerk_num_tol - 1; i++)
             {
                HYPRE_BoomerAMGSetLevelNonGalerkinTol(amg_precond, nongalerk_tol[i], i);
@@ -6368,6 +6651,7 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetTol(pcg_precond, pc_tol);
          HYPRE_BoomerAMGSetCoarsenType(pcg_precond, coarsen_type);
          HYPRE_BoomerAMGSetCoarsenCutFactor(pcg_precond, coarsen_cut_factor);
+         HYPRE_BoomerAMGSetCoarsenThreadBlocks(pcg_precond, coarsen_thread_blocks);
          HYPRE_BoomerAMGSetCPoints(pcg_precond, max_levels, num_cpt, cpt_index);
          HYPRE_BoomerAMGSetFPoints(pcg_precond, num_fpt, fpt_index);
          HYPRE_BoomerAMGSetIsolatedFPoints(pcg_precond, num_isolated_fpt, isolated_fpt_index);
@@ -6386,6 +6670,8 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetMaxIter(pcg_precond, precon_cycles);
          HYPRE_BoomerAMGSetCycleType(pcg_precond, cycle_type);
          HYPRE_BoomerAMGSetFCycle(pcg_precond, fcycle);
+         HYPRE_BoomerAMGSetKCycle(pcg_precond, kcycle);
+         HYPRE_BoomerAMGSetKCycleNumIter(pcg_precond, kcycle_iter);
          HYPRE_BoomerAMGSetNumSweeps(pcg_precond, num_sweeps);
          HYPRE_BoomerAMGSetISType(pcg_precond, IS_type);
          HYPRE_BoomerAMGSetNumCRRelaxSteps(pcg_precond, num_CR_relax_steps);
@@ -6412,6 +6698,7 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetChebyEigEst(pcg_precond, cheby_eig_est);
          HYPRE_BoomerAMGSetChebyVariant(pcg_precond, cheby_variant);
          HYPRE_BoomerAMGSetChebyScale(pcg_precond, cheby_scale);
+         HYPRE_BoomerAMGSetChebyMatPowers(pcg_precond, cheby_mat_powers);
          HYPRE_BoomerAMGSetRelaxOrder(pcg_precond, relax_order);
          HYPRE_BoomerAMGSetRelaxWt(pcg_precond, relax_wt);
          HYPRE_BoomerAMGSetOuterWt(pcg_precond, outer_wt);
@@ -6444,6 +6731,8 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetDebugFlag(pcg_precond, debug_flag);
          HYPRE_BoomerAMGSetNumFunctions(pcg_precond, num_functions);
          HYPRE_BoomerAMGSetAggNumLevels(pcg_precond, agg_num_levels);
+         HYPRE_BoomerAMGSetMemoryBudget(pcg_precond, mem_budget);
+         HYPRE_BoomerAMGSetSmoothAggNumLevels(pcg_precond, sa_num_levels);
          HYPRE_BoomerAMGSetAggInterpType(pcg_precond, agg_interp_type);
          HYPRE_BoomerAMGSetAggTruncFactor(pcg_precond, agg_trunc_factor);
          HYPRE_BoomerAMGSetAggP12TruncFactor(pcg_precond, agg_P12_trunc_factor);
@@ -6461,17 +6750,23 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetMultAdditive(pcg_precond, mult_add);
          HYPRE_BoomerAMGSetSimple(pcg_precond, simple);
          HYPRE_BoomerAMGSetAddLastLvl(pcg_precond, add_last_lvl);
+         HYPRE_BoomerAMGSetAddComposite(pcg_precond, add_composite);
          HYPRE_BoomerAMGSetMultAddPMaxElmts(pcg_precond, add_P_max_elmts);
          HYPRE_BoomerAMGSetMultAddTruncFactor(pcg_precond, add_trunc_factor);
          HYPRE_BoomerAMGSetRAP2(pcg_precond, rap2);
          HYPRE_BoomerAMGSetModuleRAP2(pcg_precond, mod_rap2);
          HYPRE_BoomerAMGSetKeepTranspose(pcg_precond, keepTranspose);
+         HYPRE_BoomerAMGSetCompressIndices(pcg_precond, compress_indices);
+         HYPRE_BoomerAMGSetPersistentComm(pcg_precond, persistent_comm);
+         HYPRE_BoomerAMGSetMergedLayout(pcg_precond, merged_layout);
+         HYPRE_BoomerAMGSetSetupTimings(pcg_precond, setup_timings);
 #ifdef HYPRE_USING_DSUPERLU
          HYPRE_BoomerAMGSetDSLUThreshold(pcg_precond, dslu_threshold);
 #endif
          if (nongalerk_tol)
          {
             HYPRE_BoomerAMGSetNonGalerkinTol(pcg_precond, nongalerk_tol[nongalerk_num_tol - 1]);
+            HYPRE_BoomerAMGSetNonGalerkinRAP(pcg_precond, nongalerkin_rap);
             for (i = 0; i < nongalerk_num_tol - 1; i++)
             {
                HYPRE_BoomerAMGSetLevelNonGalerkinTol(pcg_precond, nongalerk_tol[i], i);
@@ -6714,6 +7009,7 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetTol(pcg_precond, pc_tol);
          HYPRE_BoomerAMGSetCoarsenType(pcg_precond, coarsen_type);
          HYPRE_BoomerAMGSetCoarsenCutFactor(pcg_precond, coarsen_cut_factor);
+         HYPRE_BoomerAMGSetCoarsenThreadBlocks(pcg_precond, coarsen_thread_blocks);
          HYPRE_BoomerAMGSetCPoints(pcg_precond, max_levels, num_cpt, cpt_index);
          HYPRE_BoomerAMGSetFPoints(pcg_precond, num_fpt, fpt_index);
          HYPRE_BoomerAMGSetIsolatedFPoints(pcg_precond, num_isolated_fpt, isolated_fpt_index);
@@ -6732,6 +7028,8 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetMaxIter(pcg_precond, precon_cycles);
          HYPRE_BoomerAMGSetCycleType(pcg_precond, cycle_type);
          HYPRE_BoomerAMGSetFCycle(pcg_precond, fcycle);
+         HYPRE_BoomerAMGSetKCycle(pcg_precond, kcycle);
+         HYPRE_BoomerAMGSetKCycleNumIter(pcg_precond, kcycle_iter);
          HYPRE_BoomerAMGSetNumSweeps(pcg_precond, num_sweeps);
          HYPRE_BoomerAMGSetISType(pcg_precond, IS_type);
          HYPRE_BoomerAMGSetNumCRRelaxSteps(pcg_precond, num_CR_relax_steps);
@@ -6758,6 +7056,7 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetChebyEigEst(pcg_precond, cheby_eig_est);
          HYPRE_BoomerAMGSetChebyVariant(pcg_precond, cheby_variant);
          HYPRE_BoomerAMGSetChebyScale(pcg_precond, cheby_scale);
+         HYPRE_BoomerAMGSetChebyMatPowers(pcg_precond, cheby_mat_powers);
          HYPRE_BoomerAMGSetRelaxOrder(pcg_precond, relax_order);
          HYPRE_BoomerAMGSetRelaxWt(pcg_precond, relax_wt);
          HYPRE_BoomerAMGSetOuterWt(pcg_precond, outer_wt);
@@ -6777,6 +7076,8 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetDebugFlag(pcg_precond, debug_flag);
          HYPRE_BoomerAMGSetNumFunctions(pcg_precond, num_functions);
          HYPRE_BoomerAMGSetAggNumLevels(pcg_precond, agg_num_levels);
+         HYPRE_BoomerAMGSetMemoryBudget(pcg_precond, mem_budget);
+         HYPRE_BoomerAMGSetSmoothAggNumLevels(pcg_precond, sa_num_levels);
          HYPRE_BoomerAMGSetAggInterpType(pcg_precond, agg_interp_type);
          HYPRE_BoomerAMGSetAggTruncFactor(pcg_precond, agg_trunc_factor);
          HYPRE_BoomerAMGSetAggP12TruncFactor(pcg_precond, agg_P12_trunc_factor);
@@ -6807,17 +7108,23 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetMultAdditive(pcg_precond, mult_add);
          HYPRE_BoomerAMGSetSimple(pcg_precond, simple);
          HYPRE_BoomerAMGSetAddLastLvl(pcg_precond, add_last_lvl);
+         HYPRE_BoomerAMGSetAddComposite(pcg_precond, add_composite);
          HYPRE_BoomerAMGSetMultAddPMaxElmts(pcg_precond, add_P_max_elmts);
          HYPRE_BoomerAMGSetMultAddTruncFactor(pcg_precond, add_trunc_factor);
          HYPRE_BoomerAMGSetRAP2(pcg_precond, rap2);
          HYPRE_BoomerAMGSetModuleRAP2(pcg_precond, mod_rap2);
          HYPRE_BoomerAMGSetKeepTranspose(pcg_precond, keepTranspose);
+         HYPRE_BoomerAMGSetCompressIndices(pcg_precond, compress_indices);
+         HYPRE_BoomerAMGSetPersistentComm(pcg_precond, persistent_comm);
+         HYPRE_BoomerAMGSetMergedLayout(pcg_precond, merged_layout);
+         HYPRE_BoomerAMGSetSetupTimings(pcg_precond, setup_timings);
 #ifdef HYPRE_USING_DSUPERLU
          HYPRE_BoomerAMGSetDSLUThreshold(pcg_precond, dslu_threshold);
 #endif
          if (nongalerk_tol)
          {
             HYPRE_BoomerAMGSetNonGalerkinTol(pcg_precond, nongalerk_tol[nongalerk_num_tol - 1]);
+            HYPRE_BoomerAMGSetNonGalerkinRAP(pcg_precond, nongalerkin_rap);
             for (i = 0; i < nongalerk_num_tol - 1; i++)
             {
                HYPRE_BoomerAMGSetLevelNonGalerkinTol(pcg_precond, nongalerk_tol[i], i);
@@ -6919,6 +7226,7 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetTol(pcg_precond, pc_tol);
          HYPRE_BoomerAMGSetCoarsenType(pcg_precond, coarsen_type);
          HYPRE_BoomerAMGSetCoarsenCutFactor(pcg_precond, coarsen_cut_factor);
+         HYPRE_BoomerAMGSetCoarsenThreadBlocks(pcg_precond, coarsen_thread_blocks);
          HYPRE_BoomerAMGSetCPoints(pcg_precond, max_levels, num_cpt, cpt_index);
          HYPRE_BoomerAMGSetFPoints(pcg_precond, num_fpt, fpt_index);
          HYPRE_BoomerAMGSetIsolatedFPoints(pcg_precond, num_isolated_fpt, isolated_fpt_index);
@@ -6937,6 +7245,8 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetMaxIter(pcg_precond, precon_cycles);
          HYPRE_BoomerAMGSetCycleType(pcg_precond, cycle_type);
          HYPRE_BoomerAMGSetFCycle(pcg_precond, fcycle);
+         HYPRE_BoomerAMGSetKCycle(pcg_precond, kcycle);
+         HYPRE_BoomerAMGSetKCycleNumIter(pcg_precond, kcycle_iter);
          HYPRE_BoomerAMGSetNumSweeps(pcg_precond, num_sweeps);
          HYPRE_BoomerAMGSetISType(pcg_precond, IS_type);
          HYPRE_BoomerAMGSetNumCRRelaxSteps(pcg_precond, num_CR_relax_steps);
@@ -6963,6 +7273,7 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetChebyEigEst(pcg_precond, cheby_eig_est);
          HYPRE_BoomerAMGSetChebyVariant(pcg_precond, cheby_variant);
          HYPRE_BoomerAMGSetChebyScale(pcg_precond, cheby_scale);
+         HYPRE_BoomerAMGSetChebyMatPowers(pcg_precond, cheby_mat_powers);
          HYPRE_BoomerAMGSetRelaxOrder(pcg_precond, relax_order);
          HYPRE_BoomerAMGSetRelaxWt(pcg_precond, relax_wt);
          HYPRE_BoomerAMGSetOuterWt(pcg_precond, outer_wt);
@@ -6982,6 +7293,8 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetDebugFlag(pcg_precond, debug_flag);
          HYPRE_BoomerAMGSetNumFunctions(pcg_precond, num_functions);
          HYPRE_BoomerAMGSetAggNumLevels(pcg_precond, agg_num_levels);
+         HYPRE_BoomerAMGSetMemoryBudget(pcg_precond, mem_budget);
+         HYPRE_BoomerAMGSetSmoothAggNumLevels(pcg_precond, sa_num_levels);
          HYPRE_BoomerAMGSetAggInterpType(pcg_precond, agg_interp_type);
          HYPRE_BoomerAMGSetAggTruncFactor(pcg_precond, agg_trunc_factor);
          HYPRE_BoomerAMGSetAggP12TruncFactor(pcg_precond, agg_P12_trunc_factor);
@@ -7012,17 +7325,23 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetMultAdditive(pcg_precond, mult_add);
          HYPRE_BoomerAMGSetSimple(pcg_precond, simple);
          HYPRE_BoomerAMGSetAddLastLvl(pcg_precond, add_last_lvl);
+         HYPRE_BoomerAMGSetAddComposite(pcg_precond, add_composite);
          HYPRE_BoomerAMGSetMultAddPMaxElmts(pcg_precond, add_P_max_elmts);
          HYPRE_BoomerAMGSetMultAddTruncFactor(pcg_precond, add_trunc_factor);
          HYPRE_BoomerAMGSetRAP2(pcg_precond, rap2);
          HYPRE_BoomerAMGSetModuleRAP2(pcg_precond, mod_rap2);
          HYPRE_BoomerAMGSetKeepTranspose(pcg_precond, keepTranspose);
+         HYPRE_BoomerAMGSetCompressIndices(pcg_precond, compress_indices);
+         HYPRE_BoomerAMGSetPersistentComm(pcg_precond, persistent_comm);
+         HYPRE_BoomerAMGSetMergedLayout(pcg_precond, merged_layout);
+         HYPRE_BoomerAMGSetSetupTimings(pcg_precond, setup_timings);
 #ifdef HYPRE_USING_DSUPERLU
          HYPRE_BoomerAMGSetDSLUThreshold(pcg_precond, dslu_threshold);
 #endif
          if (nongalerk_tol)
          {
             HYPRE_BoomerAMGSetNonGalerkinTol(pcg_precond, nongalerk_tol[nongalerk_num_tol - 1]);
+            HYPRE_BoomerAMGSetNonGalerkinRAP(pcg_precond, nongalerkin_rap);
             for (i = 0; i < nongalerk_num_tol - 1; i++)
             {
                HYPRE_BoomerAMGSetLevelNonGalerkinTol(pcg_precond, nongalerk_tol[i], i);
@@ -7105,6 +7424,8 @@ main( hypre_int argc,
             HYPRE_BoomerAMGSetCoarsenType(amg_solver, 6);
             HYPRE_BoomerAMGSetCycleType(amg_solver, cycle_type);
             HYPRE_BoomerAMGSetFCycle(amg_solver, fcycle);
+            HYPRE_BoomerAMGSetKCycle(amg_solver, kcycle);
+            HYPRE_BoomerAMGSetKCycleNumIter(amg_solver, kcycle_iter);
             HYPRE_BoomerAMGSetRelaxType(amg_solver, 3);
             if (relax_down > -1)
             {
@@ -7325,6 +7646,7 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetTol(pcg_precond, pc_tol);
          HYPRE_BoomerAMGSetCoarsenType(pcg_precond, coarsen_type);
          HYPRE_BoomerAMGSetCoarsenCutFactor(pcg_precond, coarsen_cut_factor);
+         HYPRE_BoomerAMGSetCoarsenThreadBlocks(pcg_precond, coarsen_thread_blocks);
          HYPRE_BoomerAMGSetCPoints(pcg_precond, max_levels, num_cpt, cpt_index);
          HYPRE_BoomerAMGSetFPoints(pcg_precond, num_fpt, fpt_index);
          HYPRE_BoomerAMGSetIsolatedFPoints(pcg_precond, num_isolated_fpt, isolated_fpt_index);
@@ -7343,6 +7665,8 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetMaxIter(pcg_precond, precon_cycles);
          HYPRE_BoomerAMGSetCycleType(pcg_precond, cycle_type);
          HYPRE_BoomerAMGSetFCycle(pcg_precond, fcycle);
+         HYPRE_BoomerAMGSetKCycle(pcg_precond, kcycle);
+         HYPRE_BoomerAMGSetKCycleNumIter(pcg_precond, kcycle_iter);
          HYPRE_BoomerAMGSetNumSweeps(pcg_precond, num_sweeps);
          HYPRE_BoomerAMGSetISType(pcg_precond, IS_type);
          HYPRE_BoomerAMGSetNumCRRelaxSteps(pcg_precond, num_CR_relax_steps);
@@ -7369,6 +7693,7 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetChebyEigEst(pcg_precond, cheby_eig_est);
          HYPRE_BoomerAMGSetChebyVariant(pcg_precond, cheby_variant);
          HYPRE_BoomerAMGSetChebyScale(pcg_precond, cheby_scale);
+         HYPRE_BoomerAMGSetChebyMatPowers(pcg_precond, cheby_mat_powers);
          HYPRE_BoomerAMGSetRelaxOrder(pcg_precond, relax_order);
          HYPRE_BoomerAMGSetRelaxWt(pcg_precond, relax_wt);
          HYPRE_BoomerAMGSetOuterWt(pcg_precond, outer_wt);
@@ -7388,6 +7713,8 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetDebugFlag(pcg_precond, debug_flag);
          HYPRE_BoomerAMGSetNumFunctions(pcg_precond, num_functions);
          HYPRE_BoomerAMGSetAggNumLevels(pcg_precond, agg_num_levels);
+         HYPRE_BoomerAMGSetMemoryBudget(pcg_precond, mem_budget);
+         HYPRE_BoomerAMGSetSmoothAggNumLevels(pcg_precond, sa_num_levels);
          HYPRE_BoomerAMGSetAggInterpType(pcg_precond, agg_interp_type);
          HYPRE_BoomerAMGSetAggTruncFactor(pcg_precond, agg_trunc_factor);
          HYPRE_BoomerAMGSetAggP12TruncFactor(pcg_precond, agg_P12_trunc_factor);
@@ -7419,17 +7746,23 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetMultAdditive(pcg_precond, mult_add);
          HYPRE_BoomerAMGSetSimple(pcg_precond, simple);
          HYPRE_BoomerAMGSetAddLastLvl(pcg_precond, add_last_lvl);
+         HYPRE_BoomerAMGSetAddComposite(pcg_precond, add_composite);
          HYPRE_BoomerAMGSetMultAddPMaxElmts(pcg_precond, add_P_max_elmts);
          HYPRE_BoomerAMGSetMultAddTruncFactor(pcg_precond, add_trunc_factor);
          HYPRE_BoomerAMGSetRAP2(pcg_precond, rap2);
          HYPRE_BoomerAMGSetModuleRAP2(pcg_precond, mod_rap2);
          HYPRE_BoomerAMGSetKeepTranspose(pcg_precond, keepTranspose);
+         HYPRE_BoomerAMGSetCompressIndices(pcg_precond, compress_indices);
+         HYPRE_BoomerAMGSetPersistentComm(pcg_precond, persistent_comm);
+         HYPRE_BoomerAMGSetMergedLayout(pcg_precond, merged_layout);
+         HYPRE_BoomerAMGSetSetupTimings(pcg_precond, setup_timings);
 #ifdef HYPRE_USING_DSUPERLU
          HYPRE_BoomerAMGSetDSLUThreshold(pcg_precond, dslu_threshold);
 #endif
          if (nongalerk_tol)
          {
             HYPRE_BoomerAMGSetNonGalerkinTol(pcg_precond, nongalerk_tol[nongalerk_num_tol - 1]);
+            HYPRE_BoomerAMGSetNonGalerkinRAP(pcg_precond, nongalerkin_rap);
             for (i = 0; i < nongalerk_num_tol - 1; i++)
             {
                HYPRE_BoomerAMGSetLevelNonGalerkinTol(pcg_precond, nongalerk_tol[i], i);
@@ -7725,6 +8058,7 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetTol(pcg_precond, pc_tol);
          HYPRE_BoomerAMGSetCoarsenType(pcg_precond, coarsen_type);
          HYPRE_BoomerAMGSetCoarsenCutFactor(pcg_precond, coarsen_cut_factor);
+         HYPRE_BoomerAMGSetCoarsenThreadBlocks(pcg_precond, coarsen_thread_blocks);
          HYPRE_BoomerAMGSetCPoints(pcg_precond, max_levels, num_cpt, cpt_index);
          HYPRE_BoomerAMGSetFPoints(pcg_precond, num_fpt, fpt_index);
          HYPRE_BoomerAMGSetIsolatedFPoints(pcg_precond, num_isolated_fpt, isolated_fpt_index);
@@ -7743,6 +8077,8 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetMaxIter(pcg_precond, precon_cycles);
          HYPRE_BoomerAMGSetCycleType(pcg_precond, cycle_type);
          HYPRE_BoomerAMGSetFCycle(pcg_precond, fcycle);
+         HYPRE_BoomerAMGSetKCycle(pcg_precond, kcycle);
+         HYPRE_BoomerAMGSetKCycleNumIter(pcg_precond, kcycle_iter);
          HYPRE_BoomerAMGSetNumSweeps(pcg_precond, num_sweeps);
          HYPRE_BoomerAMGSetISType(pcg_precond, IS_type);
          HYPRE_BoomerAMGSetNumCRRelaxSteps(pcg_precond, num_CR_relax_steps);
@@ -7769,6 +8105,7 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetChebyEigEst(pcg_precond, cheby_eig_est);
          HYPRE_BoomerAMGSetChebyVariant(pcg_precond, cheby_variant);
          HYPRE_BoomerAMGSetChebyScale(pcg_precond, cheby_scale);
+         HYPRE_BoomerAMGSetChebyMatPowers(pcg_precond, cheby_mat_powers);
          HYPRE_BoomerAMGSetRelaxOrder(pcg_precond, relax_order);
          HYPRE_BoomerAMGSetRelaxWt(pcg_precond, relax_wt);
          HYPRE_BoomerAMGSetOuterWt(pcg_precond, outer_wt);
@@ -7788,6 +8125,8 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetDebugFlag(pcg_precond, debug_flag);
          HYPRE_BoomerAMGSetNumFunctions(pcg_precond, num_functions);
          HYPRE_BoomerAMGSetAggNumLevels(pcg_precond, agg_num_levels);
+         HYPRE_BoomerAMGSetMemoryBudget(pcg_precond, mem_budget);
+         HYPRE_BoomerAMGSetSmoothAggNumLevels(pcg_precond, sa_num_levels);
          HYPRE_BoomerAMGSetAggInterpType(pcg_precond, agg_interp_type);
          HYPRE_BoomerAMGSetAggTruncFactor(pcg_precond, agg_trunc_factor);
          HYPRE_BoomerAMGSetAggP12TruncFactor(pcg_precond, agg_P12_trunc_factor);
@@ -7819,17 +8158,23 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetMultAdditive(pcg_precond, mult_add);
          HYPRE_BoomerAMGSetSimple(pcg_precond, simple);
          HYPRE_BoomerAMGSetAddLastLvl(pcg_precond, add_last_lvl);
+         HYPRE_BoomerAMGSetAddComposite(pcg_precond, add_composite);
          HYPRE_BoomerAMGSetMultAddPMaxElmts(pcg_precond, add_P_max_elmts);
          HYPRE_BoomerAMGSetMultAddTruncFactor(pcg_precond, add_trunc_factor);
          HYPRE_BoomerAMGSetRAP2(pcg_precond, rap2);
          HYPRE_BoomerAMGSetModuleRAP2(pcg_precond, mod_rap2);
          HYPRE_BoomerAMGSetKeepTranspose(pcg_precond, keepTranspose);
+         HYPRE_BoomerAMGSetCompressIndices(pcg_precond, compress_indices);
+         HYPRE_BoomerAMGSetPersistentComm(pcg_precond, persistent_comm);
+         HYPRE_BoomerAMGSetMergedLayout(pcg_precond, merged_layout);
+         HYPRE_BoomerAMGSetSetupTimings(pcg_precond, setup_timings);
 #ifdef HYPRE_USING_DSUPERLU
          HYPRE_BoomerAMGSetDSLUThreshold(pcg_precond, dslu_threshold);
 #endif
          if (nongalerk_tol)
          {
             HYPRE_BoomerAMGSetNonGalerkinTol(pcg_precond, nongalerk_tol[nongalerk_num_tol - 1]);
+            HYPRE_BoomerAMGSetNonGalerkinRAP(pcg_precond, nongalerkin_rap);
             for (i = 0; i < nongalerk_num_tol - 1; i++)
             {
                HYPRE_BoomerAMGSetLevelNonGalerkinTol(pcg_precond, nongalerk_tol[i], i);
@@ -8074,6 +8419,7 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetTol(pcg_precond, pc_tol);
          HYPRE_BoomerAMGSetCoarsenType(pcg_precond, coarsen_type);
          HYPRE_BoomerAMGSetCoarsenCutFactor(pcg_precond, coarsen_cut_factor);
+         HYPRE_BoomerAMGSetCoarsenThreadBlocks(pcg_precond, coarsen_thread_blocks);
          HYPRE_BoomerAMGSetCPoints(pcg_precond, max_levels, num_cpt, cpt_index);
          HYPRE_BoomerAMGSetFPoints(pcg_precond, num_fpt, fpt_index);
          HYPRE_BoomerAMGSetIsolatedFPoints(pcg_precond, num_isolated_fpt, isolated_fpt_index);
@@ -8092,6 +8438,8 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetMaxIter(pcg_precond, precon_cycles);
          HYPRE_BoomerAMGSetCycleType(pcg_precond, cycle_type);
          HYPRE_BoomerAMGSetFCycle(pcg_precond, fcycle);
+         HYPRE_BoomerAMGSetKCycle(pcg_precond, kcycle);
+         HYPRE_BoomerAMGSetKCycleNumIter(pcg_precond, kcycle_iter);
          HYPRE_BoomerAMGSetNumSweeps(pcg_precond, num_sweeps);
          if (relax_type > -1) { HYPRE_BoomerAMGSetRelaxType(pcg_precond, relax_type); }
          if (relax_down > -1)
@@ -8113,6 +8461,7 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetChebyEigEst(pcg_precond, cheby_eig_est);
          HYPRE_BoomerAMGSetChebyVariant(pcg_precond, cheby_variant);
          HYPRE_BoomerAMGSetChebyScale(pcg_precond, cheby_scale);
+         HYPRE_BoomerAMGSetChebyMatPowers(pcg_precond, cheby_mat_powers);
          HYPRE_BoomerAMGSetRelaxOrder(pcg_precond, relax_order);
          HYPRE_BoomerAMGSetRelaxWt(pcg_precond, relax_wt);
          HYPRE_BoomerAMGSetOuterWt(pcg_precond, outer_wt);
@@ -8132,6 +8481,8 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetDebugFlag(pcg_precond, debug_flag);
          HYPRE_BoomerAMGSetNumFunctions(pcg_precond, num_functions);
          HYPRE_BoomerAMGSetAggNumLevels(pcg_precond, agg_num_levels);
+         HYPRE_BoomerAMGSetMemoryBudget(pcg_precond, mem_budget);
+         HYPRE_BoomerAMGSetSmoothAggNumLevels(pcg_precond, sa_num_levels);
          HYPRE_BoomerAMGSetAggInterpType(pcg_precond, agg_interp_type);
          HYPRE_BoomerAMGSetAggTruncFactor(pcg_precond, agg_trunc_factor);
          HYPRE_BoomerAMGSetAggP12TruncFactor(pcg_precond, agg_P12_trunc_factor);
@@ -8151,17 +8502,23 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetMultAdditive(pcg_precond, mult_add);
          HYPRE_BoomerAMGSetSimple(pcg_precond, simple);
          HYPRE_BoomerAMGSetAddLastLvl(pcg_precond, add_last_lvl);
+         HYPRE_BoomerAMGSetAddComposite(pcg_precond, add_composite);
          HYPRE_BoomerAMGSetMultAddPMaxElmts(pcg_precond, add_P_max_elmts);
          HYPRE_BoomerAMGSetMultAddTruncFactor(pcg_precond, add_trunc_factor);
          HYPRE_BoomerAMGSetRAP2(pcg_precond, rap2);
          HYPRE_BoomerAMGSetModuleRAP2(pcg_precond, mod_rap2);
          HYPRE_BoomerAMGSetKeepTranspose(pcg_precond, keepTranspose);
+         HYPRE_BoomerAMGSetCompressIndices(pcg_precond, compress_indices);
+         HYPRE_BoomerAMGSetPersistentComm(pcg_precond, persistent_comm);
+         HYPRE_BoomerAMGSetMergedLayout(pcg_precond, merged_layout);
+         HYPRE_BoomerAMGSetSetupTimings(pcg_precond, setup_timings);
 #ifdef HYPRE_USING_DSUPERLU
          HYPRE_BoomerAMGSetDSLUThreshold(pcg_precond, dslu_threshold);
 #endif
          if (nongalerk_tol)
          {
             HYPRE_BoomerAMGSetNonGalerkinTol(pcg_precond, nongalerk_tol[nongalerk_num_tol - 1]);
+            HYPRE_BoomerAMGSetNonGalerkinRAP(pcg_precond, nongalerkin_rap);
             for (i = 0; i < nongalerk_num_tol - 1; i++)
             {
                HYPRE_BoomerAMGSetLevelNonGalerkinTol(pcg_precond, nongalerk_tol[i], i);
@@ -8327,6 +8684,8 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetCoarsenType(amg_solver, 6);
          HYPRE_BoomerAMGSetCycleType(amg_solver, cycle_type);
          HYPRE_BoomerAMGSetFCycle(amg_solver, fcycle);
+         HYPRE_BoomerAMGSetKCycle(amg_solver, kcycle);
+         HYPRE_BoomerAMGSetKCycleNumIter(amg_solver, kcycle_iter);
          HYPRE_BoomerAMGSetRelaxType(amg_solver, 3);
          if (relax_down > -1)
          {
@@ -0,0 +1,273 @@
+/******************************************************************************
+ * Copyright (c) 1998 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/*--------------------------------------------------------------------------
+ * Microbenchmark for the overlap of halo exchanges with local computation.
+ * Do `ij_overlap -help' for usage info.
+ *
+ * The driver times repeated ParCSR matrix-vector products on a 27-point
+ * Laplacian, first without MPI progress polling and then with polling every
+ * <val> rows of the local product (see HYPRE_SetCommProgress), and checks
+ * that all variants give the same result.
+ *--------------------------------------------------------------------------*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <math.h>
+
+#include "_hypre_utilities.h"
+#include "HYPRE.h"
+#include "HYPRE_parcsr_ls.h"
+#include "_hypre_parcsr_mv.h"
+
+/*--------------------------------------------------------------------------
+ * Time num_reps products y = A*x with polling every progress rows (0 off).
+ * Returns the largest time over all ranks.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Real
+TimeMatvecs( hypre_ParCSRMatrix *A,
+             hypre_ParVector    *x,
+             hypre_ParVector    *y,
+             HYPRE_Int           num_reps,
+             HYPRE_Int           progress )
+{
+   MPI_Comm    comm = hypre_ParCSRMatrixComm(A);
+   HYPRE_Real  time, max_time;
+   HYPRE_Int   rep;
+
+   HYPRE_SetCommProgress(progress);
+
+   /* warm up */
+   hypre_ParCSRMatrixMatvec(1.0, A, x, 0.0, y);
+
+   hypre_MPI_Barrier(comm);
+   time = hypre_MPI_Wtime();
+   for (rep = 0; rep < num_reps; rep++)
+   {
+      hypre_ParCSRMatrixMatvec(1.0, A, x, 0.0, y);
+   }
+   time = hypre_MPI_Wtime() - time;
+
+   hypre_MPI_Allreduce(&time, &max_time, 1, HYPRE_MPI_REAL, hypre_MPI_MAX, comm);
+
+   return max_time;
+}
+
+hypre_int
+main( hypre_int argc,
+      char *argv[] )
+{
+   HYPRE_Int           arg_index;
+   HYPRE_Int           print_usage;
+   HYPRE_Int           num_procs, myid;
+   HYPRE_Int           nx, ny, nz;
+   HYPRE_Int           P, Q, R;
+   HYPRE_Int           p, q, r;
+   HYPRE_Int           num_reps;
+   HYPRE_Int           num_progress;
+   HYPRE_Int           progress[16];
+   HYPRE_Int           i;
+   HYPRE_Real          values[2];
+   HYPRE_Real          time, base_time, diff;
+
+   hypre_ParCSRMatrix *A;
+   hypre_ParVector    *x;
+   hypre_ParVector    *y;
+   hypre_ParVector    *y0;
+
+   MPI_Comm            comm = hypre_MPI_COMM_WORLD;
+
+   /*-----------------------------------------------------------
+    * Initialize some stuff
+    *-----------------------------------------------------------*/
+
+   /* Initialize MPI */
+   hypre_MPI_Init(&argc, &argv);
+
+   hypre_MPI_Comm_size(comm, &num_procs);
+   hypre_MPI_Comm_rank(comm, &myid);
+
+   HYPRE_Init();
+
+   /*-----------------------------------------------------------
+    * Set defaults
+    *-----------------------------------------------------------*/
+
+   nx = 50;
+   ny = 50;
+   nz = 50;
+
+   P  = num_procs;
+   Q  = 1;
+   R  = 1;
+
+   num_reps     = 100;
+   num_progress = 0;
+
+   /*-----------------------------------------------------------
+    * Parse command line
+    *-----------------------------------------------------------*/
+
+   print_usage = 0;
+   arg_index = 1;
+
+   while ( (arg_index < argc) && (!print_usage) )
+   {
+      if ( strcmp(argv[arg_index], "-n") == 0 )
+      {
+         arg_index++;
+         nx = atoi(argv[arg_index++]);
+         ny = atoi(argv[arg_index++]);
+         nz = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-P") == 0 )
+      {
+         arg_index++;
+         P  = atoi(argv[arg_index++]);
+         Q  = atoi(argv[arg_index++]);
+         R  = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-reps") == 0 )
+      {
+         arg_index++;
+         num_reps = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-comm_progress") == 0 )
+      {
+         arg_index++;
+         if (num_progress < 16)
+         {
+            progress[num_progress++] = atoi(argv[arg_index]);
+         }
+         arg_index++;
+      }
+      else if ( strcmp(argv[arg_index], "-help") == 0 )
+      {
+         print_usage = 1;
+      }
+      else
+      {
+         arg_index++;
+      }
+   }
+
+   if (P * Q * R != num_procs)
+   {
+      if (myid == 0)
+      {
+         hypre_printf("Error: Invalid number of processors or processor topology\n");
+      }
+      print_usage = 1;
+   }
+
+   /*-----------------------------------------------------------
+    * Print usage info
+    *-----------------------------------------------------------*/
+
+   if ( print_usage )
+   {
+      if ( myid == 0 )
+      {
+         hypre_printf("\n");
+         hypre_printf("Usage: %s [<options>]\n", argv[0]);
+         hypre_printf("\n");
+         hypre_printf("  -n <nx> <ny> <nz>      : problem size per processor (default 50 50 50)\n");
+         hypre_printf("  -P <Px> <Py> <Pz>      : processor topology (default np 1 1)\n");
+         hypre_printf("  -reps <val>            : number of matvecs timed (default 100)\n");
+         hypre_printf("  -comm_progress <val>   : also time polling every <val> rows;\n");
+         hypre_printf("                           may be repeated (default 64 256 1024)\n");
+         hypre_printf("\n");
+      }
+
+      HYPRE_Finalize();
+      hypre_MPI_Finalize();
+
+      return (0);
+   }
+
+   if (num_progress == 0)
+   {
+      progress[num_progress++] = 64;
+      progress[num_progress++] = 256;
+      progress[num_progress++] = 1024;
+   }
+
+   /*-----------------------------------------------------------
+    * Set up the problem
+    *-----------------------------------------------------------*/
+
+   p = myid % P;
+   q = ((myid - p) / P) % Q;
+   r = (myid - p - P * q) / (P * Q);
+
+   values[0] = 26.0;
+   values[1] = -1.0;
+
+   A = (hypre_ParCSRMatrix *) GenerateLaplacian27pt(comm, (HYPRE_BigInt) P * nx,
+                                                    (HYPRE_BigInt) Q * ny,
+                                                    (HYPRE_BigInt) R * nz,
+                                                    P, Q, R, p, q, r, values);
+
+   x  = hypre_ParVectorCreate(comm, hypre_ParCSRMatrixGlobalNumCols(A),
+                              hypre_ParCSRMatrixColStarts(A));
+   y  = hypre_ParVectorCreate(comm, hypre_ParCSRMatrixGlobalNumRows(A),
+                              hypre_ParCSRMatrixRowStarts(A));
+   y0 = hypre_ParVectorCreate(comm, hypre_ParCSRMatrixGlobalNumRows(A),
+                              hypre_ParCSRMatrixRowStarts(A));
+   hypre_ParVectorInitialize(x);
+   hypre_ParVectorInitialize(y);
+   hypre_ParVectorInitialize(y0);
+   hypre_ParVectorSetRandomValues(x, 1);
+
+   /*-----------------------------------------------------------
+    * Time the products
+    *-----------------------------------------------------------*/
+
+   if (myid == 0)
+   {
+      hypre_printf("\n");
+      hypre_printf("  %d x %d x %d grid per rank, %d x %d x %d ranks, %d matvecs\n\n",
+                   nx, ny, nz, P, Q, R, num_reps);
+      hypre_printf("  comm_progress     time (s)    speedup     ||y - y0||\n");
+   }
+
+   base_time = TimeMatvecs(A, x, y0, num_reps, 0);
+   if (myid == 0)
+   {
+      hypre_printf("  %13d   %10.4e   %8.3f   %13.6e\n", 0, base_time, 1.0, 0.0);
+   }
+
+   for (i = 0; i < num_progress; i++)
+   {
+      time = TimeMatvecs(A, x, y, num_reps, progress[i]);
+
+      hypre_ParVectorAxpy(-1.0, y0, y);
+      diff = hypre_ParVectorInnerProd(y, y);
+      if (myid == 0)
+      {
+         hypre_printf("  %13d   %10.4e   %8.3f   %13.6e\n", progress[i], time,
+                      (time > 0.0) ? base_time / time : 0.0, sqrt(diff));
+      }
+   }
+
+   HYPRE_SetCommProgress(0);
+
+   /*-----------------------------------------------------------
+    * Finalize things
+    *-----------------------------------------------------------*/
+
+   hypre_ParCSRMatrixDestroy(A);
+   hypre_ParVectorDestroy(x);
+   hypre_ParVectorDestroy(y);
+   hypre_ParVectorDestroy(y0);
+
+   HYPRE_Finalize();
+   hypre_MPI_Finalize();
+
+   return (0);
+}
@@ -13,6 +13,33 @@
 
 #include "_hypre_utilities.h"
 
+/*--------------------------------------------------------------------------
+ * HYPRE_SetNodeAwareComm
+ *--------------------------------------------------------------------------*/
+HYPRE_Int
+HYPRE_SetNodeAwareComm( HYPRE_Int value )
+{
+   return hypre_SetNodeAwareComm(value);
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_SetSharedMemComm
+ *--------------------------------------------------------------------------*/
+HYPRE_Int
+HYPRE_SetSharedMemComm( HYPRE_Int value )
+{
+   return hypre_SetSharedMemComm(value);
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_SetCommProgress
+ *--------------------------------------------------------------------------*/
+HYPRE_Int
+HYPRE_SetCommProgress( HYPRE_Int value )
+{
+   return hypre_SetCommProgress(value);
+}
+
 /*--------------------------------------------------------------------------
  * HYPRE_SetSpTransUseVendor
  *--------------------------------------------------------------------------*/
@@ -228,6 +228,48 @@ HYPRE_Int HYPRE_SetGPUMemoryPoolSize(HYPRE_Int bin_growth, HYPRE_Int min_bin, HY
  * HYPRE handle
  *--------------------------------------------------------------------------*/
 
+/**
+ * (Optional) Use node-aware halo exchanges in the ParCSR matrix-vector
+ * products and relaxations.  Data between ranks of different nodes is then
+ * aggregated through one leader rank per node, so that each pair of nodes
+ * exchanges a single message.  If {\tt value} is 1, the ranks sharing a node
+ * form one group; if {\tt value} is larger than 1, each node is further split
+ * into groups of at most {\tt value} ranks (e.g., the ranks of one socket),
+ * each with its own leader.  Only communication packages created after this
+ * call are affected, and the group communicators are built once for each
+ * set of ranks.  This has no effect in builds with GPU-aware MPI.  The
+ * default is 0 (flat, rank-to-rank exchanges).
+ **/
+HYPRE_Int HYPRE_SetNodeAwareComm( HYPRE_Int value );
+
+/**
+ * (Optional) Exchange the halo values of the ParCSR matrix-vector products
+ * and relaxations between ranks of the same node through MPI-3 shared-memory
+ * windows.  Each rank publishes the values its on-node neighbors need in a
+ * window segment, and the neighbors copy them with direct loads once a
+ * zero-byte notification has arrived; only off-node data is sent in MPI
+ * messages.  If {\tt value} is nonzero, this takes precedence over
+ * HYPRE_SetNodeAwareComm.  Only communication packages created after
+ * this call are affected, and their segments are carved from windows that
+ * are shared by all packages of the same set of ranks.  This has no effect
+ * in builds with GPU-aware MPI.  The default is 0.
+ **/
+HYPRE_Int HYPRE_SetSharedMemComm( HYPRE_Int value );
+
+/**
+ * (Optional) Drive the progress of pending halo exchanges from the local
+ * computations they overlap with.  Many MPI libraries only move the data of
+ * non-blocking messages inside MPI calls, so that the messages posted before
+ * the diagonal part of a ParCSR matrix-vector product do not progress until
+ * the final wait.  If {\tt value} is positive, the outstanding requests of the
+ * active halo exchanges are tested after every {\tt value} rows of the local
+ * product (by the master thread).  With OpenMP, this requires MPI to be
+ * initialized with at least MPI_THREAD_FUNNELED (see MPI_Init_thread);
+ * otherwise, polling is turned off.  This may be called before HYPRE_Init.
+ * The default is 0 (no polling).
+ **/
+HYPRE_Int HYPRE_SetCommProgress( HYPRE_Int value );
+
 HYPRE_Int HYPRE_SetSpTransUseVendor( HYPRE_Int use_vendor );
 HYPRE_Int HYPRE_SetSpMVUseVendor( HYPRE_Int use_vendor );
 /* Backwards compatibility with HYPRE_SetSpGemmUseCusparse() */
@@ -31,6 +31,7 @@ extern "C" {
 #define hypre_GENERAL_HEADER
 
 /* This allows us to consistently avoid 'int' throughout hypre */
+typedef short                  hypre_short;
 typedef int                    hypre_int;
 typedef long int               hypre_longint;
 typedef unsigned int           hypre_uint;
@@ -191,6 +192,7 @@ extern "C" {
 #define MPI_Op              hypre_MPI_Op
 #define MPI_Aint            hypre_MPI_Aint
 #define MPI_Info            hypre_MPI_Info
+#define MPI_Win             hypre_MPI_Win
 
 #define MPI_COMM_WORLD       hypre_MPI_COMM_WORLD
 #define MPI_COMM_NULL        hypre_MPI_COMM_NULL
@@ -226,6 +228,7 @@ extern "C" {
 #define MPI_TAG             hypre_MPI_TAG
 
 #define MPI_Init            hypre_MPI_Init
+#define MPI_Init_thread     hypre_MPI_Init_thread
 #define MPI_Finalize        hypre_MPI_Finalize
 #define MPI_Abort           hypre_MPI_Abort
 #define MPI_Wtime           hypre_MPI_Wtime
@@ -240,6 +243,8 @@ extern "C" {
 #define MPI_Comm_free       hypre_MPI_Comm_free
 #define MPI_Comm_split      hypre_MPI_Comm_split
 #define MPI_Comm_split_type hypre_MPI_Comm_split_type
+#define MPI_Comm_compare    hypre_MPI_Comm_compare
+#define MPI_Query_thread    hypre_MPI_Query_thread
 #define MPI_Group_incl      hypre_MPI_Group_incl
 #define MPI_Group_free      hypre_MPI_Group_free
 #define MPI_Address         hypre_MPI_Address
@@ -281,6 +286,12 @@ extern "C" {
 #define MPI_Op_create       hypre_MPI_Op_create
 #define MPI_User_function   hypre_MPI_User_function
 #define MPI_Info_create     hypre_MPI_Info_create
+#define MPI_Win_allocate_shared hypre_MPI_Win_allocate_shared
+#define MPI_Win_shared_query    hypre_MPI_Win_shared_query
+#define MPI_Win_lock_all    hypre_MPI_Win_lock_all
+#define MPI_Win_unlock_all  hypre_MPI_Win_unlock_all
+#define MPI_Win_sync        hypre_MPI_Win_sync
+#define MPI_Win_free        hypre_MPI_Win_free
 
 /*--------------------------------------------------------------------------
  * Types, etc.
@@ -302,12 +313,20 @@ typedef struct
 typedef HYPRE_Int  hypre_MPI_Op;
 typedef HYPRE_Int  hypre_MPI_Aint;
 typedef HYPRE_Int  hypre_MPI_Info;
+typedef HYPRE_Int  hypre_MPI_Win;
 
 #define  hypre_MPI_COMM_SELF   1
 #define  hypre_MPI_COMM_WORLD  0
 #define  hypre_MPI_COMM_NULL  -1
 
 #define  hypre_MPI_COMM_TYPE_SHARED 0
+#define  hypre_MPI_MODE_NOCHECK     0
+#define  hypre_MPI_IDENT            0
+#define  hypre_MPI_CONGRUENT        1
+#define  hypre_MPI_THREAD_SINGLE     0
+#define  hypre_MPI_THREAD_FUNNELED   1
+#define  hypre_MPI_THREAD_SERIALIZED 2
+#define  hypre_MPI_THREAD_MULTIPLE   3
 
 #define  hypre_MPI_BOTTOM  0x0
 
@@ -350,6 +369,7 @@ typedef MPI_Status   hypre_MPI_Status;
 typedef MPI_Op       hypre_MPI_Op;
 typedef MPI_Aint     hypre_MPI_Aint;
 typedef MPI_Info     hypre_MPI_Info;
+typedef MPI_Win      hypre_MPI_Win;
 typedef MPI_User_function    hypre_MPI_User_function;
 
 #define  hypre_MPI_COMM_WORLD         MPI_COMM_WORLD
@@ -357,6 +377,13 @@ typedef MPI_User_function    hypre_MPI_User_function;
 #define  hypre_MPI_BOTTOM             MPI_BOTTOM
 #define  hypre_MPI_COMM_SELF          MPI_COMM_SELF
 #define  hypre_MPI_COMM_TYPE_SHARED   MPI_COMM_TYPE_SHARED
+#define  hypre_MPI_MODE_NOCHECK       MPI_MODE_NOCHECK
+#define  hypre_MPI_IDENT              MPI_IDENT
+#define  hypre_MPI_CONGRUENT          MPI_CONGRUENT
+#define  hypre_MPI_THREAD_SINGLE      MPI_THREAD_SINGLE
+#define  hypre_MPI_THREAD_FUNNELED    MPI_THREAD_FUNNELED
+#define  hypre_MPI_THREAD_SERIALIZED  MPI_THREAD_SERIALIZED
+#define  hypre_MPI_THREAD_MULTIPLE    MPI_THREAD_MULTIPLE
 
 #define  hypre_MPI_FLOAT   MPI_FLOAT
 #define  hypre_MPI_DOUBLE  MPI_DOUBLE
@@ -399,6 +426,8 @@ typedef MPI_User_function    hypre_MPI_User_function;
 
 /* mpistubs.c */
 HYPRE_Int hypre_MPI_Init( hypre_int *argc, char ***argv );
+HYPRE_Int hypre_MPI_Init_thread( hypre_int *argc, char ***argv, HYPRE_Int required,
+                                 HYPRE_Int *provided );
 HYPRE_Int hypre_MPI_Finalize( void );
 HYPRE_Int hypre_MPI_Abort( hypre_MPI_Comm comm, HYPRE_Int errorcode );
 HYPRE_Real hypre_MPI_Wtime( void );
@@ -489,9 +518,21 @@ HYPRE_Int hypre_MPI_Type_free( hypre_MPI_Datatype *datatype );
 HYPRE_Int hypre_MPI_Op_free( hypre_MPI_Op *op );
 HYPRE_Int hypre_MPI_Op_create( hypre_MPI_User_function *function, hypre_int commute,
                                hypre_MPI_Op *op );
-#if defined(HYPRE_USING_GPU)
 HYPRE_Int hypre_MPI_Comm_split_type(hypre_MPI_Comm comm, HYPRE_Int split_type, HYPRE_Int key,
                                     hypre_MPI_Info info, hypre_MPI_Comm *newcomm);
+HYPRE_Int hypre_MPI_Comm_compare( hypre_MPI_Comm comm1, hypre_MPI_Comm comm2,
+                                  HYPRE_Int *result );
+HYPRE_Int hypre_MPI_Query_thread( HYPRE_Int *provided );
+HYPRE_Int hypre_MPI_Win_allocate_shared( hypre_MPI_Aint size, HYPRE_Int disp_unit,
+                                         hypre_MPI_Info info, hypre_MPI_Comm comm, void *baseptr,
+                                         hypre_MPI_Win *win );
+HYPRE_Int hypre_MPI_Win_shared_query( hypre_MPI_Win win, HYPRE_Int rank, hypre_MPI_Aint *size,
+                                      HYPRE_Int *disp_unit, void *baseptr );
+HYPRE_Int hypre_MPI_Win_lock_all( HYPRE_Int mode, hypre_MPI_Win win );
+HYPRE_Int hypre_MPI_Win_unlock_all( hypre_MPI_Win win );
+HYPRE_Int hypre_MPI_Win_sync( hypre_MPI_Win win );
+HYPRE_Int hypre_MPI_Win_free( hypre_MPI_Win *win );
+#if defined(HYPRE_USING_GPU)
 HYPRE_Int hypre_MPI_Info_create(hypre_MPI_Info *info);
 HYPRE_Int hypre_MPI_Info_free( hypre_MPI_Info *info );
 #endif
@@ -1364,14 +1405,75 @@ static char hypre__markname[1024];
 #ifndef HYPRE_HANDLE_H
 #define HYPRE_HANDLE_H
 
+/* maximum number of request sets polled by hypre_CommProgress */
+#define HYPRE_MAX_PROGRESS_SETS 16
+
 struct hypre_DeviceData;
 typedef struct hypre_DeviceData hypre_DeviceData;
 
+/* Shared-memory window on the ranks of a group, whose segments are handed out
+   to the halo exchange schedules of the group, see hypre_NodeCommShmAlloc */
+typedef struct hypre_ShmWindow_struct
+{
+   hypre_MPI_Win                  win;
+   HYPRE_Complex                 *base;         /* segment of this rank */
+   HYPRE_Int                      size;         /* length of the segment of this rank */
+   HYPRE_Int                      used;         /* length handed out */
+   HYPRE_Int                      num_users;    /* schedules using the segment */
+   struct hypre_ShmWindow_struct *next;
+} hypre_ShmWindow;
+
+#define hypre_ShmWindowWin(shm_win)          ((shm_win) -> win)
+#define hypre_ShmWindowBase(shm_win)         ((shm_win) -> base)
+#define hypre_ShmWindowSize(shm_win)         ((shm_win) -> size)
+#define hypre_ShmWindowUsed(shm_win)         ((shm_win) -> used)
+#define hypre_ShmWindowNumUsers(shm_win)     ((shm_win) -> num_users)
+#define hypre_ShmWindowNext(shm_win)         ((shm_win) -> next)
+
+/* Node and group communicators derived from a parent communicator, built once
+   per group of ranks and group size, see hypre_NodeCommGet */
+typedef struct hypre_NodeComm_struct
+{
+   hypre_MPI_Comm                 comm;         /* duplicate of the parent communicator */
+   HYPRE_Int                      group_size;   /* see HYPRE_SetNodeAwareComm */
+   hypre_MPI_Comm                 group_comm;   /* ranks of the group of this rank */
+   hypre_MPI_Comm                 leader_comm;  /* group leaders (COMM_NULL on the others) */
+   HYPRE_Int                      leader;       /* rank in comm of the leader of the group */
+   HYPRE_Int                      num_groups;
+   HYPRE_Int                     *leaders;      /* leader of every rank of comm */
+   HYPRE_Int                      num_leaders;
+   HYPRE_Int                     *leader_ids;   /* rank in comm of every rank of leader_comm */
+   hypre_ShmWindow               *shm_windows;  /* on group_comm, newest first */
+   struct hypre_NodeComm_struct  *next;
+} hypre_NodeComm;
+
+#define hypre_NodeCommComm(node_comm)        ((node_comm) -> comm)
+#define hypre_NodeCommGroupSize(node_comm)   ((node_comm) -> group_size)
+#define hypre_NodeCommGroupComm(node_comm)   ((node_comm) -> group_comm)
+#define hypre_NodeCommLeaderComm(node_comm)  ((node_comm) -> leader_comm)
+#define hypre_NodeCommLeader(node_comm)      ((node_comm) -> leader)
+#define hypre_NodeCommNumGroups(node_comm)   ((node_comm) -> num_groups)
+#define hypre_NodeCommLeaders(node_comm)     ((node_comm) -> leaders)
+#define hypre_NodeCommNumLeaders(node_comm)  ((node_comm) -> num_leaders)
+#define hypre_NodeCommLeaderIds(node_comm)   ((node_comm) -> leader_ids)
+#define hypre_NodeCommShmWindows(node_comm)  ((node_comm) -> shm_windows)
+#define hypre_NodeCommNext(node_comm)        ((node_comm) -> next)
+
 typedef struct
 {
    HYPRE_Int              hypre_error;
    HYPRE_MemoryLocation   memory_location;
    HYPRE_ExecutionPolicy  default_exec_policy;
+   /* node-aware halo exchange: 0 off, 1 per node, n > 1 per group of n ranks */
+   HYPRE_Int              node_aware_comm;
+   hypre_NodeComm        *node_comms;
+   /* on-node halo values through MPI shared-memory windows: 0 off, 1 on */
+   HYPRE_Int              shared_mem_comm;
+   /* MPI progress polling in long local loops: rows between polls, 0 off */
+   HYPRE_Int              comm_progress;
+   HYPRE_Int              num_progress_sets;
+   HYPRE_Int              progress_num_requests[HYPRE_MAX_PROGRESS_SETS];
+   hypre_MPI_Request     *progress_requests[HYPRE_MAX_PROGRESS_SETS];
 #if defined(HYPRE_USING_GPU)
    hypre_DeviceData      *device_data;
    /* device G-S options */
@@ -1401,6 +1503,13 @@ typedef struct
 /* accessor macros to hypre_Handle */
 #define hypre_HandleMemoryLocation(hypre_handle)                 ((hypre_handle) -> memory_location)
 #define hypre_HandleDefaultExecPolicy(hypre_handle)              ((hypre_handle) -> default_exec_policy)
+#define hypre_HandleNodeAwareComm(hypre_handle)                  ((hypre_handle) -> node_aware_comm)
+#define hypre_HandleNodeComms(hypre_handle)                     ((hypre_handle) -> node_comms)
+#define hypre_HandleSharedMemComm(hypre_handle)                  ((hypre_handle) -> shared_mem_comm)
+#define hypre_HandleCommProgress(hypre_handle)                   ((hypre_handle) -> comm_progress)
+#define hypre_HandleNumProgressSets(hypre_handle)                ((hypre_handle) -> num_progress_sets)
+#define hypre_HandleProgressNumRequests(hypre_handle)            ((hypre_handle) -> progress_num_requests)
+#define hypre_HandleProgressRequests(hypre_handle)               ((hypre_handle) -> progress_requests)
 #define hypre_HandleDeviceData(hypre_handle)                     ((hypre_handle) -> device_data)
 #define hypre_HandleDeviceGSMethod(hypre_handle)                 ((hypre_handle) -> device_gs_method)
 
@@ -1833,6 +1942,17 @@ void hypre_sort_and_create_inverse_map(HYPRE_Int *in, HYPRE_Int len, HYPRE_Int *
 void hypre_big_sort_and_create_inverse_map(HYPRE_BigInt *in, HYPRE_Int len, HYPRE_BigInt **out,
                                            hypre_UnorderedBigIntMap *inverse_map);
 
+/* col_map.c */
+HYPRE_Int hypre_GlobalToLocalColumns( HYPRE_Int num_big_j, HYPRE_BigInt *big_j, HYPRE_Int num_extra,
+                                      HYPRE_BigInt *extra, HYPRE_Int *j, HYPRE_Int *extra_map,
+                                      HYPRE_Int *num_cols_ptr, HYPRE_BigInt **col_map_ptr );
+
+/* sort.c */
+void hypre_IntSort( HYPRE_Int *keys, HYPRE_Int *vals, HYPRE_Int n );
+void hypre_BigIntSort( HYPRE_BigInt *keys, HYPRE_Int *vals, HYPRE_Int n );
+HYPRE_Int hypre_IntSortUnique( HYPRE_Int *keys, HYPRE_Int n );
+HYPRE_Int hypre_BigIntSortUnique( HYPRE_BigInt *keys, HYPRE_Int n );
+
 /* device_utils.c */
 #if defined(HYPRE_USING_GPU)
 HYPRE_Int hypre_SyncComputeStream(hypre_Handle *hypre_handle);
@@ -1924,6 +2044,17 @@ HYPRE_Int hypre_SyncComputeStream(hypre_Handle *hypre_handle);
 HYPRE_Int hypre_ForceSyncComputeStream(hypre_Handle *hypre_handle);
 
 /* handle.c */
+HYPRE_Int hypre_SetNodeAwareComm( HYPRE_Int value );
+HYPRE_Int hypre_SetSharedMemComm( HYPRE_Int value );
+hypre_NodeComm *hypre_NodeCommGet( MPI_Comm comm, HYPRE_Int group_size );
+hypre_ShmWindow *hypre_NodeCommShmAlloc( hypre_NodeComm *node_comm, HYPRE_Int size,
+                                         HYPRE_Int *offset_ptr );
+HYPRE_Int hypre_NodeCommShmRelease( hypre_ShmWindow *shm_win );
+HYPRE_Int hypre_NodeCommsDestroy( hypre_Handle *handle );
+HYPRE_Int hypre_SetCommProgress( HYPRE_Int value );
+HYPRE_Int hypre_CommProgressAdd( HYPRE_Int num_requests, hypre_MPI_Request *requests );
+HYPRE_Int hypre_CommProgressRemove( hypre_MPI_Request *requests );
+HYPRE_Int hypre_CommProgress( void );
 HYPRE_Int hypre_SetSpTransUseVendor( HYPRE_Int use_vendor );
 HYPRE_Int hypre_SetSpMVUseVendor( HYPRE_Int use_vendor );
 HYPRE_Int hypre_SetSpGemmUseVendor( HYPRE_Int use_vendor );
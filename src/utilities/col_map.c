@@ -0,0 +1,200 @@
+/******************************************************************************
+ * Copyright (c) 1998 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Global-to-local column compression for off-diagonal blocks.
+ *
+ * Given the global column indices of the off-diagonal entries produced by a
+ * ParCSR routine, hypre_GlobalToLocalColumns builds the sorted col_map_offd
+ * and the local (compressed) column index of every entry.  With concurrent
+ * hopscotch hashing the unique columns are collected in a hash set and only
+ * those are sorted; otherwise all columns are sorted together with their
+ * positions and the local indices are scattered back.  Both variants are
+ * threaded with OpenMP.
+ *
+ *****************************************************************************/
+
+#include "_hypre_utilities.h"
+
+/*--------------------------------------------------------------------------
+ * hypre_GlobalToLocalColumns
+ *
+ * Compress the global column indices big_j[0:num_big_j-1] and, optionally,
+ * the columns extra[0:num_extra-1] (e.g., the col_map_offd of an operand that
+ * must be kept) into a sorted array of unique columns, returned in col_map_ptr
+ * (NULL if there are none) with its length in num_cols_ptr.
+ *
+ * On output, j[i] is the position of big_j[i] in col_map and extra_map[i] the
+ * position of extra[i].  Either output array may be NULL.  col_map is
+ * allocated in HYPRE_MEMORY_HOST, and all other arrays must be host arrays.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_GlobalToLocalColumns( HYPRE_Int      num_big_j,
+                            HYPRE_BigInt  *big_j,
+                            HYPRE_Int      num_extra,
+                            HYPRE_BigInt  *extra,
+                            HYPRE_Int     *j,
+                            HYPRE_Int     *extra_map,
+                            HYPRE_Int     *num_cols_ptr,
+                            HYPRE_BigInt **col_map_ptr )
+{
+   HYPRE_Int      num_cols = 0;
+   HYPRE_BigInt  *col_map  = NULL;
+   HYPRE_Int      i;
+
+#ifdef HYPRE_CONCURRENT_HOPSCOTCH
+   hypre_UnorderedBigIntSet  set;
+   hypre_UnorderedBigIntMap  inverse_map;
+#else
+   HYPRE_Int                 total = num_big_j + num_extra;
+   HYPRE_BigInt             *keys;
+   HYPRE_Int                *perm;
+   HYPRE_Int                *workspace;
+#endif
+
+   if (num_big_j + num_extra < 1)
+   {
+      *num_cols_ptr = 0;
+      *col_map_ptr  = NULL;
+
+      return hypre_error_flag;
+   }
+
+#ifdef HYPRE_CONCURRENT_HOPSCOTCH
+   /* Collect the unique columns */
+   hypre_UnorderedBigIntSetCreate(&set, num_big_j + num_extra, 16 * hypre_NumThreads());
+
+   #pragma omp parallel private(i)
+   {
+      #pragma omp for HYPRE_SMP_SCHEDULE nowait
+      for (i = 0; i < num_big_j; i++)
+      {
+         hypre_UnorderedBigIntSetPut(&set, big_j[i]);
+      }
+
+      #pragma omp for HYPRE_SMP_SCHEDULE
+      for (i = 0; i < num_extra; i++)
+      {
+         hypre_UnorderedBigIntSetPut(&set, extra[i]);
+      }
+   }
+
+   col_map = hypre_UnorderedBigIntSetCopyToArray(&set, &num_cols);
+   hypre_UnorderedBigIntSetDestroy(&set);
+
+   /* Sort them and map global to local indices through the inverse map */
+   hypre_big_sort_and_create_inverse_map(col_map, num_cols, &col_map, &inverse_map);
+
+   #pragma omp parallel private(i)
+   {
+      if (j)
+      {
+         #pragma omp for HYPRE_SMP_SCHEDULE nowait
+         for (i = 0; i < num_big_j; i++)
+         {
+            j[i] = hypre_UnorderedBigIntMapGet(&inverse_map, big_j[i]);
+         }
+      }
+
+      if (extra_map)
+      {
+         #pragma omp for HYPRE_SMP_SCHEDULE
+         for (i = 0; i < num_extra; i++)
+         {
+            extra_map[i] = hypre_UnorderedBigIntMapGet(&inverse_map, extra[i]);
+         }
+      }
+   }
+
+   hypre_UnorderedBigIntMapDestroy(&inverse_map);
+
+#else /* !HYPRE_CONCURRENT_HOPSCOTCH */
+
+   /* Sort all columns along with their positions */
+   keys = hypre_TAlloc(HYPRE_BigInt, total, HYPRE_MEMORY_HOST);
+   perm = hypre_TAlloc(HYPRE_Int, total, HYPRE_MEMORY_HOST);
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < total; i++)
+   {
+      keys[i] = (i < num_big_j) ? big_j[i] : extra[i - num_big_j];
+      perm[i] = i;
+   }
+
+   hypre_BigIntSort(keys, perm, total);
+
+   /* Number the unique columns and scatter their positions back */
+   workspace = hypre_TAlloc(HYPRE_Int, hypre_NumThreads() + 1, HYPRE_MEMORY_HOST);
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel private(i)
+#endif
+   {
+      HYPRE_Int i_begin, i_end, k, cnt;
+
+      hypre_GetSimpleThreadPartition(&i_begin, &i_end, total);
+
+      cnt = 0;
+      for (i = i_begin; i < i_end; i++)
+      {
+         if (i == 0 || keys[i] != keys[i - 1])
+         {
+            cnt++;
+         }
+      }
+
+      hypre_prefix_sum(&cnt, &num_cols, workspace);
+
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp master
+#endif
+      {
+         col_map = hypre_TAlloc(HYPRE_BigInt, num_cols, HYPRE_MEMORY_HOST);
+      }
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp barrier
+#endif
+
+      /* cnt is now the number of unique columns before this chunk */
+      cnt--;
+      for (i = i_begin; i < i_end; i++)
+      {
+         if (i == 0 || keys[i] != keys[i - 1])
+         {
+            col_map[++cnt] = keys[i];
+         }
+
+         k = perm[i];
+         if (k < num_big_j)
+         {
+            if (j)
+            {
+               j[k] = cnt;
+            }
+         }
+         else if (extra_map)
+         {
+            extra_map[k - num_big_j] = cnt;
+         }
+      }
+   }
+
+   hypre_TFree(workspace, HYPRE_MEMORY_HOST);
+   hypre_TFree(keys, HYPRE_MEMORY_HOST);
+   hypre_TFree(perm, HYPRE_MEMORY_HOST);
+
+#endif /* !HYPRE_CONCURRENT_HOPSCOTCH */
+
+   *num_cols_ptr = num_cols;
+   *col_map_ptr  = col_map;
+
+   return hypre_error_flag;
+}
@@ -71,6 +71,8 @@ hypre_HandleDestroy(hypre_Handle *hypre_handle_)
    hypre_HandleDeviceData(hypre_handle_) = NULL;
 #endif
 
+   hypre_NodeCommsDestroy(hypre_handle_);
+
    hypre_TFree(hypre_handle_, HYPRE_MEMORY_HOST);
 
    return hypre_error_flag;
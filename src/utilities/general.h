@@ -15,6 +15,7 @@
 #define hypre_GENERAL_HEADER
 
 /* This allows us to consistently avoid 'int' throughout hypre */
+typedef short                  hypre_short;
 typedef int                    hypre_int;
 typedef long int               hypre_longint;
 typedef unsigned int           hypre_uint;
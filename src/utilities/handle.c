@@ -14,6 +14,357 @@
 #include "_hypre_utilities.h"
 #include "_hypre_utilities.hpp"
 
+/* smallest segment of a shared-memory window, see hypre_NodeCommShmAlloc */
+#define HYPRE_SHM_WINDOW_MIN_SIZE 4096
+
+/* Node-aware communication */
+HYPRE_Int
+hypre_SetNodeAwareComm( HYPRE_Int value )
+{
+   if (value < 0)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   hypre_HandleNodeAwareComm(hypre_handle()) = value;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_SetSharedMemComm( HYPRE_Int value )
+{
+   if (value < 0)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   hypre_HandleSharedMemComm(hypre_handle()) = value;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_NodeCommGet
+ *
+ * Returns the node and group communicators of comm for the given group size
+ * (see HYPRE_SetNodeAwareComm), building them on first use.  They are cached
+ * in the handle for any communicator with the same ranks in the same order,
+ * together with the shared-memory windows of the groups, and freed by
+ * HYPRE_Finalize.  The lookup is local, and every rank of comm
+ * holds the same cache entries for comm, since they are built collectively,
+ * so either all ranks of comm or none take the collective branch.
+ *--------------------------------------------------------------------------*/
+
+hypre_NodeComm *
+hypre_NodeCommGet( MPI_Comm   comm,
+                   HYPRE_Int  group_size )
+{
+   hypre_Handle    *handle = hypre_handle();
+   hypre_NodeComm  *node_comm;
+   hypre_MPI_Comm   split_comm;
+   hypre_MPI_Comm   group_comm;
+   HYPRE_Int        my_id, num_procs, node_id, leader, result, i;
+
+   for (node_comm = hypre_HandleNodeComms(handle); node_comm;
+        node_comm = hypre_NodeCommNext(node_comm))
+   {
+      if (hypre_NodeCommGroupSize(node_comm) == group_size)
+      {
+         hypre_MPI_Comm_compare(comm, hypre_NodeCommComm(node_comm), &result);
+         if (result == hypre_MPI_IDENT || result == hypre_MPI_CONGRUENT)
+         {
+            return node_comm;
+         }
+      }
+   }
+
+   node_comm = hypre_CTAlloc(hypre_NodeComm, 1, HYPRE_MEMORY_HOST);
+   hypre_MPI_Comm_dup(comm, &hypre_NodeCommComm(node_comm));
+   hypre_NodeCommGroupSize(node_comm) = group_size;
+   comm = hypre_NodeCommComm(node_comm);
+
+   hypre_MPI_Comm_rank(comm, &my_id);
+   hypre_MPI_Comm_size(comm, &num_procs);
+
+   /* Groups of at most group_size ranks of a node (the whole node if 1) */
+   hypre_MPI_Comm_split_type(comm, hypre_MPI_COMM_TYPE_SHARED, my_id,
+                             hypre_MPI_INFO_NULL, &split_comm);
+   if (group_size > 1)
+   {
+      hypre_MPI_Comm_rank(split_comm, &node_id);
+      hypre_MPI_Comm_split(split_comm, node_id / group_size, node_id, &group_comm);
+      hypre_MPI_Comm_free(&split_comm);
+   }
+   else
+   {
+      group_comm = split_comm;
+   }
+   hypre_NodeCommGroupComm(node_comm) = group_comm;
+
+   leader = my_id;
+   hypre_MPI_Bcast(&leader, 1, HYPRE_MPI_INT, 0, group_comm);
+   hypre_NodeCommLeader(node_comm) = leader;
+
+   hypre_NodeCommLeaders(node_comm) = hypre_TAlloc(HYPRE_Int, num_procs, HYPRE_MEMORY_HOST);
+   hypre_MPI_Allgather(&leader, 1, HYPRE_MPI_INT,
+                       hypre_NodeCommLeaders(node_comm), 1, HYPRE_MPI_INT, comm);
+   for (i = 0; i < num_procs; i++)
+   {
+      if (hypre_NodeCommLeaders(node_comm)[i] == i)
+      {
+         hypre_NodeCommNumGroups(node_comm)++;
+      }
+   }
+
+   /* leader_ids is sorted, since the ranks of leader_comm follow my_id */
+   hypre_MPI_Comm_split(comm, (leader == my_id) ? 0 : hypre_MPI_UNDEFINED, my_id,
+                        &hypre_NodeCommLeaderComm(node_comm));
+   if (leader == my_id)
+   {
+      hypre_MPI_Comm_size(hypre_NodeCommLeaderComm(node_comm),
+                          &hypre_NodeCommNumLeaders(node_comm));
+      hypre_NodeCommLeaderIds(node_comm) = hypre_TAlloc(HYPRE_Int,
+                                                        hypre_NodeCommNumLeaders(node_comm),
+                                                        HYPRE_MEMORY_HOST);
+      hypre_MPI_Allgather(&my_id, 1, HYPRE_MPI_INT,
+                          hypre_NodeCommLeaderIds(node_comm), 1, HYPRE_MPI_INT,
+                          hypre_NodeCommLeaderComm(node_comm));
+   }
+
+   hypre_NodeCommNext(node_comm) = hypre_HandleNodeComms(handle);
+   hypre_HandleNodeComms(handle) = node_comm;
+
+   return node_comm;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_NodeCommShmAlloc
+ *
+ * Hands out size entries of the segment of this rank in the newest
+ * shared-memory window of the group of node_comm, and returns the window
+ * with the start of the entries in *offset_ptr.  If the entries of some rank
+ * do not fit, all ranks of the group allocate a new window whose segments
+ * are at least twice as large as before, so that all of them get the same
+ * window.  Collective on the group communicator.  Returns NULL if no rank
+ * needs any entries.
+ *--------------------------------------------------------------------------*/
+
+hypre_ShmWindow *
+hypre_NodeCommShmAlloc( hypre_NodeComm  *node_comm,
+                        HYPRE_Int        size,
+                        HYPRE_Int       *offset_ptr )
+{
+   hypre_MPI_Comm    group_comm = hypre_NodeCommGroupComm(node_comm);
+   hypre_ShmWindow  *shm_win    = hypre_NodeCommShmWindows(node_comm);
+   HYPRE_Int         fits, all_fit, max_size, win_size;
+
+   fits = (shm_win && hypre_ShmWindowUsed(shm_win) + size <= hypre_ShmWindowSize(shm_win));
+   hypre_MPI_Allreduce(&fits, &all_fit, 1, HYPRE_MPI_INT, hypre_MPI_MIN, group_comm);
+   hypre_MPI_Allreduce(&size, &max_size, 1, HYPRE_MPI_INT, hypre_MPI_MAX, group_comm);
+
+   *offset_ptr = 0;
+   if (max_size == 0)
+   {
+      return NULL;
+   }
+
+   if (!all_fit)
+   {
+      win_size = shm_win ? 2 * hypre_ShmWindowSize(shm_win) : HYPRE_SHM_WINDOW_MIN_SIZE;
+      win_size = hypre_max(win_size, size);
+
+      shm_win = hypre_CTAlloc(hypre_ShmWindow, 1, HYPRE_MEMORY_HOST);
+      hypre_MPI_Win_allocate_shared((hypre_MPI_Aint) win_size * sizeof(HYPRE_Complex),
+                                    sizeof(HYPRE_Complex), hypre_MPI_INFO_NULL, group_comm,
+                                    &hypre_ShmWindowBase(shm_win), &hypre_ShmWindowWin(shm_win));
+      hypre_MPI_Win_lock_all(hypre_MPI_MODE_NOCHECK, hypre_ShmWindowWin(shm_win));
+      hypre_ShmWindowSize(shm_win)        = win_size;
+      hypre_ShmWindowNext(shm_win)        = hypre_NodeCommShmWindows(node_comm);
+      hypre_NodeCommShmWindows(node_comm) = shm_win;
+   }
+
+   *offset_ptr = hypre_ShmWindowUsed(shm_win);
+   hypre_ShmWindowUsed(shm_win) += size;
+   hypre_ShmWindowNumUsers(shm_win)++;
+
+   return shm_win;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_NodeCommShmRelease
+ *
+ * Returns the entries handed out by hypre_NodeCommShmAlloc.  The segment is
+ * reused from its start once all of its users are gone; the window itself
+ * is kept until HYPRE_Finalize.  Local.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_NodeCommShmRelease( hypre_ShmWindow *shm_win )
+{
+   if (shm_win && --hypre_ShmWindowNumUsers(shm_win) == 0)
+   {
+      hypre_ShmWindowUsed(shm_win) = 0;
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_NodeCommsDestroy
+ *
+ * Frees the communicators and windows cached by hypre_NodeCommGet.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_NodeCommsDestroy( hypre_Handle *handle )
+{
+   hypre_NodeComm   *node_comm;
+   hypre_ShmWindow  *shm_win;
+
+   while ((node_comm = hypre_HandleNodeComms(handle)) != NULL)
+   {
+      hypre_HandleNodeComms(handle) = hypre_NodeCommNext(node_comm);
+
+      while ((shm_win = hypre_NodeCommShmWindows(node_comm)) != NULL)
+      {
+         hypre_NodeCommShmWindows(node_comm) = hypre_ShmWindowNext(shm_win);
+         hypre_MPI_Win_unlock_all(hypre_ShmWindowWin(shm_win));
+         hypre_MPI_Win_free(&hypre_ShmWindowWin(shm_win));
+         hypre_TFree(shm_win, HYPRE_MEMORY_HOST);
+      }
+
+      if (hypre_NodeCommLeaderComm(node_comm) != hypre_MPI_COMM_NULL)
+      {
+         hypre_MPI_Comm_free(&hypre_NodeCommLeaderComm(node_comm));
+      }
+      hypre_MPI_Comm_free(&hypre_NodeCommGroupComm(node_comm));
+      hypre_MPI_Comm_free(&hypre_NodeCommComm(node_comm));
+      hypre_TFree(hypre_NodeCommLeaders(node_comm), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_NodeCommLeaderIds(node_comm), HYPRE_MEMORY_HOST);
+      hypre_TFree(node_comm, HYPRE_MEMORY_HOST);
+   }
+
+   return hypre_error_flag;
+}
+
+/* MPI progress polling */
+HYPRE_Int
+hypre_SetCommProgress( HYPRE_Int value )
+{
+   if (value < 0)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   hypre_HandleCommProgress(hypre_handle()) = value;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CommProgressAdd
+ *
+ * Register the requests of a pending exchange with hypre_CommProgress.  The
+ * set is ignored if polling is off or the registry is full.
+ *
+ * With OpenMP, the requests are tested by the master thread inside parallel
+ * regions, which needs at least MPI_THREAD_FUNNELED.  Polling is turned off
+ * for good if MPI was initialized with a lower thread level.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CommProgressAdd( HYPRE_Int          num_requests,
+                       hypre_MPI_Request *requests )
+{
+   hypre_Handle *handle = hypre_handle();
+   HYPRE_Int     k      = hypre_HandleNumProgressSets(handle);
+
+#ifdef HYPRE_USING_OPENMP
+   if (hypre_HandleCommProgress(handle) > 0 && k == 0)
+   {
+      HYPRE_Int provided;
+
+      hypre_MPI_Query_thread(&provided);
+      if (provided < hypre_MPI_THREAD_FUNNELED)
+      {
+         hypre_HandleCommProgress(handle) = 0;
+      }
+   }
+#endif
+
+   if (hypre_HandleCommProgress(handle) < 1 || num_requests < 1 ||
+       k >= HYPRE_MAX_PROGRESS_SETS)
+   {
+      return hypre_error_flag;
+   }
+
+   hypre_HandleProgressNumRequests(handle)[k] = num_requests;
+   hypre_HandleProgressRequests(handle)[k]    = requests;
+   hypre_HandleNumProgressSets(handle)        = k + 1;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CommProgressRemove
+ *
+ * Unregister a request set before it is waited on or freed.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CommProgressRemove( hypre_MPI_Request *requests )
+{
+   hypre_Handle *handle = hypre_handle();
+   HYPRE_Int     num_sets = hypre_HandleNumProgressSets(handle);
+   HYPRE_Int     k;
+
+   for (k = 0; k < num_sets; k++)
+   {
+      if (hypre_HandleProgressRequests(handle)[k] == requests)
+      {
+         num_sets--;
+         hypre_HandleProgressNumRequests(handle)[k] =
+            hypre_HandleProgressNumRequests(handle)[num_sets];
+         hypre_HandleProgressRequests(handle)[k] =
+            hypre_HandleProgressRequests(handle)[num_sets];
+         hypre_HandleNumProgressSets(handle) = num_sets;
+         break;
+      }
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CommProgress
+ *
+ * Test all registered requests so that the MPI library advances them.
+ * Completed requests are set to hypre_MPI_REQUEST_NULL, which the final
+ * waits accept.  Must be called by one thread only, and only by the master
+ * thread inside parallel regions (see hypre_CommProgressAdd).
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CommProgress( void )
+{
+   hypre_Handle *handle = hypre_handle();
+   HYPRE_Int     num_sets = hypre_HandleNumProgressSets(handle);
+   HYPRE_Int     k, flag;
+
+   for (k = 0; k < num_sets; k++)
+   {
+      hypre_MPI_Testall(hypre_HandleProgressNumRequests(handle)[k],
+                        hypre_HandleProgressRequests(handle)[k],
+                        &flag, hypre_MPI_STATUSES_IGNORE);
+   }
+
+   return hypre_error_flag;
+}
+
 /* GPU SpTrans */
 HYPRE_Int
 hypre_SetSpTransUseVendor( HYPRE_Int use_vendor )
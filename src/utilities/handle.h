@@ -14,14 +14,75 @@
 #ifndef HYPRE_HANDLE_H
 #define HYPRE_HANDLE_H
 
+/* maximum number of request sets polled by hypre_CommProgress */
+#define HYPRE_MAX_PROGRESS_SETS 16
+
 struct hypre_DeviceData;
 typedef struct hypre_DeviceData hypre_DeviceData;
 
+/* Shared-memory window on the ranks of a group, whose segments are handed out
+   to the halo exchange schedules of the group, see hypre_NodeCommShmAlloc */
+typedef struct hypre_ShmWindow_struct
+{
+   hypre_MPI_Win                  win;
+   HYPRE_Complex                 *base;         /* segment of this rank */
+   HYPRE_Int                      size;         /* length of the segment of this rank */
+   HYPRE_Int                      used;         /* length handed out */
+   HYPRE_Int                      num_users;    /* schedules using the segment */
+   struct hypre_ShmWindow_struct *next;
+} hypre_ShmWindow;
+
+#define hypre_ShmWindowWin(shm_win)          ((shm_win) -> win)
+#define hypre_ShmWindowBase(shm_win)         ((shm_win) -> base)
+#define hypre_ShmWindowSize(shm_win)         ((shm_win) -> size)
+#define hypre_ShmWindowUsed(shm_win)         ((shm_win) -> used)
+#define hypre_ShmWindowNumUsers(shm_win)     ((shm_win) -> num_users)
+#define hypre_ShmWindowNext(shm_win)         ((shm_win) -> next)
+
+/* Node and group communicators derived from a parent communicator, built once
+   per group of ranks and group size, see hypre_NodeCommGet */
+typedef struct hypre_NodeComm_struct
+{
+   hypre_MPI_Comm                 comm;         /* duplicate of the parent communicator */
+   HYPRE_Int                      group_size;   /* see HYPRE_SetNodeAwareComm */
+   hypre_MPI_Comm                 group_comm;   /* ranks of the group of this rank */
+   hypre_MPI_Comm                 leader_comm;  /* group leaders (COMM_NULL on the others) */
+   HYPRE_Int                      leader;       /* rank in comm of the leader of the group */
+   HYPRE_Int                      num_groups;
+   HYPRE_Int                     *leaders;      /* leader of every rank of comm */
+   HYPRE_Int                      num_leaders;
+   HYPRE_Int                     *leader_ids;   /* rank in comm of every rank of leader_comm */
+   hypre_ShmWindow               *shm_windows;  /* on group_comm, newest first */
+   struct hypre_NodeComm_struct  *next;
+} hypre_NodeComm;
+
+#define hypre_NodeCommComm(node_comm)        ((node_comm) -> comm)
+#define hypre_NodeCommGroupSize(node_comm)   ((node_comm) -> group_size)
+#define hypre_NodeCommGroupComm(node_comm)   ((node_comm) -> group_comm)
+#define hypre_NodeCommLeaderComm(node_comm)  ((node_comm) -> leader_comm)
+#define hypre_NodeCommLeader(node_comm)      ((node_comm) -> leader)
+#define hypre_NodeCommNumGroups(node_comm)   ((node_comm) -> num_groups)
+#define hypre_NodeCommLeaders(node_comm)     ((node_comm) -> leaders)
+#define hypre_NodeCommNumLeaders(node_comm)  ((node_comm) -> num_leaders)
+#define hypre_NodeCommLeaderIds(node_comm)   ((node_comm) -> leader_ids)
+#define hypre_NodeCommShmWindows(node_comm)  ((node_comm) -> shm_windows)
+#define hypre_NodeCommNext(node_comm)        ((node_comm) -> next)
+
 typedef struct
 {
    HYPRE_Int              hypre_error;
    HYPRE_MemoryLocation   memory_location;
    HYPRE_ExecutionPolicy  default_exec_policy;
+   /* node-aware halo exchange: 0 off, 1 per node, n > 1 per group of n ranks */
+   HYPRE_Int              node_aware_comm;
+   hypre_NodeComm        *node_comms;
+   /* on-node halo values through MPI shared-memory windows: 0 off, 1 on */
+   HYPRE_Int              shared_mem_comm;
+   /* MPI progress polling in long local loops: rows between polls, 0 off */
+   HYPRE_Int              comm_progress;
+   HYPRE_Int              num_progress_sets;
+   HYPRE_Int              progress_num_requests[HYPRE_MAX_PROGRESS_SETS];
+   hypre_MPI_Request     *progress_requests[HYPRE_MAX_PROGRESS_SETS];
 #if defined(HYPRE_USING_GPU)
    hypre_DeviceData      *device_data;
    /* device G-S options */
@@ -51,6 +112,13 @@ typedef struct
 /* accessor macros to hypre_Handle */
 #define hypre_HandleMemoryLocation(hypre_handle)                 ((hypre_handle) -> memory_location)
 #define hypre_HandleDefaultExecPolicy(hypre_handle)              ((hypre_handle) -> default_exec_policy)
+#define hypre_HandleNodeAwareComm(hypre_handle)                  ((hypre_handle) -> node_aware_comm)
+#define hypre_HandleNodeComms(hypre_handle)                     ((hypre_handle) -> node_comms)
+#define hypre_HandleSharedMemComm(hypre_handle)                  ((hypre_handle) -> shared_mem_comm)
+#define hypre_HandleCommProgress(hypre_handle)                   ((hypre_handle) -> comm_progress)
+#define hypre_HandleNumProgressSets(hypre_handle)                ((hypre_handle) -> num_progress_sets)
+#define hypre_HandleProgressNumRequests(hypre_handle)            ((hypre_handle) -> progress_num_requests)
+#define hypre_HandleProgressRequests(hypre_handle)               ((hypre_handle) -> progress_requests)
 #define hypre_HandleDeviceData(hypre_handle)                     ((hypre_handle) -> device_data)
 #define hypre_HandleDeviceGSMethod(hypre_handle)                 ((hypre_handle) -> device_gs_method)
 
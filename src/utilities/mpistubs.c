@@ -37,6 +37,16 @@ hypre_MPI_Init( hypre_int   *argc,
    return (0);
 }
 
+HYPRE_Int
+hypre_MPI_Init_thread( hypre_int   *argc,
+                       char      ***argv,
+                       HYPRE_Int    required,
+                       HYPRE_Int   *provided )
+{
+   *provided = hypre_MPI_THREAD_MULTIPLE;
+   return (0);
+}
+
 HYPRE_Int
 hypre_MPI_Finalize( void )
 {
@@ -735,13 +745,77 @@ hypre_MPI_Op_free( hypre_MPI_Op *op )
    return (0);
 }
 
-#if defined(HYPRE_USING_GPU)
 HYPRE_Int hypre_MPI_Comm_split_type( hypre_MPI_Comm comm, HYPRE_Int split_type, HYPRE_Int key,
                                      hypre_MPI_Info info, hypre_MPI_Comm *newcomm )
 {
    return (0);
 }
 
+HYPRE_Int
+hypre_MPI_Comm_compare( hypre_MPI_Comm  comm1,
+                        hypre_MPI_Comm  comm2,
+                        HYPRE_Int      *result )
+{
+   *result = hypre_MPI_IDENT;
+   return (0);
+}
+
+HYPRE_Int
+hypre_MPI_Query_thread( HYPRE_Int *provided )
+{
+   *provided = hypre_MPI_THREAD_MULTIPLE;
+   return (0);
+}
+
+HYPRE_Int
+hypre_MPI_Win_allocate_shared( hypre_MPI_Aint  size,
+                               HYPRE_Int       disp_unit,
+                               hypre_MPI_Info  info,
+                               hypre_MPI_Comm  comm,
+                               void           *baseptr,
+                               hypre_MPI_Win  *win )
+{
+   *((void **) baseptr) = NULL;
+   return (0);
+}
+
+HYPRE_Int
+hypre_MPI_Win_shared_query( hypre_MPI_Win   win,
+                            HYPRE_Int       rank,
+                            hypre_MPI_Aint *size,
+                            HYPRE_Int      *disp_unit,
+                            void           *baseptr )
+{
+   *((void **) baseptr) = NULL;
+   return (0);
+}
+
+HYPRE_Int
+hypre_MPI_Win_lock_all( HYPRE_Int     mode,
+                        hypre_MPI_Win win )
+{
+   return (0);
+}
+
+HYPRE_Int
+hypre_MPI_Win_unlock_all( hypre_MPI_Win win )
+{
+   return (0);
+}
+
+HYPRE_Int
+hypre_MPI_Win_sync( hypre_MPI_Win win )
+{
+   return (0);
+}
+
+HYPRE_Int
+hypre_MPI_Win_free( hypre_MPI_Win *win )
+{
+   return (0);
+}
+
+#if defined(HYPRE_USING_GPU)
 HYPRE_Int hypre_MPI_Info_create( hypre_MPI_Info *info )
 {
    return (0);
@@ -766,6 +840,19 @@ hypre_MPI_Init( hypre_int   *argc,
    return (HYPRE_Int) MPI_Init(argc, argv);
 }
 
+HYPRE_Int
+hypre_MPI_Init_thread( hypre_int   *argc,
+                       char      ***argv,
+                       HYPRE_Int    required,
+                       HYPRE_Int   *provided )
+{
+   hypre_int mpi_provided;
+   HYPRE_Int ierr;
+   ierr = (HYPRE_Int) MPI_Init_thread(argc, argv, (hypre_int) required, &mpi_provided);
+   *provided = (HYPRE_Int) mpi_provided;
+   return ierr;
+}
+
 HYPRE_Int
 hypre_MPI_Finalize( void )
 {
@@ -1403,7 +1490,6 @@ hypre_MPI_Op_create( hypre_MPI_User_function *function, hypre_int commute, hypre
    return (HYPRE_Int) MPI_Op_create(function, commute, op);
 }
 
-#if defined(HYPRE_USING_GPU)
 HYPRE_Int
 hypre_MPI_Comm_split_type( hypre_MPI_Comm comm, HYPRE_Int split_type, HYPRE_Int key,
                            hypre_MPI_Info info, hypre_MPI_Comm *newcomm )
@@ -1411,6 +1497,82 @@ hypre_MPI_Comm_split_type( hypre_MPI_Comm comm, HYPRE_Int split_type, HYPRE_Int
    return (HYPRE_Int) MPI_Comm_split_type(comm, split_type, key, info, newcomm );
 }
 
+HYPRE_Int
+hypre_MPI_Comm_compare( hypre_MPI_Comm  comm1,
+                        hypre_MPI_Comm  comm2,
+                        HYPRE_Int      *result )
+{
+   hypre_int mpi_result;
+   HYPRE_Int ierr;
+   ierr = (HYPRE_Int) MPI_Comm_compare(comm1, comm2, &mpi_result);
+   *result = (HYPRE_Int) mpi_result;
+   return ierr;
+}
+
+HYPRE_Int
+hypre_MPI_Query_thread( HYPRE_Int *provided )
+{
+   hypre_int mpi_provided;
+   HYPRE_Int ierr;
+   ierr = (HYPRE_Int) MPI_Query_thread(&mpi_provided);
+   *provided = (HYPRE_Int) mpi_provided;
+   return ierr;
+}
+
+HYPRE_Int
+hypre_MPI_Win_allocate_shared( hypre_MPI_Aint  size,
+                               HYPRE_Int       disp_unit,
+                               hypre_MPI_Info  info,
+                               hypre_MPI_Comm  comm,
+                               void           *baseptr,
+                               hypre_MPI_Win  *win )
+{
+   return (HYPRE_Int) MPI_Win_allocate_shared(size, (hypre_int)disp_unit, info, comm,
+                                              baseptr, win);
+}
+
+HYPRE_Int
+hypre_MPI_Win_shared_query( hypre_MPI_Win   win,
+                            HYPRE_Int       rank,
+                            hypre_MPI_Aint *size,
+                            HYPRE_Int      *disp_unit,
+                            void           *baseptr )
+{
+   hypre_int mpi_disp_unit;
+   HYPRE_Int ierr;
+
+   ierr = (HYPRE_Int) MPI_Win_shared_query(win, (hypre_int)rank, size, &mpi_disp_unit, baseptr);
+   *disp_unit = (HYPRE_Int) mpi_disp_unit;
+
+   return ierr;
+}
+
+HYPRE_Int
+hypre_MPI_Win_lock_all( HYPRE_Int     mode,
+                        hypre_MPI_Win win )
+{
+   return (HYPRE_Int) MPI_Win_lock_all((hypre_int)mode, win);
+}
+
+HYPRE_Int
+hypre_MPI_Win_unlock_all( hypre_MPI_Win win )
+{
+   return (HYPRE_Int) MPI_Win_unlock_all(win);
+}
+
+HYPRE_Int
+hypre_MPI_Win_sync( hypre_MPI_Win win )
+{
+   return (HYPRE_Int) MPI_Win_sync(win);
+}
+
+HYPRE_Int
+hypre_MPI_Win_free( hypre_MPI_Win *win )
+{
+   return (HYPRE_Int) MPI_Win_free(win);
+}
+
+#if defined(HYPRE_USING_GPU)
 HYPRE_Int
 hypre_MPI_Info_create( hypre_MPI_Info *info )
 {
@@ -39,6 +39,7 @@ extern "C" {
 #define MPI_Op              hypre_MPI_Op
 #define MPI_Aint            hypre_MPI_Aint
 #define MPI_Info            hypre_MPI_Info
+#define MPI_Win             hypre_MPI_Win
 
 #define MPI_COMM_WORLD       hypre_MPI_COMM_WORLD
 #define MPI_COMM_NULL        hypre_MPI_COMM_NULL
@@ -74,6 +75,7 @@ extern "C" {
 #define MPI_TAG             hypre_MPI_TAG
 
 #define MPI_Init            hypre_MPI_Init
+#define MPI_Init_thread     hypre_MPI_Init_thread
 #define MPI_Finalize        hypre_MPI_Finalize
 #define MPI_Abort           hypre_MPI_Abort
 #define MPI_Wtime           hypre_MPI_Wtime
@@ -88,6 +90,8 @@ extern "C" {
 #define MPI_Comm_free       hypre_MPI_Comm_free
 #define MPI_Comm_split      hypre_MPI_Comm_split
 #define MPI_Comm_split_type hypre_MPI_Comm_split_type
+#define MPI_Comm_compare    hypre_MPI_Comm_compare
+#define MPI_Query_thread    hypre_MPI_Query_thread
 #define MPI_Group_incl      hypre_MPI_Group_incl
 #define MPI_Group_free      hypre_MPI_Group_free
 #define MPI_Address         hypre_MPI_Address
@@ -129,6 +133,12 @@ extern "C" {
 #define MPI_Op_create       hypre_MPI_Op_create
 #define MPI_User_function   hypre_MPI_User_function
 #define MPI_Info_create     hypre_MPI_Info_create
+#define MPI_Win_allocate_shared hypre_MPI_Win_allocate_shared
+#define MPI_Win_shared_query    hypre_MPI_Win_shared_query
+#define MPI_Win_lock_all    hypre_MPI_Win_lock_all
+#define MPI_Win_unlock_all  hypre_MPI_Win_unlock_all
+#define MPI_Win_sync        hypre_MPI_Win_sync
+#define MPI_Win_free        hypre_MPI_Win_free
 
 /*--------------------------------------------------------------------------
  * Types, etc.
@@ -150,12 +160,20 @@ typedef struct
 typedef HYPRE_Int  hypre_MPI_Op;
 typedef HYPRE_Int  hypre_MPI_Aint;
 typedef HYPRE_Int  hypre_MPI_Info;
+typedef HYPRE_Int  hypre_MPI_Win;
 
 #define  hypre_MPI_COMM_SELF   1
 #define  hypre_MPI_COMM_WORLD  0
 #define  hypre_MPI_COMM_NULL  -1
 
 #define  hypre_MPI_COMM_TYPE_SHARED 0
+#define  hypre_MPI_MODE_NOCHECK     0
+#define  hypre_MPI_IDENT            0
+#define  hypre_MPI_CONGRUENT        1
+#define  hypre_MPI_THREAD_SINGLE     0
+#define  hypre_MPI_THREAD_FUNNELED   1
+#define  hypre_MPI_THREAD_SERIALIZED 2
+#define  hypre_MPI_THREAD_MULTIPLE   3
 
 #define  hypre_MPI_BOTTOM  0x0
 
@@ -198,6 +216,7 @@ typedef MPI_Status   hypre_MPI_Status;
 typedef MPI_Op       hypre_MPI_Op;
 typedef MPI_Aint     hypre_MPI_Aint;
 typedef MPI_Info     hypre_MPI_Info;
+typedef MPI_Win      hypre_MPI_Win;
 typedef MPI_User_function    hypre_MPI_User_function;
 
 #define  hypre_MPI_COMM_WORLD         MPI_COMM_WORLD
@@ -205,6 +224,13 @@ typedef MPI_User_function    hypre_MPI_User_function;
 #define  hypre_MPI_BOTTOM             MPI_BOTTOM
 #define  hypre_MPI_COMM_SELF          MPI_COMM_SELF
 #define  hypre_MPI_COMM_TYPE_SHARED   MPI_COMM_TYPE_SHARED
+#define  hypre_MPI_MODE_NOCHECK       MPI_MODE_NOCHECK
+#define  hypre_MPI_IDENT              MPI_IDENT
+#define  hypre_MPI_CONGRUENT          MPI_CONGRUENT
+#define  hypre_MPI_THREAD_SINGLE      MPI_THREAD_SINGLE
+#define  hypre_MPI_THREAD_FUNNELED    MPI_THREAD_FUNNELED
+#define  hypre_MPI_THREAD_SERIALIZED  MPI_THREAD_SERIALIZED
+#define  hypre_MPI_THREAD_MULTIPLE    MPI_THREAD_MULTIPLE
 
 #define  hypre_MPI_FLOAT   MPI_FLOAT
 #define  hypre_MPI_DOUBLE  MPI_DOUBLE
@@ -247,6 +273,8 @@ typedef MPI_User_function    hypre_MPI_User_function;
 
 /* mpistubs.c */
 HYPRE_Int hypre_MPI_Init( hypre_int *argc, char ***argv );
+HYPRE_Int hypre_MPI_Init_thread( hypre_int *argc, char ***argv, HYPRE_Int required,
+                                 HYPRE_Int *provided );
 HYPRE_Int hypre_MPI_Finalize( void );
 HYPRE_Int hypre_MPI_Abort( hypre_MPI_Comm comm, HYPRE_Int errorcode );
 HYPRE_Real hypre_MPI_Wtime( void );
@@ -337,9 +365,21 @@ HYPRE_Int hypre_MPI_Type_free( hypre_MPI_Datatype *datatype );
 HYPRE_Int hypre_MPI_Op_free( hypre_MPI_Op *op );
 HYPRE_Int hypre_MPI_Op_create( hypre_MPI_User_function *function, hypre_int commute,
                                hypre_MPI_Op *op );
-#if defined(HYPRE_USING_GPU)
 HYPRE_Int hypre_MPI_Comm_split_type(hypre_MPI_Comm comm, HYPRE_Int split_type, HYPRE_Int key,
                                     hypre_MPI_Info info, hypre_MPI_Comm *newcomm);
+HYPRE_Int hypre_MPI_Comm_compare( hypre_MPI_Comm comm1, hypre_MPI_Comm comm2,
+                                  HYPRE_Int *result );
+HYPRE_Int hypre_MPI_Query_thread( HYPRE_Int *provided );
+HYPRE_Int hypre_MPI_Win_allocate_shared( hypre_MPI_Aint size, HYPRE_Int disp_unit,
+                                         hypre_MPI_Info info, hypre_MPI_Comm comm, void *baseptr,
+                                         hypre_MPI_Win *win );
+HYPRE_Int hypre_MPI_Win_shared_query( hypre_MPI_Win win, HYPRE_Int rank, hypre_MPI_Aint *size,
+                                      HYPRE_Int *disp_unit, void *baseptr );
+HYPRE_Int hypre_MPI_Win_lock_all( HYPRE_Int mode, hypre_MPI_Win win );
+HYPRE_Int hypre_MPI_Win_unlock_all( hypre_MPI_Win win );
+HYPRE_Int hypre_MPI_Win_sync( hypre_MPI_Win win );
+HYPRE_Int hypre_MPI_Win_free( hypre_MPI_Win *win );
+#if defined(HYPRE_USING_GPU)
 HYPRE_Int hypre_MPI_Info_create(hypre_MPI_Info *info);
 HYPRE_Int hypre_MPI_Info_free( hypre_MPI_Info *info );
 #endif
@@ -267,6 +267,17 @@ void hypre_sort_and_create_inverse_map(HYPRE_Int *in, HYPRE_Int len, HYPRE_Int *
 void hypre_big_sort_and_create_inverse_map(HYPRE_BigInt *in, HYPRE_Int len, HYPRE_BigInt **out,
                                            hypre_UnorderedBigIntMap *inverse_map);
 
+/* col_map.c */
+HYPRE_Int hypre_GlobalToLocalColumns( HYPRE_Int num_big_j, HYPRE_BigInt *big_j, HYPRE_Int num_extra,
+                                      HYPRE_BigInt *extra, HYPRE_Int *j, HYPRE_Int *extra_map,
+                                      HYPRE_Int *num_cols_ptr, HYPRE_BigInt **col_map_ptr );
+
+/* sort.c */
+void hypre_IntSort( HYPRE_Int *keys, HYPRE_Int *vals, HYPRE_Int n );
+void hypre_BigIntSort( HYPRE_BigInt *keys, HYPRE_Int *vals, HYPRE_Int n );
+HYPRE_Int hypre_IntSortUnique( HYPRE_Int *keys, HYPRE_Int n );
+HYPRE_Int hypre_BigIntSortUnique( HYPRE_BigInt *keys, HYPRE_Int n );
+
 /* device_utils.c */
 #if defined(HYPRE_USING_GPU)
 HYPRE_Int hypre_SyncComputeStream(hypre_Handle *hypre_handle);
@@ -358,6 +369,17 @@ HYPRE_Int hypre_SyncComputeStream(hypre_Handle *hypre_handle);
 HYPRE_Int hypre_ForceSyncComputeStream(hypre_Handle *hypre_handle);
 
 /* handle.c */
+HYPRE_Int hypre_SetNodeAwareComm( HYPRE_Int value );
+HYPRE_Int hypre_SetSharedMemComm( HYPRE_Int value );
+hypre_NodeComm *hypre_NodeCommGet( MPI_Comm comm, HYPRE_Int group_size );
+hypre_ShmWindow *hypre_NodeCommShmAlloc( hypre_NodeComm *node_comm, HYPRE_Int size,
+                                         HYPRE_Int *offset_ptr );
+HYPRE_Int hypre_NodeCommShmRelease( hypre_ShmWindow *shm_win );
+HYPRE_Int hypre_NodeCommsDestroy( hypre_Handle *handle );
+HYPRE_Int hypre_SetCommProgress( HYPRE_Int value );
+HYPRE_Int hypre_CommProgressAdd( HYPRE_Int num_requests, hypre_MPI_Request *requests );
+HYPRE_Int hypre_CommProgressRemove( hypre_MPI_Request *requests );
+HYPRE_Int hypre_CommProgress( void );
 HYPRE_Int hypre_SetSpTransUseVendor( HYPRE_Int use_vendor );
 HYPRE_Int hypre_SetSpMVUseVendor( HYPRE_Int use_vendor );
 HYPRE_Int hypre_SetSpGemmUseVendor( HYPRE_Int use_vendor );
@@ -0,0 +1,542 @@
+/******************************************************************************
+ * Copyright (c) 1998 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Key/value sorting for large setup arrays.
+ *
+ * hypre_IntSort and hypre_BigIntSort pick an algorithm from the array size and
+ * the key range:
+ *
+ *   - short arrays use the recursive quicksorts in qsort.c
+ *   - otherwise an LSD radix sort on the key offsets from the minimum key,
+ *     with one byte per pass and passes only over the significant bytes
+ *   - very wide BigInt key ranges with several threads use a sample sort
+ *
+ * The radix and sample sorts are threaded with OpenMP.  An optional HYPRE_Int
+ * payload (e.g., a permutation) is moved along with the keys.  The order of
+ * equal keys is not specified.
+ *
+ *****************************************************************************/
+
+#include "_hypre_utilities.h"
+
+/* Arrays up to this length are sorted with the recursive quicksorts */
+#define HYPRE_SORT_QSORT_MAX        1024
+
+/* Minimum number of keys handled by each thread */
+#define HYPRE_SORT_THREAD_MIN       16384
+
+#define HYPRE_SORT_RADIX_BITS       8
+#define HYPRE_SORT_RADIX_BUCKETS    (1 << HYPRE_SORT_RADIX_BITS)
+#define HYPRE_SORT_RADIX_MASK       (HYPRE_SORT_RADIX_BUCKETS - 1)
+
+/* Threaded BigInt sorts needing more radix passes than this use sample sort */
+#define HYPRE_SORT_RADIX_MAX_PASSES 4
+
+/*--------------------------------------------------------------------------
+ * hypre_SortNumThreads
+ *
+ * Number of threads (and chunks) used to sort n keys.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_SortNumThreads( HYPRE_Int n )
+{
+   HYPRE_Int num_threads = hypre_NumThreads();
+
+#ifdef HYPRE_USING_OPENMP
+   if (omp_in_parallel())
+   {
+      return 1;
+   }
+#endif
+
+   return hypre_max(1, hypre_min(num_threads, n / HYPRE_SORT_THREAD_MIN));
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_SortNumPasses
+ *
+ * Number of radix passes needed for the key range [0, range].
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_SortNumPasses( hypre_ulonglongint range )
+{
+   HYPRE_Int num_passes = 0;
+
+   while (range)
+   {
+      num_passes++;
+      range >>= HYPRE_SORT_RADIX_BITS;
+   }
+
+   return num_passes;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_SortPrefixCounts
+ *
+ * Turn the per-chunk digit counts into scatter offsets.  Chunks are visited
+ * in order for each digit, which keeps every radix pass stable.
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_SortPrefixCounts( HYPRE_Int  num_chunks,
+                        HYPRE_Int *counts )
+{
+   HYPRE_Int d, t, cnt, sum = 0;
+
+   for (d = 0; d < HYPRE_SORT_RADIX_BUCKETS; d++)
+   {
+      for (t = 0; t < num_chunks; t++)
+      {
+         cnt = counts[t * HYPRE_SORT_RADIX_BUCKETS + d];
+         counts[t * HYPRE_SORT_RADIX_BUCKETS + d] = sum;
+         sum += cnt;
+      }
+   }
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_IntRadixSort, hypre_BigIntRadixSort
+ *
+ * LSD radix sort of keys[0:n-1] on num_passes bytes of the offsets from kmin.
+ * Both functions are generated by HYPRE_SORT_RADIX_SORT, which is only
+ * parametrized by the key type.
+ *--------------------------------------------------------------------------*/
+
+#ifdef HYPRE_USING_OPENMP
+#define HYPRE_SORT_OMP_FOR(...) _Pragma(HYPRE_XSTR(omp parallel for __VA_ARGS__))
+#else
+#define HYPRE_SORT_OMP_FOR(...)
+#endif
+
+#define HYPRE_SORT_RADIX_SORT(name, KeyType)                                         \
+static void                                                                          \
+name( KeyType    *keys,                                                              \
+      HYPRE_Int  *vals,                                                              \
+      HYPRE_Int   n,                                                                 \
+      KeyType     kmin,                                                              \
+      HYPRE_Int   num_passes,                                                        \
+      HYPRE_Int   num_chunks )                                                       \
+{                                                                                    \
+   hypre_ulonglongint  ukmin     = (hypre_ulonglongint) kmin;                        \
+   HYPRE_Int           chunk     = (n + num_chunks - 1) / num_chunks;                \
+   HYPRE_Int          *counts    = hypre_TAlloc(HYPRE_Int,                           \
+                                                num_chunks * HYPRE_SORT_RADIX_BUCKETS, \
+                                                HYPRE_MEMORY_HOST);                  \
+   KeyType            *keys_tmp  = hypre_TAlloc(KeyType, n, HYPRE_MEMORY_HOST);      \
+   HYPRE_Int          *vals_tmp  = vals ? hypre_TAlloc(HYPRE_Int, n, HYPRE_MEMORY_HOST) : NULL; \
+   KeyType            *src_keys  = keys, *dst_keys = keys_tmp, *swap_keys;           \
+   HYPRE_Int          *src_vals  = vals, *dst_vals = vals_tmp, *swap_vals;           \
+   HYPRE_Int           pass, shift, t, i, d, begin, end, *cnt;                       \
+                                                                                     \
+   for (pass = 0; pass < num_passes; pass++)                                         \
+   {                                                                                 \
+      shift = pass * HYPRE_SORT_RADIX_BITS;                                          \
+                                                                                     \
+      HYPRE_SORT_OMP_FOR(private(t, i, d, begin, end, cnt) schedule(static) if (num_chunks > 1)) \
+      for (t = 0; t < num_chunks; t++)                                               \
+      {                                                                              \
+         begin = hypre_min(t * chunk, n);                                            \
+         end   = hypre_min(begin + chunk, n);                                        \
+         cnt   = counts + t * HYPRE_SORT_RADIX_BUCKETS;                              \
+         for (d = 0; d < HYPRE_SORT_RADIX_BUCKETS; d++)                              \
+         {                                                                           \
+            cnt[d] = 0;                                                              \
+         }                                                                           \
+         for (i = begin; i < end; i++)                                               \
+         {                                                                           \
+            cnt[(((hypre_ulonglongint) src_keys[i] - ukmin) >> shift) & HYPRE_SORT_RADIX_MASK]++; \
+         }                                                                           \
+      }                                                                              \
+                                                                                     \
+      hypre_SortPrefixCounts(num_chunks, counts);                                    \
+                                                                                     \
+      HYPRE_SORT_OMP_FOR(private(t, i, d, begin, end, cnt) schedule(static) if (num_chunks > 1)) \
+      for (t = 0; t < num_chunks; t++)                                               \
+      {                                                                              \
+         begin = hypre_min(t * chunk, n);                                            \
+         end   = hypre_min(begin + chunk, n);                                        \
+         cnt   = counts + t * HYPRE_SORT_RADIX_BUCKETS;                              \
+         for (i = begin; i < end; i++)                                               \
+         {                                                                           \
+            d = (HYPRE_Int) ((((hypre_ulonglongint) src_keys[i] - ukmin) >> shift) & \
+                             HYPRE_SORT_RADIX_MASK);                                 \
+            dst_keys[cnt[d]] = src_keys[i];                                          \
+            if (vals)                                                                \
+            {                                                                        \
+               dst_vals[cnt[d]] = src_vals[i];                                       \
+            }                                                                        \
+            cnt[d]++;                                                                \
+         }                                                                           \
+      }                                                                              \
+                                                                                     \
+      swap_keys = src_keys; src_keys = dst_keys; dst_keys = swap_keys;               \
+      swap_vals = src_vals; src_vals = dst_vals; dst_vals = swap_vals;               \
+   }                                                                                 \
+                                                                                     \
+   if (src_keys != keys)                                                             \
+   {                                                                                 \
+      HYPRE_SORT_OMP_FOR(private(i) HYPRE_SMP_SCHEDULE if (num_chunks > 1))          \
+      for (i = 0; i < n; i++)                                                        \
+      {                                                                              \
+         keys[i] = src_keys[i];                                                      \
+         if (vals)                                                                   \
+         {                                                                           \
+            vals[i] = src_vals[i];                                                   \
+         }                                                                           \
+      }                                                                              \
+   }                                                                                 \
+                                                                                     \
+   hypre_TFree(counts, HYPRE_MEMORY_HOST);                                           \
+   hypre_TFree(keys_tmp, HYPRE_MEMORY_HOST);                                         \
+   hypre_TFree(vals_tmp, HYPRE_MEMORY_HOST);                                         \
+}
+
+HYPRE_SORT_RADIX_SORT(hypre_IntRadixSort, HYPRE_Int)
+HYPRE_SORT_RADIX_SORT(hypre_BigIntRadixSort, HYPRE_BigInt)
+
+/*--------------------------------------------------------------------------
+ * hypre_BigIntLowerBound
+ *
+ * First position in the sorted range [begin, end) whose key is >= value.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_BigIntLowerBound( HYPRE_BigInt *keys,
+                        HYPRE_Int     begin,
+                        HYPRE_Int     end,
+                        HYPRE_BigInt  value )
+{
+   HYPRE_Int mid;
+
+   while (begin < end)
+   {
+      mid = begin + (end - begin) / 2;
+      if (keys[mid] < value)
+      {
+         begin = mid + 1;
+      }
+      else
+      {
+         end = mid;
+      }
+   }
+
+   return begin;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BigIntSampleSort
+ *
+ * Each of the num_chunks chunks is sorted locally, num_chunks - 1 splitters
+ * are chosen from a regular sample of the sorted chunks, the chunk pieces are
+ * scattered into their buckets, and each bucket is sorted independently.
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_BigIntSampleSort( HYPRE_BigInt *keys,
+                        HYPRE_Int    *vals,
+                        HYPRE_Int     n,
+                        HYPRE_Int     num_chunks )
+{
+   HYPRE_Int      chunk      = (n + num_chunks - 1) / num_chunks;
+   HYPRE_Int      stride     = num_chunks + 1;
+   HYPRE_Int      num_samples = 0;
+   HYPRE_BigInt  *samples    = hypre_TAlloc(HYPRE_BigInt, num_chunks * num_chunks,
+                                            HYPRE_MEMORY_HOST);
+   HYPRE_BigInt  *splitters  = hypre_TAlloc(HYPRE_BigInt, num_chunks, HYPRE_MEMORY_HOST);
+   HYPRE_Int     *bounds     = hypre_TAlloc(HYPRE_Int, num_chunks * stride, HYPRE_MEMORY_HOST);
+   HYPRE_Int     *offsets    = hypre_TAlloc(HYPRE_Int, num_chunks * num_chunks, HYPRE_MEMORY_HOST);
+   HYPRE_Int     *bucket_starts = hypre_TAlloc(HYPRE_Int, num_chunks + 1, HYPRE_MEMORY_HOST);
+   HYPRE_BigInt  *keys_tmp   = hypre_TAlloc(HYPRE_BigInt, n, HYPRE_MEMORY_HOST);
+   HYPRE_Int     *vals_tmp   = vals ? hypre_TAlloc(HYPRE_Int, n, HYPRE_MEMORY_HOST) : NULL;
+   HYPRE_Int      t, k, s, i, j, begin, end, size, sum;
+
+   /* Sort each chunk locally */
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(t, begin, end) schedule(static)
+#endif
+   for (t = 0; t < num_chunks; t++)
+   {
+      begin = hypre_min(t * chunk, n);
+      end   = hypre_min(begin + chunk, n);
+      if (vals)
+      {
+         hypre_BigQsortbi(keys, vals, begin, end - 1);
+      }
+      else
+      {
+         hypre_BigQsort0(keys, begin, end - 1);
+      }
+   }
+
+   /* Pick splitters from a regular sample of the sorted chunks */
+   for (t = 0; t < num_chunks; t++)
+   {
+      begin = hypre_min(t * chunk, n);
+      end   = hypre_min(begin + chunk, n);
+      size  = end - begin;
+      if (size > 0)
+      {
+         for (s = 1; s < num_chunks; s++)
+         {
+            samples[num_samples++] = keys[begin + (HYPRE_Int) ((HYPRE_BigInt) size * s / num_chunks)];
+         }
+      }
+   }
+   hypre_BigQsort0(samples, 0, num_samples - 1);
+   for (k = 0; k < num_chunks - 1; k++)
+   {
+      splitters[k] = samples[(HYPRE_Int) ((HYPRE_BigInt) num_samples * (k + 1) / num_chunks)];
+   }
+
+   /* Split each chunk into its pieces for the buckets */
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(t, k, begin, end) schedule(static)
+#endif
+   for (t = 0; t < num_chunks; t++)
+   {
+      begin = hypre_min(t * chunk, n);
+      end   = hypre_min(begin + chunk, n);
+      bounds[t * stride] = begin;
+      for (k = 0; k < num_chunks - 1; k++)
+      {
+         begin = hypre_BigIntLowerBound(keys, begin, end, splitters[k]);
+         bounds[t * stride + k + 1] = begin;
+      }
+      bounds[t * stride + num_chunks] = end;
+   }
+
+   /* Bucket k collects piece k of every chunk, in chunk order */
+   sum = 0;
+   for (k = 0; k < num_chunks; k++)
+   {
+      bucket_starts[k] = sum;
+      for (t = 0; t < num_chunks; t++)
+      {
+         offsets[t * num_chunks + k] = sum;
+         sum += bounds[t * stride + k + 1] - bounds[t * stride + k];
+      }
+   }
+   bucket_starts[num_chunks] = sum;
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(t, k, i, j) schedule(static)
+#endif
+   for (t = 0; t < num_chunks; t++)
+   {
+      for (k = 0; k < num_chunks; k++)
+      {
+         j = offsets[t * num_chunks + k];
+         for (i = bounds[t * stride + k]; i < bounds[t * stride + k + 1]; i++, j++)
+         {
+            keys_tmp[j] = keys[i];
+            if (vals)
+            {
+               vals_tmp[j] = vals[i];
+            }
+         }
+      }
+   }
+
+   /* Sort each bucket and copy it back */
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(k, i, begin, end) schedule(dynamic)
+#endif
+   for (k = 0; k < num_chunks; k++)
+   {
+      begin = bucket_starts[k];
+      end   = bucket_starts[k + 1];
+      if (vals)
+      {
+         hypre_BigQsortbi(keys_tmp, vals_tmp, begin, end - 1);
+      }
+      else
+      {
+         hypre_BigQsort0(keys_tmp, begin, end - 1);
+      }
+      for (i = begin; i < end; i++)
+      {
+         keys[i] = keys_tmp[i];
+         if (vals)
+         {
+            vals[i] = vals_tmp[i];
+         }
+      }
+   }
+
+   hypre_TFree(samples, HYPRE_MEMORY_HOST);
+   hypre_TFree(splitters, HYPRE_MEMORY_HOST);
+   hypre_TFree(bounds, HYPRE_MEMORY_HOST);
+   hypre_TFree(offsets, HYPRE_MEMORY_HOST);
+   hypre_TFree(bucket_starts, HYPRE_MEMORY_HOST);
+   hypre_TFree(keys_tmp, HYPRE_MEMORY_HOST);
+   hypre_TFree(vals_tmp, HYPRE_MEMORY_HOST);
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_IntSort
+ *
+ * Sort keys[0:n-1] in increasing order.  If vals is not NULL, vals[i] is
+ * moved along with keys[i].
+ *--------------------------------------------------------------------------*/
+
+void
+hypre_IntSort( HYPRE_Int  *keys,
+               HYPRE_Int  *vals,
+               HYPRE_Int   n )
+{
+   HYPRE_Int  kmin, kmax, num_chunks, i;
+
+   if (n <= HYPRE_SORT_QSORT_MAX)
+   {
+      if (vals)
+      {
+         hypre_qsort2i(keys, vals, 0, n - 1);
+      }
+      else
+      {
+         hypre_qsort0(keys, 0, n - 1);
+      }
+      return;
+   }
+
+   num_chunks = hypre_SortNumThreads(n);
+
+   kmin = kmax = keys[0];
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(i) reduction(min:kmin) reduction(max:kmax) HYPRE_SMP_SCHEDULE if (num_chunks > 1)
+#endif
+   for (i = 0; i < n; i++)
+   {
+      kmin = hypre_min(kmin, keys[i]);
+      kmax = hypre_max(kmax, keys[i]);
+   }
+
+   hypre_IntRadixSort(keys, vals, n, kmin,
+                      hypre_SortNumPasses((hypre_ulonglongint) kmax - (hypre_ulonglongint) kmin),
+                      num_chunks);
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BigIntSort
+ *
+ * Sort keys[0:n-1] in increasing order.  If vals is not NULL, vals[i] is
+ * moved along with keys[i].
+ *--------------------------------------------------------------------------*/
+
+void
+hypre_BigIntSort( HYPRE_BigInt *keys,
+                  HYPRE_Int    *vals,
+                  HYPRE_Int     n )
+{
+   HYPRE_BigInt  kmin, kmax;
+   HYPRE_Int     num_chunks, num_passes, i;
+
+   if (n <= HYPRE_SORT_QSORT_MAX)
+   {
+      if (vals)
+      {
+         hypre_BigQsortbi(keys, vals, 0, n - 1);
+      }
+      else
+      {
+         hypre_BigQsort0(keys, 0, n - 1);
+      }
+      return;
+   }
+
+   num_chunks = hypre_SortNumThreads(n);
+
+   kmin = kmax = keys[0];
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(i) reduction(min:kmin) reduction(max:kmax) HYPRE_SMP_SCHEDULE if (num_chunks > 1)
+#endif
+   for (i = 0; i < n; i++)
+   {
+      kmin = hypre_min(kmin, keys[i]);
+      kmax = hypre_max(kmax, keys[i]);
+   }
+   num_passes = hypre_SortNumPasses((hypre_ulonglongint) kmax - (hypre_ulonglongint) kmin);
+
+   if (num_chunks > 1 && num_passes > HYPRE_SORT_RADIX_MAX_PASSES)
+   {
+      hypre_BigIntSampleSort(keys, vals, n, num_chunks);
+   }
+   else
+   {
+      hypre_BigIntRadixSort(keys, vals, n, kmin, num_passes, num_chunks);
+   }
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_IntSortUnique
+ *
+ * Sort keys[0:n-1] and remove duplicates.  Returns the number of unique keys,
+ * which are left in keys[0:return-1].
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_IntSortUnique( HYPRE_Int  *keys,
+                     HYPRE_Int   n )
+{
+   HYPRE_Int i, num_unique;
+
+   if (n < 1)
+   {
+      return 0;
+   }
+
+   hypre_IntSort(keys, NULL, n);
+
+   num_unique = 1;
+   for (i = 1; i < n; i++)
+   {
+      if (keys[i] > keys[num_unique - 1])
+      {
+         keys[num_unique++] = keys[i];
+      }
+   }
+
+   return num_unique;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BigIntSortUnique
+ *
+ * Sort keys[0:n-1] and remove duplicates.  Returns the number of unique keys,
+ * which are left in keys[0:return-1].
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BigIntSortUnique( HYPRE_BigInt *keys,
+                        HYPRE_Int     n )
+{
+   HYPRE_Int i, num_unique;
+
+   if (n < 1)
+   {
+      return 0;
+   }
+
+   hypre_BigIntSort(keys, NULL, n);
+
+   num_unique = 1;
+   for (i = 1; i < n; i++)
+   {
+      if (keys[i] > keys[num_unique - 1])
+      {
+         keys[num_unique++] = keys[i];
+      }
+   }
+
+   return num_unique;
+}